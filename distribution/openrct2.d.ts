@@ -127,6 +127,9 @@ declare global {
     /**
      * Represents information about the plugin such as type, name, author and version.
      * It also includes the entry point.
+     * The time spent running a plugin's code, from loading the script and calling main to every callback, is
+     * measured as wall-clock time per update. Every plugin has the same budget, the update_budget setting in
+     * config.ini (10 ms by default). Going over it is reported in the console and does not stop the plugin.
      */
     interface PluginMetadata {
         name: string;
@@ -252,6 +255,25 @@ declare global {
         executeAction(action: ActionType, args: object, callback: (result: GameActionResult) => void): void;
         executeAction(action: string, args: object, callback: (result: GameActionResult) => void): void;
 
+        /**
+         * Query the combined result of running a list of game actions as a single batch. Every action is
+         * checked against the same map state and the total cost is returned.
+         * @param actions The actions and their parameters.
+         * @param callback The function to be called with the result of the batch.
+         */
+        queryActionBatch(actions: GameActionBatchItem[], callback: (result: GameActionResult) => void): void;
+
+        /**
+         * Executes a list of game actions as a single batch. The batch is charged once and, in a network game,
+         * sent to the server as a single request. The batch fails as a whole if any action fails its query.
+         * An action can still fail when it is executed if an earlier action of the batch changed the map it
+         * depends on. The batch then stops there and succeeds for the actions before it, which stay applied and
+         * are charged, the result then has an errorTitle and errorMessage describing why the batch stopped.
+         * @param actions The actions and their parameters.
+         * @param callback The function to be called with the result of the batch.
+         */
+        executeActionBatch(actions: GameActionBatchItem[], callback: (result: GameActionResult) => void): void;
+
         /**
          * Subscribes to the given hook.
          */
@@ -270,6 +292,16 @@ declare global {
         subscribe(hook: "guest.generation", callback: (id: number) => void): IDisposable;
         subscribe(hook: "vehicle.crash", callback: (e: VehicleCrashArgs) => void): IDisposable;
 
+        /**
+         * Gets how often and for how long each subscribed hook function has run, in the order they were subscribed.
+         */
+        getHookStatistics(): HookStatistics[];
+
+        /**
+         * Resets the counters returned by getHookStatistics.
+         */
+        resetHookStatistics(): void;
+
         /**
          * Registers a function to be called every so often in realtime, specified by the given delay.
          * @param callback The function to call every time the delay has elapsed.
@@ -284,6 +316,18 @@ declare global {
          */
         setTimeout(callback: Function, delay: number): number;
 
+        /**
+         * Runs a function on a worker thread, away from the game. The job has none of the plugin APIs, only the
+         * standard JavaScript built-ins, so it can only compute something from the data it is given.
+         * @param source The source code of the job, it must evaluate to a function that takes the data and returns
+         * the result, e.g. "(function (data) { return data.length; })".
+         * @param data The data to pass to the job, it is copied as JSON.
+         * @param callback Called during a later update with the result, copied as JSON, or the error if the job
+         * failed. The callback is not called if the plugin is stopped before the job finishes.
+         * A job that runs for longer than 30 seconds fails. It is only stopped at its next allocation.
+         */
+        runJob(source: string, data: any, callback: (result: any, error?: string) => void): void;
+
         /**
          * Removes the registered interval specified by the numeric handle. The handles
          * are shared with `setTimeout`.
@@ -471,10 +515,35 @@ declare global {
         readonly type: number;
         readonly action: string;
         readonly isClientOnly: boolean;
+        /**
+         * The arguments are created when first read and are only available while the hooks for the action run.
+         */
         readonly args: object;
         result: GameActionResult;
     }
 
+    interface HookStatistics {
+        hook: HookType;
+        /**
+         * The name of the plugin that subscribed the function.
+         */
+        plugin: string;
+        calls: number;
+        /**
+         * The total time spent in the function, in milliseconds.
+         */
+        totalTime: number;
+        /**
+         * The longest single call of the function, in milliseconds.
+         */
+        maxTime: number;
+    }
+
+    interface GameActionBatchItem {
+        action: ActionType | string;
+        args: object;
+    }
+
     interface GameActionResult {
         error?: number;
         errorTitle?: string;
@@ -581,9 +650,97 @@ declare global {
         getAllEntities(type: "staff"): Staff[];
         getAllEntities(type: "car"): Car[];
         getAllEntities(type: "litter"): Litter[];
+
+        /**
+         * Reads fields of every entity of a type in one call, without creating an object per entity.
+         * Each requested field is returned as an array with one value per matching entity, in the same
+         * order getAllEntities returns them. Guest fields are only available for the guest type and
+         * energy fields for the guest, staff and peep types.
+         * @param type The type of entities to read.
+         * @param fields The fields to read.
+         * @param filter Only include entities whose fields match, either a value or an inclusive range.
+         * Boolean fields such as isInPark match true and false.
+         */
+        queryEntities(type: EntityType, fields: EntityQueryField[], filter?: EntityQueryFilter): EntityQueryResult;
+
+        /**
+         * Reads every tile element within a range in one call, without creating an object per tile or element.
+         * Elements are listed tile by tile, row by row, in the order of the tile's elements.
+         * @param range The area to read in map coordinates, clamped to the map.
+         * @param filter Only include elements of a type or whose base height matches, either a value or an inclusive range.
+         */
+        getTiles(range: MapRange, filter?: TileQueryFilter): TileQueryResult;
+
+        /**
+         * Moves tile elements to new base heights as a single batch of tile inspector actions. The clearance height of
+         * each element moves by the same amount. Elements already at their base height are left out of the batch.
+         * Every tile must be on the map and each element may only be listed once.
+         * @param changes The elements to move, the same layout getTiles returns so its arrays can be edited and passed back.
+         * @param callback Called with the result of the batch, as for context.executeAction.
+         */
+        setTileHeights(changes: TileHeightChanges, callback?: (result: GameActionResult) => void): void;
+
         createEntity(type: EntityType, initializer: object): Entity;
     }
 
+    type EntityQueryField =
+        "id" | "x" | "y" | "z" |
+        "energy" | "energyTarget" |
+        "happiness" | "happinessTarget" | "nausea" | "nauseaTarget" | "hunger" | "thirst" | "toilet" | "mass" |
+        "minIntensity" | "maxIntensity" | "nauseaTolerance" | "cash" | "isInPark" | "isLost" | "lostCountdown";
+
+    type EntityQueryFilter = {
+        [field in EntityQueryField]?: number | boolean | { min?: number, max?: number };
+    };
+
+    type EntityQueryResult = {
+        [field in EntityQueryField]?: Int32Array;
+    } & {
+        /**
+         * The number of entities that matched, the length of every returned array.
+         */
+        count: number;
+    };
+
+    interface TileQueryFilter {
+        type?: TileElementType;
+        baseHeight?: number | { min?: number, max?: number };
+    }
+
+    interface TileQueryResult {
+        /**
+         * The number of elements that matched, the length of every returned array.
+         */
+        count: number;
+        /**
+         * The tile coordinates of each element's tile.
+         */
+        x: Int32Array;
+        y: Int32Array;
+        /**
+         * The index of each element within its tile, as used by Tile.getElement.
+         */
+        index: Int32Array;
+        /**
+         * The type of each element, an index into typeNames.
+         */
+        type: Int32Array;
+        baseHeight: Int32Array;
+        clearanceHeight: Int32Array;
+        /**
+         * The object index of each element, -1 for elements without an object.
+         */
+        object: Int32Array;
+        typeNames: TileElementType[];
+    }
+
+    interface TileHeightChanges {
+        x: ArrayLike<number>;
+        y: ArrayLike<number>;
+        index: ArrayLike<number>;
+        baseHeight: ArrayLike<number>;
+    }
+
     type TileElementType =
         "surface" | "footpath" | "track" | "small_scenery" | "wall" | "entrance" | "large_scenery" | "banner"
         /** This only exist to retrieve the types for existing corrupt elements. For hiding elements, use the isHidden field instead. */
@@ -1587,6 +1744,14 @@ declare global {
     interface NetworkStats {
         bytesReceived: number[];
         bytesSent: number[];
+        /**
+         * Number of outgoing packets prepared for sending. A packet sent to several players is only prepared once.
+         */
+        packetsFramed: number;
+        /**
+         * Number of bytes copied to prepare the outgoing packets.
+         */
+        bytesFramed: number;
     }
 
     type PermissionType =
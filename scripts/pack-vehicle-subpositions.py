@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+
+"""Packs the vehicle subposition tables from src/openrct2/ride/VehicleSubpositionData.inc
+into the compact, delta encoded form the game is built with (VehicleSubpositionPacked.h).
+
+Every list of positions is stored once. Each position is encoded relative to the one before it:
+
+    0-124  Direction, pitch and bank are unchanged and x, y and z each move by -2 to 2.
+           dx = b % 5 - 2, dy = b / 5 % 5 - 2, dz = b / 25 - 2
+    254    Followed by int8 dx, dy, dz and uint8 direction, pitch, bank.
+    255    Followed by int16 x, y, z (little endian) and uint8 direction, pitch, bank.
+
+The first position of every list is always stored in full.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+ROOT_DIR = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+RIDE_DIR = os.path.join(ROOT_DIR, 'src', 'openrct2', 'ride')
+INPUT_PATH = os.path.join(RIDE_DIR, 'VehicleSubpositionData.inc')
+VEHICLE_HEADER_PATH = os.path.join(RIDE_DIR, 'Vehicle.h')
+OUTPUT_PATH = os.path.join(RIDE_DIR, 'VehicleSubpositionPacked.h')
+
+LOCATION_NULL = -32768
+CODE_DELTA = 254
+CODE_FULL = 255
+
+HEADER = """/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+// Generated by scripts/pack-vehicle-subpositions.py from VehicleSubpositionData.inc, do not edit.
+
+#pragma once
+
+#include <cstdint>
+
+// clang-format off
+"""
+
+
+def strip_comments(text):
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.DOTALL)
+    return re.sub(r'//[^\n]*', '', text)
+
+
+def read_enum(text, name):
+    match = re.search(r'enum class ' + name + r'\b[^{;]*\{(.*?)\}', text, re.DOTALL)
+    if match is None:
+        raise ValueError('Unable to find enum ' + name)
+    values = {}
+    value = 0
+    for item in strip_comments(match.group(1)).split(','):
+        item = item.strip()
+        if not item:
+            continue
+        if '=' in item:
+            item, explicit = [part.strip() for part in item.split('=')]
+            value = int(explicit, 0)
+        values[item] = value
+        value += 1
+    return values
+
+
+def find_namespaces(text):
+    """Returns (start, end, name) for each namespace block in the text."""
+    namespaces = []
+    for match in re.finditer(r'\bnamespace\s+(\w+)\s*\{', text):
+        depth = 1
+        pos = match.end()
+        while depth > 0:
+            if text[pos] == '{':
+                depth += 1
+            elif text[pos] == '}':
+                depth -= 1
+            pos += 1
+        namespaces.append((match.start(), pos, match.group(1)))
+    return namespaces
+
+
+def qualify(name, pos, namespaces):
+    for start, end, namespace in namespaces:
+        if start <= pos < end:
+            return namespace + '::' + name
+    return name
+
+
+def parse_entry(entry, golf_states, golf_animations):
+    entry = entry.strip()
+    match = re.fullmatch(r'MINI_GOLF_STATE\((\w+)\)', entry)
+    if match:
+        return (LOCATION_NULL, golf_states[match.group(1)], 0, 0, 0, 0)
+    match = re.fullmatch(r'MINI_GOLF_ANIMATION\((\w+)\)', entry)
+    if match:
+        return (LOCATION_NULL, golf_states['Unk4'], golf_animations[match.group(1)], 0, 0, 0)
+    match = re.fullmatch(r'\{([^{}]*)\}', entry)
+    if match:
+        values = tuple(int(value, 0) for value in match.group(1).split(','))
+        if len(values) == 6:
+            return values
+    raise ValueError('Unable to parse entry: ' + entry)
+
+
+def parse_tables(text, golf_states, golf_animations):
+    namespaces = find_namespaces(text)
+
+    lists = {}
+    for match in re.finditer(r'CREATE_VEHICLE_INFO\(\s*(\w+)\s*,\s*\{(.*?)\}\s*\)', text, re.DOTALL):
+        body = match.group(2)
+        entries = re.findall(r'\{[^{}]*\}|MINI_GOLF_\w+\(\w+\)', body)
+        name = qualify(match.group(1), match.start(), namespaces)
+        lists[name] = [parse_entry(entry, golf_states, golf_animations) for entry in entries]
+
+    list_tables = {}
+    for match in re.finditer(r'rct_vehicle_info_list\s*\*\s*(\w+)\[\]\s*=\s*\{(.*?)\};', text, re.DOTALL):
+        list_tables[match.group(1)] = re.findall(r'&\s*([\w:]+)', match.group(2))
+
+    match = re.search(r'gTrackVehicleInfo\[[^\]]*\]\s*=\s*\{(.*?)\};', text, re.DOTALL)
+    if match is None:
+        raise ValueError('Unable to find gTrackVehicleInfo')
+    subpositions = [list_tables[name] for name in re.findall(r'\w+', match.group(1))]
+    return lists, subpositions
+
+
+def encode_list(entries):
+    data = bytearray()
+    previous = None
+    for entry in entries:
+        x, y, z, direction, pitch, bank = entry
+        if previous is not None:
+            dx, dy, dz = x - previous[0], y - previous[1], z - previous[2]
+            same_attributes = entry[3:] == previous[3:]
+            if same_attributes and all(-2 <= delta <= 2 for delta in (dx, dy, dz)):
+                data.append((dx + 2) + (dy + 2) * 5 + (dz + 2) * 25)
+                previous = entry
+                continue
+            if all(-128 <= delta <= 127 for delta in (dx, dy, dz)):
+                data.append(CODE_DELTA)
+                data += bytes([dx & 0xFF, dy & 0xFF, dz & 0xFF, direction, pitch, bank])
+                previous = entry
+                continue
+        data.append(CODE_FULL)
+        for value in (x, y, z):
+            data += (value & 0xFFFF).to_bytes(2, 'little')
+        data += bytes([direction, pitch, bank])
+        previous = entry
+    return data
+
+
+def format_array(type_name, name, values, per_line):
+    lines = ['static constexpr const {} {}[] = {{'.format(type_name, name)]
+    for i in range(0, len(values), per_line):
+        lines.append('    ' + ', '.join(str(value) for value in values[i:i + per_line]) + ',')
+    lines.append('};')
+    return '\n'.join(lines) + '\n'
+
+
+def pack(text, vehicle_header):
+    golf_states = read_enum(vehicle_header, 'MiniGolfState')
+    golf_animations = read_enum(vehicle_header, 'MiniGolfAnimation')
+    lists, subpositions = parse_tables(strip_comments(text), golf_states, golf_animations)
+
+    list_ids = {}
+    list_sizes = []
+    blob = bytearray()
+    subposition_sizes = []
+    subposition_list_ids = []
+    for subposition in subpositions:
+        subposition_sizes.append(len(subposition))
+        for name in subposition:
+            if name not in list_ids:
+                list_ids[name] = len(list_sizes)
+                list_sizes.append(len(lists[name]))
+                blob += encode_list(lists[name])
+            subposition_list_ids.append(list_ids[name])
+
+    output = HEADER + '\n'
+    output += '// Number of track type and direction combinations for each VehicleTrackSubposition.\n'
+    output += format_array('uint16_t', 'PackedVehicleSubpositionSizes', subposition_sizes, 20)
+    output += '\n// Index of the position list for each subposition, track type and direction.\n'
+    output += format_array('uint16_t', 'PackedVehicleSubpositionListIds', subposition_list_ids, 24)
+    output += '\n// Number of positions in each list.\n'
+    output += format_array('uint16_t', 'PackedVehicleInfoListSizes', list_sizes, 24)
+    output += '\n// All position lists, delta encoded.\n'
+    output += format_array('uint8_t', 'PackedVehicleInfo', list(blob), 30)
+    output += '\n// clang-format on\n'
+    return output
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--check', action='store_true', help='only check that the packed header is up to date')
+    args = parser.parse_args()
+
+    with open(INPUT_PATH, encoding='utf-8') as f:
+        text = f.read()
+    with open(VEHICLE_HEADER_PATH, encoding='utf-8') as f:
+        vehicle_header = f.read()
+    output = pack(text, vehicle_header)
+
+    if args.check:
+        with open(OUTPUT_PATH, encoding='utf-8') as f:
+            if f.read() != output:
+                print('{} is out of date, run {}'.format(OUTPUT_PATH, os.path.basename(__file__)))
+                return 1
+        return 0
+
+    with open(OUTPUT_PATH, 'w', encoding='utf-8', newline='\n') as f:
+        f.write(output)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -18,6 +18,7 @@
 #include <openrct2/entity/EntityRegistry.h>
 #include <openrct2/entity/Guest.h>
 #include <openrct2/localisation/Localisation.h>
+#include <openrct2/localisation/NameCache.h>
 #include <openrct2/ride/RideData.h>
 #include <openrct2/scenario/Scenario.h>
 #include <openrct2/sprites.h>
@@ -634,10 +635,7 @@ public:
 
                 auto& item = _guestList.emplace_back();
                 item.Id = peep->sprite_index;
-
-                Formatter ft;
-                peep->FormatNameTo(ft);
-                format_string(item.Name, sizeof(item.Name), STR_STRINGID, ft.Data());
+                safe_strcpy(item.Name, OpenRCT2::NameCache::GetPeepName(*peep).c_str(), sizeof(item.Name));
             }
 
             std::sort(_guestList.begin(), _guestList.end(), GetGuestCompareFunc());
@@ -788,12 +786,7 @@ private:
 
         if (!_filterName.empty())
         {
-            char name[256]{};
-
-            Formatter ft;
-            peep.FormatNameTo(ft);
-            format_string(name, sizeof(name), STR_STRINGID, ft.Data());
-            if (strcasestr(name, _filterName.c_str()) == nullptr)
+            if (strcasestr(OpenRCT2::NameCache::GetPeepName(peep).c_str(), _filterName.c_str()) == nullptr)
             {
                 return false;
             }
@@ -19,6 +19,7 @@
 #include <openrct2/drawing/Drawing.h>
 #include <openrct2/interface/Colour.h>
 #include <openrct2/localisation/Localisation.h>
+#include <openrct2/localisation/NameCache.h>
 #include <openrct2/network/network.h>
 #include <openrct2/sprites.h>
 #include <openrct2/util/Util.h>
@@ -788,7 +789,9 @@ private:
                 case INFORMATION_TYPE_STATUS:
                     currentListPosition = SortList(
                         currentListPosition, rideRef, [](const Ride& thisRide, const Ride& otherRide) -> bool {
-                            return 0 <= strlogicalcmp(thisRide.GetName().c_str(), otherRide.GetName().c_str());
+                            const auto& thisName = OpenRCT2::NameCache::GetRideName(thisRide);
+                            const auto& otherName = OpenRCT2::NameCache::GetRideName(otherRide);
+                            return 0 <= strlogicalcmp(thisName.c_str(), otherName.c_str());
                         });
                     break;
                 case INFORMATION_TYPE_POPULARITY:
@@ -1058,6 +1058,8 @@ namespace OpenRCT2
             auto& tweener = EntityTweener::Get();
 
             bool draw = !_isWindowMinimised && !gOpenRCT2Headless;
+            // Drawing between the ticks of a catch up delays the remaining ticks, which a network game can not afford.
+            bool drawWhileCatchingUp = draw && network_get_mode() == NETWORK_MODE_NONE;
             if (_lastTick == 0)
             {
                 tweener.Reset();
@@ -1087,6 +1089,13 @@ namespace OpenRCT2
                 // Get the next position of each sprite
                 if (draw)
                     tweener.PostTick();
+
+                // Catching up after a slow tick would otherwise run every missed tick before drawing again, draw a frame in
+                // between and leave the remaining ticks in the accumulator for the next frame. Ticks beyond
+                // GAME_UPDATE_MAX_THRESHOLD are dropped from the accumulator, so under sustained load the game runs slower
+                // in exchange for a steady frame rate.
+                if (drawWhileCatchingUp && platform_get_ticks() - currentTick >= GAME_UPDATE_TIME_MS)
+                    break;
             }
 
             if (draw)
@@ -26,6 +26,7 @@
 #include "core/FileScanner.h"
 #include "core/Path.hpp"
 #include "entity/EntityRegistry.h"
+#include "entity/Litter.h"
 #include "entity/Peep.h"
 #include "entity/Staff.h"
 #include "interface/Colour.h"
@@ -39,6 +40,8 @@
 #include "network/network.h"
 #include "object/Object.h"
 #include "object/ObjectList.h"
+#include "peep/GuestRideIndex.h"
+#include "peep/PeepStats.h"
 #include "platform/Platform2.h"
 #include "ride/Ride.h"
 #include "ride/RideRatings.h"
@@ -402,6 +405,10 @@ void game_fix_save_vars()
         ptr->Remove();
     }
 
+    OpenRCT2::PeepStats::Rebuild();
+    OpenRCT2::GuestRideIndex::Rebuild();
+    Litter::RebuildCreationOrder();
+
     // Fixes broken saves where a surface element could be null
     // and broken saves with incorrect invisible map border tiles
     for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
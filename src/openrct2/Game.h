@@ -99,6 +99,7 @@ enum class GameCommand : int32_t
     SetDate,                  // GA
     Custom,                   // GA
     ChangeMapSize,
+    Batch,
     Count,
 };
 
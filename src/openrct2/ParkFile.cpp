@@ -73,7 +73,7 @@ static void UpdateFootpathsFromMapping(
 namespace OpenRCT2
 {
     // Current version that is saved.
-    constexpr uint32_t PARK_FILE_CURRENT_VERSION = 0x7;
+    constexpr uint32_t PARK_FILE_CURRENT_VERSION = 0x8;
 
     // The minimum version that is forwards compatible with the current version.
     constexpr uint32_t PARK_FILE_MIN_VERSION = 0x7;
@@ -109,6 +109,7 @@ namespace OpenRCT2
         ObjectList RequiredObjects;
         std::vector<const ObjectRepositoryItem*> ExportObjectsList;
         bool OmitTracklessRides{};
+        bool Uncompressed{};
 
     private:
         std::unique_ptr<OrcaStream> _os;
@@ -164,6 +165,10 @@ namespace OpenRCT2
             header.Magic = PARK_FILE_MAGIC;
             header.TargetVersion = PARK_FILE_CURRENT_VERSION;
             header.MinVersion = PARK_FILE_MIN_VERSION;
+            if (Uncompressed)
+            {
+                header.Compression = OrcaStream::COMPRESSION_NONE;
+            }
 
             ReadWriteAuthoringChunk(os);
             ReadWriteObjectsChunk(os);
@@ -425,7 +430,7 @@ namespace OpenRCT2
 
         void ReadWriteGeneralChunk(OrcaStream& os)
         {
-            auto found = os.ReadWriteChunk(ParkFileChunkType::GENERAL, [this](OrcaStream::ChunkStream& cs) {
+            auto found = os.ReadWriteChunk(ParkFileChunkType::GENERAL, [this, &os](OrcaStream::ChunkStream& cs) {
                 cs.ReadWrite(gGamePaused);
                 cs.ReadWrite(gCurrentTicks);
                 cs.ReadWrite(gDateMonthTicks);
@@ -465,6 +470,19 @@ namespace OpenRCT2
                 cs.ReadWrite(gWidePathTileLoopPosition);
 
                 ReadWriteRideRatingCalculationData(cs, gRideRatingUpdateState);
+
+                if (os.GetHeader().TargetVersion >= 8)
+                {
+                    cs.ReadWrite(gParkSizeScanPosition);
+                    cs.ReadWrite(gParkSizeScanOwnedTiles);
+                    cs.ReadWrite(gParkSizeScanOwnershipChanged);
+                }
+                else
+                {
+                    gParkSizeScanPosition = 0;
+                    gParkSizeScanOwnedTiles = 0;
+                    gParkSizeScanOwnershipChanged = false;
+                }
             });
             if (!found)
             {
@@ -1980,10 +1998,8 @@ namespace OpenRCT2
         std::vector<TileCoordsXY> area;
         if (staff.PatrolInfo != nullptr)
         {
-            for (size_t i = 0; i < STAFF_PATROL_AREA_SIZE; i++)
-            {
+            staff.PatrolInfo->ForEachSetData([&area](size_t i, uint32_t arrayItem) {
                 // 32 blocks per array item (32 bits)
-                auto arrayItem = staff.PatrolInfo->Data[i];
                 for (size_t j = 0; j < 32; j++)
                 {
                     auto blockIndex = (i * 32) + j;
@@ -2000,7 +2016,7 @@ namespace OpenRCT2
                         }
                     }
                 }
-            }
+            });
         }
         return area;
     }
@@ -2223,6 +2239,7 @@ void ParkFileExporter::Export(IStream& stream)
 {
     auto parkFile = std::make_unique<OpenRCT2::ParkFile>();
     parkFile->ExportObjectsList = ExportObjectsList;
+    parkFile->Uncompressed = Uncompressed;
     parkFile->Save(stream);
 }
 
@@ -16,6 +16,8 @@ class ParkFileExporter
 {
 public:
     std::vector<const ObjectRepositoryItem*> ExportObjectsList;
+    // Leaves compressing the file to the caller, i.e. maps are sent to clients in blocks compressed on their own.
+    bool Uncompressed{};
 
     void Export(std::string_view path);
     void Export(OpenRCT2::IStream& stream);
@@ -0,0 +1,217 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "BatchAction.h"
+
+#include "../core/Guard.hpp"
+
+#include <optional>
+#include <stdexcept>
+
+BatchAction::BatchAction(std::vector<GameAction::Ptr>&& actions, bool atomic)
+    : _actions(std::move(actions))
+    , _atomic(atomic)
+{
+}
+
+void BatchAction::AddAction(GameAction::Ptr&& action)
+{
+    Guard::ArgumentNotNull(action.get());
+    _actions.push_back(std::move(action));
+}
+
+const std::vector<GameAction::Ptr>& BatchAction::GetActions() const
+{
+    return _actions;
+}
+
+bool BatchAction::IsAtomic() const
+{
+    return _atomic;
+}
+
+bool BatchAction::IsBatchable(GameCommand type)
+{
+    switch (type)
+    {
+        case GameCommand::Batch:
+        case GameCommand::TogglePause:
+        case GameCommand::LoadOrQuit:
+        case GameCommand::ChangeMapSize:
+        case GameCommand::KickPlayer:
+        case GameCommand::ModifyGroups:
+        case GameCommand::SetPlayerGroup:
+            return false;
+        default:
+            return GameActions::IsValidId(EnumValue(type));
+    }
+}
+
+uint16_t BatchAction::GetActionFlags() const
+{
+    auto flags = GameAction::GetActionFlags();
+
+    // The batch may only run while paused or outside the editor if every action in it may.
+    bool allowWhilePaused = !_actions.empty();
+    for (const auto& action : _actions)
+    {
+        auto actionFlags = action->GetActionFlags();
+        if (!(actionFlags & GameActions::Flags::AllowWhilePaused))
+            allowWhilePaused = false;
+        flags |= actionFlags & GameActions::Flags::EditorOnly;
+    }
+    if (allowWhilePaused)
+        flags |= GameActions::Flags::AllowWhilePaused;
+
+    return flags;
+}
+
+void BatchAction::Serialise(DataSerialiser& stream)
+{
+    GameAction::Serialise(stream);
+
+    auto count = static_cast<uint32_t>(_actions.size());
+    stream << DS_TAG(_atomic) << DS_TAG(count);
+
+    if (stream.IsLoading())
+    {
+        if (count > MaxActions)
+        {
+            throw std::runtime_error("Too many actions in batch.");
+        }
+
+        _actions.clear();
+        _actions.reserve(count);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            GameCommand type{};
+            stream << DS_TAG(type);
+            if (!IsBatchable(type))
+            {
+                throw std::runtime_error("Invalid action in batch.");
+            }
+
+            auto action = GameActions::Create(type);
+            action->Serialise(stream);
+            _actions.push_back(std::move(action));
+        }
+    }
+    else
+    {
+        for (const auto& action : _actions)
+        {
+            auto type = action->GetType();
+            stream << DS_TAG(type);
+            action->Serialise(stream);
+        }
+    }
+}
+
+void BatchAction::PrepareAction(GameAction& action) const
+{
+    // Actions in a batch always run on behalf of the batch.
+    action.SetFlags(GetFlags());
+    action.SetPlayer(GetPlayer());
+}
+
+GameActions::Result BatchAction::CreateResult() const
+{
+    auto result = GameActions::Result();
+    result.ErrorTitle = STR_CANT_DO_THIS;
+    return result;
+}
+
+GameActions::Result BatchAction::Query() const
+{
+    if (_actions.empty() || _actions.size() > MaxActions)
+    {
+        return GameActions::Result(GameActions::Status::InvalidParameters, STR_CANT_DO_THIS, STR_NONE);
+    }
+
+    // Nothing is applied while querying, so every action is validated against the same map state.
+    auto result = CreateResult();
+    std::optional<GameActions::Result> firstError;
+    bool anySuccess = false;
+    for (const auto& action : _actions)
+    {
+        if (!IsBatchable(action->GetType()))
+        {
+            return GameActions::Result(GameActions::Status::Disallowed, STR_CANT_DO_THIS, STR_NONE);
+        }
+
+        PrepareAction(*action);
+        auto res = GameActions::QueryNested(action.get());
+        if (res.Error != GameActions::Status::Ok)
+        {
+            if (_atomic)
+                return res;
+            if (!firstError.has_value())
+                firstError = std::move(res);
+            continue;
+        }
+
+        if (!anySuccess)
+        {
+            result.Position = res.Position;
+            result.Expenditure = res.Expenditure;
+            anySuccess = true;
+        }
+        result.Cost += res.Cost;
+    }
+
+    if (!anySuccess && firstError.has_value())
+        return *firstError;
+
+    return result;
+}
+
+GameActions::Result BatchAction::Execute() const
+{
+    auto result = CreateResult();
+    std::optional<GameActions::Result> firstError;
+    bool anySuccess = false;
+    for (size_t i = 0; i < _actions.size(); i++)
+    {
+        const auto& action = _actions[i];
+        PrepareAction(*action);
+        auto res = GameActions::ExecuteNested(action.get());
+        if (res.Error != GameActions::Status::Ok)
+        {
+            // Earlier actions of the batch may have changed the map, so later ones can still fail here. An atomic batch
+            // can not undo the actions already executed, it stops and still succeeds so that they are paid for.
+            if (_atomic)
+            {
+                if (!anySuccess)
+                    return res;
+
+                result.ErrorTitle = res.ErrorTitle;
+                result.ErrorMessage = res.ErrorMessage;
+                result.ErrorMessageArgs = res.ErrorMessageArgs;
+                result.SetData(BatchActionStopped{ res.Error, i });
+                return result;
+            }
+            if (!firstError.has_value())
+                firstError = std::move(res);
+            continue;
+        }
+
+        if (!anySuccess)
+        {
+            result.Position = res.Position;
+            result.Expenditure = res.Expenditure;
+            anySuccess = true;
+        }
+        result.Cost += res.Cost;
+    }
+
+    if (!anySuccess && firstError.has_value())
+        return *firstError;
+
+    return result;
+}
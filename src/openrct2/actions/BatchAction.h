@@ -0,0 +1,66 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "GameAction.h"
+
+#include <vector>
+
+/**
+ * Result data of an atomic batch that was stopped by an action failing to execute.
+ */
+struct BatchActionStopped
+{
+    GameActions::Status Error;
+    size_t Index;
+};
+
+/**
+ * Runs a list of game actions as a single action. All actions are queried against the same map state before any of
+ * them are executed, the combined cost is charged once and the whole batch is sent over the network as one packet.
+ * An atomic batch fails if any action fails its query. An action that only fails once the actions before it have been
+ * executed stops the batch, those actions stay applied and are charged, the result carries the error and a
+ * BatchActionStopped as its data.
+ */
+class BatchAction final : public GameActionBase<GameCommand::Batch>
+{
+public:
+    static constexpr size_t MaxActions = 5000;
+
+    // Network packets are limited to 64 KiB, leave some room for the packet header and tick.
+    static constexpr size_t MaxNetworkSize = 63 * 1024;
+
+private:
+    std::vector<GameAction::Ptr> _actions;
+    bool _atomic{ true };
+
+public:
+    BatchAction() = default;
+    BatchAction(std::vector<GameAction::Ptr>&& actions, bool atomic);
+
+    void AddAction(GameAction::Ptr&& action);
+    const std::vector<GameAction::Ptr>& GetActions() const;
+    bool IsAtomic() const;
+
+    /**
+     * Returns true if the given action type is allowed to be part of a batch.
+     */
+    static bool IsBatchable(GameCommand type);
+
+    uint16_t GetActionFlags() const override;
+
+    void Serialise(DataSerialiser& stream) override;
+    GameActions::Result Query() const override;
+    GameActions::Result Execute() const override;
+
+private:
+    void PrepareAction(GameAction& action) const;
+    GameActions::Result CreateResult() const;
+};
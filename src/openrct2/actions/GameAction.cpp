@@ -131,6 +131,7 @@ namespace GameActions
                 case GameCommand::PlaceLargeScenery:
                 case GameCommand::PlaceBanner:
                 case GameCommand::PlaceScenery:
+                case GameCommand::Batch:
                     scenery_remove_ghost_tool_placement();
                     break;
                 default:
@@ -14,10 +14,10 @@
 #include "../GameState.h"
 #include "../core/MemoryStream.h"
 #include "../drawing/Drawing.h"
-#include "../entity/EntityList.h"
 #include "../interface/Window.h"
 #include "../localisation/Localisation.h"
 #include "../management/NewsItem.h"
+#include "../peep/GuestRideIndex.h"
 #include "../peep/RideUseSystem.h"
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
@@ -136,7 +136,7 @@ GameActions::Result RideDemolishAction::DemolishRide(Ride* ride) const
     UnlinkAllBannersForRide(ride->id);
 
     RideUse::GetHistory().RemoveValue(ride->id);
-    for (auto peep : EntityList<Guest>())
+    for (auto peep : GuestRideIndex::GetGuests(ride->id))
     {
         peep->RemoveRideFromMemory(ride->id);
     }
@@ -21,6 +21,7 @@
 #include "../localisation/Localisation.h"
 #include "../localisation/StringIds.h"
 #include "../network/network.h"
+#include "../peep/PeepStats.h"
 #include "../ride/Ride.h"
 #include "../ride/Vehicle.h"
 #include "../scenario/Scenario.h"
@@ -594,6 +595,7 @@ void SetCheatAction::SetGuestParameter(int32_t parameter, int32_t value) const
                 break;
         }
         peep->UpdateSpriteType();
+        OpenRCT2::PeepStats::Update(*peep);
     }
 }
 
@@ -19,6 +19,7 @@
 #include "../localisation/Localisation.h"
 #include "../localisation/StringIds.h"
 #include "../management/Finance.h"
+#include "../peep/PeepStats.h"
 #include "../ride/Ride.h"
 #include "../scenario/Scenario.h"
 #include "../ui/UiContext.h"
@@ -165,6 +166,7 @@ GameActions::Result StaffHireNewAction::QueryExecute(bool execute) const
 
         newPeep->Id = newStaffId;
         newPeep->AssignedStaffType = static_cast<StaffType>(_staffType);
+        OpenRCT2::PeepStats::Update(*newPeep);
 
         PeepSpriteType spriteType = spriteTypes[_staffType];
         if (_staffType == static_cast<uint8_t>(StaffType::Entertainer))
@@ -97,7 +97,5 @@ GameActions::Result StaffSetPatrolAreaAction::Execute() const
             break;
     }
 
-    staff_update_greyed_patrol_areas();
-
     return GameActions::Result();
 }
@@ -0,0 +1,217 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../Context.h"
+#    include "../Game.h"
+#    include "../OpenRCT2.h"
+#    include "../actions/SmallSceneryPlaceAction.h"
+#    include "../platform/Platform2.h"
+#    include "../platform/platform.h"
+#    include "../world/ConstructionClearance.h"
+#    include "../world/Map.h"
+#    include "../world/SmallScenery.h"
+#    include "../world/Surface.h"
+
+#    include <benchmark/benchmark.h>
+#    include <cstdint>
+#    include <optional>
+#    include <vector>
+
+using namespace OpenRCT2;
+
+// Placement tools try a few heights above the surface while the cursor moves over a tile.
+static constexpr int32_t HeightsPerTile = 4;
+
+static std::unique_ptr<IContext> CreateBenchContext(benchmark::State& state, const std::string& filename)
+{
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        state.SkipWithError("Context initialization failed.");
+        return nullptr;
+    }
+    if (!filename.empty() && !context->LoadParkFromFile(filename))
+    {
+        state.SkipWithError("Failed to load file!");
+        return nullptr;
+    }
+    return context;
+}
+
+static std::vector<CoordsXYZ> GetSurfaceLocations()
+{
+    std::vector<CoordsXYZ> locations;
+    for (int32_t y = 1; y < gMapSize - 1; y++)
+    {
+        for (int32_t x = 1; x < gMapSize - 1; x++)
+        {
+            auto loc = TileCoordsXY{ x, y }.ToCoordsXY();
+            auto* surfaceElement = map_get_surface_element_at(loc);
+            if (surfaceElement != nullptr)
+            {
+                locations.emplace_back(loc, surfaceElement->GetBaseZ());
+            }
+        }
+    }
+    return locations;
+}
+
+static std::optional<ObjectEntryIndex> FindSmallSceneryEntry()
+{
+    for (ObjectEntryIndex i = 0; i < MAX_SMALL_SCENERY_OBJECTS; i++)
+    {
+        if (get_small_scenery_entry(i) != nullptr)
+        {
+            return i;
+        }
+    }
+    return std::nullopt;
+}
+
+static void BM_clearance(benchmark::State& state, const std::string& filename)
+{
+    auto context = CreateBenchContext(state, filename);
+    if (context == nullptr)
+        return;
+
+    const auto locations = GetSurfaceLocations();
+    for (auto _ : state)
+    {
+        int32_t numBlocked = 0;
+        for (const auto& loc : locations)
+        {
+            for (int32_t i = 0; i < HeightsPerTile; i++)
+            {
+                auto z = loc.z + i * LAND_HEIGHT_STEP;
+                auto res = MapCanConstructWithClearAt(
+                    { loc, z, z + LAND_HEIGHT_STEP }, &map_place_scenery_clear_func, { 0b1111, 0 }, GAME_COMMAND_FLAG_GHOST);
+                if (res.Error != GameActions::Status::Ok)
+                {
+                    numBlocked++;
+                }
+            }
+        }
+        benchmark::DoNotOptimize(numBlocked);
+    }
+    state.SetItemsProcessed(state.iterations() * locations.size() * HeightsPerTile);
+}
+
+static void BM_scenery_ghost(benchmark::State& state, const std::string& filename)
+{
+    auto context = CreateBenchContext(state, filename);
+    if (context == nullptr)
+        return;
+
+    auto sceneryIndex = FindSmallSceneryEntry();
+    if (!sceneryIndex.has_value())
+    {
+        state.SkipWithError("No small scenery loaded.");
+        return;
+    }
+
+    const auto locations = GetSurfaceLocations();
+    for (auto _ : state)
+    {
+        int32_t numBlocked = 0;
+        for (const auto& loc : locations)
+        {
+            for (int32_t i = 0; i < HeightsPerTile; i++)
+            {
+                auto action = SmallSceneryPlaceAction(
+                    { loc.x, loc.y, loc.z + i * LAND_HEIGHT_STEP, 0 }, 0, *sceneryIndex, COLOUR_BLACK, COLOUR_BLACK);
+                action.SetFlags(GAME_COMMAND_FLAG_GHOST | GAME_COMMAND_FLAG_ALLOW_DURING_PAUSED);
+                auto res = GameActions::Query(&action);
+                if (res.Error != GameActions::Status::Ok)
+                {
+                    numBlocked++;
+                }
+            }
+        }
+        benchmark::DoNotOptimize(numBlocked);
+    }
+    state.SetItemsProcessed(state.iterations() * locations.size() * HeightsPerTile);
+}
+
+static int CmdlineForBenchConstruction(int argc, const char* const* argv)
+{
+    // Add a baseline test on an empty park
+    benchmark::RegisterBenchmark("baseline/clearance", BM_clearance, std::string{});
+
+    // Google benchmark does stuff to argv. It doesn't modify the pointees,
+    // but it wants to reorder the pointers, so present a copy of them.
+    std::vector<char*> argv_for_benchmark;
+
+    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
+    argv_for_benchmark.push_back(nullptr);
+
+    // Extract file names from argument list. If there is no such file, consider it benchmark option.
+    for (int i = 0; i < argc; i++)
+    {
+        if (Platform::FileExists(argv[i]))
+        {
+            // Register benchmarks for sv6 if valid
+            benchmark::RegisterBenchmark((std::string(argv[i]) + "/clearance").c_str(), BM_clearance, argv[i]);
+            benchmark::RegisterBenchmark((std::string(argv[i]) + "/scenery_ghost").c_str(), BM_scenery_ghost, argv[i]);
+        }
+        else
+        {
+            argv_for_benchmark.push_back(const_cast<char*>(argv[i]));
+        }
+    }
+    // Update argc with all the changes made
+    argc = static_cast<int>(argv_for_benchmark.size());
+    ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
+    if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
+        return -1;
+
+    core_init();
+    gOpenRCT2Headless = true;
+
+    ::benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
+
+static exitcode_t HandleBenchConstruction(CommandLineArgEnumerator* argEnumerator)
+{
+    const char* const* argv = static_cast<const char* const*>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = CmdlineForBenchConstruction(argc, argv);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+#else
+static exitcode_t HandleBenchConstruction(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, Google benchmark not enabled in this build");
+    return EXITCODE_FAIL;
+}
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchConstructionCommands[]{
+#ifdef USE_BENCHMARK
+    DefineCommand(
+        "",
+        "<file>... [--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
+        "[--benchmark_repetitions=<num_repetitions>] [--benchmark_report_aggregates_only={true|false}] "
+        "[--benchmark_format=<console|json|csv>] [--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>] "
+        "[--benchmark_color={auto|true|false}] [--benchmark_counters_tabular={true|false}] [--v=<verbosity>]",
+        nullptr, HandleBenchConstruction),
+    CommandTableEnd
+#else
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchConstruction), CommandTableEnd
+#endif // USE_BENCHMARK
+};
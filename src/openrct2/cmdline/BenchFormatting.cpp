@@ -0,0 +1,160 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../Context.h"
+#    include "../OpenRCT2.h"
+#    include "../localisation/Formatter.h"
+#    include "../localisation/Formatting.h"
+#    include "../localisation/Localisation.h"
+#    include "../localisation/StringIds.h"
+#    include "../platform/platform.h"
+
+#    include <benchmark/benchmark.h>
+#    include <cstdint>
+#    include <vector>
+
+using namespace OpenRCT2;
+
+// Every string of the language, formatted with arguments that are all zero.
+static constexpr rct_string_id LastStringId = STR_TILE_INSPECTOR_DIRECTION;
+
+static void FormatAllStrings(benchmark::State& state, bool invalidate)
+{
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        state.SkipWithError("Context initialization failed.");
+        return;
+    }
+
+    // More than any string reads, nested strings included.
+    const std::vector<uint8_t> args(1024);
+    char buffer[512];
+    int64_t numStrings = 0;
+    int64_t numBytes = 0;
+    for (auto _ : state)
+    {
+        if (invalidate)
+        {
+            InvalidateFormatPrograms();
+        }
+        for (rct_string_id id = 0; id <= LastStringId; id++)
+        {
+            numBytes += FormatStringLegacy(buffer, sizeof(buffer), id, args.data());
+        }
+        numStrings += LastStringId + 1;
+        benchmark::DoNotOptimize(buffer);
+    }
+    state.SetItemsProcessed(numStrings);
+    state.SetBytesProcessed(numBytes);
+}
+
+static void BM_format_all_strings(benchmark::State& state)
+{
+    FormatAllStrings(state, false);
+}
+
+// Tokenises every string again on each pass, like formatting did before strings were kept tokenised.
+static void BM_format_all_strings_uncached(benchmark::State& state)
+{
+    FormatAllStrings(state, true);
+}
+
+// A guest status line: string ids nested three deep with a number at the end.
+static void BM_format_nested(benchmark::State& state)
+{
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        state.SkipWithError("Context initialization failed.");
+        return;
+    }
+
+    Formatter ft;
+    ft.Add<rct_string_id>(STR_QUEUING_FOR);
+    ft.Add<rct_string_id>(STR_RIDE_NAME_DEFAULT);
+    ft.Add<rct_string_id>(STR_RIDE_NAME_BOAT_HIRE);
+    ft.Add<uint16_t>(2);
+
+    char buffer[256];
+    for (auto _ : state)
+    {
+        format_string(buffer, sizeof(buffer), STR_STRINGID, ft.Data());
+        benchmark::DoNotOptimize(buffer);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static int CmdlineForBenchFormatting(int argc, const char* const* argv)
+{
+    benchmark::RegisterBenchmark("legacy/all_strings", BM_format_all_strings);
+    benchmark::RegisterBenchmark("legacy/all_strings_uncached", BM_format_all_strings_uncached);
+    benchmark::RegisterBenchmark("legacy/nested", BM_format_nested);
+
+    // Google benchmark does stuff to argv. It doesn't modify the pointees,
+    // but it wants to reorder the pointers, so present a copy of them.
+    std::vector<char*> argv_for_benchmark;
+
+    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
+    argv_for_benchmark.push_back(nullptr);
+    for (int i = 0; i < argc; i++)
+    {
+        argv_for_benchmark.push_back(const_cast<char*>(argv[i]));
+    }
+    // Update argc with all the changes made
+    argc = static_cast<int>(argv_for_benchmark.size());
+    ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
+    if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
+        return -1;
+
+    core_init();
+    gOpenRCT2Headless = true;
+
+    ::benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
+
+static exitcode_t HandleBenchFormatting(CommandLineArgEnumerator* argEnumerator)
+{
+    const char* const* argv = static_cast<const char* const*>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = CmdlineForBenchFormatting(argc, argv);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+#else
+static exitcode_t HandleBenchFormatting(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, Google benchmark not enabled in this build");
+    return EXITCODE_FAIL;
+}
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchFormattingCommands[]{
+#ifdef USE_BENCHMARK
+    DefineCommand(
+        "",
+        "[--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
+        "[--benchmark_repetitions=<num_repetitions>] [--benchmark_report_aggregates_only={true|false}] "
+        "[--benchmark_format=<console|json|csv>] [--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>] "
+        "[--benchmark_color={auto|true|false}] [--benchmark_counters_tabular={true|false}] [--v=<verbosity>]",
+        nullptr, HandleBenchFormatting),
+    CommandTableEnd
+#else
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchFormatting), CommandTableEnd
+#endif // USE_BENCHMARK
+};
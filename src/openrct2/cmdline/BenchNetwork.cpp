@@ -0,0 +1,679 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#ifndef DISABLE_NETWORK
+
+#    include "../Context.h"
+#    include "../GameState.h"
+#    include "../OpenRCT2.h"
+#    include "../actions/GameAction.h"
+#    include "../actions/RideSetPriceAction.h"
+#    include "../actions/SmallSceneryPlaceAction.h"
+#    include "../config/Config.h"
+#    include "../core/Console.hpp"
+#    include "../core/DataSerialiser.h"
+#    include "../core/MemoryStream.h"
+#    include "../network/NetworkBase.h"
+#    include "../network/NetworkConnection.h"
+#    include "../network/NetworkKey.h"
+#    include "../network/network.h"
+#    include "../platform/platform.h"
+#    include "../ride/Ride.h"
+#    include "../world/Map.h"
+#    include "../world/SmallScenery.h"
+
+#    include <algorithm>
+#    include <atomic>
+#    include <chrono>
+#    include <cstdio>
+#    include <cstdlib>
+#    include <map>
+#    include <memory>
+#    include <mutex>
+#    include <random>
+#    include <thread>
+#    include <unordered_map>
+#    include <vector>
+
+using namespace OpenRCT2;
+
+using Clock = std::chrono::steady_clock;
+
+static exitcode_t HandleBenchNetwork(CommandLineArgEnumerator* argEnumerator);
+
+const CommandLineCommand CommandLine::BenchNetworkCommands[]{
+    // Main commands
+    DefineCommand("", "<file> [bots] [seconds] [port]", nullptr, HandleBenchNetwork), CommandTableEnd
+};
+
+constexpr int32_t DefaultBotCount = 8;
+constexpr int32_t DefaultSeconds = 60;
+// Each bot sends an action about this often, with some jitter so they do not all send in the same tick.
+constexpr auto BotActionInterval = std::chrono::milliseconds(250);
+constexpr auto BotHeartbeatInterval = std::chrono::seconds(3);
+constexpr auto JoinTimeout = std::chrono::seconds(60);
+constexpr size_t TickHistorySize = 1024;
+
+static double ToMilliseconds(Clock::duration duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+/**
+ * What the bots know about the park, read before they start as they can not look at the game state themselves.
+ */
+struct BotWorld
+{
+    uint16_t Port;
+    int32_t MapSize;
+    ObjectEntryIndex SmallScenery = OBJECT_ENTRY_INDEX_NULL;
+    std::vector<ride_id_t> Rides;
+};
+
+/**
+ * The tick stream every bot receives, bots can not simulate the park so they check they all got the same random seed
+ * and entity checksums for each tick instead.
+ */
+class TickLog
+{
+private:
+    struct TickData
+    {
+        uint32_t Srand0;
+        std::string SpriteHash;
+    };
+
+    std::mutex _mutex;
+    std::map<uint32_t, TickData> _ticks;
+    size_t _mismatches = 0;
+
+public:
+    void Check(uint32_t tick, uint32_t srand0, std::string_view spriteHash)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _ticks.find(tick);
+        if (it == _ticks.end())
+        {
+            _ticks.emplace(tick, TickData{ srand0, std::string(spriteHash) });
+            while (_ticks.size() > TickHistorySize)
+            {
+                _ticks.erase(_ticks.begin());
+            }
+            return;
+        }
+
+        auto& data = it->second;
+        if (data.Srand0 != srand0 || (!spriteHash.empty() && !data.SpriteHash.empty() && data.SpriteHash != spriteHash))
+        {
+            _mismatches++;
+        }
+        else if (data.SpriteHash.empty())
+        {
+            data.SpriteHash = spriteHash;
+        }
+    }
+
+    size_t GetMismatches()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _mismatches;
+    }
+};
+
+/**
+ * A player without a game, it only speaks enough of the protocol to join, keep its connection alive and send actions
+ * and chat, timing how long the server takes to send them back.
+ */
+class Bot
+{
+public:
+    // Written by the bot thread, only read once it has been joined.
+    bool Joined = false;
+    std::string Error;
+    double JoinTime_ms = 0;
+    std::vector<double> ActionLatencies_ms;
+    std::vector<double> ChatLatencies_ms;
+    size_t ActionsSent = 0;
+    size_t ChatsSent = 0;
+    size_t TicksReceived = 0;
+    size_t TicksMissed = 0;
+
+    Bot(int32_t index, const BotWorld& world, TickLog& tickLog)
+        : _index(index)
+        , _world(world)
+        , _tickLog(tickLog)
+        , _random(static_cast<uint32_t>(index))
+    {
+    }
+
+    void Run(const std::atomic<bool>& stop)
+    {
+        try
+        {
+            Connect();
+            while (!stop)
+            {
+                if (!Update())
+                    break;
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+        catch (const std::exception& ex)
+        {
+            Error = ex.what();
+        }
+        if (_connection.Socket != nullptr)
+        {
+            _connection.SendQueuedPackets();
+            _connection.Socket->Disconnect();
+        }
+    }
+
+private:
+    int32_t _index;
+    const BotWorld& _world;
+    TickLog& _tickLog;
+    std::mt19937 _random;
+
+    NetworkConnection _connection;
+    NetworkKey _key;
+    uint8_t _playerId = 0;
+    uint32_t _serverTick = 0;
+    uint64_t _mapBytesLeft = 0;
+    uint32_t _nextNetworkId = 0;
+    uint32_t _nextChatId = 0;
+    Clock::time_point _connectTime;
+    Clock::time_point _nextAction;
+    Clock::time_point _nextHeartbeat;
+    std::unordered_map<uint32_t, Clock::time_point> _pendingActions;
+    std::unordered_map<uint32_t, Clock::time_point> _pendingChats;
+
+    void Connect()
+    {
+        if (!_key.Generate())
+            throw std::runtime_error("Unable to generate key.");
+
+        _connectTime = Clock::now();
+        _connection.Socket = CreateTcpSocket();
+        _connection.Socket->Connect("127.0.0.1", _world.Port);
+        _connection.QueuePacket(NetworkPacket(NetworkCommand::Token));
+        _connection.SendQueuedPackets();
+    }
+
+    bool Update()
+    {
+        for (;;)
+        {
+            auto status = _connection.ReadPacket();
+            if (status == NetworkReadPacket::Disconnected)
+            {
+                Error = "Disconnected by server.";
+                return false;
+            }
+            if (status != NetworkReadPacket::Success)
+                break;
+
+            auto& packet = _connection.InboundPacket;
+            if (!HandlePacket(packet))
+                return false;
+            packet.Clear();
+        }
+
+        auto now = Clock::now();
+        if (!Joined && now - _connectTime > JoinTimeout)
+        {
+            Error = "Timed out joining.";
+            return false;
+        }
+        if (Joined && now >= _nextAction)
+        {
+            SendAction();
+            _nextAction = now + BotActionInterval + std::chrono::milliseconds(_random() % 50);
+        }
+        if (now >= _nextHeartbeat)
+        {
+            _connection.QueuePacket(NetworkPacket(NetworkCommand::Heartbeat));
+            _nextHeartbeat = now + BotHeartbeatInterval;
+        }
+
+        _connection.SendQueuedPackets();
+        return true;
+    }
+
+    bool HandlePacket(NetworkPacket& packet)
+    {
+        switch (packet.GetCommand())
+        {
+            case NetworkCommand::Token:
+                return HandleToken(packet);
+            case NetworkCommand::Auth:
+                return HandleAuth(packet);
+            case NetworkCommand::ObjectsList:
+                HandleObjectsList(packet);
+                break;
+            case NetworkCommand::MapManifest:
+                HandleMapManifest(packet);
+                break;
+            case NetworkCommand::Map:
+                HandleMap(packet);
+                break;
+            case NetworkCommand::Ping:
+                _connection.QueuePacket(NetworkPacket(NetworkCommand::Ping), true);
+                break;
+            case NetworkCommand::Tick:
+                HandleTick(packet);
+                break;
+            case NetworkCommand::GameAction:
+                HandleGameAction(packet);
+                break;
+            case NetworkCommand::Chat:
+                HandleChat(packet);
+                break;
+            default:
+                break;
+        }
+        return true;
+    }
+
+    bool HandleToken(NetworkPacket& packet)
+    {
+        uint32_t challengeSize;
+        packet >> challengeSize;
+        const auto* challenge = packet.Read(challengeSize);
+        std::vector<uint8_t> signature;
+        if (challenge == nullptr || !_key.Sign(challenge, challengeSize, signature))
+        {
+            Error = "Unable to sign the challenge.";
+            return false;
+        }
+
+        NetworkPacket auth(NetworkCommand::Auth);
+        auth.WriteString(network_get_version());
+        auth.WriteString("Bot " + std::to_string(_index + 1));
+        auth.WriteString("");
+        auth.WriteString(_key.PublicKeyString());
+        auth << static_cast<uint32_t>(signature.size());
+        auth.Write(signature.data(), signature.size());
+        auth << static_cast<uint8_t>(gConfigNetwork.compress_packets);
+        _connection.QueuePacket(auth);
+        return true;
+    }
+
+    bool HandleAuth(NetworkPacket& packet)
+    {
+        uint32_t authStatus;
+        packet >> authStatus >> _playerId;
+        _connection.AuthStatus = static_cast<NetworkAuth>(authStatus);
+        if (_connection.AuthStatus != NetworkAuth::Ok)
+        {
+            Error = "Authentication failed with status " + std::to_string(authStatus) + ".";
+            return false;
+        }
+        return true;
+    }
+
+    void HandleObjectsList(NetworkPacket& packet)
+    {
+        // Bots do not load the park, so they never need any objects.
+        uint32_t index;
+        uint32_t totalObjects;
+        packet >> index >> totalObjects;
+        if (index + 1 >= totalObjects)
+        {
+            NetworkPacket mapRequest(NetworkCommand::MapRequest);
+            mapRequest << static_cast<uint32_t>(0);
+            _connection.QueuePacket(mapRequest);
+        }
+    }
+
+    void HandleMapManifest(NetworkPacket& packet)
+    {
+        // Bots do not keep the map either, every block is requested and only counted.
+        uint32_t snapshotId;
+        uint32_t size;
+        uint32_t blockSize;
+        uint32_t blockCount;
+        packet >> snapshotId >> size >> blockSize >> blockCount;
+
+        NetworkPacket request(NetworkCommand::MapBlockRequest);
+        request << snapshotId << blockCount;
+        for (uint32_t i = 0; i < blockCount; i++)
+        {
+            uint32_t compressedSize;
+            packet.Read(sizeof(NetworkMapBlockHash));
+            packet >> compressedSize;
+            _mapBytesLeft += compressedSize;
+            request << i;
+        }
+        _connection.QueuePacket(request);
+    }
+
+    void HandleMap(NetworkPacket& packet)
+    {
+        uint32_t index;
+        uint32_t offset;
+        packet >> index >> offset;
+        auto chunkSize = packet.Header.Size - packet.BytesRead;
+        _mapBytesLeft -= std::min<uint64_t>(_mapBytesLeft, chunkSize);
+        if (!Joined && _mapBytesLeft == 0)
+        {
+            Joined = true;
+            JoinTime_ms = ToMilliseconds(Clock::now() - _connectTime);
+            _nextAction = Clock::now() + std::chrono::milliseconds(_random() % BotActionInterval.count());
+        }
+    }
+
+    void HandleTick(NetworkPacket& packet)
+    {
+        uint32_t tick;
+        uint32_t srand0;
+        uint32_t flags;
+        packet >> tick >> srand0 >> flags;
+        std::string_view spriteHash;
+        if (flags & NETWORK_TICK_FLAG_CHECKSUMS)
+        {
+            spriteHash = packet.ReadString();
+        }
+
+        if (TicksReceived > 0 && tick > _serverTick + 1)
+        {
+            TicksMissed += tick - _serverTick - 1;
+        }
+        _serverTick = tick;
+        TicksReceived++;
+        _tickLog.Check(tick, srand0, spriteHash);
+    }
+
+    void HandleGameAction(NetworkPacket& packet)
+    {
+        uint32_t tick;
+        GameCommand actionType;
+        packet >> tick >> actionType;
+
+        auto action = GameActions::Create(actionType);
+        if (action == nullptr)
+            return;
+
+        MemoryStream stream;
+        const size_t size = packet.Header.Size - packet.BytesRead;
+        stream.WriteArray(packet.Read(size), size);
+        stream.SetPosition(0);
+
+        DataSerialiser ds(false, stream);
+        action->Serialise(ds);
+        if (action->GetPlayer().id != _playerId)
+            return;
+
+        auto it = _pendingActions.find(action->GetNetworkId());
+        if (it != _pendingActions.end())
+        {
+            ActionLatencies_ms.push_back(ToMilliseconds(Clock::now() - it->second));
+            _pendingActions.erase(it);
+        }
+    }
+
+    void HandleChat(NetworkPacket& packet)
+    {
+        // The server prefixes the name of the sender, the marker identifies the bot and message.
+        auto text = std::string(packet.ReadString());
+        auto markerPos = text.rfind('[');
+        int32_t botIndex;
+        uint32_t chatId;
+        if (markerPos == std::string::npos || std::sscanf(text.c_str() + markerPos, "[%d:%u]", &botIndex, &chatId) != 2
+            || botIndex != _index)
+            return;
+
+        auto it = _pendingChats.find(chatId);
+        if (it != _pendingChats.end())
+        {
+            ChatLatencies_ms.push_back(ToMilliseconds(Clock::now() - it->second));
+            _pendingChats.erase(it);
+        }
+    }
+
+    void SendAction()
+    {
+        auto choice = _random() % 10;
+        if (choice == 0)
+        {
+            auto chatId = _nextChatId++;
+            NetworkPacket chat(NetworkCommand::Chat);
+            chat.WriteString("load test [" + std::to_string(_index) + ":" + std::to_string(chatId) + "]");
+            _connection.QueuePacket(chat);
+            _pendingChats.emplace(chatId, Clock::now());
+            ChatsSent++;
+        }
+        else if (choice < 4 && !_world.Rides.empty())
+        {
+            auto rideIndex = _world.Rides[_random() % _world.Rides.size()];
+            RideSetPriceAction action(rideIndex, static_cast<money16>(_random() % 200), true);
+            SendGameAction(action);
+        }
+        else if (_world.SmallScenery != OBJECT_ENTRY_INDEX_NULL)
+        {
+            // Most of these fail on land the park does not own, the server still has to check every one.
+            auto x = static_cast<int32_t>(1 + _random() % (_world.MapSize - 2)) * COORDS_XY_STEP;
+            auto y = static_cast<int32_t>(1 + _random() % (_world.MapSize - 2)) * COORDS_XY_STEP;
+            SmallSceneryPlaceAction action(
+                { x, y, 0, static_cast<Direction>(_random() % 4) }, static_cast<uint8_t>(_random() % 4), _world.SmallScenery,
+                0, 0);
+            SendGameAction(action);
+        }
+    }
+
+    void SendGameAction(GameAction& action)
+    {
+        auto networkId = ++_nextNetworkId;
+        action.SetNetworkId(networkId);
+
+        DataSerialiser stream(true);
+        action.Serialise(stream);
+
+        NetworkPacket packet(NetworkCommand::GameAction);
+        packet << _serverTick << action.GetType() << stream;
+        _connection.QueuePacket(packet);
+        _pendingActions.emplace(networkId, Clock::now());
+        ActionsSent++;
+    }
+};
+
+static double GetPercentile(std::vector<double> values, double percentile)
+{
+    if (values.empty())
+        return 0;
+
+    std::sort(values.begin(), values.end());
+    auto index = static_cast<size_t>(percentile * (values.size() - 1) + 0.5);
+    return values[std::min(index, values.size() - 1)];
+}
+
+static void PrintPercentiles(const char* name, const std::vector<double>& values)
+{
+    Console::WriteLine(
+        "%-22s %8zu samples, p50 %8.2f ms, p95 %8.2f ms, p99 %8.2f ms, max %8.2f ms", name, values.size(),
+        GetPercentile(values, 0.5), GetPercentile(values, 0.95), GetPercentile(values, 0.99), GetPercentile(values, 1));
+}
+
+static BotWorld GetBotWorld(uint16_t port)
+{
+    BotWorld world;
+    world.Port = port;
+    world.MapSize = gMapSize;
+    for (ObjectEntryIndex i = 0; i < MAX_SMALL_SCENERY_OBJECTS; i++)
+    {
+        if (get_small_scenery_entry(i) != nullptr)
+        {
+            world.SmallScenery = i;
+            break;
+        }
+    }
+    for (const auto& ride : GetRideManager())
+    {
+        world.Rides.push_back(ride.id);
+    }
+    return world;
+}
+
+/**
+ * New players join the default group, which can only chat unless the server has been set up otherwise. Bots need a
+ * group that can build.
+ */
+static void SetBotGroup(NetworkBase& network)
+{
+    const auto defaultGroupIndex = network_get_group_index(network_get_default_group());
+    if (defaultGroupIndex != -1
+        && network_can_perform_command(defaultGroupIndex, static_cast<int32_t>(GameCommand::PlaceScenery)))
+        return;
+
+    for (int32_t i = 0; i < network_get_num_groups(); i++)
+    {
+        if (network_can_perform_command(i, static_cast<int32_t>(GameCommand::PlaceScenery))
+            && network_can_perform_command(i, static_cast<int32_t>(GameCommand::SetRidePrice)))
+        {
+            network.SetDefaultGroup(network_get_group_id(i));
+            return;
+        }
+    }
+    Console::Error::WriteLine("No group can build, bots will only chat.");
+}
+
+static exitcode_t HandleBenchNetwork(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+
+    if (argc < 1)
+    {
+        Console::Error::WriteLine("Missing argument <file>.");
+        return EXITCODE_FAIL;
+    }
+
+    const char* inputPath = argv[0];
+    const auto botCount = argc >= 2 ? std::max(1, atoi(argv[1])) : DefaultBotCount;
+    const auto seconds = argc >= 3 ? std::max(1, atoi(argv[2])) : DefaultSeconds;
+
+    core_init();
+    gOpenRCT2Headless = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+    if (!context->LoadParkFromFile(inputPath))
+    {
+        return EXITCODE_FAIL;
+    }
+
+    const auto port = static_cast<uint16_t>(argc >= 4 ? atoi(argv[3]) : gConfigNetwork.default_port);
+    auto& network = context->GetNetwork();
+    network.SetPassword("");
+    if (!network.BeginServer(port, "127.0.0.1"))
+    {
+        Console::Error::WriteLine("Unable to start the server on port %u.", port);
+        return EXITCODE_FAIL;
+    }
+    SetBotGroup(network);
+
+    const auto world = GetBotWorld(port);
+    TickLog tickLog;
+    std::atomic<bool> stop = false;
+    std::vector<std::unique_ptr<Bot>> bots;
+    std::vector<std::thread> botThreads;
+    for (int32_t i = 0; i < botCount; i++)
+    {
+        bots.push_back(std::make_unique<Bot>(i, world, tickLog));
+        botThreads.emplace_back([bot = bots.back().get(), &stop]() { bot->Run(stop); });
+    }
+
+    // Run the server at normal speed, timing each tick.
+    Console::WriteLine("Running %d bots for %d seconds on port %u...", botCount, seconds, port);
+    std::vector<double> tickTimes;
+    const auto startStats = network.GetStats();
+    const auto start = Clock::now();
+    const auto end = start + std::chrono::seconds(seconds);
+    auto nextTick = start;
+    while (Clock::now() < end)
+    {
+        auto tickStart = Clock::now();
+        context->GetGameState()->UpdateLogic();
+        tickTimes.push_back(ToMilliseconds(Clock::now() - tickStart));
+
+        nextTick += std::chrono::milliseconds(GAME_UPDATE_TIME_MS);
+        std::this_thread::sleep_until(nextTick);
+    }
+    const auto elapsedSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+    const auto endStats = network.GetStats();
+
+    stop = true;
+    for (auto& thread : botThreads)
+    {
+        thread.join();
+    }
+    // Let the server notice the bots leaving before it is closed.
+    context->GetGameState()->UpdateLogic();
+    network.Close();
+
+    // Report
+    std::vector<double> joinTimes;
+    std::vector<double> actionLatencies;
+    std::vector<double> chatLatencies;
+    size_t actionsSent = 0;
+    size_t chatsSent = 0;
+    size_t ticksMissed = 0;
+    for (const auto& bot : bots)
+    {
+        if (!bot->Error.empty())
+        {
+            Console::Error::WriteLine("Bot %d: %s", static_cast<int32_t>(&bot - bots.data()) + 1, bot->Error.c_str());
+        }
+        if (bot->Joined)
+        {
+            joinTimes.push_back(bot->JoinTime_ms);
+        }
+        actionLatencies.insert(actionLatencies.end(), bot->ActionLatencies_ms.begin(), bot->ActionLatencies_ms.end());
+        chatLatencies.insert(chatLatencies.end(), bot->ChatLatencies_ms.begin(), bot->ChatLatencies_ms.end());
+        actionsSent += bot->ActionsSent;
+        chatsSent += bot->ChatsSent;
+        ticksMissed += bot->TicksMissed;
+    }
+
+    const auto total = EnumValue(NetworkStatisticsGroup::Total);
+    const auto bytesSent = endStats.bytesSent[total] - startStats.bytesSent[total];
+    const auto bytesReceived = endStats.bytesReceived[total] - startStats.bytesReceived[total];
+
+    Console::WriteLine("Bots joined:           %zu of %d", joinTimes.size(), botCount);
+    PrintPercentiles("Join time:", joinTimes);
+    PrintPercentiles("Server tick time:", tickTimes);
+    PrintPercentiles("Action latency:", actionLatencies);
+    Console::WriteLine("Actions executed:      %zu of %zu sent", actionLatencies.size(), actionsSent);
+    PrintPercentiles("Chat latency:", chatLatencies);
+    Console::WriteLine("Chat messages echoed:  %zu of %zu sent", chatLatencies.size(), chatsSent);
+    Console::WriteLine(
+        "Server bandwidth:      %.1f KiB/s sent, %.1f KiB/s received", bytesSent / 1024.0 / elapsedSeconds,
+        bytesReceived / 1024.0 / elapsedSeconds);
+    Console::WriteLine("Tick stream:           %zu mismatches, %zu ticks missed", tickLog.GetMismatches(), ticksMissed);
+
+    return tickLog.GetMismatches() == 0 && joinTimes.size() == static_cast<size_t>(botCount) ? EXITCODE_OK : EXITCODE_FAIL;
+}
+
+#else
+static exitcode_t HandleBenchNetwork(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, networking is not enabled in this build");
+    return EXITCODE_FAIL;
+}
+
+const CommandLineCommand CommandLine::BenchNetworkCommands[]{
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchNetwork), CommandTableEnd
+};
+#endif // DISABLE_NETWORK
@@ -0,0 +1,223 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#if defined(USE_BENCHMARK) && defined(ENABLE_SCRIPTING)
+
+#    include "../Context.h"
+#    include "../OpenRCT2.h"
+#    include "../platform/Platform2.h"
+#    include "../platform/platform.h"
+#    include "../scripting/Duktape.hpp"
+#    include "../scripting/ScriptEngine.h"
+
+#    include <benchmark/benchmark.h>
+#    include <cstdint>
+#    include <vector>
+
+using namespace OpenRCT2;
+using namespace OpenRCT2::Scripting;
+
+// Each script is a function that returns the number of entities it looked at.
+static constexpr const char* ScriptGetAllEntities = R"js(
+(function () {
+    var guests = map.getAllEntities('guest');
+    var sum = 0;
+    for (var i = 0; i < guests.length; i++) {
+        var guest = guests[i];
+        sum += guest.x + guest.y + guest.happiness;
+    }
+    return guests.length;
+})
+)js";
+
+static constexpr const char* ScriptQueryEntities = R"js(
+(function () {
+    var guests = map.queryEntities('guest', ['x', 'y', 'happiness']);
+    var sum = 0;
+    for (var i = 0; i < guests.count; i++) {
+        sum += guests.x[i] + guests.y[i] + guests.happiness[i];
+    }
+    return guests.count;
+})
+)js";
+
+static constexpr const char* ScriptGetAllEntitiesFiltered = R"js(
+(function () {
+    var guests = map.getAllEntities('guest');
+    var ids = [];
+    for (var i = 0; i < guests.length; i++) {
+        if (guests[i].happiness < 100) {
+            ids.push(guests[i].id);
+        }
+    }
+    return ids.length;
+})
+)js";
+
+static constexpr const char* ScriptQueryEntitiesFiltered = R"js(
+(function () {
+    var guests = map.queryEntities('guest', ['id'], { happiness: { max: 99 } });
+    return guests.count;
+})
+)js";
+
+// Each script is a function that returns the number of tile elements it looked at.
+static constexpr const char* ScriptGetTileElements = R"js(
+(function () {
+    var count = 0;
+    var sum = 0;
+    for (var y = 0; y < map.size.y; y++) {
+        for (var x = 0; x < map.size.x; x++) {
+            var elements = map.getTile(x, y).elements;
+            for (var i = 0; i < elements.length; i++) {
+                if (elements[i].type === 'small_scenery') {
+                    sum += elements[i].baseHeight;
+                }
+            }
+            count += elements.length;
+        }
+    }
+    return count;
+})
+)js";
+
+static constexpr const char* ScriptGetTiles = R"js(
+(function () {
+    var size = map.size;
+    var tiles = map.getTiles({ leftTop: { x: 0, y: 0 }, rightBottom: { x: size.x * 32, y: size.y * 32 } });
+    var scenery = tiles.typeNames.indexOf('small_scenery');
+    var sum = 0;
+    for (var i = 0; i < tiles.count; i++) {
+        if (tiles.type[i] === scenery) {
+            sum += tiles.baseHeight[i];
+        }
+    }
+    return tiles.count;
+})
+)js";
+
+static void BM_script(benchmark::State& state, const std::string& filename, const char* script)
+{
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        state.SkipWithError("Context initialization failed.");
+        return;
+    }
+    if (!context->LoadParkFromFile(filename))
+    {
+        state.SkipWithError("Failed to load file!");
+        return;
+    }
+
+    auto& scriptEngine = context->GetScriptEngine();
+    scriptEngine.LoadPlugins();
+    auto ctx = scriptEngine.GetContext();
+    if (duk_peval_string(ctx, script) != 0)
+    {
+        state.SkipWithError(duk_safe_to_string(ctx, -1));
+        duk_pop(ctx);
+        return;
+    }
+    auto func = DukValue::take_from_stack(ctx);
+
+    int64_t numItems = 0;
+    for (auto _ : state)
+    {
+        func.push();
+        if (duk_pcall(ctx, 0) != DUK_EXEC_SUCCESS)
+        {
+            state.SkipWithError(duk_safe_to_string(ctx, -1));
+            duk_pop(ctx);
+            break;
+        }
+        numItems += duk_get_int(ctx, -1);
+        duk_pop(ctx);
+    }
+    state.SetItemsProcessed(numItems);
+}
+
+static int CmdlineForBenchScripting(int argc, const char* const* argv)
+{
+    // Google benchmark does stuff to argv. It doesn't modify the pointees,
+    // but it wants to reorder the pointers, so present a copy of them.
+    std::vector<char*> argv_for_benchmark;
+
+    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
+    argv_for_benchmark.push_back(nullptr);
+
+    // Extract file names from argument list. If there is no such file, consider it benchmark option.
+    for (int i = 0; i < argc; i++)
+    {
+        if (Platform::FileExists(argv[i]))
+        {
+            auto name = std::string(argv[i]);
+            benchmark::RegisterBenchmark((name + "/get_all_entities").c_str(), BM_script, argv[i], ScriptGetAllEntities);
+            benchmark::RegisterBenchmark((name + "/query_entities").c_str(), BM_script, argv[i], ScriptQueryEntities);
+            benchmark::RegisterBenchmark(
+                (name + "/get_all_entities_filtered").c_str(), BM_script, argv[i], ScriptGetAllEntitiesFiltered);
+            benchmark::RegisterBenchmark(
+                (name + "/query_entities_filtered").c_str(), BM_script, argv[i], ScriptQueryEntitiesFiltered);
+            benchmark::RegisterBenchmark((name + "/get_tile_elements").c_str(), BM_script, argv[i], ScriptGetTileElements);
+            benchmark::RegisterBenchmark((name + "/get_tiles").c_str(), BM_script, argv[i], ScriptGetTiles);
+        }
+        else
+        {
+            argv_for_benchmark.push_back(const_cast<char*>(argv[i]));
+        }
+    }
+    // Update argc with all the changes made
+    argc = static_cast<int>(argv_for_benchmark.size());
+    ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
+    if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
+        return -1;
+
+    core_init();
+    gOpenRCT2Headless = true;
+
+    ::benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
+
+static exitcode_t HandleBenchScripting(CommandLineArgEnumerator* argEnumerator)
+{
+    const char* const* argv = static_cast<const char* const*>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = CmdlineForBenchScripting(argc, argv);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+#else
+static exitcode_t HandleBenchScripting(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, Google benchmark or scripting not enabled in this build");
+    return EXITCODE_FAIL;
+}
+#endif // USE_BENCHMARK && ENABLE_SCRIPTING
+
+const CommandLineCommand CommandLine::BenchScriptingCommands[]{
+#if defined(USE_BENCHMARK) && defined(ENABLE_SCRIPTING)
+    DefineCommand(
+        "",
+        "<file>... [--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
+        "[--benchmark_repetitions=<num_repetitions>] [--benchmark_report_aggregates_only={true|false}] "
+        "[--benchmark_format=<console|json|csv>] [--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>] "
+        "[--benchmark_color={auto|true|false}] [--benchmark_counters_tabular={true|false}] [--v=<verbosity>]",
+        nullptr, HandleBenchScripting),
+    CommandTableEnd
+#else
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchScripting), CommandTableEnd
+#endif // USE_BENCHMARK && ENABLE_SCRIPTING
+};
@@ -17,6 +17,7 @@
 #    include "../platform/Platform2.h"
 #    include "../platform/platform.h"
 
+#    include <algorithm>
 #    include <benchmark/benchmark.h>
 #    include <cstdint>
 #    include <iterator>
@@ -58,6 +59,20 @@ static void BM_update(benchmark::State& state, const std::string& filename)
             }
             return std::chrono::duration_cast<std::chrono::milliseconds>(timesum).count();
         };
+        // Timings are taken from the start of the update, the time spent in a part is the difference to the part before.
+        auto longest = [timings](LogicTimePart part, LogicTimePart previousPart) -> double {
+            std::chrono::duration<double, std::milli> result{};
+            for (const auto& timing : timings)
+            {
+                const auto& partTimes = timing.TimingInfo.at(part);
+                const auto& previousPartTimes = timing.TimingInfo.at(previousPart);
+                for (size_t i = 0; i < LOGIC_UPDATE_MEASUREMENTS_COUNT; i++)
+                {
+                    result = std::max<std::chrono::duration<double, std::milli>>(result, partTimes[i] - previousPartTimes[i]);
+                }
+            }
+            return result.count();
+        };
         state.counters["NetworkUpdateAcc_ms"] = accumulator(LogicTimePart::NetworkUpdate);
         state.counters["DateAcc_ms"] = accumulator(LogicTimePart::Date);
         state.counters["ScenarioAcc_ms"] = accumulator(LogicTimePart::Scenario);
@@ -80,6 +95,8 @@ static void BM_update(benchmark::State& state, const std::string& filename)
         state.counters["GameActionsAcc_ms"] = accumulator(LogicTimePart::GameActions);
         state.counters["NetworkFlushAcc_ms"] = accumulator(LogicTimePart::NetworkFlush);
         state.counters["ScriptsAcc_ms"] = accumulator(LogicTimePart::Scripts);
+        state.counters["ScenarioMax_ms"] = longest(LogicTimePart::Scenario, LogicTimePart::Date);
+        state.counters["ParkMax_ms"] = longest(LogicTimePart::Park, LogicTimePart::Ride);
     }
     else
     {
@@ -0,0 +1,157 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../Context.h"
+#    include "../OpenRCT2.h"
+#    include "../platform/Platform2.h"
+#    include "../platform/platform.h"
+#    include "../ride/TrainManager.h"
+#    include "../ride/Vehicle.h"
+#    include "../ride/VehicleSubpositionData.h"
+
+#    include <benchmark/benchmark.h>
+#    include <cstdint>
+#    include <vector>
+
+using namespace OpenRCT2;
+
+static void SetSubpositionCounters(benchmark::State& state)
+{
+    state.counters["PackedSize_bytes"] = static_cast<double>(GetVehicleSubpositionPackedSize());
+    state.counters["DecodedSize_bytes"] = static_cast<double>(GetVehicleSubpositionDecodedSize());
+}
+
+// Walks every position of every track piece, the way vehicles step through them.
+static void BM_subposition_lookup(benchmark::State& state)
+{
+    int64_t numPositions = 0;
+    for (auto _ : state)
+    {
+        int32_t sum = 0;
+        for (uint8_t subposition = 0; subposition < EnumValue(VehicleTrackSubposition::Count); subposition++)
+        {
+            for (uint16_t typeAndDirection = 0; typeAndDirection < VehicleTrackSubpositionSizeDefault; typeAndDirection++)
+            {
+                auto list = GetVehicleSubpositionList(static_cast<VehicleTrackSubposition>(subposition), typeAndDirection);
+                for (uint16_t i = 0; i < list.size; i++)
+                {
+                    sum += list.info[i].x + list.info[i].y + list.info[i].z;
+                }
+                numPositions += list.size;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(numPositions);
+    SetSubpositionCounters(state);
+}
+
+static void BM_vehicle_update(benchmark::State& state, const std::string& filename)
+{
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        state.SkipWithError("Context initialization failed.");
+        return;
+    }
+    if (!context->LoadParkFromFile(filename))
+    {
+        state.SkipWithError("Failed to load file!");
+        return;
+    }
+
+    int64_t numTrains = 0;
+    for (auto _ : state)
+    {
+        vehicle_update_all();
+        for ([[maybe_unused]] auto* train : TrainManager::View())
+        {
+            numTrains++;
+        }
+    }
+    state.SetItemsProcessed(numTrains);
+    SetSubpositionCounters(state);
+}
+
+static int CmdlineForBenchVehicles(int argc, const char* const* argv)
+{
+    // Vehicle data lookups do not need a park
+    benchmark::RegisterBenchmark("baseline/subposition_lookup", BM_subposition_lookup);
+
+    // Google benchmark does stuff to argv. It doesn't modify the pointees,
+    // but it wants to reorder the pointers, so present a copy of them.
+    std::vector<char*> argv_for_benchmark;
+
+    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
+    argv_for_benchmark.push_back(nullptr);
+
+    // Extract file names from argument list. If there is no such file, consider it benchmark option.
+    for (int i = 0; i < argc; i++)
+    {
+        if (Platform::FileExists(argv[i]))
+        {
+            // Register benchmarks for sv6 if valid
+            benchmark::RegisterBenchmark((std::string(argv[i]) + "/vehicle_update").c_str(), BM_vehicle_update, argv[i]);
+        }
+        else
+        {
+            argv_for_benchmark.push_back(const_cast<char*>(argv[i]));
+        }
+    }
+    // Update argc with all the changes made
+    argc = static_cast<int>(argv_for_benchmark.size());
+    ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
+    if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
+        return -1;
+
+    core_init();
+    gOpenRCT2Headless = true;
+
+    ::benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
+
+static exitcode_t HandleBenchVehicles(CommandLineArgEnumerator* argEnumerator)
+{
+    const char* const* argv = static_cast<const char* const*>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = CmdlineForBenchVehicles(argc, argv);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+#else
+static exitcode_t HandleBenchVehicles(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, Google benchmark not enabled in this build");
+    return EXITCODE_FAIL;
+}
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchVehiclesCommands[]{
+#ifdef USE_BENCHMARK
+    DefineCommand(
+        "",
+        "<file>... [--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
+        "[--benchmark_repetitions=<num_repetitions>] [--benchmark_report_aggregates_only={true|false}] "
+        "[--benchmark_format=<console|json|csv>] [--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>] "
+        "[--benchmark_color={auto|true|false}] [--benchmark_counters_tabular={true|false}] [--v=<verbosity>]",
+        nullptr, HandleBenchVehicles),
+    CommandTableEnd
+#else
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchVehicles), CommandTableEnd
+#endif // USE_BENCHMARK
+};
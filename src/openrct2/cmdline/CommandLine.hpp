@@ -119,7 +119,12 @@ namespace CommandLine
     extern const CommandLineCommand BenchGfxCommands[];
     extern const CommandLineCommand BenchSpriteSortCommands[];
     extern const CommandLineCommand BenchUpdateCommands[];
+    extern const CommandLineCommand BenchConstructionCommands[];
+    extern const CommandLineCommand BenchVehiclesCommands[];
     extern const CommandLineCommand SimulateCommands[];
+    extern const CommandLineCommand BenchNetworkCommands[];
+    extern const CommandLineCommand BenchFormattingCommands[];
+    extern const CommandLineCommand BenchScriptingCommands[];
 
     extern const CommandLineExample RootExamples[];
 
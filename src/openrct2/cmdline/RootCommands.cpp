@@ -140,7 +140,12 @@ const CommandLineCommand CommandLine::RootCommands[]
     DefineSubCommand("benchgfx",        CommandLine::BenchGfxCommands         ),
     DefineSubCommand("benchspritesort", CommandLine::BenchSpriteSortCommands  ),
     DefineSubCommand("benchsimulate",   CommandLine::BenchUpdateCommands      ),
+    DefineSubCommand("benchconstruction", CommandLine::BenchConstructionCommands),
+    DefineSubCommand("benchvehicles",   CommandLine::BenchVehiclesCommands    ),
     DefineSubCommand("simulate",        CommandLine::SimulateCommands         ),
+    DefineSubCommand("benchnetwork",    CommandLine::BenchNetworkCommands     ),
+    DefineSubCommand("benchformatting", CommandLine::BenchFormattingCommands  ),
+    DefineSubCommand("benchscripting",  CommandLine::BenchScriptingCommands   ),
     CommandTableEnd
 };
 
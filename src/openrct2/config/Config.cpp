@@ -420,6 +420,8 @@ namespace Config
             model->log_server_actions = reader->GetBoolean("log_server_actions", false);
             model->pause_server_if_no_clients = reader->GetBoolean("pause_server_if_no_clients", false);
             model->desync_debugging = reader->GetBoolean("desync_debugging", false);
+            model->use_io_thread = reader->GetBoolean("use_io_thread", false);
+            model->compress_packets = reader->GetBoolean("compress_packets", false);
         }
     }
 
@@ -447,6 +449,8 @@ namespace Config
         writer->WriteBoolean("log_server_actions", model->log_server_actions);
         writer->WriteBoolean("pause_server_if_no_clients", model->pause_server_if_no_clients);
         writer->WriteBoolean("desync_debugging", model->desync_debugging);
+        writer->WriteBoolean("use_io_thread", model->use_io_thread);
+        writer->WriteBoolean("compress_packets", model->compress_packets);
     }
 
     static void ReadNotifications(IIniReader* reader)
@@ -548,6 +552,7 @@ namespace Config
             auto model = &gConfigPlugin;
             model->enable_hot_reloading = reader->GetBoolean("enable_hot_reloading", false);
             model->allowed_hosts = reader->GetString("allowed_hosts", "");
+            model->update_budget = reader->GetInt32("update_budget", 10);
         }
     }
 
@@ -557,6 +562,7 @@ namespace Config
         writer->WriteSection("plugin");
         writer->WriteBoolean("enable_hot_reloading", model->enable_hot_reloading);
         writer->WriteString("allowed_hosts", model->allowed_hosts);
+        writer->WriteInt32("update_budget", model->update_budget);
     }
 
     static bool SetDefaults()
@@ -162,6 +162,8 @@ struct NetworkConfiguration
     bool log_server_actions;
     bool pause_server_if_no_clients;
     bool desync_debugging;
+    bool use_io_thread;
+    bool compress_packets;
 };
 
 struct NotificationConfiguration
@@ -208,6 +210,7 @@ struct PluginConfiguration
 {
     bool enable_hot_reloading;
     std::string allowed_hosts;
+    int32_t update_budget;
 };
 
 enum class Sort : int32_t
@@ -116,7 +116,11 @@ void JobPool::ProcessQueue()
 
             lock.lock();
 
-            _completed.push_back(std::move(taskData));
+            // Only completion functions have to wait for Join, so pools that are never joined do not keep old tasks.
+            if (taskData.CompletionFn)
+            {
+                _completed.push_back(std::move(taskData));
+            }
 
             _processing--;
             _condComplete.notify_one();
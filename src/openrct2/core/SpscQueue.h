@@ -0,0 +1,80 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <utility>
+
+/**
+ * An unbounded lock-free queue for handing values from one thread to another. Only one thread may push and only one
+ * thread may pop, those can be different threads.
+ */
+template<typename TType> class SpscQueue
+{
+private:
+    struct Node
+    {
+        std::atomic<Node*> Next{};
+        std::optional<TType> Value;
+    };
+
+    // The node before the first value, only used by the popping thread.
+    Node* _head;
+    // The last node, only used by the pushing thread.
+    Node* _tail;
+
+public:
+    SpscQueue()
+        : _head(new Node())
+    {
+        _tail = _head;
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    ~SpscQueue()
+    {
+        while (_head != nullptr)
+        {
+            auto* next = _head->Next.load(std::memory_order_relaxed);
+            delete _head;
+            _head = next;
+        }
+    }
+
+    void push(TType&& value)
+    {
+        auto* node = new Node();
+        node->Value = std::move(value);
+        _tail->Next.store(node, std::memory_order_release);
+        _tail = node;
+    }
+
+    bool try_pop(TType& value)
+    {
+        auto* next = _head->Next.load(std::memory_order_acquire);
+        if (next == nullptr)
+            return false;
+
+        // The popped node becomes the node before the first value.
+        value = std::move(*next->Value);
+        next->Value.reset();
+        delete _head;
+        _head = next;
+        return true;
+    }
+
+    bool empty() const
+    {
+        return _head->Next.load(std::memory_order_acquire) == nullptr;
+    }
+};
@@ -18,13 +18,17 @@
 #include "../entity/Peep.h"
 #include "../entity/Staff.h"
 #include "../interface/Viewport.h"
+#include "../peep/GuestRideIndex.h"
+#include "../peep/PeepStats.h"
 #include "../peep/RideUseSystem.h"
 #include "../ride/Vehicle.h"
 #include "../scenario/Scenario.h"
 #include "Balloon.h"
 #include "Duck.h"
+#include "EntityScreenIndex.h"
 #include "EntityTweener.h"
 #include "Fountain.h"
+#include "Litter.h"
 #include "MoneyEffect.h"
 #include "Particle.h"
 
@@ -180,6 +184,10 @@ void ResetAllEntities()
     std::fill(std::begin(_entities), std::end(_entities), Entity());
     OpenRCT2::RideUse::GetHistory().Clear();
     OpenRCT2::RideUse::GetTypeHistory().Clear();
+    OpenRCT2::PeepStats::Clear();
+    OpenRCT2::GuestRideIndex::Clear();
+    Litter::ClearCreationOrder();
+    EntityScreenIndex::Clear();
     for (int32_t i = 0; i < MAX_ENTITIES; ++i)
     {
         auto* spr = GetEntity(i);
@@ -219,6 +227,13 @@ void ResetEntitySpatialIndices()
             EntitySpatialInsert(spr, { spr->x, spr->y });
         }
     }
+
+    // This is done after every park load, rebuild the other indices kept on top of the entity lists as well.
+    OpenRCT2::PeepStats::Rebuild();
+    OpenRCT2::GuestRideIndex::Rebuild();
+    Litter::RebuildCreationOrder();
+    EntityScreenIndex::Rebuild();
+    staff_update_greyed_patrol_areas();
 }
 
 #ifndef DISABLE_NETWORK
@@ -322,6 +337,12 @@ static void PrepareNewEntity(EntityBase* base, const EntityType type)
     base->SpriteRect = {};
 
     EntitySpatialInsert(base, { LOCATION_NULL, 0 });
+
+    if (auto* litter = base->As<Litter>(); litter != nullptr)
+    {
+        litter->creationTick = gCurrentTicks;
+        litter->AddToCreationOrder();
+    }
 }
 
 EntityBase* CreateEntity(EntityType type)
@@ -457,6 +478,7 @@ void EntityBase::MoveTo(const CoordsXYZ& newLocation)
         x = loc.x;
         y = loc.y;
         z = loc.z;
+        EntityScreenIndex::Remove(*this);
     }
     else
     {
@@ -473,6 +495,7 @@ void EntitySetCoordinates(const CoordsXYZ& entityPos, EntityBase* entity)
         screenCoords - ScreenCoordsXY{ entity->sprite_width, entity->sprite_height_negative },
         screenCoords + ScreenCoordsXY{ entity->sprite_width, entity->sprite_height_positive });
     entity->SetLocation(entityPos);
+    EntityScreenIndex::Update(*entity);
 }
 
 /**
@@ -482,16 +505,24 @@ static void FreeEntity(EntityBase& entity)
 {
     auto* guest = entity.As<Guest>();
     auto* staff = entity.As<Staff>();
+    auto* litter = entity.As<Litter>();
     if (staff != nullptr)
     {
         staff->SetName({});
         staff->ClearPatrolArea();
+        OpenRCT2::PeepStats::Remove(*staff);
     }
     else if (guest != nullptr)
     {
         guest->SetName({});
         OpenRCT2::RideUse::GetHistory().RemoveHandle(guest->sprite_index);
         OpenRCT2::RideUse::GetTypeHistory().RemoveHandle(guest->sprite_index);
+        OpenRCT2::PeepStats::Remove(*guest);
+        OpenRCT2::GuestRideIndex::Remove(*guest);
+    }
+    else if (litter != nullptr)
+    {
+        litter->RemoveFromCreationOrder();
     }
 }
 
@@ -508,6 +539,7 @@ void EntityRemove(EntityBase* entity)
     AddToFreeList(entity->sprite_index);
 
     EntitySpatialRemove(entity);
+    EntityScreenIndex::Remove(*entity);
     EntityReset(entity);
 }
 
@@ -0,0 +1,120 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "EntityScreenIndex.h"
+
+#include <algorithm>
+#include <array>
+
+namespace EntityScreenIndex
+{
+    constexpr uint32_t NoCell = UINT32_MAX;
+
+    // Entity indices of each cell are kept in sprite_index order, the same as the tile index.
+    static std::array<std::vector<uint16_t>, CellCount * CellCount> _cells;
+    static std::array<uint32_t, MAX_ENTITIES> _entityCell = [] {
+        std::array<uint32_t, MAX_ENTITIES> result;
+        result.fill(NoCell);
+        return result;
+    }();
+
+    static int32_t GetCellCoordinate(int32_t screenCoordinate)
+    {
+        return std::clamp((screenCoordinate - CellOrigin) / CellSize, 0, CellCount - 1);
+    }
+
+    static uint32_t GetEntityCell(const EntityBase& entity)
+    {
+        if (entity.Type == EntityType::Null || entity.x == LOCATION_NULL)
+            return NoCell;
+
+        const auto cellX = GetCellCoordinate(entity.SpriteRect.GetLeft());
+        const auto cellY = GetCellCoordinate(entity.SpriteRect.GetTop());
+        return cellY * CellCount + cellX;
+    }
+
+    static void RemoveFromCell(uint16_t spriteIndex, uint32_t cell)
+    {
+        auto& cellVector = _cells[cell];
+        auto it = std::lower_bound(std::begin(cellVector), std::end(cellVector), spriteIndex);
+        if (it != std::end(cellVector) && *it == spriteIndex)
+        {
+            cellVector.erase(it);
+        }
+    }
+
+    static void InsertIntoCell(uint16_t spriteIndex, uint32_t cell)
+    {
+        auto& cellVector = _cells[cell];
+        auto it = std::lower_bound(std::begin(cellVector), std::end(cellVector), spriteIndex);
+        cellVector.insert(it, spriteIndex);
+    }
+
+    void Update(const EntityBase& entity)
+    {
+        auto& currentCell = _entityCell[entity.sprite_index];
+        const auto newCell = GetEntityCell(entity);
+        if (newCell == currentCell)
+            return;
+
+        if (currentCell != NoCell)
+        {
+            RemoveFromCell(entity.sprite_index, currentCell);
+        }
+        if (newCell != NoCell)
+        {
+            InsertIntoCell(entity.sprite_index, newCell);
+        }
+        currentCell = newCell;
+    }
+
+    void Remove(const EntityBase& entity)
+    {
+        auto& currentCell = _entityCell[entity.sprite_index];
+        if (currentCell != NoCell)
+        {
+            RemoveFromCell(entity.sprite_index, currentCell);
+            currentCell = NoCell;
+        }
+    }
+
+    void Clear()
+    {
+        for (auto& cell : _cells)
+        {
+            cell.clear();
+        }
+        _entityCell.fill(NoCell);
+    }
+
+    void Rebuild()
+    {
+        Clear();
+        for (size_t i = 0; i < MAX_ENTITIES; i++)
+        {
+            auto* entity = GetEntity(i);
+            if (entity != nullptr)
+            {
+                Update(*entity);
+            }
+        }
+    }
+
+    CellRange GetCellRange(const ScreenRect& rect)
+    {
+        // Entities are bucketed by the top left of their sprite rect, which can be up to a sprite size before rect.
+        return { GetCellCoordinate(rect.GetLeft() - MaxSpriteSize), GetCellCoordinate(rect.GetTop() - MaxSpriteSize),
+                 GetCellCoordinate(rect.GetRight()), GetCellCoordinate(rect.GetBottom()) };
+    }
+
+    const std::vector<uint16_t>& GetCell(int32_t cellX, int32_t cellY)
+    {
+        return _cells[cellY * CellCount + cellX];
+    }
+} // namespace EntityScreenIndex
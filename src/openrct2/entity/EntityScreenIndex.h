@@ -0,0 +1,120 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../world/Map.h"
+#include "EntityRegistry.h"
+
+#include <cstdint>
+#include <vector>
+
+/*
+ * Entities on the map bucketed by the screen position of their SpriteRect, so the entities overlapping a viewport can be
+ * found without testing every entity. The sprite rect is only known for the current rotation, rotating the view moves
+ * every entity through EntitySetCoordinates which puts them into their new buckets.
+ */
+namespace EntityScreenIndex
+{
+    // A sprite rect extends at most this far from its top left corner, see sprite_width and sprite_height_*.
+    constexpr int32_t MaxSpriteSize = 2 * UINT8_MAX;
+
+    constexpr int32_t CellSize = 512;
+    constexpr int32_t CellOrigin = -MAXIMUM_MAP_SIZE_BIG;
+    constexpr int32_t CellCount = (2 * MAXIMUM_MAP_SIZE_BIG) / CellSize + 1;
+
+    struct CellRange
+    {
+        int32_t minX;
+        int32_t minY;
+        int32_t maxX;
+        int32_t maxY;
+
+        bool Contains(int32_t cellX, int32_t cellY) const
+        {
+            return cellX >= minX && cellX <= maxX && cellY >= minY && cellY <= maxY;
+        }
+    };
+
+    void Update(const EntityBase& entity);
+    void Remove(const EntityBase& entity);
+    void Clear();
+    void Rebuild();
+
+    /**
+     * Returns the cells holding every entity whose sprite rect can overlap rect.
+     */
+    CellRange GetCellRange(const ScreenRect& rect);
+    const std::vector<uint16_t>& GetCell(int32_t cellX, int32_t cellY);
+
+    inline bool Overlaps(const ScreenRect& a, const ScreenRect& b)
+    {
+        return a.GetLeft() <= b.GetRight() && a.GetRight() >= b.GetLeft() && a.GetTop() <= b.GetBottom()
+            && a.GetBottom() >= b.GetTop();
+    }
+} // namespace EntityScreenIndex
+
+/**
+ * Calls func once for every entity of type T on the map whose sprite rect overlaps any of the given areas, edges
+ * included.
+ */
+template<typename T, typename TFunc> void ForEachEntityInScreenAreas(const std::vector<ScreenRect>& areas, TFunc&& func)
+{
+    using namespace EntityScreenIndex;
+
+    std::vector<CellRange> ranges;
+    ranges.reserve(areas.size());
+    for (const auto& area : areas)
+    {
+        ranges.push_back(GetCellRange(area));
+    }
+
+    for (size_t i = 0; i < ranges.size(); i++)
+    {
+        const auto& range = ranges[i];
+        for (auto cellY = range.minY; cellY <= range.maxY; cellY++)
+        {
+            for (auto cellX = range.minX; cellX <= range.maxX; cellX++)
+            {
+                // Overlapping areas share cells, only visit each cell for the first area containing it.
+                bool visited = false;
+                for (size_t j = 0; j < i && !visited; j++)
+                {
+                    visited = ranges[j].Contains(cellX, cellY);
+                }
+                if (visited)
+                    continue;
+
+                for (auto spriteIndex : GetCell(cellX, cellY))
+                {
+                    auto* entity = GetEntity<T>(spriteIndex);
+                    if (entity == nullptr || entity->x == LOCATION_NULL)
+                        continue;
+
+                    for (const auto& area : areas)
+                    {
+                        if (Overlaps(entity->SpriteRect, area))
+                        {
+                            func(*entity);
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Calls func for every entity of type T on the map whose sprite rect overlaps rect, edges included.
+ */
+template<typename T, typename TFunc> void ForEachEntityInScreenRect(const ScreenRect& rect, TFunc&& func)
+{
+    ForEachEntityInScreenAreas<T>({ rect }, func);
+}
@@ -0,0 +1,248 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../world/Map.h"
+#include "EntityList.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <optional>
+#include <utility>
+#include <vector>
+
+/*
+ * Typed spatial queries on top of the per tile entity index.
+ *
+ * All queries only consider entities that are on the map and whose x and y are both within the given radius of the
+ * query location. Results are the same as a scan over EntityList<T> with a strict less than comparison, i.e. of
+ * entities with an equal distance the one with the lowest sprite index wins.
+ */
+namespace EntitySpatialQuery
+{
+    // Tiles are only searched ring by ring while that is cheaper than scanning every entity of the type.
+    constexpr int32_t TilesPerEntityScan = 4;
+    constexpr int32_t MinTileBudget = 16;
+
+    struct TileRange
+    {
+        int32_t minX;
+        int32_t minY;
+        int32_t maxX;
+        int32_t maxY;
+    };
+
+    inline TileRange GetTileRange(const CoordsXY& loc, int32_t radius)
+    {
+        constexpr int32_t maxTile = MAXIMUM_MAP_SIZE_TECHNICAL - 1;
+        return { std::clamp((loc.x - radius) / COORDS_XY_STEP, 0, maxTile),
+                 std::clamp((loc.y - radius) / COORDS_XY_STEP, 0, maxTile),
+                 std::clamp((loc.x + radius) / COORDS_XY_STEP, 0, maxTile),
+                 std::clamp((loc.y + radius) / COORDS_XY_STEP, 0, maxTile) };
+    }
+
+    inline bool IsWithinRadius(const EntityBase& entity, const CoordsXY& loc, int32_t radius)
+    {
+        return entity.x != LOCATION_NULL && std::abs(entity.x - loc.x) <= radius && std::abs(entity.y - loc.y) <= radius;
+    }
+
+    /**
+     * Calls func for every tile of the given range whose tile distance from centre is exactly ring.
+     */
+    template<typename TFunc>
+    void ForEachTileInRing(const TileCoordsXY& centre, int32_t ring, const TileRange& range, TFunc&& func)
+    {
+        const auto minX = std::max(centre.x - ring, range.minX);
+        const auto maxX = std::min(centre.x + ring, range.maxX);
+        const auto minY = std::max(centre.y - ring, range.minY);
+        const auto maxY = std::min(centre.y + ring, range.maxY);
+        for (auto tileX = minX; tileX <= maxX; tileX++)
+        {
+            const bool isEdgeColumn = std::abs(tileX - centre.x) == ring;
+            for (auto tileY = minY; tileY <= maxY; tileY++)
+            {
+                if (isEdgeColumn || std::abs(tileY - centre.y) == ring)
+                {
+                    func(TileCoordsXY{ tileX, tileY });
+                }
+                else
+                {
+                    // Skip the inside of the ring, it has already been visited.
+                    tileY = std::max(tileY, centre.y + ring - 1);
+                }
+            }
+        }
+    }
+
+    /**
+     * Keeps the count lowest (distance, sprite index) pairs seen so far, sorted.
+     */
+    template<typename T> class NearestSet
+    {
+    private:
+        std::vector<std::pair<uint32_t, T*>> _items;
+        size_t _count;
+
+    public:
+        explicit NearestSet(size_t count)
+            : _count(count)
+        {
+            _items.reserve(count);
+        }
+
+        bool IsFull() const
+        {
+            return _items.size() >= _count;
+        }
+
+        uint32_t GetWorstDistance() const
+        {
+            return _items.back().first;
+        }
+
+        void Add(uint32_t distance, T* entity)
+        {
+            auto pos = std::upper_bound(
+                _items.begin(), _items.end(), std::make_pair(distance, entity), [](const auto& a, const auto& b) {
+                    return a.first < b.first || (a.first == b.first && a.second->sprite_index < b.second->sprite_index);
+                });
+            if (IsFull())
+            {
+                if (pos == _items.end())
+                    return;
+                _items.pop_back();
+            }
+            _items.insert(pos, { distance, entity });
+        }
+
+        std::vector<T*> GetEntities() const
+        {
+            std::vector<T*> result;
+            result.reserve(_items.size());
+            for (const auto& item : _items)
+            {
+                result.push_back(item.second);
+            }
+            return result;
+        }
+    };
+
+    template<typename T, typename TDistanceFunc>
+    void ScanNearest(NearestSet<T>& nearest, const CoordsXY& loc, int32_t radius, TDistanceFunc& getDistance)
+    {
+        for (auto* entity : EntityList<T>())
+        {
+            if (!IsWithinRadius(*entity, loc, radius))
+                continue;
+
+            std::optional<uint32_t> distance = getDistance(*entity);
+            if (distance.has_value())
+            {
+                nearest.Add(*distance, entity);
+            }
+        }
+    }
+} // namespace EntitySpatialQuery
+
+/**
+ * Calls func for every entity of type T whose x and y are both within radius of loc.
+ */
+template<typename T, typename TFunc> void ForEachEntityInRadius(const CoordsXY& loc, int32_t radius, TFunc&& func)
+{
+    const auto range = EntitySpatialQuery::GetTileRange(loc, radius);
+    for (auto tileX = range.minX; tileX <= range.maxX; tileX++)
+    {
+        for (auto tileY = range.minY; tileY <= range.maxY; tileY++)
+        {
+            for (auto* entity : EntityTileList<T>(TileCoordsXY{ tileX, tileY }.ToCoordsXY()))
+            {
+                if (EntitySpatialQuery::IsWithinRadius(*entity, loc, radius))
+                {
+                    func(*entity);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Returns the number of entities of type T whose x and y are both within radius of loc.
+ */
+template<typename T> uint32_t CountEntitiesInRadius(const CoordsXY& loc, int32_t radius)
+{
+    uint32_t count = 0;
+    ForEachEntityInRadius<T>(loc, radius, [&count](const T&) { count++; });
+    return count;
+}
+
+/**
+ * Returns up to count entities of type T nearest to loc, nearest first. getDistance returns the distance of an entity
+ * or std::nullopt to skip it, and must never be less than the larger of the x and y distance to loc.
+ */
+template<typename T, typename TDistanceFunc>
+std::vector<T*> FindNearestEntities(const CoordsXY& loc, int32_t radius, size_t count, TDistanceFunc&& getDistance)
+{
+    using namespace EntitySpatialQuery;
+
+    NearestSet<T> nearest(count);
+    if (count == 0 || loc.IsNull())
+        return {};
+
+    const auto range = GetTileRange(loc, radius);
+    const auto centre = TileCoordsXY{ std::clamp(loc.x / COORDS_XY_STEP, range.minX, range.maxX),
+                                      std::clamp(loc.y / COORDS_XY_STEP, range.minY, range.maxY) };
+    const auto numRings = std::max(
+        { centre.x - range.minX, range.maxX - centre.x, centre.y - range.minY, range.maxY - centre.y });
+
+    // Rings get more expensive the further out the search goes, give up and scan the type's list when that is cheaper.
+    const auto tileBudget = std::max<int32_t>(MinTileBudget, GetEntityListCount(T::cEntityType) * TilesPerEntityScan);
+    int32_t tilesVisited = 0;
+    for (int32_t ring = 0; ring <= numRings; ring++)
+    {
+        tilesVisited += ring == 0 ? 1 : ring * 8;
+        if (tilesVisited > tileBudget)
+        {
+            NearestSet<T> scanned(count);
+            ScanNearest(scanned, loc, radius, getDistance);
+            return scanned.GetEntities();
+        }
+
+        ForEachTileInRing(centre, ring, range, [&](const TileCoordsXY& tile) {
+            for (auto* entity : EntityTileList<T>(tile.ToCoordsXY()))
+            {
+                if (!IsWithinRadius(*entity, loc, radius))
+                    continue;
+
+                std::optional<uint32_t> distance = getDistance(*entity);
+                if (distance.has_value())
+                {
+                    nearest.Add(*distance, entity);
+                }
+            }
+        });
+
+        // Anything on a further ring is at least this far away in x or y, so it can not beat or tie the results.
+        const auto nextRingDistance = static_cast<uint32_t>(ring * COORDS_XY_STEP + 1);
+        if (nearest.IsFull() && nearest.GetWorstDistance() < nextRingDistance)
+            break;
+    }
+    return nearest.GetEntities();
+}
+
+/**
+ * Returns the entity of type T nearest to loc, see FindNearestEntities.
+ */
+template<typename T, typename TDistanceFunc>
+T* FindNearestEntity(const CoordsXY& loc, int32_t radius, TDistanceFunc&& getDistance)
+{
+    auto nearest = FindNearestEntities<T>(loc, radius, 1, getDistance);
+    return nearest.empty() ? nullptr : nearest.front();
+}
@@ -10,28 +10,37 @@
 
 #include "../entity/Guest.h"
 #include "../entity/Staff.h"
+#include "../interface/Viewport.h"
 #include "../ride/Vehicle.h"
-#include "EntityList.h"
 #include "EntityRegistry.h"
+#include "EntityScreenIndex.h"
 
 #include <cmath>
+
+// Entities are not drawn in viewports zoomed out further than this.
+static constexpr ZoomLevel MaxTweenZoom{ 2 };
+
+// More than any entity moves on screen in a single tick.
+static constexpr int32_t MaxTweenTickMovement = 128;
+
 void EntityTweener::PopulateEntities()
 {
-    for (auto ent : EntityList<Guest>())
-    {
-        Entities.push_back(ent);
-        PrePos.emplace_back(ent->GetLocation());
-    }
-    for (auto ent : EntityList<Staff>())
+    // Only entities that are drawn need to be tweened. Grow the visible areas by how far an entity can move in a tick,
+    // so entities moving into view are tweened as well.
+    auto areas = viewports_get_visible_areas(MaxTweenZoom);
+    for (auto& area : areas)
     {
-        Entities.push_back(ent);
-        PrePos.emplace_back(ent->GetLocation());
-    }
-    for (auto ent : EntityList<Vehicle>())
-    {
-        Entities.push_back(ent);
-        PrePos.emplace_back(ent->GetLocation());
+        const auto margin = ScreenCoordsXY{ MaxTweenTickMovement, MaxTweenTickMovement };
+        area = ScreenRect(area.Point1 - margin, area.Point2 + margin);
     }
+
+    ForEachEntityInScreenAreas<EntityBase>(areas, [this](EntityBase& ent) {
+        if (ent.Is<Peep>() || ent.Is<Vehicle>())
+        {
+            Entities.push_back(&ent);
+            PrePos.emplace_back(ent.GetLocation());
+        }
+    });
 }
 
 void EntityTweener::PreTick()
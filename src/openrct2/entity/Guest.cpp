@@ -19,6 +19,7 @@
 #include "../core/Numerics.hpp"
 #include "../entity/Balloon.h"
 #include "../entity/EntityRegistry.h"
+#include "../entity/EntitySpatialQuery.h"
 #include "../entity/MoneyEffect.h"
 #include "../entity/Particle.h"
 #include "../interface/Window_internal.h"
@@ -28,6 +29,8 @@
 #include "../management/NewsItem.h"
 #include "../network/network.h"
 #include "../peep/GuestPathfinding.h"
+#include "../peep/GuestRideIndex.h"
+#include "../peep/PeepStats.h"
 #include "../peep/RideUseSystem.h"
 #include "../rct2/RCT2.h"
 #include "../ride/Ride.h"
@@ -2968,15 +2971,7 @@ static PeepThoughtType peep_assess_surroundings(int16_t centre_x, int16_t centre
         }
     }
 
-    for (auto litter : EntityList<Litter>())
-    {
-        int16_t dist_x = abs(litter->x - centre_x);
-        int16_t dist_y = abs(litter->y - centre_y);
-        if (std::max(dist_x, dist_y) <= 160)
-        {
-            num_rubbish++;
-        }
-    }
+    num_rubbish += static_cast<uint16_t>(CountEntitiesInRadius<Litter>({ centre_x, centre_y }, 160));
 
     if (num_fountains >= 5 && num_rubbish < 20)
         return PeepThoughtType::Fountains;
@@ -6872,6 +6867,8 @@ void Guest::InsertNewThought(PeepThoughtType thoughtType, uint16_t thoughtArgume
     thought.fresh_timeout = 0;
 
     WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_THOUGHTS;
+    OpenRCT2::PeepStats::Update(*this);
+    OpenRCT2::GuestRideIndex::Update(*this);
 }
 
 // clang-format off
@@ -7486,6 +7483,9 @@ void Guest::RemoveRideFromMemory(ride_id_t rideId)
         lastEntry.type = PeepThoughtType::None;
         lastEntry.item = PeepThoughtItemNone;
     }
+
+    OpenRCT2::PeepStats::Update(*this);
+    OpenRCT2::GuestRideIndex::Update(*this);
 }
 
 void Guest::Serialise(DataSerialiser& stream)
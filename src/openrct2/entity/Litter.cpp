@@ -10,6 +10,10 @@
 #include "EntityList.h"
 #include "EntityRegistry.h"
 
+#include <algorithm>
+#include <array>
+#include <vector>
+
 template<> bool EntityBase::Is<Litter>() const
 {
     return Type == EntityType::Litter;
@@ -57,17 +61,7 @@ void Litter::Create(const CoordsXYZD& litterPos, Type type)
 
     if (GetEntityListCount(EntityType::Litter) >= 500)
     {
-        Litter* newestLitter = nullptr;
-        uint32_t newestLitterCreationTick = 0;
-        for (auto litter : EntityList<Litter>())
-        {
-            if (newestLitterCreationTick <= litter->creationTick)
-            {
-                newestLitterCreationTick = litter->creationTick;
-                newestLitter = litter;
-            }
-        }
-
+        Litter* newestLitter = GetNewest();
         if (newestLitter != nullptr)
         {
             newestLitter->Invalidate();
@@ -85,7 +79,6 @@ void Litter::Create(const CoordsXYZD& litterPos, Type type)
     litter->sprite_height_positive = 3;
     litter->SubType = type;
     litter->MoveTo(offsetLitterPos);
-    litter->creationTick = gCurrentTicks;
 }
 
 /**
@@ -139,6 +132,134 @@ uint32_t Litter::GetAge() const
     return gCurrentTicks - creationTick;
 }
 
+/**
+ * All litter ordered by creation tick and then sprite index, linked through arrays indexed by sprite index. New litter
+ * is nearly always the newest, so adding, removing and finding the newest litter take constant time.
+ */
+static std::array<uint16_t, MAX_ENTITIES> _litterCreatedBefore;
+static std::array<uint16_t, MAX_ENTITIES> _litterCreatedAfter;
+static std::array<bool, MAX_ENTITIES> _litterInCreationOrder;
+static uint16_t _oldestLitter = SPRITE_INDEX_NULL;
+static uint16_t _newestLitter = SPRITE_INDEX_NULL;
+static uint32_t _litterCreationOrderCount = 0;
+
+static bool IsCreatedAfter(const Litter& a, const Litter& b)
+{
+    if (a.creationTick != b.creationTick)
+        return a.creationTick > b.creationTick;
+    return a.sprite_index > b.sprite_index;
+}
+
+static void LinkLitterAfter(uint16_t index, uint16_t previous)
+{
+    auto next = previous == SPRITE_INDEX_NULL ? _oldestLitter : _litterCreatedAfter[previous];
+    _litterCreatedBefore[index] = previous;
+    _litterCreatedAfter[index] = next;
+    if (previous == SPRITE_INDEX_NULL)
+        _oldestLitter = index;
+    else
+        _litterCreatedAfter[previous] = index;
+    if (next == SPRITE_INDEX_NULL)
+        _newestLitter = index;
+    else
+        _litterCreatedBefore[next] = index;
+
+    _litterInCreationOrder[index] = true;
+    _litterCreationOrderCount++;
+}
+
+Litter* Litter::GetNewest()
+{
+    return GetEntity<Litter>(_newestLitter);
+}
+
+/**
+ * Returns the amount of litter at least the given number of ticks old. Only litter younger than that is visited.
+ */
+uint32_t Litter::CountOfMinimumAge(uint32_t age)
+{
+    uint32_t numYounger = 0;
+    for (auto index = _newestLitter; index != SPRITE_INDEX_NULL; index = _litterCreatedBefore[index])
+    {
+        const auto* litter = GetEntity<Litter>(index);
+        if (litter == nullptr)
+            continue;
+
+        if (litter->GetAge() < age)
+        {
+            numYounger++;
+        }
+        else if (litter->creationTick <= gCurrentTicks)
+        {
+            // Everything created before this is older still. Litter from a later tick than the current one can only
+            // come from a save and has a wrapped around age, so it does not stop the search.
+            break;
+        }
+    }
+    return _litterCreationOrderCount - numYounger;
+}
+
+void Litter::ClearCreationOrder()
+{
+    _litterInCreationOrder.fill(false);
+    _oldestLitter = SPRITE_INDEX_NULL;
+    _newestLitter = SPRITE_INDEX_NULL;
+    _litterCreationOrderCount = 0;
+}
+
+void Litter::RebuildCreationOrder()
+{
+    ClearCreationOrder();
+
+    std::vector<Litter*> litters;
+    for (auto* litter : EntityList<Litter>())
+    {
+        litters.push_back(litter);
+    }
+    std::sort(litters.begin(), litters.end(), [](const Litter* a, const Litter* b) { return IsCreatedAfter(*b, *a); });
+
+    for (auto* litter : litters)
+    {
+        LinkLitterAfter(litter->sprite_index, _newestLitter);
+    }
+}
+
+void Litter::AddToCreationOrder()
+{
+    if (_litterInCreationOrder[sprite_index])
+        return;
+
+    auto previous = _newestLitter;
+    while (previous != SPRITE_INDEX_NULL)
+    {
+        const auto* previousLitter = GetEntity<Litter>(previous);
+        if (previousLitter == nullptr || !IsCreatedAfter(*previousLitter, *this))
+            break;
+        previous = _litterCreatedBefore[previous];
+    }
+    LinkLitterAfter(sprite_index, previous);
+}
+
+void Litter::RemoveFromCreationOrder()
+{
+    if (!_litterInCreationOrder[sprite_index])
+        return;
+
+    auto previous = _litterCreatedBefore[sprite_index];
+    auto next = _litterCreatedAfter[sprite_index];
+    if (previous == SPRITE_INDEX_NULL)
+        _oldestLitter = next;
+    else
+        _litterCreatedAfter[previous] = next;
+    if (next == SPRITE_INDEX_NULL)
+        _newestLitter = previous;
+    else
+        _litterCreatedBefore[next] = previous;
+
+    _litterInCreationOrder[sprite_index] = false;
+    _litterCreationOrderCount--;
+}
+
 void Litter::Serialise(DataSerialiser& stream)
 {
     EntityBase::Serialise(stream);
@@ -39,6 +39,16 @@ struct Litter : EntityBase
     uint32_t creationTick;
     static void Create(const CoordsXYZD& litterPos, Type type);
     static void RemoveAt(const CoordsXYZ& litterPos);
+
+    // Litter is also kept in creation order, so the newest litter and the amount of old litter can be found without
+    // scanning all litter.
+    static Litter* GetNewest();
+    static uint32_t CountOfMinimumAge(uint32_t age);
+    static void ClearCreationOrder();
+    static void RebuildCreationOrder();
+    void AddToCreationOrder();
+    void RemoveFromCreationOrder();
+
     void Serialise(DataSerialiser& stream);
     rct_string_id GetName() const;
     uint32_t GetAge() const;
@@ -22,6 +22,7 @@
 #include "../drawing/LightFX.h"
 #include "../entity/Balloon.h"
 #include "../entity/EntityRegistry.h"
+#include "../entity/EntityScreenIndex.h"
 #include "../entity/EntityTweener.h"
 #include "../interface/Window.h"
 #include "../localisation/Localisation.h"
@@ -31,6 +32,8 @@
 #include "../network/network.h"
 #include "../paint/Paint.h"
 #include "../peep/GuestPathfinding.h"
+#include "../peep/GuestRideIndex.h"
+#include "../peep/PeepStats.h"
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
 #include "../ride/ShopItem.h"
@@ -217,6 +220,12 @@ void peep_update_all()
             }
         }
 
+        if (peep->Type == EntityType::Guest)
+        {
+            OpenRCT2::PeepStats::Update(*peep);
+            OpenRCT2::GuestRideIndex::Update(*peep);
+        }
+
         i++;
     }
 
@@ -236,6 +245,11 @@ void peep_update_all()
             }
         }
 
+        if (staff->Type == EntityType::Staff)
+        {
+            OpenRCT2::PeepStats::Update(*staff);
+        }
+
         i++;
     }
 }
@@ -656,7 +670,6 @@ void peep_sprite_remove(Peep* peep)
     else
     {
         staff->ClearPatrolArea();
-        staff_update_greyed_patrol_areas();
 
         News::DisableNewsItems(News::ItemType::Peep, staff->sprite_index);
     }
@@ -990,76 +1003,43 @@ void Peep::Update()
 }
 
 /**
- *
- *  rct2: 0x0069BF41
+ * Counts guests with a fresh thought of the given type, leaving out guests heading to a ride that would fix it.
  */
-void peep_problem_warnings_update()
+static uint32_t peep_count_unresolved_thoughts(PeepThoughtType thoughtType, uint64_t resolvingRideTypeFlag)
 {
-    Ride* ride;
-    uint32_t hunger_counter = 0, lost_counter = 0, noexit_counter = 0, thirst_counter = 0, litter_counter = 0,
-             disgust_counter = 0, toilet_counter = 0, vandalism_counter = 0;
-    uint8_t* warning_throttle = gPeepWarningThrottle;
-
-    for (auto peep : EntityList<Guest>())
+    uint32_t count = 0;
+    for (const auto& [rideId, numGuests] : OpenRCT2::PeepStats::GetFreshThoughtCountByHeadingRide(thoughtType))
     {
-        if (peep->OutsideOfPark || peep->Thoughts[0].freshness > 5)
-            continue;
-
-        switch (peep->Thoughts[0].type)
+        if (rideId == RIDE_ID_NULL)
         {
-            case PeepThoughtType::Lost: // 0x10
-                lost_counter++;
-                break;
-
-            case PeepThoughtType::Hungry: // 0x14
-                if (peep->GuestHeadingToRideId == RIDE_ID_NULL)
-                {
-                    hunger_counter++;
-                    break;
-                }
-                ride = get_ride(peep->GuestHeadingToRideId);
-                if (ride != nullptr && !ride->GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_FLAT_RIDE))
-                    hunger_counter++;
-                break;
+            count += numGuests;
+            continue;
+        }
+        auto* ride = get_ride(rideId);
+        if (ride != nullptr && !ride->GetRideTypeDescriptor().HasFlag(resolvingRideTypeFlag))
+            count += numGuests;
+    }
+    return count;
+}
 
-            case PeepThoughtType::Thirsty:
-                if (peep->GuestHeadingToRideId == RIDE_ID_NULL)
-                {
-                    thirst_counter++;
-                    break;
-                }
-                ride = get_ride(peep->GuestHeadingToRideId);
-                if (ride != nullptr && !ride->GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_SELLS_DRINKS))
-                    thirst_counter++;
-                break;
+/**
+ *
+ *  rct2: 0x0069BF41
+ */
+void peep_problem_warnings_update()
+{
+    OpenRCT2::PeepStats::Verify();
 
-            case PeepThoughtType::Toilet:
-                if (peep->GuestHeadingToRideId == RIDE_ID_NULL)
-                {
-                    toilet_counter++;
-                    break;
-                }
-                ride = get_ride(peep->GuestHeadingToRideId);
-                if (ride != nullptr && !ride->GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_IS_TOILET))
-                    toilet_counter++;
-                break;
+    uint32_t hunger_counter = peep_count_unresolved_thoughts(PeepThoughtType::Hungry, RIDE_TYPE_FLAG_FLAT_RIDE);
+    uint32_t lost_counter = OpenRCT2::PeepStats::GetFreshThoughtCount(PeepThoughtType::Lost);
+    uint32_t noexit_counter = OpenRCT2::PeepStats::GetFreshThoughtCount(PeepThoughtType::CantFindExit);
+    uint32_t thirst_counter = peep_count_unresolved_thoughts(PeepThoughtType::Thirsty, RIDE_TYPE_FLAG_SELLS_DRINKS);
+    uint32_t litter_counter = OpenRCT2::PeepStats::GetFreshThoughtCount(PeepThoughtType::BadLitter);
+    uint32_t disgust_counter = OpenRCT2::PeepStats::GetFreshThoughtCount(PeepThoughtType::PathDisgusting);
+    uint32_t toilet_counter = peep_count_unresolved_thoughts(PeepThoughtType::Toilet, RIDE_TYPE_FLAG_IS_TOILET);
+    uint32_t vandalism_counter = OpenRCT2::PeepStats::GetFreshThoughtCount(PeepThoughtType::Vandalism);
+    uint8_t* warning_throttle = gPeepWarningThrottle;
 
-            case PeepThoughtType::BadLitter: // 0x1a
-                litter_counter++;
-                break;
-            case PeepThoughtType::CantFindExit: // 0x1b
-                noexit_counter++;
-                break;
-            case PeepThoughtType::PathDisgusting: // 0x1f
-                disgust_counter++;
-                break;
-            case PeepThoughtType::Vandalism: // 0x21
-                vandalism_counter++;
-                break;
-            default:
-                break;
-        }
-    }
     // could maybe be packed into a loop, would lose a lot of clarity though
     if (warning_throttle[0])
         --warning_throttle[0];
@@ -1178,21 +1158,10 @@ void peep_update_crowd_noise()
     // Count the number of peeps visible
     auto visiblePeeps = 0;
 
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->x == LOCATION_NULL)
-            continue;
-        if (viewport->viewPos.x > peep->SpriteRect.GetRight())
-            continue;
-        if (viewport->viewPos.x + viewport->view_width < peep->SpriteRect.GetLeft())
-            continue;
-        if (viewport->viewPos.y > peep->SpriteRect.GetBottom())
-            continue;
-        if (viewport->viewPos.y + viewport->view_height < peep->SpriteRect.GetTop())
-            continue;
-
-        visiblePeeps += peep->State == PeepState::Queuing ? 1 : 2;
-    }
+    const auto viewSize = ScreenCoordsXY{ viewport->view_width, viewport->view_height };
+    const ScreenRect viewArea(viewport->viewPos, viewport->viewPos + viewSize);
+    ForEachEntityInScreenRect<Guest>(
+        viewArea, [&visiblePeeps](const Guest& peep) { visiblePeeps += peep.State == PeepState::Queuing ? 1 : 2; });
 
     // This function doesn't account for the fact that the screen might be so big that 100 peeps could potentially be very
     // spread out and therefore not produce any crowd noise. Perhaps a more sophisticated solution would check how many peeps
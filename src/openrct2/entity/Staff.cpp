@@ -17,6 +17,7 @@
 #include "../config/Config.h"
 #include "../core/DataSerialiser.h"
 #include "../entity/EntityRegistry.h"
+#include "../entity/EntitySpatialQuery.h"
 #include "../interface/Viewport.h"
 #include "../localisation/Date.h"
 #include "../localisation/Localisation.h"
@@ -43,7 +44,9 @@
 #include "Peep.h"
 
 #include <algorithm>
+#include <array>
 #include <iterator>
+#include <optional>
 
 // clang-format off
 const rct_string_id StaffCostumeNames[] = {
@@ -68,6 +71,9 @@ colour_t gStaffSecurityColour;
 
 static PatrolArea _mergedPatrolAreas[EnumValue(StaffType::Count)];
 
+// Number of staff members of each type patrolling each block, a block is part of the merged area while this is not zero.
+static std::array<std::array<uint16_t, STAFF_PATROL_AREA_SIZE * 32>, EnumValue(StaffType::Count)> _mergedPatrolAreaCounts;
+
 const PatrolArea& GetMergedPatrolArea(const StaffType type)
 {
     return _mergedPatrolAreas[EnumValue(type)];
@@ -90,35 +96,58 @@ void staff_reset_modes()
     staff_update_greyed_patrol_areas();
 }
 
+/**
+ * Adds or removes the given blocks of one element of a staff member's patrol area to the merged area of its type.
+ */
+static void staff_update_greyed_patrol_area_data(StaffType type, size_t index, uint32_t blocks, int32_t delta)
+{
+    if (type >= StaffType::Count || blocks == 0)
+        return;
+
+    auto& counts = _mergedPatrolAreaCounts[EnumValue(type)];
+    auto& mergedArea = _mergedPatrolAreas[EnumValue(type)];
+    auto value = mergedArea.Data[index];
+    for (size_t bitIndex = 0; bitIndex < 32; bitIndex++)
+    {
+        const auto bit = 1u << bitIndex;
+        if (!(blocks & bit))
+            continue;
+
+        auto& count = counts[(index * 32) + bitIndex];
+        if (delta < 0 && count == 0)
+            continue;
+
+        count += delta;
+        value = count != 0 ? (value | bit) : (value & ~bit);
+    }
+    mergedArea.SetData(index, value);
+}
+
 /**
  *
  *  rct2: 0x006C0C3F
  */
 void staff_update_greyed_patrol_areas()
 {
-    for (int32_t staffType = 0; staffType < EnumValue(StaffType::Count); ++staffType)
+    for (auto& mergedArea : _mergedPatrolAreas)
     {
-        // Reset all of the merged data for the type.
-        auto& mergedData = _mergedPatrolAreas[staffType].Data;
-        std::fill(std::begin(mergedData), std::end(mergedData), 0);
+        mergedArea = {};
+    }
+    for (auto& counts : _mergedPatrolAreaCounts)
+    {
+        counts.fill(0);
+    }
 
-        for (auto staff : EntityList<Staff>())
+    for (auto staff : EntityList<Staff>())
+    {
+        if (!staff->HasPatrolArea())
         {
-            if (EnumValue(staff->AssignedStaffType) != staffType)
-            {
-                continue;
-            }
-            if (!staff->HasPatrolArea())
-            {
-                continue;
-            }
-
-            auto staffData = staff->PatrolInfo->Data;
-            for (size_t i = 0; i < STAFF_PATROL_AREA_SIZE; i++)
-            {
-                mergedData[i] |= staffData[i];
-            }
+            continue;
         }
+
+        staff->PatrolInfo->ForEachSetData([staff](size_t index, uint32_t value) {
+            staff_update_greyed_patrol_area_data(staff->AssignedStaffType, index, value, 1);
+        });
     }
 }
 
@@ -332,20 +361,58 @@ static std::pair<int32_t, int32_t> getPatrolAreaOffsetIndex(const CoordsXY& coor
     return { byteIndex, byteBitIndex };
 }
 
+bool PatrolArea::Get(const CoordsXY& coords) const
+{
+    auto [offset, bitIndex] = getPatrolAreaOffsetIndex(coords);
+    return Data[offset] & (1u << bitIndex);
+}
+
+void PatrolArea::Set(const CoordsXY& coords, bool value)
+{
+    auto [offset, bitIndex] = getPatrolAreaOffsetIndex(coords);
+    if (value)
+    {
+        SetData(offset, Data[offset] | (1u << bitIndex));
+    }
+    else
+    {
+        SetData(offset, Data[offset] & ~(1u << bitIndex));
+    }
+}
+
+bool PatrolArea::IsEmpty() const
+{
+    constexpr auto hasData = [](const auto& datapoint) { return datapoint != 0; };
+    return std::none_of(std::begin(Summary), std::end(Summary), hasData);
+}
+
+void PatrolArea::SetData(size_t index, uint32_t value)
+{
+    Data[index] = value;
+
+    const auto summaryBit = 1u << (index % 32);
+    if (value != 0)
+    {
+        Summary[index / 32] |= summaryBit;
+    }
+    else
+    {
+        Summary[index / 32] &= ~summaryBit;
+    }
+}
+
 bool Staff::IsPatrolAreaSet(const CoordsXY& coords) const
 {
     if (PatrolInfo != nullptr)
     {
-        auto [offset, bitIndex] = getPatrolAreaOffsetIndex(coords);
-        return PatrolInfo->Data[offset] & (1UL << bitIndex);
+        return PatrolInfo->Get(coords);
     }
     return false;
 }
 
 bool staff_is_patrol_area_set_for_type(StaffType type, const CoordsXY& coords)
 {
-    auto [offset, bitIndex] = getPatrolAreaOffsetIndex(coords);
-    return _mergedPatrolAreas[EnumValue(type)].Data[offset] & (1UL << bitIndex);
+    return _mergedPatrolAreas[EnumValue(type)].Get(coords);
 }
 
 void Staff::SetPatrolArea(const CoordsXY& coords, bool value)
@@ -362,30 +429,30 @@ void Staff::SetPatrolArea(const CoordsXY& coords, bool value)
         }
     }
     auto [offset, bitIndex] = getPatrolAreaOffsetIndex(coords);
-    auto* addr = &PatrolInfo->Data[offset];
-    if (value)
-    {
-        *addr |= (1 << bitIndex);
-    }
-    else
-    {
-        *addr &= ~(1 << bitIndex);
-    }
+    const auto oldData = PatrolInfo->Data[offset];
+    PatrolInfo->Set(coords, value);
+    const auto newData = PatrolInfo->Data[offset];
+
+    // Keep the merged area of the staff type up to date.
+    staff_update_greyed_patrol_area_data(AssignedStaffType, offset, newData & ~oldData, 1);
+    staff_update_greyed_patrol_area_data(AssignedStaffType, offset, oldData & ~newData, -1);
 }
 
 void Staff::ClearPatrolArea()
 {
+    if (PatrolInfo == nullptr)
+        return;
+
+    PatrolInfo->ForEachSetData([this](size_t index, uint32_t value) {
+        staff_update_greyed_patrol_area_data(AssignedStaffType, index, value, -1);
+    });
     delete PatrolInfo;
     PatrolInfo = nullptr;
 }
 
 bool Staff::HasPatrolArea() const
 {
-    if (PatrolInfo == nullptr)
-        return false;
-
-    constexpr auto hasData = [](const auto& datapoint) { return datapoint != 0; };
-    return std::any_of(std::begin(PatrolInfo->Data), std::end(PatrolInfo->Data), hasData);
+    return PatrolInfo != nullptr && !PatrolInfo->IsEmpty();
 }
 
 /**
@@ -396,20 +463,15 @@ bool Staff::HasPatrolArea() const
  */
 Direction Staff::HandymanDirectionToNearestLitter() const
 {
-    uint16_t nearestLitterDist = 0xFFFF;
-    Litter* nearestLitter = nullptr;
-    for (auto litter : EntityList<Litter>())
-    {
-        uint16_t distance = abs(litter->x - x) + abs(litter->y - y) + abs(litter->z - z) * 4;
-
-        if (distance < nearestLitterDist)
-        {
-            nearestLitterDist = distance;
-            nearestLitter = litter;
-        }
-    }
+    auto* nearestLitter = FindNearestEntity<Litter>(
+        { x, y }, MAX_LITTER_DISTANCE, [this](const Litter& litter) -> std::optional<uint32_t> {
+            uint32_t distance = abs(litter.x - x) + abs(litter.y - y) + abs(litter.z - z) * 4;
+            if (distance > MAX_LITTER_DISTANCE)
+                return std::nullopt;
+            return distance;
+        });
 
-    if (nearestLitterDist > MAX_LITTER_DISTANCE)
+    if (nearestLitter == nullptr)
     {
         return INVALID_DIRECTION;
     }
@@ -20,9 +20,39 @@ class DataSerialiser;
 constexpr size_t STAFF_PATROL_AREA_BLOCKS_PER_LINE = MAXIMUM_MAP_SIZE_TECHNICAL / 4;
 constexpr size_t STAFF_PATROL_AREA_SIZE = (STAFF_PATROL_AREA_BLOCKS_PER_LINE * STAFF_PATROL_AREA_BLOCKS_PER_LINE) / 32;
 
+// One bit per element of PatrolArea::Data, set when any block of that element is set.
+constexpr size_t STAFF_PATROL_AREA_SUMMARY_SIZE = (STAFF_PATROL_AREA_SIZE + 31) / 32;
+
 struct PatrolArea
 {
     uint32_t Data[STAFF_PATROL_AREA_SIZE];
+    uint32_t Summary[STAFF_PATROL_AREA_SUMMARY_SIZE];
+
+    bool Get(const CoordsXY& coords) const;
+    void Set(const CoordsXY& coords, bool value);
+    void SetData(size_t index, uint32_t value);
+    bool IsEmpty() const;
+
+    /**
+     * Calls func with the index and value of every non zero element of Data, skipping empty parts using the summary.
+     */
+    template<typename TFunc> void ForEachSetData(TFunc&& func) const
+    {
+        for (size_t i = 0; i < STAFF_PATROL_AREA_SUMMARY_SIZE; i++)
+        {
+            if (Summary[i] == 0)
+                continue;
+
+            for (size_t j = 0; j < 32; j++)
+            {
+                if (Summary[i] & (1u << j))
+                {
+                    auto index = (i * 32) + j;
+                    func(index, Data[index]);
+                }
+            }
+        }
+    }
 };
 
 struct Staff : Peep
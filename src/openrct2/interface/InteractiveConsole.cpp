@@ -69,6 +69,13 @@
 #    include "../drawing/TTF.h"
 #endif
 
+#ifdef ENABLE_SCRIPTING
+#    include "../scripting/HookEngine.h"
+#    include "../scripting/ScriptEngine.h"
+
+#    include <chrono>
+#endif
+
 using arguments_t = std::vector<std::string>;
 
 static constexpr const char* ClimateNames[] = {
@@ -1267,6 +1274,52 @@ static int32_t cc_remove_park_fences(InteractiveConsole& console, [[maybe_unused
     return 0;
 }
 
+#ifdef ENABLE_SCRIPTING
+static int32_t cc_hooks(InteractiveConsole& console, const arguments_t& argv)
+{
+    using namespace OpenRCT2::Scripting;
+    using TimeMs = std::chrono::duration<double, std::milli>;
+
+    auto& hookEngine = OpenRCT2::GetContext()->GetScriptEngine().GetHookEngine();
+    if (!argv.empty() && argv[0] == "reset")
+    {
+        hookEngine.ResetStatistics();
+        console.WriteLine("Hook statistics have been reset.");
+        return 0;
+    }
+
+    auto statistics = hookEngine.GetStatistics();
+    if (statistics.empty())
+    {
+        console.WriteLine("No hooks are subscribed.");
+    }
+    for (const auto& entry : statistics)
+    {
+        auto hookName = std::string(GetHookName(entry.Type));
+        auto pluginName = entry.Owner != nullptr ? entry.Owner->GetMetadata().Name : std::string();
+        console.WriteFormatLine(
+            "%s [%s]: %u calls, %.3f ms total, %.3f ms max", hookName.c_str(), pluginName.c_str(), entry.Statistics.Calls,
+            TimeMs(entry.Statistics.TotalTime).count(), TimeMs(entry.Statistics.MaxTime).count());
+    }
+    return 0;
+}
+
+static int32_t cc_plugin_usage(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    using TimeMs = std::chrono::duration<double, std::milli>;
+
+    auto& scriptEngine = OpenRCT2::GetContext()->GetScriptEngine();
+    for (const auto& plugin : scriptEngine.GetPlugins())
+    {
+        const auto& statistics = plugin->GetExecutionStatistics();
+        console.WriteFormatLine(
+            "%s: %.3f ms total, %.3f ms longest update, %u updates over budget", plugin->GetMetadata().Name.c_str(),
+            TimeMs(statistics.TotalTime).count(), TimeMs(statistics.MaxUpdateTime).count(), statistics.UpdatesOverBudget);
+    }
+    return 0;
+}
+#endif
+
 static int32_t cc_show_limits(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
 {
     const auto& tileElements = GetTileElements();
@@ -1797,6 +1850,9 @@ static constexpr const console_command console_command_table[] = {
     { "get", cc_get, "Gets the value of the specified variable.", "get <variable>" },
     { "help", cc_help, "Lists commands or info about a command.", "help [command]" },
     { "hide", cc_hide, "Hides the console.", "hide" },
+#ifdef ENABLE_SCRIPTING
+    { "hooks", cc_hooks, "Shows how often and for how long plugin hooks have run.", "hooks [reset]" },
+#endif
     { "load_object", cc_load_object,
       "Loads the object file into the scenario.\n"
       "Loading a scenery group will not load its associated objects.\n"
@@ -1805,6 +1861,9 @@ static constexpr const console_command console_command_table[] = {
     { "load_park", cc_load_park, "Load park from save directory or by absolute path", "load_park <filename>" },
     { "object_count", cc_object_count, "Shows the number of objects of each type in the scenario.", "object_count" },
     { "open", cc_open, "Opens the window with the give name.", "open <window>." },
+#ifdef ENABLE_SCRIPTING
+    { "plugin_usage", cc_plugin_usage, "Shows how much time each plugin has taken.", "plugin_usage" },
+#endif
     { "quit", cc_close, "Closes the console.", "quit" },
     { "remove_park_fences", cc_remove_park_fences, "Removes all park fences from the surface", "remove_park_fences" },
     { "remove_unused_objects", cc_remove_unused_objects, "Removes all the unused objects from the object selection.",
@@ -229,6 +229,24 @@ void viewports_invalidate(const ScreenRect& screenRect, ZoomLevel maxZoom)
     }
 }
 
+std::vector<ScreenRect> viewports_get_visible_areas(ZoomLevel maxZoom)
+{
+    std::vector<ScreenRect> areas;
+    if (gOpenRCT2Headless)
+        return areas;
+
+    for (const auto& vp : _viewports)
+    {
+        if (vp.visibility == VisibilityCache::Covered)
+            continue;
+        if (maxZoom != ZoomLevel{ -1 } && vp.zoom > maxZoom)
+            continue;
+
+        areas.emplace_back(vp.viewPos, vp.viewPos + ScreenCoordsXY{ vp.view_width, vp.view_height });
+    }
+    return areas;
+}
+
 /**
  *
  *  rct2: 0x00689174
@@ -107,6 +107,12 @@ std::optional<ScreenCoordsXY> centre_2d_coordinates(const CoordsXYZ& loc, rct_vi
 void viewport_create(rct_window* w, const ScreenCoordsXY& screenCoords, int32_t width, int32_t height, const Focus& focus);
 void viewport_remove(rct_viewport* viewport);
 void viewports_invalidate(const ScreenRect& screenRect, ZoomLevel maxZoom = ZoomLevel{ -1 });
+
+/**
+ * Gets the area of the map view shown by each viewport that is not covered, ignoring viewports zoomed out further
+ * than maxZoom.
+ */
+std::vector<ScreenRect> viewports_get_visible_areas(ZoomLevel maxZoom = ZoomLevel{ -1 });
 void viewport_update_position(rct_window* window);
 void viewport_update_sprite_follow(rct_window* window);
 void viewport_update_smart_sprite_follow(rct_window* window);
@@ -14,8 +14,10 @@
 #include "Localisation.h"
 #include "StringIds.h"
 
+#include <atomic>
 #include <cmath>
 #include <cstdint>
+#include <memory>
 
 namespace OpenRCT2
 {
@@ -752,21 +754,103 @@ namespace OpenRCT2
         return value;
     }
 
-    static void BuildAnyArgListFromLegacyArgBuffer(const FmtString& fmt, std::vector<FormatArg_t>& anyArgs, const void*& args)
+    /**
+     * A language string tokenised once. Everything that is copied as it is, text and codes like colours alike, is merged
+     * into runs of text, only the codes that read from the arguments are kept apart.
+     */
+    struct FormatProgram
     {
-        for (const auto& t : fmt)
+        struct Instruction
         {
-            switch (t.kind)
+            FormatToken Kind;
+            // Length of the text for literal runs, which follow each other in Text.
+            uint32_t Length;
+        };
+
+        std::string Text;
+        std::vector<Instruction> Instructions;
+    };
+
+    // Bumped whenever strings change, each thread drops its programs when it next starts formatting.
+    static std::atomic<uint32_t> _formatProgramsGeneration;
+
+    static std::unique_ptr<FormatProgram> CompileFormatProgram(const FmtString& fmt)
+    {
+        auto program = std::make_unique<FormatProgram>();
+        for (const auto& token : fmt)
+        {
+            if (FormatTokenTakesArgument(token.kind) || token.kind == FormatToken::Push16 || token.kind == FormatToken::Pop16)
+            {
+                program->Instructions.push_back({ token.kind, 0 });
+            }
+            else if (!token.text.empty())
             {
+                if (program->Instructions.empty() || program->Instructions.back().Kind != FormatToken::Literal)
+                {
+                    program->Instructions.push_back({ FormatToken::Literal, 0 });
+                }
+                program->Text += token.text;
+                program->Instructions.back().Length += static_cast<uint32_t>(token.text.size());
+            }
+        }
+        return program;
+    }
+
+    static std::vector<std::unique_ptr<FormatProgram>>& GetThreadFormatPrograms()
+    {
+        thread_local std::vector<std::unique_ptr<FormatProgram>> programs;
+        return programs;
+    }
+
+    /**
+     * Only called before formatting starts, never while a program is running.
+     */
+    static void UpdateThreadFormatPrograms()
+    {
+        thread_local uint32_t generation;
+        const auto currentGeneration = _formatProgramsGeneration.load(std::memory_order_relaxed);
+        if (generation != currentGeneration)
+        {
+            GetThreadFormatPrograms().clear();
+            generation = currentGeneration;
+        }
+    }
+
+    static const FormatProgram& GetFormatProgram(rct_string_id id)
+    {
+        auto& programs = GetThreadFormatPrograms();
+        if (id >= programs.size())
+        {
+            programs.resize(id + 1);
+        }
+        auto& program = programs[id];
+        if (program == nullptr)
+        {
+            program = CompileFormatProgram(GetFmtStringById(id));
+        }
+        return *program;
+    }
+
+    static void FormatProgramLegacy(FormatBuffer& ss, const FormatProgram& program, const void*& args)
+    {
+        const char* text = program.Text.data();
+        for (const auto& instruction : program.Instructions)
+        {
+            switch (instruction.Kind)
+            {
+                case FormatToken::Literal:
+                    ss.append(text, instruction.Length);
+                    text += instruction.Length;
+                    break;
                 case FormatToken::Comma32:
                 case FormatToken::Int32:
                 case FormatToken::Comma2dp32:
                 case FormatToken::Sprite:
-                    anyArgs.push_back(ReadFromArgs<int32_t>(args));
+                    FormatArgument(ss, instruction.Kind, ReadFromArgs<int32_t>(args));
                     break;
                 case FormatToken::Currency2dp:
                 case FormatToken::Currency:
-                    anyArgs.push_back(ReadFromArgs<int64_t>(args));
+                    FormatArgument(ss, instruction.Kind, ReadFromArgs<int64_t>(args));
                     break;
                 case FormatToken::UInt16:
                 case FormatToken::MonthYear:
@@ -774,26 +858,30 @@ namespace OpenRCT2
                 case FormatToken::Velocity:
                 case FormatToken::DurationShort:
                 case FormatToken::DurationLong:
-                    anyArgs.push_back(ReadFromArgs<uint16_t>(args));
+                    FormatArgument(ss, instruction.Kind, ReadFromArgs<uint16_t>(args));
                     break;
                 case FormatToken::Comma16:
                 case FormatToken::Length:
                 case FormatToken::Comma1dp16:
-                    anyArgs.push_back(ReadFromArgs<int16_t>(args));
+                    FormatArgument(ss, instruction.Kind, static_cast<int32_t>(ReadFromArgs<int16_t>(args)));
                     break;
                 case FormatToken::StringId:
                 {
+                    // The arguments of the nested string follow its id.
                     auto stringId = ReadFromArgs<rct_string_id>(args);
-                    anyArgs.push_back(stringId);
-                    BuildAnyArgListFromLegacyArgBuffer(GetFmtStringById(stringId), anyArgs, args);
+                    if (IsRealNameStringId(stringId))
+                    {
+                        FormatRealName(ss, stringId);
+                    }
+                    else
+                    {
+                        FormatProgramLegacy(ss, GetFormatProgram(stringId), args);
+                    }
                     break;
                 }
                 case FormatToken::String:
-                {
-                    auto sz = ReadFromArgs<const char*>(args);
-                    anyArgs.push_back(sz);
+                    FormatArgument(ss, instruction.Kind, ReadFromArgs<const char*>(args));
                     break;
-                }
                 case FormatToken::Pop16:
                     args = reinterpret_cast<const char*>(reinterpret_cast<uintptr_t>(args) + 2);
                     break;
@@ -808,26 +896,24 @@ namespace OpenRCT2
 
     size_t FormatStringLegacy(char* buffer, size_t bufferLen, rct_string_id id, const void* args)
     {
-        thread_local std::vector<FormatArg_t> anyArgs;
-        anyArgs.clear();
-        auto fmt = GetFmtStringById(id);
-        BuildAnyArgListFromLegacyArgBuffer(fmt, anyArgs, args);
-        return FormatStringAny(buffer, bufferLen, fmt, anyArgs);
+        UpdateThreadFormatPrograms();
+        auto& ss = GetThreadFormatStream();
+        FormatProgramLegacy(ss, GetFormatProgram(id), args);
+        return CopyStringStreamToBuffer(buffer, bufferLen, ss);
     }
 
-    static void FormatMonthYear(FormatBuffer& ss, int32_t month, int32_t year)
+    void InvalidateFormatPrograms()
     {
-        thread_local std::vector<FormatArg_t> tempArgs;
-        tempArgs.clear();
+        _formatProgramsGeneration++;
+    }
 
-        auto fmt = GetFmtStringById(STR_DATE_FORMAT_MY);
+    static void FormatMonthYear(FormatBuffer& ss, int32_t month, int32_t year)
+    {
         Formatter ft;
         ft.Add<uint16_t>(month);
         ft.Add<uint16_t>(year);
         const void* legacyArgs = ft.Data();
-        BuildAnyArgListFromLegacyArgBuffer(fmt, tempArgs, legacyArgs);
-        size_t argIndex = 0;
-        FormatStringAny(ss, fmt, tempArgs, argIndex);
+        FormatProgramLegacy(ss, GetFormatProgram(STR_DATE_FORMAT_MY), legacyArgs);
     }
 
 } // namespace OpenRCT2
@@ -306,4 +306,9 @@ namespace OpenRCT2
     std::string FormatStringAny(const FmtString& fmt, const std::vector<FormatArg_t>& args);
     size_t FormatStringAny(char* buffer, size_t bufferLen, const FmtString& fmt, const std::vector<FormatArg_t>& args);
     size_t FormatStringLegacy(char* buffer, size_t bufferLen, rct_string_id id, const void* args);
+
+    /**
+     * FormatStringLegacy tokenises each string once and keeps the result, this has to be called whenever strings change.
+     */
+    void InvalidateFormatPrograms();
 } // namespace OpenRCT2
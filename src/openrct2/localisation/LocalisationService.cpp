@@ -14,6 +14,7 @@
 #include "../core/Path.hpp"
 #include "../interface/Fonts.h"
 #include "../object/ObjectManager.h"
+#include "Formatting.h"
 #include "Language.h"
 #include "LanguagePack.h"
 #include "StringIds.h"
@@ -101,6 +102,7 @@ void LocalisationService::OpenLanguage(int32_t id)
 
     filename = GetLanguagePath(id);
     _languageCurrent = LanguagePackFactory::FromFile(id, filename.c_str());
+    InvalidateFormatPrograms();
     if (_languageCurrent != nullptr)
     {
         _currentLanguage = id;
@@ -117,6 +119,7 @@ void LocalisationService::CloseLanguages()
     _languageFallback = nullptr;
     _languageCurrent = nullptr;
     _currentLanguage = LANGUAGE_UNDEFINED;
+    InvalidateFormatPrograms();
 }
 
 std::tuple<rct_string_id, rct_string_id, rct_string_id> LocalisationService::GetLocalisedScenarioStrings(
@@ -153,6 +156,7 @@ rct_string_id LocalisationService::AllocateObjectString(const std::string& targe
         _objectStrings.resize(index + 1);
     }
     _objectStrings[index] = target;
+    InvalidateFormatPrograms();
 
     return stringId;
 }
@@ -167,6 +171,7 @@ void LocalisationService::FreeObjectString(rct_string_id stringId)
             _objectStrings[index] = {};
         }
         _availableObjectStringIds.push(stringId);
+        InvalidateFormatPrograms();
     }
 }
 
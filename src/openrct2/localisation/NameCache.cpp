@@ -0,0 +1,171 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "NameCache.h"
+
+#include "../entity/Peep.h"
+#include "../ride/Ride.h"
+#include "Formatter.h"
+#include "Localisation.h"
+
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <unordered_map>
+
+namespace OpenRCT2::NameCache
+{
+    /**
+     * A formatted name and the arguments it was formatted from. The arguments of a custom name only hold a pointer to
+     * it, so custom names are compared by their text instead.
+     */
+    struct CachedName
+    {
+        uint32_t Generation{};
+        bool HasCustomName{};
+        std::string CustomName;
+        std::string Arguments;
+        std::string Name;
+    };
+
+    // Entries of an older generation are stale, 0 is never current so default constructed entries are stale as well.
+    static uint32_t _generation = 1;
+
+    static std::array<CachedName, MAX_RIDES> _rideNames;
+    // The name each ride is listed under in _ridesByName.
+    static std::array<std::optional<std::string>, MAX_RIDES> _rideIndexedNames;
+    static std::unordered_map<std::string, std::vector<ride_id_t>> _ridesByName;
+
+    static std::vector<CachedName> _peepNames;
+
+    /**
+     * Brings the entry up to date with the arguments in ft, returns true if the name had to be formatted again.
+     */
+    static bool Update(CachedName& entry, const char* customName, const Formatter& ft)
+    {
+        const auto hasCustomName = customName != nullptr;
+        const auto arguments = hasCustomName ? std::string_view()
+                                             : std::string_view(reinterpret_cast<const char*>(ft.Data()), ft.NumBytes());
+        if (entry.Generation == _generation && entry.HasCustomName == hasCustomName
+            && (hasCustomName ? entry.CustomName == customName : entry.Arguments == arguments))
+        {
+            return false;
+        }
+
+        char buffer[256]{};
+        format_string(buffer, sizeof(buffer), STR_STRINGID, ft.Data());
+
+        entry.Generation = _generation;
+        entry.HasCustomName = hasCustomName;
+        entry.CustomName = hasCustomName ? customName : "";
+        entry.Arguments = arguments;
+        entry.Name = buffer;
+        return true;
+    }
+
+    static void RemoveFromIndex(size_t rideIndex)
+    {
+        auto& indexedName = _rideIndexedNames[rideIndex];
+        if (!indexedName.has_value())
+            return;
+
+        auto it = _ridesByName.find(*indexedName);
+        if (it != _ridesByName.end())
+        {
+            auto& rides = it->second;
+            rides.erase(std::remove(rides.begin(), rides.end(), static_cast<ride_id_t>(rideIndex)), rides.end());
+            if (rides.empty())
+            {
+                _ridesByName.erase(it);
+            }
+        }
+        indexedName.reset();
+    }
+
+    static void AddToIndex(size_t rideIndex)
+    {
+        const auto& name = _rideNames[rideIndex].Name;
+        auto& rides = _ridesByName[name];
+        auto rideId = static_cast<ride_id_t>(rideIndex);
+        rides.insert(std::lower_bound(rides.begin(), rides.end(), rideId), rideId);
+        _rideIndexedNames[rideIndex] = name;
+    }
+
+    const std::string& GetRideName(const Ride& ride)
+    {
+        const auto rideIndex = EnumValue(ride.id);
+        auto& entry = _rideNames[rideIndex];
+
+        Formatter ft;
+        ride.FormatNameTo(ft);
+        const auto* customName = ride.custom_name.empty() ? nullptr : ride.custom_name.c_str();
+        if (Update(entry, customName, ft) || !_rideIndexedNames[rideIndex].has_value())
+        {
+            RemoveFromIndex(rideIndex);
+            AddToIndex(rideIndex);
+        }
+        return entry.Name;
+    }
+
+    const std::string& GetPeepName(const Peep& peep)
+    {
+        if (peep.sprite_index >= _peepNames.size())
+        {
+            _peepNames.resize(peep.sprite_index + 1);
+        }
+
+        Formatter ft;
+        peep.FormatNameTo(ft);
+        auto& entry = _peepNames[peep.sprite_index];
+        Update(entry, peep.Name, ft);
+        return entry.Name;
+    }
+
+    std::vector<ride_id_t> FindRidesNamed(std::string_view name)
+    {
+        // Bring every ride up to date first, names can change without going through a rename.
+        for (size_t i = 0; i < MAX_RIDES; i++)
+        {
+            const auto* ride = get_ride(static_cast<ride_id_t>(i));
+            if (ride != nullptr)
+            {
+                GetRideName(*ride);
+            }
+            else
+            {
+                RemoveFromIndex(i);
+            }
+        }
+
+        auto it = _ridesByName.find(std::string(name));
+        if (it == _ridesByName.end())
+            return {};
+
+        return it->second;
+    }
+
+    void Invalidate()
+    {
+        _generation++;
+        if (_generation == 0)
+        {
+            _generation = 1;
+            for (auto& entry : _rideNames)
+            {
+                entry.Generation = 0;
+            }
+            for (auto& entry : _peepNames)
+            {
+                entry.Generation = 0;
+            }
+        }
+        _ridesByName.clear();
+        _rideIndexedNames.fill(std::nullopt);
+    }
+} // namespace OpenRCT2::NameCache
@@ -0,0 +1,41 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "../ride/RideTypes.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct Peep;
+struct Ride;
+
+/**
+ * The formatted names of rides and peeps, so searching, sorting and checking names for uniqueness does not format every
+ * name each time. A name is only formatted again once the arguments it is formatted from change, or after Invalidate.
+ */
+namespace OpenRCT2::NameCache
+{
+    const std::string& GetRideName(const Ride& ride);
+    const std::string& GetPeepName(const Peep& peep);
+
+    /**
+     * Returns the rides with the given name in ride index order.
+     */
+    std::vector<ride_id_t> FindRidesNamed(std::string_view name);
+
+    /**
+     * Formats every name again on next use, for when the strings names are formatted with change, i.e. the language or
+     * the loaded objects.
+     */
+    void Invalidate();
+} // namespace OpenRCT2::NameCache
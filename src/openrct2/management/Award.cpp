@@ -14,6 +14,7 @@
 #include "../interface/Window.h"
 #include "../localisation/Localisation.h"
 #include "../localisation/StringIds.h"
+#include "../peep/PeepStats.h"
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
 #include "../scenario/Scenario.h"
@@ -22,6 +23,8 @@
 
 #include <algorithm>
 
+using namespace OpenRCT2;
+
 constexpr uint8_t NEGATIVE = 0;
 constexpr uint8_t POSITIVE = 1;
 
@@ -79,6 +82,14 @@ bool award_is_positive(ParkAward type)
 
 #pragma region Award checks
 
+/** Number of guests in the park thinking the paths are dirty or vandalised. */
+static uint32_t GetUntidyThoughtCount()
+{
+    return PeepStats::GetFreshThoughtCount(PeepThoughtType::BadLitter)
+        + PeepStats::GetFreshThoughtCount(PeepThoughtType::PathDisgusting)
+        + PeepStats::GetFreshThoughtCount(PeepThoughtType::Vandalism);
+}
+
 /** More than 1/16 of the total guests must be thinking untidy thoughts. */
 static bool award_is_deserved_most_untidy(int32_t activeAwardTypes)
 {
@@ -89,23 +100,7 @@ static bool award_is_deserved_most_untidy(int32_t activeAwardTypes)
     if (activeAwardTypes & EnumToFlag(ParkAward::MostTidy))
         return false;
 
-    uint32_t negativeCount = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness > 5)
-            continue;
-
-        if (thought.type == PeepThoughtType::BadLitter || thought.type == PeepThoughtType::PathDisgusting
-            || thought.type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
-
+    uint32_t negativeCount = GetUntidyThoughtCount();
     return (negativeCount > gNumGuestsInPark / 16);
 }
 
@@ -117,26 +112,8 @@ static bool award_is_deserved_most_tidy(int32_t activeAwardTypes)
     if (activeAwardTypes & EnumToFlag(ParkAward::MostDisappointing))
         return false;
 
-    uint32_t positiveCount = 0;
-    uint32_t negativeCount = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness > 5)
-            continue;
-
-        if (thought.type == PeepThoughtType::VeryClean)
-            positiveCount++;
-
-        if (thought.type == PeepThoughtType::BadLitter || thought.type == PeepThoughtType::PathDisgusting
-            || thought.type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
+    uint32_t positiveCount = PeepStats::GetFreshThoughtCount(PeepThoughtType::VeryClean);
+    uint32_t negativeCount = GetUntidyThoughtCount();
 
     return (negativeCount <= 5 && positiveCount > gNumGuestsInPark / 64);
 }
@@ -197,27 +174,8 @@ static bool award_is_deserved_most_beautiful(int32_t activeAwardTypes)
     if (activeAwardTypes & EnumToFlag(ParkAward::MostDisappointing))
         return false;
 
-    uint32_t positiveCount = 0;
-    uint32_t negativeCount = 0;
-    auto list = EntityList<Guest>();
-    for (auto peep : list)
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness > 5)
-            continue;
-
-        if (thought.type == PeepThoughtType::Scenery)
-            positiveCount++;
-
-        if (thought.type == PeepThoughtType::BadLitter || thought.type == PeepThoughtType::PathDisgusting
-            || thought.type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
+    uint32_t positiveCount = PeepStats::GetFreshThoughtCount(PeepThoughtType::Scenery);
+    uint32_t negativeCount = GetUntidyThoughtCount();
 
     return (negativeCount <= 15 && positiveCount > gNumGuestsInPark / 128);
 }
@@ -241,16 +199,7 @@ static bool award_is_deserved_worst_value(int32_t activeAwardTypes)
 /** No more than 2 people who think the vandalism is bad and no crashes. */
 static bool award_is_deserved_safest([[maybe_unused]] int32_t activeAwardTypes)
 {
-    auto peepsWhoDislikeVandalism = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Vandalism)
-            peepsWhoDislikeVandalism++;
-    }
+    auto peepsWhoDislikeVandalism = PeepStats::GetFreshThoughtCount(PeepThoughtType::Vandalism);
 
     if (peepsWhoDislikeVandalism > 2)
         return false;
@@ -311,16 +260,7 @@ static bool award_is_deserved_best_food(int32_t activeAwardTypes)
         return false;
 
     // Count hungry peeps
-    auto hungryPeeps = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Hungry)
-            hungryPeeps++;
-    }
+    auto hungryPeeps = PeepStats::GetFreshThoughtCount(PeepThoughtType::Hungry);
     return (hungryPeeps <= 12);
 }
 
@@ -356,16 +296,7 @@ static bool award_is_deserved_worst_food(int32_t activeAwardTypes)
         return false;
 
     // Count hungry peeps
-    auto hungryPeeps = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Hungry)
-            hungryPeeps++;
-    }
+    auto hungryPeeps = PeepStats::GetFreshThoughtCount(PeepThoughtType::Hungry);
     return (hungryPeeps > 15);
 }
 
@@ -387,16 +318,7 @@ static bool award_is_deserved_best_restrooms([[maybe_unused]] int32_t activeAwar
         return false;
 
     // Count number of guests who are thinking they need the restroom
-    auto guestsWhoNeedRestroom = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Toilet)
-            guestsWhoNeedRestroom++;
-    }
+    auto guestsWhoNeedRestroom = PeepStats::GetFreshThoughtCount(PeepThoughtType::Toilet);
     return (guestsWhoNeedRestroom <= 16);
 }
 
@@ -518,18 +440,9 @@ static bool award_is_deserved_most_dazzling_ride_colours(int32_t activeAwardType
 /** At least 10 peeps and more than 1/64 of total guests are lost or can't find something. */
 static bool award_is_deserved_most_confusing_layout([[maybe_unused]] int32_t activeAwardTypes)
 {
-    uint32_t peepsCounted = 0;
-    uint32_t peepsLost = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        peepsCounted++;
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && (thought.type == PeepThoughtType::Lost || thought.type == PeepThoughtType::CantFind))
-            peepsLost++;
-    }
+    uint32_t peepsCounted = PeepStats::GetGuestsInPark();
+    uint32_t peepsLost = PeepStats::GetFreshThoughtCount(PeepThoughtType::Lost)
+        + PeepStats::GetFreshThoughtCount(PeepThoughtType::CantFind);
 
     return (peepsLost >= 10 && peepsLost >= peepsCounted / 64);
 }
@@ -623,6 +536,7 @@ void award_update_all()
             } while (activeAwardTypes & (1 << EnumValue(awardType)));
 
             // Check if award is deserved
+            PeepStats::Verify();
             if (award_is_deserved(awardType, activeAwardTypes))
             {
                 // Add award
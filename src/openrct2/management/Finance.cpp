@@ -17,6 +17,7 @@
 #include "../interface/Window.h"
 #include "../localisation/Date.h"
 #include "../localisation/Localisation.h"
+#include "../peep/PeepStats.h"
 #include "../ride/Ride.h"
 #include "../scenario/Scenario.h"
 #include "../util/Util.h"
@@ -110,9 +111,15 @@ void finance_pay_wages()
         return;
     }
 
-    for (auto peep : EntityList<Staff>())
+    OpenRCT2::PeepStats::Verify();
+    for (int32_t i = 0; i < EnumValue(StaffType::Count); i++)
     {
-        finance_payment(GetStaffWage(peep->AssignedStaffType) / 4, ExpenditureType::Wages);
+        auto staffType = static_cast<StaffType>(i);
+        auto staffCount = static_cast<money32>(OpenRCT2::PeepStats::GetStaffCount(staffType));
+        if (staffCount > 0)
+        {
+            finance_payment((GetStaffWage(staffType) / 4) * staffCount, ExpenditureType::Wages);
+        }
     }
 }
 
@@ -241,9 +248,10 @@ void finance_update_daily_profit()
     if (!(gParkFlags & PARK_FLAGS_NO_MONEY))
     {
         // Staff costs
-        for (auto peep : EntityList<Staff>())
+        for (int32_t i = 0; i < EnumValue(StaffType::Count); i++)
         {
-            current_profit -= GetStaffWage(peep->AssignedStaffType);
+            auto staffType = static_cast<StaffType>(i);
+            current_profit -= GetStaffWage(staffType) * static_cast<money32>(OpenRCT2::PeepStats::GetStaffCount(staffType));
         }
 
         // Research costs
@@ -15,6 +15,8 @@
 #include "../entity/Guest.h"
 #include "../interface/Window.h"
 #include "../localisation/Localisation.h"
+#include "../peep/GuestRideIndex.h"
+#include "../peep/PeepStats.h"
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
 #include "../ride/ShopItem.h"
@@ -162,6 +164,8 @@ void marketing_set_guest_campaign(Guest* peep, int32_t campaignType)
             peep->GuestIsLostCountdown = 240;
             break;
     }
+    OpenRCT2::PeepStats::Update(*peep);
+    OpenRCT2::GuestRideIndex::Update(*peep);
 }
 
 bool marketing_is_campaign_type_applicable(int32_t campaignType)
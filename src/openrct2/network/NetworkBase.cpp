@@ -15,6 +15,7 @@
 #include "../OpenRCT2.h"
 #include "../ParkFile.h"
 #include "../PlatformEnvironment.h"
+#include "../actions/BatchAction.h"
 #include "../actions/LoadOrQuitAction.h"
 #include "../actions/NetworkModifyGroupAction.h"
 #include "../actions/PeepPickupAction.h"
@@ -40,7 +41,7 @@
 // This string specifies which version of network stream current build uses.
 // It is used for making sure only compatible builds get connected, even within
 // single OpenRCT2 version.
-#define NETWORK_STREAM_VERSION "7"
+#define NETWORK_STREAM_VERSION "11"
 #define NETWORK_STREAM_ID OPENRCT2_VERSION "-" NETWORK_STREAM_VERSION
 
 static Peep* _pickup_peep = nullptr;
@@ -91,6 +92,7 @@ static constexpr uint32_t MaxPacketsPerUpdate = 100;
 #    include <cmath>
 #    include <fstream>
 #    include <functional>
+#    include <limits>
 #    include <list>
 #    include <map>
 #    include <memory>
@@ -116,6 +118,7 @@ NetworkBase::NetworkBase(OpenRCT2::IContext& context)
     _actionId = 0;
 
     client_command_handlers[NetworkCommand::Auth] = &NetworkBase::Client_Handle_AUTH;
+    client_command_handlers[NetworkCommand::MapManifest] = &NetworkBase::Client_Handle_MAPMANIFEST;
     client_command_handlers[NetworkCommand::Map] = &NetworkBase::Client_Handle_MAP;
     client_command_handlers[NetworkCommand::Chat] = &NetworkBase::Client_Handle_CHAT;
     client_command_handlers[NetworkCommand::GameAction] = &NetworkBase::Client_Handle_GAME_ACTION;
@@ -141,6 +144,7 @@ NetworkBase::NetworkBase(OpenRCT2::IContext& context)
     server_command_handlers[NetworkCommand::GameInfo] = &NetworkBase::Server_Handle_GAMEINFO;
     server_command_handlers[NetworkCommand::Token] = &NetworkBase::Server_Handle_TOKEN;
     server_command_handlers[NetworkCommand::MapRequest] = &NetworkBase::Server_Handle_MAPREQUEST;
+    server_command_handlers[NetworkCommand::MapBlockRequest] = &NetworkBase::Server_Handle_MAPBLOCKREQUEST;
     server_command_handlers[NetworkCommand::RequestGameState] = &NetworkBase::Server_Handle_REQUEST_GAMESTATE;
     server_command_handlers[NetworkCommand::Heartbeat] = &NetworkBase::Server_Handle_HEARTBEAT;
 
@@ -230,6 +234,8 @@ void NetworkBase::CloseConnection()
     }
     else if (mode == NETWORK_MODE_SERVER)
     {
+        // Stopped first, it uses the listening socket and the client connections.
+        _ioThread.reset();
         _listenSocket.reset();
         _advertiser.reset();
     }
@@ -366,6 +372,15 @@ bool NetworkBase::BeginServer(uint16_t port, const std::string& address)
         return false;
     }
 
+    if (gConfigNetwork.use_io_thread)
+    {
+        _ioThread = NetworkIoThread::Create(*_listenSocket);
+        if (_ioThread == nullptr)
+        {
+            log_warning("Network I/O thread not supported on this platform, serving clients from the game thread.");
+        }
+    }
+
     ServerName = gConfigNetwork.server_name;
     ServerDescription = gConfigNetwork.server_description;
     ServerGreeting = gConfigNetwork.server_greeting;
@@ -490,6 +505,10 @@ void NetworkBase::Flush()
     {
         _serverConnection->SendQueuedPackets();
     }
+    else if (_ioThread != nullptr)
+    {
+        _ioThread->Flush();
+    }
     else
     {
         for (auto& it : client_connection_list)
@@ -529,10 +548,20 @@ void NetworkBase::UpdateServer()
         _advertiser->Update();
     }
 
-    std::unique_ptr<ITcpSocket> tcpSocket = _listenSocket->Accept();
-    if (tcpSocket != nullptr)
+    if (_ioThread != nullptr)
     {
-        AddClient(std::move(tcpSocket));
+        while (auto tcpSocket = _ioThread->Accept())
+        {
+            AddClient(std::move(tcpSocket));
+        }
+    }
+    else
+    {
+        std::unique_ptr<ITcpSocket> tcpSocket = _listenSocket->Accept();
+        if (tcpSocket != nullptr)
+        {
+            AddClient(std::move(tcpSocket));
+        }
     }
 }
 
@@ -714,6 +743,8 @@ const char* NetworkBase::FormatChat(NetworkPlayer* fromplayer, const char* text)
 
 void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, bool gameCmd)
 {
+    // Frame the packet once, every connection queues the same buffer.
+    auto framedPacket = packet.Frame();
     for (auto& client_connection : client_connection_list)
     {
         if (gameCmd)
@@ -727,8 +758,7 @@ void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, b
                 continue;
             }
         }
-        auto packetCopy = packet;
-        client_connection->QueuePacket(std::move(packetCopy), front);
+        client_connection->QueuePacket(framedPacket, front);
     }
 }
 
@@ -1216,6 +1246,7 @@ void NetworkBase::Client_Send_AUTH(
     assert(signature.size() <= static_cast<size_t>(UINT32_MAX));
     packet << static_cast<uint32_t>(signature.size());
     packet.Write(signature.data(), signature.size());
+    packet << static_cast<uint8_t>(gConfigNetwork.compress_packets);
     _serverConnection->AuthStatus = NetworkAuth::Requested;
     _serverConnection->QueuePacket(std::move(packet));
 }
@@ -1243,6 +1274,14 @@ void NetworkBase::Client_Send_MAPREQUEST(const std::vector<ObjectEntryDescriptor
     _serverConnection->QueuePacket(std::move(packet));
 }
 
+void NetworkBase::Client_Send_MAPBLOCKREQUEST()
+{
+    NetworkPacket packet(NetworkCommand::MapBlockRequest);
+    _mapDownload.WriteBlockRequest(packet);
+    log_verbose("client requests %u KiB of map blocks", _mapDownload.GetBytesRequested() / 1024);
+    _serverConnection->QueuePacket(std::move(packet));
+}
+
 void NetworkBase::Server_Send_TOKEN(NetworkConnection& connection)
 {
     NetworkPacket packet(NetworkCommand::Token);
@@ -1341,19 +1380,22 @@ NetworkStats_t NetworkBase::GetStats() const
     NetworkStats_t stats = {};
     if (mode == NETWORK_MODE_CLIENT)
     {
-        stats = _serverConnection->Stats;
+        stats = _serverConnection->GetStats();
     }
     else
     {
         for (auto& connection : client_connection_list)
         {
+            const auto connectionStats = connection->GetStats();
             for (size_t n = 0; n < EnumValue(NetworkStatisticsGroup::Max); n++)
             {
-                stats.bytesReceived[n] += connection->Stats.bytesReceived[n];
-                stats.bytesSent[n] += connection->Stats.bytesSent[n];
+                stats.bytesReceived[n] += connectionStats.bytesReceived[n];
+                stats.bytesSent[n] += connectionStats.bytesSent[n];
             }
         }
     }
+    stats.packetsFramed = NetworkPacket::FramedPacketCount;
+    stats.bytesFramed = NetworkPacket::FramedByteCount;
     return stats;
 }
 
@@ -1393,8 +1435,10 @@ void NetworkBase::Server_Send_MAP(NetworkConnection* connection)
         objects = objManager.GetPackableObjects();
     }
 
+    // Only the manifest is sent, each client then requests the blocks it does not have yet.
     auto header = save_for_network(objects);
-    if (header.empty())
+    auto snapshot = header.empty() ? nullptr : NetworkMapSnapshot::Create(header);
+    if (snapshot == nullptr)
     {
         if (connection != nullptr)
         {
@@ -1403,21 +1447,34 @@ void NetworkBase::Server_Send_MAP(NetworkConnection* connection)
         }
         return;
     }
-    size_t chunksize = CHUNK_SIZE;
-    for (size_t i = 0; i < header.size(); i += chunksize)
+
+    NetworkPacket packet(NetworkCommand::MapManifest);
+    snapshot->WriteManifest(packet);
+    if (connection != nullptr)
     {
-        size_t datasize = std::min(chunksize, header.size() - i);
-        NetworkPacket packet(NetworkCommand::Map);
-        packet << static_cast<uint32_t>(header.size()) << static_cast<uint32_t>(i);
-        packet.Write(&header[i], datasize);
-        if (connection != nullptr)
-        {
-            connection->QueuePacket(std::move(packet));
-        }
-        else
+        connection->MapSnapshot = snapshot;
+        connection->QueuePacket(std::move(packet));
+    }
+    else
+    {
+        for (auto& clientConnection : client_connection_list)
         {
-            SendPacketToClients(packet);
+            clientConnection->MapSnapshot = snapshot;
         }
+        SendPacketToClients(packet);
+    }
+}
+
+void NetworkBase::Server_Send_MAP_BLOCK(NetworkConnection& connection, uint32_t index)
+{
+    const auto& data = connection.MapSnapshot->GetCompressedBlock(index);
+    for (size_t i = 0; i < data.size(); i += CHUNK_SIZE)
+    {
+        size_t datasize = std::min<size_t>(CHUNK_SIZE, data.size() - i);
+        NetworkPacket packet(NetworkCommand::Map);
+        packet << index << static_cast<uint32_t>(i);
+        packet.Write(&data[i], datasize);
+        connection.QueuePacket(std::move(packet));
     }
 }
 
@@ -1456,12 +1513,13 @@ void NetworkBase::Server_Send_CHAT(const char* text, const std::vector<uint8_t>&
     }
     else
     {
+        auto framedPacket = packet.Frame();
         for (auto playerId : playerIds)
         {
             auto conn = GetPlayerConnection(playerId);
             if (conn != nullptr)
             {
-                conn->QueuePacket(packet);
+                conn->QueuePacket(framedPacket);
             }
         }
     }
@@ -1658,11 +1716,15 @@ bool NetworkBase::ProcessConnection(NetworkConnection& connection)
 {
     NetworkReadPacket packetStatus;
 
+    // Connections served by the I/O thread have their packets read already.
+    NetworkPacket receivedPacket;
+    auto& packet = connection.UsesIoThread() ? receivedPacket : connection.InboundPacket;
+
     uint32_t countProcessed = 0;
     do
     {
         countProcessed++;
-        packetStatus = connection.ReadPacket();
+        packetStatus = connection.UsesIoThread() ? connection.ReceivePacket(packet) : connection.ReadPacket();
         switch (packetStatus)
         {
             case NetworkReadPacket::Disconnected:
@@ -1674,7 +1736,7 @@ bool NetworkBase::ProcessConnection(NetworkConnection& connection)
                 return false;
             case NetworkReadPacket::Success:
                 // done reading in packet
-                ProcessPacket(connection, connection.InboundPacket);
+                ProcessPacket(connection, packet);
                 if (!connection.IsValid())
                 {
                     return false;
@@ -1934,6 +1996,11 @@ void NetworkBase::ProcessDisconnectedClients()
             continue;
         }
 
+        if (_ioThread != nullptr)
+        {
+            _ioThread->RemoveConnection(*connection);
+        }
+
         // Make sure to send all remaining packets out before disconnecting.
         connection->SendQueuedPackets();
         connection->Socket->Disconnect();
@@ -1955,6 +2022,10 @@ void NetworkBase::AddClient(std::unique_ptr<ITcpSocket>&& socket)
     // Store connection
     auto connection = std::make_unique<NetworkConnection>();
     connection->Socket = std::move(socket);
+    if (_ioThread != nullptr)
+    {
+        _ioThread->AddConnection(*connection);
+    }
 
     client_connection_list.push_back(std::move(connection));
 }
@@ -2540,6 +2611,35 @@ void NetworkBase::Server_Handle_MAPREQUEST(NetworkConnection& connection, Networ
     Server_Send_GROUPLIST(connection);
 }
 
+void NetworkBase::Server_Handle_MAPBLOCKREQUEST(NetworkConnection& connection, NetworkPacket& packet)
+{
+    std::vector<uint32_t> blocks;
+    auto request = connection.MapSnapshot == nullptr ? NetworkMapBlockRequest::Invalid
+                                                     : connection.MapSnapshot->ReadBlockRequest(packet, blocks);
+    if (request == NetworkMapBlockRequest::Outdated)
+    {
+        // The map was sent again since, the client also answers the newer manifest.
+        log_verbose("Client requested map blocks of an earlier map");
+        return;
+    }
+    if (request == NetworkMapBlockRequest::Invalid)
+    {
+        connection.SetLastDisconnectReason(STR_MULTIPLAYER_CLIENT_INVALID_REQUEST);
+        connection.Disconnect();
+        log_warning("Client requested map blocks without a map or non-existent map blocks");
+        return;
+    }
+
+    log_verbose("Client requested %u of %u map blocks", uint32_t(blocks.size()), connection.MapSnapshot->GetBlockCount());
+    for (auto index : blocks)
+    {
+        Server_Send_MAP_BLOCK(connection, index);
+    }
+
+    // The snapshot is only needed until the client has said which blocks of the latest manifest it needs.
+    connection.MapSnapshot.reset();
+}
+
 void NetworkBase::Server_Handle_AUTH(NetworkConnection& connection, NetworkPacket& packet)
 {
     if (connection.AuthStatus != NetworkAuth::Ok)
@@ -2551,6 +2651,7 @@ void NetworkBase::Server_Handle_AUTH(NetworkConnection& connection, NetworkPacke
         auto pubkey = packet.ReadString();
         uint32_t sigsize;
         packet >> sigsize;
+        uint8_t compressionRequested = 0;
         if (pubkey.empty())
         {
             connection.AuthStatus = NetworkAuth::VerificationFailure;
@@ -2569,6 +2670,7 @@ void NetworkBase::Server_Handle_AUTH(NetworkConnection& connection, NetworkPacke
                 }
 
                 std::memcpy(signature.data(), signatureData, sigsize);
+                packet >> compressionRequested;
 
                 auto ms = MemoryStream(pubkey.data(), pubkey.size());
                 if (!connection.Key.LoadPublic(&ms))
@@ -2655,36 +2757,76 @@ void NetworkBase::Server_Handle_AUTH(NetworkConnection& connection, NetworkPacke
         }
 
         Server_Send_AUTH(connection);
+
+        // Compress everything sent from here on when both ends want to.
+        if (connection.AuthStatus == NetworkAuth::Ok && compressionRequested != 0 && gConfigNetwork.compress_packets)
+        {
+            connection.BeginCompression();
+        }
     }
 }
 
-void NetworkBase::Client_Handle_MAP([[maybe_unused]] NetworkConnection& connection, NetworkPacket& packet)
+void NetworkBase::Client_Handle_MAPMANIFEST(NetworkConnection& connection, NetworkPacket& packet)
 {
-    uint32_t size, offset;
-    packet >> size >> offset;
-    int32_t chunksize = static_cast<int32_t>(packet.Header.Size - packet.BytesRead);
-    if (chunksize <= 0)
+    // Start of a new map load, clear the queue now as we have to buffer them
+    // until the map is fully loaded.
+    GameActions::ClearQueue();
+    GameActions::SuspendQueue();
+
+    _serverTickData.clear();
+    _clientMapLoaded = false;
+
+    if (!_mapDownload.Begin(packet))
     {
+        log_error("Received an invalid map manifest");
+        connection.SetLastDisconnectReason(STR_MULTIPLAYER_RECEIVED_INVALID_DATA);
+        connection.Disconnect();
         return;
     }
-    if (offset == 0)
+
+    // Blocks kept from an earlier download are not requested again, the request is still sent when none are missing to
+    // let the server know it is done.
+    Client_Send_MAPBLOCKREQUEST();
+    if (_mapDownload.HasReceivedAll())
     {
-        // Start of a new map load, clear the queue now as we have to buffer them
-        // until the map is fully loaded.
-        GameActions::ClearQueue();
-        GameActions::SuspendQueue();
+        LoadDownloadedMap();
+    }
+    else
+    {
+        ShowMapDownloadStatus();
+    }
+}
 
-        _serverTickData.clear();
-        _clientMapLoaded = false;
+void NetworkBase::Client_Handle_MAP(NetworkConnection& connection, NetworkPacket& packet)
+{
+    uint32_t index;
+    uint32_t offset;
+    packet >> index >> offset;
+    const size_t size = packet.Header.Size - packet.BytesRead;
+    if (!_mapDownload.ReceiveBlockData(index, offset, packet.Read(size), size))
+    {
+        log_error("Received unexpected map data for block %u", index);
+        connection.SetLastDisconnectReason(STR_MULTIPLAYER_RECEIVED_INVALID_DATA);
+        connection.Disconnect();
+        return;
+    }
+
+    if (_mapDownload.HasReceivedAll())
+    {
+        LoadDownloadedMap();
     }
-    if (size > chunk_buffer.size())
+    else
     {
-        chunk_buffer.resize(size);
+        ShowMapDownloadStatus();
     }
+}
+
+void NetworkBase::ShowMapDownloadStatus()
+{
     char str_downloading_map[256];
     uint32_t downloading_map_args[2] = {
-        (offset + chunksize) / 1024,
-        size / 1024,
+        _mapDownload.GetBytesReceived() / 1024,
+        _mapDownload.GetBytesRequested() / 1024,
     };
     format_string(str_downloading_map, 256, STR_MULTIPLAYER_DOWNLOADING_MAP, downloading_map_args);
 
@@ -2692,49 +2834,55 @@ void NetworkBase::Client_Handle_MAP([[maybe_unused]] NetworkConnection& connecti
     intent.putExtra(INTENT_EXTRA_MESSAGE, std::string{ str_downloading_map });
     intent.putExtra(INTENT_EXTRA_CALLBACK, []() -> void { ::GetContext()->GetNetwork().Close(); });
     context_open_intent(&intent);
+}
 
-    std::memcpy(&chunk_buffer[offset], const_cast<void*>(static_cast<const void*>(packet.Read(chunksize))), chunksize);
-    if (offset + chunksize == size)
+void NetworkBase::LoadDownloadedMap()
+{
+    // Allow queue processing of game actions again.
+    GameActions::ResumeQueue();
+
+    context_force_close_window_by_class(WC_NETWORK_STATUS);
+
+    // Most blocks have been decompressed while the rest were downloading, this waits for the last ones.
+    std::vector<uint8_t> data;
+    bool loaded = _mapDownload.Finish(data);
+    if (!loaded)
     {
-        // Allow queue processing of game actions again.
-        GameActions::ResumeQueue();
+        Console::Error::WriteLine("Unable to read map from server: a block is corrupt");
+    }
+    else
+    {
+        auto ms = MemoryStream(data.data(), data.size());
+        loaded = LoadMap(&ms);
+    }
 
-        context_force_close_window_by_class(WC_NETWORK_STATUS);
-        bool has_to_free = false;
-        uint8_t* data = &chunk_buffer[0];
-        size_t data_size = size;
-        auto ms = MemoryStream(data, data_size);
-        if (LoadMap(&ms))
-        {
-            game_load_init();
-            game_load_scripts();
-            _serverState.tick = gCurrentTicks;
-            // window_network_status_open("Loaded new map from network");
-            _serverState.state = NetworkServerState::Ok;
-            _clientMapLoaded = true;
-            gFirstTimeSaving = true;
-
-            // Notify user he is now online and which shortcut key enables chat
-            network_chat_show_connected_message();
-
-            // Fix invalid vehicle sprite sizes, thus preventing visual corruption of sprites
-            fix_invalid_vehicle_sprite_sizes();
-
-            // NOTE: Game actions are normally processed before processing the player list.
-            // Given that during map load game actions are buffered we have to process the
-            // player list first to have valid players for the queued game actions.
-            ProcessPlayerList();
-        }
-        else
-        {
-            // Something went wrong, game is not loaded. Return to main screen.
-            auto loadOrQuitAction = LoadOrQuitAction(LoadOrQuitModes::OpenSavePrompt, PromptMode::SaveBeforeQuit);
-            GameActions::Execute(&loadOrQuitAction);
-        }
-        if (has_to_free)
-        {
-            free(data);
-        }
+    if (loaded)
+    {
+        game_load_init();
+        game_load_scripts();
+        // Ticks the server sent while the map was downloading are already known, only ticks after those are ahead.
+        _serverState.tick = _serverTickData.empty() ? gCurrentTicks : std::max(gCurrentTicks, _serverState.tick);
+        // window_network_status_open("Loaded new map from network");
+        _serverState.state = NetworkServerState::Ok;
+        _clientMapLoaded = true;
+        gFirstTimeSaving = true;
+
+        // Notify user he is now online and which shortcut key enables chat
+        network_chat_show_connected_message();
+
+        // Fix invalid vehicle sprite sizes, thus preventing visual corruption of sprites
+        fix_invalid_vehicle_sprite_sizes();
+
+        // NOTE: Game actions are normally processed before processing the player list.
+        // Given that during map load game actions are buffered we have to process the
+        // player list first to have valid players for the queued game actions.
+        ProcessPlayerList();
+    }
+    else
+    {
+        // Something went wrong, game is not loaded. Return to main screen.
+        auto loadOrQuitAction = LoadOrQuitAction(LoadOrQuitModes::OpenSavePrompt, PromptMode::SaveBeforeQuit);
+        GameActions::Execute(&loadOrQuitAction);
     }
 }
 
@@ -2771,6 +2919,8 @@ bool NetworkBase::SaveMap(IStream* stream, const std::vector<const ObjectReposit
     {
         auto exporter = std::make_unique<ParkFileExporter>();
         exporter->ExportObjectsList = objects;
+        // The map is compressed in blocks when sent, see NetworkMapSnapshot.
+        exporter->Uncompressed = true;
         exporter->Export(*stream);
         result = true;
     }
@@ -2911,10 +3061,10 @@ void NetworkBase::Server_Handle_GAME_ACTION(NetworkConnection& connection, Netwo
         return;
     }
 
-    if (actionType != GameCommand::Custom)
+    // Check if player's group permission allows command to run, batches are checked per action once read.
+    NetworkGroup* group = GetGroupByID(connection.Player->Group);
+    if (actionType != GameCommand::Custom && actionType != GameCommand::Batch)
     {
-        // Check if player's group permission allows command to run
-        NetworkGroup* group = GetGroupByID(connection.Player->Group);
         if (group == nullptr || group->CanPerformCommand(actionType) == false)
         {
             Server_Send_SHOWERROR(connection, STR_CANT_DO_THIS, STR_PERMISSION_DENIED);
@@ -2954,6 +3104,14 @@ void NetworkBase::Server_Handle_GAME_ACTION(NetworkConnection& connection, Netwo
 
     DataSerialiser stream(false);
     const size_t size = packet.Header.Size - packet.BytesRead;
+    if (actionType == GameCommand::Batch && size > BatchAction::MaxNetworkSize)
+    {
+        log_warning(
+            "Received oversized batch of %zu bytes from player: (%d) %s", size, connection.Player->Id,
+            connection.Player->Name.c_str());
+        Server_Send_SHOWERROR(connection, STR_CANT_DO_THIS, STR_NONE);
+        return;
+    }
     stream.GetStream().WriteArray(packet.Read(size), size);
     stream.GetStream().SetPosition(0);
 
@@ -2961,6 +3119,43 @@ void NetworkBase::Server_Handle_GAME_ACTION(NetworkConnection& connection, Netwo
     // Set player to sender, should be 0 if sent from client.
     ga->SetPlayer(NetworkPlayerId_t{ connection.Player->Id });
 
+    if (actionType == GameCommand::Batch)
+    {
+        const auto& batchAction = static_cast<const BatchAction&>(*ga);
+        bool applyCooldowns = (player->Flags & NETWORK_PLAYER_FLAG_ISSERVER) == 0;
+        std::map<GameCommand, uint32_t> cooldowns;
+        for (const auto& action : batchAction.GetActions())
+        {
+            auto type = action->GetType();
+            if (type != GameCommand::Custom && (group == nullptr || group->CanPerformCommand(type) == false))
+            {
+                Server_Send_SHOWERROR(connection, STR_CANT_DO_THIS, STR_PERMISSION_DENIED);
+                return;
+            }
+
+            // Each action of the batch counts against its own cooldown, so a rate limited action can only be batched once.
+            if (applyCooldowns)
+            {
+                auto cooldownIt = player->CooldownTime.find(type);
+                if ((cooldownIt != std::end(player->CooldownTime) && cooldownIt->second > 0) || cooldowns.count(type) != 0)
+                {
+                    Server_Send_SHOWERROR(connection, STR_CANT_DO_THIS, STR_NETWORK_ACTION_RATE_LIMIT_MESSAGE);
+                    return;
+                }
+
+                uint32_t cooldownTime = action->GetCooldownTime();
+                if (cooldownTime > 0)
+                {
+                    cooldowns[type] = cooldownTime;
+                }
+            }
+        }
+        for (const auto& [type, cooldownTime] : cooldowns)
+        {
+            player->CooldownTime[type] = cooldownTime;
+        }
+    }
+
     GameActions::Enqueue(std::move(ga), tick);
 }
 
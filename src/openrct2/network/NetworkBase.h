@@ -5,6 +5,8 @@
 #include "../object/Object.h"
 #include "NetworkConnection.h"
 #include "NetworkGroup.h"
+#include "NetworkIoThread.h"
+#include "NetworkMapTransfer.h"
 #include "NetworkPlayer.h"
 #include "NetworkServerAdvertiser.h"
 #include "NetworkTypes.h"
@@ -83,6 +85,7 @@ public: // Server
     void Server_Send_AUTH(NetworkConnection& connection);
     void Server_Send_TOKEN(NetworkConnection& connection);
     void Server_Send_MAP(NetworkConnection* connection = nullptr);
+    void Server_Send_MAP_BLOCK(NetworkConnection& connection, uint32_t index);
     void Server_Send_CHAT(const char* text, const std::vector<uint8_t>& playerIds = {});
     void Server_Send_GAME_ACTION(const GameAction* action);
     void Server_Send_TICK();
@@ -110,6 +113,7 @@ public: // Server
     void Server_Handle_GAMEINFO(NetworkConnection& connection, NetworkPacket& packet);
     void Server_Handle_TOKEN(NetworkConnection& connection, NetworkPacket& packet);
     void Server_Handle_MAPREQUEST(NetworkConnection& connection, NetworkPacket& packet);
+    void Server_Handle_MAPBLOCKREQUEST(NetworkConnection& connection, NetworkPacket& packet);
 
 public: // Client
     void Reconnect();
@@ -128,6 +132,8 @@ public: // Client
     NetworkServerState_t GetServerState() const;
     void ServerClientDisconnected();
     bool LoadMap(OpenRCT2::IStream* stream);
+    void ShowMapDownloadStatus();
+    void LoadDownloadedMap();
     void UpdateClient();
 
     // Packet dispatchers.
@@ -140,10 +146,12 @@ public: // Client
     void Client_Send_PING();
     void Client_Send_GAMEINFO();
     void Client_Send_MAPREQUEST(const std::vector<ObjectEntryDescriptor>& objects);
+    void Client_Send_MAPBLOCKREQUEST();
     void Client_Send_HEARTBEAT(NetworkConnection& connection) const;
 
     // Handlers.
     void Client_Handle_AUTH(NetworkConnection& connection, NetworkPacket& packet);
+    void Client_Handle_MAPMANIFEST(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_MAP(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_CHAT(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_GAME_ACTION(NetworkConnection& connection, NetworkPacket& packet);
@@ -180,7 +188,6 @@ public: // Public common
 private: // Common Data
     using CommandHandler = void (NetworkBase::*)(NetworkConnection& connection, NetworkPacket& packet);
 
-    std::vector<uint8_t> chunk_buffer;
     std::ofstream _chat_log_fs;
     uint32_t _lastUpdateTime = 0;
     uint32_t _currentDeltaTime = 0;
@@ -193,6 +200,7 @@ private: // Common Data
 private: // Server Data
     std::unordered_map<NetworkCommand, CommandHandler> server_command_handlers;
     std::unique_ptr<ITcpSocket> _listenSocket;
+    std::unique_ptr<NetworkIoThread> _ioThread;
     std::unique_ptr<INetworkServerAdvertiser> _advertiser;
     std::list<std::unique_ptr<NetworkConnection>> client_connection_list;
     std::string _serverLogPath;
@@ -220,6 +228,8 @@ private: // Client Data
     std::multimap<uint32_t, NetworkPlayer> _pendingPlayerInfo;
     std::map<uint32_t, ServerTickData_t> _serverTickData;
     std::vector<ObjectEntryDescriptor> _missingObjects;
+    // Kept when disconnected, so the blocks already downloaded are not downloaded again after reconnecting.
+    NetworkMapDownload _mapDownload;
     std::string _host;
     std::string _chatLogPath;
     std::string _chatLogFilenameFormat = "%Y%m%d-%H%M%S.txt";
@@ -0,0 +1,104 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_NETWORK
+
+#    include "NetworkCompression.h"
+
+#    include "zlib.h"
+
+#    include <array>
+#    include <stdexcept>
+#    include <string>
+
+constexpr size_t CompressionBufferSize = 4096;
+
+NetworkStreamCompressor::NetworkStreamCompressor()
+    : _stream(std::make_unique<z_stream>())
+{
+    // Raw deflate as messages are framed by the packets they are sent in, favouring speed as this runs every tick.
+    const auto ret = deflateInit2(_stream.get(), Z_BEST_SPEED, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+    if (ret != Z_OK)
+    {
+        throw std::runtime_error("deflateInit2 failed with error " + std::to_string(ret));
+    }
+}
+
+NetworkStreamCompressor::~NetworkStreamCompressor()
+{
+    deflateEnd(_stream.get());
+}
+
+void NetworkStreamCompressor::Compress(const uint8_t* data, size_t size, std::vector<uint8_t>& output)
+{
+    _stream->next_in = const_cast<Bytef*>(data);
+    _stream->avail_in = static_cast<uInt>(size);
+
+    // A sync flush ends the message on a byte boundary with all of it in the output.
+    std::array<uint8_t, CompressionBufferSize> buffer;
+    do
+    {
+        _stream->next_out = buffer.data();
+        _stream->avail_out = static_cast<uInt>(buffer.size());
+        const auto ret = deflate(_stream.get(), Z_SYNC_FLUSH);
+        if (ret != Z_OK && ret != Z_BUF_ERROR)
+        {
+            throw std::runtime_error("deflate failed with error " + std::to_string(ret));
+        }
+        output.insert(output.end(), buffer.data(), buffer.data() + (buffer.size() - _stream->avail_out));
+    } while (_stream->avail_out == 0);
+}
+
+NetworkStreamDecompressor::NetworkStreamDecompressor()
+    : _stream(std::make_unique<z_stream>())
+{
+    const auto ret = inflateInit2(_stream.get(), -MAX_WBITS);
+    if (ret != Z_OK)
+    {
+        throw std::runtime_error("inflateInit2 failed with error " + std::to_string(ret));
+    }
+}
+
+NetworkStreamDecompressor::~NetworkStreamDecompressor()
+{
+    inflateEnd(_stream.get());
+}
+
+bool NetworkStreamDecompressor::Decompress(const uint8_t* data, size_t size, size_t maxSize, std::vector<uint8_t>& output)
+{
+    _stream->next_in = const_cast<Bytef*>(data);
+    _stream->avail_in = static_cast<uInt>(size);
+
+    std::array<uint8_t, CompressionBufferSize> buffer;
+    do
+    {
+        _stream->next_out = buffer.data();
+        _stream->avail_out = static_cast<uInt>(buffer.size());
+        const auto ret = inflate(_stream.get(), Z_SYNC_FLUSH);
+        if (ret != Z_OK && ret != Z_BUF_ERROR)
+        {
+            return false;
+        }
+
+        const auto length = buffer.size() - _stream->avail_out;
+        if (length == 0 && _stream->avail_in > 0)
+        {
+            // No progress while input is left, the stream is truncated or corrupt.
+            return false;
+        }
+        if (output.size() + length > maxSize)
+        {
+            return false;
+        }
+        output.insert(output.end(), buffer.data(), buffer.data() + length);
+    } while (_stream->avail_out == 0 || _stream->avail_in > 0);
+    return true;
+}
+
+#endif // DISABLE_NETWORK
@@ -0,0 +1,52 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifndef DISABLE_NETWORK
+
+#    include "../common.h"
+
+#    include <memory>
+#    include <vector>
+
+struct z_stream_s;
+
+/**
+ * Compresses a stream of messages. Each message can be decompressed as soon as it arrives, while later messages still
+ * compress against the ones sent before them.
+ */
+class NetworkStreamCompressor final
+{
+public:
+    NetworkStreamCompressor();
+    ~NetworkStreamCompressor();
+
+    void Compress(const uint8_t* data, size_t size, std::vector<uint8_t>& output);
+
+private:
+    std::unique_ptr<z_stream_s> _stream;
+};
+
+class NetworkStreamDecompressor final
+{
+public:
+    NetworkStreamDecompressor();
+    ~NetworkStreamDecompressor();
+
+    /**
+     * Returns false when the data is invalid or decompresses to more than maxSize bytes.
+     */
+    bool Decompress(const uint8_t* data, size_t size, size_t maxSize, std::vector<uint8_t>& output);
+
+private:
+    std::unique_ptr<z_stream_s> _stream;
+};
+
+#endif // DISABLE_NETWORK
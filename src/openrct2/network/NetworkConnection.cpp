@@ -17,8 +17,17 @@
 #    include "Socket.h"
 #    include "network.h"
 
+#    include <algorithm>
+#    include <array>
+#    include <cstring>
+
 constexpr size_t NETWORK_DISCONNECT_REASON_BUFFER_SIZE = 256;
 constexpr size_t NetworkBufferSize = 1024 * 64; // 64 KiB, maximum packet size.
+constexpr size_t MaxPacketsPerSend = 64;
+// Reading stops once this many packets wait for the game thread, until it catches up.
+constexpr size_t MaxReceivedPackets = 1024;
+// Uncompressed size of a batch, small enough for the compressed batch to always fit in a packet.
+constexpr size_t MaxBatchSize = 1024 * 32;
 
 NetworkConnection::NetworkConnection()
 {
@@ -29,8 +38,24 @@ NetworkConnection::~NetworkConnection()
 {
 }
 
+static void NormaliseHeader(PacketHeader& header)
+{
+    header.Size = Convert::NetworkToHost(header.Size);
+    header.Id = ByteSwapBE(header.Id);
+
+    // NOTE: For compatibility reasons for the master server we need to remove sizeof(Header.Id) from the size.
+    // Previously the Id field was not part of the header rather part of the body.
+    header.Size -= std::min<uint16_t>(header.Size, sizeof(header.Id));
+}
+
 NetworkReadPacket NetworkConnection::ReadPacket()
 {
+    // The packets of a batch are handed out one at a time before reading on.
+    if (TakeUnpackedPacket())
+    {
+        return NetworkReadPacket::Success;
+    }
+
     size_t bytesRead = 0;
 
     // Read packet header.
@@ -54,13 +79,7 @@ NetworkReadPacket NetworkConnection::ReadPacket()
             return NetworkReadPacket::MoreData;
         }
 
-        // Normalise values.
-        header.Size = Convert::NetworkToHost(header.Size);
-        header.Id = ByteSwapBE(header.Id);
-
-        // NOTE: For compatibility reasons for the master server we need to remove sizeof(Header.Id) from the size.
-        // Previously the Id field was not part of the header rather part of the body.
-        header.Size -= std::min<uint16_t>(header.Size, sizeof(header.Id));
+        NormaliseHeader(header);
 
         // Fall-through: Read rest of packet.
     }
@@ -89,7 +108,19 @@ NetworkReadPacket NetworkConnection::ReadPacket()
             // Received complete packet.
             _lastPacketTime = platform_get_ticks();
 
-            RecordPacketStats(InboundPacket, false);
+            RecordPacketStats(InboundPacket.GetCommand(), InboundPacket.BytesTransferred, false);
+
+            if (InboundPacket.GetCommand() == NetworkCommand::Batch)
+            {
+                const auto unpacked = UnpackBatch(InboundPacket);
+                InboundPacket.Clear();
+                if (!unpacked)
+                {
+                    log_verbose("Received invalid batch from %s", Socket->GetHostName());
+                    return NetworkReadPacket::Disconnected;
+                }
+                return TakeUnpackedPacket() ? NetworkReadPacket::Success : NetworkReadPacket::MoreData;
+            }
 
             return NetworkReadPacket::Success;
         }
@@ -98,63 +129,67 @@ NetworkReadPacket NetworkConnection::ReadPacket()
     return NetworkReadPacket::MoreData;
 }
 
-bool NetworkConnection::SendPacket(NetworkPacket& packet)
+void NetworkConnection::QueuePacket(const NetworkPacket& packet, bool front)
 {
-    auto header = packet.Header;
-
-    std::vector<uint8_t> buffer;
-    buffer.reserve(sizeof(header) + header.Size);
-
-    // NOTE: For compatibility reasons for the master server we need to add sizeof(Header.Id) to the size.
-    // Previously the Id field was not part of the header rather part of the body.
-    header.Size += sizeof(header.Id);
-    header.Size = Convert::HostToNetwork(header.Size);
-    header.Id = ByteSwapBE(header.Id);
-
-    buffer.insert(buffer.end(), reinterpret_cast<uint8_t*>(&header), reinterpret_cast<uint8_t*>(&header) + sizeof(header));
-    buffer.insert(buffer.end(), packet.Data.begin(), packet.Data.end());
-
-    size_t bufferSize = buffer.size() - packet.BytesTransferred;
-    size_t sent = Socket->SendData(buffer.data() + packet.BytesTransferred, bufferSize);
-    if (sent > 0)
+    if (AuthStatus == NetworkAuth::Ok || !packet.CommandRequiresAuth())
     {
-        packet.BytesTransferred += sent;
+        QueuePacket(packet.Frame(), front);
     }
+}
 
-    bool sendComplete = packet.BytesTransferred == buffer.size();
-    if (sendComplete)
+NetworkReadPacket NetworkConnection::ReceivePacket(NetworkPacket& packet)
+{
+    // Checked before taking a packet, as the packets read before the socket closed are queued before it is marked closed.
+    const auto socketClosed = _socketClosed.load();
+    if (_receivedPackets.try_pop(packet))
     {
-        RecordPacketStats(packet, true);
+        _receivedPacketCount--;
+        return NetworkReadPacket::Success;
     }
-    return sendComplete;
+    return socketClosed ? NetworkReadPacket::Disconnected : NetworkReadPacket::NoData;
 }
 
-void NetworkConnection::QueuePacket(NetworkPacket&& packet, bool front)
+void NetworkConnection::QueuePacket(const std::shared_ptr<const NetworkFramedPacket>& packet, bool front)
 {
-    if (AuthStatus == NetworkAuth::Ok || !packet.CommandRequiresAuth())
+    if (AuthStatus == NetworkAuth::Ok || !NetworkPacket::CommandRequiresAuth(packet->Command))
     {
-        packet.Header.Size = static_cast<uint16_t>(packet.Data.size());
-        if (front)
+        if (_usesIoThread)
         {
-            // If the first packet was already partially sent add new packet to second position
-            if (!_outboundPackets.empty() && _outboundPackets.front().BytesTransferred > 0)
-            {
-                auto it = _outboundPackets.begin();
-                it++; // Second position
-                _outboundPackets.insert(it, std::move(packet));
-            }
-            else
-            {
-                _outboundPackets.push_front(std::move(packet));
-            }
+            _pendingPackets.push({ packet, front });
         }
         else
         {
-            _outboundPackets.push_back(std::move(packet));
+            InsertOutboundPacket(packet, front);
         }
     }
 }
 
+void NetworkConnection::InsertOutboundPacket(const std::shared_ptr<const NetworkFramedPacket>& packet, bool front)
+{
+    if (front)
+    {
+        // If the first packet was already partially sent add new packet to second position
+        auto it = _outboundPackets.begin();
+        if (!_outboundPackets.empty() && it->BytesTransferred > 0)
+        {
+            it++;
+        }
+        if (_compressing)
+        {
+            // Batches have to arrive in the order they were compressed in, so the packet can only go after the last one.
+            auto lastBatch = std::find_if(_outboundPackets.rbegin(), _outboundPackets.rend(), [](const OutboundPacket& p) {
+                return p.Packet->Command == NetworkCommand::Batch;
+            });
+            it = std::max(it, lastBatch.base());
+        }
+        _outboundPackets.insert(it, { packet });
+    }
+    else
+    {
+        _outboundPackets.push_back({ packet });
+    }
+}
+
 void NetworkConnection::Disconnect()
 {
     ShouldDisconnect = true;
@@ -167,9 +202,49 @@ bool NetworkConnection::IsValid() const
 
 void NetworkConnection::SendQueuedPackets()
 {
-    while (!_outboundPackets.empty() && SendPacket(_outboundPackets.front()))
+    PendingPacket pending;
+    while (_pendingPackets.try_pop(pending))
+    {
+        InsertOutboundPacket(pending.Packet, pending.Front);
+    }
+
+    if (_compressing)
+    {
+        BatchOutboundPackets();
+    }
+
+    while (!_outboundPackets.empty())
     {
-        _outboundPackets.pop_front();
+        // Hand as many queued packets as possible to the socket at once.
+        std::array<SocketBuffer, MaxPacketsPerSend> buffers;
+        size_t bufferCount = 0;
+        size_t bufferedBytes = 0;
+        for (auto it = _outboundPackets.begin(); it != _outboundPackets.end() && bufferCount < buffers.size(); it++)
+        {
+            const auto& bytes = it->Packet->Bytes;
+            buffers[bufferCount++] = { bytes.data() + it->BytesTransferred, bytes.size() - it->BytesTransferred };
+            bufferedBytes += bytes.size() - it->BytesTransferred;
+        }
+
+        auto sent = Socket->SendData(buffers.data(), bufferCount);
+        auto remaining = sent;
+        while (remaining > 0)
+        {
+            auto& packet = _outboundPackets.front();
+            auto length = std::min(remaining, packet.Packet->Bytes.size() - packet.BytesTransferred);
+            packet.BytesTransferred += length;
+            remaining -= length;
+            if (packet.BytesTransferred == packet.Packet->Bytes.size())
+            {
+                RecordPacketStats(packet.Packet->Command, packet.BytesTransferred, true);
+                _outboundPackets.pop_front();
+            }
+        }
+
+        if (sent < bufferedBytes)
+        {
+            break;
+        }
     }
 }
 
@@ -189,6 +264,157 @@ bool NetworkConnection::ReceivedPacketRecently()
     return true;
 }
 
+NetworkStats_t NetworkConnection::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    return _stats;
+}
+
+void NetworkConnection::BeginCompression()
+{
+    _compressing = true;
+}
+
+void NetworkConnection::BatchOutboundPackets()
+{
+    // The first packet may have been sent partially already.
+    size_t first = !_outboundPackets.empty() && _outboundPackets.front().BytesTransferred > 0 ? 1 : 0;
+    while (first < _outboundPackets.size())
+    {
+        // Packets too large for a batch, such as map chunks, and batches left over from the last flush are sent as is.
+        size_t last = first;
+        size_t batchSize = 0;
+        while (last < _outboundPackets.size())
+        {
+            const auto& packet = *_outboundPackets[last].Packet;
+            if (packet.Command == NetworkCommand::Batch || batchSize + packet.Bytes.size() > MaxBatchSize)
+                break;
+
+            batchSize += packet.Bytes.size();
+            last++;
+        }
+        if (last == first)
+        {
+            first++;
+            continue;
+        }
+
+        auto batch = CreateBatch(first, last);
+        _outboundPackets.erase(_outboundPackets.begin() + first, _outboundPackets.begin() + last);
+        _outboundPackets.insert(_outboundPackets.begin() + first, { batch });
+        first++;
+    }
+}
+
+std::shared_ptr<const NetworkFramedPacket> NetworkConnection::CreateBatch(size_t first, size_t last)
+{
+    std::vector<uint8_t> packets;
+    for (size_t i = first; i < last; i++)
+    {
+        const auto& packet = *_outboundPackets[i].Packet;
+        packets.insert(packets.end(), packet.Bytes.begin(), packet.Bytes.end());
+        RecordPacketStats(packet.Command, packet.Bytes.size(), true, true);
+    }
+
+    if (_compressor == nullptr)
+    {
+        _compressor = std::make_unique<NetworkStreamCompressor>();
+    }
+
+    NetworkPacket batch(NetworkCommand::Batch);
+    _compressor->Compress(packets.data(), packets.size(), batch.Data);
+    return batch.Frame();
+}
+
+bool NetworkConnection::UnpackBatch(const NetworkPacket& batch)
+{
+    if (_decompressor == nullptr)
+    {
+        _decompressor = std::make_unique<NetworkStreamDecompressor>();
+    }
+
+    std::vector<uint8_t> packets;
+    if (!_decompressor->Decompress(batch.GetData(), batch.Data.size(), MaxBatchSize, packets))
+        return false;
+
+    size_t offset = 0;
+    while (offset < packets.size())
+    {
+        PacketHeader header;
+        if (packets.size() - offset < sizeof(header))
+            return false;
+
+        std::memcpy(&header, &packets[offset], sizeof(header));
+        NormaliseHeader(header);
+        offset += sizeof(header);
+        if (packets.size() - offset < header.Size || header.Id == NetworkCommand::Batch)
+            return false;
+
+        NetworkPacket packet;
+        packet.Header = header;
+        packet.Write(&packets[offset], header.Size);
+        packet.BytesTransferred = sizeof(header) + header.Size;
+        offset += header.Size;
+
+        RecordPacketStats(packet.GetCommand(), packet.BytesTransferred, false, true);
+        _unpackedPackets.push_back(std::move(packet));
+    }
+    return true;
+}
+
+bool NetworkConnection::TakeUnpackedPacket()
+{
+    if (_unpackedPackets.empty())
+        return false;
+
+    InboundPacket = std::move(_unpackedPackets.front());
+    _unpackedPackets.pop_front();
+    return true;
+}
+
+void NetworkConnection::BeginIoThread()
+{
+    _usesIoThread = true;
+}
+
+bool NetworkConnection::UsesIoThread() const
+{
+    return _usesIoThread;
+}
+
+bool NetworkConnection::ReadPackets()
+{
+    while (!IsReceiveQueueFull())
+    {
+        switch (ReadPacket())
+        {
+            case NetworkReadPacket::Success:
+                _receivedPackets.push(std::move(InboundPacket));
+                _receivedPacketCount++;
+                InboundPacket = NetworkPacket();
+                break;
+            case NetworkReadPacket::MoreData:
+                break;
+            case NetworkReadPacket::NoData:
+                return true;
+            case NetworkReadPacket::Disconnected:
+                _socketClosed = true;
+                return false;
+        }
+    }
+    return true;
+}
+
+bool NetworkConnection::HasQueuedPackets() const
+{
+    return !_outboundPackets.empty() || !_pendingPackets.empty();
+}
+
+bool NetworkConnection::IsReceiveQueueFull() const
+{
+    return _receivedPacketCount >= MaxReceivedPackets;
+}
+
 const utf8* NetworkConnection::GetLastDisconnectReason() const
 {
     return this->_lastDisconnectReason.c_str();
@@ -206,16 +432,17 @@ void NetworkConnection::SetLastDisconnectReason(const rct_string_id string_id, v
     SetLastDisconnectReason(buffer);
 }
 
-void NetworkConnection::RecordPacketStats(const NetworkPacket& packet, bool sending)
+void NetworkConnection::RecordPacketStats(NetworkCommand command, size_t size, bool sending, bool batched)
 {
-    uint32_t packetSize = static_cast<uint32_t>(packet.BytesTransferred);
+    uint32_t packetSize = static_cast<uint32_t>(size);
     NetworkStatisticsGroup trafficGroup;
 
-    switch (packet.GetCommand())
+    switch (command)
     {
         case NetworkCommand::GameAction:
             trafficGroup = NetworkStatisticsGroup::Commands;
             break;
+        case NetworkCommand::MapManifest:
         case NetworkCommand::Map:
             trafficGroup = NetworkStatisticsGroup::MapData;
             break;
@@ -224,15 +451,17 @@ void NetworkConnection::RecordPacketStats(const NetworkPacket& packet, bool send
             break;
     }
 
-    if (sending)
+    // Packets in a batch count towards their own group with their uncompressed size, the batch only counts towards the
+    // total with the size that is actually transferred.
+    std::lock_guard<std::mutex> lock(_statsMutex);
+    auto& bytes = sending ? _stats.bytesSent : _stats.bytesReceived;
+    if (command != NetworkCommand::Batch)
     {
-        Stats.bytesSent[EnumValue(trafficGroup)] += packetSize;
-        Stats.bytesSent[EnumValue(NetworkStatisticsGroup::Total)] += packetSize;
+        bytes[EnumValue(trafficGroup)] += packetSize;
     }
-    else
+    if (!batched)
     {
-        Stats.bytesReceived[EnumValue(trafficGroup)] += packetSize;
-        Stats.bytesReceived[EnumValue(NetworkStatisticsGroup::Total)] += packetSize;
+        bytes[EnumValue(NetworkStatisticsGroup::Total)] += packetSize;
     }
 }
 
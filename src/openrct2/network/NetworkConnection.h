@@ -11,13 +11,18 @@
 
 #ifndef DISABLE_NETWORK
 #    include "../common.h"
+#    include "../core/SpscQueue.h"
+#    include "NetworkCompression.h"
 #    include "NetworkKey.h"
+#    include "NetworkMapTransfer.h"
 #    include "NetworkPacket.h"
 #    include "NetworkTypes.h"
 #    include "Socket.h"
 
+#    include <atomic>
 #    include <deque>
 #    include <memory>
+#    include <mutex>
 #    include <string_view>
 #    include <vector>
 
@@ -30,24 +35,28 @@ public:
     std::unique_ptr<ITcpSocket> Socket = nullptr;
     NetworkPacket InboundPacket;
     NetworkAuth AuthStatus = NetworkAuth::None;
-    NetworkStats_t Stats = {};
     NetworkPlayer* Player = nullptr;
     uint32_t PingTime = 0;
     NetworkKey Key;
     std::vector<uint8_t> Challenge;
     std::vector<const ObjectRepositoryItem*> RequestedObjects;
+    // The map saved for the client, until it has requested the blocks it needs.
+    std::shared_ptr<const NetworkMapSnapshot> MapSnapshot;
     bool ShouldDisconnect = false;
 
     NetworkConnection();
     ~NetworkConnection();
 
     NetworkReadPacket ReadPacket();
-    void QueuePacket(NetworkPacket&& packet, bool front = false);
-    void QueuePacket(const NetworkPacket& packet, bool front = false)
-    {
-        auto copy = packet;
-        return QueuePacket(std::move(copy), front);
-    }
+
+    /**
+     * Takes the next packet the network I/O thread has read, returns Disconnected once the socket closed and every
+     * packet read before that has been taken.
+     */
+    NetworkReadPacket ReceivePacket(NetworkPacket& packet);
+
+    void QueuePacket(const NetworkPacket& packet, bool front = false);
+    void QueuePacket(const std::shared_ptr<const NetworkFramedPacket>& packet, bool front = false);
 
     // This will not immediately disconnect the client. The disconnect
     // will happen post-tick.
@@ -57,18 +66,65 @@ public:
     void SendQueuedPackets();
     void ResetLastPacketTime();
     bool ReceivedPacketRecently();
+    NetworkStats_t GetStats() const;
+
+    /**
+     * Sends the packets queued at each flush compressed together in batch packets. Only used once the handshake is
+     * completed, when both ends are known to run the same version.
+     */
+    void BeginCompression();
+
+    // Hands reading and writing the socket to the network I/O thread, see NetworkIoThread.
+    void BeginIoThread();
+    bool UsesIoThread() const;
+
+    // Called by the network I/O thread only.
+    bool ReadPackets();
+    bool HasQueuedPackets() const;
+    bool IsReceiveQueueFull() const;
 
     const utf8* GetLastDisconnectReason() const;
     void SetLastDisconnectReason(std::string_view src);
     void SetLastDisconnectReason(const rct_string_id string_id, void* args = nullptr);
 
 private:
-    std::deque<NetworkPacket> _outboundPackets;
-    uint32_t _lastPacketTime = 0;
+    struct OutboundPacket
+    {
+        std::shared_ptr<const NetworkFramedPacket> Packet;
+        size_t BytesTransferred = 0;
+    };
+
+    struct PendingPacket
+    {
+        std::shared_ptr<const NetworkFramedPacket> Packet;
+        bool Front = false;
+    };
+
+    std::deque<OutboundPacket> _outboundPackets;
+    std::atomic<uint32_t> _lastPacketTime = 0;
     std::string _lastDisconnectReason;
+    NetworkStats_t _stats = {};
+    mutable std::mutex _statsMutex;
+
+    // Packets handed between the game thread and the network I/O thread.
+    bool _usesIoThread = false;
+    SpscQueue<PendingPacket> _pendingPackets;
+    SpscQueue<NetworkPacket> _receivedPackets;
+    std::atomic<size_t> _receivedPacketCount = 0;
+    std::atomic<bool> _socketClosed = false;
+
+    // Compressed batches, the compressor is used by the sending thread and the decompressor by the reading thread.
+    std::atomic<bool> _compressing = false;
+    std::unique_ptr<NetworkStreamCompressor> _compressor;
+    std::unique_ptr<NetworkStreamDecompressor> _decompressor;
+    std::deque<NetworkPacket> _unpackedPackets;
 
-    void RecordPacketStats(const NetworkPacket& packet, bool sending);
-    bool SendPacket(NetworkPacket& packet);
+    void InsertOutboundPacket(const std::shared_ptr<const NetworkFramedPacket>& packet, bool front);
+    void BatchOutboundPackets();
+    std::shared_ptr<const NetworkFramedPacket> CreateBatch(size_t first, size_t last);
+    bool UnpackBatch(const NetworkPacket& batch);
+    bool TakeUnpackedPacket();
+    void RecordPacketStats(NetworkCommand command, size_t size, bool sending, bool batched = false);
 };
 
 #endif // DISABLE_NETWORK
@@ -0,0 +1,182 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_NETWORK
+
+#    include "NetworkIoThread.h"
+
+#    include "../Diagnostic.h"
+#    include "NetworkConnection.h"
+
+#    include <algorithm>
+#    include <array>
+
+constexpr size_t MaxEventsPerWait = 256;
+// Stopping wakes the thread, the timeout only bounds how long a lost wake up can delay sending.
+constexpr int32_t WaitTimeoutMs = 100;
+
+static void* GetUserData(uintptr_t clientId)
+{
+    return reinterpret_cast<void*>(clientId);
+}
+
+std::unique_ptr<NetworkIoThread> NetworkIoThread::Create(ITcpSocket& listenSocket)
+{
+    auto poller = CreateSocketPoller();
+    if (poller == nullptr)
+        return nullptr;
+
+    // The listening socket has no user data, clients start at 1.
+    if (!poller->Add(listenSocket, nullptr))
+    {
+        log_error("Unable to poll the listening socket.");
+        return nullptr;
+    }
+    return std::make_unique<NetworkIoThread>(std::move(poller), listenSocket);
+}
+
+NetworkIoThread::NetworkIoThread(std::unique_ptr<ISocketPoller>&& poller, ITcpSocket& listenSocket)
+    : _poller(std::move(poller))
+    , _listenSocket(listenSocket)
+{
+    _thread = std::thread([this]() { Run(); });
+}
+
+NetworkIoThread::~NetworkIoThread()
+{
+    _stop = true;
+    _poller->Wake();
+    _thread.join();
+}
+
+std::unique_ptr<ITcpSocket> NetworkIoThread::Accept()
+{
+    std::unique_ptr<ITcpSocket> socket;
+    if (_acceptedSockets.try_pop(socket))
+    {
+        return socket;
+    }
+    return nullptr;
+}
+
+void NetworkIoThread::AddConnection(NetworkConnection& connection)
+{
+    connection.BeginIoThread();
+
+    std::lock_guard<std::mutex> lock(_clientsMutex);
+    auto id = _nextClientId++;
+    if (!_poller->Add(*connection.Socket, GetUserData(id)))
+    {
+        log_error("Unable to poll the socket of %s.", connection.Socket->GetHostName());
+        connection.Disconnect();
+        return;
+    }
+    _clients.emplace(id, Client{ &connection, true, false, false });
+}
+
+void NetworkIoThread::RemoveConnection(NetworkConnection& connection)
+{
+    std::lock_guard<std::mutex> lock(_clientsMutex);
+    auto it = std::find_if(_clients.begin(), _clients.end(), [&connection](const auto& client) {
+        return client.second.Connection == &connection;
+    });
+    if (it == _clients.end())
+        return;
+
+    if (!it->second.Closed)
+    {
+        _poller->Remove(*connection.Socket);
+    }
+    _clients.erase(it);
+}
+
+void NetworkIoThread::Flush()
+{
+    _flushRequested = true;
+    _poller->Wake();
+}
+
+void NetworkIoThread::Run()
+{
+    std::array<SocketPollEvent, MaxEventsPerWait> events;
+    while (!_stop)
+    {
+        auto count = _poller->Wait(events.data(), events.size(), WaitTimeoutMs);
+
+        std::lock_guard<std::mutex> lock(_clientsMutex);
+        for (size_t i = 0; i < count; i++)
+        {
+            const auto& ev = events[i];
+            if (ev.UserData == nullptr)
+            {
+                AcceptClients();
+                continue;
+            }
+
+            auto it = _clients.find(reinterpret_cast<uintptr_t>(ev.UserData));
+            if (it == _clients.end())
+                continue;
+
+            auto& client = it->second;
+            if (ev.Readable && !client.Closed && !client.Connection->ReadPackets())
+            {
+                // Stop polling the closed socket, the game thread disconnects the client once it takes the last packet.
+                client.Closed = true;
+                _poller->Remove(*client.Connection->Socket);
+            }
+        }
+
+        const auto flush = _flushRequested.exchange(false);
+        for (auto& [id, client] : _clients)
+        {
+            UpdateClient(id, client, flush);
+        }
+    }
+}
+
+void NetworkIoThread::AcceptClients()
+{
+    while (auto socket = _listenSocket.Accept())
+    {
+        _acceptedSockets.push(std::move(socket));
+    }
+}
+
+void NetworkIoThread::UpdateClient(uintptr_t id, Client& client, bool flush)
+{
+    if (client.Closed)
+        return;
+
+    // Between flushes only packets left over from the last flush are sent.
+    auto& connection = *client.Connection;
+    if (flush || client.Writing)
+    {
+        try
+        {
+            connection.SendQueuedPackets();
+        }
+        catch (const std::exception& ex)
+        {
+            log_verbose("Unable to send to %s: %s", connection.Socket->GetHostName(), ex.what());
+        }
+    }
+
+    // Only wait for the socket to be writable while packets are left over, and stop reading while the game thread has
+    // not caught up with the packets read so far.
+    auto reading = !connection.IsReceiveQueueFull();
+    auto writing = connection.HasQueuedPackets();
+    if (reading != client.Reading || writing != client.Writing)
+    {
+        _poller->SetInterest(*connection.Socket, GetUserData(id), reading, writing);
+        client.Reading = reading;
+        client.Writing = writing;
+    }
+}
+
+#endif // DISABLE_NETWORK
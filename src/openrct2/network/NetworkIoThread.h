@@ -0,0 +1,82 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifndef DISABLE_NETWORK
+
+#    include "../common.h"
+#    include "../core/SpscQueue.h"
+#    include "Socket.h"
+
+#    include <atomic>
+#    include <memory>
+#    include <mutex>
+#    include <thread>
+#    include <unordered_map>
+
+class NetworkConnection;
+
+/**
+ * Accepts clients, reads their packets and sends the packets queued for them on a thread of its own, so clients that
+ * have nothing to send cost the game thread nothing. The packets are still processed on the game thread, which takes
+ * them with NetworkConnection::ReceivePacket.
+ */
+class NetworkIoThread final
+{
+public:
+    /**
+     * Returns nullptr when the platform has no socket poller.
+     */
+    [[nodiscard]] static std::unique_ptr<NetworkIoThread> Create(ITcpSocket& listenSocket);
+
+    NetworkIoThread(std::unique_ptr<ISocketPoller>&& poller, ITcpSocket& listenSocket);
+    ~NetworkIoThread();
+
+    [[nodiscard]] std::unique_ptr<ITcpSocket> Accept();
+    void AddConnection(NetworkConnection& connection);
+
+    /**
+     * The I/O thread no longer uses the connection once this returns.
+     */
+    void RemoveConnection(NetworkConnection& connection);
+
+    /**
+     * Wakes the I/O thread to send the packets queued since the last flush, so the packets of a tick go out together.
+     */
+    void Flush();
+
+private:
+    struct Client
+    {
+        NetworkConnection* Connection;
+        bool Reading;
+        bool Writing;
+        bool Closed;
+    };
+
+    std::unique_ptr<ISocketPoller> _poller;
+    ITcpSocket& _listenSocket;
+    SpscQueue<std::unique_ptr<ITcpSocket>> _acceptedSockets;
+
+    // Clients are looked up by id rather than pointer, as events for a client can still arrive after it was removed.
+    std::mutex _clientsMutex;
+    std::unordered_map<uintptr_t, Client> _clients;
+    uintptr_t _nextClientId = 1;
+
+    std::atomic<bool> _flushRequested = false;
+    std::atomic<bool> _stop = false;
+    std::thread _thread;
+
+    void Run();
+    void AcceptClients();
+    void UpdateClient(uintptr_t id, Client& client, bool flush);
+};
+
+#endif // DISABLE_NETWORK
@@ -0,0 +1,316 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_NETWORK
+
+#    include "NetworkMapTransfer.h"
+
+#    include "../core/JobPool.h"
+#    include "NetworkPacket.h"
+#    include "zlib.h"
+
+#    include <algorithm>
+#    include <cstring>
+#    include <limits>
+#    include <map>
+
+// Smaller blocks are reused more often after a reconnect, the block size grows for maps too large for the manifest.
+constexpr uint32_t MinBlockSize = 256 * 1024;
+constexpr uint32_t MaxBlockCount = 2048;
+constexpr uint32_t MaxBlockSize = 64 * 1024 * 1024;
+
+// Identifies the snapshots sent by this server, a request names the snapshot whose manifest it answers.
+static uint32_t _lastSnapshotId = 0;
+
+static uint32_t GetNumBlocks(uint32_t size, uint32_t blockSize)
+{
+    return static_cast<uint32_t>((static_cast<uint64_t>(size) + blockSize - 1) / blockSize);
+}
+
+std::shared_ptr<const NetworkMapSnapshot> NetworkMapSnapshot::Create(const std::vector<uint8_t>& data)
+{
+    if (data.empty() || data.size() > std::numeric_limits<uint32_t>::max())
+        return nullptr;
+
+    auto snapshot = std::make_shared<NetworkMapSnapshot>();
+    snapshot->_id = ++_lastSnapshotId;
+    snapshot->_size = static_cast<uint32_t>(data.size());
+    snapshot->_blockSize = std::max(MinBlockSize, GetNumBlocks(snapshot->_size, MaxBlockCount));
+    snapshot->_blocks.resize(GetNumBlocks(snapshot->_size, snapshot->_blockSize));
+
+    std::atomic<bool> failed = false;
+    JobPool jobs;
+    for (uint32_t i = 0; i < snapshot->_blocks.size(); i++)
+    {
+        jobs.AddTask([&data, &snapshot, &failed, i]() {
+            auto& block = snapshot->_blocks[i];
+            const auto* blockData = data.data() + static_cast<size_t>(i) * snapshot->_blockSize;
+            const auto blockSize = std::min<size_t>(snapshot->_blockSize, data.data() + data.size() - blockData);
+            block.Hash = Crypt::SHA1(blockData, blockSize);
+
+            auto compressedSize = compressBound(static_cast<uLong>(blockSize));
+            block.CompressedData.resize(compressedSize);
+            const auto ret = compress2(
+                block.CompressedData.data(), &compressedSize, blockData, static_cast<uLong>(blockSize), Z_DEFAULT_COMPRESSION);
+            if (ret != Z_OK)
+            {
+                failed = true;
+            }
+            block.CompressedData.resize(compressedSize);
+        });
+    }
+    jobs.Join();
+
+    if (failed)
+        return nullptr;
+    return snapshot;
+}
+
+void NetworkMapSnapshot::WriteManifest(NetworkPacket& packet) const
+{
+    packet << _id << _size << _blockSize << static_cast<uint32_t>(_blocks.size());
+    for (const auto& block : _blocks)
+    {
+        packet.Write(block.Hash.data(), block.Hash.size());
+        packet << static_cast<uint32_t>(block.CompressedData.size());
+    }
+}
+
+NetworkMapBlockRequest NetworkMapSnapshot::ReadBlockRequest(NetworkPacket& packet, std::vector<uint32_t>& blocks) const
+{
+    uint32_t id = std::numeric_limits<uint32_t>::max();
+    uint32_t count = std::numeric_limits<uint32_t>::max();
+    packet >> id >> count;
+    if (id < _id)
+        return NetworkMapBlockRequest::Outdated;
+    if (id != _id || count > _blocks.size())
+        return NetworkMapBlockRequest::Invalid;
+
+    blocks.clear();
+    blocks.reserve(count);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint32_t index = std::numeric_limits<uint32_t>::max();
+        packet >> index;
+        if (index >= _blocks.size())
+            return NetworkMapBlockRequest::Invalid;
+        blocks.push_back(index);
+    }
+    return NetworkMapBlockRequest::Valid;
+}
+
+uint32_t NetworkMapSnapshot::GetId() const
+{
+    return _id;
+}
+
+uint32_t NetworkMapSnapshot::GetBlockCount() const
+{
+    return static_cast<uint32_t>(_blocks.size());
+}
+
+const std::vector<uint8_t>& NetworkMapSnapshot::GetCompressedBlock(uint32_t index) const
+{
+    return _blocks[index].CompressedData;
+}
+
+NetworkMapDownload::NetworkMapDownload() = default;
+
+NetworkMapDownload::~NetworkMapDownload()
+{
+    WaitForJobs();
+}
+
+bool NetworkMapDownload::Begin(NetworkPacket& manifest)
+{
+    WaitForJobs();
+
+    uint32_t snapshotId = 0;
+    uint32_t size = 0;
+    uint32_t blockSize = 0;
+    uint32_t blockCount = 0;
+    manifest >> snapshotId >> size >> blockSize >> blockCount;
+    if (size == 0 || blockSize == 0 || blockSize > MaxBlockSize || blockCount > MaxBlockCount
+        || blockCount != GetNumBlocks(size, blockSize))
+    {
+        Reset();
+        return false;
+    }
+
+    // The blocks decompressed so far, a reconnect or a new map usually still has most of them.
+    std::map<NetworkMapBlockHash, const Block*> previousBlocks;
+    for (size_t i = 0; i < _blocks.size(); i++)
+    {
+        if (_blockStates[i] == BlockState::Done)
+        {
+            previousBlocks.emplace(_blocks[i].Hash, &_blocks[i]);
+        }
+    }
+
+    std::vector<Block> blocks(blockCount);
+    auto blockStates = std::make_unique<std::atomic<BlockState>[]>(blockCount);
+    std::vector<uint8_t> data(size);
+    for (uint32_t i = 0; i < blockCount; i++)
+    {
+        auto& block = blocks[i];
+        block.Offset = i * blockSize;
+        block.Size = std::min(blockSize, size - block.Offset);
+
+        const auto* hash = manifest.Read(block.Hash.size());
+        manifest >> block.CompressedSize;
+        if (hash == nullptr || block.CompressedSize == 0 || block.CompressedSize > compressBound(block.Size))
+        {
+            Reset();
+            return false;
+        }
+        std::memcpy(block.Hash.data(), hash, block.Hash.size());
+
+        auto it = previousBlocks.find(block.Hash);
+        if (it != previousBlocks.end() && it->second->Size == block.Size)
+        {
+            std::memcpy(data.data() + block.Offset, _data.data() + it->second->Offset, block.Size);
+            blockStates[i] = BlockState::Done;
+        }
+        else
+        {
+            blockStates[i] = BlockState::Missing;
+        }
+    }
+
+    _snapshotId = snapshotId;
+    _blocks = std::move(blocks);
+    _blockStates = std::move(blockStates);
+    _data = std::move(data);
+    _blocksOutstanding = 0;
+    _bytesReceived = 0;
+    _bytesRequested = 0;
+    return true;
+}
+
+void NetworkMapDownload::WriteBlockRequest(NetworkPacket& packet)
+{
+    std::vector<uint32_t> indices;
+    for (uint32_t i = 0; i < _blocks.size(); i++)
+    {
+        if (_blockStates[i] == BlockState::Missing)
+        {
+            _blockStates[i] = BlockState::Requested;
+            _blocksOutstanding++;
+            _bytesRequested += _blocks[i].CompressedSize;
+            indices.push_back(i);
+        }
+    }
+
+    packet << _snapshotId << static_cast<uint32_t>(indices.size());
+    for (auto index : indices)
+    {
+        packet << index;
+    }
+}
+
+bool NetworkMapDownload::ReceiveBlockData(uint32_t index, uint32_t offset, const uint8_t* data, size_t size)
+{
+    if (index >= _blocks.size() || _blockStates[index] != BlockState::Requested || data == nullptr || size == 0)
+        return false;
+
+    auto& block = _blocks[index];
+    if (offset != block.CompressedData.size() || size > block.CompressedSize - offset)
+        return false;
+
+    if (block.CompressedData.empty())
+    {
+        block.CompressedData.reserve(block.CompressedSize);
+    }
+    block.CompressedData.insert(block.CompressedData.end(), data, data + size);
+    _bytesReceived += static_cast<uint32_t>(size);
+
+    if (block.CompressedData.size() == block.CompressedSize)
+    {
+        if (_jobs == nullptr)
+        {
+            _jobs = std::make_unique<JobPool>();
+        }
+        _blockStates[index] = BlockState::Decompressing;
+        _blocksOutstanding--;
+        _jobs->AddTask([this, index]() { Decompress(index); });
+    }
+    return true;
+}
+
+bool NetworkMapDownload::HasReceivedAll() const
+{
+    return !_blocks.empty() && _blocksOutstanding == 0;
+}
+
+uint32_t NetworkMapDownload::GetBytesReceived() const
+{
+    return _bytesReceived;
+}
+
+uint32_t NetworkMapDownload::GetBytesRequested() const
+{
+    return _bytesRequested;
+}
+
+bool NetworkMapDownload::Finish(std::vector<uint8_t>& data)
+{
+    WaitForJobs();
+
+    bool result = !_blocks.empty();
+    for (size_t i = 0; i < _blocks.size(); i++)
+    {
+        if (_blockStates[i] != BlockState::Done)
+        {
+            _blockStates[i] = BlockState::Missing;
+            result = false;
+        }
+    }
+    if (!result)
+        return false;
+
+    data = std::move(_data);
+    Reset();
+    return true;
+}
+
+void NetworkMapDownload::Reset()
+{
+    WaitForJobs();
+    _blocks.clear();
+    _blockStates.reset();
+    _data.clear();
+    _data.shrink_to_fit();
+    _blocksOutstanding = 0;
+    _bytesReceived = 0;
+    _bytesRequested = 0;
+}
+
+void NetworkMapDownload::WaitForJobs()
+{
+    if (_jobs != nullptr)
+    {
+        _jobs->Join();
+    }
+}
+
+void NetworkMapDownload::Decompress(uint32_t index)
+{
+    // Runs on a worker thread, only this block's compressed data and part of the map are touched.
+    auto& block = _blocks[index];
+    auto* output = _data.data() + block.Offset;
+    uLongf outputSize = block.Size;
+    const auto ret = uncompress(output, &outputSize, block.CompressedData.data(), block.CompressedSize);
+    const auto valid = ret == Z_OK && outputSize == block.Size && Crypt::SHA1(output, block.Size) == block.Hash;
+
+    block.CompressedData.clear();
+    block.CompressedData.shrink_to_fit();
+    _blockStates[index] = valid ? BlockState::Done : BlockState::Corrupt;
+}
+
+#endif // DISABLE_NETWORK
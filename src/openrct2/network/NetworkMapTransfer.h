@@ -0,0 +1,142 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifndef DISABLE_NETWORK
+
+#    include "../common.h"
+#    include "../core/Crypt.h"
+
+#    include <atomic>
+#    include <memory>
+#    include <vector>
+
+class JobPool;
+struct NetworkPacket;
+
+using NetworkMapBlockHash = Crypt::Sha1Algorithm::Result;
+
+enum class NetworkMapBlockRequest : uint8_t
+{
+    Valid,
+    // Made for a snapshot sent before the current one, the client sends another request for the current one.
+    Outdated,
+    Invalid,
+};
+
+/**
+ * A map saved for sending to clients. The map is split into blocks that are compressed on their own and identified by
+ * the hash of their contents, so a client can decompress blocks while the rest are still arriving and keep the blocks
+ * it already has when a download is interrupted.
+ */
+class NetworkMapSnapshot final
+{
+public:
+    /**
+     * Splits and compresses an uncompressed park file, returns nullptr if compressing fails.
+     */
+    static std::shared_ptr<const NetworkMapSnapshot> Create(const std::vector<uint8_t>& data);
+
+    void WriteManifest(NetworkPacket& packet) const;
+
+    /**
+     * Reads the blocks a client requested. A snapshot replaced while the client was downloading, such as when the park
+     * is reloaded, only sees requests for itself as valid.
+     */
+    NetworkMapBlockRequest ReadBlockRequest(NetworkPacket& packet, std::vector<uint32_t>& blocks) const;
+
+    uint32_t GetId() const;
+    uint32_t GetBlockCount() const;
+    const std::vector<uint8_t>& GetCompressedBlock(uint32_t index) const;
+
+private:
+    struct Block
+    {
+        NetworkMapBlockHash Hash{};
+        std::vector<uint8_t> CompressedData;
+    };
+
+    uint32_t _id = 0;
+    uint32_t _size = 0;
+    uint32_t _blockSize = 0;
+    std::vector<Block> _blocks;
+};
+
+/**
+ * The client side of a map transfer. Blocks are decompressed on worker threads as they complete, blocks decompressed
+ * for an earlier download that did not finish are kept and reused when a new manifest lists the same contents.
+ */
+class NetworkMapDownload final
+{
+public:
+    NetworkMapDownload();
+    ~NetworkMapDownload();
+
+    /**
+     * Starts downloading the map the manifest describes, returns false if the manifest is invalid.
+     */
+    bool Begin(NetworkPacket& manifest);
+
+    /**
+     * Requests the blocks that still have to be sent, these are expected to arrive in the order requested.
+     */
+    void WriteBlockRequest(NetworkPacket& packet);
+
+    /**
+     * Adds the next part of a compressed block, returns false if it is not the part expected.
+     */
+    bool ReceiveBlockData(uint32_t index, uint32_t offset, const uint8_t* data, size_t size);
+
+    bool HasReceivedAll() const;
+    uint32_t GetBytesReceived() const;
+    uint32_t GetBytesRequested() const;
+
+    /**
+     * Waits for the remaining blocks to be decompressed and hands out the park file. Returns false if any block turned
+     * out to be corrupt, those are requested again by the next download.
+     */
+    bool Finish(std::vector<uint8_t>& data);
+
+    void Reset();
+
+private:
+    enum class BlockState : uint8_t
+    {
+        Missing,
+        Requested,
+        Decompressing,
+        Done,
+        Corrupt,
+    };
+
+    struct Block
+    {
+        NetworkMapBlockHash Hash{};
+        uint32_t Offset{};
+        uint32_t Size{};
+        uint32_t CompressedSize{};
+        std::vector<uint8_t> CompressedData;
+    };
+
+    uint32_t _snapshotId = 0;
+    std::vector<Block> _blocks;
+    // Written by the worker threads, so kept apart from the blocks.
+    std::unique_ptr<std::atomic<BlockState>[]> _blockStates;
+    std::vector<uint8_t> _data;
+    uint32_t _blocksOutstanding = 0;
+    uint32_t _bytesReceived = 0;
+    uint32_t _bytesRequested = 0;
+    std::unique_ptr<JobPool> _jobs;
+
+    void WaitForJobs();
+    void Decompress(uint32_t index);
+};
+
+#endif // DISABLE_NETWORK
@@ -12,9 +12,13 @@
 #    include "NetworkPacket.h"
 
 #    include "NetworkTypes.h"
+#    include "Socket.h"
 
 #    include <memory>
 
+std::atomic<uint64_t> NetworkPacket::FramedPacketCount = 0;
+std::atomic<uint64_t> NetworkPacket::FramedByteCount = 0;
+
 NetworkPacket::NetworkPacket(NetworkCommand id)
     : Header{ 0, id }
 {
@@ -42,9 +46,14 @@ void NetworkPacket::Clear()
     Data.clear();
 }
 
-bool NetworkPacket::CommandRequiresAuth()
+bool NetworkPacket::CommandRequiresAuth() const
+{
+    return CommandRequiresAuth(GetCommand());
+}
+
+bool NetworkPacket::CommandRequiresAuth(NetworkCommand command)
 {
-    switch (GetCommand())
+    switch (command)
     {
         case NetworkCommand::Ping:
         case NetworkCommand::Auth:
@@ -54,12 +63,36 @@ bool NetworkPacket::CommandRequiresAuth()
         case NetworkCommand::Scripts:
         case NetworkCommand::MapRequest:
         case NetworkCommand::Heartbeat:
+        case NetworkCommand::Batch: // The packets in it are checked on their own.
             return false;
         default:
             return true;
     }
 }
 
+std::shared_ptr<const NetworkFramedPacket> NetworkPacket::Frame() const
+{
+    PacketHeader header{ static_cast<uint16_t>(Data.size()), GetCommand() };
+
+    // NOTE: For compatibility reasons for the master server we need to add sizeof(Header.Id) to the size.
+    // Previously the Id field was not part of the header rather part of the body.
+    header.Size += sizeof(header.Id);
+    header.Size = Convert::HostToNetwork(header.Size);
+    header.Id = ByteSwapBE(header.Id);
+
+    auto result = std::make_shared<NetworkFramedPacket>();
+    result->Command = GetCommand();
+    result->Bytes.reserve(sizeof(header) + Data.size());
+    result->Bytes.insert(
+        result->Bytes.end(), reinterpret_cast<const uint8_t*>(&header),
+        reinterpret_cast<const uint8_t*>(&header) + sizeof(header));
+    result->Bytes.insert(result->Bytes.end(), Data.begin(), Data.end());
+
+    FramedPacketCount++;
+    FramedByteCount += result->Bytes.size();
+    return result;
+}
+
 void NetworkPacket::Write(const void* bytes, size_t size)
 {
     const uint8_t* src = reinterpret_cast<const uint8_t*>(bytes);
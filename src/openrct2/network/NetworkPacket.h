@@ -13,6 +13,7 @@
 #include "../core/DataSerialiser.h"
 #include "NetworkTypes.h"
 
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -25,6 +26,16 @@ struct PacketHeader
 static_assert(sizeof(PacketHeader) == 6);
 #pragma pack(pop)
 
+/**
+ * A packet as it is sent, header included. Framed packets are never changed, so one can be queued on any number of
+ * connections without copying it.
+ */
+struct NetworkFramedPacket final
+{
+    NetworkCommand Command = NetworkCommand::Invalid;
+    std::vector<uint8_t> Bytes;
+};
+
 struct NetworkPacket final
 {
     NetworkPacket() = default;
@@ -36,7 +47,10 @@ struct NetworkPacket final
     NetworkCommand GetCommand() const;
 
     void Clear();
-    bool CommandRequiresAuth();
+    bool CommandRequiresAuth() const;
+    static bool CommandRequiresAuth(NetworkCommand command);
+
+    std::shared_ptr<const NetworkFramedPacket> Frame() const;
 
     const uint8_t* Read(size_t size);
     std::string_view ReadString();
@@ -78,4 +92,8 @@ public:
     std::vector<uint8_t> Data;
     size_t BytesTransferred = 0;
     size_t BytesRead = 0;
+
+    // Number of packets framed and bytes copied to frame them since startup.
+    static std::atomic<uint64_t> FramedPacketCount;
+    static std::atomic<uint64_t> FramedByteCount;
 };
@@ -83,6 +83,9 @@ enum class NetworkCommand : uint32_t
     GameState,
     Scripts,
     Heartbeat,
+    Batch,
+    MapManifest,
+    MapBlockRequest,
     Max,
     Invalid = static_cast<uint32_t>(-1),
 };
@@ -146,4 +149,7 @@ struct NetworkStats_t
 {
     uint64_t bytesReceived[EnumValue(NetworkStatisticsGroup::Max)];
     uint64_t bytesSent[EnumValue(NetworkStatisticsGroup::Max)];
+    // Outgoing packets framed and bytes copied to frame them, a packet sent to several clients is framed once.
+    uint64_t packetsFramed;
+    uint64_t bytesFramed;
 };
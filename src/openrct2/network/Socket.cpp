@@ -9,6 +9,7 @@
 
 #ifndef DISABLE_NETWORK
 
+#    include <algorithm>
 #    include <atomic>
 #    include <chrono>
 #    include <cmath>
@@ -16,6 +17,7 @@
 #    include <future>
 #    include <string>
 #    include <thread>
+#    include <vector>
 
 // clang-format off
 // MSVC: include <math.h> here otherwise PI gets defined twice
@@ -51,7 +53,13 @@
     #include <netinet/tcp.h>
     #include <sys/ioctl.h>
     #include <sys/socket.h>
+    #include <sys/uio.h>
     #include "../common.h"
+    #if defined(__linux__)
+        #include <sys/epoll.h>
+        #include <sys/eventfd.h>
+        #include <unistd.h>
+    #endif // defined(__linux__)
     using SOCKET = int32_t;
     #define SOCKET_ERROR -1
     #define INVALID_SOCKET -1
@@ -70,6 +78,63 @@
 
 constexpr auto CONNECT_TIMEOUT = std::chrono::milliseconds(3000);
 
+// Buffers for sending several ranges of bytes with a single call.
+#    ifdef _WIN32
+using PlatformBuffer = WSABUF;
+
+static PlatformBuffer CreatePlatformBuffer(const SocketBuffer& buffer)
+{
+    return { static_cast<ULONG>(buffer.Size), static_cast<CHAR*>(const_cast<void*>(buffer.Data)) };
+}
+
+static size_t GetPlatformBufferSize(const PlatformBuffer& buffer)
+{
+    return buffer.len;
+}
+
+static void AdvancePlatformBuffer(PlatformBuffer& buffer, size_t length)
+{
+    buffer.buf += length;
+    buffer.len -= static_cast<ULONG>(length);
+}
+
+static int64_t SendPlatformBuffers(SOCKET socket, PlatformBuffer* buffers, size_t count)
+{
+    DWORD sentBytes = 0;
+    if (WSASend(socket, buffers, static_cast<DWORD>(count), &sentBytes, 0, nullptr, nullptr) == SOCKET_ERROR)
+    {
+        return SOCKET_ERROR;
+    }
+    return sentBytes;
+}
+#    else
+using PlatformBuffer = iovec;
+
+static PlatformBuffer CreatePlatformBuffer(const SocketBuffer& buffer)
+{
+    return { const_cast<void*>(buffer.Data), buffer.Size };
+}
+
+static size_t GetPlatformBufferSize(const PlatformBuffer& buffer)
+{
+    return buffer.iov_len;
+}
+
+static void AdvancePlatformBuffer(PlatformBuffer& buffer, size_t length)
+{
+    buffer.iov_base = static_cast<uint8_t*>(buffer.iov_base) + length;
+    buffer.iov_len -= length;
+}
+
+static int64_t SendPlatformBuffers(SOCKET socket, PlatformBuffer* buffers, size_t count)
+{
+    msghdr message{};
+    message.msg_iov = buffers;
+    message.msg_iovlen = count;
+    return sendmsg(socket, &message, FLAG_NO_PIPE);
+}
+#    endif
+
 // RAII WSA initialisation needed for Windows
 #    ifdef _WIN32
 class WSA
@@ -273,6 +338,11 @@ public:
         return _status;
     }
 
+    SOCKET GetSocket() const
+    {
+        return _socket;
+    }
+
     const char* GetError() const override
     {
         return _error.empty() ? nullptr : _error.c_str();
@@ -563,6 +633,50 @@ public:
         return totalSent;
     }
 
+    size_t SendData(const SocketBuffer* buffers, size_t count) override
+    {
+        if (_status != SocketStatus::Connected)
+        {
+            throw std::runtime_error("Socket not connected.");
+        }
+
+        std::vector<PlatformBuffer> remaining;
+        remaining.reserve(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            if (buffers[i].Size > 0)
+            {
+                remaining.push_back(CreatePlatformBuffer(buffers[i]));
+            }
+        }
+
+        size_t totalSent = 0;
+        size_t first = 0;
+        while (first < remaining.size())
+        {
+            auto sentBytes = SendPlatformBuffers(_socket, &remaining[first], remaining.size() - first);
+            if (sentBytes == SOCKET_ERROR || sentBytes == 0)
+            {
+                return totalSent;
+            }
+            totalSent += sentBytes;
+
+            // Move past what has been sent, the first buffer left may have been sent partially.
+            auto sent = static_cast<size_t>(sentBytes);
+            while (sent > 0)
+            {
+                auto length = std::min(sent, GetPlatformBufferSize(remaining[first]));
+                AdvancePlatformBuffer(remaining[first], length);
+                if (GetPlatformBufferSize(remaining[first]) == 0)
+                {
+                    first++;
+                }
+                sent -= length;
+            }
+        }
+        return totalSent;
+    }
+
     NetworkReadPacket ReceiveData(void* buffer, size_t size, size_t* sizeReceived) override
     {
         if (_status != SocketStatus::Connected)
@@ -887,6 +1001,137 @@ std::unique_ptr<IUdpSocket> CreateUdpSocket()
     return std::make_unique<UdpSocket>();
 }
 
+#    if defined(__linux__)
+class EpollSocketPoller final : public ISocketPoller
+{
+private:
+    int32_t _epoll = -1;
+    int32_t _wakeEvent = -1;
+    std::vector<epoll_event> _events;
+
+public:
+    EpollSocketPoller()
+    {
+        _epoll = epoll_create1(EPOLL_CLOEXEC);
+        _wakeEvent = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (_epoll == -1 || _wakeEvent == -1)
+        {
+            Close();
+            throw SocketException("Unable to create epoll instance.");
+        }
+
+        // The wake event is told apart from the sockets by pointing to the poller.
+        epoll_event ev{};
+        ev.events = EPOLLIN;
+        ev.data.ptr = this;
+        if (epoll_ctl(_epoll, EPOLL_CTL_ADD, _wakeEvent, &ev) == -1)
+        {
+            Close();
+            throw SocketException("Unable to watch wake event.");
+        }
+    }
+
+    ~EpollSocketPoller() override
+    {
+        Close();
+    }
+
+    bool Add(ITcpSocket& socket, void* userData) override
+    {
+        epoll_event ev{};
+        ev.events = EPOLLIN;
+        ev.data.ptr = userData;
+        return epoll_ctl(_epoll, EPOLL_CTL_ADD, GetSocket(socket), &ev) == 0;
+    }
+
+    void SetInterest(ITcpSocket& socket, void* userData, bool read, bool write) override
+    {
+        epoll_event ev{};
+        uint32_t events = 0;
+        if (read)
+            events |= EPOLLIN;
+        if (write)
+            events |= EPOLLOUT;
+        ev.events = events;
+        ev.data.ptr = userData;
+        epoll_ctl(_epoll, EPOLL_CTL_MOD, GetSocket(socket), &ev);
+    }
+
+    void Remove(ITcpSocket& socket) override
+    {
+        epoll_ctl(_epoll, EPOLL_CTL_DEL, GetSocket(socket), nullptr);
+    }
+
+    size_t Wait(SocketPollEvent* events, size_t maxEvents, int32_t timeoutMs) override
+    {
+        _events.resize(std::max<size_t>(maxEvents, 1));
+        auto count = epoll_wait(_epoll, _events.data(), static_cast<int32_t>(_events.size()), timeoutMs);
+        if (count <= 0)
+            return 0;
+
+        size_t result = 0;
+        for (int32_t i = 0; i < count; i++)
+        {
+            const auto& ev = _events[i];
+            if (ev.data.ptr == this)
+            {
+                uint64_t value;
+                [[maybe_unused]] auto readBytes = read(_wakeEvent, &value, sizeof(value));
+                continue;
+            }
+
+            // Errors and hang ups are reported as readable, reading is what finds out the socket closed.
+            events[result++] = { ev.data.ptr, (ev.events & (EPOLLIN | EPOLLERR | EPOLLHUP)) != 0,
+                                 (ev.events & EPOLLOUT) != 0 };
+        }
+        return result;
+    }
+
+    void Wake() override
+    {
+        uint64_t value = 1;
+        [[maybe_unused]] auto writtenBytes = write(_wakeEvent, &value, sizeof(value));
+    }
+
+private:
+    static SOCKET GetSocket(ITcpSocket& socket)
+    {
+        return static_cast<TcpSocket&>(socket).GetSocket();
+    }
+
+    void Close()
+    {
+        if (_wakeEvent != -1)
+        {
+            close(_wakeEvent);
+            _wakeEvent = -1;
+        }
+        if (_epoll != -1)
+        {
+            close(_epoll);
+            _epoll = -1;
+        }
+    }
+};
+#    endif // defined(__linux__)
+
+std::unique_ptr<ISocketPoller> CreateSocketPoller()
+{
+#    if defined(__linux__)
+    try
+    {
+        return std::make_unique<EpollSocketPoller>();
+    }
+    catch (const std::exception& ex)
+    {
+        log_error("%s", ex.what());
+        return nullptr;
+    }
+#    else
+    return nullptr;
+#    endif // defined(__linux__)
+}
+
 #    ifdef _WIN32
 static std::vector<INTERFACE_INFO> GetNetworkInterfaces()
 {
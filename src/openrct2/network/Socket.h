@@ -45,6 +45,15 @@ struct INetworkEndpoint
     virtual std::string GetHostname() const abstract;
 };
 
+/**
+ * A range of bytes to send, several of these can be sent with a single call.
+ */
+struct SocketBuffer
+{
+    const void* Data;
+    size_t Size;
+};
+
 /**
  * Represents a TCP socket / connection or listener.
  */
@@ -66,6 +75,7 @@ public:
     virtual void ConnectAsync(const std::string& address, uint16_t port) abstract;
 
     virtual size_t SendData(const void* buffer, size_t size) abstract;
+    virtual size_t SendData(const SocketBuffer* buffers, size_t count) abstract;
     virtual NetworkReadPacket ReceiveData(void* buffer, size_t size, size_t* sizeReceived) abstract;
 
     virtual void SetNoDelay(bool noDelay) abstract;
@@ -98,8 +108,42 @@ public:
     virtual void Close() abstract;
 };
 
+/**
+ * A socket that is ready to be read from or written to, see ISocketPoller.
+ */
+struct SocketPollEvent
+{
+    void* UserData;
+    bool Readable;
+    bool Writable;
+};
+
+/**
+ * Waits on many TCP sockets at once, so only the sockets that are ready have to be read from or written to.
+ */
+struct ISocketPoller
+{
+public:
+    virtual ~ISocketPoller() = default;
+
+    virtual bool Add(ITcpSocket& socket, void* userData) abstract;
+    virtual void SetInterest(ITcpSocket& socket, void* userData, bool read, bool write) abstract;
+    virtual void Remove(ITcpSocket& socket) abstract;
+
+    /**
+     * Waits until any socket is ready, Wake is called or the timeout passes and returns the number of events written.
+     */
+    virtual size_t Wait(SocketPollEvent* events, size_t maxEvents, int32_t timeoutMs) abstract;
+    virtual void Wake() abstract;
+};
+
 [[nodiscard]] std::unique_ptr<ITcpSocket> CreateTcpSocket();
 [[nodiscard]] std::unique_ptr<IUdpSocket> CreateUdpSocket();
+
+/**
+ * Returns nullptr when the platform has no poller, currently only epoll on Linux is supported.
+ */
+[[nodiscard]] std::unique_ptr<ISocketPoller> CreateSocketPoller();
 [[nodiscard]] std::vector<std::unique_ptr<INetworkEndpoint>> GetBroadcastAddresses();
 
 namespace Convert
@@ -13,6 +13,7 @@
 #include "../ParkImporter.h"
 #include "../core/Console.hpp"
 #include "../core/Memory.hpp"
+#include "../localisation/NameCache.h"
 #include "../localisation/StringIds.h"
 #include "../ride/Ride.h"
 #include "../util/Util.h"
@@ -625,6 +626,9 @@ private:
 
     void ResetTypeToRideEntryIndexMap()
     {
+        // Ride names are formatted with the names of their ride objects.
+        OpenRCT2::NameCache::Invalidate();
+
         // Clear all ride objects
         for (auto& v : _rideTypeToObjectMap)
         {
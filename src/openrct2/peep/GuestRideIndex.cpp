@@ -0,0 +1,184 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "GuestRideIndex.h"
+
+#include "../entity/EntityList.h"
+#include "../entity/EntityRegistry.h"
+#include "../entity/Guest.h"
+#include "../ride/Ride.h"
+
+#include <algorithm>
+#include <array>
+
+namespace OpenRCT2::GuestRideIndex
+{
+    // Current ride, ride heading to, favourite ride, four photos and the thoughts.
+    constexpr size_t MaxRideReferences = 7 + PEEP_MAX_THOUGHTS;
+
+    struct RideReferences
+    {
+        std::array<ride_id_t, MaxRideReferences> Rides{};
+        uint8_t Count{};
+        ride_id_t FavouriteRide = RIDE_ID_NULL;
+    };
+
+    static std::array<RideReferences, MAX_ENTITIES> _guestReferences;
+    static std::array<std::vector<uint16_t>, MAX_RIDES> _guestsByRide;
+    static std::array<uint32_t, MAX_RIDES> _favouriteCounts;
+
+    static bool IsIndexed(ride_id_t rideId)
+    {
+        return EnumValue(rideId) < MAX_RIDES;
+    }
+
+    static RideReferences GetReferences(const Guest& guest)
+    {
+        RideReferences result;
+        auto add = [&result](ride_id_t rideId) {
+            if (IsIndexed(rideId))
+            {
+                result.Rides[result.Count++] = rideId;
+            }
+        };
+
+        add(guest.CurrentRide);
+        add(guest.GuestHeadingToRideId);
+        add(guest.FavouriteRide);
+        if (guest.HasItem(ShopItem::Photo))
+            add(guest.Photo1RideRef);
+        if (guest.HasItem(ShopItem::Photo2))
+            add(guest.Photo2RideRef);
+        if (guest.HasItem(ShopItem::Photo3))
+            add(guest.Photo3RideRef);
+        if (guest.HasItem(ShopItem::Photo4))
+            add(guest.Photo4RideRef);
+        for (const auto& thought : guest.Thoughts)
+        {
+            if (thought.type == PeepThoughtType::None)
+                break;
+
+            // Thoughts about shop items are included as well, it does no harm to list a guest for a ride too many.
+            add(thought.rideId);
+        }
+
+        auto end = result.Rides.begin() + result.Count;
+        std::sort(result.Rides.begin(), end);
+        result.Count = static_cast<uint8_t>(std::unique(result.Rides.begin(), end) - result.Rides.begin());
+
+        if (IsIndexed(guest.FavouriteRide))
+        {
+            result.FavouriteRide = guest.FavouriteRide;
+        }
+        return result;
+    }
+
+    static void AddGuest(ride_id_t rideId, uint16_t spriteIndex)
+    {
+        auto& guests = _guestsByRide[EnumValue(rideId)];
+        guests.insert(std::lower_bound(guests.begin(), guests.end(), spriteIndex), spriteIndex);
+    }
+
+    static void RemoveGuest(ride_id_t rideId, uint16_t spriteIndex)
+    {
+        auto& guests = _guestsByRide[EnumValue(rideId)];
+        auto it = std::lower_bound(guests.begin(), guests.end(), spriteIndex);
+        if (it != guests.end() && *it == spriteIndex)
+        {
+            guests.erase(it);
+        }
+    }
+
+    static void SetReferences(uint16_t spriteIndex, const RideReferences& updated)
+    {
+        auto& current = _guestReferences[spriteIndex];
+
+        // Both lists are sorted, walk them together to find the rides that were removed or added.
+        size_t i = 0;
+        size_t j = 0;
+        while (i < current.Count || j < updated.Count)
+        {
+            if (j == updated.Count || (i < current.Count && current.Rides[i] < updated.Rides[j]))
+            {
+                RemoveGuest(current.Rides[i++], spriteIndex);
+            }
+            else if (i == current.Count || updated.Rides[j] < current.Rides[i])
+            {
+                AddGuest(updated.Rides[j++], spriteIndex);
+            }
+            else
+            {
+                i++;
+                j++;
+            }
+        }
+
+        if (current.FavouriteRide != updated.FavouriteRide)
+        {
+            if (current.FavouriteRide != RIDE_ID_NULL)
+                _favouriteCounts[EnumValue(current.FavouriteRide)]--;
+            if (updated.FavouriteRide != RIDE_ID_NULL)
+                _favouriteCounts[EnumValue(updated.FavouriteRide)]++;
+        }
+        current = updated;
+    }
+
+    void Update(const Guest& guest)
+    {
+        SetReferences(guest.sprite_index, GetReferences(guest));
+    }
+
+    void Remove(const Guest& guest)
+    {
+        SetReferences(guest.sprite_index, {});
+    }
+
+    void Clear()
+    {
+        _guestReferences.fill({});
+        for (auto& guests : _guestsByRide)
+        {
+            guests.clear();
+        }
+        _favouriteCounts.fill(0);
+    }
+
+    void Rebuild()
+    {
+        Clear();
+        for (auto* guest : EntityList<Guest>())
+        {
+            Update(*guest);
+        }
+    }
+
+    std::vector<Guest*> GetGuests(ride_id_t rideId)
+    {
+        std::vector<Guest*> result;
+        if (!IsIndexed(rideId))
+            return result;
+
+        const auto& guests = _guestsByRide[EnumValue(rideId)];
+        result.reserve(guests.size());
+        for (auto spriteIndex : guests)
+        {
+            auto* guest = GetEntity<Guest>(spriteIndex);
+            if (guest != nullptr)
+            {
+                result.push_back(guest);
+            }
+        }
+        return result;
+    }
+
+    uint32_t GetFavouriteCount(ride_id_t rideId)
+    {
+        return IsIndexed(rideId) ? _favouriteCounts[EnumValue(rideId)] : 0;
+    }
+} // namespace OpenRCT2::GuestRideIndex
@@ -0,0 +1,40 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "../ride/RideTypes.h"
+
+#include <vector>
+
+struct Guest;
+
+/**
+ * The guests referring to each ride, so ride code can find the guests on, queuing for, heading to or remembering a ride
+ * without scanning every guest. A guest refers to a ride through its current ride, the ride it is heading to, its
+ * favourite ride, its photos and its thoughts.
+ *
+ * Update must be called after changing any of these fields outside of the guest's own update.
+ */
+namespace OpenRCT2::GuestRideIndex
+{
+    void Update(const Guest& guest);
+    void Remove(const Guest& guest);
+    void Clear();
+    void Rebuild();
+
+    /**
+     * Returns the guests referring to the ride in sprite index order. Callers still need to check the field they are
+     * interested in.
+     */
+    std::vector<Guest*> GetGuests(ride_id_t rideId);
+
+    uint32_t GetFavouriteCount(ride_id_t rideId);
+} // namespace OpenRCT2::GuestRideIndex
@@ -0,0 +1,247 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "PeepStats.h"
+
+#include "../Diagnostic.h"
+#include "../core/Guard.hpp"
+#include "../entity/EntityList.h"
+#include "../entity/EntityRegistry.h"
+#include "../entity/Guest.h"
+#include "../entity/Staff.h"
+
+#include <array>
+#include <iterator>
+#include <optional>
+
+namespace OpenRCT2::PeepStats
+{
+    // Thoughts older than this are not counted, matches the checks previously done by each reader.
+    constexpr uint8_t MaxFreshness = 5;
+
+    constexpr uint8_t HappyThreshold = 128;
+    constexpr uint8_t LostCountdownThreshold = 90;
+
+    constexpr PeepThoughtType HeadingThoughts[] = {
+        PeepThoughtType::Hungry,
+        PeepThoughtType::Thirsty,
+        PeepThoughtType::Toilet,
+    };
+
+    /**
+     * What a single peep adds to the totals.
+     */
+    struct Contribution
+    {
+        EntityType Type = EntityType::Null;
+        bool InPark = false;
+        bool Happy = false;
+        bool Lost = false;
+        PeepThoughtType FreshThought = PeepThoughtType::None;
+        ride_id_t HeadingRide = RIDE_ID_NULL;
+        StaffType AssignedStaffType = StaffType::Count;
+
+        bool operator==(const Contribution& other) const
+        {
+            return Type == other.Type && InPark == other.InPark && Happy == other.Happy && Lost == other.Lost
+                && FreshThought == other.FreshThought && HeadingRide == other.HeadingRide
+                && AssignedStaffType == other.AssignedStaffType;
+        }
+        bool operator!=(const Contribution& other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    struct Totals
+    {
+        uint32_t GuestsInPark{};
+        uint32_t HappyGuests{};
+        uint32_t LostGuests{};
+        std::array<uint32_t, 256> FreshThoughts{};
+        std::array<RideCounts, std::size(HeadingThoughts)> FreshThoughtsByHeadingRide;
+        std::array<uint32_t, EnumValue(StaffType::Count)> Staff{};
+    };
+
+    static std::array<Contribution, MAX_ENTITIES> _contributions;
+    static Totals _totals;
+    static const RideCounts _emptyRideCounts;
+
+    static std::optional<size_t> GetHeadingThoughtIndex(PeepThoughtType type)
+    {
+        for (size_t i = 0; i < std::size(HeadingThoughts); i++)
+        {
+            if (HeadingThoughts[i] == type)
+                return i;
+        }
+        return std::nullopt;
+    }
+
+    static Contribution GetContribution(const EntityBase& entity)
+    {
+        Contribution result;
+        if (auto* guest = entity.As<Guest>(); guest != nullptr)
+        {
+            result.Type = EntityType::Guest;
+            if (guest->OutsideOfPark)
+                return result;
+
+            result.InPark = true;
+            result.Happy = guest->Happiness > HappyThreshold;
+            result.Lost = (guest->PeepFlags & PEEP_FLAGS_LEAVING_PARK) && guest->GuestIsLostCountdown < LostCountdownThreshold;
+
+            const auto& thought = std::get<0>(guest->Thoughts);
+            if (thought.freshness <= MaxFreshness && thought.type != PeepThoughtType::None)
+            {
+                result.FreshThought = thought.type;
+                if (GetHeadingThoughtIndex(thought.type).has_value())
+                {
+                    result.HeadingRide = guest->GuestHeadingToRideId;
+                }
+            }
+        }
+        else if (auto* staff = entity.As<Staff>(); staff != nullptr)
+        {
+            result.Type = EntityType::Staff;
+            result.AssignedStaffType = staff->AssignedStaffType;
+        }
+        return result;
+    }
+
+    static void Apply(Totals& totals, const Contribution& contribution, int32_t sign)
+    {
+        if (contribution.Type == EntityType::Staff)
+        {
+            if (contribution.AssignedStaffType < StaffType::Count)
+            {
+                totals.Staff[EnumValue(contribution.AssignedStaffType)] += sign;
+            }
+            return;
+        }
+        if (!contribution.InPark)
+            return;
+
+        totals.GuestsInPark += sign;
+        totals.HappyGuests += contribution.Happy ? sign : 0;
+        totals.LostGuests += contribution.Lost ? sign : 0;
+        if (contribution.FreshThought != PeepThoughtType::None)
+        {
+            totals.FreshThoughts[EnumValue(contribution.FreshThought)] += sign;
+
+            auto headingIndex = GetHeadingThoughtIndex(contribution.FreshThought);
+            if (headingIndex.has_value())
+            {
+                auto& rideCounts = totals.FreshThoughtsByHeadingRide[*headingIndex];
+                auto& count = rideCounts[contribution.HeadingRide];
+                count += sign;
+                if (count == 0)
+                {
+                    rideCounts.erase(contribution.HeadingRide);
+                }
+            }
+        }
+    }
+
+    void Update(const EntityBase& entity)
+    {
+        auto& current = _contributions[entity.sprite_index];
+        auto updated = GetContribution(entity);
+        if (updated != current)
+        {
+            Apply(_totals, current, -1);
+            Apply(_totals, updated, 1);
+            current = updated;
+        }
+    }
+
+    void Remove(const EntityBase& entity)
+    {
+        auto& current = _contributions[entity.sprite_index];
+        Apply(_totals, current, -1);
+        current = {};
+    }
+
+    void Clear()
+    {
+        _contributions.fill({});
+        _totals = {};
+    }
+
+    void Rebuild()
+    {
+        Clear();
+        for (auto* guest : EntityList<Guest>())
+        {
+            Update(*guest);
+        }
+        for (auto* staff : EntityList<Staff>())
+        {
+            Update(*staff);
+        }
+    }
+
+    void Verify()
+    {
+#if defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
+        Totals expected;
+        for (auto* guest : EntityList<Guest>())
+        {
+            Apply(expected, GetContribution(*guest), 1);
+        }
+        for (auto* staff : EntityList<Staff>())
+        {
+            Apply(expected, GetContribution(*staff), 1);
+        }
+
+        Guard::Assert(expected.GuestsInPark == _totals.GuestsInPark, "Guests in park count is out of date");
+        Guard::Assert(expected.HappyGuests == _totals.HappyGuests, "Happy guest count is out of date");
+        Guard::Assert(expected.LostGuests == _totals.LostGuests, "Lost guest count is out of date");
+        Guard::Assert(expected.FreshThoughts == _totals.FreshThoughts, "Guest thought counts are out of date");
+        Guard::Assert(
+            expected.FreshThoughtsByHeadingRide == _totals.FreshThoughtsByHeadingRide,
+            "Guest thought counts by ride are out of date");
+        Guard::Assert(expected.Staff == _totals.Staff, "Staff counts are out of date");
+#endif
+    }
+
+    uint32_t GetGuestsInPark()
+    {
+        return _totals.GuestsInPark;
+    }
+
+    uint32_t GetHappyGuests()
+    {
+        return _totals.HappyGuests;
+    }
+
+    uint32_t GetLostGuests()
+    {
+        return _totals.LostGuests;
+    }
+
+    uint32_t GetFreshThoughtCount(PeepThoughtType type)
+    {
+        return _totals.FreshThoughts[EnumValue(type)];
+    }
+
+    const RideCounts& GetFreshThoughtCountByHeadingRide(PeepThoughtType type)
+    {
+        auto headingIndex = GetHeadingThoughtIndex(type);
+        if (!headingIndex.has_value())
+            return _emptyRideCounts;
+        return _totals.FreshThoughtsByHeadingRide[*headingIndex];
+    }
+
+    uint32_t GetStaffCount(StaffType type)
+    {
+        if (type >= StaffType::Count)
+            return 0;
+        return _totals.Staff[EnumValue(type)];
+    }
+} // namespace OpenRCT2::PeepStats
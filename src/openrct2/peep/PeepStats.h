@@ -0,0 +1,50 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "../ride/RideTypes.h"
+
+#include <unordered_map>
+
+struct EntityBase;
+enum class PeepThoughtType : uint8_t;
+enum class StaffType : uint8_t;
+
+/**
+ * Park wide guest and staff counts used by the park rating, awards, guest warnings and wages. Each peep adds its share
+ * to the totals and only the difference is applied when it changes, so reading a total does not scan every peep.
+ *
+ * Update must be called after changing any field the totals depend on, outside of the peep's own update. Debug builds
+ * check the totals against a full scan whenever they are verified.
+ */
+namespace OpenRCT2::PeepStats
+{
+    using RideCounts = std::unordered_map<ride_id_t, uint32_t>;
+
+    void Update(const EntityBase& entity);
+    void Remove(const EntityBase& entity);
+    void Clear();
+    void Rebuild();
+    void Verify();
+
+    // Guests that are inside the park.
+    uint32_t GetGuestsInPark();
+    uint32_t GetHappyGuests();
+    uint32_t GetLostGuests();
+
+    // Guests inside the park whose most recent thought is of the given type and still fresh.
+    uint32_t GetFreshThoughtCount(PeepThoughtType type);
+
+    // As above, split by the ride the guests are heading to. Only kept for hungry, thirsty and toilet thoughts.
+    const RideCounts& GetFreshThoughtCountByHeadingRide(PeepThoughtType type);
+
+    uint32_t GetStaffCount(StaffType type);
+} // namespace OpenRCT2::PeepStats
@@ -0,0 +1,180 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "MechanicDispatch.h"
+
+#include "../entity/Staff.h"
+#include "../world/Map.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <utility>
+
+namespace OpenRCT2::MechanicDispatch
+{
+    constexpr size_t TileIndexCount = MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL;
+
+    // Search that last visited each tile, so the tiles do not have to be cleared before every search.
+    static std::vector<uint16_t> _tileVisitedBySearch;
+    static uint16_t _currentSearch;
+
+    struct FootpathTile
+    {
+        bool HasPath;
+        uint8_t Edges;
+    };
+
+    static uint32_t GetTileIndex(const TileCoordsXY& tile)
+    {
+        return (tile.y * MAXIMUM_MAP_SIZE_TECHNICAL) + tile.x;
+    }
+
+    static void BeginSearch()
+    {
+        if (_tileVisitedBySearch.empty())
+        {
+            _tileVisitedBySearch.resize(TileIndexCount);
+        }
+
+        _currentSearch++;
+        if (_currentSearch == 0)
+        {
+            std::fill(_tileVisitedBySearch.begin(), _tileVisitedBySearch.end(), 0);
+            _currentSearch = 1;
+        }
+    }
+
+    static bool Visit(const TileCoordsXY& tile)
+    {
+        auto& visitedBy = _tileVisitedBySearch[GetTileIndex(tile)];
+        if (visitedBy == _currentSearch)
+            return false;
+
+        visitedBy = _currentSearch;
+        return true;
+    }
+
+    /**
+     * Heights are ignored, a tile connects in every direction any of its footpaths connects in. Mechanics do not walk
+     * along queues, so those are skipped.
+     */
+    static FootpathTile GetFootpathTile(const TileCoordsXY& tile)
+    {
+        FootpathTile result{};
+        TileElement* tileElement = map_get_first_element_at(tile.ToCoordsXY());
+        if (tileElement == nullptr)
+            return result;
+
+        do
+        {
+            if (tileElement->GetType() != TileElementType::Path)
+                continue;
+
+            auto* pathElement = tileElement->AsPath();
+            if (pathElement->IsQueue())
+                continue;
+
+            result.HasPath = true;
+            result.Edges |= pathElement->GetEdges();
+        } while (!(tileElement++)->IsLastForTile());
+        return result;
+    }
+
+    static Staff* FindNearestMechanicByDistance(const CoordsXY& loc, const std::vector<Staff*>& candidates)
+    {
+        Staff* result = nullptr;
+        uint32_t closestDistance = std::numeric_limits<uint32_t>::max();
+        for (auto* staff : candidates)
+        {
+            // Manhattan distance
+            auto distance = static_cast<uint32_t>(std::abs(staff->x - loc.x) + std::abs(staff->y - loc.y));
+            if (result == nullptr || distance < closestDistance
+                || (distance == closestDistance && staff->sprite_index < result->sprite_index))
+            {
+                closestDistance = distance;
+                result = staff;
+            }
+        }
+        return result;
+    }
+
+    Staff* FindNearestMechanic(const CoordsXY& loc, const std::vector<Staff*>& candidates)
+    {
+        if (candidates.size() <= 1)
+            return candidates.empty() ? nullptr : candidates.front();
+
+        // The tile each candidate is on, sorted so candidates can be looked up by tile.
+        std::vector<std::pair<uint32_t, Staff*>> candidateTiles;
+        candidateTiles.reserve(candidates.size());
+        for (auto* staff : candidates)
+        {
+            if (map_is_location_valid({ staff->x, staff->y }))
+            {
+                candidateTiles.emplace_back(GetTileIndex(TileCoordsXY(CoordsXY{ staff->x, staff->y })), staff);
+            }
+        }
+        std::sort(candidateTiles.begin(), candidateTiles.end(), [](const auto& a, const auto& b) {
+            return a.first < b.first || (a.first == b.first && a.second->sprite_index < b.second->sprite_index);
+        });
+
+        // Breadth first search along the footpaths from loc, one tile further each step. The first step that reaches any
+        // candidate decides, so the whole network is only searched when no candidate is connected to loc.
+        BeginSearch();
+        const auto startTile = TileCoordsXY(loc);
+        std::vector<TileCoordsXY> currentStep{ startTile };
+        std::vector<TileCoordsXY> nextStep;
+        Visit(startTile);
+
+        Staff* result = nullptr;
+        while (!currentStep.empty() && result == nullptr)
+        {
+            for (const auto& tile : currentStep)
+            {
+                auto tileIndex = GetTileIndex(tile);
+                auto it = std::lower_bound(
+                    candidateTiles.begin(), candidateTiles.end(), tileIndex,
+                    [](const auto& candidate, uint32_t index) { return candidate.first < index; });
+                if (it != candidateTiles.end() && it->first == tileIndex)
+                {
+                    if (result == nullptr || it->second->sprite_index < result->sprite_index)
+                    {
+                        result = it->second;
+                    }
+                }
+                if (result != nullptr)
+                    continue;
+
+                // The station exit or entrance is not a footpath, but any footpath next to it leads to it.
+                const auto edges = tile == startTile ? 0b1111 : GetFootpathTile(tile).Edges;
+                for (Direction direction : ALL_DIRECTIONS)
+                {
+                    if (!(edges & (1 << direction)))
+                        continue;
+
+                    const auto neighbour = tile + TileDirectionDelta[direction];
+                    if (!map_is_location_valid(neighbour.ToCoordsXY()) || !Visit(neighbour))
+                        continue;
+
+                    if (GetFootpathTile(neighbour).HasPath)
+                    {
+                        nextStep.push_back(neighbour);
+                    }
+                }
+            }
+            std::swap(currentStep, nextStep);
+            nextStep.clear();
+        }
+
+        if (result != nullptr)
+            return result;
+
+        return FindNearestMechanicByDistance(loc, candidates);
+    }
+} // namespace OpenRCT2::MechanicDispatch
@@ -0,0 +1,27 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "../world/Location.hpp"
+
+#include <vector>
+
+struct Staff;
+
+namespace OpenRCT2::MechanicDispatch
+{
+    /**
+     * Returns the mechanic out of candidates with the shortest walk along the footpath network to the station exit or
+     * entrance at loc. Mechanics that can not reach loc along footpaths are only picked when none can, by the smallest
+     * manhattan distance. Ties go to the lowest sprite index.
+     */
+    Staff* FindNearestMechanic(const CoordsXY& loc, const std::vector<Staff*>& candidates);
+} // namespace OpenRCT2::MechanicDispatch
@@ -31,6 +31,7 @@
 #include "../interface/Window.h"
 #include "../localisation/Date.h"
 #include "../localisation/Localisation.h"
+#include "../localisation/NameCache.h"
 #include "../management/Finance.h"
 #include "../management/Marketing.h"
 #include "../management/NewsItem.h"
@@ -41,6 +42,7 @@
 #include "../object/RideObject.h"
 #include "../object/StationObject.h"
 #include "../paint/VirtualFloor.h"
+#include "../peep/GuestRideIndex.h"
 #include "../rct1/RCT1.h"
 #include "../scenario/Scenario.h"
 #include "../ui/UiContext.h"
@@ -58,6 +60,7 @@
 #include "../world/Scenery.h"
 #include "../world/TileElementsView.h"
 #include "CableLift.h"
+#include "MechanicDispatch.h"
 #include "RideAudio.h"
 #include "RideData.h"
 #include "RideEntry.h"
@@ -323,18 +326,11 @@ void Ride::QueueInsertGuestAtFront(StationIndex stationIndex, Guest* peep)
 void ride_update_favourited_stat()
 {
     for (auto& ride : GetRideManager())
-        ride.guests_favourite = 0;
-
-    for (auto peep : EntityList<Guest>())
     {
-        if (peep->FavouriteRide != RIDE_ID_NULL)
+        ride.guests_favourite = static_cast<uint16_t>(GuestRideIndex::GetFavouriteCount(ride.id));
+        if (ride.guests_favourite != 0)
         {
-            auto ride = get_ride(peep->FavouriteRide);
-            if (ride != nullptr)
-            {
-                ride->guests_favourite++;
-                ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_CUSTOMER;
-            }
+            ride.window_invalidate_flags |= RIDE_INVALIDATE_RIDE_CUSTOMER;
         }
     }
 
@@ -1686,12 +1682,13 @@ Staff* ride_find_closest_mechanic(Ride* ride, int32_t forInspection)
  */
 Staff* find_closest_mechanic(const CoordsXY& entrancePosition, int32_t forInspection)
 {
-    Staff* closestMechanic = nullptr;
-    uint32_t closestDistance = std::numeric_limits<uint32_t>::max();
+    auto location = entrancePosition.ToTileStart();
+    bool checkPatrol = map_is_location_in_park(location);
 
+    std::vector<Staff*> candidates;
     for (auto peep : EntityList<Staff>())
     {
-        if (!peep->IsMechanic())
+        if (!peep->IsMechanic() || peep->x == LOCATION_NULL)
             continue;
 
         if (!forInspection)
@@ -1713,24 +1710,13 @@ Staff* find_closest_mechanic(const CoordsXY& entrancePosition, int32_t forInspec
                 continue;
         }
 
-        auto location = entrancePosition.ToTileStart();
-        if (map_is_location_in_park(location))
-            if (!peep->IsLocationInPatrol(location))
-                continue;
-
-        if (peep->x == LOCATION_NULL)
+        if (checkPatrol && !peep->IsLocationInPatrol(location))
             continue;
 
-        // Manhattan distance
-        uint32_t distance = std::abs(peep->x - entrancePosition.x) + std::abs(peep->y - entrancePosition.y);
-        if (distance < closestDistance)
-        {
-            closestDistance = distance;
-            closestMechanic = peep;
-        }
+        candidates.push_back(peep);
     }
 
-    return closestMechanic;
+    return MechanicDispatch::FindNearestMechanic(entrancePosition, candidates);
 }
 
 Staff* ride_get_mechanic(Ride* ride)
@@ -4156,7 +4142,7 @@ void ride_get_start_of_track(CoordsXYE* output)
  */
 void Ride::StopGuestsQueuing()
 {
-    for (auto peep : EntityList<Guest>())
+    for (auto peep : GuestRideIndex::GetGuests(id))
     {
         if (peep->State != PeepState::Queuing)
             continue;
@@ -4193,15 +4179,12 @@ static bool ride_with_colour_config_exists(uint8_t ride_type, const TrackColour*
 
 bool Ride::NameExists(std::string_view name, ride_id_t excludeRideId)
 {
-    char buffer[256]{};
-    for (auto& ride : GetRideManager())
+    for (auto rideId : NameCache::FindRidesNamed(name))
     {
-        if (ride.id != excludeRideId)
+        if (rideId != excludeRideId)
         {
-            Formatter ft;
-            ride.FormatNameTo(ft);
-            format_string(buffer, 256, STR_STRINGID, ft.Data());
-            if (name == buffer && ride_has_any_track_elements(&ride))
+            auto ride = get_ride(rideId);
+            if (ride != nullptr && ride_has_any_track_elements(ride))
             {
                 return true;
             }
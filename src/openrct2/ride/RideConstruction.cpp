@@ -23,6 +23,8 @@
 #include "../localisation/Localisation.h"
 #include "../network/network.h"
 #include "../paint/VirtualFloor.h"
+#include "../peep/GuestRideIndex.h"
+#include "../peep/PeepStats.h"
 #include "../ui/UiContext.h"
 #include "../ui/WindowManager.h"
 #include "../util/Util.h"
@@ -275,7 +277,7 @@ void Ride::RemovePeeps()
     }
 
     // Place all the guests at exit
-    for (auto peep : EntityList<Guest>())
+    for (auto peep : GuestRideIndex::GetGuests(id))
     {
         if (peep->State == PeepState::QueuingFront || peep->State == PeepState::EnteringRide
             || peep->State == PeepState::LeavingRide || peep->State == PeepState::OnRide)
@@ -307,6 +309,7 @@ void Ride::RemovePeeps()
             peep->Happiness = std::min(peep->Happiness, peep->HappinessTarget) / 2;
             peep->HappinessTarget = peep->Happiness;
             peep->WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_STATS;
+            OpenRCT2::PeepStats::Update(*peep);
         }
     }
     // Place all the staff at exit
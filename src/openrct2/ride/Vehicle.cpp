@@ -49,6 +49,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <vector>
 
 using namespace OpenRCT2::TrackMetaData;
 static bool vehicle_boat_is_location_accessible(const CoordsXYZ& location);
@@ -72,6 +73,9 @@ uint8_t _vehicleF64E2C;
 Vehicle* _vehicleFrontVehicle;
 CoordsXYZ unk_F64E20;
 
+// Cars of the train being moved, front to back. Reused between updates to avoid allocating.
+static std::vector<Vehicle*> _vehicleTrainCars;
+
 static constexpr const OpenRCT2::Audio::SoundId byte_9A3A14[] = {
     OpenRCT2::Audio::SoundId::Scream8,
     OpenRCT2::Audio::SoundId::Scream1,
@@ -586,72 +590,18 @@ static void InvokeVehicleCrashHook(const uint16_t vehicleId, const std::string_v
 }
 #endif
 
-static bool vehicle_move_info_valid(
-    VehicleTrackSubposition trackSubposition, track_type_t type, uint8_t direction, int32_t offset)
-{
-    uint16_t typeAndDirection = (type << 2) | (direction & 3);
-
-    if (trackSubposition >= VehicleTrackSubposition{ std::size(gTrackVehicleInfo) })
-    {
-        return false;
-    }
-    int32_t size = 0;
-    switch (trackSubposition)
-    {
-        case VehicleTrackSubposition::Default:
-            size = VehicleTrackSubpositionSizeDefault;
-            break;
-        case VehicleTrackSubposition::ChairliftGoingOut:
-            size = 692;
-            break;
-        case VehicleTrackSubposition::ChairliftGoingBack:
-        case VehicleTrackSubposition::ChairliftEndBullwheel:
-        case VehicleTrackSubposition::ChairliftStartBullwheel:
-            size = 404;
-            break;
-        case VehicleTrackSubposition::GoKartsLeftLane:
-        case VehicleTrackSubposition::GoKartsRightLane:
-        case VehicleTrackSubposition::GoKartsMovingToRightLane:
-        case VehicleTrackSubposition::GoKartsMovingToLeftLane:
-            size = 208;
-            break;
-        case VehicleTrackSubposition::MiniGolfPathA9: // VehicleTrackSubposition::MiniGolfStart9
-        case VehicleTrackSubposition::MiniGolfBallPathA10:
-        case VehicleTrackSubposition::MiniGolfPathB11:
-        case VehicleTrackSubposition::MiniGolfBallPathB12:
-        case VehicleTrackSubposition::MiniGolfPathC13:
-        case VehicleTrackSubposition::MiniGolfBallPathC14:
-            size = 824;
-            break;
-        case VehicleTrackSubposition::ReverserRCFrontBogie:
-        case VehicleTrackSubposition::ReverserRCRearBogie:
-            size = 868;
-            break;
-        default:
-            break;
-    }
-    if (typeAndDirection >= size)
-    {
-        return false;
-    }
-    if (offset >= gTrackVehicleInfo[static_cast<uint8_t>(trackSubposition)][typeAndDirection]->size)
-    {
-        return false;
-    }
-    return true;
-}
-
 static const rct_vehicle_info* vehicle_get_move_info(
     VehicleTrackSubposition trackSubposition, track_type_t type, uint8_t direction, int32_t offset)
 {
     uint16_t typeAndDirection = (type << 2) | (direction & 3);
 
-    if (!vehicle_move_info_valid(trackSubposition, type, direction, offset))
+    auto list = GetVehicleSubpositionList(trackSubposition, typeAndDirection);
+    if (offset >= list.size)
     {
         static constexpr const rct_vehicle_info zero = {};
         return &zero;
     }
-    return &gTrackVehicleInfo[static_cast<uint8_t>(trackSubposition)][typeAndDirection]->info[offset];
+    return &list.info[offset];
 }
 
 const rct_vehicle_info* Vehicle::GetMoveInfo() const
@@ -663,11 +613,7 @@ static uint16_t vehicle_get_move_info_size(VehicleTrackSubposition trackSubposit
 {
     uint16_t typeAndDirection = (type << 2) | (direction & 3);
 
-    if (!vehicle_move_info_valid(trackSubposition, type, direction, 0))
-    {
-        return 0;
-    }
-    return gTrackVehicleInfo[static_cast<uint8_t>(trackSubposition)][typeAndDirection]->size;
+    return GetVehicleSubpositionList(trackSubposition, typeAndDirection).size;
 }
 
 uint16_t Vehicle::GetTrackProgress() const
@@ -9359,23 +9305,21 @@ int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
     CheckAndApplyBlockSectionStopSite();
     UpdateVelocity();
 
-    Vehicle* vehicle = this;
-    if (_vehicleVelocityF64E08 < 0)
+    // Look up the cars once, they are needed again for the mass and acceleration of the whole train.
+    auto& cars = _vehicleTrainCars;
+    cars.clear();
+    for (Vehicle* car = this; car != nullptr; car = GetEntity<Vehicle>(car->next_vehicle_on_train))
     {
-        vehicle = vehicle->TrainTail();
+        cars.push_back(car);
     }
-    // This will be the front vehicle even when traveling
-    // backwards.
-    _vehicleFrontVehicle = vehicle;
 
-    uint16_t spriteId = vehicle->sprite_index;
-    while (spriteId != SPRITE_INDEX_NULL)
+    // Cars are moved starting from the front in the direction of travel, which is the tail when traveling backwards.
+    const bool isTravelingBackwards = _vehicleVelocityF64E08 < 0;
+    _vehicleFrontVehicle = isTravelingBackwards ? cars.back() : this;
+
+    for (size_t carIndex = 0; carIndex < cars.size(); carIndex++)
     {
-        Vehicle* car = GetEntity<Vehicle>(spriteId);
-        if (car == nullptr)
-        {
-            break;
-        }
+        Vehicle* car = isTravelingBackwards ? cars[cars.size() - 1 - carIndex] : cars[carIndex];
         vehicleEntry = car->Entry();
         if (vehicleEntry == nullptr)
         {
@@ -9465,21 +9409,9 @@ int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
                 *outStation = _vehicleStationIndex;
             return _vehicleMotionTrackFlags;
         }
-        if (_vehicleVelocityF64E08 >= 0)
-        {
-            spriteId = car->next_vehicle_on_train;
-        }
-        else
-        {
-            if (car == gCurrentVehicle)
-            {
-                break;
-            }
-            spriteId = car->prev_vehicle_on_ride;
-        }
     }
     // loc_6DC144
-    vehicle = gCurrentVehicle;
+    Vehicle* vehicle = gCurrentVehicle;
 
     vehicleEntry = vehicle->Entry();
     // eax
@@ -9489,14 +9421,13 @@ int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
     // ebx
     int32_t numVehicles = 0;
 
-    for (; vehicle != nullptr; vehicle = GetEntity<Vehicle>(vehicle->next_vehicle_on_train))
+    for (const auto* car : cars)
     {
         numVehicles++;
-        totalMass += vehicle->mass;
-        totalAcceleration += vehicle->acceleration;
+        totalMass += car->mass;
+        totalAcceleration += car->acceleration;
     }
 
-    vehicle = gCurrentVehicle;
     int32_t newAcceleration = (totalAcceleration / numVehicles) * 21;
     if (newAcceleration < 0)
     {
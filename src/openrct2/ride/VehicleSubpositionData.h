@@ -49,4 +49,14 @@ struct rct_vehicle_info_list
     const rct_vehicle_info* info;
 };
 
-extern const rct_vehicle_info_list* const* const gTrackVehicleInfo[EnumValue(VehicleTrackSubposition::Count)];
+/**
+ * Gets the positions a vehicle moves through on a track piece. Returns an empty list for an invalid subposition, track
+ * type or direction.
+ */
+rct_vehicle_info_list GetVehicleSubpositionList(VehicleTrackSubposition trackSubposition, uint16_t typeAndDirection);
+
+/**
+ * Size in bytes of the packed subposition data built into the game and of the table it is decoded into at startup.
+ */
+size_t GetVehicleSubpositionPackedSize();
+size_t GetVehicleSubpositionDecodedSize();
@@ -0,0 +1,6376 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+// Generated by scripts/pack-vehicle-subpositions.py from VehicleSubpositionData.inc, do not edit.
+
+#pragma once
+
+#include <cstdint>
+
+// clang-format off
+
+// Number of track type and direction combinations for each VehicleTrackSubposition.
+static constexpr const uint16_t PackedVehicleSubpositionSizes[] = {
+    1068, 692, 404, 404, 404, 208, 208, 208, 208, 824, 824, 824, 824, 824, 824, 868, 868,
+};
+
+// Index of the position list for each subposition, track type and direction.
+static constexpr const uint16_t PackedVehicleSubpositionListIds[] = {
+    0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+    12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+    36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59,
+    60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83,
+    84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107,
+    108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131,
+    132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155,
+    156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179,
+    180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203,
+    204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227,
+    228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251,
+    252, 253, 254, 255, 256, 257, 258, 259, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+    40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 140, 141, 142, 143,
+    144, 145, 146, 147, 156, 157, 158, 159, 160, 161, 162, 163, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271,
+    272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295,
+    296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 0, 1, 2, 3, 0, 1, 2, 3, 308, 308, 308, 308,
+    309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332,
+    333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 0, 1, 2, 3, 349, 350, 351, 352,
+    0, 1, 2, 3, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372,
+    0, 1, 2, 3, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392,
+    393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416,
+    244, 245, 246, 247, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436,
+    437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460,
+    461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484,
+    485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508,
+    509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532,
+    533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556,
+    557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 0, 1, 2, 3,
+    577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 600,
+    601, 602, 603, 604, 605, 606, 607, 608, 4, 5, 6, 7, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620,
+    621, 622, 623, 624, 196, 197, 198, 199, 200, 201, 202, 203, 625, 626, 627, 628, 629, 630, 631, 632, 212, 213, 214, 215,
+    633, 634, 635, 636, 220, 221, 222, 223, 224, 225, 226, 227, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647, 648,
+    649, 650, 651, 652, 653, 654, 655, 656, 657, 658, 659, 660, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673, 674, 675, 676,
+    677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700,
+    0, 1, 2, 3, 701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719, 720,
+    721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735, 736, 737, 738, 739, 740, 741, 742, 743, 744,
+    745, 746, 747, 748, 749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767, 768,
+    769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792,
+    793, 794, 795, 796, 797, 798, 799, 800, 801, 802, 803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 813, 814, 815, 816,
+    817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 840,
+    841, 842, 843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 0, 1, 2, 3, 0, 1, 2, 3,
+    0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3,
+    0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 857, 858, 859, 860, 857, 858, 859, 860, 857, 858, 859, 860,
+    857, 858, 859, 860, 861, 862, 863, 864, 8, 9, 10, 11, 865, 866, 867, 868, 16, 17, 18, 19, 20, 21, 22, 23,
+    869, 870, 871, 872, 873, 874, 875, 876, 32, 33, 34, 35, 877, 878, 879, 880, 40, 41, 42, 43, 44, 45, 46, 47,
+    881, 882, 883, 884, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+    72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+    120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167,
+    168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 885, 886, 887, 888,
+    889, 890, 891, 892, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215,
+    216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 0, 1, 2, 3,
+    4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+    28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+    52, 53, 54, 55, 56, 57, 58, 59, 140, 141, 142, 143, 144, 145, 146, 147, 156, 157, 158, 159, 160, 161, 162, 163,
+    260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283,
+    284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307,
+    857, 858, 859, 860, 857, 858, 859, 860, 308, 308, 308, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320,
+    321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344,
+    345, 346, 347, 348, 0, 1, 2, 3, 349, 350, 351, 352, 0, 1, 2, 3, 353, 354, 355, 356, 357, 358, 359, 360,
+    361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 0, 1, 2, 3, 373, 374, 375, 376, 377, 378, 379, 380,
+    381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404,
+    405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 244, 245, 246, 247, 417, 418, 419, 420, 421, 422, 423, 424,
+    425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448,
+    449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472,
+    473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496,
+    497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520,
+    521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544,
+    545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568,
+    569, 570, 571, 572, 573, 574, 575, 576, 859, 860, 857, 858, 859, 860, 857, 858, 859, 860, 857, 858, 859, 860, 857, 858,
+    875, 876, 873, 874, 8, 9, 10, 11, 883, 884, 881, 882, 16, 17, 18, 19, 20, 21, 22, 23, 879, 880, 877, 878,
+    863, 864, 861, 862, 32, 33, 34, 35, 871, 872, 869, 870, 40, 41, 42, 43, 44, 45, 46, 47, 867, 868, 865, 866,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75,
+    76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99,
+    100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123,
+    124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147,
+    148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171,
+    172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 890, 891, 892, 889, 888, 885, 886, 887,
+    196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219,
+    220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243,
+    244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 0, 1, 2, 3, 4, 5, 6, 7,
+    8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+    56, 57, 58, 59, 140, 141, 142, 143, 144, 145, 146, 147, 156, 157, 158, 159, 160, 161, 162, 163, 260, 261, 262, 263,
+    264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287,
+    288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 859, 860, 857, 858,
+    859, 860, 857, 858, 893, 894, 895, 896, 893, 894, 895, 896, 893, 894, 895, 896, 893, 894, 895, 896, 4, 5, 6, 7,
+    8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+    56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+    104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151,
+    152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199,
+    200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247,
+    248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+    12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+    36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59,
+    140, 141, 142, 143, 144, 145, 146, 147, 156, 157, 158, 159, 160, 161, 162, 163, 260, 261, 262, 263, 264, 265, 266, 267,
+    268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291,
+    292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 893, 894, 895, 896, 893, 894, 895, 896,
+    895, 896, 893, 894, 895, 896, 893, 894, 895, 896, 893, 894, 895, 896, 893, 894, 4, 5, 6, 7, 8, 9, 10, 11,
+    12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+    36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59,
+    60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83,
+    84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107,
+    108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131,
+    132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155,
+    156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179,
+    180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203,
+    204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227,
+    228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251,
+    252, 253, 254, 255, 256, 257, 258, 259, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+    40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 140, 141, 142, 143,
+    144, 145, 146, 147, 156, 157, 158, 159, 160, 161, 162, 163, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271,
+    272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295,
+    296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 895, 896, 893, 894, 895, 896, 893, 894, 897, 898, 899, 900,
+    897, 898, 899, 900, 897, 898, 899, 900, 897, 898, 899, 900, 901, 902, 903, 904, 8, 9, 10, 11, 905, 906, 907, 908,
+    16, 17, 18, 19, 20, 21, 22, 23, 909, 910, 911, 912, 913, 914, 915, 916, 32, 33, 34, 35, 917, 918, 919, 920,
+    40, 41, 42, 43, 44, 45, 46, 47, 921, 922, 923, 924, 925, 926, 927, 928, 929, 930, 931, 932, 897, 898, 899, 900,
+    897, 898, 899, 900, 897, 898, 899, 900, 897, 898, 899, 900, 925, 926, 927, 928, 929, 930, 931, 932, 905, 906, 907, 908,
+    905, 906, 907, 908, 909, 910, 911, 912, 909, 910, 911, 912, 917, 918, 919, 920, 917, 918, 919, 920, 921, 922, 923, 924,
+    921, 922, 923, 924, 897, 898, 899, 900, 897, 898, 899, 900, 933, 934, 935, 936, 937, 938, 939, 940, 941, 942, 943, 944,
+    945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 148, 149, 150, 151, 152, 153, 154, 155, 957, 958, 959, 960,
+    961, 962, 963, 964, 957, 958, 959, 960, 961, 962, 963, 964, 965, 966, 967, 968, 969, 970, 971, 972, 973, 974, 975, 976,
+    977, 978, 979, 980, 981, 982, 983, 984, 985, 986, 987, 988, 989, 990, 991, 992, 989, 990, 991, 992, 989, 990, 991, 992,
+    989, 990, 991, 992, 993, 994, 995, 996, 8, 9, 10, 11, 997, 998, 999, 1000, 16, 17, 18, 19, 20, 21, 22, 23,
+    1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 32, 33, 34, 35, 1009, 1010, 1011, 1012, 40, 41, 42, 43, 44, 45, 46, 47,
+    1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 989, 990, 991, 992, 989, 990, 991, 992, 989, 990, 991, 992,
+    989, 990, 991, 992, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 997, 998, 999, 1000, 997, 998, 999, 1000, 1001, 1002, 1003, 1004,
+    1001, 1002, 1003, 1004, 1009, 1010, 1011, 1012, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1013, 1014, 1015, 1016, 989, 990, 991, 992,
+    989, 990, 991, 992, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044,
+    1045, 1046, 1047, 1048, 148, 149, 150, 151, 152, 153, 154, 155, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1049, 1050, 1051, 1052,
+    1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076,
+    1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1081, 1082, 1083, 1084, 1081, 1082, 1083, 1084, 1081, 1082, 1083, 1084, 901, 902, 903, 904,
+    8, 9, 10, 11, 905, 906, 907, 908, 16, 17, 18, 19, 20, 21, 22, 23, 909, 910, 911, 912, 913, 914, 915, 916,
+    32, 33, 34, 35, 917, 918, 919, 920, 40, 41, 42, 43, 44, 45, 46, 47, 921, 922, 923, 924, 52, 53, 54, 55,
+    56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+    104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151,
+    152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 981, 982, 983, 984, 985, 986, 987, 988, 1085, 1086, 1087, 1088,
+    1085, 1086, 1087, 1088, 1085, 1086, 1087, 1088, 1085, 1086, 1087, 1088, 993, 994, 995, 996, 8, 9, 10, 11, 997, 998, 999, 1000,
+    16, 17, 18, 19, 20, 21, 22, 23, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 32, 33, 34, 35, 1009, 1010, 1011, 1012,
+    40, 41, 42, 43, 44, 45, 46, 47, 1013, 1014, 1015, 1016, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+    88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135,
+    136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183,
+    184, 185, 186, 187, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1089, 1090, 1091, 1092, 1089, 1090, 1091, 1092, 1089, 1090, 1091, 1092,
+    1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 308, 308, 308, 308, 1097, 1098, 1099, 1100, 308, 308, 308, 308, 308, 308, 308, 308,
+    1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 308, 308, 308, 308, 1109, 1110, 1111, 1112, 308, 308, 308, 308, 308, 308, 308, 308,
+    1113, 1114, 1115, 1116, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 1117, 1118, 1119, 1120,
+    1121, 1122, 1123, 1124, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1089, 1090, 1091, 1092,
+    1089, 1090, 1091, 1092, 1089, 1090, 1091, 1092, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 308, 308, 308, 308, 1097, 1098, 1099, 1100,
+    308, 308, 308, 308, 308, 308, 308, 308, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 308, 308, 308, 308, 1109, 1110, 1111, 1112,
+    308, 308, 308, 308, 308, 308, 308, 308, 1113, 1114, 1115, 1116, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160,
+    1161, 1162, 1163, 1164, 1089, 1090, 1091, 1092, 1089, 1090, 1091, 1092, 1089, 1090, 1091, 1092, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096,
+    308, 308, 308, 308, 1097, 1098, 1099, 1100, 308, 308, 308, 308, 308, 308, 308, 308, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108,
+    308, 308, 308, 308, 1109, 1110, 1111, 1112, 308, 308, 308, 308, 308, 308, 308, 308, 1113, 1114, 1115, 1116, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172,
+    1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1089, 1090, 1091, 1092, 1089, 1090, 1091, 1092, 1089, 1090, 1091, 1092,
+    1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 308, 308, 308, 308, 1097, 1098, 1099, 1100, 308, 308, 308, 308, 308, 308, 308, 308,
+    1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 308, 308, 308, 308, 1109, 1110, 1111, 1112, 308, 308, 308, 308, 308, 308, 308, 308,
+    1113, 1114, 1115, 1116, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 1117, 1118, 1119, 1120,
+    1121, 1122, 1123, 1124, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1089, 1090, 1091, 1092,
+    1089, 1090, 1091, 1092, 1089, 1090, 1091, 1092, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 308, 308, 308, 308, 1097, 1098, 1099, 1100,
+    308, 308, 308, 308, 308, 308, 308, 308, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 308, 308, 308, 308, 1109, 1110, 1111, 1112,
+    308, 308, 308, 308, 308, 308, 308, 308, 1113, 1114, 1115, 1116, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220,
+    1221, 1222, 1223, 1224, 1089, 1090, 1091, 1092, 1089, 1090, 1091, 1092, 1089, 1090, 1091, 1092, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096,
+    308, 308, 308, 308, 1097, 1098, 1099, 1100, 308, 308, 308, 308, 308, 308, 308, 308, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108,
+    308, 308, 308, 308, 1109, 1110, 1111, 1112, 308, 308, 308, 308, 308, 308, 308, 308, 1113, 1114, 1115, 1116, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232,
+    1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+    24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+    72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+    120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167,
+    168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215,
+    216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 0, 1, 2, 3,
+    4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+    28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+    52, 53, 54, 55, 56, 57, 58, 59, 140, 141, 142, 143, 144, 145, 146, 147, 156, 157, 158, 159, 160, 161, 162, 163,
+    260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283,
+    284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307,
+    0, 1, 2, 3, 0, 1, 2, 3, 308, 308, 308, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320,
+    321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344,
+    345, 346, 347, 348, 0, 1, 2, 3, 349, 350, 351, 352, 0, 1, 2, 3, 353, 354, 355, 356, 357, 358, 359, 360,
+    361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 0, 1, 2, 3, 373, 374, 375, 376, 377, 378, 379, 380,
+    381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404,
+    405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 244, 245, 246, 247, 417, 418, 419, 420, 421, 422, 423, 424,
+    425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448,
+    449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472,
+    473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496,
+    497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520,
+    521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544,
+    545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568,
+    569, 570, 571, 572, 573, 574, 575, 576, 0, 1, 2, 3, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588,
+    589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 4, 5, 6, 7,
+    609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 196, 197, 198, 199, 200, 201, 202, 203,
+    625, 626, 627, 628, 629, 630, 631, 632, 212, 213, 214, 215, 633, 634, 635, 636, 220, 221, 222, 223, 224, 225, 226, 227,
+    637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 658, 659, 660,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252,
+    689, 690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3,
+    0, 1, 2, 3, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+    20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43,
+    44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67,
+    68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91,
+    92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115,
+    116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139,
+    140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163,
+    164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187,
+    188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211,
+    212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235,
+    236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+    24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 140, 141, 142, 143, 144, 145, 146, 147, 156, 157, 158, 159,
+    160, 161, 162, 163, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279,
+    280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303,
+    304, 305, 306, 307, 0, 1, 2, 3, 0, 1, 2, 3, 308, 308, 308, 308, 309, 310, 311, 312, 313, 314, 315, 316,
+    317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340,
+    341, 342, 343, 344, 345, 346, 347, 348, 0, 1, 2, 3, 349, 350, 351, 352, 0, 1, 2, 3, 353, 354, 355, 356,
+    357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 0, 1, 2, 3, 373, 374, 375, 376,
+    377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400,
+    401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 244, 245, 246, 247, 417, 418, 419, 420,
+    421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444,
+    445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468,
+    469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492,
+    493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516,
+    517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540,
+    541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564,
+    565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 0, 1, 2, 3, 577, 578, 579, 580, 581, 582, 583, 584,
+    585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608,
+    4, 5, 6, 7, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 196, 197, 198, 199,
+    200, 201, 202, 203, 625, 626, 627, 628, 629, 630, 631, 632, 212, 213, 214, 215, 633, 634, 635, 636, 220, 221, 222, 223,
+    224, 225, 226, 227, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656,
+    657, 658, 659, 660, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+    308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 1253, 1254, 1255, 1256,
+    1257, 1258, 1259, 1260, 689, 690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 0, 1, 2, 3,
+};
+
+// Number of positions in each list.
+static constexpr const uint16_t PackedVehicleInfoListSizes[] = {
+    32, 32, 32, 32, 32, 32, 32, 32, 64, 64, 64, 64, 32, 32, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37,
+    32, 32, 32, 32, 32, 32, 32, 32, 64, 64, 64, 64, 32, 32, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37,
+    32, 32, 32, 32, 114, 115, 114, 113, 113, 114, 115, 114, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 114, 115, 114, 113, 113, 114, 115, 114, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 114, 115, 114, 113, 113, 114, 115, 114, 114, 115, 114, 113, 113, 114, 115, 114, 96, 96, 96, 96,
+    96, 96, 96, 96, 310, 310, 310, 310, 310, 310, 310, 310, 68, 69, 68, 67, 67, 68, 69, 68, 68, 69, 68, 67,
+    67, 68, 69, 68, 68, 69, 68, 67, 67, 68, 69, 68, 68, 69, 68, 67, 67, 68, 69, 68, 22, 23, 22, 21,
+    21, 22, 23, 22, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 160, 160, 160, 160,
+    160, 160, 160, 160, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 94, 94, 94, 94, 32, 32, 32, 32, 135, 137, 137, 135,
+    135, 137, 137, 135, 135, 137, 137, 135, 135, 137, 137, 135, 227, 229, 229, 227, 227, 229, 229, 227, 227, 229, 229, 227,
+    227, 229, 229, 227, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 1, 114, 115, 114,
+    113, 113, 114, 115, 114, 114, 115, 114, 113, 113, 114, 115, 114, 114, 115, 114, 113, 113, 114, 115, 114, 114, 115, 114,
+    113, 113, 114, 115, 114, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 160, 160, 160, 160, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 165, 165, 165,
+    165, 304, 304, 304, 304, 80, 80, 80, 80, 32, 32, 32, 32, 32, 32, 32, 32, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 56, 56, 56, 56, 56, 79, 80, 80, 80, 80, 80, 80, 80, 79, 80, 80, 80, 79, 80, 80,
+    80, 79, 80, 80, 80, 80, 80, 80, 80, 79, 80, 80, 80, 79, 80, 80, 80, 32, 32, 32, 32, 32, 32, 32,
+    32, 64, 64, 64, 64, 32, 32, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 32, 32, 32,
+    32, 64, 64, 64, 64, 32, 32, 32, 32, 37, 37, 37, 37, 37, 37, 37, 37, 32, 32, 32, 32, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 49, 49, 49,
+    49, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 68, 69, 68, 67, 67, 68, 69,
+    68, 68, 69, 68, 67, 67, 68, 69, 68, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311,
+    311, 96, 96, 96, 96, 96, 96, 96, 96, 160, 160, 160, 160, 97, 97, 97, 97, 97, 97, 97, 97, 160, 160, 160,
+    160, 160, 160, 160, 160, 192, 192, 192, 192, 192, 192, 192, 192, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+    137, 68, 69, 68, 67, 67, 68, 69, 68, 192, 192, 192, 192, 192, 192, 192, 192, 114, 114, 114, 114, 80, 80, 80,
+    80, 304, 304, 304, 304, 68, 69, 68, 67, 67, 68, 69, 68, 68, 69, 68, 67, 67, 68, 69, 68, 114, 115, 114,
+    113, 113, 114, 115, 114, 114, 115, 114, 113, 113, 114, 115, 114, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+    96, 96, 96, 96, 96, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 9, 10, 9,
+    8, 36, 37, 38, 37, 61, 61, 61, 61, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 105, 105, 105, 105, 126, 126, 126, 126, 105, 105, 105,
+    105, 126, 126, 126, 126, 105, 105, 105, 105, 126, 126, 126, 126, 96, 96, 96, 96, 96, 96, 96, 96, 58, 58, 58,
+    58, 78, 78, 78, 78, 58, 58, 58, 58, 78, 78, 78, 78, 58, 58, 58, 58, 78, 78, 78, 78, 13, 14, 13,
+    12, 32, 33, 34, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 126, 126, 126, 126, 105, 105, 105, 105, 126, 126, 126, 126, 105, 105, 105,
+    105, 126, 126, 126, 126, 105, 105, 105, 105, 96, 96, 96, 96, 96, 96, 96, 96, 78, 78, 78, 78, 58, 58, 58,
+    63, 78, 78, 78, 78, 58, 58, 58, 58, 78, 78, 78, 78, 58, 58, 58, 58, 33, 34, 32, 32, 12, 13, 14,
+    13, 32, 32, 32, 32, 32, 32, 32, 32, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 15, 17, 16, 15, 15, 16, 17, 16, 59, 59, 59,
+    59, 60, 60, 60, 60, 60, 60, 60, 60, 76, 76, 76, 76, 76, 76, 76, 76, 53, 53, 53, 53, 58, 58, 58,
+    58, 42, 42, 42, 42, 74, 74, 74, 74, 74, 74, 74, 74, 66, 66, 66, 66, 81, 81, 81, 81, 73, 73, 73,
+    73, 92, 92, 92, 92, 92, 92, 92, 92, 52, 52, 52, 52, 62, 62, 62, 62, 51, 51, 51, 51, 107, 107, 107,
+    107, 107, 107, 107, 107, 93, 93, 93, 93, 70, 70, 70, 70, 88, 88, 88, 88, 102, 102, 102, 102, 102, 102, 102,
+    102, 70, 70, 70, 70, 73, 73, 73, 73, 77, 77, 77, 77, 184, 184, 184, 184, 184, 184, 184, 184, 96, 96, 96,
+    96, 96, 96, 96, 96, 192, 192, 192, 192, 192, 192, 192, 192,
+};
+
+// All position lists, delta encoded.
+static constexpr const uint8_t PackedVehicleInfo[] = {
+    255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 0, 0, 16,
+    0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 255, 31, 0, 16, 0, 0, 0, 0, 2, 0, 86, 61, 86, 61, 86, 61,
+    86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 255, 16, 0, 0, 0,
+    0, 0, 8, 2, 0, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67,
+    92, 67, 92, 67, 92, 67, 255, 0, 0, 16, 0, 0, 0, 16, 2, 0, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88,
+    63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 255, 16, 0, 31, 0, 0, 0, 24, 2, 0, 82, 57, 82,
+    57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 255, 31,
+    0, 16, 0, 0, 0, 0, 4, 0, 87, 86, 87, 86, 87, 86, 87, 86, 87, 86, 87, 86, 87, 86, 87, 86, 87, 86, 87, 86, 87, 86,
+    87, 86, 87, 86, 87, 86, 87, 86, 87, 86, 87, 86, 87, 86, 87, 86, 87, 86, 87, 86, 87, 86, 87, 86, 87, 86, 87, 86, 87, 86,
+    87, 86, 87, 86, 87, 86, 87, 86, 87, 86, 87, 255, 16, 0, 0, 0, 0, 0, 8, 4, 0, 87, 92, 87, 92, 87, 92, 87, 92, 87,
+    92, 87, 92, 87, 92, 87, 92, 87, 92, 87, 92, 87, 92, 87, 92, 87, 92, 87, 92, 87, 92, 87, 92, 87, 92, 87, 92, 87, 92, 87,
+    92, 87, 92, 87, 92, 87, 92, 87, 92, 87, 92, 87, 92, 87, 92, 87, 92, 87, 92, 87, 92, 87, 92, 87, 255, 0, 0, 16, 0, 0,
+    0, 16, 4, 0, 87, 88, 87, 88, 87, 88, 87, 88, 87, 88, 87, 88, 87, 88, 87, 88, 87, 88, 87, 88, 87, 88, 87, 88, 87, 88,
+    87, 88, 87, 88, 87, 88, 87, 88, 87, 88, 87, 88, 87, 88, 87, 88, 87, 88, 87, 88, 87, 88, 87, 88, 87, 88, 87, 88, 87, 88,
+    87, 88, 87, 88, 87, 88, 87, 255, 16, 0, 31, 0, 0, 0, 24, 4, 0, 87, 82, 87, 82, 87, 82, 87, 82, 87, 82, 87, 82, 87,
+    82, 87, 82, 87, 82, 87, 82, 87, 82, 87, 82, 87, 82, 87, 82, 87, 82, 87, 82, 87, 82, 87, 82, 87, 82, 87, 82, 87, 82, 87,
+    82, 87, 82, 87, 82, 87, 82, 87, 82, 87, 82, 87, 82, 87, 82, 87, 82, 87, 82, 87, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0,
+    61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 1, 0, 61, 86, 61, 61, 61, 61, 61, 86, 61, 61, 61, 86, 61, 61, 86, 254,
+    255, 0, 0, 0, 2, 0, 86, 61, 86, 61, 86, 61, 86, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67,
+    254, 0, 1, 0, 8, 1, 0, 67, 92, 67, 67, 67, 67, 67, 92, 67, 67, 67, 92, 67, 67, 92, 254, 0, 1, 0, 8, 2, 0, 67,
+    92, 67, 92, 67, 92, 67, 255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 1, 0,
+    63, 88, 63, 63, 63, 63, 63, 88, 63, 63, 63, 88, 63, 63, 88, 254, 1, 0, 0, 16, 2, 0, 63, 88, 63, 88, 63, 88, 63, 255,
+    16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 1, 0, 57, 82, 57, 57, 57, 57, 57,
+    82, 57, 57, 57, 82, 57, 57, 82, 254, 0, 255, 0, 24, 2, 0, 82, 57, 82, 57, 82, 57, 82, 255, 31, 0, 16, 0, 0, 0, 0,
+    2, 0, 61, 86, 61, 86, 86, 61, 86, 86, 61, 254, 255, 0, 1, 0, 3, 0, 86, 86, 61, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+    86, 87, 86, 86, 254, 255, 0, 1, 0, 4, 0, 87, 86, 86, 87, 86, 86, 87, 86, 87, 255, 16, 0, 0, 0, 0, 0, 8, 2, 0,
+    67, 92, 67, 92, 92, 67, 92, 92, 67, 254, 0, 1, 1, 8, 3, 0, 92, 92, 67, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 87,
+    92, 92, 254, 0, 1, 1, 8, 4, 0, 87, 92, 92, 87, 92, 92, 87, 92, 87, 255, 0, 0, 16, 0, 0, 0, 16, 2, 0, 63, 88,
+    63, 88, 88, 63, 88, 88, 63, 254, 1, 0, 1, 16, 3, 0, 88, 88, 63, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 87, 88, 88,
+    254, 1, 0, 1, 16, 4, 0, 87, 88, 88, 87, 88, 88, 87, 88, 87, 255, 16, 0, 31, 0, 0, 0, 24, 2, 0, 57, 82, 57, 82,
+    82, 57, 82, 82, 57, 254, 0, 255, 1, 24, 3, 0, 82, 82, 57, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 87, 82, 82, 254, 0,
+    255, 1, 24, 4, 0, 87, 82, 82, 87, 82, 82, 87, 82, 87, 255, 31, 0, 16, 0, 0, 0, 0, 4, 0, 87, 86, 87, 86, 86, 87,
+    86, 86, 87, 254, 255, 0, 1, 0, 3, 0, 86, 86, 87, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 61, 86, 86, 254, 255, 0, 1,
+    0, 2, 0, 61, 86, 86, 61, 86, 86, 61, 86, 61, 255, 16, 0, 0, 0, 0, 0, 8, 4, 0, 87, 92, 87, 92, 92, 87, 92, 92,
+    87, 254, 0, 1, 1, 8, 3, 0, 92, 92, 87, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 67, 92, 92, 254, 0, 1, 1, 8, 2,
+    0, 67, 92, 92, 67, 92, 92, 67, 92, 67, 255, 0, 0, 16, 0, 0, 0, 16, 4, 0, 87, 88, 87, 88, 88, 87, 88, 88, 87, 254,
+    1, 0, 1, 16, 3, 0, 88, 88, 87, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 63, 88, 88, 254, 1, 0, 1, 16, 2, 0, 63,
+    88, 88, 63, 88, 88, 63, 88, 63, 255, 16, 0, 31, 0, 0, 0, 24, 4, 0, 87, 82, 87, 82, 82, 87, 82, 82, 87, 254, 0, 255,
+    1, 24, 3, 0, 82, 82, 87, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 57, 82, 82, 254, 0, 255, 1, 24, 2, 0, 57, 82, 82,
+    57, 82, 82, 57, 82, 57, 255, 31, 0, 16, 0, 0, 0, 0, 2, 0, 86, 61, 86, 61, 86, 61, 61, 254, 255, 0, 1, 0, 1, 0,
+    61, 61, 86, 61, 61, 86, 61, 61, 61, 86, 61, 61, 61, 254, 255, 0, 0, 0, 0, 0, 61, 86, 61, 61, 61, 61, 61, 61, 61, 255,
+    16, 0, 0, 0, 0, 0, 8, 2, 0, 67, 92, 67, 92, 67, 92, 67, 254, 0, 1, 1, 8, 1, 0, 67, 67, 92, 67, 67, 92, 67,
+    67, 67, 92, 67, 67, 67, 254, 0, 1, 0, 8, 0, 0, 67, 92, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 0, 0, 16,
+    2, 0, 63, 88, 63, 88, 63, 88, 63, 254, 1, 0, 1, 16, 1, 0, 63, 63, 88, 63, 63, 88, 63, 63, 63, 88, 63, 63, 63, 254,
+    1, 0, 0, 16, 0, 0, 63, 88, 63, 63, 63, 63, 63, 63, 63, 255, 16, 0, 31, 0, 0, 0, 24, 2, 0, 82, 57, 82, 57, 82,
+    57, 57, 254, 0, 255, 1, 24, 1, 0, 57, 57, 82, 57, 57, 82, 57, 57, 57, 82, 57, 57, 57, 254, 0, 255, 0, 24, 0, 0, 57,
+    82, 57, 57, 57, 57, 57, 57, 57, 255, 31, 0, 16, 0, 15, 0, 0, 6, 0, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36,
+    61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 255, 16, 0, 0, 0, 15, 0, 8, 6, 0, 42,
+    67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42,
+    255, 0, 0, 16, 0, 15, 0, 16, 6, 0, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63,
+    38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 255, 16, 0, 31, 0, 15, 0, 24, 6, 0, 57, 32, 57, 32, 57, 32, 57, 32, 57,
+    32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 255, 31, 0, 16, 0, 63, 0, 0,
+    8, 0, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36,
+    37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36,
+    37, 36, 37, 36, 37, 255, 16, 0, 0, 0, 63, 0, 8, 8, 0, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37,
+    42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37,
+    42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 255, 0, 0, 16, 0, 63, 0, 16, 8, 0, 37, 38,
+    37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38,
+    37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38,
+    37, 255, 16, 0, 31, 0, 63, 0, 24, 8, 0, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37,
+    32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37,
+    32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 255, 31, 0, 16, 0, 8, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61,
+    61, 254, 255, 0, 255, 0, 5, 0, 61, 61, 61, 61, 61, 36, 61, 61, 61, 36, 61, 61, 36, 61, 61, 254, 255, 0, 255, 0, 6, 0,
+    61, 36, 61, 36, 61, 36, 61, 255, 16, 0, 0, 0, 8, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 255, 8, 5,
+    0, 67, 67, 67, 67, 67, 42, 67, 67, 67, 42, 67, 67, 42, 67, 67, 254, 0, 1, 255, 8, 6, 0, 67, 67, 42, 67, 42, 67, 42,
+    255, 0, 0, 16, 0, 8, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 255, 16, 5, 0, 63, 63, 63, 63, 63, 38,
+    63, 63, 63, 38, 63, 63, 38, 63, 63, 254, 1, 0, 255, 16, 6, 0, 63, 63, 38, 63, 38, 63, 38, 255, 16, 0, 31, 0, 8, 0,
+    24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 255, 24, 5, 0, 57, 57, 57, 57, 57, 32, 57, 57, 57, 32, 57, 57, 32,
+    57, 57, 254, 0, 255, 255, 24, 6, 0, 57, 32, 57, 32, 57, 32, 57, 255, 31, 0, 16, 0, 31, 0, 0, 6, 0, 61, 36, 61, 36,
+    36, 61, 36, 36, 61, 254, 255, 0, 255, 0, 7, 0, 36, 36, 61, 36, 36, 36, 36, 36, 11, 36, 36, 36, 36, 37, 36, 36, 254, 255,
+    0, 255, 0, 8, 0, 37, 36, 36, 37, 36, 36, 37, 36, 37, 255, 16, 0, 0, 0, 31, 0, 8, 6, 0, 67, 42, 67, 42, 42, 67,
+    42, 42, 67, 254, 0, 1, 255, 8, 7, 0, 42, 42, 67, 42, 42, 42, 42, 42, 17, 42, 42, 42, 42, 37, 42, 42, 254, 0, 1, 255,
+    8, 8, 0, 37, 42, 42, 37, 42, 42, 37, 42, 37, 255, 0, 0, 16, 0, 31, 0, 16, 6, 0, 63, 38, 63, 38, 38, 63, 38, 38,
+    63, 254, 1, 0, 255, 16, 7, 0, 38, 38, 63, 38, 38, 38, 38, 38, 13, 38, 38, 38, 38, 37, 38, 38, 254, 1, 0, 255, 16, 8,
+    0, 37, 38, 38, 37, 38, 38, 37, 38, 37, 255, 16, 0, 31, 0, 31, 0, 24, 6, 0, 57, 32, 57, 32, 32, 57, 32, 32, 57, 254,
+    0, 255, 255, 24, 7, 0, 32, 32, 57, 32, 32, 32, 32, 32, 7, 32, 32, 32, 32, 37, 32, 32, 254, 0, 255, 255, 24, 8, 0, 37,
+    32, 32, 37, 32, 32, 37, 32, 37, 255, 31, 0, 16, 0, 31, 0, 0, 8, 0, 37, 36, 37, 36, 36, 37, 36, 36, 37, 254, 255, 0,
+    255, 0, 7, 0, 36, 36, 37, 36, 36, 36, 36, 36, 35, 36, 36, 36, 36, 61, 36, 36, 254, 255, 0, 255, 0, 6, 0, 61, 36, 36,
+    61, 36, 36, 61, 36, 61, 255, 16, 0, 0, 0, 31, 0, 8, 8, 0, 37, 42, 37, 42, 42, 37, 42, 42, 37, 254, 0, 1, 255, 8,
+    7, 0, 42, 42, 37, 42, 42, 42, 42, 42, 47, 42, 42, 42, 42, 67, 42, 42, 254, 0, 1, 255, 8, 6, 0, 67, 42, 42, 67, 42,
+    42, 67, 42, 67, 255, 0, 0, 16, 0, 31, 0, 16, 8, 0, 37, 38, 37, 38, 38, 37, 38, 38, 37, 254, 1, 0, 255, 16, 7, 0,
+    38, 38, 37, 38, 38, 38, 38, 38, 39, 38, 38, 38, 38, 63, 38, 38, 254, 1, 0, 255, 16, 6, 0, 63, 38, 38, 63, 38, 38, 63,
+    38, 63, 255, 16, 0, 31, 0, 31, 0, 24, 8, 0, 37, 32, 37, 32, 32, 37, 32, 32, 37, 254, 0, 255, 255, 24, 7, 0, 32, 32,
+    37, 32, 32, 32, 32, 32, 27, 32, 32, 32, 32, 57, 32, 32, 254, 0, 255, 255, 24, 6, 0, 57, 32, 32, 57, 32, 32, 57, 32, 57,
+    255, 31, 0, 16, 0, 7, 0, 0, 6, 0, 61, 36, 61, 36, 61, 36, 61, 254, 255, 0, 0, 0, 5, 0, 36, 61, 61, 36, 61, 61,
+    61, 36, 61, 61, 61, 61, 61, 254, 255, 0, 255, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 8, 0,
+    8, 6, 0, 42, 67, 42, 67, 42, 67, 42, 254, 0, 1, 0, 8, 5, 0, 42, 67, 67, 42, 67, 67, 67, 42, 67, 67, 67, 67, 67,
+    254, 0, 1, 255, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 8, 0, 16, 6, 0, 38, 63, 38, 63,
+    38, 63, 38, 254, 1, 0, 0, 16, 5, 0, 38, 63, 63, 38, 63, 63, 63, 38, 63, 63, 63, 63, 63, 254, 1, 0, 255, 16, 0, 0,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 255, 16, 0, 31, 0, 7, 0, 24, 6, 0, 57, 32, 57, 32, 57, 32, 57, 254, 0, 255, 0,
+    24, 5, 0, 32, 57, 57, 32, 57, 57, 57, 32, 57, 57, 57, 57, 57, 254, 0, 255, 255, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 31, 0, 0, 56, 61, 61, 61, 61,
+    61, 56, 61, 61, 61, 61, 56, 61, 254, 255, 0, 0, 30, 0, 0, 61, 56, 61, 61, 56, 61, 61, 56, 61, 56, 61, 56, 61, 56, 254,
+    255, 0, 0, 29, 0, 0, 56, 61, 56, 56, 61, 56, 56, 61, 56, 56, 61, 56, 254, 255, 255, 0, 28, 0, 0, 56, 61, 56, 56, 56,
+    56, 61, 56, 56, 56, 56, 57, 254, 255, 255, 0, 27, 0, 0, 56, 56, 57, 56, 56, 57, 56, 56, 57, 56, 56, 57, 254, 255, 255, 0,
+    26, 0, 0, 57, 56, 57, 56, 57, 56, 57, 56, 57, 57, 56, 57, 57, 254, 255, 255, 0, 25, 0, 0, 57, 57, 57, 56, 57, 57, 57,
+    57, 56, 57, 57, 57, 57, 57, 56, 254, 0, 255, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 255, 16, 0, 0, 0, 0, 0,
+    8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 7, 0, 0, 66, 67, 67, 67, 67, 67, 66, 67, 67, 67, 67, 66, 67,
+    254, 0, 1, 0, 6, 0, 0, 67, 66, 67, 67, 66, 67, 67, 66, 67, 66, 67, 66, 67, 66, 254, 0, 1, 0, 5, 0, 0, 66, 67,
+    66, 66, 67, 66, 66, 67, 66, 66, 67, 66, 254, 255, 1, 0, 4, 0, 0, 66, 67, 66, 66, 66, 66, 67, 66, 66, 66, 66, 61, 254,
+    255, 1, 0, 3, 0, 0, 66, 66, 61, 66, 66, 61, 66, 66, 61, 66, 66, 61, 254, 255, 1, 0, 2, 0, 0, 61, 66, 61, 66, 61,
+    66, 61, 66, 61, 61, 66, 61, 61, 254, 255, 1, 0, 1, 0, 0, 61, 61, 61, 66, 61, 61, 61, 61, 66, 61, 61, 61, 61, 61, 66,
+    254, 255, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63,
+    63, 63, 254, 1, 0, 0, 15, 0, 0, 68, 63, 63, 63, 63, 63, 68, 63, 63, 63, 63, 68, 63, 254, 1, 0, 0, 14, 0, 0, 63,
+    68, 63, 63, 68, 63, 63, 68, 63, 68, 63, 68, 63, 68, 254, 1, 0, 0, 13, 0, 0, 68, 63, 68, 68, 63, 68, 68, 63, 68, 68,
+    63, 68, 254, 1, 1, 0, 12, 0, 0, 68, 63, 68, 68, 68, 68, 63, 68, 68, 68, 68, 67, 254, 1, 1, 0, 11, 0, 0, 68, 68,
+    67, 68, 68, 67, 68, 68, 67, 68, 68, 67, 254, 1, 1, 0, 10, 0, 0, 67, 68, 67, 68, 67, 68, 67, 68, 67, 67, 68, 67, 67,
+    254, 1, 1, 0, 9, 0, 0, 67, 67, 67, 68, 67, 67, 67, 67, 68, 67, 67, 67, 67, 67, 68, 254, 0, 1, 0, 8, 0, 0, 67,
+    67, 67, 67, 67, 67, 67, 255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 23, 0, 0, 58,
+    57, 57, 57, 57, 57, 58, 57, 57, 57, 57, 58, 57, 254, 0, 255, 0, 22, 0, 0, 57, 58, 57, 57, 58, 57, 57, 58, 57, 58, 57,
+    58, 57, 58, 254, 0, 255, 0, 21, 0, 0, 58, 57, 58, 58, 57, 58, 58, 57, 58, 58, 57, 58, 254, 1, 255, 0, 20, 0, 0, 58,
+    57, 58, 58, 58, 58, 57, 58, 58, 58, 58, 63, 254, 1, 255, 0, 19, 0, 0, 58, 58, 63, 58, 58, 63, 58, 58, 63, 58, 58, 63,
+    254, 1, 255, 0, 18, 0, 0, 63, 58, 63, 58, 63, 58, 63, 58, 63, 63, 58, 63, 63, 254, 1, 255, 0, 17, 0, 0, 63, 63, 63,
+    58, 63, 63, 63, 63, 58, 63, 63, 63, 63, 63, 58, 254, 1, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 255, 31, 0, 16,
+    0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 1, 0, 0, 66, 61, 61, 61, 61, 61, 66, 61, 61, 61, 61,
+    66, 61, 254, 255, 0, 0, 2, 0, 0, 61, 66, 61, 61, 66, 61, 61, 66, 61, 66, 61, 66, 61, 66, 254, 255, 0, 0, 3, 0, 0,
+    66, 61, 66, 66, 61, 66, 66, 61, 66, 66, 61, 66, 254, 255, 1, 0, 4, 0, 0, 66, 61, 66, 66, 66, 66, 61, 66, 66, 66, 66,
+    67, 254, 255, 1, 0, 5, 0, 0, 66, 66, 67, 66, 66, 67, 66, 66, 67, 66, 66, 67, 254, 255, 1, 0, 6, 0, 0, 67, 66, 67,
+    66, 67, 66, 67, 66, 67, 67, 66, 67, 67, 254, 255, 1, 0, 7, 0, 0, 67, 67, 67, 66, 67, 67, 67, 67, 66, 67, 67, 67, 67,
+    67, 66, 254, 0, 1, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67,
+    67, 67, 67, 254, 0, 1, 0, 9, 0, 0, 68, 67, 67, 67, 67, 67, 68, 67, 67, 67, 67, 68, 67, 254, 0, 1, 0, 10, 0, 0,
+    67, 68, 67, 67, 68, 67, 67, 68, 67, 68, 67, 68, 67, 68, 254, 0, 1, 0, 11, 0, 0, 68, 67, 68, 68, 67, 68, 68, 67, 68,
+    68, 67, 68, 254, 1, 1, 0, 12, 0, 0, 68, 67, 68, 68, 68, 68, 67, 68, 68, 68, 68, 63, 254, 1, 1, 0, 13, 0, 0, 68,
+    68, 63, 68, 68, 63, 68, 68, 63, 68, 68, 63, 254, 1, 1, 0, 14, 0, 0, 63, 68, 63, 68, 63, 68, 63, 68, 63, 63, 68, 63,
+    63, 254, 1, 1, 0, 15, 0, 0, 63, 63, 63, 68, 63, 63, 63, 63, 68, 63, 63, 63, 63, 63, 68, 254, 1, 0, 0, 16, 0, 0,
+    63, 63, 63, 63, 63, 63, 63, 255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 17, 0,
+    0, 58, 63, 63, 63, 63, 63, 58, 63, 63, 63, 63, 58, 63, 254, 1, 0, 0, 18, 0, 0, 63, 58, 63, 63, 58, 63, 63, 58, 63,
+    58, 63, 58, 63, 58, 254, 1, 0, 0, 19, 0, 0, 58, 63, 58, 58, 63, 58, 58, 63, 58, 58, 63, 58, 254, 1, 255, 0, 20, 0,
+    0, 58, 63, 58, 58, 58, 58, 63, 58, 58, 58, 58, 57, 254, 1, 255, 0, 21, 0, 0, 58, 58, 57, 58, 58, 57, 58, 58, 57, 58,
+    58, 57, 254, 1, 255, 0, 22, 0, 0, 57, 58, 57, 58, 57, 58, 57, 58, 57, 57, 58, 57, 57, 254, 1, 255, 0, 23, 0, 0, 57,
+    57, 57, 58, 57, 57, 57, 57, 58, 57, 57, 57, 57, 57, 58, 254, 0, 255, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 255,
+    16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 25, 0, 0, 56, 57, 57, 57, 57, 57, 56, 57,
+    57, 57, 57, 56, 57, 254, 0, 255, 0, 26, 0, 0, 57, 56, 57, 57, 56, 57, 57, 56, 57, 56, 57, 56, 57, 56, 254, 0, 255, 0,
+    27, 0, 0, 56, 57, 56, 56, 57, 56, 56, 57, 56, 56, 57, 56, 254, 255, 255, 0, 28, 0, 0, 56, 57, 56, 56, 56, 56, 57, 56,
+    56, 56, 56, 61, 254, 255, 255, 0, 29, 0, 0, 56, 56, 61, 56, 56, 61, 56, 56, 61, 56, 56, 61, 254, 255, 255, 0, 30, 0, 0,
+    61, 56, 61, 56, 61, 56, 61, 56, 61, 61, 56, 61, 61, 254, 255, 255, 0, 31, 0, 0, 61, 61, 61, 56, 61, 61, 61, 61, 56, 61,
+    61, 61, 61, 61, 56, 254, 255, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0,
+    61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 1, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254,
+    255, 0, 0, 0, 0, 2, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67,
+    254, 0, 1, 0, 8, 0, 1, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 2, 67,
+    67, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 1,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 2, 63, 63, 63, 63, 63, 63, 63, 255,
+    16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 1, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 2, 57, 57, 57, 57, 57, 57, 57, 255, 31, 0, 16, 0, 0, 0, 0,
+    0, 0, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 3, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 254, 255, 0, 0, 0, 0, 4, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67, 67,
+    67, 67, 254, 0, 1, 0, 8, 0, 3, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0,
+    4, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16,
+    0, 3, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 4, 63, 63, 63, 63, 63, 63,
+    63, 255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 3, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 4, 57, 57, 57, 57, 57, 57, 57, 255, 31, 0, 16, 0, 0,
+    0, 0, 0, 2, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 1, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 254, 255, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 0, 0, 8, 0, 2, 67, 67, 67,
+    67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 1, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0,
+    8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 0, 0, 16, 0, 2, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0,
+    0, 16, 0, 1, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 0, 63, 63, 63, 63,
+    63, 63, 63, 255, 16, 0, 31, 0, 0, 0, 24, 0, 2, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 1, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 255, 31, 0, 16,
+    0, 0, 0, 0, 0, 4, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 3, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 0, 0, 8, 0, 4, 67,
+    67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 3, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0,
+    1, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 0, 0, 16, 0, 4, 63, 63, 63, 63, 63, 63, 63, 254,
+    1, 0, 0, 16, 0, 3, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 0, 63, 63,
+    63, 63, 63, 63, 63, 255, 16, 0, 31, 0, 0, 0, 24, 0, 4, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 3, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 255, 31,
+    0, 16, 0, 0, 0, 0, 0, 2, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 31, 0, 2, 56, 61, 61, 61, 61, 61, 56, 61, 61,
+    61, 61, 56, 61, 254, 255, 0, 0, 30, 0, 2, 61, 56, 61, 61, 56, 61, 61, 56, 61, 56, 61, 56, 61, 56, 254, 255, 0, 0, 29,
+    0, 2, 56, 61, 56, 56, 61, 56, 56, 61, 56, 56, 61, 56, 254, 255, 255, 0, 28, 0, 2, 56, 61, 56, 56, 56, 56, 61, 56, 56,
+    56, 56, 57, 254, 255, 255, 0, 27, 0, 2, 56, 56, 57, 56, 56, 57, 56, 56, 57, 56, 56, 57, 254, 255, 255, 0, 26, 0, 2, 57,
+    56, 57, 56, 57, 56, 57, 56, 57, 57, 56, 57, 57, 254, 255, 255, 0, 25, 0, 2, 57, 57, 57, 56, 57, 57, 57, 57, 56, 57, 57,
+    57, 57, 57, 56, 254, 0, 255, 0, 24, 0, 2, 57, 57, 57, 57, 57, 57, 57, 57, 255, 16, 0, 0, 0, 0, 0, 8, 0, 2, 67,
+    67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 7, 0, 2, 66, 67, 67, 67, 67, 67, 66, 67, 67, 67, 67, 66, 67, 254, 0, 1, 0,
+    6, 0, 2, 67, 66, 67, 67, 66, 67, 67, 66, 67, 66, 67, 66, 67, 66, 254, 0, 1, 0, 5, 0, 2, 66, 67, 66, 66, 67, 66,
+    66, 67, 66, 66, 67, 66, 254, 255, 1, 0, 4, 0, 2, 66, 67, 66, 66, 66, 66, 67, 66, 66, 66, 66, 61, 254, 255, 1, 0, 3,
+    0, 2, 66, 66, 61, 66, 66, 61, 66, 66, 61, 66, 66, 61, 254, 255, 1, 0, 2, 0, 2, 61, 66, 61, 66, 61, 66, 61, 66, 61,
+    61, 66, 61, 61, 254, 255, 1, 0, 1, 0, 2, 61, 61, 61, 66, 61, 61, 61, 61, 66, 61, 61, 61, 61, 61, 66, 254, 255, 0, 0,
+    0, 0, 2, 61, 61, 61, 61, 61, 61, 61, 61, 255, 0, 0, 16, 0, 0, 0, 16, 0, 2, 63, 63, 63, 63, 63, 63, 63, 254, 1,
+    0, 0, 15, 0, 2, 68, 63, 63, 63, 63, 63, 68, 63, 63, 63, 63, 68, 63, 254, 1, 0, 0, 14, 0, 2, 63, 68, 63, 63, 68,
+    63, 63, 68, 63, 68, 63, 68, 63, 68, 254, 1, 0, 0, 13, 0, 2, 68, 63, 68, 68, 63, 68, 68, 63, 68, 68, 63, 68, 254, 1,
+    1, 0, 12, 0, 2, 68, 63, 68, 68, 68, 68, 63, 68, 68, 68, 68, 67, 254, 1, 1, 0, 11, 0, 2, 68, 68, 67, 68, 68, 67,
+    68, 68, 67, 68, 68, 67, 254, 1, 1, 0, 10, 0, 2, 67, 68, 67, 68, 67, 68, 67, 68, 67, 67, 68, 67, 67, 254, 1, 1, 0,
+    9, 0, 2, 67, 67, 67, 68, 67, 67, 67, 67, 68, 67, 67, 67, 67, 67, 68, 254, 0, 1, 0, 8, 0, 2, 67, 67, 67, 67, 67,
+    67, 67, 255, 16, 0, 31, 0, 0, 0, 24, 0, 2, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 23, 0, 2, 58, 57, 57, 57, 57,
+    57, 58, 57, 57, 57, 57, 58, 57, 254, 0, 255, 0, 22, 0, 2, 57, 58, 57, 57, 58, 57, 57, 58, 57, 58, 57, 58, 57, 58, 254,
+    0, 255, 0, 21, 0, 2, 58, 57, 58, 58, 57, 58, 58, 57, 58, 58, 57, 58, 254, 1, 255, 0, 20, 0, 2, 58, 57, 58, 58, 58,
+    58, 57, 58, 58, 58, 58, 63, 254, 1, 255, 0, 19, 0, 2, 58, 58, 63, 58, 58, 63, 58, 58, 63, 58, 58, 63, 254, 1, 255, 0,
+    18, 0, 2, 63, 58, 63, 58, 63, 58, 63, 58, 63, 63, 58, 63, 63, 254, 1, 255, 0, 17, 0, 2, 63, 63, 63, 58, 63, 63, 63,
+    63, 58, 63, 63, 63, 63, 63, 58, 254, 1, 0, 0, 16, 0, 2, 63, 63, 63, 63, 63, 63, 63, 255, 31, 0, 16, 0, 0, 0, 0,
+    0, 4, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 1, 0, 4, 66, 61, 61, 61, 61, 61, 66, 61, 61, 61, 61, 66, 61, 254, 255,
+    0, 0, 2, 0, 4, 61, 66, 61, 61, 66, 61, 61, 66, 61, 66, 61, 66, 61, 66, 254, 255, 0, 0, 3, 0, 4, 66, 61, 66, 66,
+    61, 66, 66, 61, 66, 66, 61, 66, 254, 255, 1, 0, 4, 0, 4, 66, 61, 66, 66, 66, 66, 61, 66, 66, 66, 66, 67, 254, 255, 1,
+    0, 5, 0, 4, 66, 66, 67, 66, 66, 67, 66, 66, 67, 66, 66, 67, 254, 255, 1, 0, 6, 0, 4, 67, 66, 67, 66, 67, 66, 67,
+    66, 67, 67, 66, 67, 67, 254, 255, 1, 0, 7, 0, 4, 67, 67, 67, 66, 67, 67, 67, 67, 66, 67, 67, 67, 67, 67, 66, 254, 0,
+    1, 0, 8, 0, 4, 67, 67, 67, 67, 67, 67, 67, 255, 16, 0, 0, 0, 0, 0, 8, 0, 4, 67, 67, 67, 67, 67, 67, 67, 254,
+    0, 1, 0, 9, 0, 4, 68, 67, 67, 67, 67, 67, 68, 67, 67, 67, 67, 68, 67, 254, 0, 1, 0, 10, 0, 4, 67, 68, 67, 67,
+    68, 67, 67, 68, 67, 68, 67, 68, 67, 68, 254, 0, 1, 0, 11, 0, 4, 68, 67, 68, 68, 67, 68, 68, 67, 68, 68, 67, 68, 254,
+    1, 1, 0, 12, 0, 4, 68, 67, 68, 68, 68, 68, 67, 68, 68, 68, 68, 63, 254, 1, 1, 0, 13, 0, 4, 68, 68, 63, 68, 68,
+    63, 68, 68, 63, 68, 68, 63, 254, 1, 1, 0, 14, 0, 4, 63, 68, 63, 68, 63, 68, 63, 68, 63, 63, 68, 63, 63, 254, 1, 1,
+    0, 15, 0, 4, 63, 63, 63, 68, 63, 63, 63, 63, 68, 63, 63, 63, 63, 63, 68, 254, 1, 0, 0, 16, 0, 4, 63, 63, 63, 63,
+    63, 63, 63, 255, 0, 0, 16, 0, 0, 0, 16, 0, 4, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 17, 0, 4, 58, 63, 63,
+    63, 63, 63, 58, 63, 63, 63, 63, 58, 63, 254, 1, 0, 0, 18, 0, 4, 63, 58, 63, 63, 58, 63, 63, 58, 63, 58, 63, 58, 63,
+    58, 254, 1, 0, 0, 19, 0, 4, 58, 63, 58, 58, 63, 58, 58, 63, 58, 58, 63, 58, 254, 1, 255, 0, 20, 0, 4, 58, 63, 58,
+    58, 58, 58, 63, 58, 58, 58, 58, 57, 254, 1, 255, 0, 21, 0, 4, 58, 58, 57, 58, 58, 57, 58, 58, 57, 58, 58, 57, 254, 1,
+    255, 0, 22, 0, 4, 57, 58, 57, 58, 57, 58, 57, 58, 57, 57, 58, 57, 57, 254, 1, 255, 0, 23, 0, 4, 57, 57, 57, 58, 57,
+    57, 57, 57, 58, 57, 57, 57, 57, 57, 58, 254, 0, 255, 0, 24, 0, 4, 57, 57, 57, 57, 57, 57, 57, 57, 255, 16, 0, 31, 0,
+    0, 0, 24, 0, 4, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 25, 0, 4, 56, 57, 57, 57, 57, 57, 56, 57, 57, 57, 57, 56,
+    57, 254, 0, 255, 0, 26, 0, 4, 57, 56, 57, 57, 56, 57, 57, 56, 57, 56, 57, 56, 57, 56, 254, 0, 255, 0, 27, 0, 4, 56,
+    57, 56, 56, 57, 56, 56, 57, 56, 56, 57, 56, 254, 255, 255, 0, 28, 0, 4, 56, 57, 56, 56, 56, 56, 57, 56, 56, 56, 56, 61,
+    254, 255, 255, 0, 29, 0, 4, 56, 56, 61, 56, 56, 61, 56, 56, 61, 56, 56, 61, 254, 255, 255, 0, 30, 0, 4, 61, 56, 61, 56,
+    61, 56, 61, 56, 61, 61, 56, 61, 61, 254, 255, 255, 0, 31, 0, 4, 61, 61, 61, 56, 61, 61, 61, 61, 56, 61, 61, 61, 61, 61,
+    56, 254, 255, 0, 0, 0, 0, 4, 61, 61, 61, 61, 61, 61, 61, 61, 255, 31, 0, 16, 0, 0, 0, 0, 0, 2, 61, 61, 61, 61,
+    61, 61, 61, 254, 255, 0, 0, 0, 1, 1, 61, 86, 61, 61, 61, 61, 61, 86, 61, 61, 61, 86, 61, 61, 86, 254, 255, 0, 0, 0,
+    2, 0, 61, 86, 61, 86, 61, 86, 61, 255, 16, 0, 0, 0, 0, 0, 8, 0, 2, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0,
+    8, 1, 1, 67, 92, 67, 67, 67, 67, 67, 92, 67, 67, 67, 92, 67, 67, 92, 254, 0, 1, 0, 8, 2, 0, 67, 92, 67, 92, 67,
+    92, 67, 255, 0, 0, 16, 0, 0, 0, 16, 0, 2, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 1, 1, 63, 88, 63, 63,
+    63, 63, 63, 88, 63, 63, 63, 88, 63, 63, 88, 254, 1, 0, 0, 16, 2, 0, 63, 88, 63, 88, 63, 88, 63, 255, 16, 0, 31, 0,
+    0, 0, 24, 0, 2, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 1, 1, 57, 82, 57, 57, 57, 57, 57, 82, 57, 57, 57,
+    82, 57, 57, 82, 254, 0, 255, 0, 24, 2, 0, 57, 82, 57, 82, 57, 82, 57, 255, 31, 0, 16, 0, 0, 0, 0, 0, 4, 61, 61,
+    61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 1, 3, 61, 86, 61, 61, 61, 61, 61, 86, 61, 61, 61, 86, 61, 61, 86, 254, 255, 0,
+    0, 0, 2, 0, 61, 86, 61, 86, 61, 86, 61, 255, 16, 0, 0, 0, 0, 0, 8, 0, 4, 67, 67, 67, 67, 67, 67, 67, 254, 0,
+    1, 0, 8, 1, 3, 67, 92, 67, 67, 67, 67, 67, 92, 67, 67, 67, 92, 67, 67, 92, 254, 0, 1, 0, 8, 2, 0, 67, 92, 67,
+    92, 67, 92, 67, 255, 0, 0, 16, 0, 0, 0, 16, 0, 4, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 1, 3, 63, 88,
+    63, 63, 63, 63, 63, 88, 63, 63, 63, 88, 63, 63, 88, 254, 1, 0, 0, 16, 2, 0, 63, 88, 63, 88, 63, 88, 63, 255, 16, 0,
+    31, 0, 0, 0, 24, 0, 4, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 1, 3, 57, 82, 57, 57, 57, 57, 57, 82, 57,
+    57, 57, 82, 57, 57, 82, 254, 0, 255, 0, 24, 2, 0, 57, 82, 57, 82, 57, 82, 57, 255, 31, 0, 16, 0, 0, 0, 0, 2, 0,
+    61, 86, 61, 86, 61, 86, 61, 254, 255, 0, 1, 0, 1, 1, 61, 61, 86, 61, 61, 86, 61, 61, 61, 86, 61, 61, 61, 254, 255, 0,
+    0, 0, 0, 2, 61, 86, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 0, 0, 8, 2, 0, 67, 92, 67, 92, 67, 92, 67,
+    254, 0, 1, 1, 8, 1, 1, 67, 67, 92, 67, 67, 92, 67, 67, 67, 92, 67, 67, 67, 254, 0, 1, 0, 8, 0, 2, 67, 92, 67,
+    67, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 0, 0, 16, 2, 0, 63, 88, 63, 88, 63, 88, 63, 254, 1, 0, 1, 16, 1, 1,
+    63, 63, 88, 63, 63, 88, 63, 63, 63, 88, 63, 63, 63, 254, 1, 0, 0, 16, 0, 2, 63, 88, 63, 63, 63, 63, 63, 63, 63, 255,
+    16, 0, 31, 0, 0, 0, 24, 2, 0, 57, 82, 57, 82, 57, 82, 57, 254, 0, 255, 1, 24, 1, 1, 57, 57, 82, 57, 57, 82, 57,
+    57, 57, 82, 57, 57, 57, 254, 0, 255, 0, 24, 0, 2, 57, 82, 57, 57, 57, 57, 57, 57, 57, 255, 31, 0, 16, 0, 0, 0, 0,
+    2, 0, 61, 86, 61, 86, 61, 86, 61, 254, 255, 0, 1, 0, 1, 3, 61, 61, 86, 61, 61, 86, 61, 61, 61, 86, 61, 61, 61, 254,
+    255, 0, 0, 0, 0, 4, 61, 86, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 0, 0, 8, 2, 0, 67, 92, 67, 92, 67,
+    92, 67, 254, 0, 1, 1, 8, 1, 3, 67, 67, 92, 67, 67, 92, 67, 67, 67, 92, 67, 67, 67, 254, 0, 1, 0, 8, 0, 4, 67,
+    92, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 0, 0, 16, 2, 0, 63, 88, 63, 88, 63, 88, 63, 254, 1, 0, 1, 16,
+    1, 3, 63, 63, 88, 63, 63, 88, 63, 63, 63, 88, 63, 63, 63, 254, 1, 0, 0, 16, 0, 4, 63, 88, 63, 63, 63, 63, 63, 63,
+    63, 255, 16, 0, 31, 0, 0, 0, 24, 2, 0, 57, 82, 57, 82, 57, 82, 57, 254, 0, 255, 1, 24, 1, 3, 57, 57, 82, 57, 57,
+    82, 57, 57, 57, 82, 57, 57, 57, 254, 0, 255, 0, 24, 0, 4, 57, 82, 57, 57, 57, 57, 57, 57, 57, 255, 31, 0, 16, 0, 8,
+    0, 0, 0, 2, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 255, 0, 5, 1, 61, 61, 61, 61, 61, 36, 61, 61, 61, 36, 61, 61,
+    36, 61, 61, 254, 255, 0, 255, 0, 6, 0, 61, 36, 61, 36, 61, 36, 61, 255, 16, 0, 0, 0, 8, 0, 8, 0, 2, 67, 67, 67,
+    67, 67, 67, 67, 254, 0, 1, 255, 8, 5, 1, 67, 67, 67, 67, 67, 42, 67, 67, 67, 42, 67, 67, 42, 67, 67, 254, 0, 1, 255,
+    8, 6, 0, 67, 42, 67, 42, 67, 42, 67, 255, 0, 0, 16, 0, 8, 0, 16, 0, 2, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0,
+    255, 16, 5, 1, 63, 63, 63, 63, 63, 38, 63, 63, 63, 38, 63, 63, 38, 63, 63, 254, 1, 0, 255, 16, 6, 0, 63, 38, 63, 38,
+    63, 38, 63, 255, 16, 0, 31, 0, 8, 0, 24, 0, 2, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 255, 24, 5, 1, 57, 57, 57,
+    57, 57, 32, 57, 57, 57, 32, 57, 57, 32, 57, 57, 254, 0, 255, 255, 24, 6, 0, 57, 32, 57, 32, 57, 32, 57, 255, 31, 0, 16,
+    0, 8, 0, 0, 0, 4, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 255, 0, 5, 3, 61, 61, 61, 61, 61, 36, 61, 61, 61, 36,
+    61, 61, 36, 61, 61, 254, 255, 0, 255, 0, 6, 0, 61, 36, 61, 36, 61, 36, 61, 255, 16, 0, 0, 0, 8, 0, 8, 0, 4, 67,
+    67, 67, 67, 67, 67, 67, 254, 0, 1, 255, 8, 5, 3, 67, 67, 67, 67, 67, 42, 67, 67, 67, 42, 67, 67, 42, 67, 67, 254, 0,
+    1, 255, 8, 6, 0, 67, 42, 67, 42, 67, 42, 67, 255, 0, 0, 16, 0, 8, 0, 16, 0, 4, 63, 63, 63, 63, 63, 63, 63, 254,
+    1, 0, 255, 16, 5, 3, 63, 63, 63, 63, 63, 38, 63, 63, 63, 38, 63, 63, 38, 63, 63, 254, 1, 0, 255, 16, 6, 0, 63, 38,
+    63, 38, 63, 38, 63, 255, 16, 0, 31, 0, 8, 0, 24, 0, 4, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 255, 24, 5, 3, 57,
+    57, 57, 57, 57, 32, 57, 57, 57, 32, 57, 57, 32, 57, 57, 254, 0, 255, 255, 24, 6, 0, 57, 32, 57, 32, 57, 32, 57, 255, 31,
+    0, 16, 0, 7, 0, 0, 6, 0, 61, 36, 61, 36, 61, 36, 61, 254, 255, 0, 0, 0, 5, 1, 36, 61, 61, 36, 61, 61, 61, 36,
+    61, 61, 61, 61, 61, 254, 255, 0, 255, 0, 0, 2, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 7, 0, 8, 6,
+    0, 67, 42, 67, 42, 67, 42, 67, 254, 0, 1, 0, 8, 5, 1, 42, 67, 67, 42, 67, 67, 67, 42, 67, 67, 67, 67, 67, 254, 0,
+    1, 255, 8, 0, 2, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 7, 0, 16, 6, 0, 63, 38, 63, 38, 63, 38,
+    63, 254, 1, 0, 0, 16, 5, 1, 38, 63, 63, 38, 63, 63, 63, 38, 63, 63, 63, 63, 63, 254, 1, 0, 255, 16, 0, 2, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 255, 16, 0, 31, 0, 7, 0, 24, 6, 0, 57, 32, 57, 32, 57, 32, 57, 254, 0, 255, 0, 24, 5,
+    1, 32, 57, 57, 32, 57, 57, 57, 32, 57, 57, 57, 57, 57, 254, 0, 255, 255, 24, 0, 2, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    255, 31, 0, 16, 0, 7, 0, 0, 6, 0, 61, 36, 61, 36, 61, 36, 61, 254, 255, 0, 0, 0, 5, 3, 36, 61, 61, 36, 61, 61,
+    61, 36, 61, 61, 61, 61, 61, 254, 255, 0, 255, 0, 0, 4, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 7, 0,
+    8, 6, 0, 67, 42, 67, 42, 67, 42, 67, 254, 0, 1, 0, 8, 5, 3, 42, 67, 67, 42, 67, 67, 67, 42, 67, 67, 67, 67, 67,
+    254, 0, 1, 255, 8, 0, 4, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 7, 0, 16, 6, 0, 63, 38, 63, 38,
+    63, 38, 63, 254, 1, 0, 0, 16, 5, 3, 38, 63, 63, 38, 63, 63, 63, 38, 63, 63, 63, 63, 63, 254, 1, 0, 255, 16, 0, 4,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 255, 16, 0, 31, 0, 7, 0, 24, 6, 0, 57, 32, 57, 32, 57, 32, 57, 254, 0, 255, 0,
+    24, 5, 3, 32, 57, 57, 32, 57, 57, 57, 32, 57, 57, 57, 57, 57, 254, 0, 255, 255, 24, 0, 4, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 255, 31, 0, 16, 0, 0, 0, 0, 0, 2, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 0, 0, 8, 0, 2, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 0,
+    0, 16, 0, 2, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 255, 16, 0, 31, 0, 0, 0, 24, 0, 2, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 255, 31, 0, 16, 0, 0, 0, 0, 0, 4, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0,
+    0, 0, 0, 0, 8, 0, 4, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 0, 0, 16, 0, 4, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 255, 16, 0, 31, 0, 0, 0, 24, 0, 4, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    255, 31, 0, 16, 0, 0, 0, 0, 2, 0, 61, 86, 61, 86, 61, 86, 254, 255, 0, 0, 31, 2, 0, 81, 61, 86, 61, 86, 61, 81,
+    86, 61, 61, 86, 56, 86, 254, 255, 0, 1, 30, 2, 0, 61, 81, 61, 86, 56, 86, 61, 81, 61, 81, 86, 56, 86, 56, 254, 255, 0,
+    1, 29, 2, 0, 56, 86, 81, 56, 86, 56, 81, 86, 56, 81, 86, 56, 254, 255, 255, 1, 28, 2, 0, 56, 86, 81, 56, 81, 81, 61,
+    81, 56, 81, 81, 57, 254, 255, 255, 1, 27, 2, 0, 81, 56, 82, 56, 81, 82, 56, 81, 82, 56, 81, 57, 254, 255, 255, 1, 26, 2,
+    0, 82, 56, 82, 56, 82, 56, 82, 81, 57, 82, 56, 82, 57, 254, 255, 255, 1, 25, 2, 0, 57, 82, 57, 81, 82, 57, 82, 57, 56,
+    82, 82, 57, 82, 57, 81, 254, 0, 255, 0, 24, 2, 0, 82, 57, 82, 57, 82, 57, 82, 82, 255, 16, 0, 0, 0, 0, 0, 8, 2,
+    0, 67, 67, 92, 67, 92, 67, 92, 254, 0, 1, 0, 7, 2, 0, 91, 67, 92, 67, 92, 67, 91, 92, 67, 67, 92, 66, 92, 254, 0,
+    1, 1, 6, 2, 0, 67, 91, 67, 92, 66, 92, 67, 91, 67, 91, 92, 66, 92, 66, 254, 0, 1, 1, 5, 2, 0, 66, 92, 91, 66,
+    92, 66, 91, 92, 66, 91, 92, 66, 254, 255, 1, 1, 4, 2, 0, 66, 92, 91, 66, 91, 91, 67, 91, 66, 91, 91, 61, 254, 255, 1,
+    1, 3, 2, 0, 91, 66, 86, 66, 91, 86, 66, 91, 86, 66, 91, 61, 254, 255, 1, 1, 2, 2, 0, 86, 66, 86, 66, 86, 66, 86,
+    91, 61, 86, 66, 86, 61, 254, 255, 1, 1, 1, 2, 0, 61, 86, 61, 91, 86, 61, 86, 61, 66, 86, 86, 61, 86, 61, 91, 254, 255,
+    0, 0, 0, 2, 0, 86, 61, 86, 61, 86, 61, 86, 86, 255, 0, 0, 16, 0, 0, 0, 16, 2, 0, 63, 63, 88, 63, 88, 63, 88,
+    254, 1, 0, 0, 15, 2, 0, 93, 88, 63, 63, 88, 63, 93, 88, 63, 88, 63, 93, 63, 254, 1, 0, 1, 14, 2, 0, 63, 93, 63,
+    88, 68, 88, 63, 93, 88, 68, 88, 68, 88, 68, 254, 1, 0, 1, 13, 2, 0, 93, 63, 93, 68, 88, 93, 68, 88, 68, 93, 88, 68,
+    254, 1, 1, 1, 12, 2, 0, 93, 63, 93, 68, 93, 93, 88, 68, 93, 68, 93, 92, 254, 1, 1, 0, 11, 2, 0, 93, 93, 67, 93,
+    68, 92, 93, 68, 92, 68, 93, 92, 254, 1, 1, 0, 10, 2, 0, 92, 68, 92, 93, 67, 93, 67, 93, 92, 67, 93, 67, 92, 254, 1,
+    1, 0, 9, 2, 0, 92, 67, 92, 68, 92, 67, 92, 67, 93, 92, 67, 92, 67, 67, 93, 254, 0, 1, 1, 8, 2, 0, 67, 92, 67,
+    92, 67, 92, 67, 255, 16, 0, 31, 0, 0, 0, 24, 2, 0, 57, 82, 57, 82, 57, 82, 254, 0, 255, 0, 23, 2, 0, 83, 82, 57,
+    57, 82, 57, 83, 82, 57, 82, 57, 83, 57, 254, 0, 255, 1, 22, 2, 0, 57, 83, 57, 82, 58, 82, 57, 83, 82, 58, 82, 58, 82,
+    58, 254, 0, 255, 1, 21, 2, 0, 83, 57, 83, 58, 82, 83, 58, 82, 58, 83, 82, 58, 254, 1, 255, 1, 20, 2, 0, 83, 57, 83,
+    58, 83, 83, 82, 58, 83, 58, 83, 88, 254, 1, 255, 0, 19, 2, 0, 83, 83, 63, 83, 58, 88, 83, 58, 88, 58, 83, 88, 254, 1,
+    255, 0, 18, 2, 0, 88, 58, 88, 83, 63, 83, 63, 83, 88, 63, 83, 63, 88, 254, 1, 255, 0, 17, 2, 0, 88, 63, 88, 58, 88,
+    63, 88, 63, 83, 88, 63, 88, 63, 63, 83, 254, 1, 0, 1, 16, 2, 0, 63, 88, 63, 88, 63, 88, 63, 255, 31, 0, 16, 0, 0,
+    0, 0, 2, 0, 61, 86, 61, 86, 61, 86, 254, 255, 0, 0, 1, 2, 0, 91, 86, 61, 61, 86, 61, 91, 86, 61, 86, 61, 91, 61,
+    254, 255, 0, 1, 2, 2, 0, 61, 91, 61, 86, 66, 86, 61, 91, 86, 66, 86, 66, 86, 66, 254, 255, 0, 1, 3, 2, 0, 91, 61,
+    91, 66, 86, 91, 66, 86, 66, 91, 86, 66, 254, 255, 1, 1, 4, 2, 0, 91, 61, 91, 66, 91, 91, 86, 66, 91, 66, 91, 92, 254,
+    255, 1, 0, 5, 2, 0, 91, 91, 67, 91, 66, 92, 91, 66, 92, 66, 91, 92, 254, 255, 1, 0, 6, 2, 0, 92, 66, 92, 91, 67,
+    91, 67, 91, 92, 67, 91, 67, 92, 254, 255, 1, 0, 7, 2, 0, 92, 67, 92, 66, 92, 67, 92, 67, 91, 92, 67, 92, 67, 67, 91,
+    254, 0, 1, 1, 8, 2, 0, 67, 92, 67, 92, 67, 92, 67, 255, 16, 0, 0, 0, 0, 0, 8, 2, 0, 67, 67, 92, 67, 92, 67,
+    92, 254, 0, 1, 0, 9, 2, 0, 93, 92, 67, 67, 92, 67, 93, 92, 67, 92, 67, 93, 67, 254, 0, 1, 1, 10, 2, 0, 67, 93,
+    67, 92, 68, 92, 67, 93, 92, 68, 92, 68, 92, 68, 254, 0, 1, 1, 11, 2, 0, 93, 67, 93, 68, 92, 93, 68, 92, 68, 93, 92,
+    68, 254, 1, 1, 1, 12, 2, 0, 93, 67, 93, 68, 93, 93, 92, 68, 93, 68, 93, 88, 254, 1, 1, 0, 13, 2, 0, 93, 93, 63,
+    93, 68, 88, 93, 68, 88, 68, 93, 88, 254, 1, 1, 0, 14, 2, 0, 88, 68, 88, 93, 63, 93, 63, 93, 88, 63, 93, 63, 88, 254,
+    1, 1, 0, 15, 2, 0, 88, 63, 88, 68, 88, 63, 88, 63, 93, 88, 63, 88, 63, 63, 93, 254, 1, 0, 1, 16, 2, 0, 63, 88,
+    63, 88, 63, 88, 63, 255, 0, 0, 16, 0, 0, 0, 16, 2, 0, 63, 63, 88, 63, 88, 63, 88, 254, 1, 0, 0, 17, 2, 0, 83,
+    63, 88, 63, 88, 63, 83, 88, 63, 63, 88, 58, 88, 254, 1, 0, 1, 18, 2, 0, 63, 83, 63, 88, 58, 88, 63, 83, 63, 83, 88,
+    58, 88, 58, 254, 1, 0, 1, 19, 2, 0, 58, 88, 83, 58, 88, 58, 83, 88, 58, 83, 88, 58, 254, 1, 255, 1, 20, 2, 0, 58,
+    88, 83, 58, 83, 83, 63, 83, 58, 83, 83, 57, 254, 1, 255, 1, 21, 2, 0, 83, 58, 82, 58, 83, 82, 58, 83, 82, 58, 83, 57,
+    254, 1, 255, 1, 22, 2, 0, 82, 58, 82, 58, 82, 58, 82, 83, 57, 82, 58, 82, 57, 254, 1, 255, 1, 23, 2, 0, 57, 82, 57,
+    83, 82, 57, 82, 57, 58, 82, 82, 57, 82, 57, 83, 254, 0, 255, 0, 24, 2, 0, 82, 57, 82, 57, 82, 57, 82, 82, 255, 16, 0,
+    31, 0, 0, 0, 24, 2, 0, 57, 82, 57, 82, 57, 82, 254, 0, 255, 0, 25, 2, 0, 81, 57, 82, 57, 82, 57, 81, 82, 57, 57,
+    82, 56, 82, 254, 0, 255, 1, 26, 2, 0, 57, 81, 57, 82, 56, 82, 57, 81, 57, 81, 82, 56, 82, 56, 254, 0, 255, 1, 27, 2,
+    0, 56, 82, 81, 56, 82, 56, 81, 82, 56, 81, 82, 56, 254, 255, 255, 1, 28, 2, 0, 56, 82, 81, 56, 81, 81, 82, 56, 81, 56,
+    81, 86, 254, 255, 255, 0, 29, 2, 0, 81, 81, 61, 81, 56, 86, 81, 56, 86, 56, 81, 86, 254, 255, 255, 0, 30, 2, 0, 86, 56,
+    86, 56, 86, 81, 61, 81, 61, 86, 56, 86, 86, 254, 255, 255, 0, 31, 2, 0, 86, 61, 86, 56, 86, 61, 86, 61, 81, 61, 86, 61,
+    86, 61, 81, 254, 255, 0, 0, 0, 2, 0, 86, 61, 86, 61, 86, 61, 86, 86, 255, 31, 0, 16, 0, 15, 0, 0, 6, 0, 61, 36,
+    61, 36, 61, 36, 254, 255, 0, 0, 31, 6, 0, 31, 61, 36, 61, 36, 61, 31, 36, 61, 61, 36, 56, 36, 254, 255, 0, 255, 30, 6,
+    0, 61, 31, 61, 36, 56, 36, 61, 31, 61, 31, 36, 56, 36, 56, 254, 255, 0, 255, 29, 6, 0, 56, 36, 31, 56, 36, 56, 31, 36,
+    56, 31, 36, 56, 254, 255, 255, 255, 28, 6, 0, 56, 36, 31, 56, 31, 31, 61, 31, 56, 31, 31, 57, 254, 255, 255, 255, 27, 6, 0,
+    31, 56, 32, 56, 31, 32, 56, 31, 32, 56, 31, 57, 254, 255, 255, 255, 26, 6, 0, 32, 56, 32, 56, 32, 56, 32, 31, 57, 32, 56,
+    32, 57, 254, 255, 255, 255, 25, 6, 0, 57, 32, 57, 31, 32, 57, 32, 57, 56, 32, 32, 57, 32, 57, 31, 254, 0, 255, 0, 24, 6,
+    0, 32, 57, 32, 57, 32, 57, 32, 32, 255, 16, 0, 0, 0, 15, 0, 8, 6, 0, 67, 67, 42, 67, 42, 67, 42, 254, 0, 1, 0,
+    7, 6, 0, 41, 67, 42, 67, 42, 67, 41, 42, 67, 67, 42, 66, 42, 254, 0, 1, 255, 6, 6, 0, 67, 41, 67, 42, 66, 42, 67,
+    41, 67, 41, 42, 66, 42, 66, 254, 0, 1, 255, 5, 6, 0, 66, 42, 41, 66, 42, 66, 41, 42, 66, 41, 42, 66, 254, 255, 1, 255,
+    4, 6, 0, 66, 42, 41, 66, 41, 41, 67, 41, 66, 41, 41, 61, 254, 255, 1, 255, 3, 6, 0, 41, 66, 36, 66, 41, 36, 66, 41,
+    36, 66, 41, 61, 254, 255, 1, 255, 2, 6, 0, 36, 66, 36, 66, 36, 66, 36, 41, 61, 36, 66, 36, 61, 254, 255, 1, 255, 1, 6,
+    0, 61, 36, 61, 41, 36, 61, 36, 61, 66, 36, 36, 61, 36, 61, 41, 254, 255, 0, 0, 0, 6, 0, 36, 61, 36, 61, 36, 61, 36,
+    36, 255, 0, 0, 16, 0, 15, 0, 16, 6, 0, 63, 63, 38, 63, 38, 63, 38, 254, 1, 0, 0, 15, 6, 0, 43, 38, 63, 63, 38,
+    63, 43, 38, 63, 38, 63, 43, 63, 254, 1, 0, 255, 14, 6, 0, 63, 43, 63, 38, 68, 38, 63, 43, 38, 68, 38, 68, 38, 68, 254,
+    1, 0, 255, 13, 6, 0, 43, 63, 43, 68, 38, 43, 68, 38, 68, 43, 38, 68, 254, 1, 1, 255, 12, 6, 0, 43, 63, 43, 68, 43,
+    43, 38, 68, 43, 68, 43, 42, 254, 1, 1, 0, 11, 6, 0, 43, 43, 67, 43, 68, 42, 43, 68, 42, 68, 43, 42, 254, 1, 1, 0,
+    10, 6, 0, 42, 68, 42, 43, 67, 43, 67, 43, 42, 67, 43, 67, 42, 254, 1, 1, 0, 9, 6, 0, 42, 67, 42, 68, 42, 67, 42,
+    67, 43, 42, 67, 42, 67, 67, 43, 254, 0, 1, 255, 8, 6, 0, 67, 42, 67, 42, 67, 42, 67, 255, 16, 0, 31, 0, 15, 0, 24,
+    6, 0, 57, 32, 57, 32, 57, 32, 254, 0, 255, 0, 23, 6, 0, 33, 32, 57, 57, 32, 57, 33, 32, 57, 32, 57, 33, 57, 254, 0,
+    255, 255, 22, 6, 0, 57, 33, 57, 32, 58, 32, 57, 33, 32, 58, 32, 58, 32, 58, 254, 0, 255, 255, 21, 6, 0, 33, 57, 33, 58,
+    32, 33, 58, 32, 58, 33, 32, 58, 254, 1, 255, 255, 20, 6, 0, 33, 57, 33, 58, 33, 33, 32, 58, 33, 58, 33, 38, 254, 1, 255,
+    0, 19, 6, 0, 33, 33, 63, 33, 58, 38, 33, 58, 38, 58, 33, 38, 254, 1, 255, 0, 18, 6, 0, 38, 58, 38, 33, 63, 33, 63,
+    33, 38, 63, 33, 63, 38, 254, 1, 255, 0, 17, 6, 0, 38, 63, 38, 58, 38, 63, 38, 63, 33, 38, 63, 38, 63, 63, 33, 254, 1,
+    0, 255, 16, 6, 0, 63, 38, 63, 38, 63, 38, 63, 255, 31, 0, 16, 0, 15, 0, 0, 6, 0, 61, 36, 61, 36, 61, 36, 254, 255,
+    0, 0, 1, 6, 0, 41, 36, 61, 61, 36, 61, 41, 36, 61, 36, 61, 41, 61, 254, 255, 0, 255, 2, 6, 0, 61, 41, 61, 36, 66,
+    36, 61, 41, 36, 66, 36, 66, 36, 66, 254, 255, 0, 255, 3, 6, 0, 41, 61, 41, 66, 36, 41, 66, 36, 66, 41, 36, 66, 254, 255,
+    1, 255, 4, 6, 0, 41, 61, 41, 66, 41, 41, 36, 66, 41, 66, 41, 42, 254, 255, 1, 0, 5, 6, 0, 41, 41, 67, 41, 66, 42,
+    41, 66, 42, 66, 41, 42, 254, 255, 1, 0, 6, 6, 0, 42, 66, 42, 41, 67, 41, 67, 41, 42, 67, 41, 67, 42, 254, 255, 1, 0,
+    7, 6, 0, 42, 67, 42, 66, 42, 67, 42, 67, 41, 42, 67, 42, 67, 67, 41, 254, 0, 1, 255, 8, 6, 0, 67, 42, 67, 42, 67,
+    42, 67, 255, 16, 0, 0, 0, 15, 0, 8, 6, 0, 67, 67, 42, 67, 42, 67, 42, 254, 0, 1, 0, 9, 6, 0, 43, 42, 67, 67,
+    42, 67, 43, 42, 67, 42, 67, 43, 67, 254, 0, 1, 255, 10, 6, 0, 67, 43, 67, 42, 68, 42, 67, 43, 42, 68, 42, 68, 42, 68,
+    254, 0, 1, 255, 11, 6, 0, 43, 67, 43, 68, 42, 43, 68, 42, 68, 43, 42, 68, 254, 1, 1, 255, 12, 6, 0, 43, 67, 43, 68,
+    43, 43, 42, 68, 43, 68, 43, 38, 254, 1, 1, 0, 13, 6, 0, 43, 43, 63, 43, 68, 38, 43, 68, 38, 68, 43, 38, 254, 1, 1,
+    0, 14, 6, 0, 38, 68, 38, 43, 63, 43, 63, 43, 38, 63, 43, 63, 38, 254, 1, 1, 0, 15, 6, 0, 38, 63, 38, 68, 38, 63,
+    38, 63, 43, 38, 63, 38, 63, 63, 43, 254, 1, 0, 255, 16, 6, 0, 63, 38, 63, 38, 63, 38, 63, 255, 0, 0, 16, 0, 15, 0,
+    16, 6, 0, 63, 63, 38, 63, 38, 63, 38, 254, 1, 0, 0, 17, 6, 0, 33, 63, 38, 63, 38, 63, 33, 38, 63, 63, 38, 58, 38,
+    254, 1, 0, 255, 18, 6, 0, 63, 33, 63, 38, 58, 38, 63, 33, 63, 33, 38, 58, 38, 58, 254, 1, 0, 255, 19, 6, 0, 58, 38,
+    33, 58, 38, 58, 33, 38, 58, 33, 38, 58, 254, 1, 255, 255, 20, 6, 0, 58, 38, 33, 58, 33, 33, 63, 33, 58, 33, 33, 57, 254,
+    1, 255, 255, 21, 6, 0, 33, 58, 32, 58, 33, 32, 58, 33, 32, 58, 33, 57, 254, 1, 255, 255, 22, 6, 0, 32, 58, 32, 58, 32,
+    58, 32, 33, 57, 32, 58, 32, 57, 254, 1, 255, 255, 23, 6, 0, 57, 32, 57, 33, 32, 57, 32, 57, 58, 32, 32, 57, 32, 57, 33,
+    254, 0, 255, 0, 24, 6, 0, 32, 57, 32, 57, 32, 57, 32, 32, 255, 16, 0, 31, 0, 15, 0, 24, 6, 0, 57, 32, 57, 32, 57,
+    32, 254, 0, 255, 0, 25, 6, 0, 31, 57, 32, 57, 32, 57, 31, 32, 57, 57, 32, 56, 32, 254, 0, 255, 255, 26, 6, 0, 57, 31,
+    57, 32, 56, 32, 57, 31, 57, 31, 32, 56, 32, 56, 254, 0, 255, 255, 27, 6, 0, 56, 32, 31, 56, 32, 56, 31, 32, 56, 31, 32,
+    56, 254, 255, 255, 255, 28, 6, 0, 56, 32, 31, 56, 31, 31, 57, 31, 56, 31, 31, 61, 254, 255, 255, 255, 29, 6, 0, 31, 56, 36,
+    56, 31, 36, 56, 31, 36, 56, 31, 61, 254, 255, 255, 255, 30, 6, 0, 36, 56, 36, 56, 36, 56, 36, 31, 61, 36, 56, 36, 61, 254,
+    255, 255, 255, 31, 6, 0, 61, 36, 61, 31, 36, 61, 36, 61, 56, 36, 36, 61, 36, 61, 31, 254, 255, 0, 0, 0, 6, 0, 36, 61,
+    36, 61, 36, 61, 36, 36, 255, 32, 0, 16, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 31, 0, 0,
+    56, 61, 61, 61, 61, 61, 56, 61, 61, 61, 61, 56, 61, 254, 255, 0, 0, 30, 0, 0, 61, 56, 61, 61, 56, 61, 61, 56, 61, 56,
+    61, 56, 61, 254, 255, 255, 0, 29, 0, 0, 61, 56, 61, 56, 56, 61, 56, 56, 61, 56, 56, 61, 56, 56, 61, 56, 56, 61, 56, 56,
+    61, 56, 61, 254, 255, 255, 0, 30, 0, 0, 61, 56, 61, 56, 61, 56, 61, 61, 56, 61, 61, 56, 254, 255, 0, 0, 31, 0, 0, 61,
+    61, 56, 61, 61, 61, 61, 56, 61, 61, 61, 61, 61, 56, 254, 255, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0,
+    0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 7, 0, 0, 66, 67, 67, 67, 67, 67, 66, 67, 67,
+    67, 67, 66, 67, 254, 0, 1, 0, 6, 0, 0, 67, 66, 67, 67, 66, 67, 67, 66, 67, 66, 67, 66, 67, 254, 255, 1, 0, 5, 0,
+    0, 67, 66, 67, 66, 66, 67, 66, 66, 67, 66, 66, 67, 66, 66, 67, 66, 66, 67, 66, 66, 67, 66, 67, 254, 255, 1, 0, 6, 0,
+    0, 67, 66, 67, 66, 67, 66, 67, 67, 66, 67, 67, 66, 254, 0, 1, 0, 7, 0, 0, 67, 67, 66, 67, 67, 67, 67, 66, 67, 67,
+    67, 67, 67, 66, 254, 0, 1, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63,
+    63, 63, 63, 63, 63, 254, 1, 0, 0, 15, 0, 0, 68, 63, 63, 63, 63, 63, 68, 63, 63, 63, 63, 68, 63, 254, 1, 0, 0, 14,
+    0, 0, 63, 68, 63, 63, 68, 63, 63, 68, 63, 68, 63, 68, 63, 254, 1, 1, 0, 13, 0, 0, 63, 68, 63, 68, 68, 63, 68, 68,
+    63, 68, 68, 63, 68, 68, 63, 68, 68, 63, 68, 68, 63, 68, 63, 254, 1, 1, 0, 14, 0, 0, 63, 68, 63, 68, 63, 68, 63, 63,
+    68, 63, 63, 68, 254, 1, 0, 0, 15, 0, 0, 63, 63, 68, 63, 63, 63, 63, 68, 63, 63, 63, 63, 63, 68, 254, 1, 0, 0, 16,
+    0, 0, 63, 63, 63, 63, 63, 63, 63, 255, 16, 0, 32, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0,
+    23, 0, 0, 58, 57, 57, 57, 57, 57, 58, 57, 57, 57, 57, 58, 57, 254, 0, 255, 0, 22, 0, 0, 57, 58, 57, 57, 58, 57, 57,
+    58, 57, 58, 57, 58, 57, 254, 1, 255, 0, 21, 0, 0, 57, 58, 57, 58, 58, 57, 58, 58, 57, 58, 58, 57, 58, 58, 57, 58, 58,
+    57, 58, 58, 57, 58, 57, 254, 1, 255, 0, 22, 0, 0, 57, 58, 57, 58, 57, 58, 57, 57, 58, 57, 57, 58, 254, 0, 255, 0, 23,
+    0, 0, 57, 57, 58, 57, 57, 57, 57, 58, 57, 57, 57, 57, 57, 58, 254, 0, 255, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57,
+    255, 32, 0, 16, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 1, 0, 0, 66, 61, 61, 61, 61, 61,
+    66, 61, 61, 61, 61, 66, 61, 254, 255, 0, 0, 2, 0, 0, 61, 66, 61, 61, 66, 61, 61, 66, 61, 66, 61, 66, 61, 254, 255, 1,
+    0, 3, 0, 0, 61, 66, 61, 66, 66, 61, 66, 66, 61, 66, 66, 61, 66, 66, 61, 66, 66, 61, 66, 66, 61, 66, 61, 254, 255, 1,
+    0, 2, 0, 0, 61, 66, 61, 66, 61, 66, 61, 61, 66, 61, 61, 66, 254, 255, 0, 0, 1, 0, 0, 61, 61, 66, 61, 61, 61, 61,
+    66, 61, 61, 61, 61, 61, 66, 254, 255, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 0, 0, 8, 0,
+    0, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 9, 0, 0, 68, 67, 67, 67, 67, 67, 68, 67, 67, 67, 67, 68, 67, 254, 0,
+    1, 0, 10, 0, 0, 67, 68, 67, 67, 68, 67, 67, 68, 67, 68, 67, 68, 67, 254, 1, 1, 0, 11, 0, 0, 67, 68, 67, 68, 68,
+    67, 68, 68, 67, 68, 68, 67, 68, 68, 67, 68, 68, 67, 68, 68, 67, 68, 67, 254, 1, 1, 0, 10, 0, 0, 67, 68, 67, 68, 67,
+    68, 67, 67, 68, 67, 67, 68, 254, 0, 1, 0, 9, 0, 0, 67, 67, 68, 67, 67, 67, 67, 68, 67, 67, 67, 67, 67, 68, 254, 0,
+    1, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 254,
+    1, 0, 0, 17, 0, 0, 58, 63, 63, 63, 63, 63, 58, 63, 63, 63, 63, 58, 63, 254, 1, 0, 0, 18, 0, 0, 63, 58, 63, 63,
+    58, 63, 63, 58, 63, 58, 63, 58, 63, 254, 1, 255, 0, 19, 0, 0, 63, 58, 63, 58, 58, 63, 58, 58, 63, 58, 58, 63, 58, 58,
+    63, 58, 58, 63, 58, 58, 63, 58, 63, 254, 1, 255, 0, 18, 0, 0, 63, 58, 63, 58, 63, 58, 63, 63, 58, 63, 63, 58, 254, 1,
+    0, 0, 17, 0, 0, 63, 63, 58, 63, 63, 63, 63, 58, 63, 63, 63, 63, 63, 58, 254, 1, 0, 0, 16, 0, 0, 63, 63, 63, 63,
+    63, 63, 63, 255, 16, 0, 32, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 25, 0, 0, 56, 57, 57,
+    57, 57, 57, 56, 57, 57, 57, 57, 56, 57, 254, 0, 255, 0, 26, 0, 0, 57, 56, 57, 57, 56, 57, 57, 56, 57, 56, 57, 56, 57,
+    254, 255, 255, 0, 27, 0, 0, 57, 56, 57, 56, 56, 57, 56, 56, 57, 56, 56, 57, 56, 56, 57, 56, 56, 57, 56, 56, 57, 56, 57,
+    254, 255, 255, 0, 26, 0, 0, 57, 56, 57, 56, 57, 56, 57, 57, 56, 57, 57, 56, 254, 0, 255, 0, 25, 0, 0, 57, 57, 56, 57,
+    57, 57, 57, 56, 57, 57, 57, 57, 57, 56, 254, 0, 255, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 255, 31, 0, 16, 0, 0,
+    0, 0, 2, 0, 56, 86, 61, 86, 61, 86, 61, 61, 86, 56, 86, 61, 86, 61, 86, 61, 86, 61, 254, 255, 0, 1, 0, 3, 0, 56,
+    86, 61, 86, 61, 86, 86, 86, 86, 56, 86, 86, 86, 61, 86, 86, 86, 81, 86, 86, 86, 86, 254, 255, 0, 1, 0, 4, 0, 86, 86,
+    87, 81, 86, 86, 87, 86, 86, 86, 87, 86, 82, 86, 86, 254, 0, 0, 1, 0, 9, 0, 86, 86, 87, 86, 87, 82, 86, 87, 87, 86,
+    87, 87, 86, 87, 87, 81, 87, 87, 86, 87, 254, 0, 0, 1, 0, 10, 0, 87, 86, 87, 87, 82, 87, 86, 87, 87, 87, 87, 87, 87,
+    87, 87, 82, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 0, 11, 0, 82, 88, 87, 87, 87, 87, 88, 87, 87, 87,
+    83, 87, 87, 254, 1, 0, 1, 0, 12, 0, 87, 88, 87, 88, 87, 87, 83, 87, 254, 1, 0, 1, 0, 13, 0, 87, 88, 88, 87, 88,
+    88, 83, 254, 1, 0, 1, 0, 14, 0, 88, 88, 63, 88, 254, 1, 0, 1, 0, 15, 0, 88, 83, 63, 88, 254, 1, 0, 0, 0, 16,
+    0, 63, 88, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 0, 23, 0, 63, 38, 63, 63, 254, 1, 0, 255, 0, 22, 0,
+    63, 33, 38, 38, 254, 1, 0, 255, 0, 21, 0, 63, 38, 38, 38, 33, 38, 38, 254, 0, 0, 255, 0, 20, 0, 38, 38, 37, 38, 37,
+    33, 37, 37, 254, 1, 0, 255, 0, 19, 0, 37, 38, 37, 38, 37, 37, 33, 37, 37, 37, 38, 37, 37, 254, 0, 0, 255, 0, 18, 0,
+    37, 38, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 36, 37, 32, 254, 0, 0, 255,
+    0, 17, 0, 37, 36, 37, 37, 37, 36, 37, 37, 31, 37, 37, 36, 37, 37, 36, 37, 37, 36, 32, 37, 254, 255, 0, 255, 0, 8, 0,
+    37, 36, 36, 37, 36, 36, 37, 31, 37, 36, 36, 36, 37, 36, 36, 254, 255, 255, 255, 0, 7, 0, 37, 36, 36, 36, 36, 36, 36, 36,
+    31, 36, 36, 36, 61, 36, 36, 36, 56, 36, 36, 36, 36, 61, 254, 255, 0, 255, 0, 6, 0, 61, 36, 56, 36, 61, 36, 61, 36, 61,
+    36, 61, 36, 56, 36, 61, 61, 36, 61, 36, 61, 36, 56, 255, 16, 0, 0, 0, 0, 0, 8, 2, 0, 66, 92, 67, 92, 67, 92, 67,
+    67, 92, 66, 92, 67, 92, 67, 92, 67, 92, 67, 254, 0, 1, 1, 8, 3, 0, 66, 92, 67, 92, 67, 92, 92, 92, 92, 66, 92, 92,
+    92, 67, 92, 92, 92, 91, 92, 92, 92, 92, 254, 0, 1, 1, 8, 4, 0, 92, 92, 87, 91, 92, 92, 87, 92, 92, 92, 87, 92, 86,
+    92, 92, 254, 0, 0, 1, 8, 9, 0, 92, 92, 87, 92, 87, 86, 92, 87, 87, 92, 87, 87, 92, 87, 87, 91, 87, 87, 92, 87, 254,
+    0, 0, 1, 8, 10, 0, 87, 92, 87, 87, 86, 87, 92, 87, 87, 87, 87, 87, 87, 87, 87, 86, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 254, 0, 0, 1, 8, 11, 0, 86, 82, 87, 87, 87, 87, 82, 87, 87, 87, 81, 87, 87, 254, 0, 255, 1, 8, 12, 0, 87,
+    82, 87, 82, 87, 87, 81, 87, 254, 0, 255, 1, 8, 13, 0, 87, 82, 82, 87, 82, 82, 81, 254, 0, 255, 1, 8, 14, 0, 82, 82,
+    57, 82, 254, 0, 255, 1, 8, 15, 0, 82, 81, 57, 82, 254, 0, 255, 0, 8, 16, 0, 57, 82, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 254, 0, 255, 0, 8, 23, 0, 57, 32, 57, 57, 254, 0, 255, 255, 8, 22, 0, 57, 31, 32, 32, 254, 0, 255, 255, 8, 21, 0,
+    57, 32, 32, 32, 31, 32, 32, 254, 0, 0, 255, 8, 20, 0, 32, 32, 37, 32, 37, 31, 37, 37, 254, 0, 255, 255, 8, 19, 0, 37,
+    32, 37, 32, 37, 37, 31, 37, 37, 37, 32, 37, 37, 254, 0, 0, 255, 8, 18, 0, 37, 32, 36, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 36, 37, 37, 37, 37, 37, 37, 37, 37, 42, 37, 36, 254, 0, 0, 255, 8, 17, 0, 37, 42, 37, 37, 37, 42, 37, 37,
+    41, 37, 37, 42, 37, 37, 42, 37, 37, 42, 36, 37, 254, 0, 1, 255, 8, 8, 0, 37, 42, 42, 37, 42, 42, 37, 41, 37, 42, 42,
+    42, 37, 42, 42, 254, 255, 1, 255, 8, 7, 0, 37, 42, 42, 42, 42, 42, 42, 42, 41, 42, 42, 42, 67, 42, 42, 42, 66, 42, 42,
+    42, 42, 67, 254, 0, 1, 255, 8, 6, 0, 67, 42, 66, 42, 67, 42, 67, 42, 67, 42, 67, 42, 66, 42, 67, 67, 42, 67, 42, 67,
+    42, 66, 255, 0, 0, 16, 0, 0, 0, 16, 2, 0, 63, 88, 63, 88, 63, 88, 63, 63, 88, 68, 88, 63, 88, 63, 88, 63, 88, 63,
+    254, 1, 0, 1, 16, 3, 0, 68, 88, 63, 88, 63, 88, 88, 88, 88, 68, 88, 88, 88, 63, 88, 88, 88, 93, 88, 88, 88, 88, 254,
+    1, 0, 1, 16, 4, 0, 88, 88, 87, 93, 88, 88, 87, 88, 88, 88, 87, 93, 87, 88, 88, 254, 0, 0, 1, 16, 9, 0, 88, 88,
+    87, 88, 87, 92, 88, 87, 87, 88, 87, 87, 88, 87, 87, 93, 87, 87, 88, 87, 254, 0, 0, 1, 16, 10, 0, 87, 88, 87, 87, 92,
+    87, 88, 87, 87, 87, 87, 87, 87, 87, 87, 92, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 16, 11, 0, 92, 86,
+    87, 87, 87, 87, 86, 87, 87, 87, 91, 87, 87, 254, 255, 0, 1, 16, 12, 0, 87, 86, 87, 86, 87, 87, 91, 87, 254, 255, 0, 1,
+    16, 13, 0, 87, 86, 86, 87, 86, 86, 91, 254, 255, 0, 1, 16, 14, 0, 86, 86, 61, 86, 254, 255, 0, 1, 16, 15, 0, 86, 91,
+    61, 86, 254, 255, 0, 0, 16, 16, 0, 61, 86, 61, 61, 61, 61, 61, 66, 61, 61, 61, 254, 255, 0, 0, 16, 23, 0, 61, 36, 61,
+    61, 254, 255, 0, 255, 16, 22, 0, 61, 41, 36, 36, 254, 255, 0, 255, 16, 21, 0, 61, 36, 36, 36, 41, 36, 36, 254, 0, 0, 255,
+    16, 20, 0, 36, 36, 37, 36, 37, 41, 37, 37, 254, 255, 0, 255, 16, 19, 0, 37, 36, 37, 36, 37, 37, 41, 37, 37, 37, 36, 37,
+    37, 254, 0, 0, 255, 16, 18, 0, 37, 36, 42, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 42, 37, 37, 37, 37, 37, 37, 37,
+    37, 38, 37, 42, 254, 0, 0, 255, 16, 17, 0, 37, 38, 37, 37, 37, 38, 37, 37, 43, 37, 37, 38, 37, 37, 38, 37, 37, 38, 42,
+    37, 254, 1, 0, 255, 16, 8, 0, 37, 38, 38, 37, 38, 38, 37, 43, 37, 38, 38, 38, 37, 38, 38, 254, 1, 1, 255, 16, 7, 0,
+    37, 38, 38, 38, 38, 38, 38, 38, 43, 38, 38, 38, 63, 38, 38, 38, 68, 38, 38, 38, 38, 63, 254, 1, 0, 255, 16, 6, 0, 63,
+    38, 68, 38, 63, 38, 63, 38, 63, 38, 63, 38, 68, 38, 63, 63, 38, 63, 38, 63, 38, 68, 255, 16, 0, 31, 0, 0, 0, 24, 2,
+    0, 57, 82, 57, 82, 57, 82, 57, 57, 82, 58, 82, 57, 82, 57, 82, 57, 82, 57, 254, 0, 255, 1, 24, 3, 0, 58, 82, 57, 82,
+    57, 82, 82, 82, 82, 58, 82, 82, 82, 57, 82, 82, 82, 83, 82, 82, 82, 82, 254, 0, 255, 1, 24, 4, 0, 82, 82, 87, 83, 82,
+    82, 87, 82, 82, 82, 87, 83, 87, 82, 82, 254, 0, 0, 1, 24, 9, 0, 82, 82, 87, 82, 87, 88, 82, 87, 87, 82, 87, 87, 82,
+    87, 87, 83, 87, 87, 82, 87, 254, 0, 0, 1, 24, 10, 0, 87, 82, 87, 87, 88, 87, 82, 87, 87, 87, 87, 87, 87, 87, 87, 88,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 24, 11, 0, 88, 92, 87, 87, 87, 87, 92, 87, 87, 87, 93, 87, 87,
+    254, 0, 1, 1, 24, 12, 0, 87, 92, 87, 92, 87, 87, 93, 87, 254, 0, 1, 1, 24, 13, 0, 87, 92, 92, 87, 92, 92, 93, 254,
+    0, 1, 1, 24, 14, 0, 92, 92, 67, 92, 254, 0, 1, 1, 24, 15, 0, 92, 93, 67, 92, 254, 0, 1, 0, 24, 16, 0, 67, 92,
+    67, 67, 67, 67, 67, 68, 67, 67, 67, 254, 0, 1, 0, 24, 23, 0, 67, 42, 67, 67, 254, 0, 1, 255, 24, 22, 0, 67, 43, 42,
+    42, 254, 0, 1, 255, 24, 21, 0, 67, 42, 42, 42, 43, 42, 42, 254, 0, 0, 255, 24, 20, 0, 42, 42, 37, 42, 37, 43, 37, 37,
+    254, 0, 1, 255, 24, 19, 0, 37, 42, 37, 42, 37, 37, 43, 37, 37, 37, 42, 37, 37, 254, 0, 0, 255, 24, 18, 0, 37, 42, 38,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 38, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 38, 254, 0, 0, 255, 24, 17, 0,
+    37, 32, 37, 37, 37, 32, 37, 37, 33, 37, 37, 32, 37, 37, 32, 37, 37, 32, 38, 37, 254, 0, 255, 255, 24, 8, 0, 37, 32, 32,
+    37, 32, 32, 37, 33, 37, 32, 32, 32, 37, 32, 32, 254, 1, 255, 255, 24, 7, 0, 37, 32, 32, 32, 32, 32, 32, 32, 33, 32, 32,
+    32, 57, 32, 32, 32, 58, 32, 32, 32, 32, 57, 254, 0, 255, 255, 24, 6, 0, 57, 32, 58, 32, 57, 32, 57, 32, 57, 32, 57, 32,
+    58, 32, 57, 57, 32, 57, 32, 57, 32, 58, 255, 31, 0, 16, 0, 0, 0, 0, 2, 0, 61, 86, 61, 86, 61, 86, 61, 61, 86, 66,
+    86, 61, 86, 61, 86, 61, 86, 61, 254, 255, 0, 1, 0, 3, 0, 66, 86, 61, 86, 61, 86, 86, 86, 86, 66, 86, 86, 86, 61, 86,
+    86, 86, 91, 86, 86, 86, 86, 254, 255, 0, 1, 0, 4, 0, 86, 86, 87, 91, 86, 86, 87, 86, 86, 86, 87, 91, 87, 86, 86, 254,
+    0, 0, 1, 0, 9, 0, 86, 86, 87, 86, 87, 92, 86, 87, 87, 86, 87, 87, 86, 87, 87, 91, 87, 87, 86, 87, 254, 0, 0, 1,
+    0, 10, 0, 87, 86, 87, 87, 92, 87, 86, 87, 87, 87, 87, 87, 87, 87, 87, 92, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254,
+    0, 0, 1, 0, 11, 0, 92, 88, 87, 87, 87, 87, 88, 87, 87, 87, 93, 87, 87, 254, 1, 0, 1, 0, 12, 0, 87, 88, 87, 88,
+    87, 87, 93, 87, 254, 1, 0, 1, 0, 13, 0, 87, 88, 88, 87, 88, 88, 93, 254, 1, 0, 1, 0, 14, 0, 88, 88, 63, 88, 254,
+    1, 0, 1, 0, 15, 0, 88, 93, 63, 88, 254, 1, 0, 0, 0, 16, 0, 63, 88, 63, 63, 63, 63, 63, 68, 63, 63, 63, 254, 1,
+    0, 0, 0, 23, 0, 63, 38, 63, 63, 254, 1, 0, 255, 0, 22, 0, 63, 43, 38, 38, 254, 1, 0, 255, 0, 21, 0, 63, 38, 38,
+    38, 43, 38, 38, 254, 0, 0, 255, 0, 20, 0, 38, 38, 37, 38, 37, 43, 37, 37, 254, 1, 0, 255, 0, 19, 0, 37, 38, 37, 38,
+    37, 37, 43, 37, 37, 37, 38, 37, 37, 254, 0, 0, 255, 0, 18, 0, 37, 38, 42, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    42, 37, 37, 37, 37, 37, 37, 37, 37, 36, 37, 42, 254, 0, 0, 255, 0, 17, 0, 37, 36, 37, 37, 37, 36, 37, 37, 41, 37, 37,
+    36, 37, 37, 36, 37, 37, 36, 42, 37, 254, 255, 0, 255, 0, 8, 0, 37, 36, 36, 37, 36, 36, 37, 41, 37, 36, 36, 36, 37, 36,
+    36, 254, 255, 1, 255, 0, 7, 0, 37, 36, 36, 36, 36, 36, 36, 36, 41, 36, 36, 36, 61, 36, 36, 36, 66, 36, 36, 36, 36, 61,
+    254, 255, 0, 255, 0, 6, 0, 61, 36, 66, 36, 61, 36, 61, 36, 61, 36, 61, 36, 66, 36, 61, 61, 36, 61, 36, 61, 36, 66, 255,
+    16, 0, 0, 0, 0, 0, 8, 2, 0, 67, 92, 67, 92, 67, 92, 67, 67, 92, 68, 92, 67, 92, 67, 92, 67, 92, 67, 254, 0, 1,
+    1, 8, 3, 0, 68, 92, 67, 92, 67, 92, 92, 92, 92, 68, 92, 92, 92, 67, 92, 92, 92, 93, 92, 92, 92, 92, 254, 0, 1, 1,
+    8, 4, 0, 92, 92, 87, 93, 92, 92, 87, 92, 92, 92, 87, 93, 87, 92, 92, 254, 0, 0, 1, 8, 9, 0, 92, 92, 87, 92, 87,
+    88, 92, 87, 87, 92, 87, 87, 92, 87, 87, 93, 87, 87, 92, 87, 254, 0, 0, 1, 8, 10, 0, 87, 92, 87, 87, 88, 87, 92, 87,
+    87, 87, 87, 87, 87, 87, 87, 88, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 8, 11, 0, 88, 82, 87, 87, 87,
+    87, 82, 87, 87, 87, 83, 87, 87, 254, 0, 255, 1, 8, 12, 0, 87, 82, 87, 82, 87, 87, 83, 87, 254, 0, 255, 1, 8, 13, 0,
+    87, 82, 82, 87, 82, 82, 83, 254, 0, 255, 1, 8, 14, 0, 82, 82, 57, 82, 254, 0, 255, 1, 8, 15, 0, 82, 83, 57, 82, 254,
+    0, 255, 0, 8, 16, 0, 57, 82, 57, 57, 57, 57, 57, 58, 57, 57, 57, 254, 0, 255, 0, 8, 23, 0, 57, 32, 57, 57, 254, 0,
+    255, 255, 8, 22, 0, 57, 33, 32, 32, 254, 0, 255, 255, 8, 21, 0, 57, 32, 32, 32, 33, 32, 32, 254, 0, 0, 255, 8, 20, 0,
+    32, 32, 37, 32, 37, 33, 37, 37, 254, 0, 255, 255, 8, 19, 0, 37, 32, 37, 32, 37, 37, 33, 37, 37, 37, 32, 37, 37, 254, 0,
+    0, 255, 8, 18, 0, 37, 32, 38, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 38, 37, 37, 37, 37, 37, 37, 37, 37, 42, 37,
+    38, 254, 0, 0, 255, 8, 17, 0, 37, 42, 37, 37, 37, 42, 37, 37, 43, 37, 37, 42, 37, 37, 42, 37, 37, 42, 38, 37, 254, 0,
+    1, 255, 8, 8, 0, 37, 42, 42, 37, 42, 42, 37, 43, 37, 42, 42, 42, 37, 42, 42, 254, 1, 1, 255, 8, 7, 0, 37, 42, 42,
+    42, 42, 42, 42, 42, 43, 42, 42, 42, 67, 42, 42, 42, 68, 42, 42, 42, 42, 67, 254, 0, 1, 255, 8, 6, 0, 67, 42, 68, 42,
+    67, 42, 67, 42, 67, 42, 67, 42, 68, 42, 67, 67, 42, 67, 42, 67, 42, 68, 255, 0, 0, 16, 0, 0, 0, 16, 2, 0, 58, 88,
+    63, 88, 63, 88, 63, 63, 88, 58, 88, 63, 88, 63, 88, 63, 88, 63, 254, 1, 0, 1, 16, 3, 0, 58, 88, 63, 88, 63, 88, 88,
+    88, 88, 58, 88, 88, 88, 63, 88, 88, 88, 83, 88, 88, 88, 88, 254, 1, 0, 1, 16, 4, 0, 88, 88, 87, 83, 88, 88, 87, 88,
+    88, 88, 87, 88, 82, 88, 88, 254, 0, 0, 1, 16, 9, 0, 88, 88, 87, 88, 87, 82, 88, 87, 87, 88, 87, 87, 88, 87, 87, 83,
+    87, 87, 88, 87, 254, 0, 0, 1, 16, 10, 0, 87, 88, 87, 87, 82, 87, 88, 87, 87, 87, 87, 87, 87, 87, 87, 82, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 16, 11, 0, 82, 86, 87, 87, 87, 87, 86, 87, 87, 87, 81, 87, 87, 254, 255, 0,
+    1, 16, 12, 0, 87, 86, 87, 86, 87, 87, 81, 87, 254, 255, 0, 1, 16, 13, 0, 87, 86, 86, 87, 86, 86, 81, 254, 255, 0, 1,
+    16, 14, 0, 86, 86, 61, 86, 254, 255, 0, 1, 16, 15, 0, 86, 81, 61, 86, 254, 255, 0, 0, 16, 16, 0, 61, 86, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 16, 23, 0, 61, 36, 61, 61, 254, 255, 0, 255, 16, 22, 0, 61, 31, 36, 36, 254, 255,
+    0, 255, 16, 21, 0, 61, 36, 36, 36, 31, 36, 36, 254, 0, 0, 255, 16, 20, 0, 36, 36, 37, 36, 37, 31, 37, 37, 254, 255, 0,
+    255, 16, 19, 0, 37, 36, 37, 36, 37, 37, 31, 37, 37, 37, 36, 37, 37, 254, 0, 0, 255, 16, 18, 0, 37, 36, 32, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 38, 37, 32, 254, 0, 0, 255, 16, 17, 0, 37, 38, 37,
+    37, 37, 38, 37, 37, 33, 37, 37, 38, 37, 37, 38, 37, 37, 38, 32, 37, 254, 1, 0, 255, 16, 8, 0, 37, 38, 38, 37, 38, 38,
+    37, 33, 37, 38, 38, 38, 37, 38, 38, 254, 1, 255, 255, 16, 7, 0, 37, 38, 38, 38, 38, 38, 38, 38, 33, 38, 38, 38, 63, 38,
+    38, 38, 58, 38, 38, 38, 38, 63, 254, 1, 0, 255, 16, 6, 0, 63, 38, 58, 38, 63, 38, 63, 38, 63, 38, 63, 38, 58, 38, 63,
+    63, 38, 63, 38, 63, 38, 58, 255, 16, 0, 31, 0, 0, 0, 24, 2, 0, 56, 82, 57, 82, 57, 82, 57, 57, 82, 56, 82, 57, 82,
+    57, 82, 57, 82, 57, 254, 0, 255, 1, 24, 3, 0, 56, 82, 57, 82, 57, 82, 82, 82, 82, 56, 82, 82, 82, 57, 82, 82, 82, 81,
+    82, 82, 82, 82, 254, 0, 255, 1, 24, 4, 0, 82, 82, 87, 81, 82, 82, 87, 82, 82, 82, 87, 82, 86, 82, 82, 254, 0, 0, 1,
+    24, 9, 0, 82, 82, 87, 82, 87, 86, 82, 87, 87, 82, 87, 87, 82, 87, 87, 81, 87, 87, 82, 87, 254, 0, 0, 1, 24, 10, 0,
+    87, 82, 87, 87, 86, 87, 82, 87, 87, 87, 87, 87, 87, 87, 87, 86, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1,
+    24, 11, 0, 86, 92, 87, 87, 87, 87, 92, 87, 87, 87, 91, 87, 87, 254, 0, 1, 1, 24, 12, 0, 87, 92, 87, 92, 87, 87, 91,
+    87, 254, 0, 1, 1, 24, 13, 0, 87, 92, 92, 87, 92, 92, 91, 254, 0, 1, 1, 24, 14, 0, 92, 92, 67, 92, 254, 0, 1, 1,
+    24, 15, 0, 92, 91, 67, 92, 254, 0, 1, 0, 24, 16, 0, 67, 92, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 24,
+    23, 0, 67, 42, 67, 67, 254, 0, 1, 255, 24, 22, 0, 67, 41, 42, 42, 254, 0, 1, 255, 24, 21, 0, 67, 42, 42, 42, 41, 42,
+    42, 254, 0, 0, 255, 24, 20, 0, 42, 42, 37, 42, 37, 41, 37, 37, 254, 0, 1, 255, 24, 19, 0, 37, 42, 37, 42, 37, 37, 41,
+    37, 37, 37, 42, 37, 37, 254, 0, 0, 255, 24, 18, 0, 37, 42, 36, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 36, 37, 37,
+    37, 37, 37, 37, 37, 37, 32, 37, 36, 254, 0, 0, 255, 24, 17, 0, 37, 32, 37, 37, 37, 32, 37, 37, 31, 37, 37, 32, 37, 37,
+    32, 37, 37, 32, 36, 37, 254, 0, 255, 255, 24, 8, 0, 37, 32, 32, 37, 32, 32, 37, 31, 37, 32, 32, 32, 37, 32, 32, 254, 255,
+    255, 255, 24, 7, 0, 37, 32, 32, 32, 32, 32, 32, 32, 31, 32, 32, 32, 57, 32, 32, 32, 56, 32, 32, 32, 32, 57, 254, 0, 255,
+    255, 24, 6, 0, 57, 32, 56, 32, 57, 32, 57, 32, 57, 32, 57, 32, 56, 32, 57, 57, 32, 57, 32, 57, 32, 56, 255, 31, 0, 16,
+    0, 0, 0, 0, 0, 0, 61, 61, 61, 254, 255, 0, 0, 31, 0, 0, 61, 56, 61, 61, 61, 61, 61, 56, 254, 255, 0, 0, 30, 0,
+    0, 61, 56, 61, 61, 56, 61, 56, 61, 56, 254, 255, 0, 0, 29, 0, 0, 56, 61, 56, 56, 61, 56, 56, 56, 254, 255, 255, 0, 28,
+    0, 0, 60, 56, 56, 56, 254, 255, 255, 0, 27, 0, 0, 57, 56, 56, 57, 56, 57, 56, 57, 254, 255, 255, 0, 26, 0, 0, 57, 56,
+    57, 57, 56, 57, 57, 56, 57, 254, 0, 255, 0, 25, 0, 0, 57, 57, 57, 56, 57, 57, 57, 254, 0, 255, 0, 24, 0, 0, 57, 57,
+    57, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67, 254, 0, 1, 0, 7, 0, 0, 67, 66, 67, 67, 67, 67, 67, 66,
+    254, 0, 1, 0, 6, 0, 0, 67, 66, 67, 67, 66, 67, 66, 67, 66, 254, 0, 1, 0, 5, 0, 0, 66, 67, 66, 66, 67, 66, 66,
+    66, 254, 255, 1, 0, 4, 0, 0, 72, 66, 66, 66, 254, 255, 1, 0, 3, 0, 0, 61, 66, 66, 61, 66, 61, 66, 61, 254, 255, 1,
+    0, 2, 0, 0, 61, 66, 61, 61, 66, 61, 61, 66, 61, 254, 255, 0, 0, 1, 0, 0, 61, 61, 61, 66, 61, 61, 61, 254, 255, 0,
+    0, 0, 0, 0, 61, 61, 61, 255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 254, 1, 0, 0, 15, 0, 0, 63, 68,
+    63, 63, 63, 63, 63, 68, 254, 1, 0, 0, 14, 0, 0, 63, 68, 63, 63, 68, 63, 68, 63, 68, 254, 1, 0, 0, 13, 0, 0, 68,
+    63, 68, 68, 63, 68, 68, 68, 254, 1, 1, 0, 12, 0, 0, 64, 68, 68, 68, 254, 1, 1, 0, 11, 0, 0, 67, 68, 68, 67, 68,
+    67, 68, 67, 254, 1, 1, 0, 10, 0, 0, 67, 68, 67, 67, 68, 67, 67, 68, 67, 254, 0, 1, 0, 9, 0, 0, 67, 67, 67, 68,
+    67, 67, 67, 254, 0, 1, 0, 8, 0, 0, 67, 67, 255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 254, 0, 255, 0, 23,
+    0, 0, 57, 58, 57, 57, 57, 57, 57, 58, 254, 0, 255, 0, 22, 0, 0, 57, 58, 57, 57, 58, 57, 58, 57, 58, 254, 0, 255, 0,
+    21, 0, 0, 58, 57, 58, 58, 57, 58, 58, 58, 254, 1, 255, 0, 20, 0, 0, 52, 58, 58, 58, 254, 1, 255, 0, 19, 0, 0, 63,
+    58, 58, 63, 58, 63, 58, 63, 254, 1, 255, 0, 18, 0, 0, 63, 58, 63, 63, 58, 63, 63, 58, 63, 254, 1, 0, 0, 17, 0, 0,
+    63, 63, 63, 58, 63, 63, 63, 254, 1, 0, 0, 16, 0, 0, 63, 63, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 61, 61, 61, 254,
+    255, 0, 0, 1, 0, 0, 61, 66, 61, 61, 61, 61, 61, 66, 254, 255, 0, 0, 2, 0, 0, 61, 66, 61, 61, 66, 61, 66, 61, 66,
+    254, 255, 0, 0, 3, 0, 0, 66, 61, 66, 66, 61, 66, 66, 66, 254, 255, 1, 0, 4, 0, 0, 60, 66, 66, 66, 254, 255, 1, 0,
+    5, 0, 0, 67, 66, 66, 67, 66, 67, 66, 67, 254, 255, 1, 0, 6, 0, 0, 67, 66, 67, 67, 66, 67, 67, 66, 67, 254, 0, 1,
+    0, 7, 0, 0, 67, 67, 67, 66, 67, 67, 67, 254, 0, 1, 0, 8, 0, 0, 67, 67, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0,
+    67, 67, 67, 67, 254, 0, 1, 0, 9, 0, 0, 67, 68, 67, 67, 67, 67, 67, 68, 254, 0, 1, 0, 10, 0, 0, 67, 68, 67, 67,
+    68, 67, 68, 67, 68, 254, 0, 1, 0, 11, 0, 0, 68, 67, 68, 68, 67, 68, 68, 68, 254, 1, 1, 0, 12, 0, 0, 72, 68, 68,
+    68, 254, 1, 1, 0, 13, 0, 0, 63, 68, 68, 63, 68, 63, 68, 63, 254, 1, 1, 0, 14, 0, 0, 63, 68, 63, 63, 68, 63, 63,
+    68, 63, 254, 1, 0, 0, 15, 0, 0, 63, 63, 63, 68, 63, 63, 63, 254, 1, 0, 0, 16, 0, 0, 63, 63, 255, 0, 0, 16, 0,
+    0, 0, 16, 0, 0, 63, 63, 63, 63, 254, 1, 0, 0, 17, 0, 0, 63, 58, 63, 63, 63, 63, 63, 58, 254, 1, 0, 0, 18, 0,
+    0, 63, 58, 63, 63, 58, 63, 58, 63, 58, 254, 1, 0, 0, 19, 0, 0, 58, 63, 58, 58, 63, 58, 58, 58, 254, 1, 255, 0, 20,
+    0, 0, 64, 58, 58, 58, 254, 1, 255, 0, 21, 0, 0, 57, 58, 58, 57, 58, 57, 58, 57, 254, 1, 255, 0, 22, 0, 0, 57, 58,
+    57, 57, 58, 57, 57, 58, 57, 254, 0, 255, 0, 23, 0, 0, 57, 57, 57, 58, 57, 57, 57, 254, 0, 255, 0, 24, 0, 0, 57, 57,
+    57, 255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 254, 0, 255, 0, 25, 0, 0, 57, 56, 57, 57, 57, 57, 57, 56, 254,
+    0, 255, 0, 26, 0, 0, 57, 56, 57, 57, 56, 57, 56, 57, 56, 254, 0, 255, 0, 27, 0, 0, 56, 57, 56, 56, 57, 56, 56, 56,
+    254, 255, 255, 0, 28, 0, 0, 52, 56, 56, 56, 254, 255, 255, 0, 29, 0, 0, 61, 56, 56, 61, 56, 61, 56, 61, 254, 255, 255, 0,
+    30, 0, 0, 61, 56, 61, 61, 56, 61, 61, 56, 61, 254, 255, 0, 0, 31, 0, 0, 61, 61, 61, 56, 61, 61, 61, 254, 255, 0, 0,
+    0, 0, 0, 61, 61, 61, 255, 31, 0, 16, 0, 0, 0, 0, 0, 2, 61, 61, 61, 254, 255, 0, 0, 31, 0, 2, 61, 56, 61, 61,
+    61, 61, 61, 56, 254, 255, 0, 0, 30, 0, 2, 61, 56, 61, 61, 56, 61, 56, 61, 56, 254, 255, 0, 0, 29, 0, 2, 56, 61, 56,
+    56, 61, 56, 56, 56, 254, 255, 255, 0, 28, 0, 2, 60, 56, 56, 56, 254, 255, 255, 0, 27, 0, 2, 57, 56, 56, 57, 56, 57, 56,
+    57, 254, 255, 255, 0, 26, 0, 2, 57, 56, 57, 57, 56, 57, 57, 56, 57, 254, 0, 255, 0, 25, 0, 2, 57, 57, 57, 56, 57, 57,
+    57, 254, 0, 255, 0, 24, 0, 2, 57, 57, 57, 255, 16, 0, 0, 0, 0, 0, 8, 0, 2, 67, 67, 67, 67, 254, 0, 1, 0, 7,
+    0, 2, 67, 66, 67, 67, 67, 67, 67, 66, 254, 0, 1, 0, 6, 0, 2, 67, 66, 67, 67, 66, 67, 66, 67, 66, 254, 0, 1, 0,
+    5, 0, 2, 66, 67, 66, 66, 67, 66, 66, 66, 254, 255, 1, 0, 4, 0, 2, 72, 66, 66, 66, 254, 255, 1, 0, 3, 0, 2, 61,
+    66, 66, 61, 66, 61, 66, 61, 254, 255, 1, 0, 2, 0, 2, 61, 66, 61, 61, 66, 61, 61, 66, 61, 254, 255, 0, 0, 1, 0, 2,
+    61, 61, 61, 66, 61, 61, 61, 254, 255, 0, 0, 0, 0, 2, 61, 61, 61, 255, 0, 0, 16, 0, 0, 0, 16, 0, 2, 63, 63, 63,
+    63, 254, 1, 0, 0, 15, 0, 2, 63, 68, 63, 63, 63, 63, 63, 68, 254, 1, 0, 0, 14, 0, 2, 63, 68, 63, 63, 68, 63, 68,
+    63, 68, 254, 1, 0, 0, 13, 0, 2, 68, 63, 68, 68, 63, 68, 68, 68, 254, 1, 1, 0, 12, 0, 2, 64, 68, 68, 68, 254, 1,
+    1, 0, 11, 0, 2, 67, 68, 68, 67, 68, 67, 68, 67, 254, 1, 1, 0, 10, 0, 2, 67, 68, 67, 67, 68, 67, 67, 68, 67, 254,
+    0, 1, 0, 9, 0, 2, 67, 67, 67, 68, 67, 67, 67, 254, 0, 1, 0, 8, 0, 2, 67, 67, 255, 16, 0, 31, 0, 0, 0, 24,
+    0, 2, 57, 57, 57, 254, 0, 255, 0, 23, 0, 2, 57, 58, 57, 57, 57, 57, 57, 58, 254, 0, 255, 0, 22, 0, 2, 57, 58, 57,
+    57, 58, 57, 58, 57, 58, 254, 0, 255, 0, 21, 0, 2, 58, 57, 58, 58, 57, 58, 58, 58, 254, 1, 255, 0, 20, 0, 2, 52, 58,
+    58, 58, 254, 1, 255, 0, 19, 0, 2, 63, 58, 58, 63, 58, 63, 58, 63, 254, 1, 255, 0, 18, 0, 2, 63, 58, 63, 63, 58, 63,
+    63, 58, 63, 254, 1, 0, 0, 17, 0, 2, 63, 63, 63, 58, 63, 63, 63, 254, 1, 0, 0, 16, 0, 2, 63, 63, 255, 31, 0, 16,
+    0, 0, 0, 0, 0, 4, 61, 61, 61, 254, 255, 0, 0, 1, 0, 4, 61, 66, 61, 61, 61, 61, 61, 66, 254, 255, 0, 0, 2, 0,
+    4, 61, 66, 61, 61, 66, 61, 66, 61, 66, 254, 255, 0, 0, 3, 0, 4, 66, 61, 66, 66, 61, 66, 66, 66, 254, 255, 1, 0, 4,
+    0, 4, 60, 66, 66, 66, 254, 255, 1, 0, 5, 0, 4, 67, 66, 66, 67, 66, 67, 66, 67, 254, 255, 1, 0, 6, 0, 4, 67, 66,
+    67, 67, 66, 67, 67, 66, 67, 254, 0, 1, 0, 7, 0, 4, 67, 67, 67, 66, 67, 67, 67, 254, 0, 1, 0, 8, 0, 4, 67, 67,
+    255, 16, 0, 0, 0, 0, 0, 8, 0, 4, 67, 67, 67, 67, 254, 0, 1, 0, 9, 0, 4, 67, 68, 67, 67, 67, 67, 67, 68, 254,
+    0, 1, 0, 10, 0, 4, 67, 68, 67, 67, 68, 67, 68, 67, 68, 254, 0, 1, 0, 11, 0, 4, 68, 67, 68, 68, 67, 68, 68, 68,
+    254, 1, 1, 0, 12, 0, 4, 72, 68, 68, 68, 254, 1, 1, 0, 13, 0, 4, 63, 68, 68, 63, 68, 63, 68, 63, 254, 1, 1, 0,
+    14, 0, 4, 63, 68, 63, 63, 68, 63, 63, 68, 63, 254, 1, 0, 0, 15, 0, 4, 63, 63, 63, 68, 63, 63, 63, 254, 1, 0, 0,
+    16, 0, 4, 63, 63, 255, 0, 0, 16, 0, 0, 0, 16, 0, 4, 63, 63, 63, 63, 254, 1, 0, 0, 17, 0, 4, 63, 58, 63, 63,
+    63, 63, 63, 58, 254, 1, 0, 0, 18, 0, 4, 63, 58, 63, 63, 58, 63, 58, 63, 58, 254, 1, 0, 0, 19, 0, 4, 58, 63, 58,
+    58, 63, 58, 58, 58, 254, 1, 255, 0, 20, 0, 4, 64, 58, 58, 58, 254, 1, 255, 0, 21, 0, 4, 57, 58, 58, 57, 58, 57, 58,
+    57, 254, 1, 255, 0, 22, 0, 4, 57, 58, 57, 57, 58, 57, 57, 58, 57, 254, 0, 255, 0, 23, 0, 4, 57, 57, 57, 58, 57, 57,
+    57, 254, 0, 255, 0, 24, 0, 4, 57, 57, 57, 255, 16, 0, 31, 0, 0, 0, 24, 0, 4, 57, 57, 57, 254, 0, 255, 0, 25, 0,
+    4, 57, 56, 57, 57, 57, 57, 57, 56, 254, 0, 255, 0, 26, 0, 4, 57, 56, 57, 57, 56, 57, 56, 57, 56, 254, 0, 255, 0, 27,
+    0, 4, 56, 57, 56, 56, 57, 56, 56, 56, 254, 255, 255, 0, 28, 0, 4, 52, 56, 56, 56, 254, 255, 255, 0, 29, 0, 4, 61, 56,
+    56, 61, 56, 61, 56, 61, 254, 255, 255, 0, 30, 0, 4, 61, 56, 61, 61, 56, 61, 61, 56, 61, 254, 255, 0, 0, 31, 0, 4, 61,
+    61, 61, 56, 61, 61, 61, 254, 255, 0, 0, 0, 0, 4, 61, 61, 61, 255, 31, 0, 16, 0, 0, 0, 0, 2, 0, 61, 86, 61, 254,
+    255, 0, 1, 31, 2, 0, 61, 56, 86, 61, 86, 61, 61, 81, 254, 255, 0, 0, 30, 2, 0, 86, 56, 86, 61, 81, 61, 81, 61, 81,
+    254, 255, 0, 0, 29, 2, 0, 81, 61, 56, 81, 86, 56, 81, 56, 254, 255, 255, 1, 28, 2, 0, 60, 81, 56, 81, 254, 255, 255, 0,
+    27, 2, 0, 82, 56, 81, 57, 81, 57, 81, 57, 254, 255, 255, 1, 26, 2, 0, 57, 81, 57, 82, 56, 82, 57, 56, 82, 254, 0, 255,
+    0, 25, 2, 0, 82, 57, 82, 56, 82, 57, 57, 254, 0, 255, 1, 24, 2, 0, 57, 82, 57, 255, 16, 0, 0, 0, 0, 0, 8, 2,
+    0, 67, 67, 92, 67, 254, 0, 1, 1, 7, 2, 0, 67, 66, 92, 67, 92, 67, 67, 91, 254, 0, 1, 0, 6, 2, 0, 92, 66, 92,
+    67, 91, 67, 91, 67, 91, 254, 0, 1, 0, 5, 2, 0, 91, 67, 66, 91, 92, 66, 91, 66, 254, 255, 1, 1, 4, 2, 0, 72, 91,
+    66, 91, 254, 255, 1, 0, 3, 2, 0, 86, 66, 91, 61, 91, 61, 91, 61, 254, 255, 1, 1, 2, 2, 0, 61, 91, 61, 86, 66, 86,
+    61, 66, 86, 254, 255, 0, 0, 1, 2, 0, 86, 61, 86, 66, 86, 61, 61, 254, 255, 0, 1, 0, 2, 0, 61, 86, 61, 255, 0, 0,
+    16, 0, 0, 0, 16, 2, 0, 63, 63, 88, 63, 254, 1, 0, 1, 15, 2, 0, 63, 68, 88, 63, 88, 63, 88, 68, 254, 1, 0, 1,
+    14, 2, 0, 63, 68, 88, 63, 93, 63, 93, 63, 93, 254, 1, 0, 0, 13, 2, 0, 93, 63, 93, 68, 88, 68, 93, 68, 254, 1, 1,
+    1, 12, 2, 0, 64, 93, 68, 93, 254, 1, 1, 1, 11, 2, 0, 67, 93, 68, 92, 68, 92, 68, 92, 254, 1, 1, 0, 10, 2, 0,
+    92, 68, 92, 67, 68, 92, 67, 93, 67, 254, 0, 1, 1, 9, 2, 0, 67, 92, 67, 68, 92, 67, 92, 254, 0, 1, 0, 8, 2, 0,
+    92, 67, 255, 16, 0, 31, 0, 0, 0, 24, 2, 0, 57, 82, 57, 254, 0, 255, 1, 23, 2, 0, 57, 58, 82, 57, 82, 57, 82, 58,
+    254, 0, 255, 1, 22, 2, 0, 57, 58, 82, 57, 83, 57, 83, 57, 83, 254, 0, 255, 0, 21, 2, 0, 83, 57, 83, 58, 82, 58, 83,
+    58, 254, 1, 255, 1, 20, 2, 0, 52, 83, 58, 83, 254, 1, 255, 1, 19, 2, 0, 63, 83, 58, 88, 58, 88, 58, 88, 254, 1, 255,
+    0, 18, 2, 0, 88, 58, 88, 63, 58, 88, 63, 83, 63, 254, 1, 0, 1, 17, 2, 0, 63, 88, 63, 58, 88, 63, 88, 254, 1, 0,
+    0, 16, 2, 0, 88, 63, 255, 31, 0, 16, 0, 0, 0, 0, 2, 0, 61, 86, 61, 254, 255, 0, 1, 1, 2, 0, 61, 66, 86, 61,
+    86, 61, 86, 66, 254, 255, 0, 1, 2, 2, 0, 61, 66, 86, 61, 91, 61, 91, 61, 91, 254, 255, 0, 0, 3, 2, 0, 91, 61, 91,
+    66, 86, 66, 91, 66, 254, 255, 1, 1, 4, 2, 0, 60, 91, 66, 91, 254, 255, 1, 1, 5, 2, 0, 67, 91, 66, 92, 66, 92, 66,
+    92, 254, 255, 1, 0, 6, 2, 0, 92, 66, 92, 67, 66, 92, 67, 91, 67, 254, 0, 1, 1, 7, 2, 0, 67, 92, 67, 66, 92, 67,
+    92, 254, 0, 1, 0, 8, 2, 0, 92, 67, 255, 16, 0, 0, 0, 0, 0, 8, 2, 0, 67, 67, 92, 67, 254, 0, 1, 1, 9, 2,
+    0, 67, 68, 92, 67, 92, 67, 92, 68, 254, 0, 1, 1, 10, 2, 0, 67, 68, 92, 67, 93, 67, 93, 67, 93, 254, 0, 1, 0, 11,
+    2, 0, 93, 67, 93, 68, 92, 68, 93, 68, 254, 1, 1, 1, 12, 2, 0, 72, 93, 68, 93, 254, 1, 1, 1, 13, 2, 0, 63, 93,
+    68, 88, 68, 88, 68, 88, 254, 1, 1, 0, 14, 2, 0, 88, 68, 88, 63, 68, 88, 63, 93, 63, 254, 1, 0, 1, 15, 2, 0, 63,
+    88, 63, 68, 88, 63, 88, 254, 1, 0, 0, 16, 2, 0, 88, 63, 255, 0, 0, 16, 0, 0, 0, 16, 2, 0, 63, 63, 88, 63, 254,
+    1, 0, 1, 17, 2, 0, 63, 58, 88, 63, 88, 63, 63, 83, 254, 1, 0, 0, 18, 2, 0, 88, 58, 88, 63, 83, 63, 83, 63, 83,
+    254, 1, 0, 0, 19, 2, 0, 83, 63, 58, 83, 88, 58, 83, 58, 254, 1, 255, 1, 20, 2, 0, 64, 83, 58, 83, 254, 1, 255, 0,
+    21, 2, 0, 82, 58, 83, 57, 83, 57, 83, 57, 254, 1, 255, 1, 22, 2, 0, 57, 83, 57, 82, 58, 82, 57, 58, 82, 254, 0, 255,
+    0, 23, 2, 0, 82, 57, 82, 58, 82, 57, 57, 254, 0, 255, 1, 24, 2, 0, 57, 82, 57, 255, 16, 0, 31, 0, 0, 0, 24, 2,
+    0, 57, 82, 57, 254, 0, 255, 1, 25, 2, 0, 57, 56, 82, 57, 82, 57, 57, 81, 254, 0, 255, 0, 26, 2, 0, 82, 56, 82, 57,
+    81, 57, 81, 57, 81, 254, 0, 255, 0, 27, 2, 0, 81, 57, 56, 81, 82, 56, 81, 56, 254, 255, 255, 1, 28, 2, 0, 52, 81, 56,
+    81, 254, 255, 255, 0, 29, 2, 0, 86, 56, 81, 61, 81, 61, 81, 61, 254, 255, 255, 1, 30, 2, 0, 61, 81, 61, 86, 56, 86, 61,
+    56, 86, 254, 255, 0, 0, 31, 2, 0, 86, 61, 86, 56, 86, 61, 61, 254, 255, 0, 1, 0, 2, 0, 61, 86, 61, 255, 31, 0, 16,
+    0, 15, 0, 0, 6, 0, 61, 36, 61, 254, 255, 0, 255, 31, 6, 0, 61, 56, 36, 61, 36, 61, 61, 31, 254, 255, 0, 0, 30, 6,
+    0, 36, 56, 36, 61, 31, 61, 31, 61, 31, 254, 255, 0, 0, 29, 6, 0, 31, 61, 56, 31, 36, 56, 31, 56, 254, 255, 255, 255, 28,
+    6, 0, 60, 31, 56, 31, 254, 255, 255, 0, 27, 6, 0, 32, 56, 31, 32, 56, 57, 31, 57, 254, 255, 255, 255, 26, 6, 0, 57, 31,
+    57, 32, 56, 32, 57, 31, 57, 254, 0, 255, 255, 25, 6, 0, 57, 57, 32, 56, 32, 57, 57, 254, 0, 255, 255, 24, 6, 0, 57, 32,
+    32, 255, 16, 0, 0, 0, 15, 0, 8, 6, 0, 67, 67, 42, 67, 254, 0, 1, 255, 7, 6, 0, 67, 66, 42, 67, 42, 67, 67, 41,
+    254, 0, 1, 0, 6, 6, 0, 42, 66, 42, 67, 41, 67, 41, 67, 41, 254, 0, 1, 0, 5, 6, 0, 41, 67, 66, 41, 42, 66, 41,
+    66, 254, 255, 1, 255, 4, 6, 0, 72, 41, 66, 41, 254, 255, 1, 0, 3, 6, 0, 36, 66, 41, 36, 66, 61, 41, 61, 254, 255, 1,
+    255, 2, 6, 0, 61, 41, 61, 36, 66, 36, 61, 41, 61, 254, 255, 0, 255, 1, 6, 0, 61, 61, 36, 66, 36, 61, 61, 254, 255, 0,
+    255, 0, 6, 0, 61, 36, 36, 255, 0, 0, 16, 0, 15, 0, 16, 6, 0, 63, 63, 38, 63, 254, 1, 0, 255, 15, 6, 0, 63, 68,
+    38, 63, 38, 63, 38, 68, 254, 1, 0, 255, 14, 6, 0, 63, 68, 38, 63, 43, 63, 43, 63, 43, 254, 1, 0, 0, 13, 6, 0, 43,
+    63, 43, 68, 38, 68, 43, 68, 254, 1, 1, 255, 12, 6, 0, 39, 68, 68, 43, 254, 1, 1, 255, 11, 6, 0, 67, 43, 68, 42, 68,
+    42, 68, 42, 254, 1, 1, 0, 10, 6, 0, 42, 68, 42, 67, 68, 42, 67, 43, 67, 254, 0, 1, 255, 9, 6, 0, 67, 42, 67, 68,
+    42, 67, 42, 254, 0, 1, 0, 8, 6, 0, 42, 67, 255, 16, 0, 31, 0, 15, 0, 24, 6, 0, 57, 32, 57, 254, 0, 255, 255, 23,
+    6, 0, 57, 58, 32, 57, 32, 57, 32, 58, 254, 0, 255, 255, 22, 6, 0, 57, 58, 32, 57, 33, 57, 33, 57, 33, 254, 0, 255, 0,
+    21, 6, 0, 33, 57, 33, 58, 32, 58, 33, 58, 254, 1, 255, 255, 20, 6, 0, 27, 58, 58, 33, 254, 1, 255, 255, 19, 6, 0, 63,
+    33, 58, 38, 58, 38, 58, 38, 254, 1, 255, 0, 18, 6, 0, 38, 58, 38, 63, 58, 38, 63, 33, 63, 254, 1, 0, 255, 17, 6, 0,
+    63, 38, 63, 58, 38, 63, 38, 254, 1, 0, 0, 16, 6, 0, 38, 63, 255, 31, 0, 16, 0, 15, 0, 0, 6, 0, 61, 36, 61, 254,
+    255, 0, 255, 1, 6, 0, 61, 66, 36, 61, 36, 61, 36, 66, 254, 255, 0, 255, 2, 6, 0, 61, 66, 36, 61, 41, 61, 41, 61, 41,
+    254, 255, 0, 0, 3, 6, 0, 41, 61, 41, 66, 36, 66, 41, 66, 254, 255, 1, 255, 4, 6, 0, 35, 66, 66, 41, 254, 255, 1, 255,
+    5, 6, 0, 67, 41, 66, 42, 66, 42, 66, 42, 254, 255, 1, 0, 6, 6, 0, 42, 66, 42, 67, 66, 42, 67, 41, 67, 254, 0, 1,
+    255, 7, 6, 0, 67, 42, 67, 66, 42, 67, 42, 254, 0, 1, 0, 8, 6, 0, 42, 67, 255, 16, 0, 0, 0, 15, 0, 8, 6, 0,
+    67, 67, 42, 67, 254, 0, 1, 255, 9, 6, 0, 67, 68, 42, 67, 42, 67, 42, 68, 254, 0, 1, 255, 10, 6, 0, 67, 68, 42, 67,
+    43, 67, 43, 67, 43, 254, 0, 1, 0, 11, 6, 0, 43, 67, 43, 68, 42, 68, 43, 68, 254, 1, 1, 255, 12, 6, 0, 47, 68, 68,
+    43, 254, 1, 1, 255, 13, 6, 0, 63, 43, 68, 38, 68, 38, 68, 38, 254, 1, 1, 0, 14, 6, 0, 38, 68, 38, 63, 68, 38, 63,
+    43, 63, 254, 1, 0, 255, 15, 6, 0, 63, 38, 63, 68, 38, 63, 38, 254, 1, 0, 0, 16, 6, 0, 38, 63, 255, 0, 0, 16, 0,
+    15, 0, 16, 6, 0, 63, 63, 38, 63, 254, 1, 0, 255, 17, 6, 0, 63, 58, 38, 63, 38, 63, 63, 33, 254, 1, 0, 0, 18, 6,
+    0, 38, 58, 38, 63, 33, 63, 33, 63, 33, 254, 1, 0, 0, 19, 6, 0, 33, 63, 58, 33, 38, 58, 33, 58, 254, 1, 255, 255, 20,
+    6, 0, 64, 33, 58, 33, 254, 1, 255, 0, 21, 6, 0, 32, 58, 33, 57, 33, 57, 33, 57, 254, 1, 255, 255, 22, 6, 0, 57, 33,
+    57, 32, 58, 32, 57, 58, 32, 254, 0, 255, 0, 23, 6, 0, 32, 57, 32, 58, 32, 57, 57, 254, 0, 255, 255, 24, 6, 0, 57, 32,
+    57, 255, 16, 0, 31, 0, 15, 0, 24, 6, 0, 57, 32, 57, 254, 0, 255, 255, 25, 6, 0, 57, 56, 32, 57, 32, 57, 57, 31, 254,
+    0, 255, 0, 26, 6, 0, 32, 56, 32, 57, 31, 57, 31, 57, 31, 254, 0, 255, 0, 27, 6, 0, 31, 57, 56, 31, 32, 56, 31, 56,
+    254, 255, 255, 255, 28, 6, 0, 52, 31, 56, 31, 254, 255, 255, 0, 29, 6, 0, 36, 56, 31, 61, 31, 61, 31, 61, 254, 255, 255, 255,
+    30, 6, 0, 61, 31, 61, 36, 56, 36, 61, 56, 36, 254, 255, 0, 0, 31, 6, 0, 36, 61, 36, 56, 36, 61, 61, 254, 255, 0, 255,
+    0, 6, 0, 61, 36, 61, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 61, 254, 255, 0, 0, 31, 0, 0, 56, 254, 255, 0, 0, 30,
+    0, 0, 61, 56, 254, 255, 0, 0, 29, 0, 0, 56, 254, 255, 255, 0, 28, 0, 0, 56, 56, 254, 255, 255, 0, 27, 0, 0, 56, 254,
+    0, 255, 0, 26, 0, 0, 56, 57, 254, 0, 255, 0, 25, 0, 0, 56, 254, 0, 255, 0, 24, 0, 0, 57, 57, 255, 16, 0, 0, 0,
+    0, 0, 8, 0, 0, 67, 67, 254, 0, 1, 0, 7, 0, 0, 66, 254, 0, 1, 0, 6, 0, 0, 67, 66, 254, 0, 1, 0, 5, 0,
+    0, 66, 254, 255, 1, 0, 4, 0, 0, 66, 66, 254, 255, 1, 0, 3, 0, 0, 66, 254, 255, 0, 0, 2, 0, 0, 66, 61, 254, 255,
+    0, 0, 1, 0, 0, 66, 254, 255, 0, 0, 0, 0, 0, 61, 61, 255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 254, 1, 0,
+    0, 15, 0, 0, 68, 254, 1, 0, 0, 14, 0, 0, 63, 68, 254, 1, 0, 0, 13, 0, 0, 68, 254, 1, 1, 0, 12, 0, 0, 68,
+    68, 254, 1, 1, 0, 11, 0, 0, 68, 254, 0, 1, 0, 10, 0, 0, 68, 67, 254, 0, 1, 0, 9, 0, 0, 68, 254, 0, 1, 0,
+    8, 0, 0, 67, 255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 254, 0, 255, 0, 23, 0, 0, 58, 254, 0, 255, 0, 22, 0, 0,
+    57, 58, 254, 0, 255, 0, 21, 0, 0, 58, 254, 1, 255, 0, 20, 0, 0, 58, 58, 254, 1, 255, 0, 19, 0, 0, 58, 254, 1, 0,
+    0, 18, 0, 0, 58, 63, 254, 1, 0, 0, 17, 0, 0, 58, 254, 1, 0, 0, 16, 0, 0, 63, 255, 31, 0, 16, 0, 0, 0, 0,
+    0, 0, 61, 254, 255, 0, 0, 1, 0, 0, 66, 254, 255, 0, 0, 2, 0, 0, 61, 66, 254, 255, 0, 0, 3, 0, 0, 66, 254, 255,
+    1, 0, 4, 0, 0, 66, 66, 254, 255, 1, 0, 5, 0, 0, 66, 254, 0, 1, 0, 6, 0, 0, 66, 67, 254, 0, 1, 0, 7, 0,
+    0, 66, 254, 0, 1, 0, 8, 0, 0, 67, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 254, 0, 1, 0, 9, 0, 0, 68,
+    254, 0, 1, 0, 10, 0, 0, 67, 68, 254, 0, 1, 0, 11, 0, 0, 68, 254, 1, 1, 0, 12, 0, 0, 68, 68, 254, 1, 1, 0,
+    13, 0, 0, 68, 254, 1, 0, 0, 14, 0, 0, 68, 63, 254, 1, 0, 0, 15, 0, 0, 68, 254, 1, 0, 0, 16, 0, 0, 63, 255,
+    0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 254, 1, 0, 0, 17, 0, 0, 58, 254, 1, 0, 0, 18, 0, 0, 63, 58, 254, 1,
+    0, 0, 19, 0, 0, 58, 254, 1, 255, 0, 20, 0, 0, 58, 58, 254, 1, 255, 0, 21, 0, 0, 58, 254, 0, 255, 0, 22, 0, 0,
+    58, 57, 254, 0, 255, 0, 23, 0, 0, 58, 254, 0, 255, 0, 24, 0, 0, 57, 57, 255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57,
+    254, 0, 255, 0, 25, 0, 0, 56, 254, 0, 255, 0, 26, 0, 0, 57, 56, 254, 0, 255, 0, 27, 0, 0, 56, 254, 255, 255, 0, 28,
+    0, 0, 56, 56, 254, 255, 255, 0, 29, 0, 0, 56, 254, 255, 0, 0, 30, 0, 0, 56, 61, 254, 255, 0, 0, 31, 0, 0, 56, 254,
+    255, 0, 0, 0, 0, 0, 61, 61, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 1, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 2, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255,
+    0, 0, 0, 0, 5, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 6, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 7, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 8,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 9, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254,
+    255, 0, 0, 16, 16, 0, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67, 254, 0, 1, 0, 8,
+    0, 1, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 2, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 254, 0, 1, 0, 8, 0, 5, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 6, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 7, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0,
+    8, 0, 8, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 9, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 254, 0, 1, 0, 24, 16, 0, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 254, 1,
+    0, 0, 16, 0, 1, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 2, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 5, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 6,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 7, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254,
+    1, 0, 0, 16, 0, 8, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 9, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 254, 1, 0, 0, 0, 16, 0, 63, 63, 63, 63, 63, 255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57,
+    57, 254, 0, 255, 0, 24, 0, 1, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 2, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 5, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0,
+    24, 0, 6, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 7, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 254, 0, 255, 0, 24, 0, 8, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 9, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 8, 16, 0, 57, 57, 57, 57, 57, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0,
+    61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 3, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 4,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 10, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254,
+    255, 0, 0, 0, 0, 11, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 12, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 13, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 14, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 16, 16, 0, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 0, 0,
+    8, 0, 0, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 3, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0,
+    8, 0, 4, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 10, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 254, 0, 1, 0, 8, 0, 11, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 12, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 13, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8,
+    0, 14, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 24, 16, 0, 67, 67, 67, 67, 67, 255, 0, 0, 16,
+    0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 3, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254,
+    1, 0, 0, 16, 0, 4, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 10, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 11, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 12, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 13, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1,
+    0, 0, 16, 0, 14, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 0, 16, 0, 63, 63, 63, 63, 63, 255,
+    16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 3, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 254, 0, 255, 0, 24, 0, 4, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 10, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 11, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24,
+    0, 12, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 13, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 254, 0, 255, 0, 24, 0, 14, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 8, 16, 0, 57, 57, 57,
+    57, 57, 255, 31, 0, 16, 0, 240, 255, 16, 16, 0, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 14, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 13, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 12, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 11, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255,
+    0, 0, 0, 0, 10, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 4, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 3, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 0,
+    61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 240, 255, 24, 16, 0, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 14, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 13, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8,
+    0, 12, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 11, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 254, 0, 1, 0, 8, 0, 10, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 4, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 3, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0,
+    8, 0, 0, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 240, 255, 0, 16, 0, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 14, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 13, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1,
+    0, 0, 16, 0, 12, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 11, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 10, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 4,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 3, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254,
+    1, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 255, 16, 0, 31, 0, 240, 255, 8, 16, 0, 57, 57, 57, 57, 254, 0, 255, 0, 24,
+    0, 14, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 13, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 254, 0, 255, 0, 24, 0, 12, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 11, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 10, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0,
+    24, 0, 4, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 3, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 254, 0, 255, 0, 24, 0, 0, 57, 57, 57, 57, 57, 255, 31, 0, 16, 0, 240, 255, 16, 16, 0, 61, 61, 61, 61, 254, 255,
+    0, 0, 0, 0, 9, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 8, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 7, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 6,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 5, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254,
+    255, 0, 0, 0, 0, 2, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 1, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 240, 255, 24, 16, 0, 67, 67, 67,
+    67, 254, 0, 1, 0, 8, 0, 9, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 8, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 7, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0,
+    8, 0, 6, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 5, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 254, 0, 1, 0, 8, 0, 2, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 1, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 0, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 240, 255, 0, 16, 0,
+    63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 9, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 8,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 7, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254,
+    1, 0, 0, 16, 0, 6, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 5, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 2, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 1, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 255, 16, 0, 31, 0, 240, 255,
+    8, 16, 0, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 9, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0,
+    24, 0, 8, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 7, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 254, 0, 255, 0, 24, 0, 6, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 5, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 2, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24,
+    0, 1, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 0, 57, 57, 57, 57, 57, 255, 31, 0, 16,
+    0, 0, 0, 0, 2, 0, 61, 86, 61, 86, 61, 86, 61, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 254, 255, 0, 1, 0, 3,
+    0, 61, 86, 61, 86, 61, 86, 86, 86, 86, 61, 86, 86, 86, 61, 86, 86, 86, 86, 86, 86, 86, 86, 254, 255, 0, 1, 0, 4, 0,
+    86, 86, 87, 86, 86, 86, 87, 86, 86, 86, 87, 86, 87, 86, 86, 254, 0, 0, 1, 0, 9, 0, 86, 86, 87, 86, 87, 87, 86, 87,
+    87, 86, 87, 87, 86, 87, 87, 86, 87, 87, 86, 87, 254, 0, 0, 1, 0, 10, 0, 87, 86, 87, 87, 87, 87, 86, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 0, 11, 0, 87, 88,
+    87, 87, 87, 87, 88, 87, 87, 87, 88, 87, 87, 254, 1, 0, 1, 0, 12, 0, 87, 88, 87, 88, 87, 87, 88, 87, 254, 1, 0, 1,
+    0, 13, 0, 87, 88, 88, 87, 88, 88, 88, 254, 1, 0, 1, 0, 14, 0, 88, 88, 63, 88, 254, 1, 0, 1, 0, 15, 0, 88, 88,
+    63, 88, 254, 1, 0, 0, 0, 16, 0, 63, 88, 63, 63, 63, 63, 255, 16, 0, 0, 0, 0, 0, 8, 2, 0, 67, 92, 67, 92, 67,
+    92, 67, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 254, 0, 1, 1, 8, 3, 0, 67, 92, 67, 92, 67, 92, 92, 92, 92, 67,
+    92, 92, 92, 67, 92, 92, 92, 92, 92, 92, 92, 92, 254, 0, 1, 1, 8, 4, 0, 92, 92, 87, 92, 92, 92, 87, 92, 92, 92, 87,
+    92, 87, 92, 92, 254, 0, 0, 1, 8, 9, 0, 92, 92, 87, 92, 87, 87, 92, 87, 87, 92, 87, 87, 92, 87, 87, 92, 87, 87, 92,
+    87, 254, 0, 0, 1, 8, 10, 0, 87, 92, 87, 87, 87, 87, 92, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 8, 11, 0, 87, 82, 87, 87, 87, 87, 82, 87, 87, 87, 82, 87, 87,
+    254, 0, 255, 1, 8, 12, 0, 87, 82, 87, 82, 87, 87, 82, 87, 254, 0, 255, 1, 8, 13, 0, 87, 82, 82, 87, 82, 82, 82, 254,
+    0, 255, 1, 8, 14, 0, 82, 82, 57, 82, 254, 0, 255, 1, 8, 15, 0, 82, 82, 57, 82, 254, 0, 255, 0, 8, 16, 0, 57, 82,
+    57, 57, 57, 57, 255, 0, 0, 16, 0, 0, 0, 16, 2, 0, 63, 88, 63, 88, 63, 88, 63, 63, 88, 63, 88, 63, 88, 63, 88, 63,
+    88, 63, 254, 1, 0, 1, 16, 3, 0, 63, 88, 63, 88, 63, 88, 88, 88, 88, 63, 88, 88, 88, 63, 88, 88, 88, 88, 88, 88, 88,
+    88, 254, 1, 0, 1, 16, 4, 0, 88, 88, 87, 88, 88, 88, 87, 88, 88, 88, 87, 88, 87, 88, 88, 254, 0, 0, 1, 16, 9, 0,
+    88, 88, 87, 88, 87, 87, 88, 87, 87, 88, 87, 87, 88, 87, 87, 88, 87, 87, 88, 87, 254, 0, 0, 1, 16, 10, 0, 87, 88, 87,
+    87, 87, 87, 88, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254,
+    0, 0, 1, 16, 11, 0, 87, 86, 87, 87, 87, 87, 86, 87, 87, 87, 86, 87, 87, 254, 255, 0, 1, 16, 12, 0, 87, 86, 87, 86,
+    87, 87, 86, 87, 254, 255, 0, 1, 16, 13, 0, 87, 86, 86, 87, 86, 86, 86, 254, 255, 0, 1, 16, 14, 0, 86, 86, 61, 86, 254,
+    255, 0, 1, 16, 15, 0, 86, 86, 61, 86, 254, 255, 0, 0, 16, 16, 0, 61, 86, 61, 61, 61, 61, 255, 16, 0, 31, 0, 0, 0,
+    24, 2, 0, 57, 82, 57, 82, 57, 82, 57, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 254, 0, 255, 1, 24, 3, 0, 57, 82,
+    57, 82, 57, 82, 82, 82, 82, 57, 82, 82, 82, 57, 82, 82, 82, 82, 82, 82, 82, 82, 254, 0, 255, 1, 24, 4, 0, 82, 82, 87,
+    82, 82, 82, 87, 82, 82, 82, 87, 82, 87, 82, 82, 254, 0, 0, 1, 24, 9, 0, 82, 82, 87, 82, 87, 87, 82, 87, 87, 82, 87,
+    87, 82, 87, 87, 82, 87, 87, 82, 87, 254, 0, 0, 1, 24, 10, 0, 87, 82, 87, 87, 87, 87, 82, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 24, 11, 0, 87, 92, 87, 87, 87,
+    87, 92, 87, 87, 87, 92, 87, 87, 254, 0, 1, 1, 24, 12, 0, 87, 92, 87, 92, 87, 87, 92, 87, 254, 0, 1, 1, 24, 13, 0,
+    87, 92, 92, 87, 92, 92, 92, 254, 0, 1, 1, 24, 14, 0, 92, 92, 67, 92, 254, 0, 1, 1, 24, 15, 0, 92, 92, 67, 92, 254,
+    0, 1, 0, 24, 16, 0, 67, 92, 67, 67, 67, 67, 255, 31, 0, 16, 0, 16, 0, 16, 16, 0, 61, 61, 61, 61, 254, 255, 0, 0,
+    16, 23, 0, 36, 61, 61, 36, 254, 255, 0, 0, 16, 22, 0, 36, 36, 36, 36, 254, 255, 0, 0, 16, 21, 0, 36, 36, 36, 36, 36,
+    36, 37, 254, 255, 0, 255, 16, 20, 0, 36, 37, 36, 37, 36, 37, 37, 36, 254, 0, 0, 255, 16, 19, 0, 36, 37, 36, 37, 37, 36,
+    37, 37, 37, 36, 37, 37, 37, 254, 0, 0, 255, 16, 18, 0, 36, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 38, 37, 37, 37, 254, 0, 0, 255, 16, 17, 0, 38, 37, 37, 37, 38, 37, 37,
+    38, 37, 37, 38, 37, 37, 38, 37, 37, 38, 37, 37, 38, 254, 0, 0, 255, 16, 8, 0, 38, 38, 37, 38, 38, 37, 38, 37, 38, 38,
+    38, 37, 38, 38, 38, 254, 0, 0, 255, 16, 7, 0, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 63, 38, 38, 38, 63, 38, 38,
+    38, 38, 63, 38, 254, 1, 0, 0, 16, 6, 0, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 63, 38, 63, 38, 63,
+    38, 255, 16, 0, 0, 0, 16, 0, 24, 16, 0, 67, 67, 67, 67, 254, 0, 1, 0, 24, 23, 0, 42, 67, 67, 42, 254, 0, 1, 0,
+    24, 22, 0, 42, 42, 42, 42, 254, 0, 1, 0, 24, 21, 0, 42, 42, 42, 42, 42, 42, 37, 254, 0, 1, 255, 24, 20, 0, 42, 37,
+    42, 37, 42, 37, 37, 42, 254, 0, 0, 255, 24, 19, 0, 42, 37, 42, 37, 37, 42, 37, 37, 37, 42, 37, 37, 37, 254, 0, 0, 255,
+    24, 18, 0, 42, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 32, 37, 37, 37, 254, 0, 0, 255, 24, 17, 0, 32, 37, 37, 37, 32, 37, 37, 32, 37, 37, 32, 37, 37, 32, 37, 37, 32, 37,
+    37, 32, 254, 0, 0, 255, 24, 8, 0, 32, 32, 37, 32, 32, 37, 32, 37, 32, 32, 32, 37, 32, 32, 32, 254, 0, 0, 255, 24, 7,
+    0, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 57, 32, 32, 32, 57, 32, 32, 32, 32, 57, 32, 254, 0, 255, 0, 24, 6, 0,
+    32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 57, 32, 57, 32, 57, 32, 255, 0, 0, 16, 0, 16, 0, 0, 16, 0,
+    63, 63, 63, 63, 254, 1, 0, 0, 0, 23, 0, 38, 63, 63, 38, 254, 1, 0, 0, 0, 22, 0, 38, 38, 38, 38, 254, 1, 0, 0,
+    0, 21, 0, 38, 38, 38, 38, 38, 38, 37, 254, 1, 0, 255, 0, 20, 0, 38, 37, 38, 37, 38, 37, 37, 38, 254, 0, 0, 255, 0,
+    19, 0, 38, 37, 38, 37, 37, 38, 37, 37, 37, 38, 37, 37, 37, 254, 0, 0, 255, 0, 18, 0, 38, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 36, 37, 37, 37, 254, 0, 0, 255, 0, 17,
+    0, 36, 37, 37, 37, 36, 37, 37, 36, 37, 37, 36, 37, 37, 36, 37, 37, 36, 37, 37, 36, 254, 0, 0, 255, 0, 8, 0, 36, 36,
+    37, 36, 36, 37, 36, 37, 36, 36, 36, 37, 36, 36, 36, 254, 0, 0, 255, 0, 7, 0, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 61, 36, 36, 36, 61, 36, 36, 36, 36, 61, 36, 254, 255, 0, 0, 0, 6, 0, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36,
+    61, 36, 61, 61, 36, 61, 36, 61, 36, 255, 16, 0, 31, 0, 16, 0, 8, 16, 0, 57, 57, 57, 57, 254, 0, 255, 0, 8, 23, 0,
+    32, 57, 57, 32, 254, 0, 255, 0, 8, 22, 0, 32, 32, 32, 32, 254, 0, 255, 0, 8, 21, 0, 32, 32, 32, 32, 32, 32, 37, 254,
+    0, 255, 255, 8, 20, 0, 32, 37, 32, 37, 32, 37, 37, 32, 254, 0, 0, 255, 8, 19, 0, 32, 37, 32, 37, 37, 32, 37, 37, 37,
+    32, 37, 37, 37, 254, 0, 0, 255, 8, 18, 0, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 42, 37, 37, 37, 254, 0, 0, 255, 8, 17, 0, 42, 37, 37, 37, 42, 37, 37, 42, 37, 37,
+    42, 37, 37, 42, 37, 37, 42, 37, 37, 42, 254, 0, 0, 255, 8, 8, 0, 42, 42, 37, 42, 42, 37, 42, 37, 42, 42, 42, 37, 42,
+    42, 42, 254, 0, 0, 255, 8, 7, 0, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 67, 42, 42, 42, 67, 42, 42, 42, 42, 67,
+    42, 254, 0, 1, 0, 8, 6, 0, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 67, 42, 67, 42, 67, 42, 255, 31,
+    0, 16, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 86, 61, 254, 255, 0, 0, 0, 34, 0, 61, 61, 86, 61, 61, 86, 61, 86,
+    61, 86, 61, 86, 61, 86, 86, 254, 255, 0, 1, 0, 35, 0, 61, 81, 86, 86, 86, 86, 86, 81, 86, 87, 86, 86, 81, 87, 86, 254,
+    0, 255, 1, 0, 36, 0, 86, 86, 87, 81, 87, 81, 87, 86, 82, 87, 81, 87, 81, 87, 82, 82, 254, 255, 0, 1, 0, 37, 0, 82,
+    87, 81, 82, 82, 87, 82, 81, 82, 82, 82, 82, 82, 81, 57, 254, 0, 255, 1, 0, 38, 0, 82, 82, 57, 82, 57, 82, 57, 82, 57,
+    82, 57, 57, 82, 57, 57, 57, 254, 0, 255, 0, 8, 16, 0, 82, 57, 57, 57, 57, 57, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0,
+    67, 67, 67, 67, 67, 92, 67, 254, 0, 1, 0, 8, 34, 0, 67, 67, 92, 67, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 92, 254,
+    0, 1, 1, 8, 35, 0, 67, 91, 92, 92, 92, 92, 92, 91, 92, 87, 92, 92, 91, 87, 92, 254, 255, 0, 1, 8, 36, 0, 92, 92,
+    87, 91, 87, 91, 87, 92, 86, 87, 91, 87, 91, 87, 86, 86, 254, 0, 1, 1, 8, 37, 0, 86, 87, 91, 86, 86, 87, 86, 91, 86,
+    86, 86, 86, 86, 91, 61, 254, 255, 0, 1, 8, 38, 0, 86, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 61, 86, 61, 61, 61, 254,
+    255, 0, 0, 16, 16, 0, 86, 61, 61, 61, 61, 61, 255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 88, 63, 254,
+    1, 0, 0, 16, 34, 0, 63, 63, 88, 63, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 88, 254, 1, 0, 1, 16, 35, 0, 63, 93,
+    88, 88, 88, 88, 88, 93, 88, 87, 88, 88, 93, 87, 88, 254, 0, 1, 1, 16, 36, 0, 88, 88, 87, 93, 87, 93, 87, 88, 92, 87,
+    93, 87, 93, 87, 92, 92, 254, 1, 0, 1, 16, 37, 0, 92, 87, 93, 92, 92, 87, 92, 93, 92, 92, 92, 92, 92, 93, 67, 254, 0,
+    1, 1, 16, 38, 0, 92, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 67, 92, 67, 67, 67, 254, 0, 1, 0, 24, 16, 0, 92, 67,
+    67, 67, 67, 67, 255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 57, 82, 57, 254, 0, 255, 0, 24, 34, 0, 57, 57,
+    82, 57, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 82, 254, 0, 255, 1, 24, 35, 0, 57, 83, 82, 82, 82, 82, 82, 83, 82, 87,
+    82, 82, 83, 87, 82, 254, 1, 0, 1, 24, 36, 0, 82, 82, 87, 83, 87, 83, 87, 82, 88, 87, 83, 87, 83, 87, 88, 88, 254, 0,
+    255, 1, 24, 37, 0, 88, 87, 83, 88, 88, 87, 88, 83, 88, 88, 88, 88, 88, 83, 63, 254, 1, 0, 1, 24, 38, 0, 88, 88, 63,
+    88, 63, 88, 63, 88, 63, 88, 63, 63, 88, 63, 63, 63, 254, 1, 0, 0, 0, 16, 0, 88, 63, 63, 63, 63, 63, 255, 31, 0, 16,
+    0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 86, 61, 254, 255, 0, 0, 0, 24, 0, 61, 61, 86, 61, 61, 86, 61, 86, 61, 86,
+    61, 86, 61, 86, 86, 254, 255, 0, 1, 0, 25, 0, 61, 91, 86, 86, 86, 86, 86, 91, 86, 87, 86, 86, 91, 87, 86, 254, 0, 1,
+    1, 0, 26, 0, 86, 86, 87, 91, 87, 91, 87, 86, 92, 87, 91, 87, 91, 87, 92, 92, 254, 255, 0, 1, 0, 27, 0, 92, 87, 91,
+    92, 92, 87, 92, 91, 92, 92, 92, 92, 92, 91, 67, 254, 0, 1, 1, 0, 28, 0, 92, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67,
+    67, 92, 67, 67, 67, 254, 0, 1, 0, 24, 16, 0, 92, 67, 67, 67, 67, 67, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67,
+    67, 67, 67, 92, 67, 254, 0, 1, 0, 8, 24, 0, 67, 67, 92, 67, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 92, 254, 0, 1,
+    1, 8, 25, 0, 67, 93, 92, 92, 92, 92, 92, 93, 92, 87, 92, 92, 93, 87, 92, 254, 1, 0, 1, 8, 26, 0, 92, 92, 87, 93,
+    87, 93, 87, 92, 88, 87, 93, 87, 93, 87, 88, 88, 254, 0, 1, 1, 8, 27, 0, 88, 87, 93, 88, 88, 87, 88, 93, 88, 88, 88,
+    88, 88, 93, 63, 254, 1, 0, 1, 8, 28, 0, 88, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 63, 88, 63, 63, 63, 254, 1, 0,
+    0, 0, 16, 0, 88, 63, 63, 63, 63, 63, 255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 88, 63, 254, 1, 0,
+    0, 16, 24, 0, 63, 63, 88, 63, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 88, 254, 1, 0, 1, 16, 25, 0, 63, 83, 88, 88,
+    88, 88, 88, 83, 88, 87, 88, 88, 83, 87, 88, 254, 0, 255, 1, 16, 26, 0, 88, 88, 87, 83, 87, 83, 87, 88, 82, 87, 83, 87,
+    83, 87, 82, 82, 254, 1, 0, 1, 16, 27, 0, 82, 87, 83, 82, 82, 87, 82, 83, 82, 82, 82, 82, 82, 83, 57, 254, 0, 255, 1,
+    16, 28, 0, 82, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 57, 82, 57, 57, 57, 254, 0, 255, 0, 8, 16, 0, 82, 57, 57, 57,
+    57, 57, 255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 57, 82, 57, 254, 0, 255, 0, 24, 24, 0, 57, 57, 82, 57,
+    57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 82, 254, 0, 255, 1, 24, 25, 0, 57, 81, 82, 82, 82, 82, 82, 81, 82, 87, 82, 82,
+    81, 87, 82, 254, 255, 0, 1, 24, 26, 0, 82, 82, 87, 81, 87, 81, 87, 82, 86, 87, 81, 87, 81, 87, 86, 86, 254, 0, 255, 1,
+    24, 27, 0, 86, 87, 81, 86, 86, 87, 86, 81, 86, 86, 86, 86, 86, 81, 61, 254, 255, 0, 1, 24, 28, 0, 86, 86, 61, 86, 61,
+    86, 61, 86, 61, 86, 61, 61, 86, 61, 61, 61, 254, 255, 0, 0, 16, 16, 0, 86, 61, 61, 61, 61, 61, 255, 31, 0, 16, 0, 16,
+    0, 16, 16, 0, 61, 61, 61, 61, 61, 36, 61, 254, 255, 0, 0, 24, 33, 0, 61, 61, 36, 61, 61, 36, 61, 36, 61, 36, 61, 36,
+    61, 36, 36, 254, 255, 0, 255, 24, 32, 0, 61, 31, 36, 36, 36, 36, 36, 31, 36, 37, 36, 36, 31, 37, 36, 254, 0, 255, 255, 24,
+    31, 0, 36, 36, 37, 31, 37, 31, 37, 36, 32, 37, 31, 37, 31, 37, 32, 32, 254, 255, 0, 255, 24, 30, 0, 32, 37, 31, 32, 32,
+    37, 32, 31, 32, 32, 32, 32, 32, 31, 57, 254, 0, 255, 255, 24, 29, 0, 32, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 57, 32,
+    57, 57, 57, 254, 0, 255, 0, 24, 0, 0, 32, 57, 57, 57, 57, 57, 255, 16, 0, 0, 0, 16, 0, 24, 16, 0, 67, 67, 67, 67,
+    67, 42, 67, 254, 0, 1, 0, 0, 33, 0, 67, 67, 42, 67, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 42, 254, 0, 1, 255, 0,
+    32, 0, 67, 41, 42, 42, 42, 42, 42, 41, 42, 37, 42, 42, 41, 37, 42, 254, 255, 0, 255, 0, 31, 0, 42, 42, 37, 41, 37, 41,
+    37, 42, 36, 37, 41, 37, 41, 37, 36, 36, 254, 0, 1, 255, 0, 30, 0, 36, 37, 41, 36, 36, 37, 36, 41, 36, 36, 36, 36, 36,
+    41, 61, 254, 255, 0, 255, 0, 29, 0, 36, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 61, 36, 61, 61, 61, 254, 255, 0, 0, 0,
+    0, 0, 36, 61, 61, 61, 61, 61, 255, 0, 0, 16, 0, 16, 0, 0, 16, 0, 63, 63, 63, 63, 63, 38, 63, 254, 1, 0, 0, 8,
+    33, 0, 63, 63, 38, 63, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 38, 254, 1, 0, 255, 8, 32, 0, 63, 43, 38, 38, 38, 38,
+    38, 43, 38, 37, 38, 38, 43, 37, 38, 254, 0, 1, 255, 8, 31, 0, 38, 38, 37, 43, 37, 43, 37, 38, 42, 37, 43, 37, 43, 37,
+    42, 42, 254, 1, 0, 255, 8, 30, 0, 42, 37, 43, 42, 42, 37, 42, 43, 42, 42, 42, 42, 42, 43, 67, 254, 0, 1, 255, 8, 29,
+    0, 42, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 67, 42, 67, 67, 67, 254, 0, 1, 0, 8, 0, 0, 42, 67, 67, 67, 67, 67,
+    255, 16, 0, 31, 0, 16, 0, 8, 16, 0, 57, 57, 57, 57, 57, 32, 57, 254, 0, 255, 0, 16, 33, 0, 57, 57, 32, 57, 57, 32,
+    57, 32, 57, 32, 57, 32, 57, 32, 32, 254, 0, 255, 255, 16, 32, 0, 57, 33, 32, 32, 32, 32, 32, 33, 32, 37, 32, 32, 33, 37,
+    32, 254, 1, 0, 255, 16, 31, 0, 32, 32, 37, 33, 37, 33, 37, 32, 38, 37, 33, 37, 33, 37, 38, 38, 254, 0, 255, 255, 16, 30,
+    0, 38, 37, 33, 38, 38, 37, 38, 33, 38, 38, 38, 38, 38, 33, 63, 254, 1, 0, 255, 16, 29, 0, 38, 38, 63, 38, 63, 38, 63,
+    38, 63, 38, 63, 63, 38, 63, 63, 63, 254, 1, 0, 0, 16, 0, 0, 38, 63, 63, 63, 63, 63, 255, 31, 0, 16, 0, 16, 0, 16,
+    16, 0, 61, 61, 61, 61, 61, 36, 61, 254, 255, 0, 0, 8, 43, 0, 61, 61, 36, 61, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36,
+    36, 254, 255, 0, 255, 8, 42, 0, 61, 41, 36, 36, 36, 36, 36, 41, 36, 37, 36, 36, 41, 37, 36, 254, 0, 1, 255, 8, 41, 0,
+    36, 36, 37, 41, 37, 41, 37, 36, 42, 37, 41, 37, 41, 37, 42, 42, 254, 255, 0, 255, 8, 40, 0, 42, 37, 41, 42, 42, 37, 42,
+    41, 42, 42, 42, 42, 42, 41, 67, 254, 0, 1, 255, 8, 39, 0, 42, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 67, 42, 67, 67,
+    67, 254, 0, 1, 0, 8, 0, 0, 42, 67, 67, 67, 67, 67, 255, 16, 0, 0, 0, 16, 0, 24, 16, 0, 67, 67, 67, 67, 67, 42,
+    67, 254, 0, 1, 0, 16, 43, 0, 67, 67, 42, 67, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 42, 254, 0, 1, 255, 16, 42, 0,
+    67, 43, 42, 42, 42, 42, 42, 43, 42, 37, 42, 42, 43, 37, 42, 254, 1, 0, 255, 16, 41, 0, 42, 42, 37, 43, 37, 43, 37, 42,
+    38, 37, 43, 37, 43, 37, 38, 38, 254, 0, 1, 255, 16, 40, 0, 38, 37, 43, 38, 38, 37, 38, 43, 38, 38, 38, 38, 38, 43, 63,
+    254, 1, 0, 255, 16, 39, 0, 38, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 63, 38, 63, 63, 63, 254, 1, 0, 0, 16, 0, 0,
+    38, 63, 63, 63, 63, 63, 255, 0, 0, 16, 0, 16, 0, 0, 16, 0, 63, 63, 63, 63, 63, 38, 63, 254, 1, 0, 0, 24, 43, 0,
+    63, 63, 38, 63, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 38, 254, 1, 0, 255, 24, 42, 0, 63, 33, 38, 38, 38, 38, 38, 33,
+    38, 37, 38, 38, 33, 37, 38, 254, 0, 255, 255, 24, 41, 0, 38, 38, 37, 33, 37, 33, 37, 38, 32, 37, 33, 37, 33, 37, 32, 32,
+    254, 1, 0, 255, 24, 40, 0, 32, 37, 33, 32, 32, 37, 32, 33, 32, 32, 32, 32, 32, 33, 57, 254, 0, 255, 255, 24, 39, 0, 32,
+    32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 57, 32, 57, 57, 57, 254, 0, 255, 0, 24, 0, 0, 32, 57, 57, 57, 57, 57, 255, 16,
+    0, 31, 0, 16, 0, 8, 16, 0, 57, 57, 57, 57, 57, 32, 57, 254, 0, 255, 0, 0, 43, 0, 57, 57, 32, 57, 57, 32, 57, 32,
+    57, 32, 57, 32, 57, 32, 32, 254, 0, 255, 255, 0, 42, 0, 57, 31, 32, 32, 32, 32, 32, 31, 32, 37, 32, 32, 31, 37, 32, 254,
+    255, 0, 255, 0, 41, 0, 32, 32, 37, 31, 37, 31, 37, 32, 36, 37, 31, 37, 31, 37, 36, 36, 254, 0, 255, 255, 0, 40, 0, 36,
+    37, 31, 36, 36, 37, 36, 31, 36, 36, 36, 36, 36, 31, 61, 254, 255, 0, 255, 0, 39, 0, 36, 36, 61, 36, 61, 36, 61, 36, 61,
+    36, 61, 61, 36, 61, 61, 61, 254, 255, 0, 0, 0, 0, 0, 36, 61, 61, 61, 61, 61, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0,
+    61, 61, 61, 86, 254, 255, 0, 0, 0, 1, 0, 61, 86, 61, 61, 86, 61, 86, 254, 255, 0, 0, 0, 2, 0, 86, 61, 86, 61, 86,
+    86, 61, 86, 254, 255, 0, 1, 0, 3, 0, 86, 86, 86, 86, 86, 87, 254, 255, 0, 1, 0, 4, 0, 86, 87, 86, 87, 86, 87, 255,
+    16, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 92, 254, 0, 1, 0, 8, 1, 0, 67, 92, 67, 67, 92, 67, 92, 254, 0, 1,
+    0, 8, 2, 0, 92, 67, 92, 67, 92, 92, 67, 92, 254, 0, 1, 1, 8, 3, 0, 92, 92, 92, 92, 92, 87, 254, 0, 1, 1, 8,
+    4, 0, 92, 87, 92, 87, 92, 87, 255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 63, 88, 254, 1, 0, 0, 16, 1, 0, 63,
+    88, 63, 63, 88, 63, 88, 254, 1, 0, 0, 16, 2, 0, 88, 63, 88, 63, 88, 88, 63, 88, 254, 1, 0, 1, 16, 3, 0, 88, 88,
+    88, 88, 88, 87, 254, 1, 0, 1, 16, 4, 0, 88, 87, 88, 87, 88, 87, 255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57,
+    82, 254, 0, 255, 0, 24, 1, 0, 57, 82, 57, 57, 82, 57, 82, 254, 0, 255, 0, 24, 2, 0, 82, 57, 82, 57, 82, 82, 57, 82,
+    254, 0, 255, 1, 24, 3, 0, 82, 82, 82, 82, 82, 87, 254, 0, 255, 1, 24, 4, 0, 82, 87, 82, 87, 82, 87, 255, 31, 0, 16,
+    0, 0, 0, 0, 4, 0, 87, 86, 87, 86, 87, 86, 254, 255, 0, 1, 0, 3, 0, 87, 86, 86, 86, 86, 86, 254, 255, 0, 1, 0,
+    2, 0, 86, 61, 86, 86, 61, 86, 61, 86, 254, 255, 0, 0, 0, 1, 0, 86, 61, 86, 61, 61, 86, 61, 254, 255, 0, 0, 0, 0,
+    0, 86, 61, 61, 61, 255, 16, 0, 0, 0, 0, 0, 8, 4, 0, 87, 92, 87, 92, 87, 92, 254, 0, 1, 1, 8, 3, 0, 87, 92,
+    92, 92, 92, 92, 254, 0, 1, 1, 8, 2, 0, 92, 67, 92, 92, 67, 92, 67, 92, 254, 0, 1, 0, 8, 1, 0, 92, 67, 92, 67,
+    67, 92, 67, 254, 0, 1, 0, 8, 0, 0, 92, 67, 67, 67, 255, 0, 0, 16, 0, 0, 0, 16, 4, 0, 87, 88, 87, 88, 87, 88,
+    254, 1, 0, 1, 16, 3, 0, 87, 88, 88, 88, 88, 88, 254, 1, 0, 1, 16, 2, 0, 88, 63, 88, 88, 63, 88, 63, 88, 254, 1,
+    0, 0, 16, 1, 0, 88, 63, 88, 63, 63, 88, 63, 254, 1, 0, 0, 16, 0, 0, 88, 63, 63, 63, 255, 16, 0, 31, 0, 0, 0,
+    24, 4, 0, 87, 82, 87, 82, 87, 82, 254, 0, 255, 1, 24, 3, 0, 87, 82, 82, 82, 82, 82, 254, 0, 255, 1, 24, 2, 0, 82,
+    57, 82, 82, 57, 82, 57, 82, 254, 0, 255, 0, 24, 1, 0, 82, 57, 82, 57, 57, 82, 57, 254, 0, 255, 0, 24, 0, 0, 82, 57,
+    57, 57, 255, 31, 0, 16, 0, 23, 0, 0, 0, 0, 61, 61, 61, 36, 254, 255, 0, 0, 0, 5, 0, 61, 36, 61, 61, 36, 61, 36,
+    254, 255, 0, 0, 0, 6, 0, 36, 61, 36, 61, 36, 36, 61, 36, 254, 255, 0, 255, 0, 7, 0, 36, 36, 36, 36, 36, 37, 254, 255,
+    0, 255, 0, 8, 0, 36, 37, 36, 37, 36, 37, 255, 16, 0, 0, 0, 23, 0, 8, 0, 0, 67, 67, 67, 42, 254, 0, 1, 0, 8,
+    5, 0, 67, 42, 67, 67, 42, 67, 42, 254, 0, 1, 0, 8, 6, 0, 42, 67, 42, 67, 42, 42, 67, 42, 254, 0, 1, 255, 8, 7,
+    0, 42, 42, 42, 42, 42, 37, 254, 0, 1, 255, 8, 8, 0, 42, 37, 42, 37, 42, 37, 255, 0, 0, 16, 0, 23, 0, 16, 0, 0,
+    63, 63, 63, 38, 254, 1, 0, 0, 16, 5, 0, 63, 38, 63, 63, 38, 63, 38, 254, 1, 0, 0, 16, 6, 0, 38, 63, 38, 63, 38,
+    38, 63, 38, 254, 1, 0, 255, 16, 7, 0, 38, 38, 38, 38, 38, 37, 254, 1, 0, 255, 16, 8, 0, 38, 37, 38, 37, 38, 37, 255,
+    16, 0, 31, 0, 23, 0, 24, 0, 0, 57, 57, 57, 32, 254, 0, 255, 0, 24, 5, 0, 57, 32, 57, 57, 32, 57, 32, 254, 0, 255,
+    0, 24, 6, 0, 32, 57, 32, 57, 32, 32, 57, 32, 254, 0, 255, 255, 24, 7, 0, 32, 32, 32, 32, 32, 37, 254, 0, 255, 255, 24,
+    8, 0, 32, 37, 32, 37, 32, 37, 255, 31, 0, 16, 0, 23, 0, 0, 8, 0, 37, 36, 37, 36, 37, 36, 254, 255, 0, 255, 0, 7,
+    0, 37, 36, 36, 36, 36, 36, 254, 255, 0, 255, 0, 6, 0, 36, 61, 36, 36, 61, 36, 61, 36, 254, 255, 0, 0, 0, 5, 0, 36,
+    61, 36, 61, 61, 36, 61, 254, 255, 0, 0, 0, 0, 0, 36, 61, 61, 61, 255, 16, 0, 0, 0, 23, 0, 8, 8, 0, 37, 42, 37,
+    42, 37, 42, 254, 0, 1, 255, 8, 7, 0, 37, 42, 42, 42, 42, 42, 254, 0, 1, 255, 8, 6, 0, 42, 67, 42, 42, 67, 42, 67,
+    42, 254, 0, 1, 0, 8, 5, 0, 42, 67, 42, 67, 67, 42, 67, 254, 0, 1, 0, 8, 0, 0, 42, 67, 67, 67, 255, 0, 0, 16,
+    0, 23, 0, 16, 8, 0, 37, 38, 37, 38, 37, 38, 254, 1, 0, 255, 16, 7, 0, 37, 38, 38, 38, 38, 38, 254, 1, 0, 255, 16,
+    6, 0, 38, 63, 38, 38, 63, 38, 63, 38, 254, 1, 0, 0, 16, 5, 0, 38, 63, 38, 63, 63, 38, 63, 254, 1, 0, 0, 16, 0,
+    0, 38, 63, 63, 63, 255, 16, 0, 31, 0, 23, 0, 24, 8, 0, 37, 32, 37, 32, 37, 32, 254, 0, 255, 255, 24, 7, 0, 37, 32,
+    32, 32, 32, 32, 254, 0, 255, 255, 24, 6, 0, 32, 57, 32, 32, 57, 32, 57, 32, 254, 0, 255, 0, 24, 5, 0, 32, 57, 32, 57,
+    57, 32, 57, 254, 0, 255, 0, 24, 0, 0, 32, 57, 57, 57, 255, 16, 0, 16, 0, 2, 0, 0, 10, 0, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 255, 16, 0,
+    16, 0, 2, 0, 8, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 255, 16, 0, 16, 0, 2, 0, 16, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 255, 16, 0, 16, 0, 2, 0,
+    24, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 255, 16, 0, 16, 0, 0, 0, 0, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 255, 16, 0, 16, 0, 0, 0, 8, 10, 0, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 255, 16,
+    0, 16, 0, 0, 0, 16, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 255, 16, 0, 16, 0, 0, 0, 24, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 255, 31, 0, 16, 0, 0, 0, 0, 45, 2,
+    61, 61, 61, 254, 255, 0, 0, 31, 45, 2, 61, 56, 61, 86, 61, 61, 61, 56, 254, 255, 0, 0, 30, 45, 2, 61, 56, 86, 61, 56,
+    61, 56, 61, 56, 254, 255, 0, 0, 29, 45, 2, 56, 86, 56, 56, 61, 56, 56, 56, 254, 255, 255, 0, 28, 45, 2, 85, 56, 56, 56,
+    254, 255, 255, 0, 27, 45, 2, 57, 56, 56, 57, 81, 57, 56, 57, 254, 255, 255, 0, 26, 45, 2, 57, 56, 57, 82, 56, 57, 57, 56,
+    57, 254, 0, 255, 0, 25, 45, 2, 57, 57, 82, 56, 57, 57, 57, 254, 0, 255, 0, 24, 45, 2, 57, 57, 82, 52, 57, 57, 57, 254,
+    0, 255, 0, 23, 45, 2, 57, 58, 57, 82, 57, 57, 57, 58, 254, 0, 255, 0, 22, 45, 2, 57, 58, 82, 57, 58, 57, 58, 57, 58,
+    254, 0, 255, 0, 21, 45, 2, 58, 82, 58, 58, 57, 58, 58, 58, 254, 1, 255, 0, 20, 45, 2, 77, 58, 58, 58, 254, 1, 255, 0,
+    19, 45, 2, 63, 58, 58, 88, 58, 63, 58, 63, 254, 1, 255, 0, 18, 45, 2, 63, 58, 63, 88, 58, 63, 63, 58, 63, 254, 1, 0,
+    0, 17, 45, 2, 63, 88, 63, 58, 63, 63, 63, 254, 1, 0, 0, 16, 45, 2, 63, 88, 255, 16, 0, 0, 0, 0, 0, 8, 45, 2,
+    67, 67, 67, 67, 254, 0, 1, 0, 7, 45, 2, 67, 66, 67, 92, 67, 67, 67, 66, 254, 0, 1, 0, 6, 45, 2, 67, 66, 67, 92,
+    66, 67, 66, 67, 66, 254, 0, 1, 0, 5, 45, 2, 66, 92, 66, 66, 67, 66, 66, 66, 254, 255, 1, 0, 4, 45, 2, 72, 91, 66,
+    66, 254, 255, 1, 0, 3, 45, 2, 61, 66, 66, 61, 66, 86, 66, 61, 254, 255, 1, 0, 2, 45, 2, 61, 66, 61, 61, 91, 61, 61,
+    66, 61, 254, 255, 0, 0, 1, 45, 2, 61, 61, 61, 91, 61, 61, 61, 254, 255, 0, 0, 0, 45, 2, 61, 61, 61, 85, 61, 61, 61,
+    254, 255, 0, 0, 31, 45, 2, 61, 56, 61, 86, 61, 61, 61, 56, 254, 255, 0, 0, 30, 45, 2, 61, 56, 86, 61, 56, 61, 56, 61,
+    56, 254, 255, 0, 0, 29, 45, 2, 56, 86, 56, 56, 61, 56, 56, 56, 254, 255, 255, 0, 28, 45, 2, 85, 56, 56, 56, 254, 255, 255,
+    0, 27, 45, 2, 57, 56, 56, 57, 81, 57, 56, 57, 254, 255, 255, 0, 26, 45, 2, 57, 56, 57, 82, 56, 57, 57, 56, 57, 254, 0,
+    255, 0, 25, 45, 2, 57, 57, 82, 56, 57, 57, 57, 254, 0, 255, 0, 24, 45, 2, 57, 57, 82, 255, 0, 0, 16, 0, 0, 0, 16,
+    45, 2, 63, 63, 63, 63, 254, 1, 0, 0, 15, 45, 2, 63, 68, 63, 88, 63, 63, 63, 68, 254, 1, 0, 0, 14, 45, 2, 63, 68,
+    88, 63, 68, 63, 68, 63, 68, 254, 1, 0, 0, 13, 45, 2, 68, 88, 68, 68, 63, 68, 68, 68, 254, 1, 1, 0, 12, 45, 2, 89,
+    68, 68, 68, 254, 1, 1, 0, 11, 45, 2, 67, 68, 68, 67, 93, 67, 68, 67, 254, 1, 1, 0, 10, 45, 2, 67, 68, 67, 92, 68,
+    67, 67, 68, 67, 254, 0, 1, 0, 9, 45, 2, 67, 67, 92, 68, 67, 67, 67, 254, 0, 1, 0, 8, 45, 2, 67, 67, 97, 67, 67,
+    67, 67, 254, 0, 1, 0, 7, 45, 2, 67, 66, 67, 92, 67, 67, 67, 66, 254, 0, 1, 0, 6, 45, 2, 67, 66, 67, 92, 66, 67,
+    66, 67, 66, 254, 0, 1, 0, 5, 45, 2, 66, 92, 66, 66, 67, 66, 66, 66, 254, 255, 1, 0, 4, 45, 2, 72, 91, 66, 66, 254,
+    255, 1, 0, 3, 45, 2, 61, 66, 66, 61, 66, 86, 66, 61, 254, 255, 1, 0, 2, 45, 2, 61, 66, 61, 61, 91, 61, 61, 66, 61,
+    254, 255, 0, 0, 1, 45, 2, 61, 61, 61, 91, 61, 61, 61, 254, 255, 0, 0, 0, 45, 2, 61, 61, 61, 255, 16, 0, 31, 0, 0,
+    0, 24, 45, 2, 57, 57, 57, 254, 0, 255, 0, 23, 45, 2, 57, 58, 57, 82, 57, 57, 57, 58, 254, 0, 255, 0, 22, 45, 2, 57,
+    58, 82, 57, 58, 57, 58, 57, 58, 254, 0, 255, 0, 21, 45, 2, 58, 82, 58, 58, 57, 58, 58, 58, 254, 1, 255, 0, 20, 45, 2,
+    77, 58, 58, 58, 254, 1, 255, 0, 19, 45, 2, 63, 58, 58, 88, 58, 63, 58, 63, 254, 1, 255, 0, 18, 45, 2, 63, 58, 63, 88,
+    58, 63, 63, 58, 63, 254, 1, 0, 0, 17, 45, 2, 63, 88, 63, 58, 63, 63, 63, 254, 1, 0, 0, 16, 45, 2, 63, 88, 64, 63,
+    63, 63, 63, 254, 1, 0, 0, 15, 45, 2, 63, 68, 63, 88, 63, 63, 63, 68, 254, 1, 0, 0, 14, 45, 2, 63, 68, 88, 63, 68,
+    63, 68, 63, 68, 254, 1, 0, 0, 13, 45, 2, 68, 88, 68, 68, 63, 68, 68, 68, 254, 1, 1, 0, 12, 45, 2, 89, 68, 68, 68,
+    254, 1, 1, 0, 11, 45, 2, 67, 68, 68, 67, 93, 67, 68, 67, 254, 1, 1, 0, 10, 45, 2, 67, 68, 67, 92, 68, 67, 67, 68,
+    67, 254, 0, 1, 0, 9, 45, 2, 67, 67, 92, 68, 67, 67, 67, 254, 0, 1, 0, 8, 45, 2, 67, 67, 255, 31, 0, 16, 0, 0,
+    0, 0, 45, 4, 61, 61, 61, 254, 255, 0, 0, 1, 45, 4, 61, 66, 61, 86, 61, 61, 61, 66, 254, 255, 0, 0, 2, 45, 4, 61,
+    66, 86, 61, 66, 61, 66, 61, 66, 254, 255, 0, 0, 3, 45, 4, 66, 86, 66, 66, 61, 66, 66, 66, 254, 255, 1, 0, 4, 45, 4,
+    85, 66, 66, 66, 254, 255, 1, 0, 5, 45, 4, 67, 66, 66, 92, 66, 67, 66, 67, 254, 255, 1, 0, 6, 45, 4, 67, 66, 67, 92,
+    66, 67, 67, 66, 67, 254, 0, 1, 0, 7, 45, 4, 67, 92, 67, 66, 67, 67, 67, 254, 0, 1, 0, 8, 45, 4, 67, 92, 72, 67,
+    67, 67, 67, 254, 0, 1, 0, 9, 45, 4, 67, 68, 67, 92, 67, 67, 67, 68, 254, 0, 1, 0, 10, 45, 4, 67, 68, 92, 67, 68,
+    67, 68, 67, 68, 254, 0, 1, 0, 11, 45, 4, 68, 92, 68, 68, 67, 68, 68, 68, 254, 1, 1, 0, 12, 45, 4, 97, 68, 68, 68,
+    254, 1, 1, 0, 13, 45, 4, 63, 68, 68, 63, 93, 63, 68, 63, 254, 1, 1, 0, 14, 45, 4, 63, 68, 63, 88, 68, 63, 63, 68,
+    63, 254, 1, 0, 0, 15, 45, 4, 63, 63, 88, 68, 63, 63, 63, 254, 1, 0, 0, 16, 45, 4, 63, 63, 255, 16, 0, 0, 0, 0,
+    0, 8, 45, 4, 67, 67, 67, 67, 254, 0, 1, 0, 9, 45, 4, 67, 68, 67, 92, 67, 67, 67, 68, 254, 0, 1, 0, 10, 45, 4,
+    67, 68, 92, 67, 68, 67, 68, 67, 68, 254, 0, 1, 0, 11, 45, 4, 68, 92, 68, 68, 67, 68, 68, 68, 254, 1, 1, 0, 12, 45,
+    4, 97, 68, 68, 68, 254, 1, 1, 0, 13, 45, 4, 63, 68, 68, 63, 93, 63, 68, 63, 254, 1, 1, 0, 14, 45, 4, 63, 68, 63,
+    88, 68, 63, 63, 68, 63, 254, 1, 0, 0, 15, 45, 4, 63, 63, 88, 68, 63, 63, 63, 254, 1, 0, 0, 16, 45, 4, 63, 63, 89,
+    63, 63, 63, 63, 254, 1, 0, 0, 17, 45, 4, 63, 58, 63, 88, 63, 63, 63, 58, 254, 1, 0, 0, 18, 45, 4, 63, 58, 63, 88,
+    58, 63, 58, 63, 58, 254, 1, 0, 0, 19, 45, 4, 58, 88, 58, 58, 63, 58, 58, 58, 254, 1, 255, 0, 20, 45, 4, 64, 83, 58,
+    58, 254, 1, 255, 0, 21, 45, 4, 57, 58, 58, 57, 58, 82, 58, 57, 254, 1, 255, 0, 22, 45, 4, 57, 58, 57, 57, 83, 57, 57,
+    58, 57, 254, 0, 255, 0, 23, 45, 4, 57, 57, 57, 83, 57, 57, 57, 254, 0, 255, 0, 24, 45, 4, 57, 57, 57, 255, 0, 0, 16,
+    0, 0, 0, 16, 45, 4, 63, 63, 63, 63, 254, 1, 0, 0, 17, 45, 4, 63, 58, 63, 88, 63, 63, 63, 58, 254, 1, 0, 0, 18,
+    45, 4, 63, 58, 63, 88, 58, 63, 58, 63, 58, 254, 1, 0, 0, 19, 45, 4, 58, 88, 58, 58, 63, 58, 58, 58, 254, 1, 255, 0,
+    20, 45, 4, 64, 83, 58, 58, 254, 1, 255, 0, 21, 45, 4, 57, 58, 58, 57, 58, 82, 58, 57, 254, 1, 255, 0, 22, 45, 4, 57,
+    58, 57, 57, 83, 57, 57, 58, 57, 254, 0, 255, 0, 23, 45, 4, 57, 57, 57, 83, 57, 57, 57, 254, 0, 255, 0, 24, 45, 4, 57,
+    57, 57, 77, 57, 57, 57, 254, 0, 255, 0, 25, 45, 4, 57, 56, 57, 82, 57, 57, 57, 56, 254, 0, 255, 0, 26, 45, 4, 57, 56,
+    82, 57, 56, 57, 56, 57, 56, 254, 0, 255, 0, 27, 45, 4, 56, 82, 56, 56, 57, 56, 56, 56, 254, 255, 255, 0, 28, 45, 4, 77,
+    56, 56, 56, 254, 255, 255, 0, 29, 45, 4, 61, 56, 56, 61, 81, 61, 56, 61, 254, 255, 255, 0, 30, 45, 4, 61, 56, 61, 86, 56,
+    61, 61, 56, 61, 254, 255, 0, 0, 31, 45, 4, 61, 61, 86, 56, 61, 61, 61, 254, 255, 0, 0, 0, 45, 4, 61, 61, 86, 255, 16,
+    0, 31, 0, 0, 0, 24, 45, 4, 57, 57, 57, 254, 0, 255, 0, 25, 45, 4, 57, 56, 57, 82, 57, 57, 57, 56, 254, 0, 255, 0,
+    26, 45, 4, 57, 56, 82, 57, 56, 57, 56, 57, 56, 254, 0, 255, 0, 27, 45, 4, 56, 82, 56, 56, 57, 56, 56, 56, 254, 255, 255,
+    0, 28, 45, 4, 77, 56, 56, 56, 254, 255, 255, 0, 29, 45, 4, 61, 56, 56, 61, 81, 61, 56, 61, 254, 255, 255, 0, 30, 45, 4,
+    61, 56, 61, 86, 56, 61, 61, 56, 61, 254, 255, 0, 0, 31, 45, 4, 61, 61, 86, 56, 61, 61, 61, 254, 255, 0, 0, 0, 45, 4,
+    61, 61, 86, 60, 61, 61, 61, 254, 255, 0, 0, 1, 45, 4, 61, 66, 61, 86, 61, 61, 61, 66, 254, 255, 0, 0, 2, 45, 4, 61,
+    66, 86, 61, 66, 61, 66, 61, 66, 254, 255, 0, 0, 3, 45, 4, 66, 86, 66, 66, 61, 66, 66, 66, 254, 255, 1, 0, 4, 45, 4,
+    85, 66, 66, 66, 254, 255, 1, 0, 5, 45, 4, 67, 66, 66, 92, 66, 67, 66, 67, 254, 255, 1, 0, 6, 45, 4, 67, 66, 67, 92,
+    66, 67, 67, 66, 67, 254, 0, 1, 0, 7, 45, 4, 67, 92, 67, 66, 67, 67, 67, 254, 0, 1, 0, 8, 45, 4, 67, 92, 255, 31,
+    0, 16, 0, 8, 0, 0, 47, 2, 61, 61, 61, 254, 255, 0, 0, 31, 47, 2, 61, 56, 61, 36, 61, 61, 61, 56, 254, 255, 0, 0,
+    30, 47, 2, 61, 56, 36, 61, 56, 61, 56, 61, 56, 254, 255, 0, 0, 29, 47, 2, 56, 36, 56, 56, 61, 56, 56, 56, 254, 255, 255,
+    0, 28, 47, 2, 35, 56, 56, 56, 254, 255, 255, 0, 27, 47, 2, 57, 56, 56, 57, 31, 57, 56, 57, 254, 255, 255, 0, 26, 47, 2,
+    57, 56, 57, 32, 56, 57, 57, 56, 57, 254, 0, 255, 0, 25, 47, 2, 57, 57, 32, 56, 57, 57, 57, 254, 0, 255, 0, 24, 47, 2,
+    57, 57, 32, 52, 57, 57, 57, 254, 0, 255, 0, 23, 47, 2, 57, 58, 57, 32, 57, 57, 57, 58, 254, 0, 255, 0, 22, 47, 2, 57,
+    58, 32, 57, 58, 57, 58, 57, 58, 254, 0, 255, 0, 21, 47, 2, 58, 32, 58, 58, 57, 58, 58, 58, 254, 1, 255, 0, 20, 47, 2,
+    27, 58, 58, 58, 254, 1, 255, 0, 19, 47, 2, 63, 58, 58, 38, 58, 63, 58, 63, 254, 1, 255, 0, 18, 47, 2, 63, 58, 63, 38,
+    58, 63, 63, 58, 63, 254, 1, 0, 0, 17, 47, 2, 63, 38, 63, 58, 63, 63, 63, 254, 1, 0, 0, 16, 47, 2, 63, 38, 255, 16,
+    0, 0, 0, 8, 0, 8, 47, 2, 67, 67, 67, 67, 254, 0, 1, 0, 7, 47, 2, 67, 66, 67, 42, 67, 67, 67, 66, 254, 0, 1,
+    0, 6, 47, 2, 67, 66, 67, 42, 66, 67, 66, 67, 66, 254, 0, 1, 0, 5, 47, 2, 66, 42, 66, 66, 67, 66, 66, 66, 254, 255,
+    1, 0, 4, 47, 2, 72, 41, 66, 66, 254, 255, 1, 0, 3, 47, 2, 61, 66, 66, 61, 66, 36, 66, 61, 254, 255, 1, 0, 2, 47,
+    2, 61, 66, 61, 61, 41, 61, 61, 66, 61, 254, 255, 0, 0, 1, 47, 2, 61, 61, 61, 41, 61, 61, 61, 254, 255, 0, 0, 0, 47,
+    2, 61, 61, 61, 35, 61, 61, 61, 254, 255, 0, 0, 31, 47, 2, 61, 56, 61, 36, 61, 61, 61, 56, 254, 255, 0, 0, 30, 47, 2,
+    61, 56, 36, 61, 56, 61, 56, 61, 56, 254, 255, 0, 0, 29, 47, 2, 56, 36, 56, 56, 61, 56, 56, 56, 254, 255, 255, 0, 28, 47,
+    2, 35, 56, 56, 56, 254, 255, 255, 0, 27, 47, 2, 57, 56, 56, 57, 31, 57, 56, 57, 254, 255, 255, 0, 26, 47, 2, 57, 56, 57,
+    32, 56, 57, 57, 56, 57, 254, 0, 255, 0, 25, 47, 2, 57, 57, 32, 56, 57, 57, 57, 254, 0, 255, 0, 24, 47, 2, 57, 57, 32,
+    255, 0, 0, 16, 0, 8, 0, 16, 47, 2, 63, 63, 63, 63, 254, 1, 0, 0, 15, 47, 2, 63, 68, 63, 38, 63, 63, 63, 68, 254,
+    1, 0, 0, 14, 47, 2, 63, 68, 38, 63, 68, 63, 68, 63, 68, 254, 1, 0, 0, 13, 47, 2, 68, 38, 68, 68, 63, 68, 68, 68,
+    254, 1, 1, 0, 12, 47, 2, 39, 68, 68, 68, 254, 1, 1, 0, 11, 47, 2, 67, 68, 68, 67, 43, 67, 68, 67, 254, 1, 1, 0,
+    10, 47, 2, 67, 68, 67, 42, 68, 67, 67, 68, 67, 254, 0, 1, 0, 9, 47, 2, 67, 67, 42, 68, 67, 67, 67, 254, 0, 1, 0,
+    8, 47, 2, 67, 67, 47, 67, 67, 67, 67, 254, 0, 1, 0, 7, 47, 2, 67, 66, 67, 42, 67, 67, 67, 66, 254, 0, 1, 0, 6,
+    47, 2, 67, 66, 67, 42, 66, 67, 66, 67, 66, 254, 0, 1, 0, 5, 47, 2, 66, 42, 66, 66, 67, 66, 66, 66, 254, 255, 1, 0,
+    4, 47, 2, 72, 41, 66, 66, 254, 255, 1, 0, 3, 47, 2, 61, 66, 66, 61, 66, 36, 66, 61, 254, 255, 1, 0, 2, 47, 2, 61,
+    66, 61, 61, 41, 61, 61, 66, 61, 254, 255, 0, 0, 1, 47, 2, 61, 61, 61, 41, 61, 61, 61, 254, 255, 0, 0, 0, 47, 2, 61,
+    61, 61, 255, 16, 0, 31, 0, 8, 0, 24, 47, 2, 57, 57, 57, 254, 0, 255, 0, 23, 47, 2, 57, 58, 57, 32, 57, 57, 57, 58,
+    254, 0, 255, 0, 22, 47, 2, 57, 58, 32, 57, 58, 57, 58, 57, 58, 254, 0, 255, 0, 21, 47, 2, 58, 32, 58, 58, 57, 58, 58,
+    58, 254, 1, 255, 0, 20, 47, 2, 27, 58, 58, 58, 254, 1, 255, 0, 19, 47, 2, 63, 58, 58, 38, 58, 63, 58, 63, 254, 1, 255,
+    0, 18, 47, 2, 63, 58, 63, 38, 58, 63, 63, 58, 63, 254, 1, 0, 0, 17, 47, 2, 63, 38, 63, 58, 63, 63, 63, 254, 1, 0,
+    0, 16, 47, 2, 63, 38, 64, 63, 63, 63, 63, 254, 1, 0, 0, 15, 47, 2, 63, 68, 63, 38, 63, 63, 63, 68, 254, 1, 0, 0,
+    14, 47, 2, 63, 68, 38, 63, 68, 63, 68, 63, 68, 254, 1, 0, 0, 13, 47, 2, 68, 38, 68, 68, 63, 68, 68, 68, 254, 1, 1,
+    0, 12, 47, 2, 39, 68, 68, 68, 254, 1, 1, 0, 11, 47, 2, 67, 68, 68, 67, 43, 67, 68, 67, 254, 1, 1, 0, 10, 47, 2,
+    67, 68, 67, 42, 68, 67, 67, 68, 67, 254, 0, 1, 0, 9, 47, 2, 67, 67, 42, 68, 67, 67, 67, 254, 0, 1, 0, 8, 47, 2,
+    67, 67, 255, 31, 0, 16, 0, 8, 0, 0, 47, 4, 61, 61, 61, 254, 255, 0, 0, 1, 47, 4, 61, 66, 61, 36, 61, 61, 61, 66,
+    254, 255, 0, 0, 2, 47, 4, 61, 66, 36, 61, 66, 61, 66, 61, 66, 254, 255, 0, 0, 3, 47, 4, 66, 36, 66, 66, 61, 66, 66,
+    66, 254, 255, 1, 0, 4, 47, 4, 35, 66, 66, 66, 254, 255, 1, 0, 5, 47, 4, 67, 66, 66, 42, 66, 67, 66, 67, 254, 255, 1,
+    0, 6, 47, 4, 67, 66, 67, 42, 66, 67, 67, 66, 67, 254, 0, 1, 0, 7, 47, 4, 67, 42, 67, 66, 67, 67, 67, 254, 0, 1,
+    0, 8, 47, 4, 67, 42, 72, 67, 67, 67, 67, 254, 0, 1, 0, 9, 47, 4, 67, 68, 67, 42, 67, 67, 67, 68, 254, 0, 1, 0,
+    10, 47, 4, 67, 68, 42, 67, 68, 67, 68, 67, 68, 254, 0, 1, 0, 11, 47, 4, 68, 42, 68, 68, 67, 68, 68, 68, 254, 1, 1,
+    0, 12, 47, 4, 47, 68, 68, 68, 254, 1, 1, 0, 13, 47, 4, 63, 68, 68, 63, 43, 63, 68, 63, 254, 1, 1, 0, 14, 47, 4,
+    63, 68, 63, 38, 68, 63, 63, 68, 63, 254, 1, 0, 0, 15, 47, 4, 63, 63, 38, 68, 63, 63, 63, 254, 1, 0, 0, 16, 47, 4,
+    63, 63, 255, 16, 0, 0, 0, 8, 0, 8, 47, 4, 67, 67, 67, 67, 254, 0, 1, 0, 9, 47, 4, 67, 68, 67, 42, 67, 67, 67,
+    68, 254, 0, 1, 0, 10, 47, 4, 67, 68, 42, 67, 68, 67, 68, 67, 68, 254, 0, 1, 0, 11, 47, 4, 68, 42, 68, 68, 67, 68,
+    68, 68, 254, 1, 1, 0, 12, 47, 4, 47, 68, 68, 68, 254, 1, 1, 0, 13, 47, 4, 63, 68, 68, 63, 43, 63, 68, 63, 254, 1,
+    1, 0, 14, 47, 4, 63, 68, 63, 38, 68, 63, 63, 68, 63, 254, 1, 0, 0, 15, 47, 4, 63, 63, 38, 68, 63, 63, 63, 254, 1,
+    0, 0, 16, 47, 4, 63, 63, 39, 63, 63, 63, 63, 254, 1, 0, 0, 17, 47, 4, 63, 58, 63, 38, 63, 63, 63, 58, 254, 1, 0,
+    0, 18, 47, 4, 63, 58, 63, 38, 58, 63, 58, 63, 58, 254, 1, 0, 0, 19, 47, 4, 58, 38, 58, 58, 63, 58, 58, 58, 254, 1,
+    255, 0, 20, 47, 4, 64, 33, 58, 58, 254, 1, 255, 0, 21, 47, 4, 57, 58, 58, 57, 58, 32, 58, 57, 254, 1, 255, 0, 22, 47,
+    4, 57, 58, 57, 57, 33, 57, 57, 58, 57, 254, 0, 255, 0, 23, 47, 4, 57, 57, 57, 33, 57, 57, 57, 254, 0, 255, 0, 24, 47,
+    4, 57, 57, 57, 255, 0, 0, 16, 0, 8, 0, 16, 47, 4, 63, 63, 63, 63, 254, 1, 0, 0, 17, 47, 4, 63, 58, 63, 38, 63,
+    63, 63, 58, 254, 1, 0, 0, 18, 47, 4, 63, 58, 63, 38, 58, 63, 58, 63, 58, 254, 1, 0, 0, 19, 47, 4, 58, 38, 58, 58,
+    63, 58, 58, 58, 254, 1, 255, 0, 20, 47, 4, 64, 33, 58, 58, 254, 1, 255, 0, 21, 47, 4, 57, 58, 58, 57, 58, 32, 58, 57,
+    254, 1, 255, 0, 22, 47, 4, 57, 58, 57, 57, 33, 57, 57, 58, 57, 254, 0, 255, 0, 23, 47, 4, 57, 57, 57, 33, 57, 57, 57,
+    254, 0, 255, 0, 24, 47, 4, 57, 57, 57, 27, 57, 57, 57, 254, 0, 255, 0, 25, 47, 4, 57, 56, 57, 32, 57, 57, 57, 56, 254,
+    0, 255, 0, 26, 47, 4, 57, 56, 32, 57, 56, 57, 56, 57, 56, 254, 0, 255, 0, 27, 47, 4, 56, 32, 56, 56, 57, 56, 56, 56,
+    254, 255, 255, 0, 28, 47, 4, 27, 56, 56, 56, 254, 255, 255, 0, 29, 47, 4, 61, 56, 56, 61, 31, 61, 56, 61, 254, 255, 255, 0,
+    30, 47, 4, 61, 56, 61, 36, 56, 61, 61, 56, 61, 254, 255, 0, 0, 31, 47, 4, 61, 61, 36, 56, 61, 61, 61, 254, 255, 0, 0,
+    0, 47, 4, 61, 61, 36, 255, 16, 0, 31, 0, 8, 0, 24, 47, 4, 57, 57, 57, 254, 0, 255, 0, 25, 47, 4, 57, 56, 57, 32,
+    57, 57, 57, 56, 254, 0, 255, 0, 26, 47, 4, 57, 56, 32, 57, 56, 57, 56, 57, 56, 254, 0, 255, 0, 27, 47, 4, 56, 32, 56,
+    56, 57, 56, 56, 56, 254, 255, 255, 0, 28, 47, 4, 27, 56, 56, 56, 254, 255, 255, 0, 29, 47, 4, 61, 56, 56, 61, 31, 61, 56,
+    61, 254, 255, 255, 0, 30, 47, 4, 61, 56, 61, 36, 56, 61, 61, 56, 61, 254, 255, 0, 0, 31, 47, 4, 61, 61, 36, 56, 61, 61,
+    61, 254, 255, 0, 0, 0, 47, 4, 61, 61, 36, 60, 61, 61, 61, 254, 255, 0, 0, 1, 47, 4, 61, 66, 61, 36, 61, 61, 61, 66,
+    254, 255, 0, 0, 2, 47, 4, 61, 66, 36, 61, 66, 61, 66, 61, 66, 254, 255, 0, 0, 3, 47, 4, 66, 36, 66, 66, 61, 66, 66,
+    66, 254, 255, 1, 0, 4, 47, 4, 35, 66, 66, 66, 254, 255, 1, 0, 5, 47, 4, 67, 66, 66, 42, 66, 67, 66, 67, 254, 255, 1,
+    0, 6, 47, 4, 67, 66, 67, 42, 66, 67, 67, 66, 67, 254, 0, 1, 0, 7, 47, 4, 67, 42, 67, 66, 67, 67, 67, 254, 0, 1,
+    0, 8, 47, 4, 67, 42, 255, 31, 0, 16, 0, 0, 0, 0, 44, 2, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 31, 44, 2, 56,
+    61, 61, 61, 61, 61, 81, 61, 61, 61, 61, 56, 61, 254, 255, 0, 0, 30, 44, 2, 61, 56, 61, 61, 56, 61, 86, 56, 61, 56, 61,
+    56, 61, 56, 254, 255, 0, 0, 29, 44, 2, 56, 61, 56, 56, 61, 81, 56, 61, 56, 56, 61, 56, 254, 255, 255, 0, 28, 44, 2, 56,
+    61, 56, 56, 56, 56, 86, 56, 56, 56, 56, 57, 254, 255, 255, 0, 27, 44, 2, 56, 56, 57, 56, 56, 57, 56, 56, 82, 56, 56, 57,
+    254, 255, 255, 0, 26, 44, 2, 57, 56, 57, 56, 57, 56, 57, 56, 57, 82, 56, 57, 57, 254, 255, 255, 0, 25, 44, 2, 57, 57, 57,
+    56, 57, 57, 57, 57, 56, 82, 57, 57, 57, 57, 56, 254, 0, 255, 0, 24, 44, 2, 57, 57, 57, 57, 57, 57, 57, 82, 57, 57, 57,
+    57, 57, 57, 57, 254, 0, 255, 0, 23, 44, 2, 58, 57, 57, 57, 57, 57, 83, 57, 57, 57, 57, 58, 57, 254, 0, 255, 0, 22, 44,
+    2, 57, 58, 57, 57, 58, 57, 82, 58, 57, 58, 57, 58, 57, 58, 254, 0, 255, 0, 21, 44, 2, 58, 57, 58, 58, 57, 83, 58, 57,
+    58, 58, 57, 58, 254, 1, 255, 0, 20, 44, 2, 58, 57, 58, 58, 58, 58, 82, 58, 58, 58, 58, 63, 254, 1, 255, 0, 19, 44, 2,
+    58, 58, 63, 58, 58, 63, 58, 83, 63, 58, 58, 63, 254, 1, 255, 0, 18, 44, 2, 63, 58, 63, 58, 63, 58, 63, 58, 88, 63, 58,
+    63, 63, 254, 1, 255, 0, 17, 44, 2, 63, 63, 63, 58, 63, 63, 63, 63, 83, 63, 63, 63, 63, 63, 58, 254, 1, 0, 0, 16, 44,
+    2, 63, 63, 63, 63, 63, 63, 88, 255, 16, 0, 0, 0, 0, 0, 8, 44, 2, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 7,
+    44, 2, 66, 67, 67, 67, 67, 67, 91, 67, 67, 67, 67, 66, 67, 254, 0, 1, 0, 6, 44, 2, 67, 66, 67, 67, 66, 67, 92, 66,
+    67, 66, 67, 66, 67, 66, 254, 0, 1, 0, 5, 44, 2, 66, 67, 66, 66, 67, 66, 91, 67, 66, 66, 67, 66, 254, 255, 1, 0, 4,
+    44, 2, 66, 67, 66, 66, 66, 66, 67, 91, 66, 66, 66, 61, 254, 255, 1, 0, 3, 44, 2, 66, 66, 61, 66, 66, 61, 66, 66, 86,
+    66, 66, 61, 254, 255, 1, 0, 2, 44, 2, 61, 66, 61, 66, 61, 66, 61, 66, 61, 61, 91, 61, 61, 254, 255, 1, 0, 1, 44, 2,
+    61, 61, 61, 66, 61, 61, 61, 61, 66, 61, 86, 61, 61, 61, 66, 254, 255, 0, 0, 0, 44, 2, 61, 61, 61, 61, 61, 61, 61, 61,
+    86, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 31, 44, 2, 56, 61, 61, 61, 61, 61, 81, 61, 61, 61, 61, 56, 61, 254, 255, 0,
+    0, 30, 44, 2, 61, 56, 61, 61, 56, 61, 86, 56, 61, 56, 61, 56, 61, 56, 254, 255, 0, 0, 29, 44, 2, 56, 61, 56, 56, 61,
+    81, 56, 61, 56, 56, 61, 56, 254, 255, 255, 0, 28, 44, 2, 56, 61, 56, 56, 56, 56, 86, 56, 56, 56, 56, 57, 254, 255, 255, 0,
+    27, 44, 2, 56, 56, 57, 56, 56, 57, 56, 56, 82, 56, 56, 57, 254, 255, 255, 0, 26, 44, 2, 57, 56, 57, 56, 57, 56, 57, 56,
+    57, 82, 56, 57, 57, 254, 255, 255, 0, 25, 44, 2, 57, 57, 57, 56, 57, 57, 57, 57, 56, 82, 57, 57, 57, 57, 56, 254, 0, 255,
+    0, 24, 44, 2, 57, 57, 57, 57, 57, 57, 57, 82, 255, 0, 0, 16, 0, 0, 0, 16, 44, 2, 63, 63, 63, 63, 63, 63, 63, 254,
+    1, 0, 0, 15, 44, 2, 68, 63, 63, 63, 63, 63, 93, 63, 63, 63, 63, 68, 63, 254, 1, 0, 0, 14, 44, 2, 63, 68, 63, 63,
+    68, 63, 88, 68, 63, 68, 63, 68, 63, 68, 254, 1, 0, 0, 13, 44, 2, 68, 63, 68, 68, 63, 93, 68, 63, 68, 68, 63, 68, 254,
+    1, 1, 0, 12, 44, 2, 68, 63, 68, 68, 68, 68, 88, 68, 68, 68, 68, 67, 254, 1, 1, 0, 11, 44, 2, 68, 68, 67, 68, 68,
+    67, 68, 68, 92, 68, 68, 67, 254, 1, 1, 0, 10, 44, 2, 67, 68, 67, 68, 67, 68, 67, 68, 67, 92, 68, 67, 67, 254, 1, 1,
+    0, 9, 44, 2, 67, 67, 67, 68, 67, 67, 67, 67, 68, 92, 67, 67, 67, 67, 68, 254, 0, 1, 0, 8, 44, 2, 67, 67, 67, 67,
+    67, 67, 67, 92, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 7, 44, 2, 66, 67, 67, 67, 67, 67, 91, 67, 67, 67, 67, 66,
+    67, 254, 0, 1, 0, 6, 44, 2, 67, 66, 67, 67, 66, 67, 92, 66, 67, 66, 67, 66, 67, 66, 254, 0, 1, 0, 5, 44, 2, 66,
+    67, 66, 66, 67, 66, 91, 67, 66, 66, 67, 66, 254, 255, 1, 0, 4, 44, 2, 66, 67, 66, 66, 66, 66, 67, 91, 66, 66, 66, 61,
+    254, 255, 1, 0, 3, 44, 2, 66, 66, 61, 66, 66, 61, 66, 66, 86, 66, 66, 61, 254, 255, 1, 0, 2, 44, 2, 61, 66, 61, 66,
+    61, 66, 61, 66, 61, 61, 91, 61, 61, 254, 255, 1, 0, 1, 44, 2, 61, 61, 61, 66, 61, 61, 61, 61, 66, 61, 86, 61, 61, 61,
+    66, 254, 255, 0, 0, 0, 44, 2, 61, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 31, 0, 0, 0, 24, 44, 2, 57, 57, 57, 57,
+    57, 57, 254, 0, 255, 0, 23, 44, 2, 58, 57, 57, 57, 57, 57, 83, 57, 57, 57, 57, 58, 57, 254, 0, 255, 0, 22, 44, 2, 57,
+    58, 57, 57, 58, 57, 82, 58, 57, 58, 57, 58, 57, 58, 254, 0, 255, 0, 21, 44, 2, 58, 57, 58, 58, 57, 83, 58, 57, 58, 58,
+    57, 58, 254, 1, 255, 0, 20, 44, 2, 58, 57, 58, 58, 58, 58, 82, 58, 58, 58, 58, 63, 254, 1, 255, 0, 19, 44, 2, 58, 58,
+    63, 58, 58, 63, 58, 83, 63, 58, 58, 63, 254, 1, 255, 0, 18, 44, 2, 63, 58, 63, 58, 63, 58, 63, 58, 88, 63, 58, 63, 63,
+    254, 1, 255, 0, 17, 44, 2, 63, 63, 63, 58, 63, 63, 63, 63, 83, 63, 63, 63, 63, 63, 58, 254, 1, 0, 0, 16, 44, 2, 63,
+    63, 63, 63, 63, 63, 88, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 15, 44, 2, 68, 63, 63, 63, 63, 63, 93, 63, 63,
+    63, 63, 68, 63, 254, 1, 0, 0, 14, 44, 2, 63, 68, 63, 63, 68, 63, 88, 68, 63, 68, 63, 68, 63, 68, 254, 1, 0, 0, 13,
+    44, 2, 68, 63, 68, 68, 63, 93, 68, 63, 68, 68, 63, 68, 254, 1, 1, 0, 12, 44, 2, 68, 63, 68, 68, 68, 68, 88, 68, 68,
+    68, 68, 67, 254, 1, 1, 0, 11, 44, 2, 68, 68, 67, 68, 68, 67, 68, 68, 92, 68, 68, 67, 254, 1, 1, 0, 10, 44, 2, 67,
+    68, 67, 68, 67, 68, 67, 68, 67, 92, 68, 67, 67, 254, 1, 1, 0, 9, 44, 2, 67, 67, 67, 68, 67, 67, 67, 67, 68, 92, 67,
+    67, 67, 67, 68, 254, 0, 1, 0, 8, 44, 2, 67, 67, 67, 67, 67, 67, 67, 255, 31, 0, 16, 0, 0, 0, 0, 44, 4, 61, 61,
+    61, 61, 61, 61, 254, 255, 0, 0, 1, 44, 4, 66, 61, 61, 61, 61, 61, 91, 61, 61, 61, 61, 66, 61, 254, 255, 0, 0, 2, 44,
+    4, 61, 66, 61, 61, 66, 61, 86, 66, 61, 66, 61, 66, 61, 66, 254, 255, 0, 0, 3, 44, 4, 66, 61, 66, 66, 61, 91, 66, 61,
+    66, 66, 61, 66, 254, 255, 1, 0, 4, 44, 4, 66, 61, 66, 66, 66, 66, 86, 66, 66, 66, 66, 67, 254, 255, 1, 0, 5, 44, 4,
+    66, 66, 67, 66, 66, 67, 66, 91, 67, 66, 66, 67, 254, 255, 1, 0, 6, 44, 4, 67, 66, 67, 66, 67, 66, 67, 66, 92, 67, 66,
+    67, 67, 254, 255, 1, 0, 7, 44, 4, 67, 67, 67, 66, 67, 67, 67, 67, 91, 67, 67, 67, 67, 67, 66, 254, 0, 1, 0, 8, 44,
+    4, 67, 67, 67, 67, 67, 67, 92, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 9, 44, 4, 68, 67, 67, 67, 67, 67, 93,
+    67, 67, 67, 67, 68, 67, 254, 0, 1, 0, 10, 44, 4, 67, 68, 67, 67, 68, 67, 92, 68, 67, 68, 67, 68, 67, 68, 254, 0, 1,
+    0, 11, 44, 4, 68, 67, 68, 68, 67, 93, 68, 67, 68, 68, 67, 68, 254, 1, 1, 0, 12, 44, 4, 68, 67, 68, 68, 68, 68, 92,
+    68, 68, 68, 68, 63, 254, 1, 1, 0, 13, 44, 4, 68, 68, 63, 68, 68, 63, 68, 68, 88, 68, 68, 63, 254, 1, 1, 0, 14, 44,
+    4, 63, 68, 63, 68, 63, 68, 63, 68, 63, 88, 68, 63, 63, 254, 1, 1, 0, 15, 44, 4, 63, 63, 63, 68, 63, 63, 63, 63, 68,
+    88, 63, 63, 63, 63, 68, 254, 1, 0, 0, 16, 44, 4, 63, 63, 63, 63, 63, 63, 63, 255, 16, 0, 0, 0, 0, 0, 8, 44, 4,
+    67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 9, 44, 4, 68, 67, 67, 67, 67, 67, 93, 67, 67, 67, 67, 68, 67, 254, 0, 1,
+    0, 10, 44, 4, 67, 68, 67, 67, 68, 67, 92, 68, 67, 68, 67, 68, 67, 68, 254, 0, 1, 0, 11, 44, 4, 68, 67, 68, 68, 67,
+    93, 68, 67, 68, 68, 67, 68, 254, 1, 1, 0, 12, 44, 4, 68, 67, 68, 68, 68, 68, 92, 68, 68, 68, 68, 63, 254, 1, 1, 0,
+    13, 44, 4, 68, 68, 63, 68, 68, 63, 68, 68, 88, 68, 68, 63, 254, 1, 1, 0, 14, 44, 4, 63, 68, 63, 68, 63, 68, 63, 68,
+    63, 88, 68, 63, 63, 254, 1, 1, 0, 15, 44, 4, 63, 63, 63, 68, 63, 63, 63, 63, 68, 88, 63, 63, 63, 63, 68, 254, 1, 0,
+    0, 16, 44, 4, 63, 63, 63, 63, 63, 63, 63, 88, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 17, 44, 4, 58, 63, 63, 63,
+    63, 63, 83, 63, 63, 63, 63, 58, 63, 254, 1, 0, 0, 18, 44, 4, 63, 58, 63, 63, 58, 63, 88, 58, 63, 58, 63, 58, 63, 58,
+    254, 1, 0, 0, 19, 44, 4, 58, 63, 58, 58, 63, 58, 83, 63, 58, 58, 63, 58, 254, 1, 255, 0, 20, 44, 4, 58, 63, 58, 58,
+    58, 58, 63, 83, 58, 58, 58, 57, 254, 1, 255, 0, 21, 44, 4, 58, 58, 57, 58, 58, 57, 58, 58, 82, 58, 58, 57, 254, 1, 255,
+    0, 22, 44, 4, 57, 58, 57, 58, 57, 58, 57, 58, 57, 57, 83, 57, 57, 254, 1, 255, 0, 23, 44, 4, 57, 57, 57, 58, 57, 57,
+    57, 57, 58, 57, 82, 57, 57, 57, 58, 254, 0, 255, 0, 24, 44, 4, 57, 57, 57, 57, 57, 57, 57, 57, 255, 0, 0, 16, 0, 0,
+    0, 16, 44, 4, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 17, 44, 4, 58, 63, 63, 63, 63, 63, 83, 63, 63, 63, 63, 58,
+    63, 254, 1, 0, 0, 18, 44, 4, 63, 58, 63, 63, 58, 63, 88, 58, 63, 58, 63, 58, 63, 58, 254, 1, 0, 0, 19, 44, 4, 58,
+    63, 58, 58, 63, 58, 83, 63, 58, 58, 63, 58, 254, 1, 255, 0, 20, 44, 4, 58, 63, 58, 58, 58, 58, 63, 83, 58, 58, 58, 57,
+    254, 1, 255, 0, 21, 44, 4, 58, 58, 57, 58, 58, 57, 58, 58, 82, 58, 58, 57, 254, 1, 255, 0, 22, 44, 4, 57, 58, 57, 58,
+    57, 58, 57, 58, 57, 57, 83, 57, 57, 254, 1, 255, 0, 23, 44, 4, 57, 57, 57, 58, 57, 57, 57, 57, 58, 57, 82, 57, 57, 57,
+    58, 254, 0, 255, 0, 24, 44, 4, 57, 57, 57, 57, 57, 57, 57, 57, 82, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 25, 44, 4,
+    56, 57, 57, 57, 57, 57, 81, 57, 57, 57, 57, 56, 57, 254, 0, 255, 0, 26, 44, 4, 57, 56, 57, 57, 56, 57, 82, 56, 57, 56,
+    57, 56, 57, 56, 254, 0, 255, 0, 27, 44, 4, 56, 57, 56, 56, 57, 81, 56, 57, 56, 56, 57, 56, 254, 255, 255, 0, 28, 44, 4,
+    56, 57, 56, 56, 56, 56, 82, 56, 56, 56, 56, 61, 254, 255, 255, 0, 29, 44, 4, 56, 56, 61, 56, 56, 61, 56, 56, 86, 56, 56,
+    61, 254, 255, 255, 0, 30, 44, 4, 61, 56, 61, 56, 61, 56, 61, 56, 61, 86, 56, 61, 61, 254, 255, 255, 0, 31, 44, 4, 61, 61,
+    61, 56, 61, 61, 61, 61, 56, 86, 61, 61, 61, 61, 56, 254, 255, 0, 0, 0, 44, 4, 61, 61, 61, 61, 61, 61, 61, 86, 255, 16,
+    0, 31, 0, 0, 0, 24, 44, 4, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 25, 44, 4, 56, 57, 57, 57, 57, 57, 81, 57, 57,
+    57, 57, 56, 57, 254, 0, 255, 0, 26, 44, 4, 57, 56, 57, 57, 56, 57, 82, 56, 57, 56, 57, 56, 57, 56, 254, 0, 255, 0, 27,
+    44, 4, 56, 57, 56, 56, 57, 81, 56, 57, 56, 56, 57, 56, 254, 255, 255, 0, 28, 44, 4, 56, 57, 56, 56, 56, 56, 82, 56, 56,
+    56, 56, 61, 254, 255, 255, 0, 29, 44, 4, 56, 56, 61, 56, 56, 61, 56, 56, 86, 56, 56, 61, 254, 255, 255, 0, 30, 44, 4, 61,
+    56, 61, 56, 61, 56, 61, 56, 61, 86, 56, 61, 61, 254, 255, 255, 0, 31, 44, 4, 61, 61, 61, 56, 61, 61, 61, 61, 56, 86, 61,
+    61, 61, 61, 56, 254, 255, 0, 0, 0, 44, 4, 61, 61, 61, 61, 61, 61, 61, 86, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0,
+    1, 44, 4, 66, 61, 61, 61, 61, 61, 91, 61, 61, 61, 61, 66, 61, 254, 255, 0, 0, 2, 44, 4, 61, 66, 61, 61, 66, 61, 86,
+    66, 61, 66, 61, 66, 61, 66, 254, 255, 0, 0, 3, 44, 4, 66, 61, 66, 66, 61, 91, 66, 61, 66, 66, 61, 66, 254, 255, 1, 0,
+    4, 44, 4, 66, 61, 66, 66, 66, 66, 86, 66, 66, 66, 66, 67, 254, 255, 1, 0, 5, 44, 4, 66, 66, 67, 66, 66, 67, 66, 91,
+    67, 66, 66, 67, 254, 255, 1, 0, 6, 44, 4, 67, 66, 67, 66, 67, 66, 67, 66, 92, 67, 66, 67, 67, 254, 255, 1, 0, 7, 44,
+    4, 67, 67, 67, 66, 67, 67, 67, 67, 91, 67, 67, 67, 67, 67, 66, 254, 0, 1, 0, 8, 44, 4, 67, 67, 67, 67, 67, 67, 92,
+    255, 31, 0, 16, 0, 8, 0, 0, 46, 2, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 31, 46, 2, 56, 61, 61, 61, 61, 61, 31,
+    61, 61, 61, 61, 56, 61, 254, 255, 0, 0, 30, 46, 2, 61, 56, 61, 61, 56, 61, 36, 56, 61, 56, 61, 56, 61, 56, 254, 255, 0,
+    0, 29, 46, 2, 56, 61, 56, 56, 61, 31, 56, 61, 56, 56, 61, 56, 254, 255, 255, 0, 28, 46, 2, 56, 61, 56, 56, 56, 56, 36,
+    56, 56, 56, 56, 57, 254, 255, 255, 0, 27, 46, 2, 56, 56, 57, 56, 56, 57, 56, 56, 32, 56, 56, 57, 254, 255, 255, 0, 26, 46,
+    2, 57, 56, 57, 56, 57, 56, 57, 56, 57, 32, 56, 57, 57, 254, 255, 255, 0, 25, 46, 2, 57, 57, 57, 56, 57, 57, 57, 57, 56,
+    32, 57, 57, 57, 57, 56, 254, 0, 255, 0, 24, 46, 2, 57, 57, 57, 57, 57, 57, 57, 32, 57, 57, 57, 57, 57, 57, 57, 254, 0,
+    255, 0, 23, 46, 2, 58, 57, 57, 57, 57, 57, 33, 57, 57, 57, 57, 58, 57, 254, 0, 255, 0, 22, 46, 2, 57, 58, 57, 57, 58,
+    57, 32, 58, 57, 58, 57, 58, 57, 58, 254, 0, 255, 0, 21, 46, 2, 58, 57, 58, 58, 57, 33, 58, 57, 58, 58, 57, 58, 254, 1,
+    255, 0, 20, 46, 2, 58, 57, 58, 58, 58, 58, 32, 58, 58, 58, 58, 63, 254, 1, 255, 0, 19, 46, 2, 58, 58, 63, 58, 58, 63,
+    58, 33, 63, 58, 58, 63, 254, 1, 255, 0, 18, 46, 2, 63, 58, 63, 58, 63, 58, 63, 58, 38, 63, 58, 63, 63, 254, 1, 255, 0,
+    17, 46, 2, 63, 63, 63, 58, 63, 63, 63, 63, 33, 63, 63, 63, 63, 63, 58, 254, 1, 0, 0, 16, 46, 2, 63, 63, 63, 63, 63,
+    63, 38, 255, 16, 0, 0, 0, 8, 0, 8, 46, 2, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 7, 46, 2, 66, 67, 67, 67,
+    67, 67, 41, 67, 67, 67, 67, 66, 67, 254, 0, 1, 0, 6, 46, 2, 67, 66, 67, 67, 66, 67, 42, 66, 67, 66, 67, 66, 67, 66,
+    254, 0, 1, 0, 5, 46, 2, 66, 67, 66, 66, 67, 66, 41, 67, 66, 66, 67, 66, 254, 255, 1, 0, 4, 46, 2, 66, 67, 66, 66,
+    66, 66, 67, 41, 66, 66, 66, 61, 254, 255, 1, 0, 3, 46, 2, 66, 66, 61, 66, 66, 61, 66, 66, 36, 66, 66, 61, 254, 255, 1,
+    0, 2, 46, 2, 61, 66, 61, 66, 61, 66, 61, 66, 61, 61, 41, 61, 61, 254, 255, 1, 0, 1, 46, 2, 61, 61, 61, 66, 61, 61,
+    61, 61, 66, 61, 36, 61, 61, 61, 66, 254, 255, 0, 0, 0, 46, 2, 61, 61, 61, 61, 61, 61, 61, 61, 36, 61, 61, 61, 61, 61,
+    61, 254, 255, 0, 0, 31, 46, 2, 56, 61, 61, 61, 61, 61, 31, 61, 61, 61, 61, 56, 61, 254, 255, 0, 0, 30, 46, 2, 61, 56,
+    61, 61, 56, 61, 36, 56, 61, 56, 61, 56, 61, 56, 254, 255, 0, 0, 29, 46, 2, 56, 61, 56, 56, 61, 31, 56, 61, 56, 56, 61,
+    56, 254, 255, 255, 0, 28, 46, 2, 56, 61, 56, 56, 56, 56, 36, 56, 56, 56, 56, 57, 254, 255, 255, 0, 27, 46, 2, 56, 56, 57,
+    56, 56, 57, 56, 56, 32, 56, 56, 57, 254, 255, 255, 0, 26, 46, 2, 57, 56, 57, 56, 57, 56, 57, 56, 57, 32, 56, 57, 57, 254,
+    255, 255, 0, 25, 46, 2, 57, 57, 57, 56, 57, 57, 57, 57, 56, 32, 57, 57, 57, 57, 56, 254, 0, 255, 0, 24, 46, 2, 57, 57,
+    57, 57, 57, 57, 57, 32, 255, 0, 0, 16, 0, 8, 0, 16, 46, 2, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 15, 46, 2,
+    68, 63, 63, 63, 63, 63, 43, 63, 63, 63, 63, 68, 63, 254, 1, 0, 0, 14, 46, 2, 63, 68, 63, 63, 68, 63, 38, 68, 63, 68,
+    63, 68, 63, 68, 254, 1, 0, 0, 13, 46, 2, 68, 63, 68, 68, 63, 43, 68, 63, 68, 68, 63, 68, 254, 1, 1, 0, 12, 46, 2,
+    68, 63, 68, 68, 68, 68, 38, 68, 68, 68, 68, 67, 254, 1, 1, 0, 11, 46, 2, 68, 68, 67, 68, 68, 67, 68, 68, 42, 68, 68,
+    67, 254, 1, 1, 0, 10, 46, 2, 67, 68, 67, 68, 67, 68, 67, 68, 67, 42, 68, 67, 67, 254, 1, 1, 0, 9, 46, 2, 67, 67,
+    67, 68, 67, 67, 67, 67, 68, 42, 67, 67, 67, 67, 68, 254, 0, 1, 0, 8, 46, 2, 67, 67, 67, 67, 67, 67, 67, 42, 67, 67,
+    67, 67, 67, 67, 67, 254, 0, 1, 0, 7, 46, 2, 66, 67, 67, 67, 67, 67, 41, 67, 67, 67, 67, 66, 67, 254, 0, 1, 0, 6,
+    46, 2, 67, 66, 67, 67, 66, 67, 42, 66, 67, 66, 67, 66, 67, 66, 254, 0, 1, 0, 5, 46, 2, 66, 67, 66, 66, 67, 66, 41,
+    67, 66, 66, 67, 66, 254, 255, 1, 0, 4, 46, 2, 66, 67, 66, 66, 66, 66, 67, 41, 66, 66, 66, 61, 254, 255, 1, 0, 3, 46,
+    2, 66, 66, 61, 66, 66, 61, 66, 66, 36, 66, 66, 61, 254, 255, 1, 0, 2, 46, 2, 61, 66, 61, 66, 61, 66, 61, 66, 61, 61,
+    41, 61, 61, 254, 255, 1, 0, 1, 46, 2, 61, 61, 61, 66, 61, 61, 61, 61, 66, 61, 36, 61, 61, 61, 66, 254, 255, 0, 0, 0,
+    46, 2, 61, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 31, 0, 8, 0, 24, 46, 2, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0,
+    23, 46, 2, 58, 57, 57, 57, 57, 57, 33, 57, 57, 57, 57, 58, 57, 254, 0, 255, 0, 22, 46, 2, 57, 58, 57, 57, 58, 57, 32,
+    58, 57, 58, 57, 58, 57, 58, 254, 0, 255, 0, 21, 46, 2, 58, 57, 58, 58, 57, 33, 58, 57, 58, 58, 57, 58, 254, 1, 255, 0,
+    20, 46, 2, 58, 57, 58, 58, 58, 58, 32, 58, 58, 58, 58, 63, 254, 1, 255, 0, 19, 46, 2, 58, 58, 63, 58, 58, 63, 58, 33,
+    63, 58, 58, 63, 254, 1, 255, 0, 18, 46, 2, 63, 58, 63, 58, 63, 58, 63, 58, 38, 63, 58, 63, 63, 254, 1, 255, 0, 17, 46,
+    2, 63, 63, 63, 58, 63, 63, 63, 63, 33, 63, 63, 63, 63, 63, 58, 254, 1, 0, 0, 16, 46, 2, 63, 63, 63, 63, 63, 63, 38,
+    63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 15, 46, 2, 68, 63, 63, 63, 63, 63, 43, 63, 63, 63, 63, 68, 63, 254, 1,
+    0, 0, 14, 46, 2, 63, 68, 63, 63, 68, 63, 38, 68, 63, 68, 63, 68, 63, 68, 254, 1, 0, 0, 13, 46, 2, 68, 63, 68, 68,
+    63, 43, 68, 63, 68, 68, 63, 68, 254, 1, 1, 0, 12, 46, 2, 68, 63, 68, 68, 68, 68, 38, 68, 68, 68, 68, 67, 254, 1, 1,
+    0, 11, 46, 2, 68, 68, 67, 68, 68, 67, 68, 68, 42, 68, 68, 67, 254, 1, 1, 0, 10, 46, 2, 67, 68, 67, 68, 67, 68, 67,
+    68, 67, 42, 68, 67, 67, 254, 1, 1, 0, 9, 46, 2, 67, 67, 67, 68, 67, 67, 67, 67, 68, 42, 67, 67, 67, 67, 68, 254, 0,
+    1, 0, 8, 46, 2, 67, 67, 67, 67, 67, 67, 67, 255, 31, 0, 16, 0, 8, 0, 0, 46, 4, 61, 61, 61, 61, 61, 61, 254, 255,
+    0, 0, 1, 46, 4, 66, 61, 61, 61, 61, 61, 41, 61, 61, 61, 61, 66, 61, 254, 255, 0, 0, 2, 46, 4, 61, 66, 61, 61, 66,
+    61, 36, 66, 61, 66, 61, 66, 61, 66, 254, 255, 0, 0, 3, 46, 4, 66, 61, 66, 66, 61, 41, 66, 61, 66, 66, 61, 66, 254, 255,
+    1, 0, 4, 46, 4, 66, 61, 66, 66, 66, 66, 36, 66, 66, 66, 66, 67, 254, 255, 1, 0, 5, 46, 4, 66, 66, 67, 66, 66, 67,
+    66, 41, 67, 66, 66, 67, 254, 255, 1, 0, 6, 46, 4, 67, 66, 67, 66, 67, 66, 67, 66, 42, 67, 66, 67, 67, 254, 255, 1, 0,
+    7, 46, 4, 67, 67, 67, 66, 67, 67, 67, 67, 41, 67, 67, 67, 67, 67, 66, 254, 0, 1, 0, 8, 46, 4, 67, 67, 67, 67, 67,
+    67, 42, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 9, 46, 4, 68, 67, 67, 67, 67, 67, 43, 67, 67, 67, 67, 68, 67,
+    254, 0, 1, 0, 10, 46, 4, 67, 68, 67, 67, 68, 67, 42, 68, 67, 68, 67, 68, 67, 68, 254, 0, 1, 0, 11, 46, 4, 68, 67,
+    68, 68, 67, 43, 68, 67, 68, 68, 67, 68, 254, 1, 1, 0, 12, 46, 4, 68, 67, 68, 68, 68, 68, 42, 68, 68, 68, 68, 63, 254,
+    1, 1, 0, 13, 46, 4, 68, 68, 63, 68, 68, 63, 68, 68, 38, 68, 68, 63, 254, 1, 1, 0, 14, 46, 4, 63, 68, 63, 68, 63,
+    68, 63, 68, 63, 38, 68, 63, 63, 254, 1, 1, 0, 15, 46, 4, 63, 63, 63, 68, 63, 63, 63, 63, 68, 38, 63, 63, 63, 63, 68,
+    254, 1, 0, 0, 16, 46, 4, 63, 63, 63, 63, 63, 63, 63, 255, 16, 0, 0, 0, 8, 0, 8, 46, 4, 67, 67, 67, 67, 67, 67,
+    67, 254, 0, 1, 0, 9, 46, 4, 68, 67, 67, 67, 67, 67, 43, 67, 67, 67, 67, 68, 67, 254, 0, 1, 0, 10, 46, 4, 67, 68,
+    67, 67, 68, 67, 42, 68, 67, 68, 67, 68, 67, 68, 254, 0, 1, 0, 11, 46, 4, 68, 67, 68, 68, 67, 43, 68, 67, 68, 68, 67,
+    68, 254, 1, 1, 0, 12, 46, 4, 68, 67, 68, 68, 68, 68, 42, 68, 68, 68, 68, 63, 254, 1, 1, 0, 13, 46, 4, 68, 68, 63,
+    68, 68, 63, 68, 68, 38, 68, 68, 63, 254, 1, 1, 0, 14, 46, 4, 63, 68, 63, 68, 63, 68, 63, 68, 63, 38, 68, 63, 63, 254,
+    1, 1, 0, 15, 46, 4, 63, 63, 63, 68, 63, 63, 63, 63, 68, 38, 63, 63, 63, 63, 68, 254, 1, 0, 0, 16, 46, 4, 63, 63,
+    63, 63, 63, 63, 63, 38, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 17, 46, 4, 58, 63, 63, 63, 63, 63, 33, 63, 63, 63,
+    63, 58, 63, 254, 1, 0, 0, 18, 46, 4, 63, 58, 63, 63, 58, 63, 38, 58, 63, 58, 63, 58, 63, 58, 254, 1, 0, 0, 19, 46,
+    4, 58, 63, 58, 58, 63, 58, 33, 63, 58, 58, 63, 58, 254, 1, 255, 0, 20, 46, 4, 58, 63, 58, 58, 58, 58, 63, 33, 58, 58,
+    58, 57, 254, 1, 255, 0, 21, 46, 4, 58, 58, 57, 58, 58, 57, 58, 58, 32, 58, 58, 57, 254, 1, 255, 0, 22, 46, 4, 57, 58,
+    57, 58, 57, 58, 57, 58, 57, 57, 33, 57, 57, 254, 1, 255, 0, 23, 46, 4, 57, 57, 57, 58, 57, 57, 57, 57, 58, 57, 32, 57,
+    57, 57, 58, 254, 0, 255, 0, 24, 46, 4, 57, 57, 57, 57, 57, 57, 57, 57, 255, 0, 0, 16, 0, 8, 0, 16, 46, 4, 63, 63,
+    63, 63, 63, 63, 63, 254, 1, 0, 0, 17, 46, 4, 58, 63, 63, 63, 63, 63, 33, 63, 63, 63, 63, 58, 63, 254, 1, 0, 0, 18,
+    46, 4, 63, 58, 63, 63, 58, 63, 38, 58, 63, 58, 63, 58, 63, 58, 254, 1, 0, 0, 19, 46, 4, 58, 63, 58, 58, 63, 58, 33,
+    63, 58, 58, 63, 58, 254, 1, 255, 0, 20, 46, 4, 58, 63, 58, 58, 58, 58, 63, 33, 58, 58, 58, 57, 254, 1, 255, 0, 21, 46,
+    4, 58, 58, 57, 58, 58, 57, 58, 58, 32, 58, 58, 57, 254, 1, 255, 0, 22, 46, 4, 57, 58, 57, 58, 57, 58, 57, 58, 57, 57,
+    33, 57, 57, 254, 1, 255, 0, 23, 46, 4, 57, 57, 57, 58, 57, 57, 57, 57, 58, 57, 32, 57, 57, 57, 58, 254, 0, 255, 0, 24,
+    46, 4, 57, 57, 57, 57, 57, 57, 57, 57, 32, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 25, 46, 4, 56, 57, 57, 57, 57, 57,
+    31, 57, 57, 57, 57, 56, 57, 254, 0, 255, 0, 26, 46, 4, 57, 56, 57, 57, 56, 57, 32, 56, 57, 56, 57, 56, 57, 56, 254, 0,
+    255, 0, 27, 46, 4, 56, 57, 56, 56, 57, 31, 56, 57, 56, 56, 57, 56, 254, 255, 255, 0, 28, 46, 4, 56, 57, 56, 56, 56, 56,
+    32, 56, 56, 56, 56, 61, 254, 255, 255, 0, 29, 46, 4, 56, 56, 61, 56, 56, 61, 56, 56, 36, 56, 56, 61, 254, 255, 255, 0, 30,
+    46, 4, 61, 56, 61, 56, 61, 56, 61, 56, 61, 36, 56, 61, 61, 254, 255, 255, 0, 31, 46, 4, 61, 61, 61, 56, 61, 61, 61, 61,
+    56, 36, 61, 61, 61, 61, 56, 254, 255, 0, 0, 0, 46, 4, 61, 61, 61, 61, 61, 61, 61, 36, 255, 16, 0, 31, 0, 8, 0, 24,
+    46, 4, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 25, 46, 4, 56, 57, 57, 57, 57, 57, 31, 57, 57, 57, 57, 56, 57, 254, 0,
+    255, 0, 26, 46, 4, 57, 56, 57, 57, 56, 57, 32, 56, 57, 56, 57, 56, 57, 56, 254, 0, 255, 0, 27, 46, 4, 56, 57, 56, 56,
+    57, 31, 56, 57, 56, 56, 57, 56, 254, 255, 255, 0, 28, 46, 4, 56, 57, 56, 56, 56, 56, 32, 56, 56, 56, 56, 61, 254, 255, 255,
+    0, 29, 46, 4, 56, 56, 61, 56, 56, 61, 56, 56, 36, 56, 56, 61, 254, 255, 255, 0, 30, 46, 4, 61, 56, 61, 56, 61, 56, 61,
+    56, 61, 36, 56, 61, 61, 254, 255, 255, 0, 31, 46, 4, 61, 61, 61, 56, 61, 61, 61, 61, 56, 36, 61, 61, 61, 61, 56, 254, 255,
+    0, 0, 0, 46, 4, 61, 61, 61, 61, 61, 61, 61, 36, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 1, 46, 4, 66, 61, 61,
+    61, 61, 61, 41, 61, 61, 61, 61, 66, 61, 254, 255, 0, 0, 2, 46, 4, 61, 66, 61, 61, 66, 61, 36, 66, 61, 66, 61, 66, 61,
+    66, 254, 255, 0, 0, 3, 46, 4, 66, 61, 66, 66, 61, 41, 66, 61, 66, 66, 61, 66, 254, 255, 1, 0, 4, 46, 4, 66, 61, 66,
+    66, 66, 66, 36, 66, 66, 66, 66, 67, 254, 255, 1, 0, 5, 46, 4, 66, 66, 67, 66, 66, 67, 66, 41, 67, 66, 66, 67, 254, 255,
+    1, 0, 6, 46, 4, 67, 66, 67, 66, 67, 66, 67, 66, 42, 67, 66, 67, 67, 254, 255, 1, 0, 7, 46, 4, 67, 67, 67, 66, 67,
+    67, 67, 67, 41, 67, 67, 67, 67, 67, 66, 254, 0, 1, 0, 8, 46, 4, 67, 67, 67, 67, 67, 67, 42, 255, 31, 0, 16, 0, 0,
+    0, 0, 4, 0, 87, 86, 87, 87, 254, 255, 0, 1, 31, 4, 0, 87, 81, 87, 87, 254, 255, 0, 1, 30, 4, 0, 87, 87, 86, 87,
+    87, 81, 87, 87, 254, 255, 0, 1, 29, 4, 0, 87, 87, 81, 87, 87, 254, 255, 255, 1, 28, 4, 0, 87, 87, 81, 87, 87, 81, 87,
+    87, 254, 255, 255, 1, 27, 4, 0, 87, 87, 81, 87, 87, 254, 0, 255, 1, 26, 4, 0, 87, 87, 81, 87, 87, 82, 87, 87, 254, 0,
+    255, 1, 25, 4, 0, 87, 87, 81, 87, 87, 254, 0, 255, 1, 24, 4, 0, 87, 87, 82, 87, 87, 82, 87, 87, 255, 16, 0, 0, 0,
+    0, 0, 8, 4, 0, 87, 92, 87, 92, 87, 254, 0, 1, 1, 7, 4, 0, 87, 91, 87, 87, 254, 0, 1, 1, 6, 4, 0, 87, 87,
+    92, 87, 87, 91, 87, 87, 254, 0, 1, 1, 5, 4, 0, 87, 91, 87, 87, 254, 255, 1, 1, 4, 4, 0, 87, 87, 91, 87, 87, 91,
+    87, 87, 254, 255, 1, 1, 3, 4, 0, 87, 87, 91, 87, 87, 254, 255, 0, 1, 2, 4, 0, 87, 87, 91, 87, 87, 86, 87, 87, 254,
+    255, 0, 1, 1, 4, 0, 87, 87, 91, 87, 87, 254, 255, 0, 1, 0, 4, 0, 87, 87, 86, 87, 87, 86, 87, 87, 255, 0, 0, 16,
+    0, 0, 0, 16, 4, 0, 87, 88, 87, 87, 88, 87, 254, 1, 0, 1, 15, 4, 0, 87, 87, 93, 87, 87, 254, 1, 0, 1, 14, 4,
+    0, 87, 87, 88, 87, 87, 93, 87, 87, 254, 1, 0, 1, 13, 4, 0, 87, 87, 93, 87, 87, 254, 1, 1, 1, 12, 4, 0, 87, 87,
+    93, 87, 87, 93, 87, 87, 254, 1, 1, 1, 11, 4, 0, 87, 87, 93, 87, 87, 254, 0, 1, 1, 10, 4, 0, 87, 87, 93, 87, 87,
+    92, 87, 87, 254, 0, 1, 1, 9, 4, 0, 87, 87, 93, 87, 87, 254, 0, 1, 1, 8, 4, 0, 87, 87, 92, 87, 87, 255, 16, 0,
+    31, 0, 0, 0, 24, 4, 0, 87, 82, 87, 254, 0, 255, 1, 23, 4, 0, 87, 83, 87, 87, 254, 0, 255, 1, 22, 4, 0, 87, 87,
+    87, 82, 87, 87, 83, 87, 87, 254, 0, 255, 1, 21, 4, 0, 87, 87, 83, 87, 87, 254, 1, 255, 1, 20, 4, 0, 87, 87, 87, 83,
+    87, 87, 83, 87, 87, 254, 1, 255, 1, 19, 4, 0, 87, 87, 83, 87, 87, 254, 1, 0, 1, 18, 4, 0, 87, 87, 83, 87, 87, 87,
+    88, 87, 87, 254, 1, 0, 1, 17, 4, 0, 87, 87, 83, 87, 87, 254, 1, 0, 1, 16, 4, 0, 87, 87, 88, 87, 87, 87, 255, 31,
+    0, 16, 0, 0, 0, 0, 4, 0, 87, 86, 87, 87, 254, 255, 0, 1, 1, 4, 0, 87, 87, 91, 87, 87, 254, 255, 0, 1, 2, 4,
+    0, 87, 87, 86, 87, 87, 91, 87, 87, 254, 255, 0, 1, 3, 4, 0, 87, 87, 91, 87, 87, 254, 255, 1, 1, 4, 4, 0, 87, 87,
+    87, 91, 87, 87, 91, 87, 87, 254, 255, 1, 1, 5, 4, 0, 87, 87, 91, 87, 87, 254, 0, 1, 1, 6, 4, 0, 87, 87, 91, 87,
+    87, 92, 87, 87, 254, 0, 1, 1, 7, 4, 0, 87, 87, 91, 87, 87, 254, 0, 1, 1, 8, 4, 0, 87, 87, 92, 87, 87, 87, 255,
+    16, 0, 0, 0, 0, 0, 8, 4, 0, 87, 92, 87, 92, 87, 254, 0, 1, 1, 9, 4, 0, 87, 93, 87, 87, 254, 0, 1, 1, 10,
+    4, 0, 87, 87, 92, 87, 87, 93, 87, 87, 254, 0, 1, 1, 11, 4, 0, 87, 87, 87, 93, 87, 87, 254, 1, 1, 1, 12, 4, 0,
+    87, 87, 93, 87, 87, 93, 87, 87, 254, 1, 1, 1, 13, 4, 0, 87, 87, 93, 87, 87, 254, 1, 0, 1, 14, 4, 0, 87, 87, 93,
+    87, 87, 88, 87, 87, 254, 1, 0, 1, 15, 4, 0, 87, 87, 93, 87, 87, 254, 1, 0, 1, 16, 4, 0, 87, 87, 88, 87, 87, 87,
+    255, 0, 0, 16, 0, 0, 0, 16, 4, 0, 88, 87, 87, 88, 87, 87, 254, 1, 0, 1, 17, 4, 0, 87, 87, 83, 87, 87, 254, 1,
+    0, 1, 18, 4, 0, 87, 87, 88, 87, 83, 87, 87, 254, 1, 0, 1, 19, 4, 0, 87, 87, 83, 87, 87, 254, 1, 255, 1, 20, 4,
+    0, 87, 87, 83, 87, 83, 87, 87, 254, 1, 255, 1, 21, 4, 0, 87, 87, 83, 87, 87, 254, 0, 255, 1, 22, 4, 0, 87, 87, 83,
+    87, 87, 82, 87, 254, 0, 255, 1, 23, 4, 0, 87, 87, 83, 87, 87, 254, 0, 255, 1, 24, 4, 0, 87, 87, 82, 87, 87, 82, 87,
+    87, 255, 16, 0, 31, 0, 0, 0, 24, 4, 0, 87, 82, 87, 254, 0, 255, 1, 25, 4, 0, 87, 81, 87, 87, 254, 0, 255, 1, 26,
+    4, 0, 87, 87, 82, 87, 87, 81, 87, 87, 254, 0, 255, 1, 27, 4, 0, 87, 87, 81, 87, 87, 254, 255, 255, 1, 28, 4, 0, 87,
+    87, 81, 87, 87, 81, 87, 87, 254, 255, 255, 1, 29, 4, 0, 87, 87, 81, 87, 87, 254, 255, 0, 1, 30, 4, 0, 87, 87, 81, 87,
+    87, 86, 87, 87, 254, 255, 0, 1, 31, 4, 0, 87, 87, 81, 87, 87, 254, 255, 0, 1, 0, 4, 0, 87, 87, 86, 87, 87, 86, 87,
+    87, 87, 255, 31, 0, 16, 0, 63, 0, 0, 8, 0, 37, 36, 37, 37, 254, 255, 0, 255, 31, 8, 0, 37, 31, 37, 37, 254, 255, 0,
+    255, 30, 8, 0, 37, 37, 36, 37, 37, 31, 37, 37, 254, 255, 0, 255, 29, 8, 0, 37, 37, 31, 37, 37, 254, 255, 255, 255, 28, 8,
+    0, 37, 37, 31, 37, 37, 31, 37, 37, 254, 255, 255, 255, 27, 8, 0, 37, 37, 31, 37, 37, 254, 0, 255, 255, 26, 8, 0, 37, 37,
+    31, 37, 37, 32, 37, 37, 254, 0, 255, 255, 25, 8, 0, 37, 37, 31, 37, 37, 254, 0, 255, 255, 24, 8, 0, 37, 37, 32, 37, 37,
+    32, 37, 37, 255, 16, 0, 0, 0, 63, 0, 8, 8, 0, 37, 42, 37, 42, 37, 254, 0, 1, 255, 7, 8, 0, 37, 41, 37, 37, 254,
+    0, 1, 255, 6, 8, 0, 37, 37, 42, 37, 37, 41, 37, 37, 254, 0, 1, 255, 5, 8, 0, 37, 41, 37, 37, 254, 255, 1, 255, 4,
+    8, 0, 37, 37, 41, 37, 37, 41, 37, 37, 254, 255, 1, 255, 3, 8, 0, 37, 37, 41, 37, 37, 254, 255, 0, 255, 2, 8, 0, 37,
+    37, 41, 37, 37, 36, 37, 37, 254, 255, 0, 255, 1, 8, 0, 37, 37, 41, 37, 37, 254, 255, 0, 255, 0, 8, 0, 37, 37, 36, 37,
+    37, 36, 37, 37, 255, 0, 0, 16, 0, 63, 0, 16, 8, 0, 37, 38, 37, 37, 38, 37, 254, 1, 0, 255, 15, 8, 0, 37, 37, 43,
+    37, 37, 254, 1, 0, 255, 14, 8, 0, 37, 37, 38, 37, 37, 43, 37, 37, 254, 1, 0, 255, 13, 8, 0, 37, 37, 43, 37, 37, 254,
+    1, 1, 255, 12, 8, 0, 37, 37, 43, 37, 37, 43, 37, 37, 254, 1, 1, 255, 11, 8, 0, 37, 37, 43, 37, 37, 254, 0, 1, 255,
+    10, 8, 0, 37, 37, 43, 37, 37, 42, 37, 37, 254, 0, 1, 255, 9, 8, 0, 37, 37, 43, 37, 37, 254, 0, 1, 255, 8, 8, 0,
+    37, 37, 42, 37, 37, 255, 16, 0, 31, 0, 63, 0, 24, 8, 0, 37, 32, 37, 254, 0, 255, 255, 23, 8, 0, 37, 33, 37, 37, 254,
+    0, 255, 255, 22, 8, 0, 37, 37, 37, 32, 37, 37, 33, 37, 37, 254, 0, 255, 255, 21, 8, 0, 37, 37, 33, 37, 37, 254, 1, 255,
+    255, 20, 8, 0, 37, 37, 37, 33, 37, 37, 33, 37, 37, 254, 1, 255, 255, 19, 8, 0, 37, 37, 33, 37, 37, 254, 1, 0, 255, 18,
+    8, 0, 37, 37, 33, 37, 37, 37, 38, 37, 37, 254, 1, 0, 255, 17, 8, 0, 37, 37, 33, 37, 37, 254, 1, 0, 255, 16, 8, 0,
+    37, 37, 38, 37, 37, 37, 255, 31, 0, 16, 0, 63, 0, 0, 8, 0, 37, 36, 37, 37, 254, 255, 0, 255, 1, 8, 0, 37, 37, 41,
+    37, 37, 254, 255, 0, 255, 2, 8, 0, 37, 37, 36, 37, 37, 41, 37, 37, 254, 255, 0, 255, 3, 8, 0, 37, 37, 41, 37, 37, 254,
+    255, 1, 255, 4, 8, 0, 37, 37, 37, 41, 37, 37, 41, 37, 37, 254, 255, 1, 255, 5, 8, 0, 37, 37, 41, 37, 37, 254, 0, 1,
+    255, 6, 8, 0, 37, 37, 41, 37, 37, 42, 37, 37, 254, 0, 1, 255, 7, 8, 0, 37, 37, 41, 37, 37, 254, 0, 1, 255, 8, 8,
+    0, 37, 37, 42, 37, 37, 37, 255, 16, 0, 0, 0, 63, 0, 8, 8, 0, 37, 42, 37, 42, 37, 254, 0, 1, 255, 9, 8, 0, 37,
+    43, 37, 37, 254, 0, 1, 255, 10, 8, 0, 37, 37, 42, 37, 37, 43, 37, 37, 254, 0, 1, 255, 11, 8, 0, 37, 37, 37, 43, 37,
+    37, 254, 1, 1, 255, 12, 8, 0, 37, 37, 43, 37, 37, 43, 37, 37, 254, 1, 1, 255, 13, 8, 0, 37, 37, 43, 37, 37, 254, 1,
+    0, 255, 14, 8, 0, 37, 37, 43, 37, 37, 38, 37, 37, 254, 1, 0, 255, 15, 8, 0, 37, 37, 43, 37, 37, 254, 1, 0, 255, 16,
+    8, 0, 37, 37, 38, 37, 37, 37, 255, 0, 0, 16, 0, 63, 0, 16, 8, 0, 38, 37, 37, 38, 37, 37, 254, 1, 0, 255, 17, 8,
+    0, 37, 37, 33, 37, 37, 254, 1, 0, 255, 18, 8, 0, 37, 37, 38, 37, 33, 37, 37, 254, 1, 0, 255, 19, 8, 0, 37, 37, 33,
+    37, 37, 254, 1, 255, 255, 20, 8, 0, 37, 37, 33, 37, 33, 37, 37, 254, 1, 255, 255, 21, 8, 0, 37, 37, 33, 37, 37, 254, 0,
+    255, 255, 22, 8, 0, 37, 37, 33, 37, 37, 32, 37, 254, 0, 255, 255, 23, 8, 0, 37, 37, 33, 37, 37, 254, 0, 255, 255, 24, 8,
+    0, 37, 37, 32, 37, 37, 32, 37, 37, 255, 16, 0, 31, 0, 63, 0, 24, 8, 0, 37, 32, 37, 254, 0, 255, 255, 25, 8, 0, 37,
+    31, 37, 37, 254, 0, 255, 255, 26, 8, 0, 37, 37, 32, 37, 37, 31, 37, 37, 254, 0, 255, 255, 27, 8, 0, 37, 37, 31, 37, 37,
+    254, 255, 255, 255, 28, 8, 0, 37, 37, 31, 37, 37, 31, 37, 37, 254, 255, 255, 255, 29, 8, 0, 37, 37, 31, 37, 37, 254, 255, 0,
+    255, 30, 8, 0, 37, 37, 31, 37, 37, 36, 37, 37, 254, 255, 0, 255, 31, 8, 0, 37, 37, 31, 37, 37, 254, 255, 0, 255, 0, 8,
+    0, 37, 37, 36, 37, 37, 36, 37, 37, 37, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 31, 0, 16, 0, 0, 0, 0, 48, 2,
+    61, 61, 61, 61, 61, 61, 254, 255, 0, 1, 31, 48, 2, 56, 61, 61, 61, 61, 61, 81, 61, 61, 61, 61, 56, 61, 254, 255, 0, 1,
+    30, 48, 2, 61, 56, 61, 61, 56, 61, 86, 56, 61, 56, 61, 56, 61, 81, 254, 255, 0, 0, 29, 48, 2, 56, 61, 56, 56, 61, 81,
+    56, 61, 56, 56, 61, 56, 254, 255, 255, 1, 28, 48, 2, 56, 61, 56, 56, 56, 56, 86, 56, 56, 56, 56, 57, 254, 255, 255, 0, 27,
+    48, 2, 56, 81, 57, 56, 56, 57, 56, 56, 82, 56, 56, 57, 254, 255, 255, 0, 26, 48, 2, 57, 56, 82, 56, 57, 56, 57, 56, 57,
+    82, 56, 57, 57, 254, 255, 255, 0, 25, 48, 2, 57, 57, 82, 56, 57, 57, 57, 57, 56, 82, 57, 57, 57, 57, 56, 254, 0, 255, 0,
+    24, 48, 2, 82, 57, 57, 57, 57, 57, 57, 82, 255, 16, 0, 0, 0, 0, 0, 8, 48, 2, 67, 67, 67, 67, 67, 67, 67, 254, 0,
+    1, 1, 7, 48, 2, 66, 67, 67, 67, 67, 67, 91, 67, 67, 67, 67, 66, 67, 254, 0, 1, 1, 6, 48, 2, 67, 66, 67, 67, 66,
+    67, 92, 66, 67, 66, 67, 66, 67, 91, 254, 0, 1, 0, 5, 48, 2, 66, 67, 66, 66, 67, 66, 91, 67, 66, 66, 67, 66, 254, 255,
+    1, 0, 4, 48, 2, 91, 67, 66, 66, 66, 66, 67, 91, 66, 66, 66, 61, 254, 255, 1, 0, 3, 48, 2, 66, 91, 61, 66, 66, 61,
+    66, 66, 86, 66, 66, 61, 254, 255, 1, 0, 2, 48, 2, 61, 66, 61, 91, 61, 66, 61, 66, 61, 61, 91, 61, 61, 254, 255, 1, 0,
+    1, 48, 2, 61, 61, 61, 91, 61, 61, 61, 61, 66, 61, 86, 61, 61, 61, 66, 254, 255, 0, 0, 0, 48, 2, 61, 86, 61, 61, 61,
+    61, 61, 61, 255, 0, 0, 16, 0, 0, 0, 16, 48, 2, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 1, 15, 48, 2, 68, 63, 63,
+    63, 63, 63, 93, 63, 63, 63, 63, 68, 63, 254, 1, 0, 1, 14, 48, 2, 63, 68, 63, 63, 68, 63, 88, 68, 63, 68, 63, 68, 63,
+    93, 254, 1, 0, 0, 13, 48, 2, 68, 63, 68, 68, 63, 93, 68, 63, 68, 68, 63, 68, 254, 1, 1, 1, 12, 48, 2, 68, 63, 68,
+    68, 68, 68, 88, 68, 68, 68, 68, 67, 254, 1, 1, 0, 11, 48, 2, 68, 93, 67, 68, 68, 67, 68, 68, 92, 68, 68, 67, 254, 1,
+    1, 0, 10, 48, 2, 67, 68, 92, 68, 67, 68, 67, 68, 67, 92, 68, 67, 67, 254, 1, 1, 0, 9, 48, 2, 67, 67, 92, 68, 67,
+    67, 67, 67, 68, 92, 67, 67, 67, 67, 68, 254, 0, 1, 0, 8, 48, 2, 92, 67, 67, 67, 67, 67, 67, 255, 16, 0, 31, 0, 0,
+    0, 24, 48, 2, 57, 57, 57, 57, 57, 57, 254, 0, 255, 1, 23, 48, 2, 58, 57, 57, 57, 57, 57, 83, 57, 57, 57, 57, 58, 57,
+    254, 0, 255, 1, 22, 48, 2, 57, 58, 57, 57, 58, 57, 82, 58, 57, 58, 57, 58, 57, 83, 254, 0, 255, 0, 21, 48, 2, 58, 57,
+    58, 58, 57, 83, 58, 57, 58, 58, 57, 58, 254, 1, 255, 1, 20, 48, 2, 58, 57, 58, 58, 58, 58, 82, 58, 58, 58, 58, 63, 254,
+    1, 255, 0, 19, 48, 2, 83, 58, 63, 58, 58, 63, 58, 83, 63, 58, 58, 63, 254, 1, 255, 0, 18, 48, 2, 63, 83, 63, 58, 63,
+    58, 63, 58, 88, 63, 58, 63, 63, 254, 1, 255, 0, 17, 48, 2, 63, 88, 63, 58, 63, 63, 63, 63, 83, 63, 63, 63, 63, 63, 58,
+    254, 1, 0, 1, 16, 48, 2, 63, 63, 63, 63, 63, 63, 88, 255, 31, 0, 16, 0, 0, 0, 0, 48, 4, 61, 61, 61, 61, 61, 61,
+    254, 255, 0, 1, 1, 48, 4, 66, 61, 61, 61, 61, 61, 91, 61, 61, 61, 61, 66, 61, 254, 255, 0, 1, 2, 48, 4, 61, 66, 61,
+    61, 66, 61, 86, 66, 61, 66, 61, 66, 61, 91, 254, 255, 0, 0, 3, 48, 4, 66, 61, 66, 66, 61, 91, 66, 61, 66, 66, 61, 66,
+    254, 255, 1, 1, 4, 48, 4, 66, 61, 66, 66, 66, 66, 86, 66, 66, 66, 66, 67, 254, 255, 1, 0, 5, 48, 4, 91, 66, 67, 66,
+    66, 67, 66, 91, 67, 66, 66, 67, 254, 255, 1, 0, 6, 48, 4, 67, 91, 67, 66, 67, 66, 67, 66, 92, 67, 66, 67, 67, 254, 255,
+    1, 0, 7, 48, 4, 67, 92, 67, 66, 67, 67, 67, 67, 91, 67, 67, 67, 67, 67, 66, 254, 0, 1, 1, 8, 48, 4, 67, 67, 67,
+    67, 67, 67, 92, 255, 16, 0, 0, 0, 0, 0, 8, 48, 4, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 1, 9, 48, 4, 68, 67,
+    67, 67, 67, 67, 93, 67, 67, 67, 67, 68, 67, 254, 0, 1, 1, 10, 48, 4, 67, 68, 67, 67, 68, 67, 92, 68, 67, 68, 67, 68,
+    67, 93, 254, 0, 1, 0, 11, 48, 4, 68, 67, 68, 68, 67, 93, 68, 67, 68, 68, 67, 68, 254, 1, 1, 1, 12, 48, 4, 68, 67,
+    68, 68, 68, 68, 92, 68, 68, 68, 68, 63, 254, 1, 1, 0, 13, 48, 4, 68, 93, 63, 68, 68, 63, 68, 68, 88, 68, 68, 63, 254,
+    1, 1, 0, 14, 48, 4, 63, 68, 88, 68, 63, 68, 63, 68, 63, 88, 68, 63, 63, 254, 1, 1, 0, 15, 48, 4, 63, 63, 88, 68,
+    63, 63, 63, 63, 68, 88, 63, 63, 63, 63, 68, 254, 1, 0, 0, 16, 48, 4, 88, 63, 63, 63, 63, 63, 63, 255, 0, 0, 16, 0,
+    0, 0, 16, 48, 4, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 1, 17, 48, 4, 58, 63, 63, 63, 63, 63, 83, 63, 63, 63, 63,
+    58, 63, 254, 1, 0, 1, 18, 48, 4, 63, 58, 63, 63, 58, 63, 88, 58, 63, 58, 63, 58, 63, 83, 254, 1, 0, 0, 19, 48, 4,
+    58, 63, 58, 58, 63, 58, 83, 63, 58, 58, 63, 58, 254, 1, 255, 0, 20, 48, 4, 83, 63, 58, 58, 58, 58, 63, 83, 58, 58, 58,
+    57, 254, 1, 255, 0, 21, 48, 4, 58, 83, 57, 58, 58, 57, 58, 58, 82, 58, 58, 57, 254, 1, 255, 0, 22, 48, 4, 57, 58, 57,
+    83, 57, 58, 57, 58, 57, 57, 83, 57, 57, 254, 1, 255, 0, 23, 48, 4, 57, 57, 57, 83, 57, 57, 57, 57, 58, 57, 82, 57, 57,
+    57, 58, 254, 0, 255, 0, 24, 48, 4, 57, 82, 57, 57, 57, 57, 57, 57, 255, 16, 0, 31, 0, 0, 0, 24, 48, 4, 57, 57, 57,
+    57, 57, 57, 254, 0, 255, 1, 25, 48, 4, 56, 57, 57, 57, 57, 57, 81, 57, 57, 57, 57, 56, 57, 254, 0, 255, 1, 26, 48, 4,
+    57, 56, 57, 57, 56, 57, 82, 56, 57, 56, 57, 56, 57, 81, 254, 0, 255, 0, 27, 48, 4, 56, 57, 56, 56, 57, 81, 56, 57, 56,
+    56, 57, 56, 254, 255, 255, 1, 28, 48, 4, 56, 57, 56, 56, 56, 56, 82, 56, 56, 56, 56, 61, 254, 255, 255, 0, 29, 48, 4, 56,
+    81, 61, 56, 56, 61, 56, 56, 86, 56, 56, 61, 254, 255, 255, 0, 30, 48, 4, 61, 56, 86, 56, 61, 56, 61, 56, 61, 86, 56, 61,
+    61, 254, 255, 255, 0, 31, 48, 4, 61, 61, 86, 56, 61, 61, 61, 61, 56, 86, 61, 61, 61, 61, 56, 254, 255, 0, 0, 0, 48, 4,
+    86, 61, 61, 61, 61, 61, 61, 86, 255, 31, 0, 16, 0, 16, 0, 0, 49, 2, 61, 61, 61, 61, 61, 61, 254, 255, 0, 255, 31, 49,
+    2, 56, 61, 61, 61, 61, 61, 31, 61, 61, 61, 61, 56, 61, 254, 255, 0, 255, 30, 49, 2, 61, 56, 61, 61, 56, 61, 36, 56, 61,
+    56, 61, 56, 61, 31, 254, 255, 0, 0, 29, 49, 2, 56, 61, 56, 56, 61, 31, 56, 61, 56, 56, 61, 56, 254, 255, 255, 255, 28, 49,
+    2, 56, 61, 56, 56, 56, 56, 36, 56, 56, 56, 56, 57, 254, 255, 255, 0, 27, 49, 2, 56, 31, 57, 56, 56, 57, 56, 56, 32, 56,
+    56, 57, 254, 255, 255, 0, 26, 49, 2, 57, 56, 32, 56, 57, 56, 57, 56, 57, 32, 56, 57, 57, 254, 255, 255, 0, 25, 49, 2, 57,
+    57, 32, 56, 57, 57, 57, 57, 56, 32, 57, 57, 57, 57, 56, 254, 0, 255, 0, 24, 49, 2, 32, 57, 57, 57, 57, 57, 57, 32, 255,
+    16, 0, 0, 0, 16, 0, 8, 49, 2, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 255, 7, 49, 2, 66, 67, 67, 67, 67, 67, 41,
+    67, 67, 67, 67, 66, 67, 254, 0, 1, 255, 6, 49, 2, 67, 66, 67, 67, 66, 67, 42, 66, 67, 66, 67, 66, 67, 41, 254, 0, 1,
+    0, 5, 49, 2, 66, 67, 66, 66, 67, 66, 41, 67, 66, 66, 67, 66, 254, 255, 1, 0, 4, 49, 2, 41, 67, 66, 66, 66, 66, 67,
+    41, 66, 66, 66, 61, 254, 255, 1, 0, 3, 49, 2, 66, 41, 61, 66, 66, 61, 66, 66, 36, 66, 66, 61, 254, 255, 1, 0, 2, 49,
+    2, 61, 66, 61, 41, 61, 66, 61, 66, 61, 61, 41, 61, 61, 254, 255, 1, 0, 1, 49, 2, 61, 61, 61, 41, 61, 61, 61, 61, 66,
+    61, 36, 61, 61, 61, 66, 254, 255, 0, 0, 0, 49, 2, 61, 36, 61, 61, 61, 61, 61, 61, 255, 0, 0, 16, 0, 16, 0, 16, 49,
+    2, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 255, 15, 49, 2, 68, 63, 63, 63, 63, 63, 43, 63, 63, 63, 63, 68, 63, 254, 1,
+    0, 255, 14, 49, 2, 63, 68, 63, 63, 68, 63, 38, 68, 63, 68, 63, 68, 63, 43, 254, 1, 0, 0, 13, 49, 2, 68, 63, 68, 68,
+    63, 43, 68, 63, 68, 68, 63, 68, 254, 1, 1, 255, 12, 49, 2, 68, 63, 68, 68, 68, 68, 38, 68, 68, 68, 68, 67, 254, 1, 1,
+    0, 11, 49, 2, 68, 43, 67, 68, 68, 67, 68, 68, 42, 68, 68, 67, 254, 1, 1, 0, 10, 49, 2, 67, 68, 42, 68, 67, 68, 67,
+    68, 67, 42, 68, 67, 67, 254, 1, 1, 0, 9, 49, 2, 67, 67, 42, 68, 67, 67, 67, 67, 68, 42, 67, 67, 67, 67, 68, 254, 0,
+    1, 0, 8, 49, 2, 42, 67, 67, 67, 67, 67, 67, 255, 16, 0, 31, 0, 16, 0, 24, 49, 2, 57, 57, 57, 57, 57, 57, 254, 0,
+    255, 255, 23, 49, 2, 58, 57, 57, 57, 57, 57, 33, 57, 57, 57, 57, 58, 57, 254, 0, 255, 255, 22, 49, 2, 57, 58, 57, 57, 58,
+    57, 32, 58, 57, 58, 57, 58, 57, 33, 254, 0, 255, 0, 21, 49, 2, 58, 57, 58, 58, 57, 33, 58, 57, 58, 58, 57, 58, 254, 1,
+    255, 255, 20, 49, 2, 58, 57, 58, 58, 58, 58, 32, 58, 58, 58, 58, 63, 254, 1, 255, 0, 19, 49, 2, 33, 58, 63, 58, 58, 63,
+    58, 33, 63, 58, 58, 63, 254, 1, 255, 0, 18, 49, 2, 63, 33, 63, 58, 63, 58, 63, 58, 38, 63, 58, 63, 63, 254, 1, 255, 0,
+    17, 49, 2, 63, 38, 63, 58, 63, 63, 63, 63, 33, 63, 63, 63, 63, 63, 58, 254, 1, 0, 255, 16, 49, 2, 63, 63, 63, 63, 63,
+    63, 38, 255, 31, 0, 16, 0, 16, 0, 0, 49, 4, 61, 61, 61, 61, 61, 61, 254, 255, 0, 255, 1, 49, 4, 66, 61, 61, 61, 61,
+    61, 41, 61, 61, 61, 61, 66, 61, 254, 255, 0, 255, 2, 49, 4, 61, 66, 61, 61, 66, 61, 36, 66, 61, 66, 61, 66, 61, 41, 254,
+    255, 0, 0, 3, 49, 4, 66, 61, 66, 66, 61, 41, 66, 61, 66, 66, 61, 66, 254, 255, 1, 255, 4, 49, 4, 66, 61, 66, 66, 66,
+    66, 36, 66, 66, 66, 66, 67, 254, 255, 1, 0, 5, 49, 4, 41, 66, 67, 66, 66, 67, 66, 41, 67, 66, 66, 67, 254, 255, 1, 0,
+    6, 49, 4, 67, 41, 67, 66, 67, 66, 67, 66, 42, 67, 66, 67, 67, 254, 255, 1, 0, 7, 49, 4, 67, 42, 67, 66, 67, 67, 67,
+    67, 41, 67, 67, 67, 67, 67, 66, 254, 0, 1, 255, 8, 49, 4, 67, 67, 67, 67, 67, 67, 42, 255, 16, 0, 0, 0, 16, 0, 8,
+    49, 4, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 255, 9, 49, 4, 68, 67, 67, 67, 67, 67, 43, 67, 67, 67, 67, 68, 67, 254,
+    0, 1, 255, 10, 49, 4, 67, 68, 67, 67, 68, 67, 42, 68, 67, 68, 67, 68, 67, 43, 254, 0, 1, 0, 11, 49, 4, 68, 67, 68,
+    68, 67, 43, 68, 67, 68, 68, 67, 68, 254, 1, 1, 255, 12, 49, 4, 68, 67, 68, 68, 68, 68, 42, 68, 68, 68, 68, 63, 254, 1,
+    1, 0, 13, 49, 4, 68, 43, 63, 68, 68, 63, 68, 68, 38, 68, 68, 63, 254, 1, 1, 0, 14, 49, 4, 63, 68, 38, 68, 63, 68,
+    63, 68, 63, 38, 68, 63, 63, 254, 1, 1, 0, 15, 49, 4, 63, 63, 38, 68, 63, 63, 63, 63, 68, 38, 63, 63, 63, 63, 68, 254,
+    1, 0, 0, 16, 49, 4, 38, 63, 63, 63, 63, 63, 63, 255, 0, 0, 16, 0, 16, 0, 16, 49, 4, 63, 63, 63, 63, 63, 63, 63,
+    254, 1, 0, 255, 17, 49, 4, 58, 63, 63, 63, 63, 63, 33, 63, 63, 63, 63, 58, 63, 254, 1, 0, 255, 18, 49, 4, 63, 58, 63,
+    63, 58, 63, 38, 58, 63, 58, 63, 58, 63, 33, 254, 1, 0, 0, 19, 49, 4, 58, 63, 58, 58, 63, 58, 33, 63, 58, 58, 63, 58,
+    254, 1, 255, 0, 20, 49, 4, 33, 63, 58, 58, 58, 58, 63, 33, 58, 58, 58, 57, 254, 1, 255, 0, 21, 49, 4, 58, 33, 57, 58,
+    58, 57, 58, 58, 32, 58, 58, 57, 254, 1, 255, 0, 22, 49, 4, 57, 58, 57, 33, 57, 58, 57, 58, 57, 57, 33, 57, 57, 254, 1,
+    255, 0, 23, 49, 4, 57, 57, 57, 33, 57, 57, 57, 57, 58, 57, 32, 57, 57, 57, 58, 254, 0, 255, 0, 24, 49, 4, 57, 32, 57,
+    57, 57, 57, 57, 57, 255, 16, 0, 31, 0, 16, 0, 24, 49, 4, 57, 57, 57, 57, 57, 57, 254, 0, 255, 255, 25, 49, 4, 56, 57,
+    57, 57, 57, 57, 31, 57, 57, 57, 57, 56, 57, 254, 0, 255, 255, 26, 49, 4, 57, 56, 57, 57, 56, 57, 32, 56, 57, 56, 57, 56,
+    57, 31, 254, 0, 255, 0, 27, 49, 4, 56, 57, 56, 56, 57, 31, 56, 57, 56, 56, 57, 56, 254, 255, 255, 255, 28, 49, 4, 56, 57,
+    56, 56, 56, 56, 32, 56, 56, 56, 56, 61, 254, 255, 255, 0, 29, 49, 4, 56, 31, 61, 56, 56, 61, 56, 56, 36, 56, 56, 61, 254,
+    255, 255, 0, 30, 49, 4, 61, 56, 36, 56, 61, 56, 61, 56, 61, 36, 56, 61, 61, 254, 255, 255, 0, 31, 49, 4, 61, 61, 36, 56,
+    61, 61, 61, 61, 56, 36, 61, 61, 61, 61, 56, 254, 255, 0, 0, 0, 49, 4, 36, 61, 61, 61, 61, 61, 61, 36, 255, 31, 0, 16,
+    0, 0, 0, 0, 48, 0, 61, 61, 61, 61, 61, 61, 254, 255, 0, 1, 31, 48, 0, 56, 61, 61, 61, 61, 61, 81, 61, 61, 61, 61,
+    56, 61, 254, 255, 0, 1, 30, 48, 0, 61, 56, 61, 61, 56, 61, 86, 56, 61, 56, 61, 56, 61, 81, 254, 255, 0, 0, 29, 48, 0,
+    56, 61, 56, 56, 61, 81, 56, 61, 56, 56, 61, 56, 254, 255, 255, 1, 28, 48, 0, 56, 61, 56, 56, 56, 56, 86, 56, 56, 56, 56,
+    57, 254, 255, 255, 0, 27, 48, 0, 56, 81, 57, 56, 56, 57, 56, 56, 82, 56, 56, 57, 254, 255, 255, 0, 26, 48, 0, 57, 56, 82,
+    56, 57, 56, 57, 56, 57, 82, 56, 57, 57, 254, 255, 255, 0, 25, 48, 0, 57, 57, 82, 56, 57, 57, 57, 57, 56, 82, 57, 57, 57,
+    57, 56, 254, 0, 255, 0, 24, 48, 0, 82, 57, 57, 57, 57, 57, 57, 82, 255, 16, 0, 0, 0, 0, 0, 8, 48, 0, 67, 67, 67,
+    67, 67, 67, 67, 254, 0, 1, 1, 7, 48, 0, 66, 67, 67, 67, 67, 67, 91, 67, 67, 67, 67, 66, 67, 254, 0, 1, 1, 6, 48,
+    0, 67, 66, 67, 67, 66, 67, 92, 66, 67, 66, 67, 66, 67, 91, 254, 0, 1, 0, 5, 48, 0, 66, 67, 66, 66, 67, 66, 91, 67,
+    66, 66, 67, 66, 254, 255, 1, 0, 4, 48, 0, 91, 67, 66, 66, 66, 66, 67, 91, 66, 66, 66, 61, 254, 255, 1, 0, 3, 48, 0,
+    66, 91, 61, 66, 66, 61, 66, 66, 86, 66, 66, 61, 254, 255, 1, 0, 2, 48, 0, 61, 66, 61, 91, 61, 66, 61, 66, 61, 61, 91,
+    61, 61, 254, 255, 1, 0, 1, 48, 0, 61, 61, 61, 91, 61, 61, 61, 61, 66, 61, 86, 61, 61, 61, 66, 254, 255, 0, 0, 0, 48,
+    0, 61, 86, 61, 61, 61, 61, 61, 61, 255, 0, 0, 16, 0, 0, 0, 16, 48, 0, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 1,
+    15, 48, 0, 68, 63, 63, 63, 63, 63, 93, 63, 63, 63, 63, 68, 63, 254, 1, 0, 1, 14, 48, 0, 63, 68, 63, 63, 68, 63, 88,
+    68, 63, 68, 63, 68, 63, 93, 254, 1, 0, 0, 13, 48, 0, 68, 63, 68, 68, 63, 93, 68, 63, 68, 68, 63, 68, 254, 1, 1, 1,
+    12, 48, 0, 68, 63, 68, 68, 68, 68, 88, 68, 68, 68, 68, 67, 254, 1, 1, 0, 11, 48, 0, 68, 93, 67, 68, 68, 67, 68, 68,
+    92, 68, 68, 67, 254, 1, 1, 0, 10, 48, 0, 67, 68, 92, 68, 67, 68, 67, 68, 67, 92, 68, 67, 67, 254, 1, 1, 0, 9, 48,
+    0, 67, 67, 92, 68, 67, 67, 67, 67, 68, 92, 67, 67, 67, 67, 68, 254, 0, 1, 0, 8, 48, 0, 92, 67, 67, 67, 67, 67, 67,
+    255, 16, 0, 31, 0, 0, 0, 24, 48, 0, 57, 57, 57, 57, 57, 57, 254, 0, 255, 1, 23, 48, 0, 58, 57, 57, 57, 57, 57, 83,
+    57, 57, 57, 57, 58, 57, 254, 0, 255, 1, 22, 48, 0, 57, 58, 57, 57, 58, 57, 82, 58, 57, 58, 57, 58, 57, 83, 254, 0, 255,
+    0, 21, 48, 0, 58, 57, 58, 58, 57, 83, 58, 57, 58, 58, 57, 58, 254, 1, 255, 1, 20, 48, 0, 58, 57, 58, 58, 58, 58, 82,
+    58, 58, 58, 58, 63, 254, 1, 255, 0, 19, 48, 0, 83, 58, 63, 58, 58, 63, 58, 83, 63, 58, 58, 63, 254, 1, 255, 0, 18, 48,
+    0, 63, 83, 63, 58, 63, 58, 63, 58, 88, 63, 58, 63, 63, 254, 1, 255, 0, 17, 48, 0, 63, 88, 63, 58, 63, 63, 63, 63, 83,
+    63, 63, 63, 63, 63, 58, 254, 1, 0, 1, 16, 48, 0, 63, 63, 63, 63, 63, 63, 88, 255, 31, 0, 16, 0, 0, 0, 0, 48, 0,
+    61, 61, 61, 61, 61, 61, 254, 255, 0, 1, 1, 48, 0, 66, 61, 61, 61, 61, 61, 91, 61, 61, 61, 61, 66, 61, 254, 255, 0, 1,
+    2, 48, 0, 61, 66, 61, 61, 66, 61, 86, 66, 61, 66, 61, 66, 61, 91, 254, 255, 0, 0, 3, 48, 0, 66, 61, 66, 66, 61, 91,
+    66, 61, 66, 66, 61, 66, 254, 255, 1, 1, 4, 48, 0, 66, 61, 66, 66, 66, 66, 86, 66, 66, 66, 66, 67, 254, 255, 1, 0, 5,
+    48, 0, 91, 66, 67, 66, 66, 67, 66, 91, 67, 66, 66, 67, 254, 255, 1, 0, 6, 48, 0, 67, 91, 67, 66, 67, 66, 67, 66, 92,
+    67, 66, 67, 67, 254, 255, 1, 0, 7, 48, 0, 67, 92, 67, 66, 67, 67, 67, 67, 91, 67, 67, 67, 67, 67, 66, 254, 0, 1, 1,
+    8, 48, 0, 67, 67, 67, 67, 67, 67, 92, 255, 16, 0, 0, 0, 0, 0, 8, 48, 0, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1,
+    1, 9, 48, 0, 68, 67, 67, 67, 67, 67, 93, 67, 67, 67, 67, 68, 67, 254, 0, 1, 1, 10, 48, 0, 67, 68, 67, 67, 68, 67,
+    92, 68, 67, 68, 67, 68, 67, 93, 254, 0, 1, 0, 11, 48, 0, 68, 67, 68, 68, 67, 93, 68, 67, 68, 68, 67, 68, 254, 1, 1,
+    1, 12, 48, 0, 68, 67, 68, 68, 68, 68, 92, 68, 68, 68, 68, 63, 254, 1, 1, 0, 13, 48, 0, 68, 93, 63, 68, 68, 63, 68,
+    68, 88, 68, 68, 63, 254, 1, 1, 0, 14, 48, 0, 63, 68, 88, 68, 63, 68, 63, 68, 63, 88, 68, 63, 63, 254, 1, 1, 0, 15,
+    48, 0, 63, 63, 88, 68, 63, 63, 63, 63, 68, 88, 63, 63, 63, 63, 68, 254, 1, 0, 0, 16, 48, 0, 88, 63, 63, 63, 63, 63,
+    63, 255, 0, 0, 16, 0, 0, 0, 16, 48, 0, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 1, 17, 48, 0, 58, 63, 63, 63, 63,
+    63, 83, 63, 63, 63, 63, 58, 63, 254, 1, 0, 1, 18, 48, 0, 63, 58, 63, 63, 58, 63, 88, 58, 63, 58, 63, 58, 63, 83, 254,
+    1, 0, 0, 19, 48, 0, 58, 63, 58, 58, 63, 58, 83, 63, 58, 58, 63, 58, 254, 1, 255, 0, 20, 48, 0, 83, 63, 58, 58, 58,
+    58, 63, 83, 58, 58, 58, 57, 254, 1, 255, 0, 21, 48, 0, 58, 83, 57, 58, 58, 57, 58, 58, 82, 58, 58, 57, 254, 1, 255, 0,
+    22, 48, 0, 57, 58, 57, 83, 57, 58, 57, 58, 57, 57, 83, 57, 57, 254, 1, 255, 0, 23, 48, 0, 57, 57, 57, 83, 57, 57, 57,
+    57, 58, 57, 82, 57, 57, 57, 58, 254, 0, 255, 0, 24, 48, 0, 57, 82, 57, 57, 57, 57, 57, 57, 255, 16, 0, 31, 0, 0, 0,
+    24, 48, 0, 57, 57, 57, 57, 57, 57, 254, 0, 255, 1, 25, 48, 0, 56, 57, 57, 57, 57, 57, 81, 57, 57, 57, 57, 56, 57, 254,
+    0, 255, 1, 26, 48, 0, 57, 56, 57, 57, 56, 57, 82, 56, 57, 56, 57, 56, 57, 81, 254, 0, 255, 0, 27, 48, 0, 56, 57, 56,
+    56, 57, 81, 56, 57, 56, 56, 57, 56, 254, 255, 255, 1, 28, 48, 0, 56, 57, 56, 56, 56, 56, 82, 56, 56, 56, 56, 61, 254, 255,
+    255, 0, 29, 48, 0, 56, 81, 61, 56, 56, 61, 56, 56, 86, 56, 56, 61, 254, 255, 255, 0, 30, 48, 0, 61, 56, 86, 56, 61, 56,
+    61, 56, 61, 86, 56, 61, 61, 254, 255, 255, 0, 31, 48, 0, 61, 61, 86, 56, 61, 61, 61, 61, 56, 86, 61, 61, 61, 61, 56, 254,
+    255, 0, 0, 0, 48, 0, 86, 61, 61, 61, 61, 61, 61, 86, 255, 31, 0, 16, 0, 16, 0, 0, 49, 0, 61, 61, 61, 61, 61, 61,
+    254, 255, 0, 255, 31, 49, 0, 56, 61, 61, 61, 61, 61, 31, 61, 61, 61, 61, 56, 61, 254, 255, 0, 255, 30, 49, 0, 61, 56, 61,
+    61, 56, 61, 36, 56, 61, 56, 61, 56, 61, 31, 254, 255, 0, 0, 29, 49, 0, 56, 61, 56, 56, 61, 31, 56, 61, 56, 56, 61, 56,
+    254, 255, 255, 255, 28, 49, 0, 56, 61, 56, 56, 56, 56, 36, 56, 56, 56, 56, 57, 254, 255, 255, 0, 27, 49, 0, 56, 31, 57, 56,
+    56, 57, 56, 56, 32, 56, 56, 57, 254, 255, 255, 0, 26, 49, 0, 57, 56, 32, 56, 57, 56, 57, 56, 57, 32, 56, 57, 57, 254, 255,
+    255, 0, 25, 49, 0, 57, 57, 32, 56, 57, 57, 57, 57, 56, 32, 57, 57, 57, 57, 56, 254, 0, 255, 0, 24, 49, 0, 32, 57, 57,
+    57, 57, 57, 57, 32, 255, 16, 0, 0, 0, 16, 0, 8, 49, 0, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 255, 7, 49, 0, 66,
+    67, 67, 67, 67, 67, 41, 67, 67, 67, 67, 66, 67, 254, 0, 1, 255, 6, 49, 0, 67, 66, 67, 67, 66, 67, 42, 66, 67, 66, 67,
+    66, 67, 41, 254, 0, 1, 0, 5, 49, 0, 66, 67, 66, 66, 67, 66, 41, 67, 66, 66, 67, 66, 254, 255, 1, 0, 4, 49, 0, 41,
+    67, 66, 66, 66, 66, 67, 41, 66, 66, 66, 61, 254, 255, 1, 0, 3, 49, 0, 66, 41, 61, 66, 66, 61, 66, 66, 36, 66, 66, 61,
+    254, 255, 1, 0, 2, 49, 0, 61, 66, 61, 41, 61, 66, 61, 66, 61, 61, 41, 61, 61, 254, 255, 1, 0, 1, 49, 0, 61, 61, 61,
+    41, 61, 61, 61, 61, 66, 61, 36, 61, 61, 61, 66, 254, 255, 0, 0, 0, 49, 0, 61, 36, 61, 61, 61, 61, 61, 61, 255, 0, 0,
+    16, 0, 16, 0, 16, 49, 0, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 255, 15, 49, 0, 68, 63, 63, 63, 63, 63, 43, 63, 63,
+    63, 63, 68, 63, 254, 1, 0, 255, 14, 49, 0, 63, 68, 63, 63, 68, 63, 38, 68, 63, 68, 63, 68, 63, 43, 254, 1, 0, 0, 13,
+    49, 0, 68, 63, 68, 68, 63, 43, 68, 63, 68, 68, 63, 68, 254, 1, 1, 255, 12, 49, 0, 68, 63, 68, 68, 68, 68, 38, 68, 68,
+    68, 68, 67, 254, 1, 1, 0, 11, 49, 0, 68, 43, 67, 68, 68, 67, 68, 68, 42, 68, 68, 67, 254, 1, 1, 0, 10, 49, 0, 67,
+    68, 42, 68, 67, 68, 67, 68, 67, 42, 68, 67, 67, 254, 1, 1, 0, 9, 49, 0, 67, 67, 42, 68, 67, 67, 67, 67, 68, 42, 67,
+    67, 67, 67, 68, 254, 0, 1, 0, 8, 49, 0, 42, 67, 67, 67, 67, 67, 67, 255, 16, 0, 31, 0, 16, 0, 24, 49, 0, 57, 57,
+    57, 57, 57, 57, 254, 0, 255, 255, 23, 49, 0, 58, 57, 57, 57, 57, 57, 33, 57, 57, 57, 57, 58, 57, 254, 0, 255, 255, 22, 49,
+    0, 57, 58, 57, 57, 58, 57, 32, 58, 57, 58, 57, 58, 57, 33, 254, 0, 255, 0, 21, 49, 0, 58, 57, 58, 58, 57, 33, 58, 57,
+    58, 58, 57, 58, 254, 1, 255, 255, 20, 49, 0, 58, 57, 58, 58, 58, 58, 32, 58, 58, 58, 58, 63, 254, 1, 255, 0, 19, 49, 0,
+    33, 58, 63, 58, 58, 63, 58, 33, 63, 58, 58, 63, 254, 1, 255, 0, 18, 49, 0, 63, 33, 63, 58, 63, 58, 63, 58, 38, 63, 58,
+    63, 63, 254, 1, 255, 0, 17, 49, 0, 63, 38, 63, 58, 63, 63, 63, 63, 33, 63, 63, 63, 63, 63, 58, 254, 1, 0, 255, 16, 49,
+    0, 63, 63, 63, 63, 63, 63, 38, 255, 31, 0, 16, 0, 16, 0, 0, 49, 0, 61, 61, 61, 61, 61, 61, 254, 255, 0, 255, 1, 49,
+    0, 66, 61, 61, 61, 61, 61, 41, 61, 61, 61, 61, 66, 61, 254, 255, 0, 255, 2, 49, 0, 61, 66, 61, 61, 66, 61, 36, 66, 61,
+    66, 61, 66, 61, 41, 254, 255, 0, 0, 3, 49, 0, 66, 61, 66, 66, 61, 41, 66, 61, 66, 66, 61, 66, 254, 255, 1, 255, 4, 49,
+    0, 66, 61, 66, 66, 66, 66, 36, 66, 66, 66, 66, 67, 254, 255, 1, 0, 5, 49, 0, 41, 66, 67, 66, 66, 67, 66, 41, 67, 66,
+    66, 67, 254, 255, 1, 0, 6, 49, 0, 67, 41, 67, 66, 67, 66, 67, 66, 42, 67, 66, 67, 67, 254, 255, 1, 0, 7, 49, 0, 67,
+    42, 67, 66, 67, 67, 67, 67, 41, 67, 67, 67, 67, 67, 66, 254, 0, 1, 255, 8, 49, 0, 67, 67, 67, 67, 67, 67, 42, 255, 16,
+    0, 0, 0, 16, 0, 8, 49, 0, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 255, 9, 49, 0, 68, 67, 67, 67, 67, 67, 43, 67,
+    67, 67, 67, 68, 67, 254, 0, 1, 255, 10, 49, 0, 67, 68, 67, 67, 68, 67, 42, 68, 67, 68, 67, 68, 67, 43, 254, 0, 1, 0,
+    11, 49, 0, 68, 67, 68, 68, 67, 43, 68, 67, 68, 68, 67, 68, 254, 1, 1, 255, 12, 49, 0, 68, 67, 68, 68, 68, 68, 42, 68,
+    68, 68, 68, 63, 254, 1, 1, 0, 13, 49, 0, 68, 43, 63, 68, 68, 63, 68, 68, 38, 68, 68, 63, 254, 1, 1, 0, 14, 49, 0,
+    63, 68, 38, 68, 63, 68, 63, 68, 63, 38, 68, 63, 63, 254, 1, 1, 0, 15, 49, 0, 63, 63, 38, 68, 63, 63, 63, 63, 68, 38,
+    63, 63, 63, 63, 68, 254, 1, 0, 0, 16, 49, 0, 38, 63, 63, 63, 63, 63, 63, 255, 0, 0, 16, 0, 16, 0, 16, 49, 0, 63,
+    63, 63, 63, 63, 63, 63, 254, 1, 0, 255, 17, 49, 0, 58, 63, 63, 63, 63, 63, 33, 63, 63, 63, 63, 58, 63, 254, 1, 0, 255,
+    18, 49, 0, 63, 58, 63, 63, 58, 63, 38, 58, 63, 58, 63, 58, 63, 33, 254, 1, 0, 0, 19, 49, 0, 58, 63, 58, 58, 63, 58,
+    33, 63, 58, 58, 63, 58, 254, 1, 255, 0, 20, 49, 0, 33, 63, 58, 58, 58, 58, 63, 33, 58, 58, 58, 57, 254, 1, 255, 0, 21,
+    49, 0, 58, 33, 57, 58, 58, 57, 58, 58, 32, 58, 58, 57, 254, 1, 255, 0, 22, 49, 0, 57, 58, 57, 33, 57, 58, 57, 58, 57,
+    57, 33, 57, 57, 254, 1, 255, 0, 23, 49, 0, 57, 57, 57, 33, 57, 57, 57, 57, 58, 57, 32, 57, 57, 57, 58, 254, 0, 255, 0,
+    24, 49, 0, 57, 32, 57, 57, 57, 57, 57, 57, 255, 16, 0, 31, 0, 16, 0, 24, 49, 0, 57, 57, 57, 57, 57, 57, 254, 0, 255,
+    255, 25, 49, 0, 56, 57, 57, 57, 57, 57, 31, 57, 57, 57, 57, 56, 57, 254, 0, 255, 255, 26, 49, 0, 57, 56, 57, 57, 56, 57,
+    32, 56, 57, 56, 57, 56, 57, 31, 254, 0, 255, 0, 27, 49, 0, 56, 57, 56, 56, 57, 31, 56, 57, 56, 56, 57, 56, 254, 255, 255,
+    255, 28, 49, 0, 56, 57, 56, 56, 56, 56, 32, 56, 56, 56, 56, 61, 254, 255, 255, 0, 29, 49, 0, 56, 31, 61, 56, 56, 61, 56,
+    56, 36, 56, 56, 61, 254, 255, 255, 0, 30, 49, 0, 61, 56, 36, 56, 61, 56, 61, 56, 61, 36, 56, 61, 61, 254, 255, 255, 0, 31,
+    49, 0, 61, 61, 36, 56, 61, 61, 61, 61, 56, 36, 61, 61, 61, 61, 56, 254, 255, 0, 0, 0, 49, 0, 36, 61, 61, 61, 61, 61,
+    61, 36, 255, 31, 0, 16, 0, 0, 0, 0, 2, 2, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61,
+    86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 255, 16, 0, 0, 0, 0, 0, 8, 2, 2, 67, 92, 67, 92, 67, 92, 67,
+    92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 255, 0, 0, 16, 0, 0,
+    0, 16, 2, 2, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88,
+    63, 88, 63, 88, 63, 255, 16, 0, 31, 0, 0, 0, 24, 2, 2, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82,
+    57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 255, 31, 0, 16, 0, 0, 0, 0, 2, 4, 86, 61, 86, 61,
+    86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 255, 16, 0,
+    0, 0, 0, 0, 8, 2, 4, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67,
+    92, 67, 92, 67, 92, 67, 92, 67, 255, 0, 0, 16, 0, 0, 0, 16, 2, 4, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88,
+    63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 255, 16, 0, 31, 0, 0, 0, 24, 2, 4, 82,
+    57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82,
+    255, 31, 0, 16, 0, 0, 0, 0, 1, 0, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 0, 61, 61, 254, 255, 0, 0, 0, 5, 0,
+    61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 0, 61, 61, 254, 255, 0, 0, 0, 1, 0, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0,
+    0, 61, 61, 254, 255, 0, 0, 0, 5, 0, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 0, 61, 61, 255, 16, 0, 0, 0, 0, 0,
+    8, 1, 0, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 0, 67, 67, 254, 0, 1, 0, 8, 5, 0, 67, 67, 67, 67, 254, 0, 1,
+    0, 8, 0, 0, 67, 67, 254, 0, 1, 0, 8, 1, 0, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 0, 67, 67, 254, 0, 1, 0,
+    8, 5, 0, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 0, 67, 67, 255, 0, 0, 16, 0, 0, 0, 16, 1, 0, 63, 63, 63, 63,
+    254, 1, 0, 0, 16, 0, 0, 63, 63, 254, 1, 0, 0, 16, 5, 0, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 0, 63, 63, 254,
+    1, 0, 0, 16, 1, 0, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 0, 63, 63, 254, 1, 0, 0, 16, 5, 0, 63, 63, 63, 63,
+    254, 1, 0, 0, 16, 0, 0, 63, 63, 255, 16, 0, 31, 0, 0, 0, 24, 1, 0, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 0,
+    57, 57, 254, 0, 255, 0, 24, 5, 0, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 0, 57, 57, 254, 0, 255, 0, 24, 1, 0, 57,
+    57, 57, 57, 254, 0, 255, 0, 24, 0, 0, 57, 57, 254, 0, 255, 0, 24, 5, 0, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 0,
+    57, 57, 255, 31, 0, 16, 0, 15, 0, 0, 6, 2, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36,
+    61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 255, 16, 0, 0, 0, 15, 0, 8, 6, 2, 42, 67, 42, 67, 42, 67, 42,
+    67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 255, 0, 0, 16, 0, 15,
+    0, 16, 6, 2, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63,
+    38, 63, 38, 63, 38, 255, 16, 0, 31, 0, 15, 0, 24, 6, 2, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57,
+    32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 255, 31, 0, 16, 0, 15, 0, 0, 6, 4, 61, 36, 61, 36,
+    61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 255, 16, 0,
+    0, 0, 15, 0, 8, 6, 4, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42,
+    67, 42, 67, 42, 67, 42, 67, 42, 255, 0, 0, 16, 0, 15, 0, 16, 6, 4, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63,
+    38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 255, 16, 0, 31, 0, 15, 0, 24, 6, 4, 57,
+    32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57,
+    255, 31, 0, 16, 0, 16, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 36, 61, 61, 61, 61, 61, 61,
+    254, 255, 0, 255, 0, 5, 0, 61, 61, 61, 61, 36, 61, 61, 61, 36, 61, 61, 61, 36, 61, 61, 61, 36, 61, 61, 61, 61, 254, 255,
+    0, 255, 0, 0, 0, 61, 61, 61, 61, 61, 61, 36, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 86, 61, 61, 61, 61, 61, 61, 254, 255, 0, 1, 0, 1, 0, 61, 61, 61, 61, 86,
+    61, 61, 61, 86, 61, 61, 61, 86, 61, 61, 61, 86, 61, 61, 61, 61, 254, 255, 0, 1, 0, 0, 0, 61, 61, 61, 61, 61, 61, 86,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 16, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 42, 67, 67, 67, 67, 67, 67, 254, 0, 1, 255, 8, 5, 0, 67, 67, 67, 67, 42, 67, 67, 67, 42, 67,
+    67, 67, 42, 67, 67, 67, 42, 67, 67, 67, 67, 254, 0, 1, 255, 8, 0, 0, 67, 67, 67, 67, 67, 67, 42, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 92, 67, 67, 67, 67, 67,
+    67, 254, 0, 1, 1, 8, 1, 0, 67, 67, 67, 67, 92, 67, 67, 67, 92, 67, 67, 67, 92, 67, 67, 67, 92, 67, 67, 67, 67, 254,
+    0, 1, 1, 8, 0, 0, 67, 67, 67, 67, 67, 67, 92, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 16,
+    0, 16, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 38, 63, 63, 63, 63, 63, 63, 254, 1, 0, 255,
+    16, 5, 0, 63, 63, 63, 63, 38, 63, 63, 63, 38, 63, 63, 63, 38, 63, 63, 63, 38, 63, 63, 63, 63, 254, 1, 0, 255, 16, 0,
+    0, 63, 63, 63, 63, 63, 63, 38, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 88, 63, 63, 63, 63, 63, 63, 254, 1, 0, 1, 16, 1, 0, 63, 63, 63, 63, 88, 63, 63, 63, 88,
+    63, 63, 63, 88, 63, 63, 63, 88, 63, 63, 63, 63, 254, 1, 0, 1, 16, 0, 0, 63, 63, 63, 63, 63, 63, 88, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 255, 16, 0, 31, 0, 16, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 32, 57, 57, 57, 57, 57, 57, 254, 0, 255, 255, 24, 5, 0, 57, 57, 57, 57, 32, 57, 57, 57, 32, 57, 57, 57, 32, 57,
+    57, 57, 32, 57, 57, 57, 57, 254, 0, 255, 255, 24, 0, 0, 57, 57, 57, 57, 57, 57, 32, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 82, 57, 57, 57, 57, 57, 57, 254, 0, 255,
+    1, 24, 1, 0, 57, 57, 57, 57, 82, 57, 57, 57, 82, 57, 57, 57, 82, 57, 57, 57, 82, 57, 57, 57, 57, 254, 0, 255, 1, 24,
+    0, 0, 57, 57, 57, 57, 57, 57, 82, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 255, 31, 0, 16, 0, 0, 0, 0,
+    0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 86, 254, 255, 0, 0, 0, 1, 0, 61, 61, 61, 61,
+    86, 61, 61, 61, 86, 61, 61, 61, 86, 61, 61, 61, 86, 61, 86, 61, 61, 61, 254, 255, 0, 1, 0, 2, 0, 61, 61, 86, 61, 86,
+    61, 61, 86, 61, 86, 86, 61, 61, 61, 86, 86, 61, 61, 86, 86, 61, 86, 86, 61, 61, 86, 86, 61, 86, 254, 255, 0, 1, 0, 3,
+    0, 61, 86, 86, 86, 86, 61, 86, 86, 61, 86, 86, 61, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+    86, 86, 86, 86, 87, 254, 255, 0, 1, 0, 4, 0, 87, 86, 86, 86, 86, 86, 87, 86, 86, 86, 87, 86, 86, 87, 86, 86, 87, 86,
+    86, 87, 86, 87, 86, 86, 87, 86, 87, 86, 87, 86, 87, 86, 86, 87, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 92, 254, 0, 1, 0, 8, 1, 0, 67, 67, 67, 67, 92, 67, 67, 67, 92, 67,
+    67, 67, 92, 67, 67, 67, 92, 67, 92, 67, 67, 67, 254, 0, 1, 1, 8, 2, 0, 67, 67, 92, 67, 92, 67, 67, 92, 67, 92, 92,
+    67, 67, 67, 92, 92, 67, 67, 92, 92, 67, 92, 92, 67, 67, 92, 92, 67, 92, 254, 0, 1, 1, 8, 3, 0, 67, 92, 92, 92, 92,
+    67, 92, 92, 67, 92, 92, 67, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 87, 254,
+    0, 1, 1, 8, 4, 0, 87, 92, 92, 92, 92, 92, 87, 92, 92, 92, 87, 92, 92, 87, 92, 92, 87, 92, 92, 87, 92, 87, 92, 92,
+    87, 92, 87, 92, 87, 92, 87, 92, 92, 87, 255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 88, 254, 1, 0, 0, 16, 1, 0, 63, 63, 63, 63, 88, 63, 63, 63, 88, 63, 63, 63, 88, 63, 63, 63,
+    88, 63, 88, 63, 63, 63, 254, 1, 0, 1, 16, 2, 0, 63, 63, 88, 63, 88, 63, 63, 88, 63, 88, 88, 63, 63, 63, 88, 88, 63,
+    63, 88, 88, 63, 88, 88, 63, 63, 88, 88, 63, 88, 254, 1, 0, 1, 16, 3, 0, 63, 88, 88, 88, 88, 63, 88, 88, 63, 88, 88,
+    63, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 87, 254, 1, 0, 1, 16, 4, 0,
+    87, 88, 88, 88, 88, 88, 87, 88, 88, 88, 87, 88, 88, 87, 88, 88, 87, 88, 88, 87, 88, 87, 88, 88, 87, 88, 87, 88, 87, 88,
+    87, 88, 88, 87, 255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    82, 254, 0, 255, 0, 24, 1, 0, 57, 57, 57, 57, 82, 57, 57, 57, 82, 57, 57, 57, 82, 57, 57, 57, 82, 57, 82, 57, 57, 57,
+    254, 0, 255, 1, 24, 2, 0, 57, 57, 82, 57, 82, 57, 57, 82, 57, 82, 82, 57, 57, 57, 82, 82, 57, 57, 82, 82, 57, 82, 82,
+    57, 57, 82, 82, 57, 82, 254, 0, 255, 1, 24, 3, 0, 57, 82, 82, 82, 82, 57, 82, 82, 57, 82, 82, 57, 82, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 87, 254, 0, 255, 1, 24, 4, 0, 87, 82, 82, 82, 82, 82,
+    87, 82, 82, 82, 87, 82, 82, 87, 82, 82, 87, 82, 82, 87, 82, 87, 82, 82, 87, 82, 87, 82, 87, 82, 87, 82, 82, 87, 255, 31,
+    0, 16, 0, 0, 0, 0, 4, 0, 87, 86, 86, 87, 86, 87, 86, 87, 86, 87, 86, 86, 87, 86, 87, 86, 86, 87, 86, 86, 87, 86,
+    86, 87, 86, 86, 86, 87, 86, 86, 86, 86, 86, 87, 254, 255, 0, 1, 0, 3, 0, 87, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+    86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 61, 86, 86, 61, 86, 86, 61, 86, 86, 86, 86, 61, 254, 255, 0, 1, 0, 2, 0,
+    86, 61, 86, 86, 61, 61, 86, 86, 61, 86, 86, 61, 61, 86, 86, 61, 61, 61, 86, 86, 61, 86, 61, 61, 86, 61, 86, 61, 61, 254,
+    255, 0, 1, 0, 1, 0, 61, 61, 61, 86, 61, 86, 61, 61, 61, 86, 61, 61, 61, 86, 61, 61, 61, 86, 61, 61, 61, 61, 254, 255,
+    0, 0, 0, 0, 0, 86, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 0, 0, 8,
+    4, 0, 87, 92, 92, 87, 92, 87, 92, 87, 92, 87, 92, 92, 87, 92, 87, 92, 92, 87, 92, 92, 87, 92, 92, 87, 92, 92, 92, 87,
+    92, 92, 92, 92, 92, 87, 254, 0, 1, 1, 8, 3, 0, 87, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92,
+    92, 92, 92, 92, 92, 67, 92, 92, 67, 92, 92, 67, 92, 92, 92, 92, 67, 254, 0, 1, 1, 8, 2, 0, 92, 67, 92, 92, 67, 67,
+    92, 92, 67, 92, 92, 67, 67, 92, 92, 67, 67, 67, 92, 92, 67, 92, 67, 67, 92, 67, 92, 67, 67, 254, 0, 1, 1, 8, 1, 0,
+    67, 67, 67, 92, 67, 92, 67, 67, 67, 92, 67, 67, 67, 92, 67, 67, 67, 92, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 0, 92,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 0, 0, 16, 4, 0, 87, 88, 88, 87,
+    88, 87, 88, 87, 88, 87, 88, 88, 87, 88, 87, 88, 88, 87, 88, 88, 87, 88, 88, 87, 88, 88, 88, 87, 88, 88, 88, 88, 88, 87,
+    254, 1, 0, 1, 16, 3, 0, 87, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 63,
+    88, 88, 63, 88, 88, 63, 88, 88, 88, 88, 63, 254, 1, 0, 1, 16, 2, 0, 88, 63, 88, 88, 63, 63, 88, 88, 63, 88, 88, 63,
+    63, 88, 88, 63, 63, 63, 88, 88, 63, 88, 63, 63, 88, 63, 88, 63, 63, 254, 1, 0, 1, 16, 1, 0, 63, 63, 63, 88, 63, 88,
+    63, 63, 63, 88, 63, 63, 63, 88, 63, 63, 63, 88, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 0, 88, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 255, 16, 0, 31, 0, 0, 0, 24, 4, 0, 87, 82, 82, 87, 82, 87, 82, 87, 82, 87,
+    82, 82, 87, 82, 87, 82, 82, 87, 82, 82, 87, 82, 82, 87, 82, 82, 82, 87, 82, 82, 82, 82, 82, 87, 254, 0, 255, 1, 24, 3,
+    0, 87, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 57, 82, 82, 57, 82, 82, 57,
+    82, 82, 82, 82, 57, 254, 0, 255, 1, 24, 2, 0, 82, 57, 82, 82, 57, 57, 82, 82, 57, 82, 82, 57, 57, 82, 82, 57, 57, 57,
+    82, 82, 57, 82, 57, 57, 82, 57, 82, 57, 57, 254, 0, 255, 1, 24, 1, 0, 57, 57, 57, 82, 57, 82, 57, 57, 57, 82, 57, 57,
+    57, 82, 57, 57, 57, 82, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 0, 82, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 255, 31, 0, 16, 0, 48, 0, 0, 8, 0, 37, 36, 36, 37, 36, 37, 36, 37, 36, 37, 36, 36, 37, 36, 37, 36,
+    36, 37, 36, 36, 37, 36, 36, 37, 36, 36, 36, 37, 36, 36, 36, 36, 36, 37, 254, 255, 0, 255, 0, 7, 0, 37, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 61, 36, 36, 61, 36, 36, 61, 36, 36, 36, 36, 61, 254,
+    255, 0, 255, 0, 6, 0, 36, 61, 36, 36, 61, 61, 36, 36, 61, 36, 36, 61, 61, 36, 36, 61, 61, 61, 36, 36, 61, 36, 61, 61,
+    36, 61, 36, 61, 61, 254, 255, 0, 255, 0, 5, 0, 61, 61, 61, 36, 61, 36, 61, 61, 61, 36, 61, 61, 61, 36, 61, 61, 61, 36,
+    61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 0, 36, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 16,
+    0, 0, 0, 48, 0, 8, 8, 0, 37, 42, 42, 37, 42, 37, 42, 37, 42, 37, 42, 42, 37, 42, 37, 42, 42, 37, 42, 42, 37, 42,
+    42, 37, 42, 42, 42, 37, 42, 42, 42, 42, 42, 37, 254, 0, 1, 255, 8, 7, 0, 37, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 67, 42, 42, 67, 42, 42, 67, 42, 42, 42, 42, 67, 254, 0, 1, 255, 8, 6, 0,
+    42, 67, 42, 42, 67, 67, 42, 42, 67, 42, 42, 67, 67, 42, 42, 67, 67, 67, 42, 42, 67, 42, 67, 67, 42, 67, 42, 67, 67, 254,
+    0, 1, 255, 8, 5, 0, 67, 67, 67, 42, 67, 42, 67, 67, 67, 42, 67, 67, 67, 42, 67, 67, 67, 42, 67, 67, 67, 67, 254, 0,
+    1, 0, 8, 0, 0, 42, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 48, 0, 16,
+    8, 0, 37, 38, 38, 37, 38, 37, 38, 37, 38, 37, 38, 38, 37, 38, 37, 38, 38, 37, 38, 38, 37, 38, 38, 37, 38, 38, 38, 37,
+    38, 38, 38, 38, 38, 37, 254, 1, 0, 255, 16, 7, 0, 37, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 63, 38, 38, 63, 38, 38, 63, 38, 38, 38, 38, 63, 254, 1, 0, 255, 16, 6, 0, 38, 63, 38, 38, 63, 63,
+    38, 38, 63, 38, 38, 63, 63, 38, 38, 63, 63, 63, 38, 38, 63, 38, 63, 63, 38, 63, 38, 63, 63, 254, 1, 0, 255, 16, 5, 0,
+    63, 63, 63, 38, 63, 38, 63, 63, 63, 38, 63, 63, 63, 38, 63, 63, 63, 38, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 0, 38,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 255, 16, 0, 31, 0, 48, 0, 24, 8, 0, 37, 32, 32, 37,
+    32, 37, 32, 37, 32, 37, 32, 32, 37, 32, 37, 32, 32, 37, 32, 32, 37, 32, 32, 37, 32, 32, 32, 37, 32, 32, 32, 32, 32, 37,
+    254, 0, 255, 255, 24, 7, 0, 37, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 57,
+    32, 32, 57, 32, 32, 57, 32, 32, 32, 32, 57, 254, 0, 255, 255, 24, 6, 0, 32, 57, 32, 32, 57, 57, 32, 32, 57, 32, 32, 57,
+    57, 32, 32, 57, 57, 57, 32, 32, 57, 32, 57, 57, 32, 57, 32, 57, 57, 254, 0, 255, 255, 24, 5, 0, 57, 57, 57, 32, 57, 32,
+    57, 57, 57, 32, 57, 57, 57, 32, 57, 57, 57, 32, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 0, 32, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 255, 31, 0, 16, 0, 8, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 36, 254, 255, 0, 0, 0, 5, 0, 61, 61, 61, 61, 36, 61, 61, 61, 36, 61, 61, 61, 36, 61, 61, 61,
+    36, 61, 36, 61, 61, 61, 254, 255, 0, 255, 0, 6, 0, 61, 61, 36, 61, 36, 61, 61, 36, 61, 36, 36, 61, 61, 61, 36, 36, 61,
+    61, 36, 36, 61, 36, 36, 61, 61, 36, 36, 61, 36, 254, 255, 0, 255, 0, 7, 0, 61, 36, 36, 36, 36, 61, 36, 36, 61, 36, 36,
+    61, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 37, 254, 255, 0, 255, 0, 8, 0,
+    37, 36, 36, 36, 36, 36, 37, 36, 36, 36, 37, 36, 36, 37, 36, 36, 37, 36, 36, 37, 36, 37, 36, 36, 37, 36, 37, 36, 37, 36,
+    37, 36, 36, 37, 255, 16, 0, 0, 0, 8, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    42, 254, 0, 1, 0, 8, 5, 0, 67, 67, 67, 67, 42, 67, 67, 67, 42, 67, 67, 67, 42, 67, 67, 67, 42, 67, 42, 67, 67, 67,
+    254, 0, 1, 255, 8, 6, 0, 67, 67, 42, 67, 42, 67, 67, 42, 67, 42, 42, 67, 67, 67, 42, 42, 67, 67, 42, 42, 67, 42, 42,
+    67, 67, 42, 42, 67, 42, 254, 0, 1, 255, 8, 7, 0, 67, 42, 42, 42, 42, 67, 42, 42, 67, 42, 42, 67, 42, 42, 42, 42, 42,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 37, 254, 0, 1, 255, 8, 8, 0, 37, 42, 42, 42, 42, 42,
+    37, 42, 42, 42, 37, 42, 42, 37, 42, 42, 37, 42, 42, 37, 42, 37, 42, 42, 37, 42, 37, 42, 37, 42, 37, 42, 42, 37, 255, 0,
+    0, 16, 0, 8, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 38, 254, 1, 0, 0, 16,
+    5, 0, 63, 63, 63, 63, 38, 63, 63, 63, 38, 63, 63, 63, 38, 63, 63, 63, 38, 63, 38, 63, 63, 63, 254, 1, 0, 255, 16, 6,
+    0, 63, 63, 38, 63, 38, 63, 63, 38, 63, 38, 38, 63, 63, 63, 38, 38, 63, 63, 38, 38, 63, 38, 38, 63, 63, 38, 38, 63, 38,
+    254, 1, 0, 255, 16, 7, 0, 63, 38, 38, 38, 38, 63, 38, 38, 63, 38, 38, 63, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 37, 254, 1, 0, 255, 16, 8, 0, 37, 38, 38, 38, 38, 38, 37, 38, 38, 38, 37, 38,
+    38, 37, 38, 38, 37, 38, 38, 37, 38, 37, 38, 38, 37, 38, 37, 38, 37, 38, 37, 38, 38, 37, 255, 16, 0, 31, 0, 8, 0, 24,
+    0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 32, 254, 0, 255, 0, 24, 5, 0, 57, 57, 57, 57,
+    32, 57, 57, 57, 32, 57, 57, 57, 32, 57, 57, 57, 32, 57, 32, 57, 57, 57, 254, 0, 255, 255, 24, 6, 0, 57, 57, 32, 57, 32,
+    57, 57, 32, 57, 32, 32, 57, 57, 57, 32, 32, 57, 57, 32, 32, 57, 32, 32, 57, 57, 32, 32, 57, 32, 254, 0, 255, 255, 24, 7,
+    0, 57, 32, 32, 32, 32, 57, 32, 32, 57, 32, 32, 57, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 37, 254, 0, 255, 255, 24, 8, 0, 37, 32, 32, 32, 32, 32, 37, 32, 32, 32, 37, 32, 32, 37, 32, 32, 37, 32,
+    32, 37, 32, 37, 32, 32, 37, 32, 37, 32, 37, 32, 37, 32, 32, 37, 255, 31, 0, 16, 0, 0, 0, 0, 2, 0, 86, 61, 86, 61,
+    86, 61, 61, 254, 255, 0, 1, 0, 1, 0, 61, 61, 86, 61, 61, 86, 61, 61, 61, 86, 61, 61, 61, 254, 255, 0, 0, 0, 0, 0,
+    61, 86, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 255, 0, 5, 0, 61, 61, 61, 61, 61, 36,
+    61, 61, 61, 36, 61, 61, 36, 61, 61, 254, 255, 0, 255, 0, 6, 0, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 36, 61,
+    36, 36, 61, 254, 255, 0, 255, 0, 7, 0, 36, 36, 61, 36, 36, 36, 36, 36, 11, 36, 36, 36, 36, 37, 36, 36, 254, 255, 0, 255,
+    0, 8, 0, 37, 36, 36, 37, 36, 36, 37, 36, 37, 61, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+    36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+    36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 255, 16, 0, 0, 0, 0, 0, 8, 2, 0, 67, 92, 67, 92,
+    67, 92, 67, 254, 0, 1, 1, 8, 1, 0, 67, 67, 92, 67, 67, 92, 67, 67, 67, 92, 67, 67, 67, 254, 0, 1, 0, 8, 0, 0,
+    67, 92, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 255, 8, 5, 0, 67, 67, 67, 67, 67, 42,
+    67, 67, 67, 42, 67, 67, 42, 67, 67, 254, 0, 1, 255, 8, 6, 0, 67, 67, 42, 67, 42, 67, 42, 42, 67, 42, 67, 42, 42, 67,
+    42, 42, 67, 254, 0, 1, 255, 8, 7, 0, 42, 42, 67, 42, 42, 42, 42, 42, 17, 42, 42, 42, 42, 37, 42, 42, 254, 0, 1, 255,
+    8, 8, 0, 37, 42, 42, 37, 42, 42, 37, 42, 37, 67, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37,
+    42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37,
+    42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 255, 0, 0, 16, 0, 0, 0, 16, 2, 0, 63, 88, 63, 88,
+    63, 88, 63, 254, 1, 0, 1, 16, 1, 0, 63, 63, 88, 63, 63, 88, 63, 63, 63, 88, 63, 63, 63, 254, 1, 0, 0, 16, 0, 0,
+    63, 88, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 255, 16, 5, 0, 63, 63, 63, 63, 63, 38,
+    63, 63, 63, 38, 63, 63, 38, 63, 63, 254, 1, 0, 255, 16, 6, 0, 63, 63, 38, 63, 38, 63, 38, 38, 63, 38, 63, 38, 38, 63,
+    38, 38, 63, 254, 1, 0, 255, 16, 7, 0, 38, 38, 63, 38, 38, 38, 38, 38, 13, 38, 38, 38, 38, 37, 38, 38, 254, 1, 0, 255,
+    16, 8, 0, 37, 38, 38, 37, 38, 38, 37, 38, 37, 63, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37,
+    38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37,
+    38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 255, 16, 0, 31, 0, 0, 0, 24, 2, 0, 82, 57, 82, 57,
+    82, 57, 57, 254, 0, 255, 1, 24, 1, 0, 57, 57, 82, 57, 57, 82, 57, 57, 57, 82, 57, 57, 57, 254, 0, 255, 0, 24, 0, 0,
+    57, 82, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 255, 24, 5, 0, 57, 57, 57, 57, 57, 32,
+    57, 57, 57, 32, 57, 57, 32, 57, 57, 254, 0, 255, 255, 24, 6, 0, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 32, 57,
+    32, 32, 57, 254, 0, 255, 255, 24, 7, 0, 32, 32, 57, 32, 32, 32, 32, 32, 7, 32, 32, 32, 32, 37, 32, 32, 254, 0, 255, 255,
+    24, 8, 0, 37, 32, 32, 37, 32, 32, 37, 32, 37, 57, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37,
+    32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37,
+    32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61,
+    61, 61, 86, 61, 61, 61, 61, 61, 61, 61, 61, 86, 254, 255, 0, 0, 0, 1, 0, 61, 61, 61, 61, 61, 86, 61, 61, 61, 61, 86,
+    61, 61, 61, 86, 61, 61, 61, 86, 61, 61, 61, 86, 61, 61, 86, 61, 61, 86, 61, 61, 86, 61, 61, 86, 61, 254, 255, 0, 0, 0,
+    2, 0, 86, 61, 86, 61, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 86, 61, 86, 61,
+    86, 86, 61, 86, 86, 61, 86, 86, 61, 86, 86, 61, 86, 86, 86, 61, 86, 86, 86, 254, 255, 0, 0, 0, 3, 0, 86, 86, 86, 86,
+    86, 86, 61, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 87, 86, 86, 86, 86, 86, 87, 86, 86,
+    86, 86, 87, 86, 86, 86, 87, 86, 86, 87, 86, 86, 86, 87, 86, 86, 87, 254, 255, 0, 1, 0, 4, 0, 87, 86, 86, 87, 86, 86,
+    87, 86, 87, 86, 87, 86, 86, 87, 86, 87, 86, 87, 86, 87, 86, 87, 86, 87, 86, 87, 86, 87, 86, 87, 86, 87, 87, 86, 87, 86,
+    87, 86, 87, 87, 86, 87, 86, 87, 254, 0, 0, 1, 0, 9, 0, 86, 87, 87, 86, 87, 87, 86, 87, 87, 86, 87, 87, 86, 87, 87,
+    86, 87, 87, 86, 87, 87, 87, 86, 87, 87, 86, 87, 87, 87, 86, 87, 87, 87, 87, 86, 87, 87, 87, 86, 87, 87, 87, 87, 86, 87,
+    87, 87, 87, 87, 86, 87, 87, 254, 0, 0, 1, 0, 10, 0, 87, 87, 87, 86, 87, 87, 87, 87, 87, 87, 87, 86, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 86, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 62, 87, 87, 87,
+    87, 87, 87, 87, 87, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 92, 67, 67, 67, 67, 67, 67, 67, 67,
+    92, 254, 0, 1, 0, 8, 1, 0, 67, 67, 67, 67, 67, 92, 67, 67, 67, 67, 92, 67, 67, 67, 92, 67, 67, 67, 92, 67, 67, 67,
+    92, 67, 67, 92, 67, 67, 92, 67, 67, 92, 67, 67, 92, 67, 254, 0, 1, 0, 8, 2, 0, 92, 67, 92, 67, 67, 92, 67, 92, 67,
+    92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 92, 67, 92, 67, 92, 92, 67, 92, 92, 67, 92, 92, 67, 92, 92,
+    67, 92, 92, 92, 67, 92, 92, 92, 254, 0, 1, 0, 8, 3, 0, 92, 92, 92, 92, 92, 92, 67, 92, 92, 92, 92, 92, 92, 92, 92,
+    92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 87, 92, 92, 92, 92, 92, 87, 92, 92, 92, 92, 87, 92, 92, 92, 87, 92, 92, 87, 92,
+    92, 92, 87, 92, 92, 87, 254, 0, 1, 1, 8, 4, 0, 87, 92, 92, 87, 92, 92, 87, 92, 87, 92, 87, 92, 92, 87, 92, 87, 92,
+    87, 92, 87, 92, 87, 92, 87, 92, 87, 92, 87, 92, 87, 92, 87, 87, 92, 87, 92, 87, 92, 87, 87, 92, 87, 92, 87, 254, 0, 0,
+    1, 8, 9, 0, 92, 87, 87, 92, 87, 87, 92, 87, 87, 92, 87, 87, 92, 87, 87, 92, 87, 87, 92, 87, 87, 87, 92, 87, 87, 92,
+    87, 87, 87, 92, 87, 87, 87, 87, 92, 87, 87, 87, 92, 87, 87, 87, 87, 92, 87, 87, 87, 87, 87, 92, 87, 87, 254, 0, 0, 1,
+    8, 10, 0, 87, 87, 87, 92, 87, 87, 87, 87, 87, 87, 87, 92, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 92, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 62, 87, 87, 87, 87, 87, 87, 87, 87, 255, 0, 0, 16, 0, 0,
+    0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 88, 63, 63, 63, 63, 63, 63, 63, 63, 88, 254, 1, 0, 0, 16, 1, 0, 63, 63, 63,
+    63, 63, 88, 63, 63, 63, 63, 88, 63, 63, 63, 88, 63, 63, 63, 88, 63, 63, 63, 88, 63, 63, 88, 63, 63, 88, 63, 63, 88, 63,
+    63, 88, 63, 254, 1, 0, 0, 16, 2, 0, 88, 63, 88, 63, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88,
+    63, 88, 63, 88, 88, 63, 88, 63, 88, 88, 63, 88, 88, 63, 88, 88, 63, 88, 88, 63, 88, 88, 88, 63, 88, 88, 88, 254, 1, 0,
+    0, 16, 3, 0, 88, 88, 88, 88, 88, 88, 63, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 87,
+    88, 88, 88, 88, 88, 87, 88, 88, 88, 88, 87, 88, 88, 88, 87, 88, 88, 87, 88, 88, 88, 87, 88, 88, 87, 254, 1, 0, 1, 16,
+    4, 0, 87, 88, 88, 87, 88, 88, 87, 88, 87, 88, 87, 88, 88, 87, 88, 87, 88, 87, 88, 87, 88, 87, 88, 87, 88, 87, 88, 87,
+    88, 87, 88, 87, 87, 88, 87, 88, 87, 88, 87, 87, 88, 87, 88, 87, 254, 0, 0, 1, 16, 9, 0, 88, 87, 87, 88, 87, 87, 88,
+    87, 87, 88, 87, 87, 88, 87, 87, 88, 87, 87, 88, 87, 87, 87, 88, 87, 87, 88, 87, 87, 87, 88, 87, 87, 87, 87, 88, 87, 87,
+    87, 88, 87, 87, 87, 87, 88, 87, 87, 87, 87, 87, 88, 87, 87, 254, 0, 0, 1, 16, 10, 0, 87, 87, 87, 88, 87, 87, 87, 87,
+    87, 87, 87, 88, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 88, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 62, 87, 87, 87, 87, 87, 87, 87, 87, 255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 82,
+    57, 57, 57, 57, 57, 57, 57, 57, 82, 254, 0, 255, 0, 24, 1, 0, 57, 57, 57, 57, 57, 82, 57, 57, 57, 57, 82, 57, 57, 57,
+    82, 57, 57, 57, 82, 57, 57, 57, 82, 57, 57, 82, 57, 57, 82, 57, 57, 82, 57, 57, 82, 57, 254, 0, 255, 0, 24, 2, 0, 82,
+    57, 82, 57, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 82, 57, 82, 57, 82, 82, 57,
+    82, 82, 57, 82, 82, 57, 82, 82, 57, 82, 82, 82, 57, 82, 82, 82, 254, 0, 255, 0, 24, 3, 0, 82, 82, 82, 82, 82, 82, 57,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 87, 82, 82, 82, 82, 82, 87, 82, 82, 82, 82, 87,
+    82, 82, 82, 87, 82, 82, 87, 82, 82, 82, 87, 82, 82, 87, 254, 0, 255, 1, 24, 4, 0, 87, 82, 82, 87, 82, 82, 87, 82, 87,
+    82, 87, 82, 82, 87, 82, 87, 82, 87, 82, 87, 82, 87, 82, 87, 82, 87, 82, 87, 82, 87, 82, 87, 87, 82, 87, 82, 87, 82, 87,
+    87, 82, 87, 82, 87, 254, 0, 0, 1, 24, 9, 0, 82, 87, 87, 82, 87, 87, 82, 87, 87, 82, 87, 87, 82, 87, 87, 82, 87, 87,
+    82, 87, 87, 87, 82, 87, 87, 82, 87, 87, 87, 82, 87, 87, 87, 87, 82, 87, 87, 87, 82, 87, 87, 87, 87, 82, 87, 87, 87, 87,
+    87, 82, 87, 87, 254, 0, 0, 1, 24, 10, 0, 87, 87, 87, 82, 87, 87, 87, 87, 87, 87, 87, 82, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 82, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 62, 87, 87, 87, 87, 87, 87,
+    87, 87, 255, 37, 0, 16, 0, 0, 0, 0, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 255, 16, 0, 250, 255, 0, 0, 8, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    255, 250, 255, 16, 0, 0, 0, 16, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 255,
+    16, 0, 37, 0, 0, 0, 24, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 255, 16,
+    0, 16, 0, 0, 0, 0, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 255, 16, 0, 15, 0, 0, 0, 8, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 255, 15, 0, 16, 0, 0, 0, 16, 10, 0,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 255, 16, 0, 16, 0, 0, 0, 24, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 255, 16, 0, 16, 0, 31, 0, 0, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 255, 16, 0, 15, 0, 31, 0,
+    8, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 255, 15, 0, 16, 0, 31, 0, 16, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 255, 16, 0, 16, 0, 31, 0, 24, 18, 0, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 255, 31, 0, 16,
+    0, 0, 0, 0, 4, 0, 87, 86, 87, 86, 87, 86, 87, 86, 87, 86, 87, 86, 87, 87, 86, 87, 254, 255, 0, 1, 0, 9, 0, 87,
+    87, 86, 87, 87, 86, 87, 87, 87, 86, 87, 87, 87, 86, 87, 87, 87, 86, 87, 87, 87, 86, 87, 87, 87, 254, 0, 0, 1, 0, 10,
+    0, 87, 87, 86, 87, 87, 87, 87, 87, 87, 87, 87, 87, 255, 16, 0, 0, 0, 0, 0, 8, 4, 0, 87, 92, 87, 92, 87, 92, 87,
+    92, 87, 92, 87, 92, 87, 87, 92, 87, 254, 0, 1, 1, 8, 9, 0, 87, 87, 92, 87, 87, 92, 87, 87, 87, 92, 87, 87, 87, 92,
+    87, 87, 87, 92, 87, 87, 87, 92, 87, 87, 87, 254, 0, 0, 1, 8, 10, 0, 87, 87, 92, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    255, 0, 0, 16, 0, 0, 0, 16, 4, 0, 87, 88, 87, 88, 87, 88, 87, 88, 87, 88, 87, 88, 87, 87, 88, 87, 254, 1, 0, 1,
+    16, 9, 0, 87, 87, 88, 87, 87, 88, 87, 87, 87, 88, 87, 87, 87, 88, 87, 87, 87, 88, 87, 87, 87, 88, 87, 87, 87, 254, 0,
+    0, 1, 16, 10, 0, 87, 87, 88, 87, 87, 87, 87, 87, 87, 87, 87, 87, 255, 16, 0, 31, 0, 0, 0, 24, 4, 0, 87, 82, 87,
+    82, 87, 82, 87, 82, 87, 82, 87, 82, 87, 87, 82, 87, 254, 0, 255, 1, 24, 9, 0, 87, 87, 82, 87, 87, 82, 87, 87, 87, 82,
+    87, 87, 87, 82, 87, 87, 87, 82, 87, 87, 87, 82, 87, 87, 87, 254, 0, 0, 1, 24, 10, 0, 87, 87, 82, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 255, 16, 0, 16, 0, 55, 0, 0, 18, 0, 37, 37, 37, 37, 37, 37, 37, 36, 37, 37, 37, 37, 254, 0, 0, 255,
+    0, 17, 0, 37, 36, 37, 37, 37, 36, 37, 37, 37, 36, 37, 37, 37, 36, 37, 37, 37, 36, 37, 37, 36, 37, 37, 254, 255, 0, 255,
+    0, 8, 0, 37, 36, 37, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 255, 16, 0, 15, 0, 55, 0, 8, 18,
+    0, 37, 37, 37, 37, 37, 37, 37, 42, 37, 37, 37, 37, 254, 0, 0, 255, 8, 17, 0, 37, 42, 37, 37, 37, 42, 37, 37, 37, 42,
+    37, 37, 37, 42, 37, 37, 37, 42, 37, 37, 42, 37, 37, 254, 0, 1, 255, 8, 8, 0, 37, 42, 37, 37, 42, 37, 42, 37, 42, 37,
+    42, 37, 42, 37, 42, 37, 42, 37, 255, 15, 0, 16, 0, 55, 0, 16, 18, 0, 37, 37, 37, 37, 37, 37, 37, 38, 37, 37, 37, 37,
+    254, 0, 0, 255, 16, 17, 0, 37, 38, 37, 37, 37, 38, 37, 37, 37, 38, 37, 37, 37, 38, 37, 37, 37, 38, 37, 37, 38, 37, 37,
+    254, 1, 0, 255, 16, 8, 0, 37, 38, 37, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 255, 16, 0, 16, 0,
+    55, 0, 24, 18, 0, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 254, 0, 0, 255, 24, 17, 0, 37, 32, 37, 37, 37, 32,
+    37, 37, 37, 32, 37, 37, 37, 32, 37, 37, 37, 32, 37, 37, 32, 37, 37, 254, 0, 255, 255, 24, 8, 0, 37, 32, 37, 37, 32, 37,
+    32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 255, 16, 0, 16, 0, 0, 0, 0, 10, 0, 87, 87, 87, 87, 87, 87, 87, 86,
+    87, 87, 87, 87, 254, 0, 0, 1, 0, 9, 0, 87, 86, 87, 87, 87, 86, 87, 87, 87, 86, 87, 87, 87, 86, 87, 87, 87, 86, 87,
+    87, 86, 87, 87, 254, 255, 0, 1, 0, 4, 0, 87, 86, 87, 87, 86, 87, 86, 87, 86, 87, 86, 87, 86, 87, 86, 87, 86, 87, 255,
+    16, 0, 15, 0, 0, 0, 8, 10, 0, 87, 87, 87, 87, 87, 87, 87, 92, 87, 87, 87, 87, 254, 0, 0, 1, 8, 9, 0, 87, 92,
+    87, 87, 87, 92, 87, 87, 87, 92, 87, 87, 87, 92, 87, 87, 87, 92, 87, 87, 92, 87, 87, 254, 0, 1, 1, 8, 4, 0, 87, 92,
+    87, 87, 92, 87, 92, 87, 92, 87, 92, 87, 92, 87, 92, 87, 92, 87, 255, 15, 0, 16, 0, 0, 0, 16, 10, 0, 87, 87, 87, 87,
+    87, 87, 87, 88, 87, 87, 87, 87, 254, 0, 0, 1, 16, 9, 0, 87, 88, 87, 87, 87, 88, 87, 87, 87, 88, 87, 87, 87, 88, 87,
+    87, 87, 88, 87, 87, 88, 87, 87, 254, 1, 0, 1, 16, 4, 0, 87, 88, 87, 87, 88, 87, 88, 87, 88, 87, 88, 87, 88, 87, 88,
+    87, 88, 87, 255, 16, 0, 16, 0, 0, 0, 24, 10, 0, 87, 87, 87, 87, 87, 87, 87, 82, 87, 87, 87, 87, 254, 0, 0, 1, 24,
+    9, 0, 87, 82, 87, 87, 87, 82, 87, 87, 87, 82, 87, 87, 87, 82, 87, 87, 87, 82, 87, 87, 82, 87, 87, 254, 0, 255, 1, 24,
+    4, 0, 87, 82, 87, 87, 82, 87, 82, 87, 82, 87, 82, 87, 82, 87, 82, 87, 82, 87, 255, 31, 0, 16, 0, 55, 0, 0, 8, 0,
+    37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 37, 36, 37, 254, 255, 0, 255, 0, 17, 0, 37, 37, 36, 37, 37, 36, 37,
+    37, 37, 36, 37, 37, 37, 36, 37, 37, 37, 36, 37, 37, 37, 36, 37, 37, 37, 254, 0, 0, 255, 0, 18, 0, 37, 37, 36, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 255, 16, 0, 0, 0, 55, 0, 8, 8, 0, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37,
+    37, 42, 37, 254, 0, 1, 255, 8, 17, 0, 37, 37, 42, 37, 37, 42, 37, 37, 37, 42, 37, 37, 37, 42, 37, 37, 37, 42, 37, 37,
+    37, 42, 37, 37, 37, 254, 0, 0, 255, 8, 18, 0, 37, 37, 42, 37, 37, 37, 37, 37, 37, 37, 37, 37, 255, 0, 0, 16, 0, 55,
+    0, 16, 8, 0, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 37, 38, 37, 254, 1, 0, 255, 16, 17, 0, 37, 37, 38,
+    37, 37, 38, 37, 37, 37, 38, 37, 37, 37, 38, 37, 37, 37, 38, 37, 37, 37, 38, 37, 37, 37, 254, 0, 0, 255, 16, 18, 0, 37,
+    37, 38, 37, 37, 37, 37, 37, 37, 37, 37, 37, 255, 16, 0, 31, 0, 55, 0, 24, 8, 0, 37, 32, 37, 32, 37, 32, 37, 32, 37,
+    32, 37, 32, 37, 37, 32, 37, 254, 0, 255, 255, 24, 17, 0, 37, 37, 32, 37, 37, 32, 37, 37, 37, 32, 37, 37, 37, 32, 37, 37,
+    37, 32, 37, 37, 37, 32, 37, 37, 37, 254, 0, 0, 255, 24, 18, 0, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 255, 31,
+    0, 16, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 31, 0, 0, 61, 56, 61, 61, 61, 61,
+    56, 61, 61, 61, 61, 56, 61, 61, 61, 61, 56, 61, 61, 254, 255, 0, 0, 30, 0, 0, 56, 61, 61, 61, 56, 61, 61, 56, 61, 61,
+    56, 61, 61, 56, 61, 56, 61, 56, 61, 56, 254, 255, 0, 0, 29, 0, 0, 56, 61, 56, 61, 56, 56, 61, 56, 56, 61, 56, 56, 61,
+    56, 56, 56, 61, 56, 254, 255, 255, 0, 28, 0, 0, 56, 56, 56, 61, 56, 56, 56, 56, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 7, 0, 0, 67, 66, 67, 67, 67, 67, 66, 67, 67, 67, 67, 66, 67,
+    67, 67, 67, 66, 67, 67, 254, 0, 1, 0, 6, 0, 0, 66, 67, 67, 67, 66, 67, 67, 66, 67, 67, 66, 67, 67, 66, 67, 66, 67,
+    66, 67, 66, 254, 0, 1, 0, 5, 0, 0, 66, 67, 66, 67, 66, 66, 67, 66, 66, 67, 66, 66, 67, 66, 66, 66, 67, 66, 254, 255,
+    1, 0, 4, 0, 0, 66, 66, 66, 67, 66, 66, 66, 66, 255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 254, 1, 0, 0, 15, 0, 0, 63, 63, 68, 63, 63, 63, 63, 68, 63, 63, 63, 63, 68, 63, 63, 63, 63, 68, 63, 254,
+    1, 0, 0, 14, 0, 0, 63, 68, 63, 63, 63, 68, 63, 63, 68, 63, 63, 68, 63, 63, 68, 63, 68, 63, 68, 63, 254, 1, 1, 0,
+    13, 0, 0, 63, 68, 63, 68, 63, 68, 68, 63, 68, 68, 63, 68, 68, 63, 68, 68, 68, 63, 254, 1, 1, 0, 12, 0, 0, 68, 68,
+    68, 68, 63, 68, 68, 68, 255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 23,
+    0, 0, 57, 57, 57, 58, 57, 57, 57, 57, 58, 57, 57, 57, 57, 58, 57, 57, 57, 57, 58, 254, 0, 255, 0, 22, 0, 0, 57, 57,
+    58, 57, 57, 57, 58, 57, 57, 58, 57, 57, 58, 57, 57, 58, 57, 58, 57, 58, 254, 0, 255, 0, 21, 0, 0, 58, 57, 58, 57, 58,
+    57, 58, 58, 57, 58, 58, 57, 58, 58, 57, 58, 58, 58, 254, 0, 255, 0, 20, 0, 0, 58, 58, 58, 58, 58, 57, 58, 58, 58, 255,
+    31, 0, 16, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 1, 0, 0, 61, 61, 61, 66, 61,
+    61, 61, 61, 66, 61, 61, 61, 61, 66, 61, 61, 61, 61, 66, 254, 255, 0, 0, 2, 0, 0, 61, 61, 66, 61, 61, 61, 66, 61, 61,
+    66, 61, 61, 66, 61, 61, 66, 61, 66, 61, 66, 254, 255, 0, 0, 3, 0, 0, 66, 61, 66, 61, 66, 61, 66, 66, 61, 66, 66, 61,
+    66, 66, 61, 66, 66, 66, 254, 255, 0, 0, 4, 0, 0, 66, 66, 66, 66, 66, 61, 66, 66, 66, 255, 16, 0, 0, 0, 0, 0, 8,
+    0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 9, 0, 0, 67, 67, 68, 67, 67, 67, 67, 68, 67, 67, 67,
+    67, 68, 67, 67, 67, 67, 68, 67, 254, 0, 1, 0, 10, 0, 0, 67, 68, 67, 67, 67, 68, 67, 67, 68, 67, 67, 68, 67, 67, 68,
+    67, 68, 67, 68, 67, 254, 1, 1, 0, 11, 0, 0, 67, 68, 67, 68, 67, 68, 68, 67, 68, 68, 67, 68, 68, 67, 68, 68, 68, 67,
+    254, 1, 1, 0, 12, 0, 0, 68, 68, 68, 68, 67, 68, 68, 68, 255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 254, 1, 0, 0, 17, 0, 0, 63, 58, 63, 63, 63, 63, 58, 63, 63, 63, 63, 58, 63, 63, 63, 63, 58, 63,
+    63, 254, 1, 0, 0, 18, 0, 0, 58, 63, 63, 63, 58, 63, 63, 58, 63, 63, 58, 63, 63, 58, 63, 58, 63, 58, 63, 58, 254, 1,
+    0, 0, 19, 0, 0, 58, 63, 58, 63, 58, 58, 63, 58, 58, 63, 58, 58, 63, 58, 58, 58, 63, 58, 254, 1, 255, 0, 20, 0, 0,
+    58, 58, 58, 63, 58, 58, 58, 58, 255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255,
+    0, 25, 0, 0, 57, 57, 56, 57, 57, 57, 57, 56, 57, 57, 57, 57, 56, 57, 57, 57, 57, 56, 57, 254, 0, 255, 0, 26, 0, 0,
+    57, 56, 57, 57, 57, 56, 57, 57, 56, 57, 57, 56, 57, 57, 56, 57, 56, 57, 56, 57, 254, 255, 255, 0, 27, 0, 0, 57, 56, 57,
+    56, 57, 56, 56, 57, 56, 56, 57, 56, 56, 57, 56, 56, 56, 57, 254, 255, 255, 0, 28, 0, 0, 56, 56, 56, 56, 57, 56, 56, 56,
+    56, 255, 15, 0, 17, 0, 0, 0, 4, 0, 0, 66, 66, 66, 61, 66, 66, 66, 254, 255, 1, 0, 3, 0, 0, 66, 61, 66, 66, 66,
+    61, 66, 66, 61, 66, 66, 61, 66, 66, 61, 66, 61, 254, 255, 1, 0, 2, 0, 0, 61, 66, 61, 66, 61, 66, 61, 66, 61, 61, 66,
+    61, 61, 66, 61, 61, 66, 61, 61, 254, 255, 0, 0, 1, 0, 0, 66, 61, 61, 61, 66, 61, 61, 61, 61, 66, 61, 61, 61, 61, 66,
+    61, 61, 61, 61, 254, 255, 1, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 16, 0, 0, 0,
+    12, 0, 0, 68, 68, 68, 68, 67, 68, 68, 68, 254, 1, 1, 0, 11, 0, 0, 68, 67, 68, 68, 68, 67, 68, 68, 67, 68, 68, 67,
+    68, 68, 67, 68, 67, 254, 1, 1, 0, 10, 0, 0, 67, 68, 67, 68, 67, 68, 67, 68, 67, 67, 68, 67, 67, 68, 67, 67, 68, 67,
+    67, 254, 0, 1, 0, 9, 0, 0, 68, 67, 67, 67, 68, 67, 67, 67, 67, 68, 67, 67, 67, 67, 68, 67, 67, 67, 67, 254, 1, 1,
+    0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255, 16, 0, 15, 0, 0, 0, 20, 0, 0, 58, 58, 58, 63,
+    58, 58, 58, 254, 1, 255, 0, 19, 0, 0, 58, 63, 58, 58, 58, 63, 58, 58, 63, 58, 58, 63, 58, 58, 63, 58, 63, 254, 1, 255,
+    0, 18, 0, 0, 63, 58, 63, 58, 63, 58, 63, 58, 63, 63, 58, 63, 63, 58, 63, 63, 58, 63, 63, 254, 1, 0, 0, 17, 0, 0,
+    58, 63, 63, 63, 58, 63, 63, 63, 63, 58, 63, 63, 63, 63, 58, 63, 63, 63, 63, 254, 1, 255, 0, 16, 0, 0, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 255, 15, 0, 15, 0, 0, 0, 28, 0, 0, 56, 56, 56, 57, 56, 56, 56, 254, 255, 255, 0,
+    27, 0, 0, 56, 57, 56, 56, 56, 57, 56, 56, 57, 56, 56, 57, 56, 56, 57, 56, 57, 254, 255, 255, 0, 26, 0, 0, 57, 56, 57,
+    56, 57, 56, 57, 56, 57, 57, 56, 57, 57, 56, 57, 57, 56, 57, 57, 254, 0, 255, 0, 25, 0, 0, 56, 57, 57, 57, 56, 57, 57,
+    57, 57, 56, 57, 57, 57, 57, 56, 57, 57, 57, 57, 254, 255, 255, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 255, 15, 0, 17, 0, 0, 0, 4, 0, 0, 66, 66, 66, 67, 66, 66, 66, 254, 255, 1, 0, 5, 0, 0, 66, 67, 66, 66,
+    66, 67, 66, 66, 67, 66, 66, 67, 66, 66, 67, 66, 67, 254, 255, 1, 0, 6, 0, 0, 67, 66, 67, 66, 67, 66, 67, 66, 67, 67,
+    66, 67, 67, 66, 67, 67, 66, 67, 67, 254, 0, 1, 0, 7, 0, 0, 66, 67, 67, 67, 66, 67, 67, 67, 67, 66, 67, 67, 67, 67,
+    66, 67, 67, 67, 67, 254, 255, 1, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255, 16, 0, 16, 0, 0,
+    0, 12, 0, 0, 68, 68, 68, 68, 63, 68, 68, 68, 254, 1, 1, 0, 13, 0, 0, 68, 63, 68, 68, 68, 63, 68, 68, 63, 68, 68,
+    63, 68, 68, 63, 68, 63, 254, 1, 1, 0, 14, 0, 0, 63, 68, 63, 68, 63, 68, 63, 68, 63, 63, 68, 63, 63, 68, 63, 63, 68,
+    63, 63, 254, 1, 0, 0, 15, 0, 0, 68, 63, 63, 63, 68, 63, 63, 63, 63, 68, 63, 63, 63, 63, 68, 63, 63, 63, 63, 254, 1,
+    1, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 255, 16, 0, 15, 0, 0, 0, 20, 0, 0, 58, 58, 58,
+    57, 58, 58, 58, 254, 1, 255, 0, 21, 0, 0, 58, 57, 58, 58, 58, 57, 58, 58, 57, 58, 58, 57, 58, 58, 57, 58, 57, 254, 1,
+    255, 0, 22, 0, 0, 57, 58, 57, 58, 57, 58, 57, 58, 57, 57, 58, 57, 57, 58, 57, 57, 58, 57, 57, 254, 0, 255, 0, 23, 0,
+    0, 58, 57, 57, 57, 58, 57, 57, 57, 57, 58, 57, 57, 57, 57, 58, 57, 57, 57, 57, 254, 1, 255, 0, 24, 0, 0, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 255, 15, 0, 15, 0, 0, 0, 28, 0, 0, 56, 56, 56, 61, 56, 56, 56, 254, 255, 255,
+    0, 29, 0, 0, 56, 61, 56, 56, 56, 61, 56, 56, 61, 56, 56, 61, 56, 56, 61, 56, 61, 254, 255, 255, 0, 30, 0, 0, 61, 56,
+    61, 56, 61, 56, 61, 56, 61, 61, 56, 61, 61, 56, 61, 61, 56, 61, 61, 254, 255, 0, 0, 31, 0, 0, 56, 61, 61, 61, 56, 61,
+    61, 61, 61, 56, 61, 61, 61, 61, 56, 61, 61, 61, 61, 254, 255, 255, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 255, 31, 0, 16, 0, 0, 0, 0, 0, 2, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 31, 0, 2, 61,
+    56, 61, 61, 61, 61, 56, 61, 61, 61, 61, 56, 61, 61, 61, 61, 56, 61, 61, 254, 255, 0, 0, 30, 0, 2, 56, 61, 61, 61, 56,
+    61, 61, 56, 61, 61, 56, 61, 61, 56, 61, 56, 61, 56, 61, 56, 254, 255, 0, 0, 29, 0, 2, 56, 61, 56, 61, 56, 56, 61, 56,
+    56, 61, 56, 56, 61, 56, 56, 56, 61, 56, 254, 255, 255, 0, 28, 0, 2, 56, 56, 56, 61, 56, 56, 56, 56, 255, 16, 0, 0, 0,
+    0, 0, 8, 0, 2, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 7, 0, 2, 67, 66, 67, 67, 67, 67, 66, 67,
+    67, 67, 67, 66, 67, 67, 67, 67, 66, 67, 67, 254, 0, 1, 0, 6, 0, 2, 66, 67, 67, 67, 66, 67, 67, 66, 67, 67, 66, 67,
+    67, 66, 67, 66, 67, 66, 67, 66, 254, 0, 1, 0, 5, 0, 2, 66, 67, 66, 67, 66, 66, 67, 66, 66, 67, 66, 66, 67, 66, 66,
+    66, 67, 66, 254, 255, 1, 0, 4, 0, 2, 66, 66, 66, 67, 66, 66, 66, 66, 255, 0, 0, 16, 0, 0, 0, 16, 0, 2, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 15, 0, 2, 63, 63, 68, 63, 63, 63, 63, 68, 63, 63, 63, 63, 68, 63, 63,
+    63, 63, 68, 63, 254, 1, 0, 0, 14, 0, 2, 63, 68, 63, 63, 63, 68, 63, 63, 68, 63, 63, 68, 63, 63, 68, 63, 68, 63, 68,
+    63, 254, 1, 1, 0, 13, 0, 2, 63, 68, 63, 68, 63, 68, 68, 63, 68, 68, 63, 68, 68, 63, 68, 68, 68, 63, 254, 1, 1, 0,
+    12, 0, 2, 68, 68, 68, 68, 63, 68, 68, 68, 255, 16, 0, 31, 0, 0, 0, 24, 0, 2, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    254, 0, 255, 0, 23, 0, 2, 57, 57, 57, 58, 57, 57, 57, 57, 58, 57, 57, 57, 57, 58, 57, 57, 57, 57, 58, 254, 0, 255, 0,
+    22, 0, 2, 57, 57, 58, 57, 57, 57, 58, 57, 57, 58, 57, 57, 58, 57, 57, 58, 57, 58, 57, 58, 254, 0, 255, 0, 21, 0, 2,
+    58, 57, 58, 57, 58, 57, 58, 58, 57, 58, 58, 57, 58, 58, 57, 58, 58, 58, 254, 0, 255, 0, 20, 0, 2, 58, 58, 58, 58, 58,
+    57, 58, 58, 58, 255, 31, 0, 16, 0, 0, 0, 0, 0, 4, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 1, 0, 4,
+    61, 61, 61, 66, 61, 61, 61, 61, 66, 61, 61, 61, 61, 66, 61, 61, 61, 61, 66, 254, 255, 0, 0, 2, 0, 4, 61, 61, 66, 61,
+    61, 61, 66, 61, 61, 66, 61, 61, 66, 61, 61, 66, 61, 66, 61, 66, 254, 255, 0, 0, 3, 0, 4, 66, 61, 66, 61, 66, 61, 66,
+    66, 61, 66, 66, 61, 66, 66, 61, 66, 66, 66, 254, 255, 0, 0, 4, 0, 4, 66, 66, 66, 66, 66, 61, 66, 66, 66, 255, 16, 0,
+    0, 0, 0, 0, 8, 0, 4, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 9, 0, 4, 67, 67, 68, 67, 67, 67,
+    67, 68, 67, 67, 67, 67, 68, 67, 67, 67, 67, 68, 67, 254, 0, 1, 0, 10, 0, 4, 67, 68, 67, 67, 67, 68, 67, 67, 68, 67,
+    67, 68, 67, 67, 68, 67, 68, 67, 68, 67, 254, 1, 1, 0, 11, 0, 4, 67, 68, 67, 68, 67, 68, 68, 67, 68, 68, 67, 68, 68,
+    67, 68, 68, 68, 67, 254, 1, 1, 0, 12, 0, 4, 68, 68, 68, 68, 67, 68, 68, 68, 255, 0, 0, 16, 0, 0, 0, 16, 0, 4,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 17, 0, 4, 63, 58, 63, 63, 63, 63, 58, 63, 63, 63, 63, 58, 63,
+    63, 63, 63, 58, 63, 63, 254, 1, 0, 0, 18, 0, 4, 58, 63, 63, 63, 58, 63, 63, 58, 63, 63, 58, 63, 63, 58, 63, 58, 63,
+    58, 63, 58, 254, 1, 0, 0, 19, 0, 4, 58, 63, 58, 63, 58, 58, 63, 58, 58, 63, 58, 58, 63, 58, 58, 58, 63, 58, 254, 1,
+    255, 0, 20, 0, 4, 58, 58, 58, 63, 58, 58, 58, 58, 255, 16, 0, 31, 0, 0, 0, 24, 0, 4, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 254, 0, 255, 0, 25, 0, 4, 57, 57, 56, 57, 57, 57, 57, 56, 57, 57, 57, 57, 56, 57, 57, 57, 57, 56, 57, 254, 0,
+    255, 0, 26, 0, 4, 57, 56, 57, 57, 57, 56, 57, 57, 56, 57, 57, 56, 57, 57, 56, 57, 56, 57, 56, 57, 254, 255, 255, 0, 27,
+    0, 4, 57, 56, 57, 56, 57, 56, 56, 57, 56, 56, 57, 56, 56, 57, 56, 56, 56, 57, 254, 255, 255, 0, 28, 0, 4, 56, 56, 56,
+    56, 57, 56, 56, 56, 56, 255, 15, 0, 17, 0, 0, 0, 4, 0, 2, 66, 66, 66, 61, 66, 66, 66, 254, 255, 1, 0, 3, 0, 2,
+    66, 61, 66, 66, 66, 61, 66, 66, 61, 66, 66, 61, 66, 66, 61, 66, 61, 254, 255, 1, 0, 2, 0, 2, 61, 66, 61, 66, 61, 66,
+    61, 66, 61, 61, 66, 61, 61, 66, 61, 61, 66, 61, 61, 254, 255, 0, 0, 1, 0, 2, 66, 61, 61, 61, 66, 61, 61, 61, 61, 66,
+    61, 61, 61, 61, 66, 61, 61, 61, 61, 254, 255, 1, 0, 0, 0, 2, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 16,
+    0, 16, 0, 0, 0, 12, 0, 2, 68, 68, 68, 68, 67, 68, 68, 68, 254, 1, 1, 0, 11, 0, 2, 68, 67, 68, 68, 68, 67, 68,
+    68, 67, 68, 68, 67, 68, 68, 67, 68, 67, 254, 1, 1, 0, 10, 0, 2, 67, 68, 67, 68, 67, 68, 67, 68, 67, 67, 68, 67, 67,
+    68, 67, 67, 68, 67, 67, 254, 0, 1, 0, 9, 0, 2, 68, 67, 67, 67, 68, 67, 67, 67, 67, 68, 67, 67, 67, 67, 68, 67, 67,
+    67, 67, 254, 1, 1, 0, 8, 0, 2, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255, 16, 0, 15, 0, 0, 0, 20, 0,
+    2, 58, 58, 58, 63, 58, 58, 58, 254, 1, 255, 0, 19, 0, 2, 58, 63, 58, 58, 58, 63, 58, 58, 63, 58, 58, 63, 58, 58, 63,
+    58, 63, 254, 1, 255, 0, 18, 0, 2, 63, 58, 63, 58, 63, 58, 63, 58, 63, 63, 58, 63, 63, 58, 63, 63, 58, 63, 63, 254, 1,
+    0, 0, 17, 0, 2, 58, 63, 63, 63, 58, 63, 63, 63, 63, 58, 63, 63, 63, 63, 58, 63, 63, 63, 63, 254, 1, 255, 0, 16, 0,
+    2, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 255, 15, 0, 15, 0, 0, 0, 28, 0, 2, 56, 56, 56, 57, 56, 56,
+    56, 254, 255, 255, 0, 27, 0, 2, 56, 57, 56, 56, 56, 57, 56, 56, 57, 56, 56, 57, 56, 56, 57, 56, 57, 254, 255, 255, 0, 26,
+    0, 2, 57, 56, 57, 56, 57, 56, 57, 56, 57, 57, 56, 57, 57, 56, 57, 57, 56, 57, 57, 254, 0, 255, 0, 25, 0, 2, 56, 57,
+    57, 57, 56, 57, 57, 57, 57, 56, 57, 57, 57, 57, 56, 57, 57, 57, 57, 254, 255, 255, 0, 24, 0, 2, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 255, 15, 0, 17, 0, 0, 0, 4, 0, 4, 66, 66, 66, 67, 66, 66, 66, 254, 255, 1, 0, 5, 0,
+    4, 66, 67, 66, 66, 66, 67, 66, 66, 67, 66, 66, 67, 66, 66, 67, 66, 67, 254, 255, 1, 0, 6, 0, 4, 67, 66, 67, 66, 67,
+    66, 67, 66, 67, 67, 66, 67, 67, 66, 67, 67, 66, 67, 67, 254, 0, 1, 0, 7, 0, 4, 66, 67, 67, 67, 66, 67, 67, 67, 67,
+    66, 67, 67, 67, 67, 66, 67, 67, 67, 67, 254, 255, 1, 0, 8, 0, 4, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255,
+    16, 0, 16, 0, 0, 0, 12, 0, 4, 68, 68, 68, 68, 63, 68, 68, 68, 254, 1, 1, 0, 13, 0, 4, 68, 63, 68, 68, 68, 63,
+    68, 68, 63, 68, 68, 63, 68, 68, 63, 68, 63, 254, 1, 1, 0, 14, 0, 4, 63, 68, 63, 68, 63, 68, 63, 68, 63, 63, 68, 63,
+    63, 68, 63, 63, 68, 63, 63, 254, 1, 0, 0, 15, 0, 4, 68, 63, 63, 63, 68, 63, 63, 63, 63, 68, 63, 63, 63, 63, 68, 63,
+    63, 63, 63, 254, 1, 1, 0, 16, 0, 4, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 255, 16, 0, 15, 0, 0, 0, 20,
+    0, 4, 58, 58, 58, 57, 58, 58, 58, 254, 1, 255, 0, 21, 0, 4, 58, 57, 58, 58, 58, 57, 58, 58, 57, 58, 58, 57, 58, 58,
+    57, 58, 57, 254, 1, 255, 0, 22, 0, 4, 57, 58, 57, 58, 57, 58, 57, 58, 57, 57, 58, 57, 57, 58, 57, 57, 58, 57, 57, 254,
+    0, 255, 0, 23, 0, 4, 58, 57, 57, 57, 58, 57, 57, 57, 57, 58, 57, 57, 57, 57, 58, 57, 57, 57, 57, 254, 1, 255, 0, 24,
+    0, 4, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 255, 15, 0, 15, 0, 0, 0, 28, 0, 4, 56, 56, 56, 61, 56,
+    56, 56, 254, 255, 255, 0, 29, 0, 4, 56, 61, 56, 56, 56, 61, 56, 56, 61, 56, 56, 61, 56, 56, 61, 56, 61, 254, 255, 255, 0,
+    30, 0, 4, 61, 56, 61, 56, 61, 56, 61, 56, 61, 61, 56, 61, 61, 56, 61, 61, 56, 61, 61, 254, 255, 0, 0, 31, 0, 4, 56,
+    61, 61, 61, 56, 61, 61, 61, 61, 56, 61, 61, 61, 61, 56, 61, 61, 61, 61, 254, 255, 255, 0, 0, 0, 4, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 255, 15, 0, 16, 0, 0, 0, 4, 0, 0, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 255, 16, 0, 16, 0, 0, 0, 12, 0, 0, 68,
+    68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+    255, 16, 0, 15, 0, 0, 0, 20, 0, 0, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 255, 15, 0, 15, 0, 0, 0, 28, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 255, 15, 0, 16, 0, 0, 0, 4,
+    51, 0, 91, 66, 91, 66, 91, 66, 91, 66, 91, 66, 91, 66, 91, 66, 91, 66, 91, 66, 91, 66, 91, 66, 91, 66, 91, 66, 91, 66,
+    91, 66, 91, 255, 16, 0, 16, 0, 0, 0, 12, 51, 0, 68, 93, 68, 93, 68, 93, 68, 93, 68, 93, 68, 93, 68, 93, 68, 93, 68,
+    93, 68, 93, 68, 93, 68, 93, 68, 93, 68, 93, 68, 93, 68, 255, 16, 0, 15, 0, 0, 0, 20, 51, 0, 58, 83, 58, 83, 58, 83,
+    58, 83, 58, 83, 58, 83, 58, 83, 58, 83, 58, 83, 58, 83, 58, 83, 58, 83, 58, 83, 58, 83, 58, 83, 58, 255, 15, 0, 15, 0,
+    0, 0, 28, 51, 0, 81, 56, 81, 56, 81, 56, 81, 56, 81, 56, 81, 56, 81, 56, 81, 56, 81, 56, 81, 56, 81, 56, 81, 56, 81,
+    56, 81, 56, 81, 56, 81, 255, 15, 0, 16, 0, 0, 0, 4, 52, 0, 87, 91, 87, 91, 87, 91, 87, 91, 87, 91, 87, 91, 87, 91,
+    87, 91, 87, 91, 87, 91, 87, 91, 87, 91, 87, 91, 87, 91, 87, 91, 87, 91, 87, 91, 87, 91, 87, 91, 87, 91, 87, 91, 87, 91,
+    87, 91, 87, 91, 87, 91, 87, 91, 87, 91, 87, 91, 87, 91, 87, 91, 87, 91, 87, 255, 16, 0, 16, 0, 0, 0, 12, 52, 0, 87,
+    93, 87, 93, 87, 93, 87, 93, 87, 93, 87, 93, 87, 93, 87, 93, 87, 93, 87, 93, 87, 93, 87, 93, 87, 93, 87, 93, 87, 93, 87,
+    93, 87, 93, 87, 93, 87, 93, 87, 93, 87, 93, 87, 93, 87, 93, 87, 93, 87, 93, 87, 93, 87, 93, 87, 93, 87, 93, 87, 93, 87,
+    93, 87, 255, 16, 0, 15, 0, 0, 0, 20, 52, 0, 87, 83, 87, 83, 87, 83, 87, 83, 87, 83, 87, 83, 87, 83, 87, 83, 87, 83,
+    87, 83, 87, 83, 87, 83, 87, 83, 87, 83, 87, 83, 87, 83, 87, 83, 87, 83, 87, 83, 87, 83, 87, 83, 87, 83, 87, 83, 87, 83,
+    87, 83, 87, 83, 87, 83, 87, 83, 87, 83, 87, 83, 87, 83, 87, 255, 15, 0, 15, 0, 0, 0, 28, 52, 0, 87, 81, 87, 81, 87,
+    81, 87, 81, 87, 81, 87, 81, 87, 81, 87, 81, 87, 81, 87, 81, 87, 81, 87, 81, 87, 81, 87, 81, 87, 81, 87, 81, 87, 81, 87,
+    81, 87, 81, 87, 81, 87, 81, 87, 81, 87, 81, 87, 81, 87, 81, 87, 81, 87, 81, 87, 81, 87, 81, 87, 81, 87, 81, 87, 255, 15,
+    0, 16, 0, 0, 0, 4, 0, 0, 66, 66, 66, 66, 66, 66, 66, 254, 255, 1, 0, 4, 50, 0, 66, 91, 66, 66, 66, 66, 66, 91,
+    66, 66, 66, 91, 66, 66, 91, 254, 255, 1, 0, 4, 51, 0, 91, 66, 91, 66, 91, 66, 91, 255, 16, 0, 16, 0, 0, 0, 12, 0,
+    0, 68, 68, 68, 68, 68, 68, 68, 254, 1, 1, 0, 12, 50, 0, 68, 93, 68, 68, 68, 68, 68, 93, 68, 68, 68, 93, 68, 68, 93,
+    254, 1, 1, 0, 12, 51, 0, 68, 93, 68, 93, 68, 93, 68, 255, 16, 0, 15, 0, 0, 0, 20, 0, 0, 58, 58, 58, 58, 58, 58,
+    58, 254, 1, 255, 0, 20, 50, 0, 58, 83, 58, 58, 58, 58, 58, 83, 58, 58, 58, 83, 58, 58, 83, 254, 1, 255, 0, 20, 51, 0,
+    58, 83, 58, 83, 58, 83, 58, 255, 15, 0, 15, 0, 0, 0, 28, 0, 0, 56, 56, 56, 56, 56, 56, 56, 254, 255, 255, 0, 28, 50,
+    0, 56, 81, 56, 56, 56, 56, 56, 81, 56, 56, 56, 81, 56, 56, 81, 254, 255, 255, 0, 28, 51, 0, 81, 56, 81, 56, 81, 56, 81,
+    255, 15, 0, 16, 0, 0, 0, 4, 51, 0, 66, 91, 66, 254, 255, 1, 1, 4, 2, 0, 91, 66, 91, 91, 66, 91, 91, 91, 66, 91,
+    91, 91, 91, 254, 255, 1, 1, 4, 3, 0, 91, 91, 91, 91, 91, 87, 91, 91, 91, 87, 91, 91, 87, 91, 254, 255, 1, 1, 4, 52,
+    0, 87, 91, 87, 255, 16, 0, 16, 0, 0, 0, 12, 51, 0, 68, 93, 68, 254, 1, 1, 1, 12, 2, 0, 93, 68, 93, 93, 68, 93,
+    93, 93, 68, 93, 93, 93, 93, 254, 1, 1, 1, 12, 3, 0, 93, 93, 93, 93, 93, 87, 93, 93, 93, 87, 93, 93, 87, 93, 254, 1,
+    1, 1, 12, 52, 0, 87, 93, 87, 255, 16, 0, 15, 0, 0, 0, 20, 51, 0, 58, 83, 58, 254, 1, 255, 1, 20, 2, 0, 83, 58,
+    83, 83, 58, 83, 83, 83, 58, 83, 83, 83, 83, 254, 1, 255, 1, 20, 3, 0, 83, 83, 83, 83, 83, 87, 83, 83, 83, 87, 83, 83,
+    87, 83, 254, 1, 255, 1, 20, 52, 0, 87, 83, 87, 255, 15, 0, 15, 0, 0, 0, 28, 51, 0, 56, 81, 56, 254, 255, 255, 1, 28,
+    2, 0, 81, 56, 81, 81, 56, 81, 81, 81, 56, 81, 81, 81, 81, 254, 255, 255, 1, 28, 3, 0, 81, 81, 81, 81, 81, 87, 81, 81,
+    81, 87, 81, 81, 87, 81, 254, 255, 255, 1, 28, 52, 0, 87, 81, 87, 255, 15, 0, 16, 0, 0, 0, 4, 52, 0, 254, 0, 0, 1,
+    4, 3, 0, 91, 87, 91, 91, 87, 91, 91, 87, 91, 91, 91, 87, 91, 91, 254, 255, 1, 1, 4, 2, 0, 91, 91, 91, 91, 91, 91,
+    91, 66, 91, 91, 91, 66, 91, 91, 66, 91, 254, 255, 1, 1, 4, 51, 0, 66, 91, 66, 255, 16, 0, 16, 0, 0, 0, 12, 52, 0,
+    254, 0, 0, 1, 12, 3, 0, 93, 87, 93, 93, 87, 93, 93, 87, 93, 93, 93, 87, 93, 93, 254, 1, 1, 1, 12, 2, 0, 93, 93,
+    93, 93, 93, 93, 93, 68, 93, 93, 93, 68, 93, 93, 68, 93, 254, 1, 1, 1, 12, 51, 0, 68, 93, 68, 255, 16, 0, 15, 0, 0,
+    0, 20, 52, 0, 254, 0, 0, 1, 20, 3, 0, 83, 87, 83, 83, 87, 83, 83, 87, 83, 83, 83, 87, 83, 83, 254, 1, 255, 1, 20,
+    2, 0, 83, 83, 83, 83, 83, 83, 83, 58, 83, 83, 83, 58, 83, 83, 58, 83, 254, 1, 255, 1, 20, 51, 0, 58, 83, 58, 255, 15,
+    0, 15, 0, 0, 0, 28, 52, 0, 254, 0, 0, 1, 28, 3, 0, 81, 87, 81, 81, 87, 81, 81, 87, 81, 81, 81, 87, 81, 81, 254,
+    255, 255, 1, 28, 2, 0, 81, 81, 81, 81, 81, 81, 81, 56, 81, 81, 81, 56, 81, 81, 56, 81, 254, 255, 255, 1, 28, 51, 0, 56,
+    81, 56, 255, 15, 0, 16, 0, 0, 0, 4, 51, 0, 91, 66, 91, 66, 91, 66, 66, 254, 255, 1, 1, 4, 50, 0, 66, 66, 91, 66,
+    66, 91, 66, 66, 66, 91, 66, 66, 66, 254, 255, 1, 0, 4, 0, 0, 66, 91, 66, 66, 66, 66, 66, 66, 66, 255, 16, 0, 16, 0,
+    0, 0, 12, 51, 0, 68, 93, 68, 93, 68, 93, 68, 254, 1, 1, 1, 12, 50, 0, 68, 68, 93, 68, 68, 93, 68, 68, 68, 93, 68,
+    68, 68, 254, 1, 1, 0, 12, 0, 0, 68, 93, 68, 68, 68, 68, 68, 68, 68, 255, 16, 0, 15, 0, 0, 0, 20, 51, 0, 58, 83,
+    58, 83, 58, 83, 58, 254, 1, 255, 1, 20, 50, 0, 58, 58, 83, 58, 58, 83, 58, 58, 58, 83, 58, 58, 58, 254, 1, 255, 0, 20,
+    0, 0, 58, 83, 58, 58, 58, 58, 58, 58, 58, 255, 15, 0, 15, 0, 0, 0, 28, 51, 0, 81, 56, 81, 56, 81, 56, 56, 254, 255,
+    255, 1, 28, 50, 0, 56, 56, 81, 56, 56, 81, 56, 56, 56, 81, 56, 56, 56, 254, 255, 255, 0, 28, 0, 0, 56, 81, 56, 56, 56,
+    56, 56, 56, 56, 255, 15, 0, 16, 0, 15, 0, 4, 54, 0, 66, 41, 66, 41, 66, 41, 66, 41, 66, 41, 66, 41, 66, 41, 66, 41,
+    66, 41, 66, 41, 66, 41, 66, 41, 66, 41, 66, 41, 66, 41, 66, 255, 16, 0, 16, 0, 15, 0, 12, 54, 0, 43, 68, 43, 68, 43,
+    68, 43, 68, 43, 68, 43, 68, 43, 68, 43, 68, 43, 68, 43, 68, 43, 68, 43, 68, 43, 68, 43, 68, 43, 68, 43, 255, 16, 0, 15,
+    0, 15, 0, 20, 54, 0, 33, 58, 33, 58, 33, 58, 33, 58, 33, 58, 33, 58, 33, 58, 33, 58, 33, 58, 33, 58, 33, 58, 33, 58,
+    33, 58, 33, 58, 33, 58, 33, 255, 15, 0, 15, 0, 15, 0, 28, 54, 0, 56, 31, 56, 31, 56, 31, 56, 31, 56, 31, 56, 31, 56,
+    31, 56, 31, 56, 31, 56, 31, 56, 31, 56, 31, 56, 31, 56, 31, 56, 31, 56, 255, 15, 0, 16, 0, 63, 0, 4, 55, 0, 37, 41,
+    37, 41, 37, 41, 37, 41, 37, 41, 37, 41, 37, 41, 37, 41, 37, 41, 37, 41, 37, 41, 37, 41, 37, 41, 37, 41, 37, 41, 37, 41,
+    37, 41, 37, 41, 37, 41, 37, 41, 37, 41, 37, 41, 37, 41, 37, 41, 37, 41, 37, 41, 37, 41, 37, 41, 37, 41, 37, 41, 37, 41,
+    37, 255, 16, 0, 16, 0, 63, 0, 12, 55, 0, 37, 43, 37, 43, 37, 43, 37, 43, 37, 43, 37, 43, 37, 43, 37, 43, 37, 43, 37,
+    43, 37, 43, 37, 43, 37, 43, 37, 43, 37, 43, 37, 43, 37, 43, 37, 43, 37, 43, 37, 43, 37, 43, 37, 43, 37, 43, 37, 43, 37,
+    43, 37, 43, 37, 43, 37, 43, 37, 43, 37, 43, 37, 43, 37, 255, 16, 0, 15, 0, 63, 0, 20, 55, 0, 37, 33, 37, 33, 37, 33,
+    37, 33, 37, 33, 37, 33, 37, 33, 37, 33, 37, 33, 37, 33, 37, 33, 37, 33, 37, 33, 37, 33, 37, 33, 37, 33, 37, 33, 37, 33,
+    37, 33, 37, 33, 37, 33, 37, 33, 37, 33, 37, 33, 37, 33, 37, 33, 37, 33, 37, 33, 37, 33, 37, 33, 37, 33, 37, 255, 15, 0,
+    15, 0, 63, 0, 28, 55, 0, 37, 31, 37, 31, 37, 31, 37, 31, 37, 31, 37, 31, 37, 31, 37, 31, 37, 31, 37, 31, 37, 31, 37,
+    31, 37, 31, 37, 31, 37, 31, 37, 31, 37, 31, 37, 31, 37, 31, 37, 31, 37, 31, 37, 31, 37, 31, 37, 31, 37, 31, 37, 31, 37,
+    31, 37, 31, 37, 31, 37, 31, 37, 31, 37, 255, 15, 0, 16, 0, 8, 0, 4, 0, 0, 66, 66, 66, 66, 66, 66, 66, 254, 255, 1,
+    255, 4, 53, 0, 66, 66, 66, 66, 66, 41, 66, 66, 66, 41, 66, 66, 41, 66, 66, 254, 255, 1, 255, 4, 54, 0, 66, 41, 66, 41,
+    66, 41, 66, 255, 16, 0, 16, 0, 8, 0, 12, 0, 0, 68, 68, 68, 68, 68, 68, 68, 254, 1, 1, 255, 12, 53, 0, 68, 68, 68,
+    68, 68, 43, 68, 68, 68, 43, 68, 68, 43, 68, 68, 254, 1, 1, 255, 12, 54, 0, 68, 68, 43, 68, 43, 68, 43, 255, 16, 0, 15,
+    0, 8, 0, 20, 0, 0, 58, 58, 58, 58, 58, 58, 58, 254, 1, 255, 255, 20, 53, 0, 58, 58, 58, 58, 58, 33, 58, 58, 58, 33,
+    58, 58, 33, 58, 58, 254, 1, 255, 255, 20, 54, 0, 58, 58, 33, 58, 33, 58, 33, 255, 15, 0, 15, 0, 8, 0, 28, 0, 0, 56,
+    56, 56, 56, 56, 56, 56, 254, 255, 255, 255, 28, 53, 0, 56, 56, 56, 56, 56, 31, 56, 56, 56, 31, 56, 56, 31, 56, 56, 254, 255,
+    255, 255, 28, 54, 0, 56, 31, 56, 31, 56, 31, 56, 255, 15, 0, 16, 0, 31, 0, 4, 54, 0, 66, 41, 66, 254, 255, 1, 255, 4,
+    6, 0, 41, 66, 41, 41, 66, 41, 41, 41, 66, 41, 41, 41, 41, 41, 16, 41, 254, 255, 1, 255, 4, 7, 0, 41, 41, 37, 41, 41,
+    41, 37, 41, 41, 37, 41, 41, 37, 41, 254, 0, 0, 255, 4, 55, 0, 255, 16, 0, 16, 0, 31, 0, 12, 54, 0, 68, 43, 68, 254,
+    1, 1, 255, 12, 6, 0, 43, 68, 43, 43, 68, 43, 43, 43, 68, 43, 43, 43, 43, 43, 18, 43, 254, 1, 1, 255, 12, 7, 0, 43,
+    43, 37, 43, 43, 43, 37, 43, 43, 37, 43, 43, 37, 43, 254, 0, 0, 255, 12, 55, 0, 255, 16, 0, 15, 0, 31, 0, 20, 54, 0,
+    58, 33, 58, 254, 1, 255, 255, 20, 6, 0, 33, 58, 33, 33, 58, 33, 33, 33, 58, 33, 33, 33, 33, 33, 8, 33, 254, 1, 255, 255,
+    20, 7, 0, 33, 33, 37, 33, 33, 33, 37, 33, 33, 37, 33, 33, 37, 33, 254, 0, 0, 255, 20, 55, 0, 255, 15, 0, 15, 0, 31,
+    0, 28, 54, 0, 56, 31, 56, 254, 255, 255, 255, 28, 6, 0, 31, 56, 31, 31, 56, 31, 31, 31, 56, 31, 31, 31, 31, 31, 6, 31,
+    254, 255, 255, 255, 28, 7, 0, 31, 31, 37, 31, 31, 31, 37, 31, 31, 37, 31, 31, 37, 31, 254, 0, 0, 255, 28, 55, 0, 255, 15,
+    0, 16, 0, 31, 0, 4, 55, 0, 37, 41, 37, 254, 255, 1, 255, 4, 7, 0, 41, 37, 41, 41, 37, 41, 41, 41, 37, 41, 41, 41,
+    41, 41, 254, 254, 2, 255, 4, 6, 0, 41, 41, 41, 41, 66, 41, 41, 41, 66, 41, 41, 66, 41, 254, 255, 1, 255, 4, 54, 0, 66,
+    41, 66, 255, 16, 0, 16, 0, 31, 0, 12, 55, 0, 37, 43, 37, 254, 1, 1, 255, 12, 7, 0, 43, 37, 43, 43, 37, 43, 43, 43,
+    37, 43, 43, 43, 43, 43, 254, 2, 2, 255, 12, 6, 0, 43, 43, 43, 43, 68, 43, 43, 43, 68, 43, 43, 68, 43, 254, 1, 1, 255,
+    12, 54, 0, 68, 43, 68, 255, 16, 0, 15, 0, 31, 0, 20, 55, 0, 37, 33, 37, 254, 1, 255, 255, 20, 7, 0, 33, 37, 33, 33,
+    37, 33, 33, 33, 37, 33, 33, 33, 33, 33, 254, 2, 254, 255, 20, 6, 0, 33, 33, 33, 33, 58, 33, 33, 33, 58, 33, 33, 58, 33,
+    254, 1, 255, 255, 20, 54, 0, 58, 33, 58, 255, 15, 0, 15, 0, 31, 0, 28, 55, 0, 37, 31, 37, 254, 255, 255, 255, 28, 7, 0,
+    31, 37, 31, 31, 37, 31, 31, 31, 37, 31, 31, 31, 31, 31, 254, 254, 254, 255, 28, 6, 0, 31, 31, 31, 31, 56, 31, 31, 31, 56,
+    31, 31, 56, 31, 254, 255, 255, 255, 28, 54, 0, 56, 31, 56, 255, 15, 0, 16, 0, 7, 0, 4, 54, 0, 66, 41, 66, 41, 66, 41,
+    66, 254, 255, 1, 0, 4, 53, 0, 41, 66, 66, 41, 66, 66, 66, 41, 66, 66, 66, 66, 66, 254, 255, 1, 255, 4, 0, 0, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 255, 16, 0, 16, 0, 8, 0, 12, 54, 0, 43, 68, 43, 68, 43, 68, 43, 254, 1, 1, 0, 12, 53,
+    0, 43, 68, 68, 43, 68, 68, 68, 43, 68, 68, 68, 68, 68, 254, 1, 1, 255, 12, 0, 0, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+    255, 16, 0, 15, 0, 8, 0, 20, 54, 0, 33, 58, 33, 58, 33, 58, 33, 254, 1, 255, 0, 20, 53, 0, 33, 58, 58, 33, 58, 58,
+    58, 33, 58, 58, 58, 58, 58, 254, 1, 255, 255, 20, 0, 0, 58, 58, 58, 58, 58, 58, 58, 58, 58, 255, 15, 0, 15, 0, 7, 0,
+    28, 54, 0, 56, 31, 56, 31, 56, 31, 56, 254, 255, 255, 0, 28, 53, 0, 31, 56, 56, 31, 56, 56, 56, 31, 56, 56, 56, 56, 56,
+    254, 255, 255, 255, 28, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56, 56, 255, 15, 0, 16, 0, 0, 0, 4, 0, 0, 66, 66, 66, 91,
+    254, 255, 1, 0, 4, 50, 0, 66, 91, 66, 66, 91, 66, 91, 254, 255, 1, 0, 4, 51, 0, 91, 66, 91, 66, 91, 91, 66, 91, 254,
+    255, 1, 1, 4, 3, 0, 91, 91, 91, 91, 91, 87, 254, 255, 1, 1, 4, 52, 0, 91, 87, 91, 87, 91, 87, 255, 16, 0, 16, 0,
+    0, 0, 12, 0, 0, 68, 68, 68, 93, 254, 1, 1, 0, 12, 50, 0, 68, 93, 68, 68, 93, 68, 93, 254, 1, 1, 0, 12, 51, 0,
+    93, 68, 93, 68, 93, 93, 68, 93, 254, 1, 1, 1, 12, 3, 0, 93, 93, 93, 93, 93, 87, 254, 1, 1, 1, 12, 52, 0, 93, 87,
+    93, 87, 93, 87, 255, 16, 0, 15, 0, 0, 0, 20, 0, 0, 58, 58, 58, 83, 254, 1, 255, 0, 20, 50, 0, 58, 83, 58, 58, 83,
+    58, 83, 254, 1, 255, 0, 20, 51, 0, 83, 58, 83, 58, 83, 83, 58, 83, 254, 1, 255, 1, 20, 3, 0, 83, 83, 83, 83, 83, 87,
+    254, 1, 255, 1, 20, 52, 0, 83, 87, 83, 87, 83, 87, 255, 15, 0, 15, 0, 0, 0, 28, 0, 0, 56, 56, 56, 81, 254, 255, 255,
+    0, 28, 50, 0, 56, 81, 56, 56, 81, 56, 81, 254, 255, 255, 0, 28, 51, 0, 81, 56, 81, 56, 81, 81, 56, 81, 254, 255, 255, 1,
+    28, 3, 0, 81, 81, 81, 81, 81, 87, 254, 255, 255, 1, 28, 52, 0, 81, 87, 81, 87, 81, 87, 255, 15, 0, 16, 0, 0, 0, 4,
+    52, 0, 87, 91, 87, 91, 87, 91, 254, 255, 1, 1, 4, 3, 0, 87, 91, 91, 91, 91, 91, 254, 255, 1, 1, 4, 51, 0, 91, 66,
+    91, 91, 66, 91, 66, 91, 254, 255, 1, 0, 4, 50, 0, 91, 66, 91, 66, 66, 91, 66, 254, 255, 1, 0, 4, 0, 0, 91, 66, 66,
+    66, 255, 16, 0, 16, 0, 0, 0, 12, 52, 0, 87, 93, 87, 93, 87, 93, 254, 1, 1, 1, 12, 3, 0, 87, 93, 93, 93, 93, 93,
+    254, 1, 1, 1, 12, 51, 0, 93, 68, 93, 93, 68, 93, 68, 93, 254, 1, 1, 0, 12, 50, 0, 93, 68, 93, 68, 68, 93, 68, 254,
+    1, 1, 0, 12, 0, 0, 93, 68, 68, 68, 255, 16, 0, 15, 0, 0, 0, 20, 52, 0, 87, 83, 87, 83, 87, 83, 254, 1, 255, 1,
+    20, 3, 0, 87, 83, 83, 83, 83, 83, 254, 1, 255, 1, 20, 51, 0, 83, 58, 83, 83, 58, 83, 58, 83, 254, 1, 255, 0, 20, 50,
+    0, 83, 58, 83, 58, 58, 83, 58, 254, 1, 255, 0, 20, 0, 0, 83, 58, 58, 58, 255, 15, 0, 15, 0, 0, 0, 28, 52, 0, 87,
+    81, 87, 81, 87, 81, 254, 255, 255, 1, 28, 3, 0, 87, 81, 81, 81, 81, 81, 254, 255, 255, 1, 28, 51, 0, 81, 56, 81, 81, 56,
+    81, 56, 81, 254, 255, 255, 0, 28, 50, 0, 81, 56, 81, 56, 56, 81, 56, 254, 255, 255, 0, 28, 0, 0, 81, 56, 56, 56, 255, 15,
+    0, 16, 0, 23, 0, 4, 0, 0, 66, 66, 66, 41, 254, 255, 1, 0, 4, 53, 0, 66, 41, 66, 66, 41, 66, 41, 254, 255, 1, 0,
+    4, 54, 0, 41, 66, 41, 66, 41, 41, 66, 41, 254, 255, 1, 255, 4, 7, 0, 41, 41, 41, 41, 41, 37, 254, 255, 1, 255, 4, 55,
+    0, 41, 37, 41, 37, 41, 37, 255, 16, 0, 16, 0, 23, 0, 12, 0, 0, 68, 68, 68, 43, 254, 1, 1, 0, 12, 53, 0, 68, 43,
+    68, 68, 43, 68, 43, 254, 1, 1, 0, 12, 54, 0, 43, 68, 43, 68, 43, 43, 68, 43, 254, 1, 1, 255, 12, 7, 0, 43, 43, 43,
+    43, 43, 37, 254, 1, 1, 255, 12, 55, 0, 43, 37, 43, 37, 43, 37, 255, 16, 0, 15, 0, 23, 0, 20, 0, 0, 58, 58, 58, 33,
+    254, 1, 255, 0, 20, 53, 0, 58, 33, 58, 58, 33, 58, 33, 254, 1, 255, 0, 20, 54, 0, 33, 58, 33, 58, 33, 33, 58, 33, 254,
+    1, 255, 255, 20, 7, 0, 33, 33, 33, 33, 33, 37, 254, 1, 255, 255, 20, 55, 0, 33, 37, 33, 37, 33, 37, 255, 15, 0, 15, 0,
+    23, 0, 28, 0, 0, 56, 56, 56, 31, 254, 255, 255, 0, 28, 53, 0, 56, 31, 56, 56, 31, 56, 31, 254, 255, 255, 0, 28, 54, 0,
+    31, 56, 31, 56, 31, 31, 56, 31, 254, 255, 255, 255, 28, 7, 0, 31, 31, 31, 31, 31, 37, 254, 255, 255, 255, 28, 55, 0, 31, 37,
+    31, 37, 31, 37, 255, 15, 0, 16, 0, 23, 0, 4, 55, 0, 37, 41, 37, 41, 37, 41, 254, 255, 1, 255, 4, 7, 0, 37, 41, 41,
+    41, 41, 41, 254, 255, 1, 255, 4, 54, 0, 41, 66, 41, 41, 66, 41, 66, 41, 254, 255, 1, 0, 4, 53, 0, 41, 66, 41, 66, 66,
+    41, 66, 254, 255, 1, 0, 4, 0, 0, 41, 66, 66, 66, 255, 16, 0, 16, 0, 23, 0, 12, 55, 0, 37, 43, 37, 43, 37, 43, 254,
+    1, 1, 255, 12, 7, 0, 37, 43, 43, 43, 43, 43, 254, 1, 1, 255, 12, 54, 0, 43, 68, 43, 43, 68, 43, 68, 43, 254, 1, 1,
+    0, 12, 53, 0, 43, 68, 43, 68, 68, 43, 68, 254, 1, 1, 0, 12, 0, 0, 43, 68, 68, 68, 255, 16, 0, 15, 0, 23, 0, 20,
+    55, 0, 37, 33, 37, 33, 37, 33, 254, 1, 255, 255, 20, 7, 0, 37, 33, 33, 33, 33, 33, 254, 1, 255, 255, 20, 54, 0, 33, 58,
+    33, 33, 58, 33, 58, 33, 254, 1, 255, 0, 20, 53, 0, 33, 58, 33, 58, 58, 33, 58, 254, 1, 255, 0, 20, 0, 0, 33, 58, 58,
+    58, 255, 15, 0, 15, 0, 23, 0, 28, 55, 0, 37, 31, 37, 31, 37, 31, 254, 255, 255, 255, 28, 7, 0, 37, 31, 31, 31, 31, 31,
+    254, 255, 255, 255, 28, 54, 0, 31, 56, 31, 31, 56, 31, 56, 31, 254, 255, 255, 0, 28, 53, 0, 31, 56, 31, 56, 56, 31, 56, 254,
+    255, 255, 0, 28, 0, 0, 31, 56, 56, 56, 255, 15, 0, 16, 0, 0, 0, 4, 0, 0, 66, 66, 66, 66, 66, 66, 66, 254, 255, 1,
+    0, 4, 0, 1, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 254, 255, 1, 0, 4, 0, 2, 66, 66, 66, 66,
+    66, 66, 66, 255, 16, 0, 16, 0, 0, 0, 12, 0, 0, 68, 68, 68, 68, 68, 68, 68, 254, 1, 1, 0, 12, 0, 1, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 254, 1, 1, 0, 12, 0, 2, 68, 68, 68, 68, 68, 68, 68, 255, 16, 0, 15,
+    0, 0, 0, 20, 0, 0, 58, 58, 58, 58, 58, 58, 58, 254, 1, 255, 0, 20, 0, 1, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 254, 1, 255, 0, 20, 0, 2, 58, 58, 58, 58, 58, 58, 58, 255, 15, 0, 15, 0, 0, 0, 28, 0, 0, 56,
+    56, 56, 56, 56, 56, 56, 254, 255, 255, 0, 28, 0, 1, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 254, 255,
+    255, 0, 28, 0, 2, 56, 56, 56, 56, 56, 56, 56, 255, 15, 0, 16, 0, 0, 0, 4, 0, 0, 66, 66, 66, 66, 66, 66, 66, 254,
+    255, 1, 0, 4, 0, 3, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 254, 255, 1, 0, 4, 0, 4, 66, 66,
+    66, 66, 66, 66, 66, 255, 16, 0, 16, 0, 0, 0, 12, 0, 0, 68, 68, 68, 68, 68, 68, 68, 254, 1, 1, 0, 12, 0, 3, 68,
+    68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 254, 1, 1, 0, 12, 0, 4, 68, 68, 68, 68, 68, 68, 68, 255, 16,
+    0, 15, 0, 0, 0, 20, 0, 0, 58, 58, 58, 58, 58, 58, 58, 254, 1, 255, 0, 20, 0, 3, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 254, 1, 255, 0, 20, 0, 4, 58, 58, 58, 58, 58, 58, 58, 255, 15, 0, 15, 0, 0, 0, 28, 0,
+    0, 56, 56, 56, 56, 56, 56, 56, 254, 255, 255, 0, 28, 0, 3, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    254, 255, 255, 0, 28, 0, 4, 56, 56, 56, 56, 56, 56, 56, 255, 15, 0, 16, 0, 0, 0, 4, 0, 2, 66, 66, 66, 66, 66, 66,
+    66, 254, 255, 1, 0, 4, 0, 1, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 254, 255, 1, 0, 4, 0, 0,
+    66, 66, 66, 66, 66, 66, 66, 255, 16, 0, 16, 0, 0, 0, 12, 0, 2, 68, 68, 68, 68, 68, 68, 68, 254, 1, 1, 0, 12, 0,
+    1, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 254, 1, 1, 0, 12, 0, 0, 68, 68, 68, 68, 68, 68, 68,
+    255, 16, 0, 15, 0, 0, 0, 20, 0, 2, 58, 58, 58, 58, 58, 58, 58, 254, 1, 255, 0, 20, 0, 1, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 254, 1, 255, 0, 20, 0, 0, 58, 58, 58, 58, 58, 58, 58, 255, 15, 0, 15, 0, 0, 0,
+    28, 0, 2, 56, 56, 56, 56, 56, 56, 56, 254, 255, 255, 0, 28, 0, 1, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 254, 255, 255, 0, 28, 0, 0, 56, 56, 56, 56, 56, 56, 56, 255, 15, 0, 16, 0, 0, 0, 4, 0, 4, 66, 66, 66, 66,
+    66, 66, 66, 254, 255, 1, 0, 4, 0, 3, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 254, 255, 1, 0, 4,
+    0, 0, 66, 66, 66, 66, 66, 66, 66, 255, 16, 0, 16, 0, 0, 0, 12, 0, 4, 68, 68, 68, 68, 68, 68, 68, 254, 1, 1, 0,
+    12, 0, 3, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 254, 1, 1, 0, 12, 0, 0, 68, 68, 68, 68, 68,
+    68, 68, 255, 16, 0, 15, 0, 0, 0, 20, 0, 4, 58, 58, 58, 58, 58, 58, 58, 254, 1, 255, 0, 20, 0, 3, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 254, 1, 255, 0, 20, 0, 0, 58, 58, 58, 58, 58, 58, 58, 255, 15, 0, 15, 0,
+    0, 0, 28, 0, 4, 56, 56, 56, 56, 56, 56, 56, 254, 255, 255, 0, 28, 0, 3, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 254, 255, 255, 0, 28, 0, 0, 56, 56, 56, 56, 56, 56, 56, 255, 15, 0, 16, 0, 0, 0, 4, 0, 2, 66, 66,
+    66, 66, 66, 66, 66, 254, 255, 1, 0, 4, 50, 1, 66, 91, 66, 66, 66, 66, 66, 91, 66, 66, 66, 91, 66, 66, 91, 254, 255, 1,
+    0, 4, 51, 0, 66, 91, 66, 91, 66, 91, 66, 255, 16, 0, 16, 0, 0, 0, 12, 0, 2, 68, 68, 68, 68, 68, 68, 68, 254, 1,
+    1, 0, 12, 50, 1, 68, 93, 68, 68, 68, 68, 68, 93, 68, 68, 68, 93, 68, 68, 93, 254, 1, 1, 0, 12, 51, 0, 68, 93, 68,
+    93, 68, 93, 68, 255, 16, 0, 15, 0, 0, 0, 20, 0, 2, 58, 58, 58, 58, 58, 58, 58, 254, 1, 255, 0, 20, 50, 1, 58, 83,
+    58, 58, 58, 58, 58, 83, 58, 58, 58, 83, 58, 58, 83, 254, 1, 255, 0, 20, 51, 0, 58, 83, 58, 83, 58, 83, 58, 255, 15, 0,
+    15, 0, 0, 0, 28, 0, 2, 56, 56, 56, 56, 56, 56, 56, 254, 255, 255, 0, 28, 50, 1, 56, 81, 56, 56, 56, 56, 56, 81, 56,
+    56, 56, 81, 56, 56, 81, 254, 255, 255, 0, 28, 51, 0, 56, 81, 56, 81, 56, 81, 56, 255, 15, 0, 16, 0, 0, 0, 4, 0, 4,
+    66, 66, 66, 66, 66, 66, 66, 254, 255, 1, 0, 4, 50, 3, 66, 91, 66, 66, 66, 66, 66, 91, 66, 66, 66, 91, 66, 66, 91, 254,
+    255, 1, 0, 4, 51, 0, 66, 91, 66, 91, 66, 91, 66, 255, 16, 0, 16, 0, 0, 0, 12, 0, 4, 68, 68, 68, 68, 68, 68, 68,
+    254, 1, 1, 0, 12, 50, 3, 68, 93, 68, 68, 68, 68, 68, 93, 68, 68, 68, 93, 68, 68, 93, 254, 1, 1, 0, 12, 51, 0, 68,
+    93, 68, 93, 68, 93, 68, 255, 16, 0, 15, 0, 0, 0, 20, 0, 4, 58, 58, 58, 58, 58, 58, 58, 254, 1, 255, 0, 20, 50, 3,
+    58, 83, 58, 58, 58, 58, 58, 83, 58, 58, 58, 83, 58, 58, 83, 254, 1, 255, 0, 20, 51, 0, 58, 83, 58, 83, 58, 83, 58, 255,
+    15, 0, 15, 0, 0, 0, 28, 0, 4, 56, 56, 56, 56, 56, 56, 56, 254, 255, 255, 0, 28, 50, 3, 56, 81, 56, 56, 56, 56, 56,
+    81, 56, 56, 56, 81, 56, 56, 81, 254, 255, 255, 0, 28, 51, 0, 56, 81, 56, 81, 56, 81, 56, 255, 15, 0, 16, 0, 0, 0, 4,
+    51, 0, 66, 91, 66, 91, 66, 91, 66, 254, 255, 1, 1, 4, 50, 1, 66, 66, 91, 66, 66, 91, 66, 66, 66, 91, 66, 66, 66, 254,
+    255, 1, 0, 4, 0, 2, 66, 91, 66, 66, 66, 66, 66, 66, 66, 255, 16, 0, 16, 0, 0, 0, 12, 51, 0, 68, 93, 68, 93, 68,
+    93, 68, 254, 1, 1, 1, 12, 50, 1, 68, 68, 93, 68, 68, 93, 68, 68, 68, 93, 68, 68, 68, 254, 1, 1, 0, 12, 0, 2, 68,
+    93, 68, 68, 68, 68, 68, 68, 68, 255, 16, 0, 15, 0, 0, 0, 20, 51, 0, 58, 83, 58, 83, 58, 83, 58, 254, 1, 255, 1, 20,
+    50, 1, 58, 58, 83, 58, 58, 83, 58, 58, 58, 83, 58, 58, 58, 254, 1, 255, 0, 20, 0, 2, 58, 83, 58, 58, 58, 58, 58, 58,
+    58, 255, 15, 0, 15, 0, 0, 0, 28, 51, 0, 56, 81, 56, 81, 56, 81, 56, 254, 255, 255, 1, 28, 50, 1, 56, 56, 81, 56, 56,
+    81, 56, 56, 56, 81, 56, 56, 56, 254, 255, 255, 0, 28, 0, 2, 56, 81, 56, 56, 56, 56, 56, 56, 56, 255, 15, 0, 16, 0, 0,
+    0, 4, 51, 0, 66, 91, 66, 91, 66, 91, 66, 254, 255, 1, 1, 4, 50, 3, 66, 66, 91, 66, 66, 91, 66, 66, 66, 91, 66, 66,
+    66, 254, 255, 1, 0, 4, 0, 4, 66, 91, 66, 66, 66, 66, 66, 66, 66, 255, 16, 0, 16, 0, 0, 0, 12, 51, 0, 68, 93, 68,
+    93, 68, 93, 68, 254, 1, 1, 1, 12, 50, 3, 68, 68, 93, 68, 68, 93, 68, 68, 68, 93, 68, 68, 68, 254, 1, 1, 0, 12, 0,
+    4, 68, 93, 68, 68, 68, 68, 68, 68, 68, 255, 16, 0, 15, 0, 0, 0, 20, 51, 0, 58, 83, 58, 83, 58, 83, 58, 254, 1, 255,
+    1, 20, 50, 3, 58, 58, 83, 58, 58, 83, 58, 58, 58, 83, 58, 58, 58, 254, 1, 255, 0, 20, 0, 4, 58, 83, 58, 58, 58, 58,
+    58, 58, 58, 255, 15, 0, 15, 0, 0, 0, 28, 51, 0, 56, 81, 56, 81, 56, 81, 56, 254, 255, 255, 1, 28, 50, 3, 56, 56, 81,
+    56, 56, 81, 56, 56, 56, 81, 56, 56, 56, 254, 255, 255, 0, 28, 0, 4, 56, 81, 56, 56, 56, 56, 56, 56, 56, 255, 15, 0, 16,
+    0, 8, 0, 4, 0, 2, 66, 66, 66, 66, 66, 66, 66, 254, 255, 1, 255, 4, 53, 1, 66, 66, 66, 66, 66, 41, 66, 66, 66, 41,
+    66, 66, 41, 66, 66, 254, 255, 1, 255, 4, 54, 0, 66, 41, 66, 41, 66, 41, 66, 255, 16, 0, 16, 0, 8, 0, 12, 0, 2, 68,
+    68, 68, 68, 68, 68, 68, 254, 1, 1, 255, 12, 53, 1, 68, 68, 68, 68, 68, 43, 68, 68, 68, 43, 68, 68, 43, 68, 68, 254, 1,
+    1, 255, 12, 54, 0, 68, 43, 68, 43, 68, 43, 68, 255, 16, 0, 15, 0, 8, 0, 20, 0, 2, 58, 58, 58, 58, 58, 58, 58, 254,
+    1, 255, 255, 20, 53, 1, 58, 58, 58, 58, 58, 33, 58, 58, 58, 33, 58, 58, 33, 58, 58, 254, 1, 255, 255, 20, 54, 0, 58, 33,
+    58, 33, 58, 33, 58, 255, 15, 0, 15, 0, 8, 0, 28, 0, 2, 56, 56, 56, 56, 56, 56, 56, 254, 255, 255, 255, 28, 53, 1, 56,
+    56, 56, 56, 56, 31, 56, 56, 56, 31, 56, 56, 31, 56, 56, 254, 255, 255, 255, 28, 54, 0, 56, 31, 56, 31, 56, 31, 56, 255, 15,
+    0, 16, 0, 8, 0, 4, 0, 4, 66, 66, 66, 66, 66, 66, 66, 254, 255, 1, 255, 4, 53, 3, 66, 66, 66, 66, 66, 41, 66, 66,
+    66, 41, 66, 66, 41, 66, 66, 254, 255, 1, 255, 4, 54, 0, 66, 41, 66, 41, 66, 41, 66, 255, 16, 0, 16, 0, 8, 0, 12, 0,
+    4, 68, 68, 68, 68, 68, 68, 68, 254, 1, 1, 255, 12, 53, 3, 68, 68, 68, 68, 68, 43, 68, 68, 68, 43, 68, 68, 43, 68, 68,
+    254, 1, 1, 255, 12, 54, 0, 68, 43, 68, 43, 68, 43, 68, 255, 16, 0, 15, 0, 8, 0, 20, 0, 4, 58, 58, 58, 58, 58, 58,
+    58, 254, 1, 255, 255, 20, 53, 3, 58, 58, 58, 58, 58, 33, 58, 58, 58, 33, 58, 58, 33, 58, 58, 254, 1, 255, 255, 20, 54, 0,
+    58, 33, 58, 33, 58, 33, 58, 255, 15, 0, 15, 0, 8, 0, 28, 0, 4, 56, 56, 56, 56, 56, 56, 56, 254, 255, 255, 255, 28, 53,
+    3, 56, 56, 56, 56, 56, 31, 56, 56, 56, 31, 56, 56, 31, 56, 56, 254, 255, 255, 255, 28, 54, 0, 56, 31, 56, 31, 56, 31, 56,
+    255, 15, 0, 16, 0, 7, 0, 4, 54, 0, 66, 41, 66, 41, 66, 41, 66, 254, 255, 1, 0, 4, 53, 1, 41, 66, 66, 41, 66, 66,
+    66, 41, 66, 66, 66, 66, 66, 254, 255, 1, 255, 4, 0, 2, 66, 66, 66, 66, 66, 66, 66, 66, 66, 255, 16, 0, 16, 0, 7, 0,
+    12, 54, 0, 68, 43, 68, 43, 68, 43, 68, 254, 1, 1, 0, 12, 53, 1, 43, 68, 68, 43, 68, 68, 68, 43, 68, 68, 68, 68, 68,
+    254, 1, 1, 255, 12, 0, 2, 68, 68, 68, 68, 68, 68, 68, 68, 68, 255, 16, 0, 15, 0, 7, 0, 20, 54, 0, 58, 33, 58, 33,
+    58, 33, 58, 254, 1, 255, 0, 20, 53, 1, 33, 58, 58, 33, 58, 58, 58, 33, 58, 58, 58, 58, 58, 254, 1, 255, 255, 20, 0, 2,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 255, 15, 0, 15, 0, 7, 0, 28, 54, 0, 56, 31, 56, 31, 56, 31, 56, 254, 255, 255, 0,
+    28, 53, 1, 31, 56, 56, 31, 56, 56, 56, 31, 56, 56, 56, 56, 56, 254, 255, 255, 255, 28, 0, 2, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 255, 15, 0, 16, 0, 7, 0, 4, 54, 0, 66, 41, 66, 41, 66, 41, 66, 254, 255, 1, 0, 4, 53, 3, 41, 66, 66, 41,
+    66, 66, 66, 41, 66, 66, 66, 66, 66, 254, 255, 1, 255, 4, 0, 4, 66, 66, 66, 66, 66, 66, 66, 66, 66, 255, 16, 0, 16, 0,
+    7, 0, 12, 54, 0, 68, 43, 68, 43, 68, 43, 68, 254, 1, 1, 0, 12, 53, 3, 43, 68, 68, 43, 68, 68, 68, 43, 68, 68, 68,
+    68, 68, 254, 1, 1, 255, 12, 0, 4, 68, 68, 68, 68, 68, 68, 68, 68, 68, 255, 16, 0, 15, 0, 7, 0, 20, 54, 0, 58, 33,
+    58, 33, 58, 33, 58, 254, 1, 255, 0, 20, 53, 3, 33, 58, 58, 33, 58, 58, 58, 33, 58, 58, 58, 58, 58, 254, 1, 255, 255, 20,
+    0, 4, 58, 58, 58, 58, 58, 58, 58, 58, 58, 255, 15, 0, 15, 0, 7, 0, 28, 54, 0, 56, 31, 56, 31, 56, 31, 56, 254, 255,
+    255, 0, 28, 53, 3, 31, 56, 56, 31, 56, 56, 56, 31, 56, 56, 56, 56, 56, 254, 255, 255, 255, 28, 0, 4, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 255, 15, 0, 16, 0, 0, 0, 4, 0, 2, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 255, 16, 0, 16, 0, 0, 0, 12, 0, 2, 68, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 255, 16, 0, 15,
+    0, 0, 0, 20, 0, 2, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 255, 15, 0, 15, 0, 0, 0, 28, 0, 2, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 255, 15, 0, 16, 0, 0, 0, 4, 0, 4, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 255,
+    16, 0, 16, 0, 0, 0, 12, 0, 4, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 255, 16, 0, 15, 0, 0, 0, 20, 0, 4, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 255, 15, 0, 15, 0, 0, 0, 28, 0,
+    4, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+    56, 56, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 0,
+    1, 0, 1, 0, 0, 254, 0, 255, 0, 2, 0, 0, 254, 0, 1, 0, 3, 0, 0, 254, 0, 255, 0, 4, 0, 0, 254, 0, 1, 0,
+    5, 0, 0, 254, 0, 255, 0, 6, 0, 0, 254, 0, 1, 0, 7, 0, 0, 254, 0, 255, 0, 8, 0, 0, 254, 0, 1, 0, 9, 0,
+    0, 254, 0, 255, 0, 10, 0, 0, 254, 0, 1, 0, 11, 0, 0, 254, 0, 255, 0, 12, 0, 0, 254, 0, 1, 0, 13, 0, 0, 254,
+    0, 255, 0, 14, 0, 0, 254, 0, 1, 0, 15, 0, 0, 254, 0, 255, 0, 16, 0, 0, 254, 0, 0, 0, 0, 0, 0, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 66, 254, 0, 1, 0, 9, 0, 0, 254, 0, 255, 0, 10, 0, 0, 254, 0, 1, 0, 11, 0, 0, 254,
+    0, 255, 0, 12, 0, 0, 254, 0, 1, 0, 13, 0, 0, 254, 0, 255, 0, 14, 0, 0, 254, 0, 1, 0, 15, 0, 0, 254, 0, 255,
+    0, 16, 0, 0, 254, 0, 1, 0, 17, 0, 0, 254, 0, 255, 0, 18, 0, 0, 254, 0, 1, 0, 19, 0, 0, 254, 0, 255, 0, 20,
+    0, 0, 254, 0, 1, 0, 21, 0, 0, 254, 0, 255, 0, 22, 0, 0, 254, 0, 1, 0, 23, 0, 0, 254, 0, 255, 0, 24, 0, 0,
+    254, 1, 0, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 0, 0, 16,
+    0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 62, 254, 0, 1, 0, 17, 0, 0, 254, 0, 255, 0, 18,
+    0, 0, 254, 0, 1, 0, 19, 0, 0, 254, 0, 255, 0, 20, 0, 0, 254, 0, 1, 0, 21, 0, 0, 254, 0, 255, 0, 22, 0, 0,
+    254, 0, 1, 0, 23, 0, 0, 254, 0, 255, 0, 24, 0, 0, 254, 0, 1, 0, 25, 0, 0, 254, 0, 255, 0, 26, 0, 0, 254, 0,
+    1, 0, 27, 0, 0, 254, 0, 255, 0, 28, 0, 0, 254, 0, 1, 0, 29, 0, 0, 254, 0, 255, 0, 30, 0, 0, 254, 0, 1, 0,
+    31, 0, 0, 254, 0, 255, 0, 0, 0, 0, 254, 1, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 61, 254, 0,
+    1, 0, 25, 0, 0, 254, 0, 255, 0, 26, 0, 0, 254, 0, 1, 0, 27, 0, 0, 254, 0, 255, 0, 28, 0, 0, 254, 0, 1, 0,
+    29, 0, 0, 254, 0, 255, 0, 30, 0, 0, 254, 0, 1, 0, 31, 0, 0, 254, 0, 255, 0, 0, 0, 0, 254, 0, 1, 0, 1, 0,
+    0, 254, 0, 255, 0, 2, 0, 0, 254, 0, 1, 0, 3, 0, 0, 254, 0, 255, 0, 4, 0, 0, 254, 0, 1, 0, 5, 0, 0, 254,
+    0, 255, 0, 6, 0, 0, 254, 0, 1, 0, 7, 0, 0, 254, 0, 255, 0, 8, 0, 0, 254, 1, 255, 0, 24, 0, 0, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 255, 31, 0, 16, 0, 1, 0, 0, 45, 0, 61, 61, 66, 61, 61, 254, 255, 0,
+    0, 0, 45, 1, 66, 61, 61, 61, 86, 66, 61, 61, 61, 61, 66, 254, 255, 0, 0, 0, 45, 2, 61, 86, 61, 66, 61, 61, 86, 61,
+    61, 66, 61, 254, 255, 0, 1, 0, 45, 5, 61, 61, 61, 61, 86, 61, 66, 61, 86, 61, 61, 254, 255, 0, 0, 0, 45, 6, 86, 61,
+    61, 61, 61, 61, 61, 86, 61, 61, 61, 254, 255, 0, 1, 0, 45, 7, 61, 61, 61, 86, 61, 56, 61, 86, 61, 61, 61, 254, 255, 0,
+    0, 0, 45, 8, 86, 61, 56, 61, 61, 86, 61, 61, 56, 61, 86, 254, 255, 0, 0, 0, 45, 9, 61, 56, 61, 61, 61, 61, 56, 86,
+    61, 61, 61, 254, 255, 255, 0, 16, 16, 0, 61, 61, 61, 56, 61, 255, 16, 0, 0, 0, 1, 0, 8, 45, 0, 67, 67, 68, 67, 67,
+    254, 0, 1, 0, 8, 45, 1, 68, 67, 67, 67, 92, 68, 67, 67, 67, 67, 68, 254, 0, 1, 0, 8, 45, 2, 67, 92, 67, 68, 67,
+    67, 92, 67, 67, 68, 67, 254, 0, 1, 1, 8, 45, 5, 67, 67, 67, 67, 92, 67, 68, 67, 92, 67, 67, 254, 0, 1, 0, 8, 45,
+    6, 92, 67, 67, 67, 67, 67, 67, 92, 67, 67, 67, 254, 0, 1, 1, 8, 45, 7, 67, 67, 67, 92, 67, 66, 67, 92, 67, 67, 67,
+    254, 0, 1, 0, 8, 45, 8, 92, 67, 66, 67, 67, 92, 67, 67, 66, 67, 92, 254, 0, 1, 0, 8, 45, 9, 67, 66, 67, 67, 67,
+    67, 66, 92, 67, 67, 67, 254, 255, 1, 0, 24, 16, 0, 67, 67, 67, 66, 67, 255, 0, 0, 16, 0, 1, 0, 16, 45, 0, 63, 63,
+    58, 63, 63, 254, 1, 0, 0, 16, 45, 1, 58, 63, 63, 63, 88, 58, 63, 63, 63, 63, 58, 254, 1, 0, 0, 16, 45, 2, 63, 88,
+    63, 58, 63, 63, 88, 63, 63, 58, 63, 254, 1, 0, 1, 16, 45, 5, 63, 63, 63, 63, 88, 63, 58, 63, 88, 63, 63, 254, 1, 0,
+    0, 16, 45, 6, 88, 63, 63, 63, 63, 63, 63, 88, 63, 63, 63, 254, 1, 0, 1, 16, 45, 7, 63, 63, 63, 88, 63, 68, 63, 88,
+    63, 63, 63, 254, 1, 0, 0, 16, 45, 8, 88, 63, 68, 63, 63, 88, 63, 63, 68, 63, 88, 254, 1, 0, 0, 16, 45, 9, 63, 68,
+    63, 63, 63, 63, 68, 88, 63, 63, 63, 254, 1, 1, 0, 0, 16, 0, 63, 63, 63, 68, 63, 255, 16, 0, 31, 0, 1, 0, 24, 45,
+    0, 57, 57, 56, 57, 57, 254, 0, 255, 0, 24, 45, 1, 56, 57, 57, 57, 82, 56, 57, 57, 57, 57, 56, 254, 0, 255, 0, 24, 45,
+    2, 57, 82, 57, 56, 57, 57, 82, 57, 57, 56, 57, 254, 0, 255, 1, 24, 45, 5, 57, 57, 57, 57, 82, 57, 56, 57, 82, 57, 57,
+    254, 0, 255, 0, 24, 45, 6, 82, 57, 57, 57, 57, 57, 57, 82, 57, 57, 57, 254, 0, 255, 1, 24, 45, 7, 57, 57, 57, 82, 57,
+    58, 57, 82, 57, 57, 57, 254, 0, 255, 0, 24, 45, 8, 82, 57, 58, 57, 57, 82, 57, 57, 58, 57, 82, 254, 0, 255, 0, 24, 45,
+    9, 57, 58, 57, 57, 57, 57, 58, 82, 57, 57, 57, 254, 1, 255, 0, 8, 16, 0, 57, 57, 57, 58, 57, 255, 31, 0, 16, 0, 1,
+    0, 0, 45, 0, 61, 61, 56, 61, 61, 254, 255, 0, 0, 0, 45, 3, 56, 61, 61, 61, 86, 56, 61, 61, 61, 61, 56, 254, 255, 0,
+    0, 0, 45, 4, 61, 86, 61, 56, 61, 61, 86, 61, 61, 56, 61, 254, 255, 0, 1, 0, 45, 10, 61, 61, 61, 61, 86, 61, 56, 61,
+    86, 61, 61, 254, 255, 0, 0, 0, 45, 11, 86, 61, 61, 61, 61, 61, 61, 86, 61, 61, 61, 254, 255, 0, 1, 0, 45, 12, 61, 61,
+    61, 86, 61, 66, 61, 86, 61, 61, 61, 254, 255, 0, 0, 0, 45, 13, 86, 61, 66, 61, 61, 86, 61, 61, 66, 61, 86, 254, 255, 0,
+    0, 0, 45, 14, 61, 66, 61, 61, 61, 61, 66, 86, 61, 61, 61, 254, 255, 1, 0, 16, 16, 0, 61, 61, 61, 66, 61, 255, 16, 0,
+    0, 0, 1, 0, 8, 45, 0, 67, 67, 66, 67, 67, 254, 0, 1, 0, 8, 45, 3, 66, 67, 67, 67, 92, 66, 67, 67, 67, 67, 66,
+    254, 0, 1, 0, 8, 45, 4, 67, 92, 67, 66, 67, 67, 92, 67, 67, 66, 67, 254, 0, 1, 1, 8, 45, 10, 67, 67, 67, 67, 92,
+    67, 66, 67, 92, 67, 67, 254, 0, 1, 0, 8, 45, 11, 92, 67, 67, 67, 67, 67, 67, 92, 67, 67, 67, 254, 0, 1, 1, 8, 45,
+    12, 67, 67, 67, 92, 67, 68, 67, 92, 67, 67, 67, 254, 0, 1, 0, 8, 45, 13, 92, 67, 68, 67, 67, 92, 67, 67, 68, 67, 92,
+    254, 0, 1, 0, 8, 45, 14, 67, 68, 67, 67, 67, 67, 68, 92, 67, 67, 67, 254, 1, 1, 0, 24, 16, 0, 67, 67, 67, 68, 67,
+    255, 0, 0, 16, 0, 1, 0, 16, 45, 0, 63, 63, 68, 63, 63, 254, 1, 0, 0, 16, 45, 3, 68, 63, 63, 63, 88, 68, 63, 63,
+    63, 63, 68, 254, 1, 0, 0, 16, 45, 4, 63, 88, 63, 68, 63, 63, 88, 63, 63, 68, 63, 254, 1, 0, 1, 16, 45, 10, 63, 63,
+    63, 63, 88, 63, 68, 63, 88, 63, 63, 254, 1, 0, 0, 16, 45, 11, 88, 63, 63, 63, 63, 63, 63, 88, 63, 63, 63, 254, 1, 0,
+    1, 16, 45, 12, 63, 63, 63, 88, 63, 58, 63, 88, 63, 63, 63, 254, 1, 0, 0, 16, 45, 13, 88, 63, 58, 63, 63, 88, 63, 63,
+    58, 63, 88, 254, 1, 0, 0, 16, 45, 14, 63, 58, 63, 63, 63, 63, 58, 88, 63, 63, 63, 254, 1, 255, 0, 0, 16, 0, 63, 63,
+    63, 58, 63, 255, 16, 0, 31, 0, 1, 0, 24, 45, 0, 57, 57, 58, 57, 57, 254, 0, 255, 0, 24, 45, 3, 58, 57, 57, 57, 82,
+    58, 57, 57, 57, 57, 58, 254, 0, 255, 0, 24, 45, 4, 57, 82, 57, 58, 57, 57, 82, 57, 57, 58, 57, 254, 0, 255, 1, 24, 45,
+    10, 57, 57, 57, 57, 82, 57, 58, 57, 82, 57, 57, 254, 0, 255, 0, 24, 45, 11, 82, 57, 57, 57, 57, 57, 57, 82, 57, 57, 57,
+    254, 0, 255, 1, 24, 45, 12, 57, 57, 57, 82, 57, 56, 57, 82, 57, 57, 57, 254, 0, 255, 0, 24, 45, 13, 82, 57, 56, 57, 57,
+    82, 57, 57, 56, 57, 82, 254, 0, 255, 0, 24, 45, 14, 57, 56, 57, 57, 57, 57, 56, 82, 57, 57, 57, 254, 255, 255, 0, 8, 16,
+    0, 57, 57, 57, 56, 57, 255, 31, 0, 16, 0, 15, 0, 16, 16, 0, 61, 61, 56, 61, 61, 254, 255, 0, 0, 0, 47, 14, 56, 61,
+    61, 61, 36, 56, 61, 61, 61, 61, 56, 254, 255, 0, 0, 0, 47, 13, 61, 36, 61, 56, 61, 61, 36, 61, 61, 56, 61, 254, 255, 0,
+    255, 0, 47, 12, 61, 61, 61, 61, 36, 61, 56, 61, 36, 61, 61, 254, 255, 0, 0, 0, 47, 11, 36, 61, 61, 61, 61, 61, 61, 36,
+    61, 61, 61, 254, 255, 0, 255, 0, 47, 10, 61, 61, 61, 36, 61, 66, 61, 36, 61, 61, 61, 254, 255, 0, 0, 0, 47, 4, 36, 61,
+    66, 61, 61, 36, 61, 61, 66, 61, 36, 254, 255, 0, 0, 0, 47, 3, 61, 66, 61, 61, 61, 61, 66, 36, 61, 61, 61, 254, 255, 1,
+    0, 0, 47, 0, 61, 61, 61, 66, 61, 255, 16, 0, 0, 0, 15, 0, 24, 16, 0, 67, 67, 66, 67, 67, 254, 0, 1, 0, 8, 47,
+    14, 66, 67, 67, 67, 42, 66, 67, 67, 67, 67, 66, 254, 0, 1, 0, 8, 47, 13, 67, 42, 67, 66, 67, 67, 42, 67, 67, 66, 67,
+    254, 0, 1, 255, 8, 47, 12, 67, 67, 67, 67, 42, 67, 66, 67, 42, 67, 67, 254, 0, 1, 0, 8, 47, 11, 42, 67, 67, 67, 67,
+    67, 67, 42, 67, 67, 67, 254, 0, 1, 255, 8, 47, 10, 67, 67, 67, 42, 67, 68, 67, 42, 67, 67, 67, 254, 0, 1, 0, 8, 47,
+    4, 42, 67, 68, 67, 67, 42, 67, 67, 68, 67, 42, 254, 0, 1, 0, 8, 47, 3, 67, 68, 67, 67, 67, 67, 68, 42, 67, 67, 67,
+    254, 1, 1, 0, 8, 47, 0, 67, 67, 67, 68, 67, 255, 0, 0, 16, 0, 15, 0, 0, 16, 0, 63, 63, 68, 63, 63, 254, 1, 0,
+    0, 16, 47, 14, 68, 63, 63, 63, 38, 68, 63, 63, 63, 63, 68, 254, 1, 0, 0, 16, 47, 13, 63, 38, 63, 68, 63, 63, 38, 63,
+    63, 68, 63, 254, 1, 0, 255, 16, 47, 12, 63, 63, 63, 63, 38, 63, 68, 63, 38, 63, 63, 254, 1, 0, 0, 16, 47, 11, 38, 63,
+    63, 63, 63, 63, 63, 38, 63, 63, 63, 254, 1, 0, 255, 16, 47, 10, 63, 63, 63, 38, 63, 58, 63, 38, 63, 63, 63, 254, 1, 0,
+    0, 16, 47, 4, 38, 63, 58, 63, 63, 38, 63, 63, 58, 63, 38, 254, 1, 0, 0, 16, 47, 3, 63, 58, 63, 63, 63, 63, 58, 38,
+    63, 63, 63, 254, 1, 255, 0, 16, 47, 0, 63, 63, 63, 58, 63, 255, 16, 0, 31, 0, 15, 0, 8, 16, 0, 57, 57, 58, 57, 57,
+    254, 0, 255, 0, 24, 47, 14, 58, 57, 57, 57, 32, 58, 57, 57, 57, 57, 58, 254, 0, 255, 0, 24, 47, 13, 57, 32, 57, 58, 57,
+    57, 32, 57, 57, 58, 57, 254, 0, 255, 255, 24, 47, 12, 57, 57, 57, 57, 32, 57, 58, 57, 32, 57, 57, 254, 0, 255, 0, 24, 47,
+    11, 32, 57, 57, 57, 57, 57, 57, 32, 57, 57, 57, 254, 0, 255, 255, 24, 47, 10, 57, 57, 57, 32, 57, 56, 57, 32, 57, 57, 57,
+    254, 0, 255, 0, 24, 47, 4, 32, 57, 56, 57, 57, 32, 57, 57, 56, 57, 32, 254, 0, 255, 0, 24, 47, 3, 57, 56, 57, 57, 57,
+    57, 56, 32, 57, 57, 57, 254, 255, 255, 0, 24, 47, 0, 57, 57, 57, 56, 57, 255, 31, 0, 16, 0, 15, 0, 16, 16, 0, 61, 61,
+    66, 61, 61, 254, 255, 0, 0, 0, 47, 9, 66, 61, 61, 61, 36, 66, 61, 61, 61, 61, 66, 254, 255, 0, 0, 0, 47, 8, 61, 36,
+    61, 66, 61, 61, 36, 61, 61, 66, 61, 254, 255, 0, 255, 0, 47, 7, 61, 61, 61, 61, 36, 61, 66, 61, 36, 61, 61, 254, 255, 0,
+    0, 0, 47, 6, 36, 61, 61, 61, 61, 61, 61, 36, 61, 61, 61, 254, 255, 0, 255, 0, 47, 5, 61, 61, 61, 36, 61, 56, 61, 36,
+    61, 61, 61, 254, 255, 0, 0, 0, 47, 2, 36, 61, 56, 61, 61, 36, 61, 61, 56, 61, 36, 254, 255, 0, 0, 0, 47, 1, 61, 56,
+    61, 61, 61, 61, 56, 36, 61, 61, 61, 254, 255, 255, 0, 0, 47, 0, 61, 61, 61, 56, 61, 255, 16, 0, 0, 0, 15, 0, 24, 16,
+    0, 67, 67, 68, 67, 67, 254, 0, 1, 0, 8, 47, 9, 68, 67, 67, 67, 42, 68, 67, 67, 67, 67, 68, 254, 0, 1, 0, 8, 47,
+    8, 67, 42, 67, 68, 67, 67, 42, 67, 67, 68, 67, 254, 0, 1, 255, 8, 47, 7, 67, 67, 67, 67, 42, 67, 68, 67, 42, 67, 67,
+    254, 0, 1, 0, 8, 47, 6, 42, 67, 67, 67, 67, 67, 67, 42, 67, 67, 67, 254, 0, 1, 255, 8, 47, 5, 67, 67, 67, 42, 67,
+    66, 67, 42, 67, 67, 67, 254, 0, 1, 0, 8, 47, 2, 42, 67, 66, 67, 67, 42, 67, 67, 66, 67, 42, 254, 0, 1, 0, 8, 47,
+    1, 67, 66, 67, 67, 67, 67, 66, 42, 67, 67, 67, 254, 255, 1, 0, 8, 47, 0, 67, 67, 67, 66, 67, 255, 0, 0, 16, 0, 15,
+    0, 0, 16, 0, 63, 63, 58, 63, 63, 254, 1, 0, 0, 16, 47, 9, 58, 63, 63, 63, 38, 58, 63, 63, 63, 63, 58, 254, 1, 0,
+    0, 16, 47, 8, 63, 38, 63, 58, 63, 63, 38, 63, 63, 58, 63, 254, 1, 0, 255, 16, 47, 7, 63, 63, 63, 63, 38, 63, 58, 63,
+    38, 63, 63, 254, 1, 0, 0, 16, 47, 6, 38, 63, 63, 63, 63, 63, 63, 38, 63, 63, 63, 254, 1, 0, 255, 16, 47, 5, 63, 63,
+    63, 38, 63, 68, 63, 38, 63, 63, 63, 254, 1, 0, 0, 16, 47, 2, 38, 63, 68, 63, 63, 38, 63, 63, 68, 63, 38, 254, 1, 0,
+    0, 16, 47, 1, 63, 68, 63, 63, 63, 63, 68, 38, 63, 63, 63, 254, 1, 1, 0, 16, 47, 0, 63, 63, 63, 68, 63, 255, 16, 0,
+    31, 0, 15, 0, 8, 16, 0, 57, 57, 56, 57, 57, 254, 0, 255, 0, 24, 47, 9, 56, 57, 57, 57, 32, 56, 57, 57, 57, 57, 56,
+    254, 0, 255, 0, 24, 47, 8, 57, 32, 57, 56, 57, 57, 32, 57, 57, 56, 57, 254, 0, 255, 255, 24, 47, 7, 57, 57, 57, 57, 32,
+    57, 56, 57, 32, 57, 57, 254, 0, 255, 0, 24, 47, 6, 32, 57, 57, 57, 57, 57, 57, 32, 57, 57, 57, 254, 0, 255, 255, 24, 47,
+    5, 57, 57, 57, 32, 57, 58, 57, 32, 57, 57, 57, 254, 0, 255, 0, 24, 47, 2, 32, 57, 58, 57, 57, 32, 57, 57, 58, 57, 32,
+    254, 0, 255, 0, 24, 47, 1, 57, 58, 57, 57, 57, 57, 58, 32, 57, 57, 57, 254, 1, 255, 0, 24, 47, 0, 57, 57, 57, 58, 57,
+    255, 31, 0, 16, 0, 0, 0, 0, 0, 2, 61, 61, 61, 254, 255, 0, 0, 31, 0, 2, 61, 56, 86, 61, 61, 61, 61, 56, 254, 255,
+    0, 1, 30, 0, 2, 61, 56, 254, 255, 0, 0, 30, 1, 1, 61, 81, 61, 56, 61, 56, 254, 255, 0, 1, 29, 1, 1, 56, 61, 81,
+    56, 61, 81, 56, 56, 254, 255, 255, 1, 28, 1, 1, 254, 254, 0, 0, 28, 2, 0, 81, 56, 56, 254, 255, 255, 1, 27, 2, 0, 57,
+    56, 81, 57, 81, 57, 81, 57, 254, 255, 255, 1, 26, 2, 0, 57, 81, 57, 82, 56, 82, 57, 81, 57, 254, 0, 255, 1, 25, 2, 0,
+    57, 82, 57, 81, 57, 82, 57, 254, 0, 255, 1, 24, 2, 0, 57, 82, 57, 255, 16, 0, 0, 0, 0, 0, 8, 0, 2, 67, 67, 67,
+    67, 254, 0, 1, 0, 7, 0, 2, 67, 66, 92, 67, 67, 67, 67, 66, 254, 0, 1, 1, 6, 0, 2, 67, 66, 254, 0, 1, 0, 6,
+    1, 1, 67, 91, 67, 66, 67, 66, 254, 0, 1, 1, 5, 1, 1, 66, 67, 91, 66, 67, 91, 66, 66, 254, 255, 1, 1, 4, 1, 1,
+    254, 0, 2, 0, 4, 2, 0, 91, 66, 66, 254, 255, 1, 1, 3, 2, 0, 61, 66, 91, 61, 91, 61, 91, 61, 254, 255, 1, 1, 2,
+    2, 0, 61, 91, 61, 86, 66, 86, 61, 91, 61, 254, 255, 0, 1, 1, 2, 0, 61, 86, 61, 91, 61, 86, 61, 254, 255, 0, 1, 0,
+    2, 0, 61, 86, 61, 255, 0, 0, 16, 0, 0, 0, 16, 0, 2, 63, 63, 63, 63, 254, 1, 0, 0, 15, 0, 2, 63, 93, 63, 63,
+    63, 63, 63, 93, 254, 1, 0, 0, 14, 0, 2, 63, 254, 1, 1, 0, 14, 1, 1, 63, 88, 68, 63, 68, 63, 93, 254, 1, 0, 0,
+    13, 1, 1, 68, 88, 68, 68, 88, 68, 68, 93, 254, 1, 1, 0, 12, 2, 0, 89, 68, 68, 93, 254, 1, 1, 0, 11, 2, 0, 67,
+    93, 68, 92, 68, 92, 68, 92, 254, 1, 1, 0, 10, 2, 0, 92, 68, 92, 67, 93, 67, 92, 68, 92, 254, 0, 1, 0, 9, 2, 0,
+    92, 67, 92, 68, 92, 67, 92, 254, 0, 1, 0, 8, 2, 0, 92, 67, 255, 16, 0, 31, 0, 0, 0, 24, 0, 2, 57, 57, 57, 254,
+    0, 255, 0, 23, 0, 2, 57, 83, 57, 57, 57, 57, 57, 83, 254, 0, 255, 0, 22, 0, 2, 57, 254, 1, 255, 0, 22, 1, 1, 57,
+    82, 58, 57, 58, 57, 83, 254, 0, 255, 0, 21, 1, 1, 58, 82, 58, 58, 82, 58, 58, 83, 254, 1, 255, 0, 20, 2, 0, 77, 58,
+    58, 83, 254, 1, 255, 0, 19, 2, 0, 63, 83, 58, 88, 58, 88, 58, 88, 254, 1, 255, 0, 18, 2, 0, 88, 58, 88, 63, 83, 63,
+    88, 58, 88, 254, 1, 0, 0, 17, 2, 0, 88, 63, 88, 58, 88, 63, 88, 254, 1, 0, 0, 16, 2, 0, 88, 63, 255, 31, 0, 16,
+    0, 0, 0, 0, 0, 4, 61, 61, 61, 254, 255, 0, 0, 1, 0, 4, 61, 91, 61, 61, 61, 61, 61, 91, 254, 255, 0, 0, 2, 0,
+    4, 61, 254, 255, 1, 0, 2, 1, 3, 61, 86, 66, 61, 66, 61, 91, 254, 255, 0, 0, 3, 1, 3, 66, 86, 66, 66, 86, 66, 66,
+    91, 254, 255, 1, 0, 4, 2, 0, 85, 66, 66, 91, 254, 255, 1, 0, 5, 2, 0, 67, 91, 66, 92, 66, 92, 66, 92, 254, 255, 1,
+    0, 6, 2, 0, 92, 66, 92, 67, 91, 67, 92, 66, 92, 254, 0, 1, 0, 7, 2, 0, 92, 67, 92, 66, 92, 67, 92, 254, 0, 1,
+    0, 8, 2, 0, 92, 67, 255, 16, 0, 0, 0, 0, 0, 8, 0, 4, 67, 67, 67, 67, 254, 0, 1, 0, 9, 0, 4, 67, 93, 67,
+    67, 67, 67, 67, 93, 254, 0, 1, 0, 10, 0, 4, 67, 254, 1, 1, 0, 10, 1, 3, 67, 92, 68, 67, 68, 67, 93, 254, 0, 1,
+    0, 11, 1, 3, 68, 92, 68, 68, 92, 68, 68, 93, 254, 1, 1, 0, 12, 2, 0, 97, 68, 68, 93, 254, 1, 1, 0, 13, 2, 0,
+    63, 93, 68, 88, 68, 88, 68, 88, 254, 1, 1, 0, 14, 2, 0, 88, 68, 88, 63, 93, 63, 88, 68, 88, 254, 1, 0, 0, 15, 2,
+    0, 88, 63, 88, 68, 88, 63, 88, 254, 1, 0, 0, 16, 2, 0, 88, 63, 255, 0, 0, 16, 0, 0, 0, 16, 0, 4, 63, 63, 63,
+    63, 254, 1, 0, 0, 17, 0, 4, 63, 58, 88, 63, 63, 63, 63, 58, 254, 1, 0, 1, 18, 0, 4, 63, 58, 254, 1, 0, 0, 18,
+    1, 3, 63, 83, 63, 58, 63, 58, 254, 1, 0, 1, 19, 1, 3, 58, 63, 83, 58, 63, 83, 58, 58, 254, 1, 255, 1, 20, 1, 3,
+    254, 2, 0, 0, 20, 2, 0, 83, 58, 58, 254, 1, 255, 1, 21, 2, 0, 57, 58, 83, 57, 83, 57, 83, 57, 254, 1, 255, 1, 22,
+    2, 0, 57, 83, 57, 82, 58, 82, 57, 83, 57, 254, 0, 255, 1, 23, 2, 0, 57, 82, 57, 83, 57, 82, 57, 254, 0, 255, 1, 24,
+    2, 0, 57, 82, 57, 255, 16, 0, 31, 0, 0, 0, 24, 0, 4, 57, 57, 57, 254, 0, 255, 0, 25, 0, 4, 57, 56, 82, 57, 57,
+    57, 57, 56, 254, 0, 255, 1, 26, 0, 4, 57, 56, 254, 0, 255, 0, 26, 1, 3, 57, 81, 57, 56, 57, 56, 254, 0, 255, 1, 27,
+    1, 3, 56, 57, 81, 56, 57, 81, 56, 56, 254, 255, 255, 1, 28, 1, 3, 254, 0, 254, 0, 28, 2, 0, 81, 56, 56, 254, 255, 255,
+    1, 29, 2, 0, 61, 56, 81, 61, 81, 61, 81, 61, 254, 255, 255, 1, 30, 2, 0, 61, 81, 61, 86, 56, 86, 61, 81, 61, 254, 255,
+    0, 1, 31, 2, 0, 61, 86, 61, 81, 61, 86, 61, 254, 255, 0, 1, 0, 2, 0, 61, 86, 61, 255, 31, 0, 16, 0, 7, 0, 0,
+    6, 0, 61, 36, 61, 254, 255, 0, 255, 31, 6, 0, 61, 31, 61, 36, 61, 36, 61, 31, 254, 255, 0, 0, 30, 6, 0, 36, 56, 36,
+    61, 31, 61, 31, 61, 31, 254, 255, 0, 0, 29, 6, 0, 31, 61, 31, 56, 36, 56, 56, 31, 254, 255, 255, 0, 28, 6, 0, 60, 31,
+    254, 255, 255, 0, 28, 5, 1, 31, 254, 255, 255, 0, 27, 5, 1, 57, 31, 56, 57, 31, 57, 56, 32, 254, 255, 255, 0, 26, 5, 1,
+    57, 56, 57, 32, 56, 254, 0, 255, 0, 26, 0, 2, 57, 56, 32, 254, 0, 255, 0, 25, 0, 2, 57, 57, 57, 56, 32, 57, 57, 254,
+    0, 255, 0, 24, 0, 2, 57, 57, 57, 255, 16, 0, 0, 0, 7, 0, 8, 6, 0, 67, 42, 67, 42, 254, 0, 1, 0, 7, 6, 0,
+    42, 66, 42, 67, 42, 67, 42, 66, 254, 0, 1, 255, 6, 6, 0, 67, 41, 67, 42, 66, 42, 66, 42, 66, 254, 0, 1, 255, 5, 6,
+    0, 66, 42, 66, 41, 67, 66, 41, 66, 254, 255, 1, 0, 4, 6, 0, 47, 254, 255, 1, 0, 4, 5, 1, 41, 66, 254, 255, 1, 0,
+    3, 5, 1, 36, 66, 66, 36, 66, 61, 41, 61, 254, 255, 1, 0, 2, 5, 1, 61, 66, 36, 61, 254, 255, 1, 0, 2, 0, 2, 61,
+    61, 41, 61, 254, 255, 0, 0, 1, 0, 2, 61, 61, 61, 41, 61, 61, 61, 254, 255, 0, 0, 0, 0, 2, 61, 61, 61, 255, 0, 0,
+    16, 0, 7, 0, 16, 6, 0, 63, 38, 63, 38, 254, 1, 0, 0, 15, 6, 0, 38, 68, 38, 63, 38, 63, 38, 68, 254, 1, 0, 255,
+    14, 6, 0, 63, 43, 63, 38, 68, 38, 68, 38, 68, 254, 1, 0, 255, 13, 6, 0, 68, 38, 68, 43, 63, 68, 43, 68, 254, 1, 1,
+    0, 12, 6, 0, 39, 254, 1, 1, 0, 12, 5, 1, 43, 68, 254, 1, 1, 0, 11, 5, 1, 42, 68, 68, 42, 68, 67, 43, 67, 254,
+    1, 1, 0, 10, 5, 1, 67, 68, 42, 67, 254, 1, 1, 0, 10, 0, 2, 67, 67, 43, 67, 254, 0, 1, 0, 9, 0, 2, 67, 67,
+    67, 43, 67, 67, 67, 254, 0, 1, 0, 8, 0, 2, 67, 67, 255, 16, 0, 31, 0, 7, 0, 24, 6, 0, 57, 32, 57, 254, 0, 255,
+    255, 23, 6, 0, 57, 33, 57, 32, 57, 32, 57, 33, 254, 0, 255, 0, 22, 6, 0, 32, 58, 32, 57, 33, 57, 33, 57, 33, 254, 0,
+    255, 0, 21, 6, 0, 33, 57, 33, 58, 32, 58, 58, 33, 254, 1, 255, 0, 20, 6, 0, 52, 33, 254, 1, 255, 0, 20, 5, 1, 33,
+    254, 1, 255, 0, 19, 5, 1, 63, 33, 58, 63, 33, 63, 58, 38, 254, 1, 255, 0, 18, 5, 1, 63, 58, 63, 38, 58, 254, 1, 0,
+    0, 18, 0, 2, 63, 58, 38, 254, 1, 0, 0, 17, 0, 2, 63, 63, 63, 58, 38, 63, 63, 254, 1, 0, 0, 16, 0, 2, 63, 63,
+    255, 31, 0, 16, 0, 7, 0, 0, 6, 0, 61, 36, 61, 254, 255, 0, 255, 1, 6, 0, 61, 41, 61, 36, 61, 36, 61, 41, 254, 255,
+    0, 0, 2, 6, 0, 36, 66, 36, 61, 41, 61, 41, 61, 41, 254, 255, 0, 0, 3, 6, 0, 41, 61, 41, 66, 36, 66, 66, 41, 254,
+    255, 1, 0, 4, 6, 0, 60, 41, 254, 255, 1, 0, 4, 5, 3, 41, 254, 255, 1, 0, 5, 5, 3, 67, 41, 66, 67, 41, 67, 66,
+    42, 254, 255, 1, 0, 6, 5, 3, 67, 66, 67, 42, 66, 254, 0, 1, 0, 6, 0, 4, 67, 66, 42, 254, 0, 1, 0, 7, 0, 4,
+    67, 67, 67, 66, 42, 67, 67, 254, 0, 1, 0, 8, 0, 4, 67, 67, 255, 16, 0, 0, 0, 7, 0, 8, 6, 0, 67, 42, 67, 42,
+    254, 0, 1, 0, 9, 6, 0, 42, 68, 42, 67, 42, 67, 42, 68, 254, 0, 1, 255, 10, 6, 0, 67, 43, 67, 42, 68, 42, 68, 42,
+    68, 254, 0, 1, 255, 11, 6, 0, 68, 42, 68, 43, 67, 68, 43, 68, 254, 1, 1, 0, 12, 6, 0, 47, 254, 1, 1, 0, 12, 5,
+    3, 43, 68, 254, 1, 1, 0, 13, 5, 3, 38, 68, 68, 38, 68, 63, 43, 63, 254, 1, 1, 0, 14, 5, 3, 63, 68, 38, 63, 254,
+    1, 1, 0, 14, 0, 4, 63, 63, 43, 63, 254, 1, 0, 0, 15, 0, 4, 63, 63, 63, 43, 63, 63, 63, 254, 1, 0, 0, 16, 0,
+    4, 63, 63, 255, 0, 0, 16, 0, 7, 0, 16, 6, 0, 63, 38, 63, 38, 254, 1, 0, 0, 17, 6, 0, 38, 58, 38, 63, 38, 63,
+    38, 58, 254, 1, 0, 255, 18, 6, 0, 63, 33, 63, 38, 58, 38, 58, 38, 58, 254, 1, 0, 255, 19, 6, 0, 58, 38, 58, 33, 63,
+    58, 33, 58, 254, 1, 255, 0, 20, 6, 0, 39, 254, 1, 255, 0, 20, 5, 3, 33, 58, 254, 1, 255, 0, 21, 5, 3, 32, 58, 58,
+    32, 58, 57, 33, 57, 254, 1, 255, 0, 22, 5, 3, 57, 58, 32, 57, 254, 1, 255, 0, 22, 0, 4, 57, 57, 33, 57, 254, 0, 255,
+    0, 23, 0, 4, 57, 57, 57, 33, 57, 57, 57, 254, 0, 255, 0, 24, 0, 4, 57, 57, 57, 255, 16, 0, 31, 0, 7, 0, 24, 6,
+    0, 57, 32, 57, 254, 0, 255, 255, 25, 6, 0, 57, 31, 57, 32, 57, 32, 57, 31, 254, 0, 255, 0, 26, 6, 0, 32, 56, 32, 57,
+    31, 57, 31, 57, 31, 254, 0, 255, 0, 27, 6, 0, 31, 57, 31, 56, 32, 56, 56, 31, 254, 255, 255, 0, 28, 6, 0, 52, 31, 254,
+    255, 255, 0, 28, 5, 3, 31, 254, 255, 255, 0, 29, 5, 3, 61, 31, 56, 61, 31, 61, 56, 36, 254, 255, 255, 0, 30, 5, 3, 61,
+    56, 61, 36, 56, 254, 255, 0, 0, 30, 0, 4, 61, 56, 36, 254, 255, 0, 0, 31, 0, 4, 61, 61, 61, 56, 36, 61, 61, 254, 255,
+    0, 0, 0, 0, 4, 61, 61, 61, 255, 31, 0, 16, 0, 0, 0, 0, 2, 0, 61, 86, 61, 86, 61, 86, 61, 86, 61, 81, 61, 86,
+    61, 86, 61, 86, 61, 86, 61, 81, 61, 86, 61, 86, 61, 86, 61, 86, 61, 81, 61, 86, 61, 86, 61, 86, 61, 86, 56, 86, 86, 61,
+    86, 61, 86, 86, 61, 86, 56, 86, 86, 61, 86, 86, 86, 61, 86, 86, 81, 61, 86, 254, 255, 0, 1, 0, 3, 0, 86, 61, 86, 86,
+    86, 86, 81, 86, 61, 86, 86, 86, 86, 86, 86, 81, 86, 86, 86, 87, 86, 86, 86, 86, 86, 81, 86, 87, 86, 86, 87, 86, 86, 87,
+    86, 81, 86, 87, 86, 86, 87, 86, 86, 87, 81, 87, 254, 255, 0, 1, 0, 4, 0, 86, 87, 86, 87, 86, 86, 87, 81, 87, 86, 87,
+    86, 87, 86, 87, 87, 86, 82, 86, 87, 86, 87, 87, 86, 87, 86, 87, 82, 86, 87, 86, 87, 86, 87, 87, 254, 255, 0, 1, 0, 9,
+    0, 82, 87, 87, 86, 87, 87, 86, 87, 87, 86, 82, 87, 87, 86, 87, 87, 87, 87, 86, 87, 82, 87, 87, 87, 86, 87, 87, 87, 87,
+    82, 86, 87, 254, 0, 0, 1, 0, 10, 0, 87, 87, 87, 87, 87, 87, 82, 87, 87, 87, 87, 87, 87, 87, 87, 87, 82, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 82, 87, 87, 87, 87, 87, 87, 87, 87, 82, 254, 0, 0, 1, 0, 11, 0, 87, 88, 87, 87, 87, 87, 87,
+    87, 82, 88, 87, 87, 87, 87, 87, 88, 87, 87, 82, 88, 87, 87, 87, 254, 1, 0, 1, 0, 12, 0, 87, 87, 88, 82, 88, 87, 87,
+    88, 87, 87, 88, 87, 88, 82, 254, 1, 0, 1, 0, 13, 0, 87, 88, 87, 88, 87, 88, 87, 88, 83, 87, 88, 88, 87, 88, 254, 1,
+    0, 1, 0, 14, 0, 88, 87, 88, 83, 88, 88, 88, 88, 88, 88, 88, 88, 254, 1, 255, 1, 0, 15, 0, 63, 88, 88, 88, 63, 88,
+    88, 63, 88, 58, 88, 63, 88, 63, 254, 1, 0, 1, 0, 16, 0, 63, 63, 88, 63, 58, 63, 88, 63, 63, 63, 63, 63, 63, 255, 16,
+    0, 0, 0, 0, 0, 8, 2, 0, 67, 92, 67, 92, 67, 92, 67, 92, 67, 91, 67, 92, 67, 92, 67, 92, 67, 92, 67, 91, 67, 92,
+    67, 92, 67, 92, 67, 92, 67, 91, 67, 92, 67, 92, 67, 92, 67, 92, 66, 92, 92, 67, 92, 67, 92, 92, 67, 92, 66, 92, 92, 67,
+    92, 92, 92, 67, 92, 92, 91, 67, 92, 254, 0, 1, 1, 8, 3, 0, 92, 67, 92, 92, 92, 92, 91, 92, 67, 92, 92, 92, 92, 92,
+    92, 91, 92, 92, 92, 87, 92, 92, 92, 92, 92, 91, 92, 87, 92, 92, 87, 92, 92, 87, 92, 91, 92, 87, 92, 92, 87, 92, 92, 87,
+    91, 87, 254, 0, 1, 1, 8, 4, 0, 92, 87, 92, 87, 92, 92, 87, 91, 87, 92, 87, 92, 87, 92, 87, 87, 92, 86, 92, 87, 92,
+    87, 87, 92, 87, 92, 87, 86, 92, 87, 92, 87, 92, 87, 87, 254, 0, 1, 1, 8, 9, 0, 86, 87, 87, 92, 87, 87, 92, 87, 87,
+    92, 86, 87, 87, 92, 87, 87, 87, 87, 92, 87, 86, 87, 87, 87, 92, 87, 87, 87, 87, 86, 92, 87, 254, 0, 0, 1, 8, 10, 0,
+    87, 87, 87, 87, 87, 87, 86, 87, 87, 87, 87, 87, 87, 87, 87, 87, 86, 87, 87, 87, 87, 87, 87, 87, 87, 87, 86, 87, 87, 87,
+    87, 87, 87, 87, 87, 86, 254, 0, 0, 1, 8, 11, 0, 87, 82, 87, 87, 87, 87, 87, 87, 86, 82, 87, 87, 87, 87, 87, 82, 87,
+    87, 86, 82, 87, 87, 87, 254, 0, 255, 1, 8, 12, 0, 87, 87, 82, 86, 82, 87, 87, 82, 87, 87, 82, 87, 82, 86, 254, 0, 255,
+    1, 8, 13, 0, 87, 82, 87, 82, 87, 82, 87, 82, 81, 87, 82, 82, 87, 82, 254, 0, 255, 1, 8, 14, 0, 82, 87, 82, 81, 82,
+    82, 82, 82, 82, 82, 82, 82, 254, 255, 255, 1, 8, 15, 0, 57, 82, 82, 82, 57, 82, 82, 57, 82, 56, 82, 57, 82, 57, 254, 0,
+    255, 1, 8, 16, 0, 57, 57, 82, 57, 56, 57, 82, 57, 57, 57, 57, 57, 57, 255, 0, 0, 16, 0, 0, 0, 16, 2, 0, 63, 88,
+    63, 88, 63, 88, 63, 88, 63, 93, 63, 88, 63, 88, 63, 88, 63, 88, 63, 93, 63, 88, 63, 88, 63, 88, 63, 88, 63, 93, 63, 88,
+    63, 88, 63, 88, 63, 88, 68, 88, 88, 63, 88, 63, 88, 88, 63, 88, 68, 88, 88, 63, 88, 88, 88, 63, 88, 88, 93, 63, 88, 254,
+    1, 0, 1, 16, 3, 0, 88, 63, 88, 88, 88, 88, 93, 88, 63, 88, 88, 88, 88, 88, 88, 93, 88, 88, 88, 87, 88, 88, 88, 88,
+    88, 93, 88, 87, 88, 88, 87, 88, 88, 87, 88, 93, 88, 87, 88, 88, 87, 88, 88, 87, 93, 87, 254, 1, 0, 1, 16, 4, 0, 88,
+    87, 88, 87, 88, 88, 87, 93, 87, 88, 87, 88, 87, 88, 87, 87, 88, 92, 88, 87, 88, 87, 87, 88, 87, 88, 87, 92, 88, 87, 88,
+    87, 88, 87, 87, 254, 1, 0, 1, 16, 9, 0, 92, 87, 87, 88, 87, 87, 88, 87, 87, 88, 92, 87, 87, 88, 87, 87, 87, 87, 88,
+    87, 92, 87, 87, 87, 88, 87, 87, 87, 87, 92, 88, 87, 254, 0, 0, 1, 16, 10, 0, 87, 87, 87, 87, 87, 87, 92, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 92, 87, 87, 87, 87, 87, 87, 87, 87, 87, 92, 87, 87, 87, 87, 87, 87, 87, 87, 92, 254, 0, 0, 1,
+    16, 11, 0, 87, 86, 87, 87, 87, 87, 87, 87, 92, 86, 87, 87, 87, 87, 87, 86, 87, 87, 92, 86, 87, 87, 87, 254, 255, 0, 1,
+    16, 12, 0, 87, 87, 86, 92, 86, 87, 87, 86, 87, 87, 86, 87, 86, 92, 254, 255, 0, 1, 16, 13, 0, 87, 86, 87, 86, 87, 86,
+    87, 86, 91, 87, 86, 86, 87, 86, 254, 255, 0, 1, 16, 14, 0, 86, 87, 86, 91, 86, 86, 86, 86, 86, 86, 86, 86, 254, 255, 1,
+    1, 16, 15, 0, 61, 86, 86, 86, 61, 86, 86, 61, 86, 66, 86, 61, 86, 61, 254, 255, 0, 1, 16, 16, 0, 61, 61, 86, 61, 66,
+    61, 86, 61, 61, 61, 61, 61, 61, 255, 16, 0, 31, 0, 0, 0, 24, 2, 0, 57, 82, 57, 82, 57, 82, 57, 82, 57, 83, 57, 82,
+    57, 82, 57, 82, 57, 82, 57, 83, 57, 82, 57, 82, 57, 82, 57, 82, 57, 83, 57, 82, 57, 82, 57, 82, 57, 82, 58, 82, 82, 57,
+    82, 57, 82, 82, 57, 82, 58, 82, 82, 57, 82, 82, 82, 57, 82, 82, 83, 57, 82, 254, 0, 255, 1, 24, 3, 0, 82, 57, 82, 82,
+    82, 82, 83, 82, 57, 82, 82, 82, 82, 82, 82, 83, 82, 82, 82, 87, 82, 82, 82, 82, 82, 83, 82, 87, 82, 82, 87, 82, 82, 87,
+    82, 83, 82, 87, 82, 82, 87, 82, 82, 87, 83, 87, 254, 0, 255, 1, 24, 4, 0, 82, 87, 82, 87, 82, 82, 87, 83, 87, 82, 87,
+    82, 87, 82, 87, 87, 82, 88, 82, 87, 82, 87, 87, 82, 87, 82, 87, 88, 82, 87, 82, 87, 82, 87, 87, 254, 0, 255, 1, 24, 9,
+    0, 88, 87, 87, 82, 87, 87, 82, 87, 87, 82, 88, 87, 87, 82, 87, 87, 87, 87, 82, 87, 88, 87, 87, 87, 82, 87, 87, 87, 87,
+    88, 82, 87, 254, 0, 0, 1, 24, 10, 0, 87, 87, 87, 87, 87, 87, 88, 87, 87, 87, 87, 87, 87, 87, 87, 87, 88, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 88, 87, 87, 87, 87, 87, 87, 87, 87, 88, 254, 0, 0, 1, 24, 11, 0, 87, 92, 87, 87, 87, 87, 87,
+    87, 88, 92, 87, 87, 87, 87, 87, 92, 87, 87, 88, 92, 87, 87, 87, 254, 0, 1, 1, 24, 12, 0, 87, 87, 92, 88, 92, 87, 87,
+    92, 87, 87, 92, 87, 92, 88, 254, 0, 1, 1, 24, 13, 0, 87, 92, 87, 92, 87, 92, 87, 92, 93, 87, 92, 92, 87, 92, 254, 0,
+    1, 1, 24, 14, 0, 92, 87, 92, 93, 92, 92, 92, 92, 92, 92, 92, 92, 254, 1, 1, 1, 24, 15, 0, 67, 92, 92, 92, 67, 92,
+    92, 67, 92, 68, 92, 67, 92, 67, 254, 0, 1, 1, 24, 16, 0, 67, 67, 92, 67, 68, 67, 92, 67, 67, 67, 67, 67, 67, 255, 31,
+    0, 16, 0, 0, 0, 0, 2, 0, 61, 86, 61, 86, 61, 86, 61, 86, 61, 91, 61, 86, 61, 86, 61, 86, 61, 86, 61, 91, 61, 86,
+    61, 86, 61, 86, 61, 86, 61, 91, 61, 86, 61, 86, 61, 86, 61, 86, 66, 86, 86, 61, 86, 61, 86, 86, 61, 86, 66, 86, 86, 61,
+    86, 86, 86, 61, 86, 86, 91, 61, 86, 254, 255, 0, 1, 0, 3, 0, 86, 61, 86, 86, 86, 86, 91, 86, 61, 86, 86, 86, 86, 86,
+    86, 91, 86, 86, 86, 87, 86, 86, 86, 86, 86, 91, 86, 87, 86, 86, 87, 86, 86, 87, 86, 91, 86, 87, 86, 86, 87, 86, 86, 87,
+    91, 87, 254, 255, 0, 1, 0, 4, 0, 86, 87, 86, 87, 86, 86, 87, 91, 87, 86, 87, 86, 87, 86, 87, 87, 86, 92, 86, 87, 86,
+    87, 87, 86, 87, 86, 87, 92, 86, 87, 86, 87, 86, 87, 87, 254, 255, 0, 1, 0, 9, 0, 92, 87, 87, 86, 87, 87, 86, 87, 87,
+    86, 92, 87, 87, 86, 87, 87, 87, 87, 86, 87, 92, 87, 87, 87, 86, 87, 87, 87, 87, 92, 86, 87, 254, 0, 0, 1, 0, 10, 0,
+    87, 87, 87, 87, 87, 87, 92, 87, 87, 87, 87, 87, 87, 87, 87, 87, 92, 87, 87, 87, 87, 87, 87, 87, 87, 87, 92, 87, 87, 87,
+    87, 87, 87, 87, 87, 92, 254, 0, 0, 1, 0, 11, 0, 87, 88, 87, 87, 87, 87, 87, 87, 92, 88, 87, 87, 87, 87, 87, 88, 87,
+    87, 92, 88, 87, 87, 87, 254, 1, 0, 1, 0, 12, 0, 87, 87, 88, 92, 88, 87, 87, 88, 87, 87, 88, 87, 88, 92, 254, 1, 0,
+    1, 0, 13, 0, 87, 88, 87, 88, 87, 88, 87, 88, 93, 87, 88, 88, 87, 88, 254, 1, 0, 1, 0, 14, 0, 88, 87, 88, 93, 88,
+    88, 88, 88, 88, 88, 88, 88, 254, 1, 1, 1, 0, 15, 0, 63, 88, 88, 88, 63, 88, 88, 63, 88, 68, 88, 63, 88, 63, 254, 1,
+    0, 1, 0, 16, 0, 63, 63, 88, 63, 68, 63, 88, 63, 63, 63, 63, 63, 63, 255, 16, 0, 0, 0, 0, 0, 8, 2, 0, 67, 92,
+    67, 92, 67, 92, 67, 92, 67, 93, 67, 92, 67, 92, 67, 92, 67, 92, 67, 93, 67, 92, 67, 92, 67, 92, 67, 92, 67, 93, 67, 92,
+    67, 92, 67, 92, 67, 92, 68, 92, 92, 67, 92, 67, 92, 92, 67, 92, 68, 92, 92, 67, 92, 92, 92, 67, 92, 92, 93, 67, 92, 254,
+    0, 1, 1, 8, 3, 0, 92, 67, 92, 92, 92, 92, 93, 92, 67, 92, 92, 92, 92, 92, 92, 93, 92, 92, 92, 87, 92, 92, 92, 92,
+    92, 93, 92, 87, 92, 92, 87, 92, 92, 87, 92, 93, 92, 87, 92, 92, 87, 92, 92, 87, 93, 87, 254, 0, 1, 1, 8, 4, 0, 92,
+    87, 92, 87, 92, 92, 87, 93, 87, 92, 87, 92, 87, 92, 87, 87, 92, 88, 92, 87, 92, 87, 87, 92, 87, 92, 87, 88, 92, 87, 92,
+    87, 92, 87, 87, 254, 0, 1, 1, 8, 9, 0, 88, 87, 87, 92, 87, 87, 92, 87, 87, 92, 88, 87, 87, 92, 87, 87, 87, 87, 92,
+    87, 88, 87, 87, 87, 92, 87, 87, 87, 87, 88, 92, 87, 254, 0, 0, 1, 8, 10, 0, 87, 87, 87, 87, 87, 87, 88, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 88, 87, 87, 87, 87, 87, 87, 87, 87, 87, 88, 87, 87, 87, 87, 87, 87, 87, 87, 88, 254, 0, 0, 1,
+    8, 11, 0, 87, 82, 87, 87, 87, 87, 87, 87, 88, 82, 87, 87, 87, 87, 87, 82, 87, 87, 88, 82, 87, 87, 87, 254, 0, 255, 1,
+    8, 12, 0, 87, 87, 82, 88, 82, 87, 87, 82, 87, 87, 82, 87, 82, 88, 254, 0, 255, 1, 8, 13, 0, 87, 82, 87, 82, 87, 82,
+    87, 82, 83, 87, 82, 82, 87, 82, 254, 0, 255, 1, 8, 14, 0, 82, 87, 82, 83, 82, 82, 82, 82, 82, 82, 82, 82, 254, 1, 255,
+    1, 8, 15, 0, 57, 82, 82, 82, 57, 82, 82, 57, 82, 58, 82, 57, 82, 57, 254, 0, 255, 1, 8, 16, 0, 57, 57, 82, 57, 58,
+    57, 82, 57, 57, 57, 57, 57, 57, 255, 0, 0, 16, 0, 0, 0, 16, 2, 0, 63, 88, 63, 88, 63, 88, 63, 88, 63, 83, 63, 88,
+    63, 88, 63, 88, 63, 88, 63, 83, 63, 88, 63, 88, 63, 88, 63, 88, 63, 83, 63, 88, 63, 88, 63, 88, 63, 88, 58, 88, 88, 63,
+    88, 63, 88, 88, 63, 88, 58, 88, 88, 63, 88, 88, 88, 63, 88, 88, 83, 63, 88, 254, 1, 0, 1, 16, 3, 0, 88, 63, 88, 88,
+    88, 88, 83, 88, 63, 88, 88, 88, 88, 88, 88, 83, 88, 88, 88, 87, 88, 88, 88, 88, 88, 83, 88, 87, 88, 88, 87, 88, 88, 87,
+    88, 83, 88, 87, 88, 88, 87, 88, 88, 87, 83, 87, 254, 1, 0, 1, 16, 4, 0, 88, 87, 88, 87, 88, 88, 87, 83, 87, 88, 87,
+    88, 87, 88, 87, 87, 88, 82, 88, 87, 88, 87, 87, 88, 87, 88, 87, 82, 88, 87, 88, 87, 88, 87, 87, 254, 1, 0, 1, 16, 9,
+    0, 82, 87, 87, 88, 87, 87, 88, 87, 87, 88, 82, 87, 87, 88, 87, 87, 87, 87, 88, 87, 82, 87, 87, 87, 88, 87, 87, 87, 87,
+    82, 88, 87, 254, 0, 0, 1, 16, 10, 0, 87, 87, 87, 87, 87, 87, 82, 87, 87, 87, 87, 87, 87, 87, 87, 87, 82, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 82, 87, 87, 87, 87, 87, 87, 87, 87, 82, 254, 0, 0, 1, 16, 11, 0, 87, 86, 87, 87, 87, 87, 87,
+    87, 82, 86, 87, 87, 87, 87, 87, 86, 87, 87, 82, 86, 87, 87, 87, 254, 255, 0, 1, 16, 12, 0, 87, 87, 86, 82, 86, 87, 87,
+    86, 87, 87, 86, 87, 86, 82, 254, 255, 0, 1, 16, 13, 0, 87, 86, 87, 86, 87, 86, 87, 86, 81, 87, 86, 86, 87, 86, 254, 255,
+    0, 1, 16, 14, 0, 86, 87, 86, 81, 86, 86, 86, 86, 86, 86, 86, 86, 254, 255, 255, 1, 16, 15, 0, 61, 86, 86, 86, 61, 86,
+    86, 61, 86, 56, 86, 61, 86, 61, 254, 255, 0, 1, 16, 16, 0, 61, 61, 86, 61, 56, 61, 86, 61, 61, 61, 61, 61, 61, 255, 16,
+    0, 31, 0, 0, 0, 24, 2, 0, 57, 82, 57, 82, 57, 82, 57, 82, 57, 81, 57, 82, 57, 82, 57, 82, 57, 82, 57, 81, 57, 82,
+    57, 82, 57, 82, 57, 82, 57, 81, 57, 82, 57, 82, 57, 82, 57, 82, 56, 82, 82, 57, 82, 57, 82, 82, 57, 82, 56, 82, 82, 57,
+    82, 82, 82, 57, 82, 82, 81, 57, 82, 254, 0, 255, 1, 24, 3, 0, 82, 57, 82, 82, 82, 82, 81, 82, 57, 82, 82, 82, 82, 82,
+    82, 81, 82, 82, 82, 87, 82, 82, 82, 82, 82, 81, 82, 87, 82, 82, 87, 82, 82, 87, 82, 81, 82, 87, 82, 82, 87, 82, 82, 87,
+    81, 87, 254, 0, 255, 1, 24, 4, 0, 82, 87, 82, 87, 82, 82, 87, 81, 87, 82, 87, 82, 87, 82, 87, 87, 82, 86, 82, 87, 82,
+    87, 87, 82, 87, 82, 87, 86, 82, 87, 82, 87, 82, 87, 87, 254, 0, 255, 1, 24, 9, 0, 86, 87, 87, 82, 87, 87, 82, 87, 87,
+    82, 86, 87, 87, 82, 87, 87, 87, 87, 82, 87, 86, 87, 87, 87, 82, 87, 87, 87, 87, 86, 82, 87, 254, 0, 0, 1, 24, 10, 0,
+    87, 87, 87, 87, 87, 87, 86, 87, 87, 87, 87, 87, 87, 87, 87, 87, 86, 87, 87, 87, 87, 87, 87, 87, 87, 87, 86, 87, 87, 87,
+    87, 87, 87, 87, 87, 86, 254, 0, 0, 1, 24, 11, 0, 87, 92, 87, 87, 87, 87, 87, 87, 86, 92, 87, 87, 87, 87, 87, 92, 87,
+    87, 86, 92, 87, 87, 87, 254, 0, 1, 1, 24, 12, 0, 87, 87, 92, 86, 92, 87, 87, 92, 87, 87, 92, 87, 92, 86, 254, 0, 1,
+    1, 24, 13, 0, 87, 92, 87, 92, 87, 92, 87, 92, 91, 87, 92, 92, 87, 92, 254, 0, 1, 1, 24, 14, 0, 92, 87, 92, 91, 92,
+    92, 92, 92, 92, 92, 92, 92, 254, 255, 1, 1, 24, 15, 0, 67, 92, 92, 92, 67, 92, 92, 67, 92, 66, 92, 67, 92, 67, 254, 0,
+    1, 1, 24, 16, 0, 67, 67, 92, 67, 66, 67, 92, 67, 67, 67, 67, 67, 67, 255, 31, 0, 16, 0, 16, 0, 16, 16, 0, 61, 61,
+    61, 61, 61, 61, 61, 36, 61, 56, 61, 36, 61, 61, 254, 255, 0, 255, 16, 23, 0, 61, 36, 61, 36, 56, 36, 61, 36, 36, 61, 36,
+    36, 36, 61, 254, 255, 255, 255, 16, 22, 0, 36, 36, 36, 36, 36, 36, 36, 36, 31, 36, 37, 36, 254, 255, 0, 255, 16, 21, 0, 36,
+    37, 36, 36, 37, 31, 36, 37, 36, 37, 36, 37, 36, 37, 254, 255, 0, 255, 16, 20, 0, 32, 36, 37, 36, 37, 37, 36, 37, 37, 36,
+    32, 36, 37, 37, 254, 255, 0, 255, 16, 19, 0, 37, 37, 37, 36, 32, 37, 37, 36, 37, 37, 37, 37, 37, 36, 32, 37, 37, 37, 37,
+    37, 37, 36, 37, 254, 0, 0, 255, 16, 18, 0, 32, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 16, 17, 0, 37, 38, 32, 37, 37, 37,
+    37, 38, 37, 37, 37, 32, 37, 38, 37, 37, 37, 37, 38, 37, 37, 32, 38, 37, 37, 38, 37, 37, 38, 37, 37, 32, 254, 1, 0, 255,
+    16, 8, 0, 37, 37, 38, 37, 38, 37, 38, 32, 37, 38, 37, 38, 37, 37, 38, 37, 38, 32, 38, 37, 37, 38, 37, 38, 37, 38, 37,
+    33, 37, 38, 38, 37, 38, 37, 38, 254, 1, 0, 255, 16, 7, 0, 37, 33, 37, 38, 38, 37, 38, 38, 37, 38, 33, 38, 37, 38, 38,
+    37, 38, 38, 37, 38, 33, 38, 38, 38, 38, 38, 37, 38, 38, 38, 33, 38, 38, 38, 38, 38, 38, 63, 38, 33, 38, 38, 38, 38, 63,
+    38, 254, 1, 0, 255, 16, 6, 0, 38, 63, 33, 38, 38, 63, 38, 38, 38, 63, 38, 38, 58, 38, 63, 38, 38, 63, 38, 63, 38, 38,
+    58, 38, 63, 38, 63, 38, 63, 38, 63, 33, 63, 38, 63, 38, 63, 38, 63, 38, 63, 33, 63, 38, 63, 38, 63, 38, 63, 38, 63, 33,
+    63, 38, 63, 38, 63, 38, 63, 38, 255, 16, 0, 0, 0, 16, 0, 24, 16, 0, 67, 67, 67, 67, 67, 67, 67, 42, 67, 66, 67, 42,
+    67, 67, 254, 0, 1, 255, 24, 23, 0, 67, 42, 67, 42, 66, 42, 67, 42, 42, 67, 42, 42, 42, 67, 254, 255, 1, 255, 24, 22, 0,
+    42, 42, 42, 42, 42, 42, 42, 42, 41, 42, 37, 42, 254, 0, 1, 255, 24, 21, 0, 42, 37, 42, 42, 37, 41, 42, 37, 42, 37, 42,
+    37, 42, 37, 254, 0, 1, 255, 24, 20, 0, 36, 42, 37, 42, 37, 37, 42, 37, 37, 42, 36, 42, 37, 37, 254, 0, 1, 255, 24, 19,
+    0, 37, 37, 37, 42, 36, 37, 37, 42, 37, 37, 37, 37, 37, 42, 36, 37, 37, 37, 37, 37, 37, 42, 37, 254, 0, 0, 255, 24, 18,
+    0, 36, 37, 37, 37, 37, 37, 37, 37, 37, 36, 37, 37, 37, 37, 37, 37, 37, 37, 37, 36, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    36, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 24, 17, 0, 37, 32, 36, 37, 37, 37, 37, 32, 37, 37, 37, 36, 37, 32, 37, 37,
+    37, 37, 32, 37, 37, 36, 32, 37, 37, 32, 37, 37, 32, 37, 37, 36, 254, 0, 255, 255, 24, 8, 0, 37, 37, 32, 37, 32, 37, 32,
+    36, 37, 32, 37, 32, 37, 37, 32, 37, 32, 36, 32, 37, 37, 32, 37, 32, 37, 32, 37, 31, 37, 32, 32, 37, 32, 37, 32, 254, 0,
+    255, 255, 24, 7, 0, 37, 31, 37, 32, 32, 37, 32, 32, 37, 32, 31, 32, 37, 32, 32, 37, 32, 32, 37, 32, 31, 32, 32, 32, 32,
+    32, 37, 32, 32, 32, 31, 32, 32, 32, 32, 32, 32, 57, 32, 31, 32, 32, 32, 32, 57, 32, 254, 0, 255, 255, 24, 6, 0, 32, 57,
+    31, 32, 32, 57, 32, 32, 32, 57, 32, 32, 56, 32, 57, 32, 32, 57, 32, 57, 32, 32, 56, 32, 57, 32, 57, 32, 57, 32, 57, 31,
+    57, 32, 57, 32, 57, 32, 57, 32, 57, 31, 57, 32, 57, 32, 57, 32, 57, 32, 57, 31, 57, 32, 57, 32, 57, 32, 57, 32, 255, 0,
+    0, 16, 0, 16, 0, 0, 16, 0, 63, 63, 63, 63, 63, 63, 63, 38, 63, 68, 63, 38, 63, 63, 254, 1, 0, 255, 0, 23, 0, 63,
+    38, 63, 38, 68, 38, 63, 38, 38, 63, 38, 38, 38, 63, 254, 1, 1, 255, 0, 22, 0, 38, 38, 38, 38, 38, 38, 38, 38, 43, 38,
+    37, 38, 254, 1, 0, 255, 0, 21, 0, 38, 37, 38, 38, 37, 43, 38, 37, 38, 37, 38, 37, 38, 37, 254, 1, 0, 255, 0, 20, 0,
+    42, 38, 37, 38, 37, 37, 38, 37, 37, 38, 42, 38, 37, 37, 254, 1, 0, 255, 0, 19, 0, 37, 37, 37, 38, 42, 37, 37, 38, 37,
+    37, 37, 37, 37, 38, 42, 37, 37, 37, 37, 37, 37, 38, 37, 254, 0, 0, 255, 0, 18, 0, 42, 37, 37, 37, 37, 37, 37, 37, 37,
+    42, 37, 37, 37, 37, 37, 37, 37, 37, 37, 42, 37, 37, 37, 37, 37, 37, 37, 37, 37, 42, 37, 37, 37, 37, 37, 37, 254, 0, 0,
+    255, 0, 17, 0, 37, 36, 42, 37, 37, 37, 37, 36, 37, 37, 37, 42, 37, 36, 37, 37, 37, 37, 36, 37, 37, 42, 36, 37, 37, 36,
+    37, 37, 36, 37, 37, 42, 254, 255, 0, 255, 0, 8, 0, 37, 37, 36, 37, 36, 37, 36, 42, 37, 36, 37, 36, 37, 37, 36, 37, 36,
+    42, 36, 37, 37, 36, 37, 36, 37, 36, 37, 41, 37, 36, 36, 37, 36, 37, 36, 254, 255, 0, 255, 0, 7, 0, 37, 41, 37, 36, 36,
+    37, 36, 36, 37, 36, 41, 36, 37, 36, 36, 37, 36, 36, 37, 36, 41, 36, 36, 36, 36, 36, 37, 36, 36, 36, 41, 36, 36, 36, 36,
+    36, 36, 61, 36, 41, 36, 36, 36, 36, 61, 36, 254, 255, 0, 255, 0, 6, 0, 36, 61, 41, 36, 36, 61, 36, 36, 36, 61, 36, 36,
+    66, 36, 61, 36, 36, 61, 36, 61, 36, 36, 66, 36, 61, 36, 61, 36, 61, 36, 61, 41, 61, 36, 61, 36, 61, 36, 61, 36, 61, 41,
+    61, 36, 61, 36, 61, 36, 61, 36, 61, 41, 61, 36, 61, 36, 61, 36, 61, 36, 255, 16, 0, 31, 0, 16, 0, 8, 16, 0, 57, 57,
+    57, 57, 57, 57, 57, 32, 57, 58, 57, 32, 57, 57, 254, 0, 255, 255, 8, 23, 0, 57, 32, 57, 32, 58, 32, 57, 32, 32, 57, 32,
+    32, 32, 57, 254, 1, 255, 255, 8, 22, 0, 32, 32, 32, 32, 32, 32, 32, 32, 33, 32, 37, 32, 254, 0, 255, 255, 8, 21, 0, 32,
+    37, 32, 32, 37, 33, 32, 37, 32, 37, 32, 37, 32, 37, 254, 0, 255, 255, 8, 20, 0, 38, 32, 37, 32, 37, 37, 32, 37, 37, 32,
+    38, 32, 37, 37, 254, 0, 255, 255, 8, 19, 0, 37, 37, 37, 32, 38, 37, 37, 32, 37, 37, 37, 37, 37, 32, 38, 37, 37, 37, 37,
+    37, 37, 32, 37, 254, 0, 0, 255, 8, 18, 0, 38, 37, 37, 37, 37, 37, 37, 37, 37, 38, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    38, 37, 37, 37, 37, 37, 37, 37, 37, 37, 38, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 8, 17, 0, 37, 42, 38, 37, 37, 37,
+    37, 42, 37, 37, 37, 38, 37, 42, 37, 37, 37, 37, 42, 37, 37, 38, 42, 37, 37, 42, 37, 37, 42, 37, 37, 38, 254, 0, 1, 255,
+    8, 8, 0, 37, 37, 42, 37, 42, 37, 42, 38, 37, 42, 37, 42, 37, 37, 42, 37, 42, 38, 42, 37, 37, 42, 37, 42, 37, 42, 37,
+    43, 37, 42, 42, 37, 42, 37, 42, 254, 0, 1, 255, 8, 7, 0, 37, 43, 37, 42, 42, 37, 42, 42, 37, 42, 43, 42, 37, 42, 42,
+    37, 42, 42, 37, 42, 43, 42, 42, 42, 42, 42, 37, 42, 42, 42, 43, 42, 42, 42, 42, 42, 42, 67, 42, 43, 42, 42, 42, 42, 67,
+    42, 254, 0, 1, 255, 8, 6, 0, 42, 67, 43, 42, 42, 67, 42, 42, 42, 67, 42, 42, 68, 42, 67, 42, 42, 67, 42, 67, 42, 42,
+    68, 42, 67, 42, 67, 42, 67, 42, 67, 43, 67, 42, 67, 42, 67, 42, 67, 42, 67, 43, 67, 42, 67, 42, 67, 42, 67, 42, 67, 43,
+    67, 42, 67, 42, 67, 42, 67, 42, 255, 31, 0, 16, 0, 16, 0, 16, 16, 0, 61, 61, 61, 61, 61, 61, 61, 36, 61, 66, 61, 36,
+    61, 61, 254, 255, 0, 255, 16, 23, 0, 61, 36, 61, 36, 66, 36, 61, 36, 36, 61, 36, 36, 36, 61, 254, 255, 1, 255, 16, 22, 0,
+    36, 36, 36, 36, 36, 36, 36, 36, 41, 36, 37, 36, 254, 255, 0, 255, 16, 21, 0, 36, 37, 36, 36, 37, 41, 36, 37, 36, 37, 36,
+    37, 36, 37, 254, 255, 0, 255, 16, 20, 0, 42, 36, 37, 36, 37, 37, 36, 37, 37, 36, 42, 36, 37, 37, 254, 255, 0, 255, 16, 19,
+    0, 37, 37, 37, 36, 42, 37, 37, 36, 37, 37, 37, 37, 37, 36, 42, 37, 37, 37, 37, 37, 37, 36, 37, 254, 0, 0, 255, 16, 18,
+    0, 42, 37, 37, 37, 37, 37, 37, 37, 37, 42, 37, 37, 37, 37, 37, 37, 37, 37, 37, 42, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    42, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 16, 17, 0, 37, 38, 42, 37, 37, 37, 37, 38, 37, 37, 37, 42, 37, 38, 37, 37,
+    37, 37, 38, 37, 37, 42, 38, 37, 37, 38, 37, 37, 38, 37, 37, 42, 254, 1, 0, 255, 16, 8, 0, 37, 37, 38, 37, 38, 37, 38,
+    42, 37, 38, 37, 38, 37, 37, 38, 37, 38, 42, 38, 37, 37, 38, 37, 38, 37, 38, 37, 43, 37, 38, 38, 37, 38, 37, 38, 254, 1,
+    0, 255, 16, 7, 0, 37, 43, 37, 38, 38, 37, 38, 38, 37, 38, 43, 38, 37, 38, 38, 37, 38, 38, 37, 38, 43, 38, 38, 38, 38,
+    38, 37, 38, 38, 38, 43, 38, 38, 38, 38, 38, 38, 63, 38, 43, 38, 38, 38, 38, 63, 38, 254, 1, 0, 255, 16, 6, 0, 38, 63,
+    43, 38, 38, 63, 38, 38, 38, 63, 38, 38, 68, 38, 63, 38, 38, 63, 38, 63, 38, 38, 68, 38, 63, 38, 63, 38, 63, 38, 63, 43,
+    63, 38, 63, 38, 63, 38, 63, 38, 63, 43, 63, 38, 63, 38, 63, 38, 63, 38, 63, 43, 63, 38, 63, 38, 63, 38, 63, 38, 255, 16,
+    0, 0, 0, 16, 0, 24, 16, 0, 67, 67, 67, 67, 67, 67, 67, 42, 67, 68, 67, 42, 67, 67, 254, 0, 1, 255, 24, 23, 0, 67,
+    42, 67, 42, 68, 42, 67, 42, 42, 67, 42, 42, 42, 67, 254, 1, 1, 255, 24, 22, 0, 42, 42, 42, 42, 42, 42, 42, 42, 43, 42,
+    37, 42, 254, 0, 1, 255, 24, 21, 0, 42, 37, 42, 42, 37, 43, 42, 37, 42, 37, 42, 37, 42, 37, 254, 0, 1, 255, 24, 20, 0,
+    38, 42, 37, 42, 37, 37, 42, 37, 37, 42, 38, 42, 37, 37, 254, 0, 1, 255, 24, 19, 0, 37, 37, 37, 42, 38, 37, 37, 42, 37,
+    37, 37, 37, 37, 42, 38, 37, 37, 37, 37, 37, 37, 42, 37, 254, 0, 0, 255, 24, 18, 0, 38, 37, 37, 37, 37, 37, 37, 37, 37,
+    38, 37, 37, 37, 37, 37, 37, 37, 37, 37, 38, 37, 37, 37, 37, 37, 37, 37, 37, 37, 38, 37, 37, 37, 37, 37, 37, 254, 0, 0,
+    255, 24, 17, 0, 37, 32, 38, 37, 37, 37, 37, 32, 37, 37, 37, 38, 37, 32, 37, 37, 37, 37, 32, 37, 37, 38, 32, 37, 37, 32,
+    37, 37, 32, 37, 37, 38, 254, 0, 255, 255, 24, 8, 0, 37, 37, 32, 37, 32, 37, 32, 38, 37, 32, 37, 32, 37, 37, 32, 37, 32,
+    38, 32, 37, 37, 32, 37, 32, 37, 32, 37, 33, 37, 32, 32, 37, 32, 37, 32, 254, 0, 255, 255, 24, 7, 0, 37, 33, 37, 32, 32,
+    37, 32, 32, 37, 32, 33, 32, 37, 32, 32, 37, 32, 32, 37, 32, 33, 32, 32, 32, 32, 32, 37, 32, 32, 32, 33, 32, 32, 32, 32,
+    32, 32, 57, 32, 33, 32, 32, 32, 32, 57, 32, 254, 0, 255, 255, 24, 6, 0, 32, 57, 33, 32, 32, 57, 32, 32, 32, 57, 32, 32,
+    58, 32, 57, 32, 32, 57, 32, 57, 32, 32, 58, 32, 57, 32, 57, 32, 57, 32, 57, 33, 57, 32, 57, 32, 57, 32, 57, 32, 57, 33,
+    57, 32, 57, 32, 57, 32, 57, 32, 57, 33, 57, 32, 57, 32, 57, 32, 57, 32, 255, 0, 0, 16, 0, 16, 0, 0, 16, 0, 63, 63,
+    63, 63, 63, 63, 63, 38, 63, 58, 63, 38, 63, 63, 254, 1, 0, 255, 0, 23, 0, 63, 38, 63, 38, 58, 38, 63, 38, 38, 63, 38,
+    38, 38, 63, 254, 1, 255, 255, 0, 22, 0, 38, 38, 38, 38, 38, 38, 38, 38, 33, 38, 37, 38, 254, 1, 0, 255, 0, 21, 0, 38,
+    37, 38, 38, 37, 33, 38, 37, 38, 37, 38, 37, 38, 37, 254, 1, 0, 255, 0, 20, 0, 32, 38, 37, 38, 37, 37, 38, 37, 37, 38,
+    32, 38, 37, 37, 254, 1, 0, 255, 0, 19, 0, 37, 37, 37, 38, 32, 37, 37, 38, 37, 37, 37, 37, 37, 38, 32, 37, 37, 37, 37,
+    37, 37, 38, 37, 254, 0, 0, 255, 0, 18, 0, 32, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 0, 17, 0, 37, 36, 32, 37, 37, 37,
+    37, 36, 37, 37, 37, 32, 37, 36, 37, 37, 37, 37, 36, 37, 37, 32, 36, 37, 37, 36, 37, 37, 36, 37, 37, 32, 254, 255, 0, 255,
+    0, 8, 0, 37, 37, 36, 37, 36, 37, 36, 32, 37, 36, 37, 36, 37, 37, 36, 37, 36, 32, 36, 37, 37, 36, 37, 36, 37, 36, 37,
+    31, 37, 36, 36, 37, 36, 37, 36, 254, 255, 0, 255, 0, 7, 0, 37, 31, 37, 36, 36, 37, 36, 36, 37, 36, 31, 36, 37, 36, 36,
+    37, 36, 36, 37, 36, 31, 36, 36, 36, 36, 36, 37, 36, 36, 36, 31, 36, 36, 36, 36, 36, 36, 61, 36, 31, 36, 36, 36, 36, 61,
+    36, 254, 255, 0, 255, 0, 6, 0, 36, 61, 31, 36, 36, 61, 36, 36, 36, 61, 36, 36, 56, 36, 61, 36, 36, 61, 36, 61, 36, 36,
+    56, 36, 61, 36, 61, 36, 61, 36, 61, 31, 61, 36, 61, 36, 61, 36, 61, 36, 61, 31, 61, 36, 61, 36, 61, 36, 61, 36, 61, 31,
+    61, 36, 61, 36, 61, 36, 61, 36, 255, 16, 0, 31, 0, 16, 0, 8, 16, 0, 57, 57, 57, 57, 57, 57, 57, 32, 57, 56, 57, 32,
+    57, 57, 254, 0, 255, 255, 8, 23, 0, 57, 32, 57, 32, 56, 32, 57, 32, 32, 57, 32, 32, 32, 57, 254, 255, 255, 255, 8, 22, 0,
+    32, 32, 32, 32, 32, 32, 32, 32, 31, 32, 37, 32, 254, 0, 255, 255, 8, 21, 0, 32, 37, 32, 32, 37, 31, 32, 37, 32, 37, 32,
+    37, 32, 37, 254, 0, 255, 255, 8, 20, 0, 36, 32, 37, 32, 37, 37, 32, 37, 37, 32, 36, 32, 37, 37, 254, 0, 255, 255, 8, 19,
+    0, 37, 37, 37, 32, 36, 37, 37, 32, 37, 37, 37, 37, 37, 32, 36, 37, 37, 37, 37, 37, 37, 32, 37, 254, 0, 0, 255, 8, 18,
+    0, 36, 37, 37, 37, 37, 37, 37, 37, 37, 36, 37, 37, 37, 37, 37, 37, 37, 37, 37, 36, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    36, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 8, 17, 0, 37, 42, 36, 37, 37, 37, 37, 42, 37, 37, 37, 36, 37, 42, 37, 37,
+    37, 37, 42, 37, 37, 36, 42, 37, 37, 42, 37, 37, 42, 37, 37, 36, 254, 0, 1, 255, 8, 8, 0, 37, 37, 42, 37, 42, 37, 42,
+    36, 37, 42, 37, 42, 37, 37, 42, 37, 42, 36, 42, 37, 37, 42, 37, 42, 37, 42, 37, 41, 37, 42, 42, 37, 42, 37, 42, 254, 0,
+    1, 255, 8, 7, 0, 37, 41, 37, 42, 42, 37, 42, 42, 37, 42, 41, 42, 37, 42, 42, 37, 42, 42, 37, 42, 41, 42, 42, 42, 42,
+    42, 37, 42, 42, 42, 41, 42, 42, 42, 42, 42, 42, 67, 42, 41, 42, 42, 42, 42, 67, 42, 254, 0, 1, 255, 8, 6, 0, 42, 67,
+    41, 42, 42, 67, 42, 42, 42, 67, 42, 42, 66, 42, 67, 42, 42, 67, 42, 67, 42, 42, 66, 42, 67, 42, 67, 42, 67, 42, 67, 41,
+    67, 42, 67, 42, 67, 42, 67, 42, 67, 41, 67, 42, 67, 42, 67, 42, 67, 42, 67, 41, 67, 42, 67, 42, 67, 42, 67, 42, 255, 31,
+    0, 16, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 14, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 254, 255, 0, 0, 0, 0, 13, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 12, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 11, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0,
+    10, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 19, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    254, 255, 0, 0, 0, 0, 18, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 16, 16, 0, 61, 61, 61, 61,
+    61, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 14, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 13, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 12, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 11, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1,
+    0, 8, 0, 10, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 19, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 254, 0, 1, 0, 8, 0, 18, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 24, 16, 0, 67,
+    67, 67, 67, 67, 255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 14, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 13, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0,
+    12, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 11, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    254, 1, 0, 0, 16, 0, 10, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 19, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 18, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 0,
+    16, 0, 63, 63, 63, 63, 63, 255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 14, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 13, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255,
+    0, 24, 0, 12, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 11, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 254, 0, 255, 0, 24, 0, 10, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 19, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 18, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0,
+    255, 0, 8, 16, 0, 57, 57, 57, 57, 57, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0,
+    9, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 8, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    254, 255, 0, 0, 0, 0, 7, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 6, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 5, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0,
+    0, 17, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 16, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 254, 255, 0, 0, 16, 16, 0, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67, 254, 0, 1,
+    0, 8, 0, 9, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 8, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 254, 0, 1, 0, 8, 0, 7, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 6, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 5, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0,
+    1, 0, 8, 0, 17, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 16, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 254, 0, 1, 0, 24, 16, 0, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63,
+    254, 1, 0, 0, 16, 0, 9, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 8, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 7, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16,
+    0, 6, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 5, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 254, 1, 0, 0, 16, 0, 17, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 16, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 0, 16, 0, 63, 63, 63, 63, 63, 255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57,
+    57, 57, 57, 254, 0, 255, 0, 24, 0, 9, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 8, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 7, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0,
+    255, 0, 24, 0, 6, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 5, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 17, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 16, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 8, 16, 0, 57, 57, 57, 57, 57, 255, 31, 0, 16, 0, 0, 0, 0,
+    0, 0, 61, 61, 61, 61, 254, 255, 0, 0, 16, 23, 0, 36, 61, 61, 36, 254, 255, 0, 0, 16, 22, 0, 36, 36, 36, 36, 254, 255,
+    0, 0, 16, 21, 0, 36, 36, 36, 36, 36, 36, 37, 254, 255, 0, 255, 16, 20, 0, 36, 37, 36, 37, 36, 37, 37, 36, 254, 0, 0,
+    255, 16, 19, 0, 36, 37, 36, 37, 37, 36, 37, 37, 37, 36, 37, 37, 37, 254, 0, 0, 255, 16, 18, 0, 36, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 38, 37, 37, 37, 254, 0, 0, 255,
+    16, 17, 0, 38, 37, 37, 37, 38, 37, 37, 38, 37, 37, 38, 37, 37, 38, 37, 37, 38, 37, 37, 38, 254, 0, 0, 255, 16, 58, 0,
+    38, 38, 37, 38, 38, 37, 38, 37, 38, 38, 38, 37, 38, 38, 38, 254, 0, 0, 255, 16, 57, 0, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 63, 38, 38, 38, 63, 38, 38, 38, 38, 63, 38, 254, 1, 0, 0, 16, 56, 0, 38, 63, 38, 63, 38, 63, 38, 63, 38,
+    63, 38, 63, 38, 63, 63, 38, 63, 38, 63, 38, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67, 254, 0, 1, 0, 24,
+    23, 0, 42, 67, 67, 42, 254, 0, 1, 0, 24, 22, 0, 42, 42, 42, 42, 254, 0, 1, 0, 24, 21, 0, 42, 42, 42, 42, 42, 42,
+    37, 254, 0, 1, 255, 24, 20, 0, 42, 37, 42, 37, 42, 37, 37, 42, 254, 0, 0, 255, 24, 19, 0, 42, 37, 42, 37, 37, 42, 37,
+    37, 37, 42, 37, 37, 37, 254, 0, 0, 255, 24, 18, 0, 42, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 254, 0, 0, 255, 24, 17, 0, 32, 37, 37, 37, 32, 37, 37, 32,
+    37, 37, 32, 37, 37, 32, 37, 37, 32, 37, 37, 32, 254, 0, 0, 255, 24, 58, 0, 32, 32, 37, 32, 32, 37, 32, 37, 32, 32, 32,
+    37, 32, 32, 32, 254, 0, 0, 255, 24, 57, 0, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 57, 32, 32, 32, 57, 32, 32, 32,
+    32, 57, 32, 254, 0, 255, 0, 24, 56, 0, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 57, 32, 57, 32, 57, 32,
+    255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 254, 1, 0, 0, 0, 23, 0, 38, 63, 63, 38, 254, 1, 0, 0, 0,
+    22, 0, 38, 38, 38, 38, 254, 1, 0, 0, 0, 21, 0, 38, 38, 38, 38, 38, 38, 37, 254, 1, 0, 255, 0, 20, 0, 38, 37, 38,
+    37, 38, 37, 37, 38, 254, 0, 0, 255, 0, 19, 0, 38, 37, 38, 37, 37, 38, 37, 37, 37, 38, 37, 37, 37, 254, 0, 0, 255, 0,
+    18, 0, 38, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    36, 37, 37, 37, 254, 0, 0, 255, 0, 17, 0, 36, 37, 37, 37, 36, 37, 37, 36, 37, 37, 36, 37, 37, 36, 37, 37, 36, 37, 37,
+    36, 254, 0, 0, 255, 0, 58, 0, 36, 36, 37, 36, 36, 37, 36, 37, 36, 36, 36, 37, 36, 36, 36, 254, 0, 0, 255, 0, 57, 0,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 61, 36, 36, 36, 61, 36, 36, 36, 36, 61, 36, 254, 255, 0, 0, 0, 56, 0, 36,
+    61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 61, 36, 61, 36, 61, 36, 255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57,
+    57, 57, 57, 254, 0, 255, 0, 8, 23, 0, 32, 57, 57, 32, 254, 0, 255, 0, 8, 22, 0, 32, 32, 32, 32, 254, 0, 255, 0, 8,
+    21, 0, 32, 32, 32, 32, 32, 32, 37, 254, 0, 255, 255, 8, 20, 0, 32, 37, 32, 37, 32, 37, 37, 32, 254, 0, 0, 255, 8, 19,
+    0, 32, 37, 32, 37, 37, 32, 37, 37, 37, 32, 37, 37, 37, 254, 0, 0, 255, 8, 18, 0, 32, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 42, 37, 37, 37, 254, 0, 0, 255, 8, 17, 0,
+    42, 37, 37, 37, 42, 37, 37, 42, 37, 37, 42, 37, 37, 42, 37, 37, 42, 37, 37, 42, 254, 0, 0, 255, 8, 58, 0, 42, 42, 37,
+    42, 42, 37, 42, 37, 42, 42, 42, 37, 42, 42, 42, 254, 0, 0, 255, 8, 57, 0, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    67, 42, 42, 42, 67, 42, 42, 42, 42, 67, 42, 254, 0, 1, 0, 8, 56, 0, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67,
+    42, 67, 67, 42, 67, 42, 67, 42, 255, 31, 0, 16, 0, 0, 0, 16, 0, 0, 61, 61, 61, 61, 61, 36, 61, 254, 255, 0, 0, 24,
+    33, 0, 61, 61, 36, 61, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 36, 254, 255, 0, 255, 24, 32, 0, 61, 31, 36, 36, 36, 36,
+    36, 31, 36, 37, 36, 36, 31, 37, 36, 254, 0, 255, 255, 24, 31, 0, 36, 36, 37, 31, 37, 31, 37, 36, 32, 37, 31, 37, 31, 37,
+    32, 32, 254, 255, 0, 255, 24, 30, 0, 32, 37, 31, 32, 32, 37, 32, 31, 32, 32, 32, 32, 32, 31, 57, 254, 0, 255, 255, 24, 29,
+    0, 32, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 57, 32, 57, 57, 57, 254, 0, 255, 0, 8, 16, 0, 32, 57, 57, 57, 57, 57,
+    255, 16, 0, 0, 0, 0, 0, 24, 0, 0, 67, 67, 67, 67, 67, 42, 67, 254, 0, 1, 0, 0, 33, 0, 67, 67, 42, 67, 67, 42,
+    67, 42, 67, 42, 67, 42, 67, 42, 42, 254, 0, 1, 255, 0, 32, 0, 67, 41, 42, 42, 42, 42, 42, 41, 42, 37, 42, 42, 41, 37,
+    42, 254, 255, 0, 255, 0, 31, 0, 42, 42, 37, 41, 37, 41, 37, 42, 36, 37, 41, 37, 41, 37, 36, 36, 254, 0, 1, 255, 0, 30,
+    0, 36, 37, 41, 36, 36, 37, 36, 41, 36, 36, 36, 36, 36, 41, 61, 254, 255, 0, 255, 0, 29, 0, 36, 36, 61, 36, 61, 36, 61,
+    36, 61, 36, 61, 61, 36, 61, 61, 61, 254, 255, 0, 0, 16, 16, 0, 36, 61, 61, 61, 61, 61, 255, 0, 0, 16, 0, 0, 0, 0,
+    0, 0, 63, 63, 63, 63, 63, 38, 63, 254, 1, 0, 0, 8, 33, 0, 63, 63, 38, 63, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38,
+    38, 254, 1, 0, 255, 8, 32, 0, 63, 43, 38, 38, 38, 38, 38, 43, 38, 37, 38, 38, 43, 37, 38, 254, 0, 1, 255, 8, 31, 0,
+    38, 38, 37, 43, 37, 43, 37, 38, 42, 37, 43, 37, 43, 37, 42, 42, 254, 1, 0, 255, 8, 30, 0, 42, 37, 43, 42, 42, 37, 42,
+    43, 42, 42, 42, 42, 42, 43, 67, 254, 0, 1, 255, 8, 29, 0, 42, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 67, 42, 67, 67,
+    67, 254, 0, 1, 0, 24, 16, 0, 42, 67, 67, 67, 67, 67, 255, 16, 0, 31, 0, 0, 0, 8, 0, 0, 57, 57, 57, 57, 57, 32,
+    57, 254, 0, 255, 0, 16, 33, 0, 57, 57, 32, 57, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 32, 254, 0, 255, 255, 16, 32, 0,
+    57, 33, 32, 32, 32, 32, 32, 33, 32, 37, 32, 32, 33, 37, 32, 254, 1, 0, 255, 16, 31, 0, 32, 32, 37, 33, 37, 33, 37, 32,
+    38, 37, 33, 37, 33, 37, 38, 38, 254, 0, 255, 255, 16, 30, 0, 38, 37, 33, 38, 38, 37, 38, 33, 38, 38, 38, 38, 38, 33, 63,
+    254, 1, 0, 255, 16, 29, 0, 38, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 63, 38, 63, 63, 63, 254, 1, 0, 0, 0, 16, 0,
+    38, 63, 63, 63, 63, 63, 255, 31, 0, 16, 0, 0, 0, 16, 0, 0, 61, 61, 61, 61, 61, 36, 61, 254, 255, 0, 0, 8, 43, 0,
+    61, 61, 36, 61, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 36, 254, 255, 0, 255, 8, 42, 0, 61, 41, 36, 36, 36, 36, 36, 41,
+    36, 37, 36, 36, 41, 37, 36, 254, 0, 1, 255, 8, 41, 0, 36, 36, 37, 41, 37, 41, 37, 36, 42, 37, 41, 37, 41, 37, 42, 42,
+    254, 255, 0, 255, 8, 40, 0, 42, 37, 41, 42, 42, 37, 42, 41, 42, 42, 42, 42, 42, 41, 67, 254, 0, 1, 255, 8, 39, 0, 42,
+    42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 67, 42, 67, 67, 67, 254, 0, 1, 0, 24, 16, 0, 42, 67, 67, 67, 67, 67, 255, 16,
+    0, 0, 0, 0, 0, 24, 0, 0, 67, 67, 67, 67, 67, 42, 67, 254, 0, 1, 0, 16, 43, 0, 67, 67, 42, 67, 67, 42, 67, 42,
+    67, 42, 67, 42, 67, 42, 42, 254, 0, 1, 255, 16, 42, 0, 67, 43, 42, 42, 42, 42, 42, 43, 42, 37, 42, 42, 43, 37, 42, 254,
+    1, 0, 255, 16, 41, 0, 42, 42, 37, 43, 37, 43, 37, 42, 38, 37, 43, 37, 43, 37, 38, 38, 254, 0, 1, 255, 16, 40, 0, 38,
+    37, 43, 38, 38, 37, 38, 43, 38, 38, 38, 38, 38, 43, 63, 254, 1, 0, 255, 16, 39, 0, 38, 38, 63, 38, 63, 38, 63, 38, 63,
+    38, 63, 63, 38, 63, 63, 63, 254, 1, 0, 0, 0, 16, 0, 38, 63, 63, 63, 63, 63, 255, 0, 0, 16, 0, 0, 0, 0, 0, 0,
+    63, 63, 63, 63, 63, 38, 63, 254, 1, 0, 0, 24, 43, 0, 63, 63, 38, 63, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 38, 254,
+    1, 0, 255, 24, 42, 0, 63, 33, 38, 38, 38, 38, 38, 33, 38, 37, 38, 38, 33, 37, 38, 254, 0, 255, 255, 24, 41, 0, 38, 38,
+    37, 33, 37, 33, 37, 38, 32, 37, 33, 37, 33, 37, 32, 32, 254, 1, 0, 255, 24, 40, 0, 32, 37, 33, 32, 32, 37, 32, 33, 32,
+    32, 32, 32, 32, 33, 57, 254, 0, 255, 255, 24, 39, 0, 32, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 57, 32, 57, 57, 57, 254,
+    0, 255, 0, 8, 16, 0, 32, 57, 57, 57, 57, 57, 255, 16, 0, 31, 0, 0, 0, 8, 0, 0, 57, 57, 57, 57, 57, 32, 57, 254,
+    0, 255, 0, 0, 43, 0, 57, 57, 32, 57, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 32, 254, 0, 255, 255, 0, 42, 0, 57, 31,
+    32, 32, 32, 32, 32, 31, 32, 37, 32, 32, 31, 37, 32, 254, 255, 0, 255, 0, 41, 0, 32, 32, 37, 31, 37, 31, 37, 32, 36, 37,
+    31, 37, 31, 37, 36, 36, 254, 0, 255, 255, 0, 40, 0, 36, 37, 31, 36, 36, 37, 36, 31, 36, 36, 36, 36, 36, 31, 61, 254, 255,
+    0, 255, 0, 39, 0, 36, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 61, 36, 61, 61, 61, 254, 255, 0, 0, 16, 16, 0, 36, 61,
+    61, 61, 61, 61, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 1, 0, 1, 0,
+    61, 61, 61, 61, 61, 86, 61, 61, 61, 86, 61, 61, 86, 254, 255, 0, 0, 0, 2, 0, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61,
+    86, 61, 86, 61, 61, 254, 255, 0, 1, 0, 1, 0, 61, 61, 86, 61, 61, 86, 61, 61, 61, 86, 61, 61, 61, 254, 255, 0, 0, 0,
+    0, 0, 61, 86, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 0, 0,
+    0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254,
+    1, 0, 1, 16, 1, 0, 63, 63, 63, 63, 63, 88, 63, 63, 63, 88, 63, 63, 88, 254, 1, 0, 0, 16, 2, 0, 88, 63, 88, 63,
+    88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 63, 254, 1, 0, 1, 16, 1, 0, 63, 63, 88, 63, 63, 88, 63, 63, 63, 88, 63, 63,
+    63, 254, 1, 0, 0, 16, 0, 0, 63, 88, 63, 63, 63, 63, 63, 63, 63, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 254, 0, 1, 1, 8, 1, 0, 67, 67, 67, 67, 67, 92, 67, 67, 67, 92, 67, 67, 92, 254, 0, 1, 0,
+    8, 2, 0, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 254, 0, 1, 1, 8, 1, 0, 67, 67, 92, 67, 67,
+    92, 67, 67, 67, 92, 67, 67, 67, 254, 0, 1, 0, 8, 0, 0, 67, 92, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 1, 24, 1, 0, 57, 57, 57, 57, 57, 82, 57, 57, 57, 82, 57,
+    57, 82, 254, 0, 255, 0, 24, 2, 0, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 254, 0, 255, 1, 24, 1,
+    0, 57, 57, 82, 57, 57, 82, 57, 57, 57, 82, 57, 57, 57, 254, 0, 255, 0, 24, 0, 0, 57, 82, 57, 57, 57, 57, 57, 57, 57,
+    255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 1, 16, 1, 0, 63, 63, 63, 63,
+    63, 88, 63, 63, 63, 88, 63, 63, 88, 254, 1, 0, 0, 16, 2, 0, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88,
+    63, 254, 1, 0, 1, 16, 1, 0, 63, 63, 88, 63, 63, 88, 63, 63, 63, 88, 63, 63, 63, 254, 1, 0, 0, 16, 0, 0, 63, 88,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 0, 0, 0, 0, 0, 0,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 1, 0,
+    1, 0, 61, 61, 61, 61, 61, 86, 61, 61, 61, 86, 61, 61, 86, 254, 255, 0, 0, 0, 2, 0, 61, 86, 61, 86, 61, 86, 61, 86,
+    61, 86, 61, 86, 61, 86, 61, 254, 255, 0, 1, 0, 1, 0, 61, 61, 86, 61, 61, 86, 61, 61, 61, 86, 61, 61, 61, 254, 255, 0,
+    0, 0, 0, 0, 61, 86, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 254, 0, 255, 1, 24, 1, 0, 57, 57, 57, 57, 57, 82, 57, 57, 57, 82, 57, 57, 82, 254, 0, 255, 0, 24, 2, 0, 82,
+    57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 57, 254, 0, 255, 1, 24, 1, 0, 57, 57, 82, 57, 57, 82, 57, 57, 57,
+    82, 57, 57, 57, 254, 0, 255, 0, 24, 0, 0, 57, 82, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 254, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 1, 8, 1, 0, 67, 67, 67, 67, 67, 92, 67, 67, 67, 92, 67, 67, 92, 254, 0,
+    1, 0, 8, 2, 0, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 67, 254, 0, 1, 1, 8, 1, 0, 67, 67, 92,
+    67, 67, 92, 67, 67, 67, 92, 67, 67, 67, 254, 0, 1, 0, 8, 0, 0, 67, 92, 67, 67, 67, 67, 67, 67, 67, 255, 31, 0, 16,
+    0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 36, 61, 254, 255, 0, 0, 0, 5, 0, 61, 61, 61, 36, 61, 61, 61, 36,
+    61, 61, 36, 61, 61, 254, 255, 0, 255, 0, 6, 0, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 254, 255, 0,
+    0, 0, 5, 0, 36, 61, 61, 36, 61, 61, 61, 36, 61, 61, 61, 61, 61, 254, 255, 0, 255, 0, 0, 0, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 38, 63, 254, 1, 0, 0, 16, 5, 0, 63, 63,
+    63, 38, 63, 63, 63, 38, 63, 63, 38, 63, 63, 254, 1, 0, 255, 16, 6, 0, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38,
+    63, 38, 63, 254, 1, 0, 0, 16, 5, 0, 38, 63, 63, 38, 63, 63, 63, 38, 63, 63, 63, 63, 63, 254, 1, 0, 255, 16, 0, 0,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 42, 67, 254, 0,
+    1, 0, 8, 5, 0, 67, 67, 67, 42, 67, 67, 67, 42, 67, 67, 42, 67, 67, 254, 0, 1, 255, 8, 6, 0, 67, 67, 42, 67, 42,
+    67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 254, 0, 1, 0, 8, 5, 0, 42, 67, 67, 42, 67, 67, 67, 42, 67, 67, 67, 67, 67,
+    254, 0, 1, 255, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 254, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 32, 57, 254, 0, 255, 0, 24, 5, 0, 57, 57, 57, 32, 57, 57, 57, 32, 57, 57, 32, 57, 57, 254, 0, 255, 255, 24, 6,
+    0, 57, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 254, 0, 255, 0, 24, 5, 0, 32, 57, 57, 32, 57, 57, 57,
+    32, 57, 57, 57, 57, 57, 254, 0, 255, 255, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 255, 0, 0, 16, 0, 0, 0, 16,
+    0, 0, 63, 63, 63, 63, 63, 63, 63, 38, 63, 254, 1, 0, 0, 16, 5, 0, 63, 63, 63, 38, 63, 63, 63, 38, 63, 63, 38, 63,
+    63, 254, 1, 0, 255, 16, 6, 0, 63, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 254, 1, 0, 0, 16, 5, 0,
+    38, 63, 63, 38, 63, 63, 63, 38, 63, 63, 63, 63, 63, 254, 1, 0, 255, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 36, 61, 254, 255, 0, 0, 0, 5, 0, 61, 61, 61, 36, 61, 61,
+    61, 36, 61, 61, 36, 61, 61, 254, 255, 0, 255, 0, 6, 0, 61, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 254,
+    255, 0, 0, 0, 5, 0, 36, 61, 61, 36, 61, 61, 61, 36, 61, 61, 61, 61, 61, 254, 255, 0, 255, 0, 0, 0, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 32, 57, 254, 0, 255, 0, 24, 5,
+    0, 57, 57, 57, 32, 57, 57, 57, 32, 57, 57, 32, 57, 57, 254, 0, 255, 255, 24, 6, 0, 57, 32, 57, 32, 57, 32, 57, 32, 57,
+    32, 57, 32, 57, 32, 57, 254, 0, 255, 0, 24, 5, 0, 32, 57, 57, 32, 57, 57, 57, 32, 57, 57, 57, 57, 57, 254, 0, 255, 255,
+    24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0,
+    0, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 42, 67,
+    254, 0, 1, 0, 8, 5, 0, 67, 67, 67, 42, 67, 67, 67, 42, 67, 67, 42, 67, 67, 254, 0, 1, 255, 8, 6, 0, 67, 42, 67,
+    42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 254, 0, 1, 0, 8, 5, 0, 42, 67, 67, 42, 67, 67, 67, 42, 67, 67, 67,
+    67, 67, 254, 0, 1, 255, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 61, 61,
+    61, 61, 254, 255, 0, 0, 0, 0, 1, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 2, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 5, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0,
+    0, 0, 6, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 7, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 254, 255, 0, 0, 0, 0, 8, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 9, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 16, 16, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0,
+    0, 0, 14, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 13, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 254, 255, 0, 0, 0, 0, 12, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 11, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 10, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0,
+    0, 0, 4, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 3, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 254, 255, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67, 254,
+    0, 1, 0, 8, 0, 1, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 2, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 5, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 6,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 7, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254,
+    0, 1, 0, 8, 0, 8, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 9, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 254, 0, 1, 0, 24, 16, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 14,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 13, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254,
+    0, 1, 0, 8, 0, 12, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 11, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 10, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 4,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 3, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254,
+    0, 1, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 254, 1, 0, 0,
+    16, 0, 1, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 2, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 254, 1, 0, 0, 16, 0, 5, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 6, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 7, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0,
+    16, 0, 8, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 9, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 254, 1, 0, 0, 0, 16, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 14, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 13, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0,
+    16, 0, 12, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 11, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 254, 1, 0, 0, 16, 0, 10, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 4, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 3, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0,
+    16, 0, 0, 63, 63, 63, 63, 63, 63, 255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 1,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 2, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254,
+    0, 255, 0, 24, 0, 5, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 6, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 7, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 8,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 9, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254,
+    0, 255, 0, 8, 16, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 14, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 13, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 12,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 11, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254,
+    0, 255, 0, 24, 0, 10, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 4, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 3, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 0,
+    57, 57, 57, 57, 57, 57, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 3, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 4, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0,
+    0, 0, 10, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 11, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 254, 255, 0, 0, 0, 0, 12, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 13, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 14, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0,
+    16, 16, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 9, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 254, 255, 0, 0, 0, 0, 8, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 7, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 6, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0,
+    0, 0, 5, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 2, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 254, 255, 0, 0, 0, 0, 1, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0, 0, 61, 61, 61,
+    61, 61, 61, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 3, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 4, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 10,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 11, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254,
+    0, 1, 0, 8, 0, 12, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 13, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 14, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 24, 16, 0,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 9, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254,
+    0, 1, 0, 8, 0, 8, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 7, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 6, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 5,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 2, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254,
+    0, 1, 0, 8, 0, 1, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67,
+    255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 3, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 254, 1, 0, 0, 16, 0, 4, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 10, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 11, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0,
+    16, 0, 12, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 13, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 254, 1, 0, 0, 16, 0, 14, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 0, 16, 0, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 9, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0,
+    16, 0, 8, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 7, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 254, 1, 0, 0, 16, 0, 6, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 5, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 2, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0,
+    16, 0, 1, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 255, 16, 0,
+    31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 3, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254,
+    0, 255, 0, 24, 0, 4, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 10, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 11, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 12,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 13, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254,
+    0, 255, 0, 24, 0, 14, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 8, 16, 0, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 9, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 8,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 7, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254,
+    0, 255, 0, 24, 0, 6, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 5, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 2, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 1,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 255, 31, 0, 16, 0, 0,
+    0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 36, 254, 255, 0, 0, 16, 23, 0, 61, 61, 61, 36, 61, 61, 61, 36, 61, 61, 254,
+    255, 0, 255, 16, 22, 0, 61, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 36, 61, 36, 61, 254, 255, 0, 255, 16, 21, 0, 36, 36,
+    61, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 37, 36, 36, 254, 255, 0, 255, 16, 20, 0, 37, 36, 36, 36, 37, 36,
+    36, 37, 36, 37, 36, 37, 36, 36, 37, 36, 37, 36, 37, 37, 36, 37, 36, 37, 254, 255, 0, 255, 16, 19, 0, 37, 37, 36, 37, 36,
+    37, 37, 36, 37, 37, 36, 37, 37, 37, 36, 37, 37, 37, 36, 37, 37, 37, 36, 37, 37, 37, 37, 36, 37, 37, 37, 37, 37, 36, 254,
+    0, 0, 255, 16, 18, 0, 37, 37, 37, 37, 37, 37, 37, 36, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 255, 16, 0, 0,
+    0, 0, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 42, 254, 0, 1, 0, 24, 23, 0, 67, 67, 67, 42, 67, 67, 67, 42, 67,
+    67, 254, 0, 1, 255, 24, 22, 0, 67, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 42, 67, 42, 67, 254, 0, 1, 255, 24, 21, 0,
+    42, 42, 67, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 37, 42, 42, 254, 0, 1, 255, 24, 20, 0, 37, 42, 42, 42,
+    37, 42, 42, 37, 42, 37, 42, 37, 42, 42, 37, 42, 37, 42, 37, 37, 42, 37, 42, 37, 254, 0, 1, 255, 24, 19, 0, 37, 37, 42,
+    37, 42, 37, 37, 42, 37, 37, 42, 37, 37, 37, 42, 37, 37, 37, 42, 37, 37, 37, 42, 37, 37, 37, 37, 42, 37, 37, 37, 37, 37,
+    42, 254, 0, 0, 255, 24, 18, 0, 37, 37, 37, 37, 37, 37, 37, 42, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 255, 0,
+    0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 38, 254, 1, 0, 0, 0, 23, 0, 63, 63, 63, 38, 63, 63, 63,
+    38, 63, 63, 254, 1, 0, 255, 0, 22, 0, 63, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 38, 63, 38, 63, 254, 1, 0, 255, 0,
+    21, 0, 38, 38, 63, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 37, 38, 38, 254, 1, 0, 255, 0, 20, 0, 37, 38,
+    38, 38, 37, 38, 38, 37, 38, 37, 38, 37, 38, 38, 37, 38, 37, 38, 37, 37, 38, 37, 38, 37, 254, 1, 0, 255, 0, 19, 0, 37,
+    37, 38, 37, 38, 37, 37, 38, 37, 37, 38, 37, 37, 37, 38, 37, 37, 37, 38, 37, 37, 37, 38, 37, 37, 37, 37, 38, 37, 37, 37,
+    37, 37, 38, 254, 0, 0, 255, 0, 18, 0, 37, 37, 37, 37, 37, 37, 37, 38, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 32, 254, 0, 255, 0, 8, 23, 0, 57, 57, 57, 32, 57,
+    57, 57, 32, 57, 57, 254, 0, 255, 255, 8, 22, 0, 57, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 32, 57, 32, 57, 254, 0, 255,
+    255, 8, 21, 0, 32, 32, 57, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 37, 32, 32, 254, 0, 255, 255, 8, 20, 0,
+    37, 32, 32, 32, 37, 32, 32, 37, 32, 37, 32, 37, 32, 32, 37, 32, 37, 32, 37, 37, 32, 37, 32, 37, 254, 0, 255, 255, 8, 19,
+    0, 37, 37, 32, 37, 32, 37, 37, 32, 37, 37, 32, 37, 37, 37, 32, 37, 37, 37, 32, 37, 37, 37, 32, 37, 37, 37, 37, 32, 37,
+    37, 37, 37, 37, 32, 254, 0, 0, 255, 8, 18, 0, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 255, 16, 0, 16, 0, 0, 0, 0, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 88, 87, 87, 87, 87, 87,
+    87, 87, 87, 254, 1, 0, 1, 0, 11, 0, 87, 87, 87, 87, 87, 88, 87, 87, 87, 87, 88, 87, 87, 87, 88, 87, 87, 87, 88, 87,
+    87, 87, 88, 87, 87, 88, 87, 87, 88, 87, 88, 87, 87, 254, 1, 0, 1, 0, 12, 0, 87, 88, 87, 88, 87, 87, 88, 87, 88, 87,
+    88, 88, 87, 88, 87, 88, 87, 88, 88, 87, 88, 88, 88, 87, 254, 1, 0, 1, 0, 13, 0, 88, 88, 87, 88, 88, 88, 88, 88, 88,
+    88, 88, 88, 88, 88, 88, 88, 63, 88, 88, 254, 1, 0, 1, 0, 14, 0, 63, 88, 63, 88, 88, 63, 88, 63, 88, 63, 88, 63, 88,
+    63, 63, 254, 1, 0, 1, 0, 15, 0, 63, 63, 88, 63, 63, 63, 88, 63, 63, 63, 254, 1, 0, 0, 0, 16, 0, 88, 63, 63, 63,
+    63, 63, 63, 63, 255, 16, 0, 16, 0, 0, 0, 8, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 82, 87, 87, 87,
+    87, 87, 87, 87, 87, 254, 0, 255, 1, 8, 11, 0, 87, 87, 87, 87, 87, 82, 87, 87, 87, 87, 82, 87, 87, 87, 82, 87, 87, 87,
+    82, 87, 87, 87, 82, 87, 87, 82, 87, 87, 82, 87, 82, 87, 87, 254, 0, 255, 1, 8, 12, 0, 87, 82, 87, 82, 87, 87, 82, 87,
+    82, 87, 82, 82, 87, 82, 87, 82, 87, 82, 82, 87, 82, 82, 82, 87, 254, 0, 255, 1, 8, 13, 0, 82, 82, 87, 82, 82, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 57, 82, 82, 254, 0, 255, 1, 8, 14, 0, 57, 82, 57, 82, 82, 57, 82, 57, 82, 57, 82,
+    57, 82, 57, 57, 254, 0, 255, 1, 8, 15, 0, 57, 57, 82, 57, 57, 57, 82, 57, 57, 57, 254, 0, 255, 0, 8, 16, 0, 82, 57,
+    57, 57, 57, 57, 57, 57, 255, 16, 0, 16, 0, 0, 0, 16, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 86, 87,
+    87, 87, 87, 87, 87, 87, 87, 254, 255, 0, 1, 16, 11, 0, 87, 87, 87, 87, 87, 86, 87, 87, 87, 87, 86, 87, 87, 87, 86, 87,
+    87, 87, 86, 87, 87, 87, 86, 87, 87, 86, 87, 87, 86, 87, 86, 87, 87, 254, 255, 0, 1, 16, 12, 0, 87, 86, 87, 86, 87, 87,
+    86, 87, 86, 87, 86, 86, 87, 86, 87, 86, 87, 86, 86, 87, 86, 86, 86, 87, 254, 255, 0, 1, 16, 13, 0, 86, 86, 87, 86, 86,
+    86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 61, 86, 86, 254, 255, 0, 1, 16, 14, 0, 61, 86, 61, 86, 86, 61, 86, 61, 86,
+    61, 86, 61, 86, 61, 61, 254, 255, 0, 1, 16, 15, 0, 61, 61, 86, 61, 61, 61, 86, 61, 61, 61, 254, 255, 0, 0, 16, 16, 0,
+    86, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 16, 0, 0, 0, 24, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    92, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 1, 1, 24, 11, 0, 87, 87, 87, 87, 87, 92, 87, 87, 87, 87, 92, 87, 87, 87,
+    92, 87, 87, 87, 92, 87, 87, 87, 92, 87, 87, 92, 87, 87, 92, 87, 92, 87, 87, 254, 0, 1, 1, 24, 12, 0, 87, 92, 87, 92,
+    87, 87, 92, 87, 92, 87, 92, 92, 87, 92, 87, 92, 87, 92, 92, 87, 92, 92, 92, 87, 254, 0, 1, 1, 24, 13, 0, 92, 92, 87,
+    92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 67, 92, 92, 254, 0, 1, 1, 24, 14, 0, 67, 92, 67, 92, 92, 67, 92,
+    67, 92, 67, 92, 67, 92, 67, 67, 254, 0, 1, 1, 24, 15, 0, 67, 67, 92, 67, 67, 67, 92, 67, 67, 67, 254, 0, 1, 0, 24,
+    16, 0, 92, 67, 67, 67, 67, 67, 67, 67, 255, 31, 0, 16, 0, 16, 0, 16, 16, 0, 61, 61, 61, 61, 61, 61, 61, 36, 254, 255,
+    0, 0, 16, 23, 0, 61, 61, 61, 36, 61, 61, 61, 36, 61, 61, 254, 255, 0, 255, 16, 22, 0, 61, 61, 36, 61, 36, 61, 36, 61,
+    36, 61, 36, 36, 61, 36, 61, 254, 255, 0, 255, 16, 21, 0, 36, 36, 61, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    37, 36, 36, 254, 255, 0, 255, 16, 20, 0, 37, 36, 36, 36, 37, 36, 36, 37, 36, 37, 36, 37, 36, 36, 37, 36, 37, 36, 37, 37,
+    36, 37, 36, 37, 254, 255, 0, 255, 16, 19, 0, 37, 37, 36, 37, 36, 37, 37, 36, 37, 37, 36, 37, 37, 37, 36, 37, 37, 37, 36,
+    37, 37, 37, 36, 37, 37, 37, 37, 36, 37, 37, 37, 37, 37, 36, 254, 0, 0, 255, 16, 18, 0, 37, 37, 37, 37, 37, 37, 37, 36,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 255, 16, 0, 0, 0, 16, 0, 24, 16, 0, 67, 67, 67, 67, 67, 67, 67, 42,
+    254, 0, 1, 0, 24, 23, 0, 67, 67, 67, 42, 67, 67, 67, 42, 67, 67, 254, 0, 1, 255, 24, 22, 0, 67, 67, 42, 67, 42, 67,
+    42, 67, 42, 67, 42, 42, 67, 42, 67, 254, 0, 1, 255, 24, 21, 0, 42, 42, 67, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 37, 42, 42, 254, 0, 1, 255, 24, 20, 0, 37, 42, 42, 42, 37, 42, 42, 37, 42, 37, 42, 37, 42, 42, 37, 42, 37, 42,
+    37, 37, 42, 37, 42, 37, 254, 0, 1, 255, 24, 19, 0, 37, 37, 42, 37, 42, 37, 37, 42, 37, 37, 42, 37, 37, 37, 42, 37, 37,
+    37, 42, 37, 37, 37, 42, 37, 37, 37, 37, 42, 37, 37, 37, 37, 37, 42, 254, 0, 0, 255, 24, 18, 0, 37, 37, 37, 37, 37, 37,
+    37, 42, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 255, 0, 0, 16, 0, 16, 0, 0, 16, 0, 63, 63, 63, 63, 63, 63,
+    63, 38, 254, 1, 0, 0, 0, 23, 0, 63, 63, 63, 38, 63, 63, 63, 38, 63, 63, 254, 1, 0, 255, 0, 22, 0, 63, 63, 38, 63,
+    38, 63, 38, 63, 38, 63, 38, 38, 63, 38, 63, 254, 1, 0, 255, 0, 21, 0, 38, 38, 63, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 37, 38, 38, 254, 1, 0, 255, 0, 20, 0, 37, 38, 38, 38, 37, 38, 38, 37, 38, 37, 38, 37, 38, 38, 37, 38,
+    37, 38, 37, 37, 38, 37, 38, 37, 254, 1, 0, 255, 0, 19, 0, 37, 37, 38, 37, 38, 37, 37, 38, 37, 37, 38, 37, 37, 37, 38,
+    37, 37, 37, 38, 37, 37, 37, 38, 37, 37, 37, 37, 38, 37, 37, 37, 37, 37, 38, 254, 0, 0, 255, 0, 18, 0, 37, 37, 37, 37,
+    37, 37, 37, 38, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 255, 16, 0, 31, 0, 16, 0, 8, 16, 0, 57, 57, 57, 57,
+    57, 57, 57, 32, 254, 0, 255, 0, 8, 23, 0, 57, 57, 57, 32, 57, 57, 57, 32, 57, 57, 254, 0, 255, 255, 8, 22, 0, 57, 57,
+    32, 57, 32, 57, 32, 57, 32, 57, 32, 32, 57, 32, 57, 254, 0, 255, 255, 8, 21, 0, 32, 32, 57, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 37, 32, 32, 254, 0, 255, 255, 8, 20, 0, 37, 32, 32, 32, 37, 32, 32, 37, 32, 37, 32, 37, 32, 32,
+    37, 32, 37, 32, 37, 37, 32, 37, 32, 37, 254, 0, 255, 255, 8, 19, 0, 37, 37, 32, 37, 32, 37, 37, 32, 37, 37, 32, 37, 37,
+    37, 32, 37, 37, 37, 32, 37, 37, 37, 32, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 32, 254, 0, 0, 255, 8, 18, 0, 37, 37,
+    37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 255, 31, 0, 16, 0, 0, 0, 0, 59, 0, 61, 61,
+    61, 254, 255, 0, 1, 31, 59, 0, 61, 56, 61, 61, 86, 61, 61, 56, 254, 255, 0, 0, 30, 59, 0, 86, 56, 61, 61, 81, 61, 56,
+    61, 81, 254, 255, 0, 0, 29, 59, 0, 56, 61, 56, 81, 61, 56, 81, 56, 254, 255, 255, 0, 28, 59, 0, 60, 81, 56, 56, 254, 255,
+    255, 0, 27, 59, 0, 82, 56, 56, 57, 81, 57, 56, 57, 254, 255, 255, 1, 26, 59, 0, 57, 56, 57, 82, 56, 57, 57, 56, 82, 254,
+    0, 255, 0, 25, 59, 0, 57, 57, 82, 56, 57, 57, 57, 254, 0, 255, 1, 24, 59, 0, 57, 57, 57, 255, 16, 0, 0, 0, 0, 0,
+    8, 59, 0, 67, 67, 67, 67, 254, 0, 1, 1, 7, 59, 0, 67, 66, 67, 67, 92, 67, 67, 66, 254, 0, 1, 0, 6, 59, 0, 92,
+    66, 67, 67, 91, 67, 66, 67, 91, 254, 0, 1, 0, 5, 59, 0, 66, 67, 66, 91, 67, 66, 91, 66, 254, 255, 1, 0, 4, 59, 0,
+    72, 91, 66, 66, 254, 255, 1, 0, 3, 59, 0, 86, 66, 66, 61, 91, 61, 66, 61, 254, 255, 1, 1, 2, 59, 0, 61, 66, 61, 86,
+    66, 61, 61, 66, 86, 254, 255, 0, 0, 1, 59, 0, 61, 61, 86, 66, 61, 61, 61, 254, 255, 0, 1, 0, 59, 0, 61, 61, 61, 255,
+    0, 0, 16, 0, 0, 0, 16, 59, 0, 63, 63, 63, 63, 254, 1, 0, 1, 15, 59, 0, 63, 68, 63, 63, 88, 63, 63, 68, 254, 1,
+    0, 1, 14, 59, 0, 63, 68, 63, 63, 93, 63, 68, 63, 93, 254, 1, 0, 0, 13, 59, 0, 68, 63, 93, 68, 63, 68, 93, 68, 254,
+    1, 1, 0, 12, 59, 0, 64, 93, 68, 68, 254, 1, 1, 1, 11, 59, 0, 67, 68, 68, 92, 68, 67, 68, 92, 254, 1, 1, 0, 10,
+    59, 0, 67, 68, 92, 67, 68, 67, 67, 93, 67, 254, 0, 1, 0, 9, 59, 0, 67, 92, 67, 68, 67, 67, 92, 254, 0, 1, 0, 8,
+    59, 0, 67, 67, 255, 16, 0, 31, 0, 0, 0, 24, 59, 0, 57, 57, 57, 254, 0, 255, 1, 23, 59, 0, 57, 58, 57, 57, 82, 57,
+    57, 58, 254, 0, 255, 1, 22, 59, 0, 57, 58, 57, 57, 83, 57, 58, 57, 83, 254, 0, 255, 0, 21, 59, 0, 58, 57, 83, 58, 57,
+    58, 83, 58, 254, 1, 255, 0, 20, 59, 0, 52, 83, 58, 58, 254, 1, 255, 1, 19, 59, 0, 63, 58, 58, 88, 58, 63, 58, 88, 254,
+    1, 255, 0, 18, 59, 0, 63, 58, 88, 63, 58, 63, 63, 83, 63, 254, 1, 0, 0, 17, 59, 0, 63, 88, 63, 58, 63, 63, 88, 254,
+    1, 0, 0, 16, 59, 0, 63, 63, 255, 31, 0, 16, 0, 0, 0, 0, 59, 0, 61, 61, 61, 254, 255, 0, 1, 1, 59, 0, 61, 66,
+    61, 61, 86, 61, 61, 66, 254, 255, 0, 1, 2, 59, 0, 61, 66, 61, 61, 91, 61, 66, 61, 91, 254, 255, 0, 0, 3, 59, 0, 66,
+    61, 91, 66, 61, 66, 91, 66, 254, 255, 1, 0, 4, 59, 0, 60, 91, 66, 66, 254, 255, 1, 1, 5, 59, 0, 67, 66, 66, 92, 66,
+    67, 66, 92, 254, 255, 1, 0, 6, 59, 0, 67, 66, 92, 67, 66, 67, 67, 91, 67, 254, 0, 1, 0, 7, 59, 0, 67, 92, 67, 66,
+    67, 67, 92, 254, 0, 1, 0, 8, 59, 0, 67, 67, 255, 16, 0, 0, 0, 0, 0, 8, 59, 0, 67, 67, 67, 67, 254, 0, 1, 1,
+    9, 59, 0, 67, 68, 67, 67, 92, 67, 67, 68, 254, 0, 1, 1, 10, 59, 0, 67, 68, 67, 67, 93, 67, 68, 67, 93, 254, 0, 1,
+    0, 11, 59, 0, 68, 67, 93, 68, 67, 68, 93, 68, 254, 1, 1, 0, 12, 59, 0, 72, 93, 68, 68, 254, 1, 1, 1, 13, 59, 0,
+    63, 68, 68, 88, 68, 63, 68, 88, 254, 1, 1, 0, 14, 59, 0, 63, 68, 88, 63, 68, 63, 63, 93, 63, 254, 1, 0, 0, 15, 59,
+    0, 63, 88, 63, 68, 63, 63, 88, 254, 1, 0, 0, 16, 59, 0, 63, 63, 255, 0, 0, 16, 0, 0, 0, 16, 59, 0, 63, 63, 63,
+    63, 254, 1, 0, 1, 17, 59, 0, 63, 58, 63, 63, 88, 63, 63, 58, 254, 1, 0, 0, 18, 59, 0, 88, 58, 63, 63, 83, 63, 58,
+    63, 83, 254, 1, 0, 0, 19, 59, 0, 58, 63, 58, 83, 63, 58, 83, 58, 254, 1, 255, 0, 20, 59, 0, 64, 83, 58, 58, 254, 1,
+    255, 0, 21, 59, 0, 82, 58, 58, 57, 83, 57, 58, 57, 254, 1, 255, 1, 22, 59, 0, 57, 58, 57, 82, 58, 57, 57, 58, 82, 254,
+    0, 255, 0, 23, 59, 0, 57, 57, 82, 58, 57, 57, 57, 254, 0, 255, 1, 24, 59, 0, 57, 57, 57, 255, 16, 0, 31, 0, 0, 0,
+    24, 59, 0, 57, 57, 57, 254, 0, 255, 1, 25, 59, 0, 57, 56, 57, 57, 82, 57, 57, 56, 254, 0, 255, 0, 26, 59, 0, 82, 56,
+    57, 57, 81, 57, 56, 57, 81, 254, 0, 255, 0, 27, 59, 0, 56, 57, 56, 81, 57, 56, 81, 56, 254, 255, 255, 0, 28, 59, 0, 52,
+    81, 56, 56, 254, 255, 255, 0, 29, 59, 0, 86, 56, 56, 61, 81, 61, 56, 61, 254, 255, 255, 1, 30, 59, 0, 61, 56, 61, 86, 56,
+    61, 61, 56, 86, 254, 255, 0, 0, 31, 59, 0, 61, 61, 86, 56, 61, 61, 61, 254, 255, 0, 1, 0, 59, 0, 61, 61, 61, 255, 31,
+    0, 16, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 56, 61, 56, 61, 56, 61, 56, 56, 61, 56, 56, 61, 56, 61, 56, 61, 56, 61,
+    61, 56, 61, 56, 61, 61, 56, 61, 61, 56, 61, 61, 61, 61, 56, 61, 61, 61, 61, 56, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 66, 61, 61, 61, 61, 66, 61, 61, 61, 61, 66, 61, 61, 66, 61, 61, 66, 61, 66, 61, 61, 66, 61, 66, 61, 66, 61, 66, 66,
+    61, 66, 66, 61, 66, 61, 66, 61, 66, 61, 61, 61, 61, 254, 95, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0,
+    0, 0, 8, 0, 0, 67, 67, 67, 67, 66, 67, 66, 67, 66, 67, 66, 66, 67, 66, 66, 67, 66, 67, 66, 67, 66, 67, 67, 66, 67,
+    66, 67, 67, 66, 67, 67, 66, 67, 67, 67, 67, 66, 67, 67, 67, 67, 66, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 68, 67,
+    67, 67, 67, 68, 67, 67, 67, 67, 68, 67, 67, 68, 67, 67, 68, 67, 68, 67, 67, 68, 67, 68, 67, 68, 67, 68, 68, 67, 68, 68,
+    67, 68, 67, 68, 67, 68, 67, 67, 67, 67, 254, 0, 161, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 0, 0, 16,
+    0, 0, 63, 63, 63, 63, 68, 63, 68, 63, 68, 63, 68, 68, 63, 68, 68, 63, 68, 63, 68, 63, 68, 63, 63, 68, 63, 68, 63, 63,
+    68, 63, 63, 68, 63, 63, 63, 63, 68, 63, 63, 63, 63, 68, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 58, 63, 63, 63, 63,
+    58, 63, 63, 63, 63, 58, 63, 63, 58, 63, 63, 58, 63, 58, 63, 63, 58, 63, 58, 63, 58, 63, 58, 58, 63, 58, 58, 63, 58, 63,
+    58, 63, 58, 63, 63, 63, 63, 254, 161, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57,
+    57, 57, 57, 58, 57, 58, 57, 58, 57, 58, 58, 57, 58, 58, 57, 58, 57, 58, 57, 58, 57, 57, 58, 57, 58, 57, 57, 58, 57, 57,
+    58, 57, 57, 57, 57, 58, 57, 57, 57, 57, 58, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 56, 57, 57, 57, 57, 56, 57, 57,
+    57, 57, 56, 57, 57, 56, 57, 57, 56, 57, 56, 57, 57, 56, 57, 56, 57, 56, 57, 56, 56, 57, 56, 56, 57, 56, 57, 56, 57, 56,
+    57, 57, 57, 57, 254, 0, 95, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61,
+    66, 61, 66, 61, 66, 61, 66, 66, 61, 66, 66, 61, 66, 61, 66, 61, 66, 61, 61, 66, 61, 66, 61, 61, 66, 61, 61, 66, 61, 61,
+    61, 61, 66, 61, 61, 61, 61, 66, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 56, 61, 61, 61, 61, 56, 61, 61, 61, 61, 56,
+    61, 61, 56, 61, 61, 56, 61, 56, 61, 61, 56, 61, 56, 61, 56, 61, 56, 56, 61, 56, 56, 61, 56, 61, 56, 61, 56, 61, 61, 61,
+    61, 254, 95, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67, 68, 67, 68,
+    67, 68, 67, 68, 68, 67, 68, 68, 67, 68, 67, 68, 67, 68, 67, 67, 68, 67, 68, 67, 67, 68, 67, 67, 68, 67, 67, 67, 67, 68,
+    67, 67, 67, 67, 68, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 66, 67, 67, 67, 67, 66, 67, 67, 67, 67, 66, 67, 67, 66,
+    67, 67, 66, 67, 66, 67, 67, 66, 67, 66, 67, 66, 67, 66, 66, 67, 66, 66, 67, 66, 67, 66, 67, 66, 67, 67, 67, 67, 254, 0,
+    161, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 58, 63, 58, 63, 58, 63,
+    58, 58, 63, 58, 58, 63, 58, 63, 58, 63, 58, 63, 63, 58, 63, 58, 63, 63, 58, 63, 63, 58, 63, 63, 63, 63, 58, 63, 63, 63,
+    63, 58, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 68, 63, 63, 63, 63, 68, 63, 63, 63, 63, 68, 63, 63, 68, 63, 63, 68,
+    63, 68, 63, 63, 68, 63, 68, 63, 68, 63, 68, 68, 63, 68, 68, 63, 68, 63, 68, 63, 68, 63, 63, 63, 63, 254, 161, 0, 0, 16,
+    0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 56, 57, 56, 57, 56, 57, 56, 56, 57,
+    56, 56, 57, 56, 57, 56, 57, 56, 57, 57, 56, 57, 56, 57, 57, 56, 57, 57, 56, 57, 57, 57, 57, 56, 57, 57, 57, 57, 56, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 58, 57, 57, 57, 57, 58, 57, 57, 57, 57, 58, 57, 57, 58, 57, 57, 58, 57, 58, 57,
+    57, 58, 57, 58, 57, 58, 57, 58, 58, 57, 58, 58, 57, 58, 57, 58, 57, 58, 57, 57, 57, 57, 254, 0, 95, 0, 24, 0, 0, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 255, 37, 0, 16, 0, 1, 0, 0, 10, 0, 86, 87, 87, 87, 87, 86, 87, 254, 0, 0, 1, 0, 9, 0, 87, 86,
+    87, 87, 86, 87, 87, 86, 254, 0, 0, 1, 0, 4, 0, 86, 87, 86, 87, 86, 87, 86, 87, 254, 255, 0, 1, 0, 3, 0, 86, 87,
+    86, 87, 86, 86, 86, 86, 254, 0, 0, 1, 0, 2, 0, 86, 86, 86, 61, 86, 86, 61, 86, 254, 255, 0, 1, 0, 1, 0, 61, 86,
+    61, 86, 61, 86, 61, 61, 254, 255, 0, 1, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 36, 61, 61, 36, 61, 36, 61, 254, 255, 0,
+    255, 0, 5, 0, 61, 36, 36, 61, 36, 61, 36, 36, 254, 255, 0, 255, 0, 6, 0, 37, 36, 36, 36, 36, 37, 36, 37, 254, 255, 0,
+    255, 0, 7, 0, 36, 37, 36, 37, 36, 37, 36, 37, 254, 255, 0, 255, 0, 8, 0, 37, 36, 37, 37, 36, 37, 37, 36, 254, 0, 0,
+    255, 0, 17, 0, 37, 37, 36, 37, 37, 37, 37, 36, 254, 0, 0, 255, 0, 18, 0, 255, 16, 0, 250, 255, 1, 0, 8, 10, 0, 92,
+    87, 87, 87, 87, 92, 87, 254, 0, 0, 1, 8, 9, 0, 87, 92, 87, 87, 92, 87, 87, 92, 254, 0, 0, 1, 8, 4, 0, 92, 87,
+    92, 87, 92, 87, 92, 87, 254, 0, 1, 1, 8, 3, 0, 92, 87, 92, 87, 92, 92, 92, 92, 254, 0, 0, 1, 8, 2, 0, 92, 92,
+    92, 67, 92, 92, 67, 92, 254, 0, 1, 1, 8, 1, 0, 67, 92, 67, 92, 67, 92, 67, 67, 254, 0, 1, 1, 8, 0, 0, 67, 67,
+    67, 67, 67, 67, 67, 42, 67, 67, 42, 67, 42, 67, 254, 0, 1, 255, 8, 5, 0, 67, 42, 42, 67, 42, 67, 42, 42, 254, 0, 1,
+    255, 8, 6, 0, 37, 42, 42, 42, 42, 37, 42, 37, 254, 0, 1, 255, 8, 7, 0, 42, 37, 42, 37, 42, 37, 42, 37, 254, 0, 1,
+    255, 8, 8, 0, 37, 42, 37, 37, 42, 37, 37, 42, 254, 0, 0, 255, 8, 17, 0, 37, 37, 42, 37, 37, 37, 37, 42, 254, 0, 0,
+    255, 8, 18, 0, 255, 250, 255, 16, 0, 1, 0, 16, 10, 0, 88, 87, 87, 87, 87, 88, 87, 254, 0, 0, 1, 16, 9, 0, 87, 88,
+    87, 87, 88, 87, 87, 88, 254, 0, 0, 1, 16, 4, 0, 88, 87, 88, 87, 88, 87, 88, 87, 254, 1, 0, 1, 16, 3, 0, 88, 87,
+    88, 87, 88, 88, 88, 88, 254, 0, 0, 1, 16, 2, 0, 88, 88, 88, 63, 88, 88, 63, 88, 254, 1, 0, 1, 16, 1, 0, 63, 88,
+    63, 88, 63, 88, 63, 63, 254, 1, 0, 1, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 38, 63, 63, 38, 63, 38, 63, 254, 1, 0,
+    255, 16, 5, 0, 63, 38, 38, 63, 38, 63, 38, 38, 254, 1, 0, 255, 16, 6, 0, 37, 38, 38, 38, 38, 37, 38, 37, 254, 1, 0,
+    255, 16, 7, 0, 38, 37, 38, 37, 38, 37, 38, 37, 254, 1, 0, 255, 16, 8, 0, 37, 38, 37, 37, 38, 37, 37, 38, 254, 0, 0,
+    255, 16, 17, 0, 37, 37, 38, 37, 37, 37, 37, 38, 254, 0, 0, 255, 16, 18, 0, 255, 16, 0, 37, 0, 1, 0, 24, 10, 0, 82,
+    87, 87, 87, 87, 82, 87, 254, 0, 0, 1, 24, 9, 0, 87, 82, 87, 87, 82, 87, 87, 82, 254, 0, 0, 1, 24, 4, 0, 82, 87,
+    82, 87, 82, 87, 82, 87, 254, 0, 255, 1, 24, 3, 0, 82, 87, 82, 87, 82, 82, 82, 82, 254, 0, 0, 1, 24, 2, 0, 82, 82,
+    82, 57, 82, 82, 57, 82, 254, 0, 255, 1, 24, 1, 0, 57, 82, 57, 82, 57, 82, 57, 57, 254, 0, 255, 1, 24, 0, 0, 57, 57,
+    57, 57, 57, 57, 57, 32, 57, 57, 32, 57, 32, 57, 254, 0, 255, 255, 24, 5, 0, 57, 32, 32, 57, 32, 57, 32, 32, 254, 0, 255,
+    255, 24, 6, 0, 37, 32, 32, 32, 32, 37, 32, 37, 254, 0, 255, 255, 24, 7, 0, 32, 37, 32, 37, 32, 37, 32, 37, 254, 0, 255,
+    255, 24, 8, 0, 37, 32, 37, 37, 32, 37, 37, 32, 254, 0, 0, 255, 24, 17, 0, 37, 37, 32, 37, 37, 37, 37, 32, 254, 0, 0,
+    255, 24, 18, 0, 255, 27, 0, 16, 0, 79, 0, 0, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 255, 16, 0, 5, 0, 79, 0, 8, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 255, 5, 0, 16, 0, 79, 0, 16, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 255, 16, 0, 27, 0, 79, 0, 24, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    255, 27, 0, 16, 0, 239, 0, 0, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 12, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 36, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 36, 37, 37, 37, 37, 37, 37, 37, 36, 37, 37, 254,
+    0, 0, 255, 0, 17, 0, 37, 37, 37, 36, 37, 37, 37, 37, 37, 36, 37, 37, 37, 37, 36, 37, 37, 37, 36, 37, 37, 37, 37, 36,
+    37, 37, 37, 36, 37, 37, 36, 37, 37, 37, 36, 37, 37, 36, 37, 37, 36, 37, 37, 36, 37, 37, 36, 37, 37, 36, 37, 37, 254, 255,
+    0, 255, 0, 8, 0, 37, 37, 36, 37, 36, 37, 37, 36, 37, 36, 37, 36, 37, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36,
+    37, 36, 37, 36, 37, 36, 37, 36, 36, 37, 36, 37, 36, 37, 36, 36, 37, 36, 36, 254, 0, 0, 255, 0, 7, 0, 36, 37, 36, 36,
+    37, 36, 36, 36, 37, 36, 36, 37, 36, 36, 36, 37, 36, 36, 36, 36, 37, 36, 36, 36, 36, 36, 37, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 61, 36, 36, 36, 36, 36, 254, 255, 0, 255, 0, 6, 0, 61, 36, 36, 36, 61, 36,
+    36, 36, 61, 36, 36, 61, 36, 36, 61, 36, 36, 61, 36, 36, 61, 36, 61, 36, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61,
+    36, 61, 36, 61, 36, 61, 36, 61, 61, 36, 61, 254, 255, 0, 255, 0, 5, 0, 61, 61, 36, 61, 61, 36, 61, 61, 36, 61, 61, 36,
+    61, 61, 36, 61, 61, 61, 36, 61, 61, 61, 36, 61, 61, 61, 36, 61, 61, 61, 61, 36, 61, 61, 61, 61, 254, 255, 0, 0, 0, 0,
+    0, 61, 36, 61, 61, 61, 61, 61, 61, 61, 61, 36, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 5, 0, 239, 0, 8, 18, 0, 37,
+    37, 37, 37, 37, 37, 37, 37, 12, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 42, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 42, 37, 37, 37, 37, 37, 37, 37, 42, 37, 37, 254, 0, 0, 255, 8, 17, 0, 37, 37, 37, 42, 37,
+    37, 37, 37, 37, 42, 37, 37, 37, 37, 42, 37, 37, 37, 42, 37, 37, 37, 37, 42, 37, 37, 37, 42, 37, 37, 42, 37, 37, 37, 42,
+    37, 37, 42, 37, 37, 42, 37, 37, 42, 37, 37, 42, 37, 37, 42, 37, 37, 254, 0, 1, 255, 8, 8, 0, 37, 37, 42, 37, 42, 37,
+    37, 42, 37, 42, 37, 42, 37, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 37, 42, 42, 37, 42,
+    37, 42, 37, 42, 42, 37, 42, 42, 254, 0, 0, 255, 8, 7, 0, 42, 37, 42, 42, 37, 42, 42, 42, 37, 42, 42, 37, 42, 42, 42,
+    37, 42, 42, 42, 42, 37, 42, 42, 42, 42, 42, 37, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    67, 42, 42, 42, 42, 42, 254, 0, 1, 255, 8, 6, 0, 67, 42, 42, 42, 67, 42, 42, 42, 67, 42, 42, 67, 42, 42, 67, 42, 42,
+    67, 42, 42, 67, 42, 67, 42, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 67, 42, 67,
+    254, 0, 1, 255, 8, 5, 0, 67, 67, 42, 67, 67, 42, 67, 67, 42, 67, 67, 42, 67, 67, 42, 67, 67, 67, 42, 67, 67, 67, 42,
+    67, 67, 67, 42, 67, 67, 67, 67, 42, 67, 67, 67, 67, 254, 0, 1, 0, 8, 0, 0, 67, 42, 67, 67, 67, 67, 67, 67, 67, 67,
+    42, 67, 67, 67, 67, 67, 67, 67, 255, 5, 0, 16, 0, 239, 0, 16, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 12, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 38, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 38, 37, 37, 37,
+    37, 37, 37, 37, 38, 37, 37, 254, 0, 0, 255, 16, 17, 0, 37, 37, 37, 38, 37, 37, 37, 37, 37, 38, 37, 37, 37, 37, 38, 37,
+    37, 37, 38, 37, 37, 37, 37, 38, 37, 37, 37, 38, 37, 37, 38, 37, 37, 37, 38, 37, 37, 38, 37, 37, 38, 37, 37, 38, 37, 37,
+    38, 37, 37, 38, 37, 37, 254, 1, 0, 255, 16, 8, 0, 37, 37, 38, 37, 38, 37, 37, 38, 37, 38, 37, 38, 37, 37, 38, 37, 38,
+    37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 37, 38, 38, 37, 38, 37, 38, 37, 38, 38, 37, 38, 38, 254, 0, 0,
+    255, 16, 7, 0, 38, 37, 38, 38, 37, 38, 38, 38, 37, 38, 38, 37, 38, 38, 38, 37, 38, 38, 38, 38, 37, 38, 38, 38, 38, 38,
+    37, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 63, 38, 38, 38, 38, 38, 254, 1, 0, 255, 16,
+    6, 0, 63, 38, 38, 38, 63, 38, 38, 38, 63, 38, 38, 63, 38, 38, 63, 38, 38, 63, 38, 38, 63, 38, 63, 38, 38, 63, 38, 63,
+    38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 63, 38, 63, 254, 1, 0, 255, 16, 5, 0, 63, 63, 38, 63,
+    63, 38, 63, 63, 38, 63, 63, 38, 63, 63, 38, 63, 63, 63, 38, 63, 63, 63, 38, 63, 63, 63, 38, 63, 63, 63, 63, 38, 63, 63,
+    63, 63, 254, 1, 0, 0, 16, 0, 0, 63, 38, 63, 63, 63, 63, 63, 63, 63, 63, 38, 63, 63, 63, 63, 63, 63, 63, 255, 16, 0,
+    27, 0, 239, 0, 24, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 12, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 254, 0, 0, 255,
+    24, 17, 0, 37, 37, 37, 32, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 32, 37, 37, 37, 32, 37, 37, 37, 37, 32, 37, 37, 37,
+    32, 37, 37, 32, 37, 37, 37, 32, 37, 37, 32, 37, 37, 32, 37, 37, 32, 37, 37, 32, 37, 37, 32, 37, 37, 254, 0, 255, 255, 24,
+    8, 0, 37, 37, 32, 37, 32, 37, 37, 32, 37, 32, 37, 32, 37, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37, 32, 37,
+    32, 37, 32, 37, 32, 32, 37, 32, 37, 32, 37, 32, 32, 37, 32, 32, 254, 0, 0, 255, 24, 7, 0, 32, 37, 32, 32, 37, 32, 32,
+    32, 37, 32, 32, 37, 32, 32, 32, 37, 32, 32, 32, 32, 37, 32, 32, 32, 32, 32, 37, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 57, 32, 32, 32, 32, 32, 254, 0, 255, 255, 24, 6, 0, 57, 32, 32, 32, 57, 32, 32, 32, 57,
+    32, 32, 57, 32, 32, 57, 32, 32, 57, 32, 32, 57, 32, 57, 32, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32,
+    57, 32, 57, 32, 57, 57, 32, 57, 254, 0, 255, 255, 24, 5, 0, 57, 57, 32, 57, 57, 32, 57, 57, 32, 57, 57, 32, 57, 57, 32,
+    57, 57, 57, 32, 57, 57, 57, 32, 57, 57, 57, 32, 57, 57, 57, 57, 32, 57, 57, 57, 57, 254, 0, 255, 0, 24, 0, 0, 57, 32,
+    57, 57, 57, 57, 57, 57, 57, 57, 32, 57, 57, 57, 57, 57, 57, 57, 255, 31, 0, 16, 0, 0, 0, 0, 2, 2, 61, 86, 61, 254,
+    255, 0, 1, 31, 2, 2, 61, 56, 86, 61, 86, 61, 61, 81, 254, 255, 0, 0, 30, 2, 2, 86, 56, 86, 61, 81, 61, 81, 61, 81,
+    254, 255, 0, 0, 29, 2, 2, 81, 61, 56, 81, 86, 56, 81, 56, 254, 255, 255, 1, 28, 2, 2, 60, 81, 56, 81, 254, 255, 255, 0,
+    27, 2, 2, 82, 56, 81, 57, 81, 57, 81, 57, 254, 255, 255, 1, 26, 2, 2, 57, 81, 57, 82, 56, 82, 57, 56, 82, 254, 0, 255,
+    0, 25, 2, 2, 82, 57, 82, 56, 82, 57, 57, 254, 0, 255, 1, 24, 2, 2, 57, 82, 57, 255, 16, 0, 0, 0, 0, 0, 8, 2,
+    2, 67, 67, 92, 67, 254, 0, 1, 1, 7, 2, 2, 67, 66, 92, 67, 92, 67, 67, 91, 254, 0, 1, 0, 6, 2, 2, 92, 66, 92,
+    67, 91, 67, 91, 67, 91, 254, 0, 1, 0, 5, 2, 2, 91, 67, 66, 91, 92, 66, 91, 66, 254, 255, 1, 1, 4, 2, 2, 72, 91,
+    66, 91, 254, 255, 1, 0, 3, 2, 2, 86, 66, 91, 61, 91, 61, 91, 61, 254, 255, 1, 1, 2, 2, 2, 61, 91, 61, 86, 66, 86,
+    61, 66, 86, 254, 255, 0, 0, 1, 2, 2, 86, 61, 86, 66, 86, 61, 61, 254, 255, 0, 1, 0, 2, 2, 61, 86, 61, 255, 0, 0,
+    16, 0, 0, 0, 16, 2, 2, 63, 63, 88, 63, 254, 1, 0, 1, 15, 2, 2, 63, 68, 88, 63, 88, 63, 88, 68, 254, 1, 0, 1,
+    14, 2, 2, 63, 68, 88, 63, 93, 63, 93, 63, 93, 254, 1, 0, 0, 13, 2, 2, 93, 63, 93, 68, 88, 68, 93, 68, 254, 1, 1,
+    1, 12, 2, 2, 64, 93, 68, 93, 254, 1, 1, 1, 11, 2, 2, 67, 93, 68, 92, 68, 92, 68, 92, 254, 1, 1, 0, 10, 2, 2,
+    92, 68, 92, 67, 68, 92, 67, 93, 67, 254, 0, 1, 1, 9, 2, 2, 67, 92, 67, 68, 92, 67, 92, 254, 0, 1, 0, 8, 2, 2,
+    92, 67, 255, 16, 0, 31, 0, 0, 0, 24, 2, 2, 57, 82, 57, 254, 0, 255, 1, 23, 2, 2, 57, 58, 82, 57, 82, 57, 82, 58,
+    254, 0, 255, 1, 22, 2, 2, 57, 58, 82, 57, 83, 57, 83, 57, 83, 254, 0, 255, 0, 21, 2, 2, 83, 57, 83, 58, 82, 58, 83,
+    58, 254, 1, 255, 1, 20, 2, 2, 52, 83, 58, 83, 254, 1, 255, 1, 19, 2, 2, 63, 83, 58, 88, 58, 88, 58, 88, 254, 1, 255,
+    0, 18, 2, 2, 88, 58, 88, 63, 58, 88, 63, 83, 63, 254, 1, 0, 1, 17, 2, 2, 63, 88, 63, 58, 88, 63, 88, 254, 1, 0,
+    0, 16, 2, 2, 88, 63, 255, 31, 0, 16, 0, 0, 0, 0, 2, 4, 61, 86, 61, 254, 255, 0, 1, 1, 2, 4, 61, 66, 86, 61,
+    86, 61, 86, 66, 254, 255, 0, 1, 2, 2, 4, 61, 66, 86, 61, 91, 61, 91, 61, 91, 254, 255, 0, 0, 3, 2, 4, 91, 61, 91,
+    66, 86, 66, 91, 66, 254, 255, 1, 1, 4, 2, 4, 60, 91, 66, 91, 254, 255, 1, 1, 5, 2, 4, 67, 91, 66, 92, 66, 92, 66,
+    92, 254, 255, 1, 0, 6, 2, 4, 92, 66, 92, 67, 66, 92, 67, 91, 67, 254, 0, 1, 1, 7, 2, 4, 67, 92, 67, 66, 92, 67,
+    92, 254, 0, 1, 0, 8, 2, 4, 92, 67, 255, 16, 0, 0, 0, 0, 0, 8, 2, 4, 67, 67, 92, 67, 254, 0, 1, 1, 9, 2,
+    4, 67, 68, 92, 67, 92, 67, 92, 68, 254, 0, 1, 1, 10, 2, 4, 67, 68, 92, 67, 93, 67, 93, 67, 93, 254, 0, 1, 0, 11,
+    2, 4, 93, 67, 93, 68, 92, 68, 93, 68, 254, 1, 1, 1, 12, 2, 4, 72, 93, 68, 93, 254, 1, 1, 1, 13, 2, 4, 63, 93,
+    68, 88, 68, 88, 68, 88, 254, 1, 1, 0, 14, 2, 4, 88, 68, 88, 63, 68, 88, 63, 93, 63, 254, 1, 0, 1, 15, 2, 4, 63,
+    88, 63, 68, 88, 63, 88, 254, 1, 0, 0, 16, 2, 4, 88, 63, 255, 0, 0, 16, 0, 0, 0, 16, 2, 4, 63, 63, 88, 63, 254,
+    1, 0, 1, 17, 2, 4, 63, 58, 88, 63, 88, 63, 63, 83, 254, 1, 0, 0, 18, 2, 4, 88, 58, 88, 63, 83, 63, 83, 63, 83,
+    254, 1, 0, 0, 19, 2, 4, 83, 63, 58, 83, 88, 58, 83, 58, 254, 1, 255, 1, 20, 2, 4, 64, 83, 58, 83, 254, 1, 255, 0,
+    21, 2, 4, 82, 58, 83, 57, 83, 57, 83, 57, 254, 1, 255, 1, 22, 2, 4, 57, 83, 57, 82, 58, 82, 57, 58, 82, 254, 0, 255,
+    0, 23, 2, 4, 82, 57, 82, 58, 82, 57, 57, 254, 0, 255, 1, 24, 2, 4, 57, 82, 57, 255, 16, 0, 31, 0, 0, 0, 24, 2,
+    4, 57, 82, 57, 254, 0, 255, 1, 25, 2, 4, 57, 56, 82, 57, 82, 57, 57, 81, 254, 0, 255, 0, 26, 2, 4, 82, 56, 82, 57,
+    81, 57, 81, 57, 81, 254, 0, 255, 0, 27, 2, 4, 81, 57, 56, 81, 82, 56, 81, 56, 254, 255, 255, 1, 28, 2, 4, 52, 81, 56,
+    81, 254, 255, 255, 0, 29, 2, 4, 86, 56, 81, 61, 81, 61, 81, 61, 254, 255, 255, 1, 30, 2, 4, 61, 81, 61, 86, 56, 86, 61,
+    56, 86, 254, 255, 0, 0, 31, 2, 4, 86, 61, 86, 56, 86, 61, 61, 254, 255, 0, 1, 0, 2, 4, 61, 86, 61, 255, 31, 0, 16,
+    0, 15, 0, 0, 6, 2, 61, 36, 61, 254, 255, 0, 255, 31, 6, 2, 61, 56, 36, 61, 36, 61, 61, 31, 254, 255, 0, 0, 30, 6,
+    2, 36, 56, 36, 61, 31, 61, 31, 61, 31, 254, 255, 0, 0, 29, 6, 2, 31, 61, 56, 31, 36, 56, 31, 56, 254, 255, 255, 255, 28,
+    6, 2, 60, 31, 56, 31, 254, 255, 255, 0, 27, 6, 2, 32, 56, 31, 32, 56, 57, 31, 57, 254, 255, 255, 255, 26, 6, 2, 57, 31,
+    57, 32, 56, 32, 57, 31, 57, 254, 0, 255, 255, 25, 6, 2, 57, 57, 32, 56, 32, 57, 57, 254, 0, 255, 255, 24, 6, 2, 57, 32,
+    32, 255, 16, 0, 0, 0, 15, 0, 8, 6, 2, 67, 67, 42, 67, 254, 0, 1, 255, 7, 6, 2, 67, 66, 42, 67, 42, 67, 67, 41,
+    254, 0, 1, 0, 6, 6, 2, 42, 66, 42, 67, 41, 67, 41, 67, 41, 254, 0, 1, 0, 5, 6, 2, 41, 67, 66, 41, 42, 66, 41,
+    66, 254, 255, 1, 255, 4, 6, 2, 72, 41, 66, 41, 254, 255, 1, 0, 3, 6, 2, 36, 66, 41, 36, 66, 61, 41, 61, 254, 255, 1,
+    255, 2, 6, 2, 61, 41, 61, 36, 66, 36, 61, 41, 61, 254, 255, 0, 255, 1, 6, 2, 61, 61, 36, 66, 36, 61, 61, 254, 255, 0,
+    255, 0, 6, 2, 61, 36, 36, 255, 0, 0, 16, 0, 15, 0, 16, 6, 2, 63, 63, 38, 63, 254, 1, 0, 255, 15, 6, 2, 63, 68,
+    38, 63, 38, 63, 38, 68, 254, 1, 0, 255, 14, 6, 2, 63, 68, 38, 63, 43, 63, 43, 63, 43, 254, 1, 0, 0, 13, 6, 2, 43,
+    63, 43, 68, 38, 68, 43, 68, 254, 1, 1, 255, 12, 6, 2, 39, 68, 68, 43, 254, 1, 1, 255, 11, 6, 2, 67, 43, 68, 42, 68,
+    42, 68, 42, 254, 1, 1, 0, 10, 6, 2, 42, 68, 42, 67, 68, 42, 67, 43, 67, 254, 0, 1, 255, 9, 6, 2, 67, 42, 67, 68,
+    42, 67, 42, 254, 0, 1, 0, 8, 6, 2, 42, 67, 255, 16, 0, 31, 0, 15, 0, 24, 6, 2, 57, 32, 57, 254, 0, 255, 255, 23,
+    6, 2, 57, 58, 32, 57, 32, 57, 32, 58, 254, 0, 255, 255, 22, 6, 2, 57, 58, 32, 57, 33, 57, 33, 57, 33, 254, 0, 255, 0,
+    21, 6, 2, 33, 57, 33, 58, 32, 58, 33, 58, 254, 1, 255, 255, 20, 6, 2, 27, 58, 58, 33, 254, 1, 255, 255, 19, 6, 2, 63,
+    33, 58, 38, 58, 38, 58, 38, 254, 1, 255, 0, 18, 6, 2, 38, 58, 38, 63, 58, 38, 63, 33, 63, 254, 1, 0, 255, 17, 6, 2,
+    63, 38, 63, 58, 38, 63, 38, 254, 1, 0, 0, 16, 6, 2, 38, 63, 255, 31, 0, 16, 0, 15, 0, 0, 6, 4, 61, 36, 61, 254,
+    255, 0, 255, 1, 6, 4, 61, 66, 36, 61, 36, 61, 36, 66, 254, 255, 0, 255, 2, 6, 4, 61, 66, 36, 61, 41, 61, 41, 61, 41,
+    254, 255, 0, 0, 3, 6, 4, 41, 61, 41, 66, 36, 66, 41, 66, 254, 255, 1, 255, 4, 6, 4, 35, 66, 66, 41, 254, 255, 1, 255,
+    5, 6, 4, 67, 41, 66, 42, 66, 42, 66, 42, 254, 255, 1, 0, 6, 6, 4, 42, 66, 42, 67, 66, 42, 67, 41, 67, 254, 0, 1,
+    255, 7, 6, 4, 67, 42, 67, 66, 42, 67, 42, 254, 0, 1, 0, 8, 6, 4, 42, 67, 255, 16, 0, 0, 0, 15, 0, 8, 6, 4,
+    67, 67, 42, 67, 254, 0, 1, 255, 9, 6, 4, 67, 68, 42, 67, 42, 67, 42, 68, 254, 0, 1, 255, 10, 6, 4, 67, 68, 42, 67,
+    43, 67, 43, 67, 43, 254, 0, 1, 0, 11, 6, 4, 43, 67, 43, 68, 42, 68, 43, 68, 254, 1, 1, 255, 12, 6, 4, 47, 68, 68,
+    43, 254, 1, 1, 255, 13, 6, 4, 63, 43, 68, 38, 68, 38, 68, 38, 254, 1, 1, 0, 14, 6, 4, 38, 68, 38, 63, 68, 38, 63,
+    43, 63, 254, 1, 0, 255, 15, 6, 4, 63, 38, 63, 68, 38, 63, 38, 254, 1, 0, 0, 16, 6, 4, 38, 63, 255, 0, 0, 16, 0,
+    15, 0, 16, 6, 4, 63, 63, 38, 63, 254, 1, 0, 255, 17, 6, 4, 63, 58, 38, 63, 38, 63, 63, 33, 254, 1, 0, 0, 18, 6,
+    4, 38, 58, 38, 63, 33, 63, 33, 63, 33, 254, 1, 0, 0, 19, 6, 4, 33, 63, 58, 33, 38, 58, 33, 58, 254, 1, 255, 255, 20,
+    6, 4, 64, 33, 58, 33, 254, 1, 255, 0, 21, 6, 4, 32, 58, 33, 57, 33, 57, 33, 57, 254, 1, 255, 255, 22, 6, 4, 57, 33,
+    57, 32, 58, 32, 57, 58, 32, 254, 0, 255, 0, 23, 6, 4, 32, 57, 32, 58, 32, 57, 57, 254, 0, 255, 255, 24, 6, 4, 57, 32,
+    57, 255, 16, 0, 31, 0, 15, 0, 24, 6, 4, 57, 32, 57, 254, 0, 255, 255, 25, 6, 4, 57, 56, 32, 57, 32, 57, 57, 31, 254,
+    0, 255, 0, 26, 6, 4, 32, 56, 32, 57, 31, 57, 31, 57, 31, 254, 0, 255, 0, 27, 6, 4, 31, 57, 56, 31, 32, 56, 31, 56,
+    254, 255, 255, 255, 28, 6, 4, 52, 31, 56, 31, 254, 255, 255, 0, 29, 6, 4, 36, 56, 31, 61, 31, 61, 31, 61, 254, 255, 255, 255,
+    30, 6, 4, 61, 31, 61, 36, 56, 36, 61, 56, 36, 254, 255, 0, 0, 31, 6, 4, 36, 61, 36, 56, 36, 61, 61, 254, 255, 0, 255,
+    0, 6, 4, 61, 36, 61, 255, 31, 0, 16, 0, 0, 0, 0, 2, 2, 61, 86, 61, 86, 61, 86, 254, 255, 0, 0, 31, 2, 2, 81,
+    61, 86, 61, 86, 61, 81, 86, 61, 61, 86, 56, 86, 254, 255, 0, 1, 30, 2, 2, 61, 81, 61, 86, 56, 86, 61, 81, 61, 81, 86,
+    56, 86, 56, 254, 255, 0, 1, 29, 2, 2, 56, 86, 81, 56, 86, 56, 81, 86, 56, 81, 86, 56, 254, 255, 255, 1, 28, 2, 2, 56,
+    86, 81, 56, 81, 81, 61, 81, 56, 81, 81, 57, 254, 255, 255, 1, 27, 2, 2, 81, 56, 82, 56, 81, 82, 56, 81, 82, 56, 81, 57,
+    254, 255, 255, 1, 26, 2, 2, 82, 56, 82, 56, 82, 56, 82, 81, 57, 82, 56, 82, 57, 254, 255, 255, 1, 25, 2, 2, 57, 82, 57,
+    81, 82, 57, 82, 57, 56, 82, 82, 57, 82, 57, 81, 254, 0, 255, 0, 24, 2, 2, 82, 57, 82, 57, 82, 57, 82, 82, 255, 16, 0,
+    0, 0, 0, 0, 8, 2, 2, 67, 67, 92, 67, 92, 67, 92, 254, 0, 1, 0, 7, 2, 2, 91, 67, 92, 67, 92, 67, 91, 92, 67,
+    67, 92, 66, 92, 254, 0, 1, 1, 6, 2, 2, 67, 91, 67, 92, 66, 92, 67, 91, 67, 91, 92, 66, 92, 66, 254, 0, 1, 1, 5,
+    2, 2, 66, 92, 91, 66, 92, 66, 91, 92, 66, 91, 92, 66, 254, 255, 1, 1, 4, 2, 2, 66, 92, 91, 66, 91, 91, 67, 91, 66,
+    91, 91, 61, 254, 255, 1, 1, 3, 2, 2, 91, 66, 86, 66, 91, 86, 66, 91, 86, 66, 91, 61, 254, 255, 1, 1, 2, 2, 2, 86,
+    66, 86, 66, 86, 66, 86, 91, 61, 86, 66, 86, 61, 254, 255, 1, 1, 1, 2, 2, 61, 86, 61, 91, 86, 61, 86, 61, 66, 86, 86,
+    61, 86, 61, 91, 254, 255, 0, 0, 0, 2, 2, 86, 61, 86, 61, 86, 61, 86, 86, 255, 0, 0, 16, 0, 0, 0, 16, 2, 2, 63,
+    63, 88, 63, 88, 63, 88, 254, 1, 0, 0, 15, 2, 2, 93, 88, 63, 63, 88, 63, 93, 88, 63, 88, 63, 93, 63, 254, 1, 0, 1,
+    14, 2, 2, 63, 93, 63, 88, 68, 88, 63, 93, 88, 68, 88, 68, 88, 68, 254, 1, 0, 1, 13, 2, 2, 93, 63, 93, 68, 88, 93,
+    68, 88, 68, 93, 88, 68, 254, 1, 1, 1, 12, 2, 2, 93, 63, 93, 68, 93, 93, 88, 68, 93, 68, 93, 92, 254, 1, 1, 0, 11,
+    2, 2, 93, 93, 67, 93, 68, 92, 93, 68, 92, 68, 93, 92, 254, 1, 1, 0, 10, 2, 2, 92, 68, 92, 93, 67, 93, 67, 93, 92,
+    67, 93, 67, 92, 254, 1, 1, 0, 9, 2, 2, 92, 67, 92, 68, 92, 67, 92, 67, 93, 92, 67, 92, 67, 67, 93, 254, 0, 1, 1,
+    8, 2, 2, 67, 92, 67, 92, 67, 92, 67, 255, 16, 0, 31, 0, 0, 0, 24, 2, 2, 57, 82, 57, 82, 57, 82, 254, 0, 255, 0,
+    23, 2, 2, 83, 82, 57, 57, 82, 57, 83, 82, 57, 82, 57, 83, 57, 254, 0, 255, 1, 22, 2, 2, 57, 83, 57, 82, 58, 82, 57,
+    83, 82, 58, 82, 58, 82, 58, 254, 0, 255, 1, 21, 2, 2, 83, 57, 83, 58, 82, 83, 58, 82, 58, 83, 82, 58, 254, 1, 255, 1,
+    20, 2, 2, 83, 57, 83, 58, 83, 83, 82, 58, 83, 58, 83, 88, 254, 1, 255, 0, 19, 2, 2, 83, 83, 63, 83, 58, 88, 83, 58,
+    88, 58, 83, 88, 254, 1, 255, 0, 18, 2, 2, 88, 58, 88, 83, 63, 83, 63, 83, 88, 63, 83, 63, 88, 254, 1, 255, 0, 17, 2,
+    2, 88, 63, 88, 58, 88, 63, 88, 63, 83, 88, 63, 88, 63, 63, 83, 254, 1, 0, 1, 16, 2, 2, 63, 88, 63, 88, 63, 88, 63,
+    255, 31, 0, 16, 0, 0, 0, 0, 2, 4, 61, 86, 61, 86, 61, 86, 254, 255, 0, 0, 1, 2, 4, 91, 86, 61, 61, 86, 61, 91,
+    86, 61, 86, 61, 91, 61, 254, 255, 0, 1, 2, 2, 4, 61, 91, 61, 86, 66, 86, 61, 91, 86, 66, 86, 66, 86, 66, 254, 255, 0,
+    1, 3, 2, 4, 91, 61, 91, 66, 86, 91, 66, 86, 66, 91, 86, 66, 254, 255, 1, 1, 4, 2, 4, 91, 61, 91, 66, 91, 91, 86,
+    66, 91, 66, 91, 92, 254, 255, 1, 0, 5, 2, 4, 91, 91, 67, 91, 66, 92, 91, 66, 92, 66, 91, 92, 254, 255, 1, 0, 6, 2,
+    4, 92, 66, 92, 91, 67, 91, 67, 91, 92, 67, 91, 67, 92, 254, 255, 1, 0, 7, 2, 4, 92, 67, 92, 66, 92, 67, 92, 67, 91,
+    92, 67, 92, 67, 67, 91, 254, 0, 1, 1, 8, 2, 4, 67, 92, 67, 92, 67, 92, 67, 255, 16, 0, 0, 0, 0, 0, 8, 2, 4,
+    67, 67, 92, 67, 92, 67, 92, 254, 0, 1, 0, 9, 2, 4, 93, 92, 67, 67, 92, 67, 93, 92, 67, 92, 67, 93, 67, 254, 0, 1,
+    1, 10, 2, 4, 67, 93, 67, 92, 68, 92, 67, 93, 92, 68, 92, 68, 92, 68, 254, 0, 1, 1, 11, 2, 4, 93, 67, 93, 68, 92,
+    93, 68, 92, 68, 93, 92, 68, 254, 1, 1, 1, 12, 2, 4, 93, 67, 93, 68, 93, 93, 92, 68, 93, 68, 93, 88, 254, 1, 1, 0,
+    13, 2, 4, 93, 93, 63, 93, 68, 88, 93, 68, 88, 68, 93, 88, 254, 1, 1, 0, 14, 2, 4, 88, 68, 88, 93, 63, 93, 63, 93,
+    88, 63, 93, 63, 88, 254, 1, 1, 0, 15, 2, 4, 88, 63, 88, 68, 88, 63, 88, 63, 93, 88, 63, 88, 63, 63, 93, 254, 1, 0,
+    1, 16, 2, 4, 63, 88, 63, 88, 63, 88, 63, 255, 0, 0, 16, 0, 0, 0, 16, 2, 4, 63, 63, 88, 63, 88, 63, 88, 254, 1,
+    0, 0, 17, 2, 4, 83, 63, 88, 63, 88, 63, 83, 88, 63, 63, 88, 58, 88, 254, 1, 0, 1, 18, 2, 4, 63, 83, 63, 88, 58,
+    88, 63, 83, 63, 83, 88, 58, 88, 58, 254, 1, 0, 1, 19, 2, 4, 58, 88, 83, 58, 88, 58, 83, 88, 58, 83, 88, 58, 254, 1,
+    255, 1, 20, 2, 4, 58, 88, 83, 58, 83, 83, 63, 83, 58, 83, 83, 57, 254, 1, 255, 1, 21, 2, 4, 83, 58, 82, 58, 83, 82,
+    58, 83, 82, 58, 83, 57, 254, 1, 255, 1, 22, 2, 4, 82, 58, 82, 58, 82, 58, 82, 83, 57, 82, 58, 82, 57, 254, 1, 255, 1,
+    23, 2, 4, 57, 82, 57, 83, 82, 57, 82, 57, 58, 82, 82, 57, 82, 57, 83, 254, 0, 255, 0, 24, 2, 4, 82, 57, 82, 57, 82,
+    57, 82, 82, 255, 16, 0, 31, 0, 0, 0, 24, 2, 4, 57, 82, 57, 82, 57, 82, 254, 0, 255, 0, 25, 2, 4, 81, 57, 82, 57,
+    82, 57, 81, 82, 57, 57, 82, 56, 82, 254, 0, 255, 1, 26, 2, 4, 57, 81, 57, 82, 56, 82, 57, 81, 57, 81, 82, 56, 82, 56,
+    254, 0, 255, 1, 27, 2, 4, 56, 82, 81, 56, 82, 56, 81, 82, 56, 81, 82, 56, 254, 255, 255, 1, 28, 2, 4, 56, 82, 81, 56,
+    81, 81, 82, 56, 81, 56, 81, 86, 254, 255, 255, 0, 29, 2, 4, 81, 81, 61, 81, 56, 86, 81, 56, 86, 56, 81, 86, 254, 255, 255,
+    0, 30, 2, 4, 86, 56, 86, 56, 86, 81, 61, 81, 61, 86, 56, 86, 86, 254, 255, 255, 0, 31, 2, 4, 86, 61, 86, 56, 86, 61,
+    86, 61, 81, 61, 86, 61, 86, 61, 81, 254, 255, 0, 0, 0, 2, 4, 86, 61, 86, 61, 86, 61, 86, 86, 255, 31, 0, 16, 0, 15,
+    0, 0, 6, 2, 61, 36, 61, 36, 61, 36, 254, 255, 0, 0, 31, 6, 2, 31, 61, 36, 61, 36, 61, 31, 36, 61, 61, 36, 56, 36,
+    254, 255, 0, 255, 30, 6, 2, 61, 31, 61, 36, 56, 36, 61, 31, 61, 31, 36, 56, 36, 56, 254, 255, 0, 255, 29, 6, 2, 56, 36,
+    31, 56, 36, 56, 31, 36, 56, 31, 36, 56, 254, 255, 255, 255, 28, 6, 2, 56, 36, 31, 56, 31, 31, 61, 31, 56, 31, 31, 57, 254,
+    255, 255, 255, 27, 6, 2, 31, 56, 32, 56, 31, 32, 56, 31, 32, 56, 31, 57, 254, 255, 255, 255, 26, 6, 2, 32, 56, 32, 56, 32,
+    56, 32, 31, 57, 32, 56, 32, 57, 254, 255, 255, 255, 25, 6, 2, 57, 32, 57, 31, 32, 57, 32, 57, 56, 32, 32, 57, 32, 57, 31,
+    254, 0, 255, 0, 24, 6, 2, 32, 57, 32, 57, 32, 57, 32, 32, 255, 16, 0, 0, 0, 15, 0, 8, 6, 2, 67, 67, 42, 67, 42,
+    67, 42, 254, 0, 1, 0, 7, 6, 2, 41, 67, 42, 67, 42, 67, 41, 42, 67, 67, 42, 66, 42, 254, 0, 1, 255, 6, 6, 2, 67,
+    41, 67, 42, 66, 42, 67, 41, 67, 41, 42, 66, 42, 66, 254, 0, 1, 255, 5, 6, 2, 66, 42, 41, 66, 42, 66, 41, 42, 66, 41,
+    42, 66, 254, 255, 1, 255, 4, 6, 2, 66, 42, 41, 66, 41, 41, 67, 41, 66, 41, 41, 61, 254, 255, 1, 255, 3, 6, 2, 41, 66,
+    36, 66, 41, 36, 66, 41, 36, 66, 41, 61, 254, 255, 1, 255, 2, 6, 2, 36, 66, 36, 66, 36, 66, 36, 41, 61, 36, 66, 36, 61,
+    254, 255, 1, 255, 1, 6, 2, 61, 36, 61, 41, 36, 61, 36, 61, 66, 36, 36, 61, 36, 61, 41, 254, 255, 0, 0, 0, 6, 2, 36,
+    61, 36, 61, 36, 61, 36, 36, 255, 0, 0, 16, 0, 15, 0, 16, 6, 2, 63, 63, 38, 63, 38, 63, 38, 254, 1, 0, 0, 15, 6,
+    2, 43, 38, 63, 63, 38, 63, 43, 38, 63, 38, 63, 43, 63, 254, 1, 0, 255, 14, 6, 2, 63, 43, 63, 38, 68, 38, 63, 43, 38,
+    68, 38, 68, 38, 68, 254, 1, 0, 255, 13, 6, 2, 43, 63, 43, 68, 38, 43, 68, 38, 68, 43, 38, 68, 254, 1, 1, 255, 12, 6,
+    2, 43, 63, 43, 68, 43, 43, 38, 68, 43, 68, 43, 42, 254, 1, 1, 0, 11, 6, 2, 43, 43, 67, 43, 68, 42, 43, 68, 42, 68,
+    43, 42, 254, 1, 1, 0, 10, 6, 2, 42, 68, 42, 43, 67, 43, 67, 43, 42, 67, 43, 67, 42, 254, 1, 1, 0, 9, 6, 2, 42,
+    67, 42, 68, 42, 67, 42, 67, 43, 42, 67, 42, 67, 67, 43, 254, 0, 1, 255, 8, 6, 2, 67, 42, 67, 42, 67, 42, 67, 255, 16,
+    0, 31, 0, 15, 0, 24, 6, 2, 57, 32, 57, 32, 57, 32, 254, 0, 255, 0, 23, 6, 2, 33, 32, 57, 57, 32, 57, 33, 32, 57,
+    32, 57, 33, 57, 254, 0, 255, 255, 22, 6, 2, 57, 33, 57, 32, 58, 32, 57, 33, 32, 58, 32, 58, 32, 58, 254, 0, 255, 255, 21,
+    6, 2, 33, 57, 33, 58, 32, 33, 58, 32, 58, 33, 32, 58, 254, 1, 255, 255, 20, 6, 2, 33, 57, 33, 58, 33, 33, 32, 58, 33,
+    58, 33, 38, 254, 1, 255, 0, 19, 6, 2, 33, 33, 63, 33, 58, 38, 33, 58, 38, 58, 33, 38, 254, 1, 255, 0, 18, 6, 2, 38,
+    58, 38, 33, 63, 33, 63, 33, 38, 63, 33, 63, 38, 254, 1, 255, 0, 17, 6, 2, 38, 63, 38, 58, 38, 63, 38, 63, 33, 38, 63,
+    38, 63, 63, 33, 254, 1, 0, 255, 16, 6, 2, 63, 38, 63, 38, 63, 38, 63, 255, 31, 0, 16, 0, 15, 0, 0, 6, 4, 61, 36,
+    61, 36, 61, 36, 254, 255, 0, 0, 1, 6, 4, 41, 36, 61, 61, 36, 61, 41, 36, 61, 36, 61, 41, 61, 254, 255, 0, 255, 2, 6,
+    4, 61, 41, 61, 36, 66, 36, 61, 41, 36, 66, 36, 66, 36, 66, 254, 255, 0, 255, 3, 6, 4, 41, 61, 41, 66, 36, 41, 66, 36,
+    66, 41, 36, 66, 254, 255, 1, 255, 4, 6, 4, 41, 61, 41, 66, 41, 41, 36, 66, 41, 66, 41, 42, 254, 255, 1, 0, 5, 6, 4,
+    41, 41, 67, 41, 66, 42, 41, 66, 42, 66, 41, 42, 254, 255, 1, 0, 6, 6, 4, 42, 66, 42, 41, 67, 41, 67, 41, 42, 67, 41,
+    67, 42, 254, 255, 1, 0, 7, 6, 4, 42, 67, 42, 66, 42, 67, 42, 67, 41, 42, 67, 42, 67, 67, 41, 254, 0, 1, 255, 8, 6,
+    4, 67, 42, 67, 42, 67, 42, 67, 255, 16, 0, 0, 0, 15, 0, 8, 6, 4, 67, 67, 42, 67, 42, 67, 42, 254, 0, 1, 0, 9,
+    6, 4, 43, 42, 67, 67, 42, 67, 43, 42, 67, 42, 67, 43, 67, 254, 0, 1, 255, 10, 6, 4, 67, 43, 67, 42, 68, 42, 67, 43,
+    42, 68, 42, 68, 42, 68, 254, 0, 1, 255, 11, 6, 4, 43, 67, 43, 68, 42, 43, 68, 42, 68, 43, 42, 68, 254, 1, 1, 255, 12,
+    6, 4, 43, 67, 43, 68, 43, 43, 42, 68, 43, 68, 43, 38, 254, 1, 1, 0, 13, 6, 4, 43, 43, 63, 43, 68, 38, 43, 68, 38,
+    68, 43, 38, 254, 1, 1, 0, 14, 6, 4, 38, 68, 38, 43, 63, 43, 63, 43, 38, 63, 43, 63, 38, 254, 1, 1, 0, 15, 6, 4,
+    38, 63, 38, 68, 38, 63, 38, 63, 43, 38, 63, 38, 63, 63, 43, 254, 1, 0, 255, 16, 6, 4, 63, 38, 63, 38, 63, 38, 63, 255,
+    0, 0, 16, 0, 15, 0, 16, 6, 4, 63, 63, 38, 63, 38, 63, 38, 254, 1, 0, 0, 17, 6, 4, 33, 63, 38, 63, 38, 63, 33,
+    38, 63, 63, 38, 58, 38, 254, 1, 0, 255, 18, 6, 4, 63, 33, 63, 38, 58, 38, 63, 33, 63, 33, 38, 58, 38, 58, 254, 1, 0,
+    255, 19, 6, 4, 58, 38, 33, 58, 38, 58, 33, 38, 58, 33, 38, 58, 254, 1, 255, 255, 20, 6, 4, 58, 38, 33, 58, 33, 33, 63,
+    33, 58, 33, 33, 57, 254, 1, 255, 255, 21, 6, 4, 33, 58, 32, 58, 33, 32, 58, 33, 32, 58, 33, 57, 254, 1, 255, 255, 22, 6,
+    4, 32, 58, 32, 58, 32, 58, 32, 33, 57, 32, 58, 32, 57, 254, 1, 255, 255, 23, 6, 4, 57, 32, 57, 33, 32, 57, 32, 57, 58,
+    32, 32, 57, 32, 57, 33, 254, 0, 255, 0, 24, 6, 4, 32, 57, 32, 57, 32, 57, 32, 32, 255, 16, 0, 31, 0, 15, 0, 24, 6,
+    4, 57, 32, 57, 32, 57, 32, 254, 0, 255, 0, 25, 6, 4, 31, 57, 32, 57, 32, 57, 31, 32, 57, 57, 32, 56, 32, 254, 0, 255,
+    255, 26, 6, 4, 57, 31, 57, 32, 56, 32, 57, 31, 57, 31, 32, 56, 32, 56, 254, 0, 255, 255, 27, 6, 4, 56, 32, 31, 56, 32,
+    56, 31, 32, 56, 31, 32, 56, 254, 255, 255, 255, 28, 6, 4, 56, 32, 31, 56, 31, 31, 57, 31, 56, 31, 31, 61, 254, 255, 255, 255,
+    29, 6, 4, 31, 56, 36, 56, 31, 36, 56, 31, 36, 56, 31, 61, 254, 255, 255, 255, 30, 6, 4, 36, 56, 36, 56, 36, 56, 36, 31,
+    61, 36, 56, 36, 61, 254, 255, 255, 255, 31, 6, 4, 61, 36, 61, 31, 36, 61, 36, 61, 56, 36, 36, 61, 36, 61, 31, 254, 255, 0,
+    0, 0, 6, 4, 36, 61, 36, 61, 36, 61, 36, 36, 255, 31, 0, 16, 0, 0, 0, 0, 2, 0, 86, 61, 86, 61, 86, 61, 86, 254,
+    255, 0, 0, 0, 2, 1, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 254, 255, 0, 0, 0, 2, 2, 86, 61,
+    86, 61, 86, 61, 86, 255, 16, 0, 0, 0, 0, 0, 8, 2, 0, 67, 92, 67, 92, 67, 92, 67, 254, 0, 1, 1, 8, 2, 1, 67,
+    92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 254, 0, 1, 1, 8, 2, 2, 67, 92, 67, 92, 67, 92, 67, 255, 0,
+    0, 16, 0, 0, 0, 16, 2, 0, 63, 88, 63, 88, 63, 88, 63, 254, 1, 0, 1, 16, 2, 1, 63, 88, 63, 88, 63, 88, 63, 88,
+    63, 88, 63, 88, 63, 88, 63, 254, 1, 0, 1, 16, 2, 2, 63, 88, 63, 88, 63, 88, 63, 255, 16, 0, 31, 0, 0, 0, 24, 2,
+    0, 82, 57, 82, 57, 82, 57, 82, 254, 0, 255, 0, 24, 2, 1, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82,
+    254, 0, 255, 0, 24, 2, 2, 82, 57, 82, 57, 82, 57, 82, 255, 31, 0, 16, 0, 0, 0, 0, 2, 0, 86, 61, 86, 61, 86, 61,
+    86, 254, 255, 0, 0, 0, 2, 3, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 254, 255, 0, 0, 0, 2, 4,
+    86, 61, 86, 61, 86, 61, 86, 255, 16, 0, 0, 0, 0, 0, 8, 2, 0, 67, 92, 67, 92, 67, 92, 67, 254, 0, 1, 1, 8, 2,
+    3, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 254, 0, 1, 1, 8, 2, 4, 67, 92, 67, 92, 67, 92, 67,
+    255, 0, 0, 16, 0, 0, 0, 16, 2, 0, 63, 88, 63, 88, 63, 88, 63, 254, 1, 0, 1, 16, 2, 3, 63, 88, 63, 88, 63, 88,
+    63, 88, 63, 88, 63, 88, 63, 88, 63, 254, 1, 0, 1, 16, 2, 4, 63, 88, 63, 88, 63, 88, 63, 255, 16, 0, 31, 0, 0, 0,
+    24, 2, 0, 82, 57, 82, 57, 82, 57, 82, 254, 0, 255, 0, 24, 2, 3, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82,
+    57, 82, 254, 0, 255, 0, 24, 2, 4, 82, 57, 82, 57, 82, 57, 82, 255, 31, 0, 16, 0, 0, 0, 0, 2, 2, 86, 61, 86, 61,
+    86, 61, 86, 254, 255, 0, 0, 0, 2, 1, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 254, 255, 0, 0, 0,
+    2, 0, 86, 61, 86, 61, 86, 61, 86, 255, 16, 0, 0, 0, 0, 0, 8, 2, 2, 67, 92, 67, 92, 67, 92, 67, 254, 0, 1, 1,
+    8, 2, 1, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 254, 0, 1, 1, 8, 2, 0, 67, 92, 67, 92, 67,
+    92, 67, 255, 0, 0, 16, 0, 0, 0, 16, 2, 2, 63, 88, 63, 88, 63, 88, 63, 254, 1, 0, 1, 16, 2, 1, 63, 88, 63, 88,
+    63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 254, 1, 0, 1, 16, 2, 0, 63, 88, 63, 88, 63, 88, 63, 255, 16, 0, 31, 0,
+    0, 0, 24, 2, 2, 82, 57, 82, 57, 82, 57, 82, 254, 0, 255, 0, 24, 2, 1, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82,
+    57, 82, 57, 82, 254, 0, 255, 0, 24, 2, 0, 82, 57, 82, 57, 82, 57, 82, 255, 31, 0, 16, 0, 0, 0, 0, 2, 4, 86, 61,
+    86, 61, 86, 61, 86, 254, 255, 0, 0, 0, 2, 3, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 254, 255, 0,
+    0, 0, 2, 0, 86, 61, 86, 61, 86, 61, 86, 255, 16, 0, 0, 0, 0, 0, 8, 2, 4, 67, 92, 67, 92, 67, 92, 67, 254, 0,
+    1, 1, 8, 2, 3, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 254, 0, 1, 1, 8, 2, 0, 67, 92, 67,
+    92, 67, 92, 67, 255, 0, 0, 16, 0, 0, 0, 16, 2, 4, 63, 88, 63, 88, 63, 88, 63, 254, 1, 0, 1, 16, 2, 3, 63, 88,
+    63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 254, 1, 0, 1, 16, 2, 0, 63, 88, 63, 88, 63, 88, 63, 255, 16, 0,
+    31, 0, 0, 0, 24, 2, 4, 82, 57, 82, 57, 82, 57, 82, 254, 0, 255, 0, 24, 2, 3, 82, 57, 82, 57, 82, 57, 82, 57, 82,
+    57, 82, 57, 82, 57, 82, 254, 0, 255, 0, 24, 2, 0, 82, 57, 82, 57, 82, 57, 82, 255, 31, 0, 16, 0, 15, 0, 0, 6, 0,
+    61, 36, 61, 36, 61, 36, 61, 254, 255, 0, 255, 0, 6, 1, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 254,
+    255, 0, 255, 0, 6, 2, 61, 36, 61, 36, 61, 36, 61, 255, 16, 0, 0, 0, 15, 0, 8, 6, 0, 42, 67, 42, 67, 42, 67, 42,
+    254, 0, 1, 0, 8, 6, 1, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 254, 0, 1, 0, 8, 6, 2, 42,
+    67, 42, 67, 42, 67, 42, 255, 0, 0, 16, 0, 15, 0, 16, 6, 0, 38, 63, 38, 63, 38, 63, 38, 254, 1, 0, 0, 16, 6, 1,
+    38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 254, 1, 0, 0, 16, 6, 2, 38, 63, 38, 63, 38, 63, 38, 255,
+    16, 0, 31, 0, 15, 0, 24, 6, 0, 57, 32, 57, 32, 57, 32, 57, 254, 0, 255, 255, 24, 6, 1, 57, 32, 57, 32, 57, 32, 57,
+    32, 57, 32, 57, 32, 57, 32, 57, 254, 0, 255, 255, 24, 6, 2, 57, 32, 57, 32, 57, 32, 57, 255, 31, 0, 16, 0, 15, 0, 0,
+    6, 0, 61, 36, 61, 36, 61, 36, 61, 254, 255, 0, 255, 0, 6, 3, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36,
+    61, 254, 255, 0, 255, 0, 6, 4, 61, 36, 61, 36, 61, 36, 61, 255, 16, 0, 0, 0, 15, 0, 8, 6, 0, 42, 67, 42, 67, 42,
+    67, 42, 254, 0, 1, 0, 8, 6, 3, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 254, 0, 1, 0, 8, 6,
+    4, 42, 67, 42, 67, 42, 67, 42, 255, 0, 0, 16, 0, 15, 0, 16, 6, 0, 38, 63, 38, 63, 38, 63, 38, 254, 1, 0, 0, 16,
+    6, 3, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 254, 1, 0, 0, 16, 6, 4, 38, 63, 38, 63, 38, 63,
+    38, 255, 16, 0, 31, 0, 15, 0, 24, 6, 0, 57, 32, 57, 32, 57, 32, 57, 254, 0, 255, 255, 24, 6, 3, 57, 32, 57, 32, 57,
+    32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 254, 0, 255, 255, 24, 6, 4, 57, 32, 57, 32, 57, 32, 57, 255, 31, 0, 16, 0, 15,
+    0, 0, 6, 2, 61, 36, 61, 36, 61, 36, 61, 254, 255, 0, 255, 0, 6, 1, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36,
+    61, 36, 61, 254, 255, 0, 255, 0, 6, 0, 61, 36, 61, 36, 61, 36, 61, 255, 16, 0, 0, 0, 15, 0, 8, 6, 2, 42, 67, 42,
+    67, 42, 67, 42, 254, 0, 1, 0, 8, 6, 1, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 254, 0, 1, 0,
+    8, 6, 0, 42, 67, 42, 67, 42, 67, 42, 255, 0, 0, 16, 0, 15, 0, 16, 6, 2, 38, 63, 38, 63, 38, 63, 38, 254, 1, 0,
+    0, 16, 6, 1, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 254, 1, 0, 0, 16, 6, 0, 38, 63, 38, 63,
+    38, 63, 38, 255, 16, 0, 31, 0, 15, 0, 24, 6, 2, 57, 32, 57, 32, 57, 32, 57, 254, 0, 255, 255, 24, 6, 1, 57, 32, 57,
+    32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 254, 0, 255, 255, 24, 6, 0, 57, 32, 57, 32, 57, 32, 57, 255, 31, 0, 16,
+    0, 15, 0, 0, 6, 4, 61, 36, 61, 36, 61, 36, 61, 254, 255, 0, 255, 0, 6, 3, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36,
+    61, 36, 61, 36, 61, 254, 255, 0, 255, 0, 6, 0, 61, 36, 61, 36, 61, 36, 61, 255, 16, 0, 0, 0, 15, 0, 8, 6, 4, 42,
+    67, 42, 67, 42, 67, 42, 254, 0, 1, 0, 8, 6, 3, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 254, 0,
+    1, 0, 8, 6, 0, 42, 67, 42, 67, 42, 67, 42, 255, 0, 0, 16, 0, 15, 0, 16, 6, 4, 38, 63, 38, 63, 38, 63, 38, 254,
+    1, 0, 0, 16, 6, 3, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 254, 1, 0, 0, 16, 6, 0, 38, 63,
+    38, 63, 38, 63, 38, 255, 16, 0, 31, 0, 15, 0, 24, 6, 4, 57, 32, 57, 32, 57, 32, 57, 254, 0, 255, 255, 24, 6, 3, 57,
+    32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 254, 0, 255, 255, 24, 6, 0, 57, 32, 57, 32, 57, 32, 57, 255, 31,
+    0, 16, 0, 0, 0, 0, 0, 2, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 1, 2, 61, 86, 61, 61, 61, 61, 61, 86,
+    61, 61, 61, 86, 61, 61, 86, 254, 255, 0, 0, 0, 2, 2, 86, 61, 86, 61, 86, 61, 86, 255, 16, 0, 0, 0, 0, 0, 8, 0,
+    2, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 1, 2, 67, 92, 67, 67, 67, 67, 67, 92, 67, 67, 67, 92, 67, 67, 92,
+    254, 0, 1, 0, 8, 2, 2, 67, 92, 67, 92, 67, 92, 67, 255, 0, 0, 16, 0, 0, 0, 16, 0, 2, 63, 63, 63, 63, 63, 63,
+    63, 254, 1, 0, 0, 16, 1, 2, 63, 88, 63, 63, 63, 63, 63, 88, 63, 63, 63, 88, 63, 63, 88, 254, 1, 0, 0, 16, 2, 2,
+    63, 88, 63, 88, 63, 88, 63, 255, 16, 0, 31, 0, 0, 0, 24, 0, 2, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 1,
+    2, 57, 82, 57, 57, 57, 57, 57, 82, 57, 57, 57, 82, 57, 57, 82, 254, 0, 255, 0, 24, 2, 2, 82, 57, 82, 57, 82, 57, 82,
+    255, 31, 0, 16, 0, 0, 0, 0, 0, 4, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 1, 4, 61, 86, 61, 61, 61, 61,
+    61, 86, 61, 61, 61, 86, 61, 61, 86, 254, 255, 0, 0, 0, 2, 4, 86, 61, 86, 61, 86, 61, 86, 255, 16, 0, 0, 0, 0, 0,
+    8, 0, 4, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 1, 4, 67, 92, 67, 67, 67, 67, 67, 92, 67, 67, 67, 92, 67,
+    67, 92, 254, 0, 1, 0, 8, 2, 4, 67, 92, 67, 92, 67, 92, 67, 255, 0, 0, 16, 0, 0, 0, 16, 0, 4, 63, 63, 63, 63,
+    63, 63, 63, 254, 1, 0, 0, 16, 1, 4, 63, 88, 63, 63, 63, 63, 63, 88, 63, 63, 63, 88, 63, 63, 88, 254, 1, 0, 0, 16,
+    2, 4, 63, 88, 63, 88, 63, 88, 63, 255, 16, 0, 31, 0, 0, 0, 24, 0, 4, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0,
+    24, 1, 4, 57, 82, 57, 57, 57, 57, 57, 82, 57, 57, 57, 82, 57, 57, 82, 254, 0, 255, 0, 24, 2, 4, 82, 57, 82, 57, 82,
+    57, 82, 255, 31, 0, 16, 0, 0, 0, 0, 2, 2, 86, 61, 86, 61, 86, 61, 61, 254, 255, 0, 1, 0, 1, 2, 61, 61, 86, 61,
+    61, 86, 61, 61, 61, 86, 61, 61, 61, 254, 255, 0, 0, 0, 0, 2, 61, 86, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0,
+    0, 0, 8, 2, 2, 67, 92, 67, 92, 67, 92, 67, 254, 0, 1, 1, 8, 1, 2, 67, 67, 92, 67, 67, 92, 67, 67, 67, 92, 67,
+    67, 67, 254, 0, 1, 0, 8, 0, 2, 67, 92, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 0, 0, 16, 2, 2, 63, 88,
+    63, 88, 63, 88, 63, 254, 1, 0, 1, 16, 1, 2, 63, 63, 88, 63, 63, 88, 63, 63, 63, 88, 63, 63, 63, 254, 1, 0, 0, 16,
+    0, 2, 63, 88, 63, 63, 63, 63, 63, 63, 63, 255, 16, 0, 31, 0, 0, 0, 24, 2, 2, 82, 57, 82, 57, 82, 57, 57, 254, 0,
+    255, 1, 24, 1, 2, 57, 57, 82, 57, 57, 82, 57, 57, 57, 82, 57, 57, 57, 254, 0, 255, 0, 24, 0, 2, 57, 82, 57, 57, 57,
+    57, 57, 57, 57, 255, 31, 0, 16, 0, 0, 0, 0, 2, 4, 86, 61, 86, 61, 86, 61, 61, 254, 255, 0, 1, 0, 1, 4, 61, 61,
+    86, 61, 61, 86, 61, 61, 61, 86, 61, 61, 61, 254, 255, 0, 0, 0, 0, 4, 61, 86, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0,
+    0, 0, 0, 0, 8, 2, 4, 67, 92, 67, 92, 67, 92, 67, 254, 0, 1, 1, 8, 1, 4, 67, 67, 92, 67, 67, 92, 67, 67, 67,
+    92, 67, 67, 67, 254, 0, 1, 0, 8, 0, 4, 67, 92, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 0, 0, 16, 2, 4,
+    63, 88, 63, 88, 63, 88, 63, 254, 1, 0, 1, 16, 1, 4, 63, 63, 88, 63, 63, 88, 63, 63, 63, 88, 63, 63, 63, 254, 1, 0,
+    0, 16, 0, 4, 63, 88, 63, 63, 63, 63, 63, 63, 63, 255, 16, 0, 31, 0, 0, 0, 24, 2, 4, 82, 57, 82, 57, 82, 57, 57,
+    254, 0, 255, 1, 24, 1, 4, 57, 57, 82, 57, 57, 82, 57, 57, 57, 82, 57, 57, 57, 254, 0, 255, 0, 24, 0, 4, 57, 82, 57,
+    57, 57, 57, 57, 57, 57, 255, 31, 0, 16, 0, 8, 0, 0, 0, 2, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 255, 0, 5, 2,
+    61, 61, 61, 61, 61, 36, 61, 61, 61, 36, 61, 61, 36, 61, 61, 254, 255, 0, 255, 0, 6, 2, 61, 36, 61, 36, 61, 36, 61, 255,
+    16, 0, 0, 0, 8, 0, 8, 0, 2, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 255, 8, 5, 2, 67, 67, 67, 67, 67, 42, 67,
+    67, 67, 42, 67, 67, 42, 67, 67, 254, 0, 1, 255, 8, 6, 2, 67, 67, 42, 67, 42, 67, 42, 255, 0, 0, 16, 0, 8, 0, 16,
+    0, 2, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 255, 16, 5, 2, 63, 63, 63, 63, 63, 38, 63, 63, 63, 38, 63, 63, 38, 63,
+    63, 254, 1, 0, 255, 16, 6, 2, 63, 63, 38, 63, 38, 63, 38, 255, 16, 0, 31, 0, 8, 0, 24, 0, 2, 57, 57, 57, 57, 57,
+    57, 57, 254, 0, 255, 255, 24, 5, 2, 57, 57, 57, 57, 57, 32, 57, 57, 57, 32, 57, 57, 32, 57, 57, 254, 0, 255, 255, 24, 6,
+    2, 57, 32, 57, 32, 57, 32, 57, 255, 31, 0, 16, 0, 8, 0, 0, 0, 4, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 255, 0,
+    5, 4, 61, 61, 61, 61, 61, 36, 61, 61, 61, 36, 61, 61, 36, 61, 61, 254, 255, 0, 255, 0, 6, 4, 61, 36, 61, 36, 61, 36,
+    61, 255, 16, 0, 0, 0, 8, 0, 8, 0, 4, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 255, 8, 5, 4, 67, 67, 67, 67, 67,
+    42, 67, 67, 67, 42, 67, 67, 42, 67, 67, 254, 0, 1, 255, 8, 6, 4, 67, 67, 42, 67, 42, 67, 42, 255, 0, 0, 16, 0, 8,
+    0, 16, 0, 4, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 255, 16, 5, 4, 63, 63, 63, 63, 63, 38, 63, 63, 63, 38, 63, 63,
+    38, 63, 63, 254, 1, 0, 255, 16, 6, 4, 63, 63, 38, 63, 38, 63, 38, 255, 16, 0, 31, 0, 8, 0, 24, 0, 4, 57, 57, 57,
+    57, 57, 57, 57, 254, 0, 255, 255, 24, 5, 4, 57, 57, 57, 57, 57, 32, 57, 57, 57, 32, 57, 57, 32, 57, 57, 254, 0, 255, 255,
+    24, 6, 4, 57, 32, 57, 32, 57, 32, 57, 255, 31, 0, 16, 0, 7, 0, 0, 6, 2, 61, 36, 61, 36, 61, 36, 61, 254, 255, 0,
+    0, 0, 5, 2, 36, 61, 61, 36, 61, 61, 61, 36, 61, 61, 61, 61, 61, 254, 255, 0, 255, 0, 0, 2, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 255, 16, 0, 0, 0, 8, 0, 8, 6, 2, 42, 67, 42, 67, 42, 67, 42, 254, 0, 1, 0, 8, 5, 2, 42, 67, 67,
+    42, 67, 67, 67, 42, 67, 67, 67, 67, 67, 254, 0, 1, 255, 8, 0, 2, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 16,
+    0, 8, 0, 16, 6, 2, 38, 63, 38, 63, 38, 63, 38, 254, 1, 0, 0, 16, 5, 2, 38, 63, 63, 38, 63, 63, 63, 38, 63, 63,
+    63, 63, 63, 254, 1, 0, 255, 16, 0, 2, 63, 63, 63, 63, 63, 63, 63, 63, 63, 255, 16, 0, 31, 0, 7, 0, 24, 6, 2, 57,
+    32, 57, 32, 57, 32, 57, 254, 0, 255, 0, 24, 5, 2, 32, 57, 57, 32, 57, 57, 57, 32, 57, 57, 57, 57, 57, 254, 0, 255, 255,
+    24, 0, 2, 57, 57, 57, 57, 57, 57, 57, 57, 57, 255, 31, 0, 16, 0, 7, 0, 0, 6, 4, 61, 36, 61, 36, 61, 36, 61, 254,
+    255, 0, 0, 0, 5, 4, 36, 61, 61, 36, 61, 61, 61, 36, 61, 61, 61, 61, 61, 254, 255, 0, 255, 0, 0, 4, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 8, 0, 8, 6, 4, 42, 67, 42, 67, 42, 67, 42, 254, 0, 1, 0, 8, 5, 4, 42,
+    67, 67, 42, 67, 67, 67, 42, 67, 67, 67, 67, 67, 254, 0, 1, 255, 8, 0, 4, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255, 0,
+    0, 16, 0, 8, 0, 16, 6, 4, 38, 63, 38, 63, 38, 63, 38, 254, 1, 0, 0, 16, 5, 4, 38, 63, 63, 38, 63, 63, 63, 38,
+    63, 63, 63, 63, 63, 254, 1, 0, 255, 16, 0, 4, 63, 63, 63, 63, 63, 63, 63, 63, 63, 255, 16, 0, 31, 0, 7, 0, 24, 6,
+    4, 57, 32, 57, 32, 57, 32, 57, 254, 0, 255, 0, 24, 5, 4, 32, 57, 57, 32, 57, 57, 57, 32, 57, 57, 57, 57, 57, 254, 0,
+    255, 255, 24, 0, 4, 57, 57, 57, 57, 57, 57, 57, 57, 57, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61,
+    61, 254, 255, 0, 0, 0, 1, 1, 61, 86, 61, 61, 61, 61, 61, 86, 61, 61, 61, 86, 61, 61, 86, 254, 255, 0, 0, 0, 2, 2,
+    61, 86, 61, 86, 61, 86, 61, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 1,
+    1, 67, 92, 67, 67, 67, 67, 67, 92, 67, 67, 67, 92, 67, 67, 92, 254, 0, 1, 0, 8, 2, 2, 67, 92, 67, 92, 67, 92, 67,
+    255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 1, 1, 63, 88, 63, 63, 63, 63,
+    63, 88, 63, 63, 63, 88, 63, 63, 88, 254, 1, 0, 0, 16, 2, 2, 63, 88, 63, 88, 63, 88, 63, 255, 16, 0, 31, 0, 0, 0,
+    24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 1, 1, 57, 82, 57, 57, 57, 57, 57, 82, 57, 57, 57, 82, 57,
+    57, 82, 254, 0, 255, 0, 24, 2, 2, 57, 82, 57, 82, 57, 82, 57, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61,
+    61, 61, 61, 254, 255, 0, 0, 0, 1, 3, 61, 86, 61, 61, 61, 61, 61, 86, 61, 61, 61, 86, 61, 61, 86, 254, 255, 0, 0, 0,
+    2, 4, 61, 86, 61, 86, 61, 86, 61, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0,
+    8, 1, 3, 67, 92, 67, 67, 67, 67, 67, 92, 67, 67, 67, 92, 67, 67, 92, 254, 0, 1, 0, 8, 2, 4, 67, 92, 67, 92, 67,
+    92, 67, 255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 1, 3, 63, 88, 63, 63,
+    63, 63, 63, 88, 63, 63, 63, 88, 63, 63, 88, 254, 1, 0, 0, 16, 2, 4, 63, 88, 63, 88, 63, 88, 63, 255, 16, 0, 31, 0,
+    0, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 1, 3, 57, 82, 57, 57, 57, 57, 57, 82, 57, 57, 57,
+    82, 57, 57, 82, 254, 0, 255, 0, 24, 2, 4, 57, 82, 57, 82, 57, 82, 57, 255, 31, 0, 16, 0, 0, 0, 0, 2, 2, 61, 86,
+    61, 86, 61, 86, 61, 254, 255, 0, 1, 0, 1, 1, 61, 61, 86, 61, 61, 86, 61, 61, 61, 86, 61, 61, 61, 254, 255, 0, 0, 0,
+    0, 0, 61, 86, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 0, 0, 8, 2, 2, 67, 92, 67, 92, 67, 92, 67, 254, 0,
+    1, 1, 8, 1, 1, 67, 67, 92, 67, 67, 92, 67, 67, 67, 92, 67, 67, 67, 254, 0, 1, 0, 8, 0, 0, 67, 92, 67, 67, 67,
+    67, 67, 67, 67, 255, 0, 0, 16, 0, 0, 0, 16, 2, 2, 63, 88, 63, 88, 63, 88, 63, 254, 1, 0, 1, 16, 1, 1, 63, 63,
+    88, 63, 63, 88, 63, 63, 63, 88, 63, 63, 63, 254, 1, 0, 0, 16, 0, 0, 63, 88, 63, 63, 63, 63, 63, 63, 63, 255, 16, 0,
+    31, 0, 0, 0, 24, 2, 2, 57, 82, 57, 82, 57, 82, 57, 254, 0, 255, 1, 24, 1, 1, 57, 57, 82, 57, 57, 82, 57, 57, 57,
+    82, 57, 57, 57, 254, 0, 255, 0, 24, 0, 0, 57, 82, 57, 57, 57, 57, 57, 57, 57, 255, 31, 0, 16, 0, 0, 0, 0, 2, 4,
+    61, 86, 61, 86, 61, 86, 61, 254, 255, 0, 1, 0, 1, 3, 61, 61, 86, 61, 61, 86, 61, 61, 61, 86, 61, 61, 61, 254, 255, 0,
+    0, 0, 0, 0, 61, 86, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 0, 0, 8, 2, 4, 67, 92, 67, 92, 67, 92, 67,
+    254, 0, 1, 1, 8, 1, 3, 67, 67, 92, 67, 67, 92, 67, 67, 67, 92, 67, 67, 67, 254, 0, 1, 0, 8, 0, 0, 67, 92, 67,
+    67, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 0, 0, 16, 2, 4, 63, 88, 63, 88, 63, 88, 63, 254, 1, 0, 1, 16, 1, 3,
+    63, 63, 88, 63, 63, 88, 63, 63, 63, 88, 63, 63, 63, 254, 1, 0, 0, 16, 0, 0, 63, 88, 63, 63, 63, 63, 63, 63, 63, 255,
+    16, 0, 31, 0, 0, 0, 24, 2, 4, 57, 82, 57, 82, 57, 82, 57, 254, 0, 255, 1, 24, 1, 3, 57, 57, 82, 57, 57, 82, 57,
+    57, 57, 82, 57, 57, 57, 254, 0, 255, 0, 24, 0, 0, 57, 82, 57, 57, 57, 57, 57, 57, 57, 255, 31, 0, 16, 0, 8, 0, 0,
+    0, 0, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 255, 0, 5, 1, 61, 61, 61, 61, 61, 36, 61, 61, 61, 36, 61, 61, 36, 61,
+    61, 254, 255, 0, 255, 0, 6, 2, 61, 36, 61, 36, 61, 36, 61, 255, 16, 0, 0, 0, 8, 0, 8, 0, 0, 67, 67, 67, 67, 67,
+    67, 67, 254, 0, 1, 255, 8, 5, 1, 67, 67, 67, 67, 67, 42, 67, 67, 67, 42, 67, 67, 42, 67, 67, 254, 0, 1, 255, 8, 6,
+    2, 67, 42, 67, 42, 67, 42, 67, 255, 0, 0, 16, 0, 8, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 255, 16,
+    5, 1, 63, 63, 63, 63, 63, 38, 63, 63, 63, 38, 63, 63, 38, 63, 63, 254, 1, 0, 255, 16, 6, 2, 63, 38, 63, 38, 63, 38,
+    63, 255, 16, 0, 31, 0, 8, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 255, 24, 5, 1, 57, 57, 57, 57, 57,
+    32, 57, 57, 57, 32, 57, 57, 32, 57, 57, 254, 0, 255, 255, 24, 6, 2, 57, 32, 57, 32, 57, 32, 57, 255, 31, 0, 16, 0, 8,
+    0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 255, 0, 5, 3, 61, 61, 61, 61, 61, 36, 61, 61, 61, 36, 61, 61,
+    36, 61, 61, 254, 255, 0, 255, 0, 6, 4, 61, 36, 61, 36, 61, 36, 61, 255, 16, 0, 0, 0, 8, 0, 8, 0, 0, 67, 67, 67,
+    67, 67, 67, 67, 254, 0, 1, 255, 8, 5, 3, 67, 67, 67, 67, 67, 42, 67, 67, 67, 42, 67, 67, 42, 67, 67, 254, 0, 1, 255,
+    8, 6, 4, 67, 42, 67, 42, 67, 42, 67, 255, 0, 0, 16, 0, 8, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0,
+    255, 16, 5, 3, 63, 63, 63, 63, 63, 38, 63, 63, 63, 38, 63, 63, 38, 63, 63, 254, 1, 0, 255, 16, 6, 4, 63, 38, 63, 38,
+    63, 38, 63, 255, 16, 0, 31, 0, 8, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 255, 24, 5, 3, 57, 57, 57,
+    57, 57, 32, 57, 57, 57, 32, 57, 57, 32, 57, 57, 254, 0, 255, 255, 24, 6, 4, 57, 32, 57, 32, 57, 32, 57, 255, 31, 0, 16,
+    0, 7, 0, 0, 6, 2, 61, 36, 61, 36, 61, 36, 61, 254, 255, 0, 0, 0, 5, 1, 36, 61, 61, 36, 61, 61, 61, 36, 61, 61,
+    61, 61, 61, 254, 255, 0, 255, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 7, 0, 8, 6, 2, 67,
+    42, 67, 42, 67, 42, 67, 254, 0, 1, 0, 8, 5, 1, 42, 67, 67, 42, 67, 67, 67, 42, 67, 67, 67, 67, 67, 254, 0, 1, 255,
+    8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 7, 0, 16, 6, 2, 63, 38, 63, 38, 63, 38, 63, 254,
+    1, 0, 0, 16, 5, 1, 38, 63, 63, 38, 63, 63, 63, 38, 63, 63, 63, 63, 63, 254, 1, 0, 255, 16, 0, 0, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 255, 16, 0, 31, 0, 7, 0, 24, 6, 2, 57, 32, 57, 32, 57, 32, 57, 254, 0, 255, 0, 24, 5, 1, 32,
+    57, 57, 32, 57, 57, 57, 32, 57, 57, 57, 57, 57, 254, 0, 255, 255, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 255, 31,
+    0, 16, 0, 7, 0, 0, 6, 4, 61, 36, 61, 36, 61, 36, 61, 254, 255, 0, 0, 0, 5, 3, 36, 61, 61, 36, 61, 61, 61, 36,
+    61, 61, 61, 61, 61, 254, 255, 0, 255, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 7, 0, 8, 6,
+    4, 67, 42, 67, 42, 67, 42, 67, 254, 0, 1, 0, 8, 5, 3, 42, 67, 67, 42, 67, 67, 67, 42, 67, 67, 67, 67, 67, 254, 0,
+    1, 255, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 16, 0, 7, 0, 16, 6, 4, 63, 38, 63, 38, 63, 38,
+    63, 254, 1, 0, 0, 16, 5, 3, 38, 63, 63, 38, 63, 63, 63, 38, 63, 63, 63, 63, 63, 254, 1, 0, 255, 16, 0, 0, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 255, 16, 0, 31, 0, 7, 0, 24, 6, 4, 57, 32, 57, 32, 57, 32, 57, 254, 0, 255, 0, 24, 5,
+    3, 32, 57, 57, 32, 57, 57, 57, 32, 57, 57, 57, 57, 57, 254, 0, 255, 255, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    255, 16, 0, 16, 0, 0, 0, 0, 10, 0, 87, 87, 87, 87, 87, 254, 0, 0, 1, 31, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 254, 0, 0, 1, 30, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 29, 10, 0, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 28, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0,
+    1, 27, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 26, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 254, 0, 0, 1, 25, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 24, 10, 0, 87, 87,
+    87, 87, 87, 255, 16, 0, 16, 0, 0, 0, 8, 10, 0, 87, 87, 87, 87, 87, 254, 0, 0, 1, 7, 10, 0, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 6, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 5, 10,
+    0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 4, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    254, 0, 0, 1, 3, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 2, 10, 0, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 1, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 0, 10,
+    0, 87, 87, 87, 87, 87, 255, 16, 0, 16, 0, 0, 0, 16, 10, 0, 87, 87, 87, 87, 87, 254, 0, 0, 1, 15, 10, 0, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 14, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0,
+    1, 13, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 12, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 254, 0, 0, 1, 11, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 10, 10, 0, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 9, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0,
+    1, 8, 10, 0, 87, 87, 87, 87, 87, 255, 16, 0, 16, 0, 0, 0, 24, 10, 0, 87, 87, 87, 87, 87, 254, 0, 0, 1, 23, 10,
+    0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 22, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    254, 0, 0, 1, 21, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 20, 10, 0, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 19, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 18, 10,
+    0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 17, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    254, 0, 0, 1, 16, 10, 0, 87, 87, 87, 87, 87, 255, 16, 0, 16, 0, 0, 0, 0, 10, 0, 87, 87, 87, 87, 87, 254, 0, 0,
+    1, 1, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 2, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 254, 0, 0, 1, 3, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 4, 10, 0, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 5, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0,
+    1, 6, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 7, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 254, 0, 0, 1, 8, 10, 0, 87, 87, 87, 87, 87, 255, 16, 0, 16, 0, 0, 0, 8, 10, 0, 87, 87, 87, 87, 87,
+    254, 0, 0, 1, 9, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 10, 10, 0, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 11, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 12, 10,
+    0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 13, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    254, 0, 0, 1, 14, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 15, 10, 0, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 16, 10, 0, 87, 87, 87, 87, 87, 255, 16, 0, 16, 0, 0, 0, 16, 10, 0, 87, 87,
+    87, 87, 87, 254, 0, 0, 1, 17, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 18, 10, 0, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 19, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0,
+    1, 20, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 21, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 87, 254, 0, 0, 1, 22, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 23, 10, 0, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 24, 10, 0, 87, 87, 87, 87, 87, 255, 16, 0, 16, 0, 0, 0, 24, 10,
+    0, 87, 87, 87, 87, 87, 254, 0, 0, 1, 25, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 26, 10,
+    0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 27, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    254, 0, 0, 1, 28, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 29, 10, 0, 87, 87, 87, 87, 87,
+    87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 30, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 31, 10,
+    0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 0, 1, 0, 10, 0, 87, 87, 87, 87, 87, 255, 16, 0, 16, 0, 95,
+    0, 0, 18, 0, 37, 37, 37, 37, 37, 254, 0, 0, 255, 31, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0,
+    255, 30, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 29, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 254, 0, 0, 255, 28, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 27, 18, 0, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 26, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0,
+    255, 25, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 24, 18, 0, 37, 37, 37, 37, 37, 255, 16, 0,
+    16, 0, 95, 0, 8, 18, 0, 37, 37, 37, 37, 37, 254, 0, 0, 255, 7, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    254, 0, 0, 255, 6, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 5, 18, 0, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 4, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 3, 18,
+    0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 2, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    254, 0, 0, 255, 1, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 0, 18, 0, 37, 37, 37, 37, 37,
+    255, 16, 0, 16, 0, 95, 0, 16, 18, 0, 37, 37, 37, 37, 37, 254, 0, 0, 255, 15, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 254, 0, 0, 255, 14, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 13, 18, 0, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 12, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0,
+    255, 11, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 10, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 254, 0, 0, 255, 9, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 8, 18, 0, 37, 37,
+    37, 37, 37, 255, 16, 0, 16, 0, 95, 0, 24, 18, 0, 37, 37, 37, 37, 37, 254, 0, 0, 255, 23, 18, 0, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 22, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 21, 18,
+    0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 20, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    254, 0, 0, 255, 19, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 18, 18, 0, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 17, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 16, 18,
+    0, 37, 37, 37, 37, 37, 255, 16, 0, 16, 0, 95, 0, 0, 18, 0, 37, 37, 37, 37, 37, 254, 0, 0, 255, 1, 18, 0, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 2, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0,
+    255, 3, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 4, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 254, 0, 0, 255, 5, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 6, 18, 0, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 7, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0,
+    255, 8, 18, 0, 37, 37, 37, 37, 37, 255, 16, 0, 16, 0, 95, 0, 8, 18, 0, 37, 37, 37, 37, 37, 254, 0, 0, 255, 9, 18,
+    0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 10, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    254, 0, 0, 255, 11, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 12, 18, 0, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 13, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 14, 18,
+    0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 15, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    254, 0, 0, 255, 16, 18, 0, 37, 37, 37, 37, 37, 255, 16, 0, 16, 0, 95, 0, 16, 18, 0, 37, 37, 37, 37, 37, 254, 0, 0,
+    255, 17, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 18, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 254, 0, 0, 255, 19, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 20, 18, 0, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 21, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0,
+    255, 22, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 23, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 254, 0, 0, 255, 24, 18, 0, 37, 37, 37, 37, 37, 255, 16, 0, 16, 0, 95, 0, 24, 18, 0, 37, 37, 37, 37, 37,
+    254, 0, 0, 255, 25, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 26, 18, 0, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 27, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 28, 18,
+    0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 29, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    254, 0, 0, 255, 30, 18, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 31, 18, 0, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 254, 0, 0, 255, 0, 18, 0, 37, 37, 37, 37, 37, 255, 16, 0, 16, 0, 0, 0, 0, 10, 0, 87, 87,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 88, 87, 87, 87, 87, 87, 87, 87, 87, 254, 1, 0, 1, 0, 11, 0, 87, 87, 87, 87,
+    87, 88, 87, 87, 87, 87, 88, 87, 87, 87, 88, 87, 87, 87, 88, 87, 87, 87, 88, 87, 87, 88, 87, 87, 88, 87, 88, 87, 87, 254,
+    1, 0, 1, 0, 12, 0, 87, 88, 87, 88, 87, 87, 88, 87, 88, 87, 88, 88, 87, 88, 87, 88, 87, 88, 88, 87, 88, 88, 88, 87,
+    254, 1, 0, 1, 0, 13, 0, 88, 88, 87, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 63, 88, 88, 254, 1, 0, 1,
+    0, 14, 0, 63, 88, 63, 88, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 63, 254, 1, 0, 1, 0, 15, 0, 63, 63, 88, 63, 63,
+    63, 88, 63, 63, 63, 254, 1, 0, 0, 0, 16, 0, 88, 63, 63, 63, 63, 63, 63, 63, 255, 16, 0, 16, 0, 0, 0, 8, 10, 0,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 82, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 255, 1, 8, 11, 0, 87, 87,
+    87, 87, 87, 82, 87, 87, 87, 87, 82, 87, 87, 87, 82, 87, 87, 87, 82, 87, 87, 87, 82, 87, 87, 82, 87, 87, 82, 87, 82, 87,
+    87, 254, 0, 255, 1, 8, 12, 0, 87, 82, 87, 82, 87, 87, 82, 87, 82, 87, 82, 82, 87, 82, 87, 82, 87, 82, 82, 87, 82, 82,
+    82, 87, 254, 0, 255, 1, 8, 13, 0, 82, 82, 87, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 57, 82, 82, 254, 0,
+    255, 1, 8, 14, 0, 57, 82, 57, 82, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 57, 254, 0, 255, 1, 8, 15, 0, 57, 57, 82,
+    57, 57, 57, 82, 57, 57, 57, 254, 0, 255, 0, 8, 16, 0, 82, 57, 57, 57, 57, 57, 57, 57, 255, 16, 0, 16, 0, 0, 0, 16,
+    10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 86, 87, 87, 87, 87, 87, 87, 87, 87, 254, 255, 0, 1, 16, 11, 0,
+    87, 87, 87, 87, 87, 86, 87, 87, 87, 87, 86, 87, 87, 87, 86, 87, 87, 87, 86, 87, 87, 87, 86, 87, 87, 86, 87, 87, 86, 87,
+    86, 87, 87, 254, 255, 0, 1, 16, 12, 0, 87, 86, 87, 86, 87, 87, 86, 87, 86, 87, 86, 86, 87, 86, 87, 86, 87, 86, 86, 87,
+    86, 86, 86, 87, 254, 255, 0, 1, 16, 13, 0, 86, 86, 87, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 61, 86, 86,
+    254, 255, 0, 1, 16, 14, 0, 61, 86, 61, 86, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 61, 254, 255, 0, 1, 16, 15, 0, 61,
+    61, 86, 61, 61, 61, 86, 61, 61, 61, 254, 255, 0, 0, 16, 16, 0, 86, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 16, 0, 0,
+    0, 24, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 92, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 1, 1, 24,
+    11, 0, 87, 87, 87, 87, 87, 92, 87, 87, 87, 87, 92, 87, 87, 87, 92, 87, 87, 87, 92, 87, 87, 87, 92, 87, 87, 92, 87, 87,
+    92, 87, 92, 87, 87, 254, 0, 1, 1, 24, 12, 0, 87, 92, 87, 92, 87, 87, 92, 87, 92, 87, 92, 92, 87, 92, 87, 92, 87, 92,
+    92, 87, 92, 92, 92, 87, 254, 0, 1, 1, 24, 13, 0, 92, 92, 87, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 67,
+    92, 92, 254, 0, 1, 1, 24, 14, 0, 67, 92, 67, 92, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 67, 254, 0, 1, 1, 24, 15,
+    0, 67, 67, 92, 67, 67, 67, 92, 67, 67, 67, 254, 0, 1, 0, 24, 16, 0, 92, 67, 67, 67, 67, 67, 67, 67, 255, 31, 0, 16,
+    0, 32, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 5, 0, 36, 61, 61, 61, 61, 36, 61, 61, 254, 255, 0,
+    0, 0, 6, 0, 36, 61, 61, 36, 61, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 36, 61, 36, 61, 254, 255, 0, 255, 0, 7, 0,
+    36, 36, 61, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 37, 36, 36, 254, 255, 0, 255, 0, 8, 0, 37, 36, 36, 36,
+    37, 36, 36, 37, 36, 37, 36, 37, 36, 36, 37, 36, 37, 36, 37, 37, 36, 37, 36, 37, 254, 255, 0, 255, 0, 17, 0, 37, 37, 36,
+    37, 36, 37, 37, 36, 37, 37, 36, 37, 37, 37, 36, 37, 37, 37, 36, 37, 37, 37, 36, 37, 37, 37, 37, 36, 37, 37, 37, 37, 37,
+    36, 254, 0, 0, 255, 0, 18, 0, 37, 37, 37, 37, 37, 37, 37, 36, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 255, 16,
+    0, 0, 0, 32, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 5, 0, 42, 67, 67, 67, 67, 42, 67, 67, 254,
+    0, 1, 0, 8, 6, 0, 42, 67, 67, 42, 67, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 42, 67, 42, 67, 254, 0, 1, 255, 8,
+    7, 0, 42, 42, 67, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 37, 42, 42, 254, 0, 1, 255, 8, 8, 0, 37, 42,
+    42, 42, 37, 42, 42, 37, 42, 37, 42, 37, 42, 42, 37, 42, 37, 42, 37, 37, 42, 37, 42, 37, 254, 0, 1, 255, 8, 17, 0, 37,
+    37, 42, 37, 42, 37, 37, 42, 37, 37, 42, 37, 37, 37, 42, 37, 37, 37, 42, 37, 37, 37, 42, 37, 37, 37, 37, 42, 37, 37, 37,
+    37, 37, 42, 254, 0, 0, 255, 8, 18, 0, 37, 37, 37, 37, 37, 37, 37, 42, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    255, 0, 0, 16, 0, 32, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 5, 0, 38, 63, 63, 63, 63, 38, 63,
+    63, 254, 1, 0, 0, 16, 6, 0, 38, 63, 63, 38, 63, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 38, 63, 38, 63, 254, 1, 0,
+    255, 16, 7, 0, 38, 38, 63, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 37, 38, 38, 254, 1, 0, 255, 16, 8, 0,
+    37, 38, 38, 38, 37, 38, 38, 37, 38, 37, 38, 37, 38, 38, 37, 38, 37, 38, 37, 37, 38, 37, 38, 37, 254, 1, 0, 255, 16, 17,
+    0, 37, 37, 38, 37, 38, 37, 37, 38, 37, 37, 38, 37, 37, 37, 38, 37, 37, 37, 38, 37, 37, 37, 38, 37, 37, 37, 37, 38, 37,
+    37, 37, 37, 37, 38, 254, 0, 0, 255, 16, 18, 0, 37, 37, 37, 37, 37, 37, 37, 38, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 255, 16, 0, 31, 0, 32, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 5, 0, 32, 57, 57, 57, 57,
+    32, 57, 57, 254, 0, 255, 0, 24, 6, 0, 32, 57, 57, 32, 57, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 32, 57, 32, 57, 254,
+    0, 255, 255, 24, 7, 0, 32, 32, 57, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 37, 32, 32, 254, 0, 255, 255, 24,
+    8, 0, 37, 32, 32, 32, 37, 32, 32, 37, 32, 37, 32, 37, 32, 32, 37, 32, 37, 32, 37, 37, 32, 37, 32, 37, 254, 0, 255, 255,
+    24, 17, 0, 37, 37, 32, 37, 32, 37, 37, 32, 37, 37, 32, 37, 37, 37, 32, 37, 37, 37, 32, 37, 37, 37, 32, 37, 37, 37, 37,
+    32, 37, 37, 37, 37, 37, 32, 254, 0, 0, 255, 24, 18, 0, 37, 37, 37, 37, 37, 37, 37, 32, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 255, 16, 0, 16, 0, 224, 255, 0, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 88, 87, 87, 87,
+    87, 87, 87, 87, 87, 254, 1, 0, 1, 0, 11, 0, 87, 87, 87, 87, 87, 88, 87, 87, 87, 87, 88, 87, 87, 87, 88, 87, 87, 87,
+    88, 87, 87, 87, 88, 87, 87, 88, 87, 87, 88, 87, 88, 87, 87, 254, 1, 0, 1, 0, 12, 0, 87, 88, 87, 88, 87, 87, 88, 87,
+    88, 87, 88, 88, 87, 88, 87, 88, 87, 88, 88, 87, 88, 88, 88, 87, 254, 1, 0, 1, 0, 13, 0, 88, 88, 87, 88, 88, 88, 88,
+    88, 88, 88, 88, 88, 88, 88, 88, 88, 63, 88, 88, 254, 1, 0, 1, 0, 14, 0, 63, 88, 63, 88, 88, 63, 88, 63, 88, 63, 88,
+    63, 88, 63, 63, 254, 1, 0, 1, 0, 15, 0, 63, 63, 88, 63, 63, 63, 88, 63, 63, 63, 254, 1, 0, 0, 0, 16, 0, 88, 63,
+    63, 63, 63, 63, 63, 63, 255, 16, 0, 16, 0, 224, 255, 8, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 82, 87,
+    87, 87, 87, 87, 87, 87, 87, 254, 0, 255, 1, 8, 11, 0, 87, 87, 87, 87, 87, 82, 87, 87, 87, 87, 82, 87, 87, 87, 82, 87,
+    87, 87, 82, 87, 87, 87, 82, 87, 87, 82, 87, 87, 82, 87, 82, 87, 87, 254, 0, 255, 1, 8, 12, 0, 87, 82, 87, 82, 87, 87,
+    82, 87, 82, 87, 82, 82, 87, 82, 87, 82, 87, 82, 82, 87, 82, 82, 82, 87, 254, 0, 255, 1, 8, 13, 0, 82, 82, 87, 82, 82,
+    82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 57, 82, 82, 254, 0, 255, 1, 8, 14, 0, 57, 82, 57, 82, 82, 57, 82, 57, 82,
+    57, 82, 57, 82, 57, 57, 254, 0, 255, 1, 8, 15, 0, 57, 57, 82, 57, 57, 57, 82, 57, 57, 57, 254, 0, 255, 0, 8, 16, 0,
+    82, 57, 57, 57, 57, 57, 57, 57, 255, 16, 0, 16, 0, 224, 255, 16, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    86, 87, 87, 87, 87, 87, 87, 87, 87, 254, 255, 0, 1, 16, 11, 0, 87, 87, 87, 87, 87, 86, 87, 87, 87, 87, 86, 87, 87, 87,
+    86, 87, 87, 87, 86, 87, 87, 87, 86, 87, 87, 86, 87, 87, 86, 87, 86, 87, 87, 254, 255, 0, 1, 16, 12, 0, 87, 86, 87, 86,
+    87, 87, 86, 87, 86, 87, 86, 86, 87, 86, 87, 86, 87, 86, 86, 87, 86, 86, 86, 87, 254, 255, 0, 1, 16, 13, 0, 86, 86, 87,
+    86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 61, 86, 86, 254, 255, 0, 1, 16, 14, 0, 61, 86, 61, 86, 86, 61, 86,
+    61, 86, 61, 86, 61, 86, 61, 61, 254, 255, 0, 1, 16, 15, 0, 61, 61, 86, 61, 61, 61, 86, 61, 61, 61, 254, 255, 0, 0, 16,
+    16, 0, 86, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 16, 0, 224, 255, 24, 10, 0, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+    87, 87, 92, 87, 87, 87, 87, 87, 87, 87, 87, 254, 0, 1, 1, 24, 11, 0, 87, 87, 87, 87, 87, 92, 87, 87, 87, 87, 92, 87,
+    87, 87, 92, 87, 87, 87, 92, 87, 87, 87, 92, 87, 87, 92, 87, 87, 92, 87, 92, 87, 87, 254, 0, 1, 1, 24, 12, 0, 87, 92,
+    87, 92, 87, 87, 92, 87, 92, 87, 92, 92, 87, 92, 87, 92, 87, 92, 92, 87, 92, 92, 92, 87, 254, 0, 1, 1, 24, 13, 0, 92,
+    92, 87, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 67, 92, 92, 254, 0, 1, 1, 24, 14, 0, 67, 92, 67, 92, 92,
+    67, 92, 67, 92, 67, 92, 67, 92, 67, 67, 254, 0, 1, 1, 24, 15, 0, 67, 67, 92, 67, 67, 67, 92, 67, 67, 67, 254, 0, 1,
+    0, 24, 16, 0, 92, 67, 67, 67, 67, 67, 67, 67, 255, 31, 0, 6, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 6, 0, 0, 0, 0, 0,
+    8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 255, 0, 0, 26, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 255, 26, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 255, 31, 0, 6,
+    0, 0, 0, 0, 2, 0, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61,
+    86, 61, 86, 61, 86, 61, 86, 255, 6, 0, 0, 0, 0, 0, 8, 2, 0, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67,
+    92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 255, 0, 0, 26, 0, 0, 0, 16, 2, 0, 63, 88,
+    63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 255,
+    26, 0, 31, 0, 0, 0, 24, 2, 0, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82,
+    57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 255, 31, 0, 6, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0,
+    0, 0, 1, 0, 61, 86, 61, 61, 61, 61, 61, 86, 61, 61, 61, 86, 61, 61, 86, 254, 255, 0, 0, 0, 2, 0, 86, 61, 86, 61,
+    86, 61, 86, 255, 6, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 1, 0, 67, 92, 67,
+    67, 67, 67, 67, 92, 67, 67, 67, 92, 67, 67, 92, 254, 0, 1, 0, 8, 2, 0, 67, 92, 67, 92, 67, 92, 67, 255, 0, 0, 26,
+    0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 1, 0, 63, 88, 63, 63, 63, 63, 63, 88, 63, 63,
+    63, 88, 63, 63, 88, 254, 1, 0, 0, 16, 2, 0, 63, 88, 63, 88, 63, 88, 63, 255, 26, 0, 31, 0, 0, 0, 24, 0, 0, 57,
+    57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 24, 1, 0, 57, 82, 57, 57, 57, 57, 57, 82, 57, 57, 57, 82, 57, 57, 82, 254, 0,
+    255, 0, 24, 2, 0, 82, 57, 82, 57, 82, 57, 82, 255, 31, 0, 6, 0, 0, 0, 0, 2, 0, 86, 61, 86, 61, 86, 61, 61, 254,
+    255, 0, 1, 0, 1, 0, 61, 61, 86, 61, 61, 86, 61, 61, 61, 86, 61, 61, 61, 254, 255, 0, 0, 0, 0, 0, 61, 86, 61, 61,
+    61, 61, 61, 61, 61, 255, 6, 0, 0, 0, 0, 0, 8, 2, 0, 67, 92, 67, 92, 67, 92, 67, 254, 0, 1, 1, 8, 1, 0, 67,
+    67, 92, 67, 67, 92, 67, 67, 67, 92, 67, 67, 67, 254, 0, 1, 0, 8, 0, 0, 67, 92, 67, 67, 67, 67, 67, 67, 67, 255, 0,
+    0, 26, 0, 0, 0, 16, 2, 0, 63, 88, 63, 88, 63, 88, 63, 254, 1, 0, 1, 16, 1, 0, 63, 63, 88, 63, 63, 88, 63, 63,
+    63, 88, 63, 63, 63, 254, 1, 0, 0, 16, 0, 0, 63, 88, 63, 63, 63, 63, 63, 63, 63, 255, 26, 0, 31, 0, 0, 0, 24, 2,
+    0, 82, 57, 82, 57, 82, 57, 57, 254, 0, 255, 1, 24, 1, 0, 57, 57, 82, 57, 57, 82, 57, 57, 57, 82, 57, 57, 57, 254, 0,
+    255, 0, 24, 0, 0, 57, 82, 57, 57, 57, 57, 57, 57, 57, 255, 31, 0, 6, 0, 15, 0, 0, 6, 0, 61, 36, 61, 36, 61, 36,
+    61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 255, 6, 0, 0, 0,
+    15, 0, 8, 6, 0, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42,
+    67, 42, 67, 42, 67, 42, 255, 0, 0, 26, 0, 15, 0, 16, 6, 0, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63,
+    38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 255, 26, 0, 31, 0, 15, 0, 24, 6, 0, 57, 32, 57,
+    32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 255, 31,
+    0, 6, 0, 8, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 255, 0, 5, 0, 61, 61, 61, 61, 61, 36, 61, 61,
+    61, 36, 61, 61, 36, 61, 61, 254, 255, 0, 255, 0, 6, 0, 61, 36, 61, 36, 61, 36, 61, 255, 6, 0, 0, 0, 8, 0, 8, 0,
+    0, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 255, 8, 5, 0, 67, 67, 67, 67, 67, 42, 67, 67, 67, 42, 67, 67, 42, 67, 67,
+    254, 0, 1, 255, 8, 6, 0, 67, 67, 42, 67, 42, 67, 42, 255, 0, 0, 26, 0, 8, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63,
+    63, 254, 1, 0, 255, 16, 5, 0, 63, 63, 63, 63, 63, 38, 63, 63, 63, 38, 63, 63, 38, 63, 63, 254, 1, 0, 255, 16, 6, 0,
+    63, 63, 38, 63, 38, 63, 38, 255, 26, 0, 31, 0, 8, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 255, 24, 5,
+    0, 57, 57, 57, 57, 57, 32, 57, 57, 57, 32, 57, 57, 32, 57, 57, 254, 0, 255, 255, 24, 6, 0, 57, 32, 57, 32, 57, 32, 57,
+    255, 31, 0, 6, 0, 7, 0, 0, 6, 0, 61, 36, 61, 36, 61, 36, 61, 254, 255, 0, 0, 0, 5, 0, 36, 61, 61, 36, 61, 61,
+    61, 36, 61, 61, 61, 61, 61, 254, 255, 0, 255, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 6, 0, 0, 0, 8, 0,
+    8, 6, 0, 42, 67, 42, 67, 42, 67, 42, 254, 0, 1, 0, 8, 5, 0, 42, 67, 67, 42, 67, 67, 67, 42, 67, 67, 67, 67, 67,
+    254, 0, 1, 255, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 26, 0, 8, 0, 16, 6, 0, 38, 63, 38, 63,
+    38, 63, 38, 254, 1, 0, 0, 16, 5, 0, 38, 63, 63, 38, 63, 63, 63, 38, 63, 63, 63, 63, 63, 254, 1, 0, 255, 16, 0, 0,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 255, 26, 0, 31, 0, 7, 0, 24, 6, 0, 57, 32, 57, 32, 57, 32, 57, 254, 0, 255, 0,
+    24, 5, 0, 32, 57, 57, 32, 57, 57, 57, 32, 57, 57, 57, 57, 57, 254, 0, 255, 255, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 255, 31, 0, 6, 0, 0, 0, 0, 0, 0, 254, 255, 0, 0, 30, 0, 0, 56, 254, 255, 0, 0, 28, 0, 0, 56, 254, 0,
+    255, 0, 26, 0, 0, 56, 254, 0, 255, 0, 24, 0, 0, 57, 255, 6, 0, 0, 0, 0, 0, 8, 0, 0, 67, 254, 0, 1, 0, 6,
+    0, 0, 66, 254, 0, 1, 0, 4, 0, 0, 66, 254, 255, 0, 0, 2, 0, 0, 66, 254, 255, 0, 0, 0, 0, 0, 61, 255, 0, 0,
+    26, 0, 0, 0, 16, 0, 0, 63, 254, 1, 0, 0, 14, 0, 0, 68, 254, 1, 0, 0, 12, 0, 0, 68, 254, 0, 1, 0, 10, 0,
+    0, 68, 254, 0, 1, 0, 8, 0, 0, 255, 26, 0, 31, 0, 0, 0, 24, 0, 0, 254, 0, 255, 0, 22, 0, 0, 58, 254, 0, 255,
+    0, 20, 0, 0, 58, 254, 1, 0, 0, 18, 0, 0, 58, 254, 1, 0, 0, 16, 0, 0, 255, 31, 0, 6, 0, 0, 0, 0, 0, 0,
+    61, 61, 61, 61, 254, 255, 1, 0, 1, 0, 0, 61, 61, 61, 254, 255, 1, 0, 2, 0, 0, 61, 61, 254, 255, 1, 0, 3, 0, 0,
+    61, 66, 66, 254, 255, 1, 0, 4, 0, 0, 66, 66, 66, 254, 255, 1, 0, 5, 0, 0, 66, 66, 67, 254, 255, 1, 0, 6, 0, 0,
+    67, 67, 254, 255, 1, 0, 7, 0, 0, 67, 67, 67, 254, 255, 1, 0, 8, 0, 0, 67, 67, 67, 67, 255, 6, 0, 0, 0, 0, 0,
+    8, 0, 0, 67, 67, 67, 67, 67, 254, 1, 1, 0, 9, 0, 0, 67, 67, 67, 254, 1, 1, 0, 10, 0, 0, 67, 67, 254, 1, 1,
+    0, 11, 0, 0, 67, 68, 68, 254, 1, 1, 0, 12, 0, 0, 68, 68, 68, 254, 1, 1, 0, 13, 0, 0, 68, 68, 63, 254, 1, 1,
+    0, 14, 0, 0, 63, 63, 254, 1, 1, 0, 15, 0, 0, 63, 63, 63, 254, 1, 1, 0, 16, 0, 0, 63, 63, 63, 63, 255, 0, 0,
+    26, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 254, 1, 255, 0, 17, 0, 0, 63, 63, 63, 254, 1, 255, 0, 18, 0, 0, 63,
+    63, 254, 1, 255, 0, 19, 0, 0, 63, 58, 58, 254, 1, 255, 0, 20, 0, 0, 58, 58, 58, 254, 1, 255, 0, 21, 0, 0, 58, 58,
+    57, 254, 1, 255, 0, 22, 0, 0, 57, 57, 254, 1, 255, 0, 23, 0, 0, 57, 57, 57, 254, 1, 255, 0, 24, 0, 0, 57, 57, 57,
+    57, 57, 255, 26, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 254, 255, 255, 0, 25, 0, 0, 57, 57, 57, 254, 255, 255, 0,
+    26, 0, 0, 57, 57, 254, 255, 255, 0, 27, 0, 0, 57, 56, 56, 254, 255, 255, 0, 28, 0, 0, 56, 56, 56, 254, 255, 255, 0, 29,
+    0, 0, 56, 56, 61, 254, 255, 255, 0, 30, 0, 0, 61, 61, 254, 255, 255, 0, 31, 0, 0, 61, 61, 61, 254, 255, 255, 0, 0, 0,
+    0, 61, 61, 61, 61, 61, 255, 31, 0, 6, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 254, 255, 0, 0, 1, 0, 0, 61, 254, 255, 1, 0, 2, 0, 0, 61, 254, 255, 1, 0, 3, 0, 0, 61, 254, 255, 1, 0,
+    4, 0, 0, 254, 255, 1, 0, 5, 0, 0, 67, 254, 255, 1, 0, 6, 0, 0, 67, 254, 0, 1, 0, 7, 0, 0, 67, 254, 0, 1,
+    0, 8, 0, 0, 254, 0, 1, 0, 9, 0, 0, 67, 254, 0, 1, 0, 10, 0, 0, 67, 254, 1, 1, 0, 11, 0, 0, 67, 254, 1,
+    1, 0, 12, 0, 0, 254, 1, 1, 0, 13, 0, 0, 63, 254, 1, 1, 0, 14, 0, 0, 63, 254, 1, 1, 0, 15, 0, 0, 63, 254,
+    1, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 255, 6, 0, 0, 0, 0, 0, 8,
+    0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 9, 0, 0, 67, 254, 1, 1, 0,
+    10, 0, 0, 67, 254, 1, 1, 0, 11, 0, 0, 67, 254, 1, 1, 0, 12, 0, 0, 254, 1, 1, 0, 13, 0, 0, 63, 254, 1, 1,
+    0, 14, 0, 0, 63, 254, 1, 0, 0, 15, 0, 0, 63, 254, 1, 0, 0, 16, 0, 0, 254, 1, 0, 0, 17, 0, 0, 63, 254, 1,
+    0, 0, 18, 0, 0, 63, 254, 1, 255, 0, 19, 0, 0, 63, 254, 1, 255, 0, 20, 0, 0, 254, 1, 255, 0, 21, 0, 0, 57, 254,
+    1, 255, 0, 22, 0, 0, 57, 254, 1, 255, 0, 23, 0, 0, 57, 254, 0, 255, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 255, 0, 0, 26, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 254, 1, 0, 0, 17, 0, 0, 63, 254, 1, 255, 0, 18, 0, 0, 63, 254, 1, 255, 0, 19, 0, 0, 63, 254, 1,
+    255, 0, 20, 0, 0, 254, 1, 255, 0, 21, 0, 0, 57, 254, 1, 255, 0, 22, 0, 0, 57, 254, 0, 255, 0, 23, 0, 0, 57, 254,
+    0, 255, 0, 24, 0, 0, 254, 0, 255, 0, 25, 0, 0, 57, 254, 0, 255, 0, 26, 0, 0, 57, 254, 255, 255, 0, 27, 0, 0, 57,
+    254, 255, 255, 0, 28, 0, 0, 254, 255, 255, 0, 29, 0, 0, 61, 254, 255, 255, 0, 30, 0, 0, 61, 254, 255, 255, 0, 31, 0, 0,
+    61, 254, 255, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 26, 0, 31, 0, 0,
+    0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 25, 0, 0, 57, 254, 255,
+    255, 0, 26, 0, 0, 57, 254, 255, 255, 0, 27, 0, 0, 57, 254, 255, 255, 0, 28, 0, 0, 254, 255, 255, 0, 29, 0, 0, 61, 254,
+    255, 255, 0, 30, 0, 0, 61, 254, 255, 0, 0, 31, 0, 0, 61, 254, 255, 0, 0, 0, 0, 0, 254, 255, 0, 0, 1, 0, 0, 61,
+    254, 255, 0, 0, 2, 0, 0, 61, 254, 255, 1, 0, 3, 0, 0, 61, 254, 255, 1, 0, 4, 0, 0, 254, 255, 1, 0, 5, 0, 0,
+    67, 254, 255, 1, 0, 6, 0, 0, 67, 254, 255, 1, 0, 7, 0, 0, 67, 254, 0, 1, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255, 31, 0, 9, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 9, 0, 0, 0, 0, 0, 8, 0,
+    0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 255, 0, 0, 23, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 255, 23, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 255, 31, 0, 9, 0, 0,
+    0, 0, 2, 0, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86,
+    61, 86, 61, 86, 61, 255, 9, 0, 0, 0, 0, 0, 8, 2, 0, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92,
+    67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 255, 0, 0, 23, 0, 0, 0, 16, 2, 0, 88, 63, 88, 63,
+    88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 255, 23, 0,
+    31, 0, 0, 0, 24, 2, 0, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57,
+    82, 57, 82, 57, 82, 57, 82, 57, 255, 31, 0, 9, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0,
+    1, 0, 61, 86, 61, 61, 61, 61, 61, 86, 61, 61, 61, 86, 61, 61, 86, 254, 255, 0, 0, 0, 2, 0, 86, 61, 86, 61, 86, 61,
+    86, 255, 9, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 1, 0, 67, 92, 67, 67, 67,
+    67, 67, 92, 67, 67, 67, 92, 67, 67, 92, 254, 0, 1, 0, 8, 2, 0, 67, 92, 67, 92, 67, 92, 67, 255, 0, 0, 23, 0, 0,
+    0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 16, 1, 0, 63, 88, 63, 63, 63, 63, 63, 88, 63, 63, 63, 88,
+    63, 63, 88, 254, 1, 0, 0, 16, 2, 0, 63, 88, 63, 88, 63, 88, 63, 255, 23, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57,
+    57, 57, 57, 57, 254, 0, 255, 0, 24, 1, 0, 57, 82, 57, 57, 57, 57, 57, 82, 57, 57, 57, 82, 57, 57, 82, 254, 0, 255, 0,
+    24, 2, 0, 82, 57, 82, 57, 82, 57, 82, 255, 31, 0, 9, 0, 0, 0, 0, 2, 0, 86, 61, 86, 61, 86, 61, 61, 254, 255, 0,
+    1, 0, 1, 0, 61, 61, 86, 61, 61, 86, 61, 61, 61, 86, 61, 61, 61, 254, 255, 0, 0, 0, 0, 0, 61, 86, 61, 61, 61, 61,
+    61, 61, 61, 255, 9, 0, 0, 0, 0, 0, 8, 2, 0, 67, 92, 67, 92, 67, 92, 67, 254, 0, 1, 1, 8, 1, 0, 67, 67, 92,
+    67, 67, 92, 67, 67, 67, 92, 67, 67, 67, 254, 0, 1, 0, 8, 0, 0, 67, 92, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 23,
+    0, 0, 0, 16, 2, 0, 63, 88, 63, 88, 63, 88, 63, 254, 1, 0, 1, 16, 1, 0, 63, 63, 88, 63, 63, 88, 63, 63, 63, 88,
+    63, 63, 63, 254, 1, 0, 0, 16, 0, 0, 63, 88, 63, 63, 63, 63, 63, 63, 63, 255, 23, 0, 31, 0, 0, 0, 24, 2, 0, 82,
+    57, 82, 57, 82, 57, 57, 254, 0, 255, 1, 24, 1, 0, 57, 57, 82, 57, 57, 82, 57, 57, 57, 82, 57, 57, 57, 254, 0, 255, 0,
+    24, 0, 0, 57, 82, 57, 57, 57, 57, 57, 57, 57, 255, 31, 0, 9, 0, 15, 0, 0, 6, 0, 36, 61, 36, 61, 36, 61, 36, 61,
+    36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 255, 9, 0, 0, 0, 15, 0,
+    8, 6, 0, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67,
+    42, 67, 42, 67, 255, 0, 0, 23, 0, 15, 0, 16, 6, 0, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38,
+    63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 255, 23, 0, 31, 0, 15, 0, 24, 6, 0, 32, 57, 32, 57, 32,
+    57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 255, 31, 0, 9,
+    0, 8, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 255, 0, 5, 0, 61, 61, 61, 61, 61, 36, 61, 61, 61, 36,
+    61, 61, 36, 61, 61, 254, 255, 0, 255, 0, 6, 0, 61, 36, 61, 36, 61, 36, 61, 255, 9, 0, 0, 0, 8, 0, 8, 0, 0, 67,
+    67, 67, 67, 67, 67, 67, 254, 0, 1, 255, 8, 5, 0, 67, 67, 67, 67, 67, 42, 67, 67, 67, 42, 67, 67, 42, 67, 67, 254, 0,
+    1, 255, 8, 6, 0, 67, 67, 42, 67, 42, 67, 42, 255, 0, 0, 23, 0, 8, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 254,
+    1, 0, 255, 16, 5, 0, 63, 63, 63, 63, 63, 38, 63, 63, 63, 38, 63, 63, 38, 63, 63, 254, 1, 0, 255, 16, 6, 0, 63, 63,
+    38, 63, 38, 63, 38, 255, 23, 0, 31, 0, 8, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 255, 24, 5, 0, 57,
+    57, 57, 57, 57, 32, 57, 57, 57, 32, 57, 57, 32, 57, 57, 254, 0, 255, 255, 24, 6, 0, 57, 32, 57, 32, 57, 32, 57, 255, 31,
+    0, 9, 0, 7, 0, 0, 6, 0, 61, 36, 61, 36, 61, 36, 61, 254, 255, 0, 0, 0, 5, 0, 36, 61, 61, 36, 61, 61, 61, 36,
+    61, 61, 61, 61, 61, 254, 255, 0, 255, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 9, 0, 0, 0, 8, 0, 8, 6,
+    0, 42, 67, 42, 67, 42, 67, 42, 254, 0, 1, 0, 8, 5, 0, 42, 67, 67, 42, 67, 67, 67, 42, 67, 67, 67, 67, 67, 254, 0,
+    1, 255, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 23, 0, 8, 0, 16, 6, 0, 38, 63, 38, 63, 38, 63,
+    38, 254, 1, 0, 0, 16, 5, 0, 38, 63, 63, 38, 63, 63, 63, 38, 63, 63, 63, 63, 63, 254, 1, 0, 255, 16, 0, 0, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 255, 23, 0, 31, 0, 7, 0, 24, 6, 0, 57, 32, 57, 32, 57, 32, 57, 254, 0, 255, 0, 24, 5,
+    0, 32, 57, 57, 32, 57, 57, 57, 32, 57, 57, 57, 57, 57, 254, 0, 255, 255, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    255, 31, 0, 9, 0, 0, 0, 0, 0, 0, 254, 255, 0, 0, 31, 0, 0, 61, 61, 61, 61, 61, 61, 61, 56, 61, 61, 61, 61, 61,
+    254, 255, 255, 0, 30, 0, 0, 61, 61, 61, 56, 61, 61, 61, 56, 61, 61, 56, 61, 254, 255, 255, 0, 29, 0, 0, 61, 61, 56, 61,
+    56, 61, 56, 56, 61, 56, 61, 56, 254, 255, 255, 0, 28, 0, 0, 61, 56, 56, 56, 61, 56, 56, 56, 56, 56, 254, 255, 255, 0, 27,
+    0, 0, 56, 56, 56, 56, 57, 56, 56, 56, 57, 254, 255, 255, 0, 26, 0, 0, 56, 57, 56, 57, 56, 56, 57, 56, 57, 56, 57, 57,
+    254, 255, 255, 0, 25, 0, 0, 57, 56, 57, 57, 56, 57, 57, 57, 56, 57, 57, 57, 254, 255, 255, 0, 24, 0, 0, 57, 57, 57, 57,
+    57, 56, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 23, 0, 0, 63, 255, 9, 0, 1, 0, 0, 0, 8, 0, 0, 254, 0,
+    1, 0, 7, 0, 0, 67, 67, 67, 67, 67, 67, 67, 66, 67, 67, 67, 67, 67, 254, 255, 1, 0, 6, 0, 0, 67, 67, 67, 66, 67,
+    67, 67, 66, 67, 67, 66, 67, 254, 255, 1, 0, 5, 0, 0, 67, 67, 66, 67, 66, 67, 66, 66, 67, 66, 67, 66, 254, 255, 1, 0,
+    4, 0, 0, 67, 66, 66, 66, 67, 66, 66, 66, 66, 66, 254, 255, 1, 0, 3, 0, 0, 66, 66, 66, 66, 61, 66, 66, 66, 61, 254,
+    255, 1, 0, 2, 0, 0, 66, 61, 66, 61, 66, 66, 61, 66, 61, 66, 61, 61, 254, 255, 1, 0, 1, 0, 0, 61, 66, 61, 61, 66,
+    61, 61, 61, 66, 61, 61, 61, 254, 255, 1, 0, 0, 0, 0, 61, 61, 61, 61, 61, 66, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255,
+    0, 0, 31, 0, 0, 57, 255, 1, 0, 23, 0, 0, 0, 16, 0, 0, 254, 1, 0, 0, 15, 0, 0, 63, 63, 63, 63, 63, 63, 63,
+    68, 63, 63, 63, 63, 63, 254, 1, 1, 0, 14, 0, 0, 63, 63, 63, 68, 63, 63, 63, 68, 63, 63, 68, 63, 254, 1, 1, 0, 13,
+    0, 0, 63, 63, 68, 63, 68, 63, 68, 68, 63, 68, 63, 68, 254, 1, 1, 0, 12, 0, 0, 63, 68, 68, 68, 63, 68, 68, 68, 68,
+    68, 254, 1, 1, 0, 11, 0, 0, 68, 68, 68, 68, 67, 68, 68, 68, 67, 254, 1, 1, 0, 10, 0, 0, 68, 67, 68, 67, 68, 68,
+    67, 68, 67, 68, 67, 67, 254, 1, 1, 0, 9, 0, 0, 67, 68, 67, 67, 68, 67, 67, 67, 68, 67, 67, 67, 254, 1, 1, 0, 8,
+    0, 0, 67, 67, 67, 67, 67, 68, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 7, 0, 0, 61, 255, 23, 0, 31, 0, 0,
+    0, 24, 0, 0, 254, 0, 255, 0, 23, 0, 0, 57, 57, 57, 57, 57, 57, 57, 58, 57, 57, 57, 57, 57, 254, 1, 255, 0, 22, 0,
+    0, 57, 57, 57, 58, 57, 57, 57, 58, 57, 57, 58, 57, 254, 1, 255, 0, 21, 0, 0, 57, 57, 58, 57, 58, 57, 58, 58, 57, 58,
+    57, 58, 254, 1, 255, 0, 20, 0, 0, 57, 58, 58, 58, 57, 58, 58, 58, 58, 58, 254, 1, 255, 0, 19, 0, 0, 58, 58, 58, 58,
+    63, 58, 58, 58, 63, 254, 1, 255, 0, 18, 0, 0, 58, 63, 58, 63, 58, 58, 63, 58, 63, 58, 63, 63, 254, 1, 255, 0, 17, 0,
+    0, 63, 58, 63, 63, 58, 63, 63, 63, 58, 63, 63, 63, 254, 1, 255, 0, 16, 0, 0, 63, 63, 63, 63, 63, 58, 63, 63, 63, 63,
+    63, 63, 63, 63, 254, 1, 0, 0, 15, 0, 0, 67, 255, 31, 0, 9, 0, 0, 0, 0, 0, 0, 254, 255, 0, 0, 1, 0, 0, 61,
+    61, 61, 61, 61, 61, 61, 61, 66, 61, 61, 61, 61, 61, 61, 254, 255, 1, 0, 2, 0, 0, 61, 61, 61, 66, 61, 61, 61, 66, 61,
+    61, 66, 61, 61, 66, 61, 254, 255, 1, 0, 3, 0, 0, 61, 61, 66, 61, 66, 61, 66, 61, 66, 61, 66, 66, 61, 66, 254, 255, 1,
+    0, 4, 0, 0, 61, 66, 66, 61, 66, 66, 66, 66, 61, 66, 66, 66, 66, 254, 255, 1, 0, 5, 0, 0, 66, 66, 66, 67, 66, 66,
+    66, 66, 67, 66, 66, 67, 254, 255, 1, 0, 6, 0, 0, 66, 67, 66, 66, 67, 66, 67, 66, 67, 66, 67, 66, 67, 67, 254, 255, 1,
+    0, 7, 0, 0, 67, 66, 67, 67, 66, 67, 67, 66, 67, 67, 67, 66, 67, 67, 67, 254, 255, 1, 0, 8, 0, 0, 67, 67, 67, 67,
+    67, 67, 66, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 9, 0, 0, 63, 63, 255, 9, 0, 1, 0, 0, 0, 8, 0,
+    0, 254, 0, 1, 0, 9, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 68, 67, 67, 67, 67, 67, 67, 254, 1, 1, 0, 10, 0, 0,
+    67, 67, 67, 68, 67, 67, 67, 68, 67, 67, 68, 67, 67, 68, 67, 254, 1, 1, 0, 11, 0, 0, 67, 67, 68, 67, 68, 67, 68, 67,
+    68, 67, 68, 68, 67, 68, 254, 1, 1, 0, 12, 0, 0, 67, 68, 68, 67, 68, 68, 68, 68, 67, 68, 68, 68, 68, 254, 1, 1, 0,
+    13, 0, 0, 68, 68, 68, 63, 68, 68, 68, 68, 63, 68, 68, 63, 254, 1, 1, 0, 14, 0, 0, 68, 63, 68, 68, 63, 68, 63, 68,
+    63, 68, 63, 68, 63, 63, 254, 1, 1, 0, 15, 0, 0, 63, 68, 63, 63, 68, 63, 63, 68, 63, 63, 63, 68, 63, 63, 63, 254, 1,
+    1, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 68, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 17, 0, 0, 57, 57,
+    255, 1, 0, 23, 0, 0, 0, 16, 0, 0, 254, 1, 0, 0, 17, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 58, 63, 63, 63, 63,
+    63, 63, 254, 1, 255, 0, 18, 0, 0, 63, 63, 63, 58, 63, 63, 63, 58, 63, 63, 58, 63, 63, 58, 63, 254, 1, 255, 0, 19, 0,
+    0, 63, 63, 58, 63, 58, 63, 58, 63, 58, 63, 58, 58, 63, 58, 254, 1, 255, 0, 20, 0, 0, 63, 58, 58, 63, 58, 58, 58, 58,
+    63, 58, 58, 58, 58, 254, 1, 255, 0, 21, 0, 0, 58, 58, 58, 57, 58, 58, 58, 58, 57, 58, 58, 57, 254, 1, 255, 0, 22, 0,
+    0, 58, 57, 58, 58, 57, 58, 57, 58, 57, 58, 57, 58, 57, 57, 254, 1, 255, 0, 23, 0, 0, 57, 58, 57, 57, 58, 57, 57, 58,
+    57, 57, 57, 58, 57, 57, 57, 254, 1, 255, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 58, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    254, 0, 255, 0, 25, 0, 0, 61, 61, 255, 23, 0, 31, 0, 0, 0, 24, 0, 0, 254, 0, 255, 0, 25, 0, 0, 57, 57, 57, 57,
+    57, 57, 57, 57, 56, 57, 57, 57, 57, 57, 57, 254, 255, 255, 0, 26, 0, 0, 57, 57, 57, 56, 57, 57, 57, 56, 57, 57, 56, 57,
+    57, 56, 57, 254, 255, 255, 0, 27, 0, 0, 57, 57, 56, 57, 56, 57, 56, 57, 56, 57, 56, 56, 57, 56, 254, 255, 255, 0, 28, 0,
+    0, 57, 56, 56, 57, 56, 56, 56, 56, 57, 56, 56, 56, 56, 254, 255, 255, 0, 29, 0, 0, 56, 56, 56, 61, 56, 56, 56, 56, 61,
+    56, 56, 61, 254, 255, 255, 0, 30, 0, 0, 56, 61, 56, 56, 61, 56, 61, 56, 61, 56, 61, 56, 61, 61, 254, 255, 255, 0, 31, 0,
+    0, 61, 56, 61, 61, 56, 61, 61, 56, 61, 61, 61, 56, 61, 61, 61, 254, 255, 255, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 56,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 1, 0, 0, 67, 67, 255, 31, 0, 9, 0, 0, 0, 0, 2, 0, 254, 255,
+    0, 1, 31, 2, 0, 61, 86, 61, 86, 86, 61, 86, 56, 86, 86, 61, 86, 86, 254, 255, 255, 0, 30, 2, 0, 86, 61, 86, 81, 61,
+    86, 61, 81, 86, 61, 81, 61, 254, 255, 255, 1, 29, 2, 0, 86, 61, 81, 86, 56, 86, 56, 81, 86, 56, 86, 56, 254, 255, 255, 1,
+    28, 2, 0, 86, 56, 81, 56, 86, 81, 56, 81, 56, 81, 254, 255, 255, 1, 27, 2, 0, 56, 81, 81, 56, 82, 56, 81, 81, 57, 254,
+    255, 255, 1, 26, 2, 0, 56, 82, 81, 57, 81, 56, 82, 81, 57, 81, 57, 82, 254, 255, 255, 1, 25, 2, 0, 57, 81, 82, 57, 81,
+    57, 82, 82, 56, 82, 57, 82, 254, 255, 255, 1, 24, 2, 0, 57, 82, 57, 82, 82, 56, 82, 82, 57, 82, 57, 82, 82, 57, 254, 0,
+    255, 1, 23, 2, 0, 63, 255, 9, 0, 1, 0, 0, 0, 8, 2, 0, 254, 0, 1, 1, 7, 2, 0, 67, 92, 67, 92, 92, 67, 92,
+    66, 92, 92, 67, 92, 92, 254, 255, 1, 0, 6, 2, 0, 92, 67, 92, 91, 67, 92, 67, 91, 92, 67, 91, 67, 254, 255, 1, 1, 5,
+    2, 0, 92, 67, 91, 92, 66, 92, 66, 91, 92, 66, 92, 66, 254, 255, 1, 1, 4, 2, 0, 92, 66, 91, 66, 92, 91, 66, 91, 66,
+    91, 254, 255, 1, 1, 3, 2, 0, 66, 91, 91, 66, 86, 66, 91, 91, 61, 254, 255, 1, 1, 2, 2, 0, 66, 86, 91, 61, 91, 66,
+    86, 91, 61, 91, 61, 86, 254, 255, 1, 1, 1, 2, 0, 61, 91, 86, 61, 91, 61, 86, 86, 66, 86, 61, 86, 254, 255, 1, 1, 0,
+    2, 0, 61, 86, 61, 86, 86, 66, 86, 86, 61, 86, 61, 86, 86, 61, 254, 255, 0, 1, 31, 2, 0, 57, 255, 1, 0, 23, 0, 0,
+    0, 16, 2, 0, 254, 1, 0, 1, 15, 2, 0, 63, 88, 63, 88, 88, 63, 88, 68, 88, 88, 63, 88, 88, 254, 1, 1, 0, 14, 2,
+    0, 88, 63, 88, 93, 63, 88, 63, 93, 88, 63, 93, 63, 254, 1, 1, 1, 13, 2, 0, 88, 63, 93, 88, 68, 88, 68, 93, 88, 68,
+    88, 68, 254, 1, 1, 1, 12, 2, 0, 88, 68, 93, 68, 88, 93, 68, 93, 68, 93, 254, 1, 1, 1, 11, 2, 0, 68, 93, 93, 68,
+    92, 68, 93, 93, 67, 254, 1, 1, 1, 10, 2, 0, 68, 92, 93, 67, 93, 68, 92, 93, 67, 93, 67, 92, 254, 1, 1, 1, 9, 2,
+    0, 67, 93, 92, 67, 93, 67, 92, 92, 68, 92, 67, 92, 254, 1, 1, 1, 8, 2, 0, 67, 92, 67, 92, 92, 68, 92, 92, 67, 92,
+    67, 92, 92, 67, 254, 0, 1, 1, 7, 2, 0, 61, 255, 23, 0, 31, 0, 0, 0, 24, 2, 0, 254, 0, 255, 1, 23, 2, 0, 57,
+    82, 57, 82, 82, 57, 82, 58, 82, 82, 57, 82, 82, 254, 1, 255, 0, 22, 2, 0, 82, 57, 82, 83, 57, 82, 57, 83, 82, 57, 83,
+    57, 254, 1, 255, 1, 21, 2, 0, 82, 57, 83, 82, 58, 82, 58, 83, 82, 58, 82, 58, 254, 1, 255, 1, 20, 2, 0, 82, 58, 83,
+    58, 82, 83, 58, 83, 58, 83, 254, 1, 255, 1, 19, 2, 0, 58, 83, 83, 58, 88, 58, 83, 83, 63, 254, 1, 255, 1, 18, 2, 0,
+    58, 88, 83, 63, 83, 58, 88, 83, 63, 83, 63, 88, 254, 1, 255, 1, 17, 2, 0, 63, 83, 88, 63, 83, 63, 88, 88, 58, 88, 63,
+    88, 254, 1, 255, 1, 16, 2, 0, 63, 88, 63, 88, 88, 58, 88, 88, 63, 88, 63, 88, 88, 63, 254, 1, 0, 1, 15, 2, 0, 67,
+    255, 31, 0, 9, 0, 0, 0, 0, 2, 0, 254, 255, 0, 1, 1, 2, 0, 61, 86, 61, 86, 61, 86, 61, 86, 66, 86, 61, 86, 61,
+    86, 61, 254, 255, 1, 1, 2, 2, 0, 61, 86, 61, 91, 61, 86, 61, 91, 61, 86, 66, 86, 61, 91, 61, 254, 255, 1, 1, 3, 2,
+    0, 61, 86, 66, 86, 66, 86, 66, 86, 66, 86, 66, 91, 61, 91, 254, 255, 1, 0, 4, 2, 0, 86, 66, 91, 61, 91, 66, 91, 66,
+    86, 66, 91, 66, 91, 254, 255, 1, 0, 5, 2, 0, 91, 91, 66, 92, 66, 91, 66, 91, 67, 91, 66, 92, 254, 255, 1, 0, 6, 2,
+    0, 91, 67, 91, 66, 92, 66, 92, 66, 92, 66, 92, 66, 92, 67, 254, 255, 1, 1, 7, 2, 0, 67, 91, 67, 92, 66, 92, 67, 91,
+    67, 92, 67, 91, 67, 92, 67, 254, 255, 1, 1, 8, 2, 0, 67, 92, 67, 92, 67, 92, 66, 92, 67, 92, 67, 92, 67, 92, 67, 92,
+    254, 0, 1, 0, 9, 2, 0, 88, 63, 255, 9, 0, 1, 0, 0, 0, 8, 2, 0, 254, 0, 1, 1, 9, 2, 0, 67, 92, 67, 92,
+    67, 92, 67, 92, 68, 92, 67, 92, 67, 92, 67, 254, 1, 1, 1, 10, 2, 0, 67, 92, 67, 93, 67, 92, 67, 93, 67, 92, 68, 92,
+    67, 93, 67, 254, 1, 1, 1, 11, 2, 0, 67, 92, 68, 92, 68, 92, 68, 92, 68, 92, 68, 93, 67, 93, 254, 1, 1, 0, 12, 2,
+    0, 92, 68, 93, 67, 93, 68, 93, 68, 92, 68, 93, 68, 93, 254, 1, 1, 0, 13, 2, 0, 93, 93, 68, 88, 68, 93, 68, 93, 63,
+    93, 68, 88, 254, 1, 1, 0, 14, 2, 0, 93, 63, 93, 68, 88, 68, 88, 68, 88, 68, 88, 68, 88, 63, 254, 1, 1, 1, 15, 2,
+    0, 63, 93, 63, 88, 68, 88, 63, 93, 63, 88, 63, 93, 63, 88, 63, 254, 1, 1, 1, 16, 2, 0, 63, 88, 63, 88, 63, 88, 68,
+    88, 63, 88, 63, 88, 63, 88, 63, 88, 254, 1, 0, 0, 17, 2, 0, 82, 57, 255, 1, 0, 23, 0, 0, 0, 16, 2, 0, 254, 1,
+    0, 1, 17, 2, 0, 63, 88, 63, 88, 63, 88, 63, 88, 58, 88, 63, 88, 63, 88, 63, 254, 1, 255, 1, 18, 2, 0, 63, 88, 63,
+    83, 63, 88, 63, 83, 63, 88, 58, 88, 63, 83, 63, 254, 1, 255, 1, 19, 2, 0, 63, 88, 58, 88, 58, 88, 58, 88, 58, 88, 58,
+    83, 63, 83, 254, 1, 255, 0, 20, 2, 0, 88, 58, 83, 63, 83, 58, 83, 58, 88, 58, 83, 58, 83, 254, 1, 255, 0, 21, 2, 0,
+    83, 83, 58, 82, 58, 83, 58, 83, 57, 83, 58, 82, 254, 1, 255, 0, 22, 2, 0, 83, 57, 83, 58, 82, 58, 82, 58, 82, 58, 82,
+    58, 82, 57, 254, 1, 255, 1, 23, 2, 0, 57, 83, 57, 82, 58, 82, 57, 83, 57, 82, 57, 83, 57, 82, 57, 254, 1, 255, 1, 24,
+    2, 0, 57, 82, 57, 82, 57, 82, 58, 82, 57, 82, 57, 82, 57, 82, 57, 82, 254, 0, 255, 0, 25, 2, 0, 86, 61, 255, 23, 0,
+    31, 0, 0, 0, 24, 2, 0, 254, 0, 255, 1, 25, 2, 0, 57, 82, 57, 82, 57, 82, 57, 82, 56, 82, 57, 82, 57, 82, 57, 254,
+    255, 255, 1, 26, 2, 0, 57, 82, 57, 81, 57, 82, 57, 81, 57, 82, 56, 82, 57, 81, 57, 254, 255, 255, 1, 27, 2, 0, 57, 82,
+    56, 82, 56, 82, 56, 82, 56, 82, 56, 81, 57, 81, 254, 255, 255, 0, 28, 2, 0, 82, 56, 81, 57, 81, 56, 81, 56, 82, 56, 81,
+    56, 81, 254, 255, 255, 0, 29, 2, 0, 81, 81, 56, 86, 56, 81, 56, 81, 61, 81, 56, 86, 254, 255, 255, 0, 30, 2, 0, 81, 61,
+    81, 56, 86, 56, 86, 56, 86, 56, 86, 56, 86, 61, 254, 255, 255, 1, 31, 2, 0, 61, 81, 61, 86, 56, 86, 61, 81, 61, 86, 61,
+    81, 61, 86, 61, 254, 255, 255, 1, 0, 2, 0, 61, 86, 61, 86, 61, 86, 56, 86, 61, 86, 61, 86, 61, 86, 61, 86, 254, 255, 0,
+    0, 1, 2, 0, 92, 67, 255, 31, 0, 9, 0, 15, 0, 0, 6, 0, 254, 255, 0, 255, 31, 6, 0, 61, 36, 61, 36, 36, 61, 36,
+    56, 36, 36, 61, 36, 36, 254, 255, 255, 0, 30, 6, 0, 36, 61, 36, 31, 61, 36, 61, 31, 36, 61, 31, 61, 254, 255, 255, 255, 29,
+    6, 0, 36, 61, 31, 36, 56, 36, 56, 31, 36, 56, 36, 56, 254, 255, 255, 255, 28, 6, 0, 36, 56, 31, 56, 36, 31, 56, 31, 56,
+    31, 254, 255, 255, 255, 27, 6, 0, 56, 31, 31, 56, 32, 56, 31, 31, 57, 254, 255, 255, 255, 26, 6, 0, 56, 32, 31, 57, 31, 56,
+    32, 31, 57, 31, 57, 32, 254, 255, 255, 255, 25, 6, 0, 57, 31, 32, 57, 31, 57, 32, 32, 56, 32, 57, 32, 254, 255, 255, 255, 24,
+    6, 0, 57, 32, 57, 32, 32, 56, 32, 32, 57, 32, 57, 32, 32, 57, 254, 0, 255, 255, 23, 6, 0, 63, 255, 9, 0, 1, 0, 15,
+    0, 8, 6, 0, 254, 0, 1, 255, 7, 6, 0, 67, 42, 67, 42, 42, 67, 42, 66, 42, 42, 67, 42, 42, 254, 255, 1, 0, 6, 6,
+    0, 42, 67, 42, 41, 67, 42, 67, 41, 42, 67, 41, 67, 254, 255, 1, 255, 5, 6, 0, 42, 67, 41, 42, 66, 42, 66, 41, 42, 66,
+    42, 66, 254, 255, 1, 255, 4, 6, 0, 42, 66, 41, 66, 42, 41, 66, 41, 66, 41, 254, 255, 1, 255, 3, 6, 0, 66, 41, 41, 66,
+    36, 66, 41, 41, 61, 254, 255, 1, 255, 2, 6, 0, 66, 36, 41, 61, 41, 66, 36, 41, 61, 41, 61, 36, 254, 255, 1, 255, 1, 6,
+    0, 61, 41, 36, 61, 41, 61, 36, 36, 66, 36, 61, 36, 254, 255, 1, 255, 0, 6, 0, 61, 36, 61, 36, 36, 66, 36, 36, 61, 36,
+    61, 36, 36, 61, 254, 255, 0, 255, 31, 6, 0, 57, 255, 1, 0, 23, 0, 15, 0, 16, 6, 0, 254, 1, 0, 255, 15, 6, 0, 63,
+    38, 63, 38, 38, 63, 38, 68, 38, 38, 63, 38, 38, 254, 1, 1, 0, 14, 6, 0, 38, 63, 38, 43, 63, 38, 63, 43, 38, 63, 43,
+    63, 254, 1, 1, 255, 13, 6, 0, 38, 63, 43, 38, 68, 38, 68, 43, 38, 68, 38, 68, 254, 1, 1, 255, 12, 6, 0, 38, 68, 43,
+    68, 38, 43, 68, 43, 68, 43, 254, 1, 1, 255, 11, 6, 0, 68, 43, 43, 68, 42, 68, 43, 43, 67, 254, 1, 1, 255, 10, 6, 0,
+    68, 42, 43, 67, 43, 68, 42, 43, 67, 43, 67, 42, 254, 1, 1, 255, 9, 6, 0, 67, 43, 42, 67, 43, 67, 42, 42, 68, 42, 67,
+    42, 254, 1, 1, 255, 8, 6, 0, 67, 42, 67, 42, 42, 68, 42, 42, 67, 42, 67, 42, 42, 67, 254, 0, 1, 255, 7, 6, 0, 61,
+    255, 23, 0, 31, 0, 15, 0, 24, 6, 0, 254, 0, 255, 255, 23, 6, 0, 57, 32, 57, 32, 32, 57, 32, 58, 32, 32, 57, 32, 32,
+    254, 1, 255, 0, 22, 6, 0, 32, 57, 32, 33, 57, 32, 57, 33, 32, 57, 33, 57, 254, 1, 255, 255, 21, 6, 0, 32, 57, 33, 32,
+    58, 32, 58, 33, 32, 58, 32, 58, 254, 1, 255, 255, 20, 6, 0, 32, 58, 33, 58, 32, 33, 58, 33, 58, 33, 254, 1, 255, 255, 19,
+    6, 0, 58, 33, 33, 58, 38, 58, 33, 33, 63, 254, 1, 255, 255, 18, 6, 0, 58, 38, 33, 63, 33, 58, 38, 33, 63, 33, 63, 38,
+    254, 1, 255, 255, 17, 6, 0, 63, 33, 38, 63, 33, 63, 38, 38, 58, 38, 63, 38, 254, 1, 255, 255, 16, 6, 0, 63, 38, 63, 38,
+    38, 58, 38, 38, 63, 38, 63, 38, 38, 63, 254, 1, 0, 255, 15, 6, 0, 67, 255, 31, 0, 9, 0, 15, 0, 0, 6, 0, 254, 255,
+    0, 255, 1, 6, 0, 61, 36, 61, 36, 61, 36, 61, 36, 66, 36, 61, 36, 61, 36, 61, 254, 255, 1, 255, 2, 6, 0, 61, 36, 61,
+    41, 61, 36, 61, 41, 61, 36, 66, 36, 61, 41, 61, 254, 255, 1, 255, 3, 6, 0, 61, 36, 66, 36, 66, 36, 66, 36, 66, 36, 66,
+    41, 61, 41, 254, 255, 1, 0, 4, 6, 0, 36, 66, 41, 61, 41, 66, 41, 66, 36, 66, 41, 66, 41, 254, 255, 1, 0, 5, 6, 0,
+    41, 41, 66, 42, 66, 41, 66, 41, 67, 41, 66, 42, 254, 255, 1, 0, 6, 6, 0, 41, 67, 41, 66, 42, 66, 42, 66, 42, 66, 42,
+    66, 42, 67, 254, 255, 1, 255, 7, 6, 0, 67, 41, 67, 42, 66, 42, 67, 41, 67, 42, 67, 41, 67, 42, 67, 254, 255, 1, 255, 8,
+    6, 0, 67, 42, 67, 42, 67, 42, 66, 42, 67, 42, 67, 42, 67, 42, 67, 42, 254, 0, 1, 0, 9, 6, 0, 38, 63, 255, 9, 0,
+    1, 0, 15, 0, 8, 6, 0, 254, 0, 1, 255, 9, 6, 0, 67, 42, 67, 42, 67, 42, 67, 42, 68, 42, 67, 42, 67, 42, 67, 254,
+    1, 1, 255, 10, 6, 0, 67, 42, 67, 43, 67, 42, 67, 43, 67, 42, 68, 42, 67, 43, 67, 254, 1, 1, 255, 11, 6, 0, 67, 42,
+    68, 42, 68, 42, 68, 42, 68, 42, 68, 43, 67, 43, 254, 1, 1, 0, 12, 6, 0, 42, 68, 43, 67, 43, 68, 43, 68, 42, 68, 43,
+    68, 43, 254, 1, 1, 0, 13, 6, 0, 43, 43, 68, 38, 68, 43, 68, 43, 63, 43, 68, 38, 254, 1, 1, 0, 14, 6, 0, 43, 63,
+    43, 68, 38, 68, 38, 68, 38, 68, 38, 68, 38, 63, 254, 1, 1, 255, 15, 6, 0, 63, 43, 63, 38, 68, 38, 63, 43, 63, 38, 63,
+    43, 63, 38, 63, 254, 1, 1, 255, 16, 6, 0, 63, 38, 63, 38, 63, 38, 68, 38, 63, 38, 63, 38, 63, 38, 63, 38, 254, 1, 0,
+    0, 17, 6, 0, 32, 57, 255, 1, 0, 23, 0, 15, 0, 16, 6, 0, 254, 1, 0, 255, 17, 6, 0, 63, 38, 63, 38, 63, 38, 63,
+    38, 58, 38, 63, 38, 63, 38, 63, 254, 1, 255, 255, 18, 6, 0, 63, 38, 63, 33, 63, 38, 63, 33, 63, 38, 58, 38, 63, 33, 63,
+    254, 1, 255, 255, 19, 6, 0, 63, 38, 58, 38, 58, 38, 58, 38, 58, 38, 58, 33, 63, 33, 254, 1, 255, 0, 20, 6, 0, 38, 58,
+    33, 63, 33, 58, 33, 58, 38, 58, 33, 58, 33, 254, 1, 255, 0, 21, 6, 0, 33, 33, 58, 32, 58, 33, 58, 33, 57, 33, 58, 32,
+    254, 1, 255, 0, 22, 6, 0, 33, 57, 33, 58, 32, 58, 32, 58, 32, 58, 32, 58, 32, 57, 254, 1, 255, 255, 23, 6, 0, 57, 33,
+    57, 32, 58, 32, 57, 33, 57, 32, 57, 33, 57, 32, 57, 254, 1, 255, 255, 24, 6, 0, 57, 32, 57, 32, 57, 32, 58, 32, 57, 32,
+    57, 32, 57, 32, 57, 32, 254, 0, 255, 0, 25, 6, 0, 36, 61, 255, 23, 0, 31, 0, 15, 0, 24, 6, 0, 254, 0, 255, 255, 25,
+    6, 0, 57, 32, 57, 32, 57, 32, 57, 32, 56, 32, 57, 32, 57, 32, 57, 254, 255, 255, 255, 26, 6, 0, 57, 32, 57, 31, 57, 32,
+    57, 31, 57, 32, 56, 32, 57, 31, 57, 254, 255, 255, 255, 27, 6, 0, 57, 32, 56, 32, 56, 32, 56, 32, 56, 32, 56, 31, 57, 31,
+    254, 255, 255, 0, 28, 6, 0, 32, 56, 31, 57, 31, 56, 31, 56, 32, 56, 31, 56, 31, 254, 255, 255, 0, 29, 6, 0, 31, 31, 56,
+    36, 56, 31, 56, 31, 61, 31, 56, 36, 254, 255, 255, 0, 30, 6, 0, 31, 61, 31, 56, 36, 56, 36, 56, 36, 56, 36, 56, 36, 61,
+    254, 255, 255, 255, 31, 6, 0, 61, 31, 61, 36, 56, 36, 61, 31, 61, 36, 61, 31, 61, 36, 61, 254, 255, 255, 255, 0, 6, 0, 61,
+    36, 61, 36, 61, 36, 56, 36, 61, 36, 61, 36, 61, 36, 61, 36, 254, 255, 0, 0, 1, 6, 0, 42, 67, 255, 32, 0, 9, 0, 0,
+    0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 31, 0, 0, 56, 61, 61, 61, 61, 61, 56, 61, 61, 61, 56, 254,
+    255, 0, 0, 30, 0, 0, 61, 56, 61, 61, 56, 61, 61, 56, 61, 56, 61, 56, 61, 254, 255, 255, 0, 29, 0, 0, 61, 56, 61, 56,
+    56, 61, 56, 56, 61, 56, 56, 61, 56, 56, 61, 56, 56, 61, 56, 61, 254, 255, 255, 0, 30, 0, 0, 61, 56, 61, 56, 61, 56, 61,
+    56, 61, 61, 56, 61, 56, 61, 61, 254, 255, 255, 0, 31, 0, 0, 61, 61, 61, 56, 61, 61, 61, 56, 61, 61, 61, 61, 61, 61, 56,
+    254, 255, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 255, 9, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67, 67,
+    67, 67, 254, 0, 1, 0, 7, 0, 0, 66, 67, 67, 67, 67, 67, 66, 67, 67, 67, 66, 254, 0, 1, 0, 6, 0, 0, 67, 66, 67,
+    67, 66, 67, 67, 66, 67, 66, 67, 66, 67, 254, 255, 1, 0, 5, 0, 0, 67, 66, 67, 66, 66, 67, 66, 66, 67, 66, 66, 67, 66,
+    66, 67, 66, 66, 67, 66, 67, 254, 255, 1, 0, 6, 0, 0, 67, 66, 67, 66, 67, 66, 67, 66, 67, 67, 66, 67, 66, 67, 67, 254,
+    255, 1, 0, 7, 0, 0, 67, 67, 67, 66, 67, 67, 67, 66, 67, 67, 67, 67, 67, 67, 66, 254, 0, 1, 0, 8, 0, 0, 67, 67,
+    67, 67, 67, 67, 67, 67, 255, 0, 0, 23, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 15, 0, 0,
+    68, 63, 63, 63, 63, 63, 68, 63, 63, 63, 68, 254, 1, 0, 0, 14, 0, 0, 63, 68, 63, 63, 68, 63, 63, 68, 63, 68, 63, 68,
+    63, 254, 1, 1, 0, 13, 0, 0, 63, 68, 63, 68, 68, 63, 68, 68, 63, 68, 68, 63, 68, 68, 63, 68, 68, 63, 68, 63, 254, 1,
+    1, 0, 14, 0, 0, 63, 68, 63, 68, 63, 68, 63, 68, 63, 63, 68, 63, 68, 63, 63, 254, 1, 1, 0, 15, 0, 0, 63, 63, 63,
+    68, 63, 63, 63, 68, 63, 63, 63, 63, 63, 63, 68, 254, 1, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 255, 23, 0,
+    32, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 23, 0, 0, 58, 57, 57, 57, 57, 57, 58, 57, 57,
+    57, 58, 254, 0, 255, 0, 22, 0, 0, 57, 58, 57, 57, 58, 57, 57, 58, 57, 58, 57, 58, 57, 254, 1, 255, 0, 21, 0, 0, 57,
+    58, 57, 58, 58, 57, 58, 58, 57, 58, 58, 57, 58, 58, 57, 58, 58, 57, 58, 57, 254, 1, 255, 0, 22, 0, 0, 57, 58, 57, 58,
+    57, 58, 57, 58, 57, 57, 58, 57, 58, 57, 57, 254, 1, 255, 0, 23, 0, 0, 57, 57, 57, 58, 57, 57, 57, 58, 57, 57, 57, 57,
+    57, 57, 58, 254, 0, 255, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 255, 32, 0, 9, 0, 0, 0, 0, 0, 0, 61, 61,
+    61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 1, 0, 0, 66, 61, 61, 61, 61, 61, 61, 66, 61, 61, 61, 66, 61, 61, 61, 254, 255,
+    1, 0, 2, 0, 0, 61, 61, 66, 61, 66, 61, 61, 66, 61, 66, 61, 66, 61, 66, 254, 255, 0, 0, 3, 0, 0, 66, 61, 66, 61,
+    66, 66, 61, 66, 66, 61, 66, 66, 61, 66, 66, 61, 66, 66, 61, 66, 61, 254, 255, 1, 0, 2, 0, 0, 61, 66, 61, 66, 61, 66,
+    61, 61, 66, 61, 61, 66, 61, 254, 255, 0, 0, 1, 0, 0, 66, 61, 61, 61, 66, 61, 61, 61, 61, 61, 66, 254, 255, 0, 0, 0,
+    0, 0, 61, 61, 61, 61, 61, 61, 61, 255, 9, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1,
+    0, 9, 0, 0, 68, 67, 67, 67, 67, 67, 67, 68, 67, 67, 67, 68, 67, 67, 67, 254, 1, 1, 0, 10, 0, 0, 67, 67, 68, 67,
+    68, 67, 67, 68, 67, 68, 67, 68, 67, 68, 254, 0, 1, 0, 11, 0, 0, 68, 67, 68, 67, 68, 68, 67, 68, 68, 67, 68, 68, 67,
+    68, 68, 67, 68, 68, 67, 68, 67, 254, 1, 1, 0, 10, 0, 0, 67, 68, 67, 68, 67, 68, 67, 67, 68, 67, 67, 68, 67, 254, 0,
+    1, 0, 9, 0, 0, 68, 67, 67, 67, 68, 67, 67, 67, 67, 67, 68, 254, 0, 1, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67,
+    255, 0, 0, 23, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 17, 0, 0, 58, 63, 63, 63, 63,
+    63, 63, 58, 63, 63, 63, 58, 63, 63, 63, 254, 1, 255, 0, 18, 0, 0, 63, 63, 58, 63, 58, 63, 63, 58, 63, 58, 63, 58, 63,
+    58, 254, 1, 0, 0, 19, 0, 0, 58, 63, 58, 63, 58, 58, 63, 58, 58, 63, 58, 58, 63, 58, 58, 63, 58, 58, 63, 58, 63, 254,
+    1, 255, 0, 18, 0, 0, 63, 58, 63, 58, 63, 58, 63, 63, 58, 63, 63, 58, 63, 254, 1, 0, 0, 17, 0, 0, 58, 63, 63, 63,
+    58, 63, 63, 63, 63, 63, 58, 254, 1, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 255, 23, 0, 32, 0, 0, 0, 24, 0,
+    0, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 25, 0, 0, 56, 57, 57, 57, 57, 57, 57, 56, 57, 57, 57, 56, 57, 57,
+    57, 254, 255, 255, 0, 26, 0, 0, 57, 57, 56, 57, 56, 57, 57, 56, 57, 56, 57, 56, 57, 56, 254, 0, 255, 0, 27, 0, 0, 56,
+    57, 56, 57, 56, 56, 57, 56, 56, 57, 56, 56, 57, 56, 56, 57, 56, 56, 57, 56, 57, 254, 255, 255, 0, 26, 0, 0, 57, 56, 57,
+    56, 57, 56, 57, 57, 56, 57, 57, 56, 57, 254, 0, 255, 0, 25, 0, 0, 56, 57, 57, 57, 56, 57, 57, 57, 57, 57, 56, 254, 0,
+    255, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 255, 31, 0, 9, 0, 0, 0, 0, 0, 0, 254, 255, 0, 0, 31, 0, 0, 61,
+    61, 61, 61, 61, 61, 254, 255, 0, 0, 30, 0, 0, 56, 61, 61, 61, 56, 61, 61, 254, 255, 255, 0, 29, 0, 0, 61, 56, 61, 56,
+    61, 56, 254, 255, 255, 0, 28, 0, 0, 61, 56, 56, 56, 56, 254, 255, 255, 0, 27, 0, 0, 56, 56, 56, 56, 57, 254, 255, 255, 0,
+    26, 0, 0, 56, 57, 56, 57, 56, 57, 254, 255, 255, 0, 25, 0, 0, 57, 57, 56, 57, 57, 57, 56, 254, 0, 255, 0, 24, 0, 0,
+    57, 57, 57, 57, 57, 57, 57, 255, 9, 0, 1, 0, 0, 0, 8, 0, 0, 254, 0, 1, 0, 7, 0, 0, 67, 67, 67, 67, 67, 67,
+    254, 0, 1, 0, 6, 0, 0, 66, 67, 67, 67, 66, 67, 67, 254, 255, 1, 0, 5, 0, 0, 67, 66, 67, 66, 67, 66, 254, 255, 1,
+    0, 4, 0, 0, 67, 66, 66, 66, 66, 254, 255, 1, 0, 3, 0, 0, 66, 66, 66, 66, 61, 254, 255, 1, 0, 2, 0, 0, 66, 61,
+    66, 61, 66, 61, 254, 255, 1, 0, 1, 0, 0, 61, 61, 66, 61, 61, 61, 66, 254, 255, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61,
+    61, 61, 255, 1, 0, 23, 0, 0, 0, 16, 0, 0, 254, 1, 0, 0, 15, 0, 0, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 14,
+    0, 0, 68, 63, 63, 63, 68, 63, 63, 254, 1, 1, 0, 13, 0, 0, 63, 68, 63, 68, 63, 68, 254, 1, 1, 0, 12, 0, 0, 63,
+    68, 68, 68, 68, 254, 1, 1, 0, 11, 0, 0, 68, 68, 68, 68, 67, 254, 1, 1, 0, 10, 0, 0, 68, 67, 68, 67, 68, 67, 254,
+    1, 1, 0, 9, 0, 0, 67, 67, 68, 67, 67, 67, 68, 254, 0, 1, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 255, 23, 0,
+    31, 0, 0, 0, 24, 0, 0, 254, 0, 255, 0, 23, 0, 0, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 22, 0, 0, 58, 57, 57,
+    57, 58, 57, 57, 254, 1, 255, 0, 21, 0, 0, 57, 58, 57, 58, 57, 58, 254, 1, 255, 0, 20, 0, 0, 57, 58, 58, 58, 58, 254,
+    1, 255, 0, 19, 0, 0, 58, 58, 58, 58, 63, 254, 1, 255, 0, 18, 0, 0, 58, 63, 58, 63, 58, 63, 254, 1, 255, 0, 17, 0,
+    0, 63, 63, 58, 63, 63, 63, 58, 254, 1, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 255, 31, 0, 9, 0, 0, 0, 0,
+    0, 0, 254, 255, 0, 0, 1, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 1, 0, 2, 0, 0, 61, 61, 61, 66, 61,
+    61, 66, 61, 61, 254, 255, 1, 0, 3, 0, 0, 61, 66, 61, 66, 61, 66, 61, 66, 61, 254, 255, 1, 0, 4, 0, 0, 66, 66, 61,
+    66, 66, 66, 66, 254, 255, 1, 0, 5, 0, 0, 66, 66, 66, 66, 67, 66, 66, 254, 255, 1, 0, 6, 0, 0, 67, 66, 67, 66, 67,
+    66, 67, 66, 67, 254, 255, 1, 0, 7, 0, 0, 67, 67, 66, 67, 67, 66, 67, 67, 67, 254, 255, 1, 0, 8, 0, 0, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 255, 9, 0, 1, 0, 0, 0, 8, 0, 0, 254, 0, 1, 0, 9, 0, 0, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 254, 1, 1, 0, 10, 0, 0, 67, 67, 67, 68, 67, 67, 68, 67, 67, 254, 1, 1, 0, 11, 0, 0, 67, 68, 67, 68,
+    67, 68, 67, 68, 67, 254, 1, 1, 0, 12, 0, 0, 68, 68, 67, 68, 68, 68, 68, 254, 1, 1, 0, 13, 0, 0, 68, 68, 68, 68,
+    63, 68, 68, 254, 1, 1, 0, 14, 0, 0, 63, 68, 63, 68, 63, 68, 63, 68, 63, 254, 1, 1, 0, 15, 0, 0, 63, 63, 68, 63,
+    63, 68, 63, 63, 63, 254, 1, 1, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 255, 1, 0, 23, 0, 0, 0, 16,
+    0, 0, 254, 1, 0, 0, 17, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 255, 0, 18, 0, 0, 63, 63, 63, 58, 63,
+    63, 58, 63, 63, 254, 1, 255, 0, 19, 0, 0, 63, 58, 63, 58, 63, 58, 63, 58, 63, 254, 1, 255, 0, 20, 0, 0, 58, 58, 63,
+    58, 58, 58, 58, 254, 1, 255, 0, 21, 0, 0, 58, 58, 58, 58, 57, 58, 58, 254, 1, 255, 0, 22, 0, 0, 57, 58, 57, 58, 57,
+    58, 57, 58, 57, 254, 1, 255, 0, 23, 0, 0, 57, 57, 58, 57, 57, 58, 57, 57, 57, 254, 1, 255, 0, 24, 0, 0, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 255, 23, 0, 31, 0, 0, 0, 24, 0, 0, 254, 0, 255, 0, 25, 0, 0, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 254, 255, 255, 0, 26, 0, 0, 57, 57, 57, 56, 57, 57, 56, 57, 57, 254, 255, 255, 0, 27, 0, 0, 57, 56, 57, 56,
+    57, 56, 57, 56, 57, 254, 255, 255, 0, 28, 0, 0, 56, 56, 57, 56, 56, 56, 56, 254, 255, 255, 0, 29, 0, 0, 56, 56, 56, 56,
+    61, 56, 56, 254, 255, 255, 0, 30, 0, 0, 61, 56, 61, 56, 61, 56, 61, 56, 61, 254, 255, 255, 0, 31, 0, 0, 61, 61, 56, 61,
+    61, 56, 61, 61, 61, 254, 255, 255, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 31, 0, 9, 0, 0, 0, 0,
+    2, 0, 254, 255, 0, 1, 31, 2, 0, 61, 86, 61, 86, 61, 86, 254, 255, 0, 0, 30, 2, 0, 81, 61, 86, 61, 81, 61, 86, 254,
+    255, 255, 1, 29, 2, 0, 61, 81, 61, 81, 61, 81, 254, 255, 255, 0, 28, 2, 0, 86, 56, 81, 56, 81, 254, 255, 255, 1, 27, 2,
+    0, 56, 81, 56, 81, 57, 254, 255, 255, 1, 26, 2, 0, 56, 82, 56, 82, 56, 82, 254, 255, 255, 0, 25, 2, 0, 82, 82, 56, 82,
+    57, 82, 56, 254, 0, 255, 1, 24, 2, 0, 57, 82, 57, 82, 57, 82, 57, 255, 9, 0, 1, 0, 0, 0, 8, 2, 0, 254, 0, 1,
+    1, 7, 2, 0, 67, 92, 67, 92, 67, 92, 254, 0, 1, 0, 6, 2, 0, 91, 67, 92, 67, 91, 67, 92, 254, 255, 1, 1, 5, 2,
+    0, 67, 91, 67, 91, 67, 91, 254, 255, 1, 0, 4, 2, 0, 92, 66, 91, 66, 91, 254, 255, 1, 1, 3, 2, 0, 66, 91, 66, 91,
+    61, 254, 255, 1, 1, 2, 2, 0, 66, 86, 66, 86, 66, 86, 254, 255, 1, 0, 1, 2, 0, 86, 86, 66, 86, 61, 86, 66, 254, 255,
+    0, 1, 0, 2, 0, 61, 86, 61, 86, 61, 86, 61, 255, 1, 0, 23, 0, 0, 0, 16, 2, 0, 254, 1, 0, 1, 15, 2, 0, 63,
+    88, 63, 88, 63, 88, 254, 1, 0, 0, 14, 2, 0, 93, 63, 88, 63, 93, 63, 88, 254, 1, 1, 1, 13, 2, 0, 63, 93, 63, 93,
+    63, 93, 254, 1, 1, 0, 12, 2, 0, 88, 68, 93, 68, 93, 254, 1, 1, 1, 11, 2, 0, 68, 93, 68, 93, 67, 254, 1, 1, 1,
+    10, 2, 0, 68, 92, 68, 92, 68, 92, 254, 1, 1, 0, 9, 2, 0, 92, 92, 68, 92, 67, 92, 68, 254, 0, 1, 1, 8, 2, 0,
+    67, 92, 67, 92, 67, 92, 67, 255, 23, 0, 31, 0, 0, 0, 24, 2, 0, 254, 0, 255, 1, 23, 2, 0, 57, 82, 57, 82, 57, 82,
+    254, 0, 255, 0, 22, 2, 0, 83, 57, 82, 57, 83, 57, 82, 254, 1, 255, 1, 21, 2, 0, 57, 83, 57, 83, 57, 83, 254, 1, 255,
+    0, 20, 2, 0, 82, 58, 83, 58, 83, 254, 1, 255, 1, 19, 2, 0, 58, 83, 58, 83, 63, 254, 1, 255, 1, 18, 2, 0, 58, 88,
+    58, 88, 58, 88, 254, 1, 255, 0, 17, 2, 0, 88, 88, 58, 88, 63, 88, 58, 254, 1, 0, 1, 16, 2, 0, 63, 88, 63, 88, 63,
+    88, 63, 255, 31, 0, 9, 0, 0, 0, 0, 2, 0, 254, 255, 0, 0, 1, 2, 0, 86, 61, 86, 61, 61, 86, 61, 86, 61, 254, 255,
+    1, 0, 2, 2, 0, 86, 61, 86, 66, 61, 86, 66, 86, 61, 254, 255, 1, 0, 3, 2, 0, 86, 66, 86, 66, 61, 91, 61, 91, 61,
+    254, 255, 1, 0, 4, 2, 0, 91, 66, 86, 66, 66, 91, 66, 254, 255, 1, 1, 5, 2, 0, 66, 66, 91, 66, 67, 91, 66, 254, 255,
+    1, 1, 6, 2, 0, 67, 66, 92, 66, 92, 66, 67, 91, 67, 254, 255, 1, 1, 7, 2, 0, 67, 67, 91, 67, 92, 66, 67, 92, 67,
+    254, 255, 1, 1, 8, 2, 0, 67, 67, 92, 67, 92, 67, 67, 92, 67, 92, 255, 9, 0, 1, 0, 0, 0, 8, 2, 0, 254, 0, 1,
+    0, 9, 2, 0, 92, 67, 92, 67, 67, 92, 67, 92, 67, 254, 1, 1, 0, 10, 2, 0, 92, 67, 92, 68, 67, 92, 68, 92, 67, 254,
+    1, 1, 0, 11, 2, 0, 92, 68, 92, 68, 67, 93, 67, 93, 67, 254, 1, 1, 0, 12, 2, 0, 93, 68, 92, 68, 68, 93, 68, 254,
+    1, 1, 1, 13, 2, 0, 68, 68, 93, 68, 63, 93, 68, 254, 1, 1, 1, 14, 2, 0, 63, 68, 88, 68, 88, 68, 63, 93, 63, 254,
+    1, 1, 1, 15, 2, 0, 63, 63, 93, 63, 88, 68, 63, 88, 63, 254, 1, 1, 1, 16, 2, 0, 63, 63, 88, 63, 88, 63, 63, 88,
+    63, 88, 255, 1, 0, 23, 0, 0, 0, 16, 2, 0, 254, 1, 0, 0, 17, 2, 0, 88, 63, 88, 63, 63, 88, 63, 88, 63, 254, 1,
+    255, 0, 18, 2, 0, 88, 63, 88, 58, 63, 88, 58, 88, 63, 254, 1, 255, 0, 19, 2, 0, 88, 58, 88, 58, 63, 83, 63, 83, 63,
+    254, 1, 255, 0, 20, 2, 0, 83, 58, 88, 58, 58, 83, 58, 254, 1, 255, 1, 21, 2, 0, 58, 58, 83, 58, 57, 83, 58, 254, 1,
+    255, 1, 22, 2, 0, 57, 58, 82, 58, 82, 58, 57, 83, 57, 254, 1, 255, 1, 23, 2, 0, 57, 57, 83, 57, 82, 58, 57, 82, 57,
+    254, 1, 255, 1, 24, 2, 0, 57, 57, 82, 57, 82, 57, 57, 82, 57, 82, 255, 23, 0, 31, 0, 0, 0, 24, 2, 0, 254, 0, 255,
+    0, 25, 2, 0, 82, 57, 82, 57, 57, 82, 57, 82, 57, 254, 255, 255, 0, 26, 2, 0, 82, 57, 82, 56, 57, 82, 56, 82, 57, 254,
+    255, 255, 0, 27, 2, 0, 82, 56, 82, 56, 57, 81, 57, 81, 57, 254, 255, 255, 0, 28, 2, 0, 81, 56, 82, 56, 56, 81, 56, 254,
+    255, 255, 1, 29, 2, 0, 56, 56, 81, 56, 61, 81, 56, 254, 255, 255, 1, 30, 2, 0, 61, 56, 86, 56, 86, 56, 61, 81, 61, 254,
+    255, 255, 1, 31, 2, 0, 61, 61, 81, 61, 86, 56, 61, 86, 61, 254, 255, 255, 1, 0, 2, 0, 61, 61, 86, 61, 86, 61, 61, 86,
+    61, 86, 255, 31, 0, 9, 0, 15, 0, 0, 6, 0, 254, 255, 0, 255, 31, 6, 0, 61, 36, 61, 36, 61, 36, 254, 255, 0, 0, 30,
+    6, 0, 31, 36, 61, 36, 56, 36, 61, 254, 255, 255, 255, 29, 6, 0, 61, 31, 61, 31, 36, 56, 254, 255, 255, 255, 28, 6, 0, 61,
+    31, 56, 31, 56, 254, 255, 255, 255, 27, 6, 0, 31, 56, 31, 56, 32, 254, 255, 255, 0, 26, 6, 0, 31, 57, 31, 32, 56, 32, 254,
+    255, 255, 0, 25, 6, 0, 32, 57, 31, 57, 32, 57, 31, 254, 0, 255, 255, 24, 6, 0, 57, 32, 57, 32, 57, 32, 57, 255, 9, 0,
+    1, 0, 15, 0, 8, 6, 0, 254, 0, 1, 255, 7, 6, 0, 67, 42, 67, 42, 67, 42, 254, 0, 1, 0, 6, 6, 0, 41, 42, 67,
+    42, 66, 42, 67, 254, 255, 1, 255, 5, 6, 0, 67, 41, 67, 41, 42, 66, 254, 255, 1, 255, 4, 6, 0, 67, 41, 66, 41, 66, 254,
+    255, 1, 255, 3, 6, 0, 41, 66, 41, 66, 36, 254, 255, 1, 0, 2, 6, 0, 41, 61, 41, 36, 66, 36, 254, 255, 1, 0, 1, 6,
+    0, 36, 61, 41, 61, 36, 61, 41, 254, 255, 0, 255, 0, 6, 0, 61, 36, 61, 36, 61, 36, 61, 255, 1, 0, 23, 0, 15, 0, 16,
+    6, 0, 254, 1, 0, 255, 15, 6, 0, 63, 38, 63, 38, 63, 38, 254, 1, 0, 0, 14, 6, 0, 43, 38, 63, 38, 68, 38, 63, 254,
+    1, 1, 255, 13, 6, 0, 63, 43, 63, 43, 38, 68, 254, 1, 1, 255, 12, 6, 0, 63, 43, 68, 43, 68, 254, 1, 1, 255, 11, 6,
+    0, 43, 68, 43, 68, 42, 254, 1, 1, 0, 10, 6, 0, 43, 67, 43, 42, 68, 42, 254, 1, 1, 0, 9, 6, 0, 42, 67, 43, 67,
+    42, 67, 43, 254, 0, 1, 255, 8, 6, 0, 67, 42, 67, 42, 67, 42, 67, 255, 23, 0, 31, 0, 15, 0, 24, 6, 0, 254, 0, 255,
+    255, 23, 6, 0, 57, 32, 57, 32, 57, 32, 254, 0, 255, 0, 22, 6, 0, 33, 32, 57, 32, 58, 32, 57, 254, 1, 255, 255, 21, 6,
+    0, 57, 33, 57, 33, 32, 58, 254, 1, 255, 255, 20, 6, 0, 57, 33, 58, 33, 58, 254, 1, 255, 255, 19, 6, 0, 33, 58, 33, 58,
+    38, 254, 1, 255, 0, 18, 6, 0, 33, 63, 33, 38, 58, 38, 254, 1, 255, 0, 17, 6, 0, 38, 63, 33, 63, 38, 63, 33, 254, 1,
+    0, 255, 16, 6, 0, 63, 38, 63, 38, 63, 38, 63, 255, 31, 0, 9, 0, 15, 0, 0, 6, 0, 254, 255, 0, 0, 1, 6, 0, 36,
+    61, 36, 61, 61, 36, 61, 36, 61, 254, 255, 1, 255, 2, 6, 0, 61, 61, 36, 66, 36, 61, 66, 36, 61, 254, 255, 1, 255, 3, 6,
+    0, 61, 66, 36, 66, 36, 66, 61, 41, 61, 254, 255, 1, 255, 4, 6, 0, 66, 41, 61, 66, 41, 66, 41, 254, 255, 1, 0, 5, 6,
+    0, 66, 41, 66, 41, 67, 66, 41, 254, 255, 1, 0, 6, 6, 0, 42, 66, 42, 66, 67, 41, 67, 41, 67, 254, 255, 1, 0, 7, 6,
+    0, 42, 67, 41, 67, 67, 41, 67, 42, 67, 254, 255, 1, 0, 8, 6, 0, 42, 67, 42, 67, 42, 67, 67, 42, 67, 42, 255, 9, 0,
+    1, 0, 15, 0, 8, 6, 0, 254, 0, 1, 0, 9, 6, 0, 42, 67, 42, 67, 67, 42, 67, 42, 67, 254, 1, 1, 255, 10, 6, 0,
+    67, 67, 42, 68, 42, 67, 68, 42, 67, 254, 1, 1, 255, 11, 6, 0, 67, 68, 42, 68, 42, 68, 67, 43, 67, 254, 1, 1, 255, 12,
+    6, 0, 68, 43, 67, 68, 43, 68, 43, 254, 1, 1, 0, 13, 6, 0, 68, 43, 68, 43, 63, 68, 43, 254, 1, 1, 0, 14, 6, 0,
+    38, 68, 38, 68, 63, 43, 63, 43, 63, 254, 1, 1, 0, 15, 6, 0, 38, 63, 43, 63, 63, 43, 63, 38, 63, 254, 1, 1, 0, 16,
+    6, 0, 38, 63, 38, 63, 38, 63, 63, 38, 63, 38, 255, 1, 0, 23, 0, 15, 0, 16, 6, 0, 254, 1, 0, 0, 17, 6, 0, 38,
+    63, 38, 63, 63, 38, 63, 38, 63, 254, 1, 255, 255, 18, 6, 0, 63, 63, 38, 58, 38, 63, 58, 38, 63, 254, 1, 255, 255, 19, 6,
+    0, 63, 58, 38, 58, 38, 58, 63, 33, 63, 254, 1, 255, 255, 20, 6, 0, 58, 33, 63, 58, 33, 58, 33, 254, 1, 255, 0, 21, 6,
+    0, 58, 33, 58, 33, 57, 58, 33, 254, 1, 255, 0, 22, 6, 0, 32, 58, 32, 58, 57, 33, 57, 33, 57, 254, 1, 255, 0, 23, 6,
+    0, 32, 57, 33, 57, 57, 33, 57, 32, 57, 254, 1, 255, 0, 24, 6, 0, 32, 57, 32, 57, 32, 57, 57, 32, 57, 32, 255, 23, 0,
+    31, 0, 15, 0, 24, 6, 0, 254, 0, 255, 0, 25, 6, 0, 32, 57, 32, 57, 57, 32, 57, 32, 57, 254, 255, 255, 255, 26, 6, 0,
+    57, 57, 32, 56, 32, 57, 56, 32, 57, 254, 255, 255, 255, 27, 6, 0, 57, 56, 32, 56, 32, 56, 57, 31, 57, 254, 255, 255, 255, 28,
+    6, 0, 56, 31, 57, 56, 31, 56, 31, 254, 255, 255, 0, 29, 6, 0, 56, 31, 56, 31, 61, 56, 31, 254, 255, 255, 0, 30, 6, 0,
+    36, 56, 36, 56, 61, 31, 61, 31, 61, 254, 255, 255, 0, 31, 6, 0, 36, 61, 31, 61, 61, 31, 61, 36, 61, 254, 255, 255, 0, 0,
+    6, 0, 36, 61, 36, 61, 36, 61, 61, 36, 61, 36, 255, 31, 0, 9, 0, 0, 0, 0, 0, 0, 254, 255, 0, 0, 31, 0, 0, 61,
+    254, 255, 255, 0, 30, 0, 0, 61, 254, 255, 255, 0, 28, 0, 0, 56, 254, 255, 255, 0, 26, 0, 0, 57, 254, 255, 255, 0, 25, 0,
+    0, 57, 254, 0, 255, 0, 24, 0, 0, 57, 255, 9, 0, 0, 0, 0, 0, 8, 0, 0, 67, 254, 0, 1, 0, 7, 0, 0, 67, 254,
+    255, 1, 0, 6, 0, 0, 67, 254, 255, 1, 0, 4, 0, 0, 66, 254, 255, 1, 0, 2, 0, 0, 61, 254, 255, 1, 0, 1, 0, 0,
+    61, 254, 255, 0, 0, 0, 0, 0, 61, 255, 0, 0, 23, 0, 0, 0, 16, 0, 0, 63, 254, 1, 0, 0, 15, 0, 0, 63, 254, 1,
+    1, 0, 14, 0, 0, 63, 254, 1, 1, 0, 12, 0, 0, 68, 254, 1, 1, 0, 10, 0, 0, 67, 254, 1, 1, 0, 9, 0, 0, 67,
+    254, 0, 1, 0, 8, 0, 0, 255, 23, 0, 31, 0, 0, 0, 24, 0, 0, 254, 0, 255, 0, 23, 0, 0, 57, 254, 1, 255, 0, 22,
+    0, 0, 57, 254, 1, 255, 0, 20, 0, 0, 58, 254, 1, 255, 0, 18, 0, 0, 63, 254, 1, 255, 0, 17, 0, 0, 63, 254, 1, 0,
+    0, 16, 0, 0, 255, 31, 0, 9, 0, 0, 0, 0, 0, 0, 61, 61, 254, 255, 0, 0, 1, 0, 0, 61, 66, 61, 254, 255, 0, 0,
+    2, 0, 0, 66, 61, 61, 254, 255, 1, 0, 3, 0, 0, 61, 66, 66, 254, 255, 1, 0, 4, 0, 0, 66, 254, 255, 1, 0, 5, 0,
+    0, 66, 66, 67, 254, 255, 1, 0, 6, 0, 0, 67, 67, 66, 254, 0, 1, 0, 7, 0, 0, 67, 66, 67, 254, 0, 1, 0, 8, 0,
+    0, 67, 67, 255, 9, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 254, 0, 1, 0, 9, 0, 0, 67, 68, 67, 254, 0, 1, 0,
+    10, 0, 0, 68, 67, 67, 254, 1, 1, 0, 11, 0, 0, 67, 68, 68, 254, 1, 1, 0, 12, 0, 0, 68, 254, 1, 1, 0, 13, 0,
+    0, 68, 68, 63, 254, 1, 1, 0, 14, 0, 0, 63, 63, 68, 254, 1, 0, 0, 15, 0, 0, 63, 68, 63, 254, 1, 0, 0, 16, 0,
+    0, 63, 63, 255, 0, 0, 23, 0, 0, 0, 16, 0, 0, 63, 63, 63, 254, 1, 0, 0, 17, 0, 0, 63, 58, 63, 254, 1, 0, 0,
+    18, 0, 0, 58, 63, 63, 254, 1, 255, 0, 19, 0, 0, 63, 58, 58, 254, 1, 255, 0, 20, 0, 0, 58, 254, 1, 255, 0, 21, 0,
+    0, 58, 58, 57, 254, 1, 255, 0, 22, 0, 0, 57, 57, 58, 254, 0, 255, 0, 23, 0, 0, 57, 58, 57, 254, 0, 255, 0, 24, 0,
+    0, 57, 57, 57, 255, 23, 0, 31, 0, 0, 0, 24, 0, 0, 57, 254, 0, 255, 0, 25, 0, 0, 57, 56, 57, 254, 0, 255, 0, 26,
+    0, 0, 56, 57, 57, 254, 255, 255, 0, 27, 0, 0, 57, 56, 56, 254, 255, 255, 0, 28, 0, 0, 56, 254, 255, 255, 0, 29, 0, 0,
+    56, 56, 56, 254, 255, 0, 0, 30, 0, 0, 56, 61, 61, 254, 255, 255, 0, 31, 0, 0, 61, 61, 56, 254, 255, 0, 0, 0, 0, 0,
+    61, 61, 61, 255, 31, 0, 23, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 23, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 9, 0,
+    0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 255, 9, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 255, 31, 0, 23, 0, 0, 0, 0, 2, 0, 61, 86, 61,
+    86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 86, 61, 255, 23,
+    0, 0, 0, 0, 0, 8, 2, 0, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67, 92, 67,
+    92, 67, 92, 67, 92, 67, 92, 67, 92, 255, 0, 0, 9, 0, 0, 0, 16, 2, 0, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88,
+    63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 63, 88, 255, 9, 0, 31, 0, 0, 0, 24, 2, 0,
+    57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82, 57, 82,
+    57, 255, 31, 0, 23, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 0, 1, 0, 61, 86, 61, 61, 61,
+    61, 61, 86, 61, 61, 61, 86, 61, 61, 86, 254, 255, 0, 0, 0, 2, 0, 86, 61, 86, 61, 86, 61, 86, 255, 23, 0, 0, 0, 0,
+    0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 8, 1, 0, 67, 92, 67, 67, 67, 67, 67, 92, 67, 67, 67, 92,
+    67, 67, 92, 254, 0, 1, 0, 8, 2, 0, 67, 92, 67, 92, 67, 92, 67, 255, 0, 0, 9, 0, 0, 0, 16, 0, 0, 63, 63, 63,
+    63, 63, 63, 63, 254, 1, 0, 0, 16, 1, 0, 63, 88, 63, 63, 63, 63, 63, 88, 63, 63, 63, 88, 63, 63, 88, 254, 1, 0, 0,
+    16, 2, 0, 63, 88, 63, 88, 63, 88, 63, 255, 9, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255,
+    0, 24, 1, 0, 57, 82, 57, 57, 57, 57, 57, 82, 57, 57, 57, 82, 57, 57, 82, 254, 0, 255, 0, 24, 2, 0, 82, 57, 82, 57,
+    82, 57, 82, 255, 31, 0, 23, 0, 0, 0, 0, 2, 0, 86, 61, 86, 61, 86, 61, 61, 254, 255, 0, 1, 0, 1, 0, 61, 61, 86,
+    61, 61, 86, 61, 61, 61, 86, 61, 61, 61, 254, 255, 0, 0, 0, 0, 0, 61, 86, 61, 61, 61, 61, 61, 61, 61, 255, 23, 0, 0,
+    0, 0, 0, 8, 2, 0, 67, 92, 67, 92, 67, 92, 67, 254, 0, 1, 1, 8, 1, 0, 67, 67, 92, 67, 67, 92, 67, 67, 67, 92,
+    67, 67, 67, 254, 0, 1, 0, 8, 0, 0, 67, 92, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 9, 0, 0, 0, 16, 2, 0, 63,
+    88, 63, 88, 63, 88, 63, 254, 1, 0, 1, 16, 1, 0, 63, 63, 88, 63, 63, 88, 63, 63, 63, 88, 63, 63, 63, 254, 1, 0, 0,
+    16, 0, 0, 63, 88, 63, 63, 63, 63, 63, 63, 63, 255, 9, 0, 31, 0, 0, 0, 24, 2, 0, 82, 57, 82, 57, 82, 57, 57, 254,
+    0, 255, 1, 24, 1, 0, 57, 57, 82, 57, 57, 82, 57, 57, 57, 82, 57, 57, 57, 254, 0, 255, 0, 24, 0, 0, 57, 82, 57, 57,
+    57, 57, 57, 57, 57, 255, 31, 0, 23, 0, 15, 0, 0, 6, 0, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36,
+    61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 61, 36, 255, 23, 0, 0, 0, 15, 0, 8, 6, 0, 67, 42, 67, 42,
+    67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 42, 67, 255, 0, 0,
+    9, 0, 15, 0, 16, 6, 0, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63, 38, 63,
+    38, 63, 38, 63, 38, 63, 38, 63, 255, 9, 0, 31, 0, 15, 0, 24, 6, 0, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57,
+    32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 57, 32, 255, 31, 0, 23, 0, 8, 0, 0, 0, 0, 61,
+    61, 61, 61, 61, 61, 61, 254, 255, 0, 255, 0, 5, 0, 61, 61, 61, 61, 61, 36, 61, 61, 61, 36, 61, 61, 36, 61, 61, 254, 255,
+    0, 255, 0, 6, 0, 61, 36, 61, 36, 61, 36, 61, 255, 23, 0, 0, 0, 8, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 254,
+    0, 1, 255, 8, 5, 0, 67, 67, 67, 67, 67, 42, 67, 67, 67, 42, 67, 67, 42, 67, 67, 254, 0, 1, 255, 8, 6, 0, 67, 67,
+    42, 67, 42, 67, 42, 255, 0, 0, 9, 0, 8, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 255, 16, 5, 0, 63,
+    63, 63, 63, 63, 38, 63, 63, 63, 38, 63, 63, 38, 63, 63, 254, 1, 0, 255, 16, 6, 0, 63, 63, 38, 63, 38, 63, 38, 255, 9,
+    0, 31, 0, 8, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 255, 24, 5, 0, 57, 57, 57, 57, 57, 32, 57, 57,
+    57, 32, 57, 57, 32, 57, 57, 254, 0, 255, 255, 24, 6, 0, 57, 32, 57, 32, 57, 32, 57, 255, 31, 0, 23, 0, 7, 0, 0, 6,
+    0, 61, 36, 61, 36, 61, 36, 61, 254, 255, 0, 0, 0, 5, 0, 36, 61, 61, 36, 61, 61, 61, 36, 61, 61, 61, 61, 61, 254, 255,
+    0, 255, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 23, 0, 0, 0, 8, 0, 8, 6, 0, 42, 67, 42, 67, 42, 67,
+    42, 254, 0, 1, 0, 8, 5, 0, 42, 67, 67, 42, 67, 67, 67, 42, 67, 67, 67, 67, 67, 254, 0, 1, 255, 8, 0, 0, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 9, 0, 8, 0, 16, 6, 0, 38, 63, 38, 63, 38, 63, 38, 254, 1, 0, 0, 16, 5,
+    0, 38, 63, 63, 38, 63, 63, 63, 38, 63, 63, 63, 63, 63, 254, 1, 0, 255, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    255, 9, 0, 31, 0, 7, 0, 24, 6, 0, 57, 32, 57, 32, 57, 32, 57, 254, 0, 255, 0, 24, 5, 0, 32, 57, 57, 32, 57, 57,
+    57, 32, 57, 57, 57, 57, 57, 254, 0, 255, 255, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 255, 31, 0, 23, 0, 0, 0,
+    0, 0, 0, 254, 255, 0, 0, 31, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 56, 61, 61, 61, 61, 61, 61, 254, 255, 255, 0, 30,
+    0, 0, 61, 61, 61, 56, 61, 61, 61, 56, 61, 61, 56, 61, 61, 56, 61, 254, 255, 255, 0, 29, 0, 0, 61, 61, 56, 61, 56, 61,
+    56, 61, 56, 61, 56, 56, 61, 56, 254, 255, 255, 0, 28, 0, 0, 61, 56, 56, 61, 56, 56, 56, 56, 61, 56, 56, 56, 56, 254, 255,
+    255, 0, 27, 0, 0, 56, 56, 56, 57, 56, 56, 56, 56, 57, 56, 56, 57, 254, 255, 255, 0, 26, 0, 0, 56, 57, 56, 56, 57, 56,
+    57, 56, 57, 56, 57, 56, 57, 57, 254, 255, 255, 0, 25, 0, 0, 57, 56, 57, 57, 56, 57, 57, 56, 57, 57, 57, 56, 57, 57, 57,
+    254, 255, 255, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 56, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 23, 0, 0,
+    63, 63, 255, 23, 0, 1, 0, 0, 0, 8, 0, 0, 254, 0, 1, 0, 7, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 66, 67, 67,
+    67, 67, 67, 67, 254, 255, 1, 0, 6, 0, 0, 67, 67, 67, 66, 67, 67, 67, 66, 67, 67, 66, 67, 67, 66, 67, 254, 255, 1, 0,
+    5, 0, 0, 67, 67, 66, 67, 66, 67, 66, 67, 66, 67, 66, 66, 67, 66, 254, 255, 1, 0, 4, 0, 0, 67, 66, 66, 67, 66, 66,
+    66, 66, 67, 66, 66, 66, 66, 254, 255, 1, 0, 3, 0, 0, 66, 66, 66, 61, 66, 66, 66, 66, 61, 66, 66, 61, 254, 255, 1, 0,
+    2, 0, 0, 66, 61, 66, 66, 61, 66, 61, 66, 61, 66, 61, 66, 61, 61, 254, 255, 1, 0, 1, 0, 0, 61, 66, 61, 61, 66, 61,
+    61, 66, 61, 61, 61, 66, 61, 61, 61, 254, 255, 1, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 66, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 254, 255, 0, 0, 31, 0, 0, 57, 57, 255, 1, 0, 9, 0, 0, 0, 16, 0, 0, 254, 1, 0, 0, 15, 0, 0, 63, 63,
+    63, 63, 63, 63, 63, 63, 68, 63, 63, 63, 63, 63, 63, 254, 1, 1, 0, 14, 0, 0, 63, 63, 63, 68, 63, 63, 63, 68, 63, 63,
+    68, 63, 63, 68, 63, 254, 1, 1, 0, 13, 0, 0, 63, 63, 68, 63, 68, 63, 68, 63, 68, 63, 68, 68, 63, 68, 254, 1, 1, 0,
+    12, 0, 0, 63, 68, 68, 63, 68, 68, 68, 68, 63, 68, 68, 68, 68, 254, 1, 1, 0, 11, 0, 0, 68, 68, 68, 67, 68, 68, 68,
+    68, 67, 68, 68, 67, 254, 1, 1, 0, 10, 0, 0, 68, 67, 68, 68, 67, 68, 67, 68, 67, 68, 67, 68, 67, 67, 254, 1, 1, 0,
+    9, 0, 0, 67, 68, 67, 67, 68, 67, 67, 68, 67, 67, 67, 68, 67, 67, 67, 254, 1, 1, 0, 8, 0, 0, 67, 67, 67, 67, 67,
+    67, 68, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 7, 0, 0, 61, 61, 255, 9, 0, 31, 0, 0, 0, 24, 0, 0,
+    254, 0, 255, 0, 23, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 58, 57, 57, 57, 57, 57, 57, 254, 1, 255, 0, 22, 0, 0, 57,
+    57, 57, 58, 57, 57, 57, 58, 57, 57, 58, 57, 57, 58, 57, 254, 1, 255, 0, 21, 0, 0, 57, 57, 58, 57, 58, 57, 58, 57, 58,
+    57, 58, 58, 57, 58, 254, 1, 255, 0, 20, 0, 0, 57, 58, 58, 57, 58, 58, 58, 58, 57, 58, 58, 58, 58, 254, 1, 255, 0, 19,
+    0, 0, 58, 58, 58, 63, 58, 58, 58, 58, 63, 58, 58, 63, 254, 1, 255, 0, 18, 0, 0, 58, 63, 58, 58, 63, 58, 63, 58, 63,
+    58, 63, 58, 63, 63, 254, 1, 255, 0, 17, 0, 0, 63, 58, 63, 63, 58, 63, 63, 58, 63, 63, 63, 58, 63, 63, 63, 254, 1, 255,
+    0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 58, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 15, 0, 0, 67, 67, 255,
+    31, 0, 23, 0, 0, 0, 0, 0, 0, 254, 255, 0, 0, 1, 0, 0, 61, 61, 61, 61, 61, 61, 61, 66, 61, 61, 61, 61, 61, 254,
+    255, 1, 0, 2, 0, 0, 61, 61, 61, 66, 61, 61, 61, 66, 61, 61, 66, 61, 254, 255, 1, 0, 3, 0, 0, 61, 61, 66, 61, 66,
+    61, 66, 66, 61, 66, 61, 66, 254, 255, 1, 0, 4, 0, 0, 61, 66, 66, 66, 61, 66, 66, 66, 66, 66, 254, 255, 1, 0, 5, 0,
+    0, 66, 66, 66, 66, 67, 66, 66, 66, 67, 254, 255, 1, 0, 6, 0, 0, 66, 67, 66, 67, 66, 66, 67, 66, 67, 66, 67, 67, 254,
+    255, 1, 0, 7, 0, 0, 67, 66, 67, 67, 66, 67, 67, 67, 66, 67, 67, 67, 254, 255, 1, 0, 8, 0, 0, 67, 67, 67, 67, 67,
+    66, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 9, 0, 0, 63, 255, 23, 0, 1, 0, 0, 0, 8, 0, 0, 254, 0, 1,
+    0, 9, 0, 0, 67, 67, 67, 67, 67, 67, 67, 68, 67, 67, 67, 67, 67, 254, 1, 1, 0, 10, 0, 0, 67, 67, 67, 68, 67, 67,
+    67, 68, 67, 67, 68, 67, 254, 1, 1, 0, 11, 0, 0, 67, 67, 68, 67, 68, 67, 68, 68, 67, 68, 67, 68, 254, 1, 1, 0, 12,
+    0, 0, 67, 68, 68, 68, 67, 68, 68, 68, 68, 68, 254, 1, 1, 0, 13, 0, 0, 68, 68, 68, 68, 63, 68, 68, 68, 63, 254, 1,
+    1, 0, 14, 0, 0, 68, 63, 68, 63, 68, 68, 63, 68, 63, 68, 63, 63, 254, 1, 1, 0, 15, 0, 0, 63, 68, 63, 63, 68, 63,
+    63, 63, 68, 63, 63, 63, 254, 1, 1, 0, 16, 0, 0, 63, 63, 63, 63, 63, 68, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0,
+    0, 17, 0, 0, 57, 255, 1, 0, 9, 0, 0, 0, 16, 0, 0, 254, 1, 0, 0, 17, 0, 0, 63, 63, 63, 63, 63, 63, 63, 58,
+    63, 63, 63, 63, 63, 254, 1, 255, 0, 18, 0, 0, 63, 63, 63, 58, 63, 63, 63, 58, 63, 63, 58, 63, 254, 1, 255, 0, 19, 0,
+    0, 63, 63, 58, 63, 58, 63, 58, 58, 63, 58, 63, 58, 254, 1, 255, 0, 20, 0, 0, 63, 58, 58, 58, 63, 58, 58, 58, 58, 58,
+    254, 1, 255, 0, 21, 0, 0, 58, 58, 58, 58, 57, 58, 58, 58, 57, 254, 1, 255, 0, 22, 0, 0, 58, 57, 58, 57, 58, 58, 57,
+    58, 57, 58, 57, 57, 254, 1, 255, 0, 23, 0, 0, 57, 58, 57, 57, 58, 57, 57, 57, 58, 57, 57, 57, 254, 1, 255, 0, 24, 0,
+    0, 57, 57, 57, 57, 57, 58, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 25, 0, 0, 61, 255, 9, 0, 31, 0, 0, 0,
+    24, 0, 0, 254, 0, 255, 0, 25, 0, 0, 57, 57, 57, 57, 57, 57, 57, 56, 57, 57, 57, 57, 57, 254, 255, 255, 0, 26, 0, 0,
+    57, 57, 57, 56, 57, 57, 57, 56, 57, 57, 56, 57, 254, 255, 255, 0, 27, 0, 0, 57, 57, 56, 57, 56, 57, 56, 56, 57, 56, 57,
+    56, 254, 255, 255, 0, 28, 0, 0, 57, 56, 56, 56, 57, 56, 56, 56, 56, 56, 254, 255, 255, 0, 29, 0, 0, 56, 56, 56, 56, 61,
+    56, 56, 56, 61, 254, 255, 255, 0, 30, 0, 0, 56, 61, 56, 61, 56, 56, 61, 56, 61, 56, 61, 61, 254, 255, 255, 0, 31, 0, 0,
+    61, 56, 61, 61, 56, 61, 61, 61, 56, 61, 61, 61, 254, 255, 255, 0, 0, 0, 0, 61, 61, 61, 61, 61, 56, 61, 61, 61, 61, 61,
+    61, 61, 61, 254, 255, 0, 0, 1, 0, 0, 67, 255, 31, 0, 23, 0, 0, 0, 0, 2, 0, 254, 255, 0, 1, 31, 2, 0, 61, 86,
+    61, 86, 61, 86, 61, 86, 56, 86, 61, 86, 61, 86, 61, 254, 255, 255, 1, 30, 2, 0, 61, 86, 61, 81, 61, 86, 61, 81, 61, 86,
+    56, 86, 61, 81, 61, 254, 255, 255, 1, 29, 2, 0, 61, 86, 56, 86, 56, 86, 56, 86, 56, 86, 56, 81, 61, 81, 254, 255, 255, 0,
+    28, 2, 0, 86, 56, 81, 61, 81, 56, 81, 56, 86, 56, 81, 56, 81, 254, 255, 255, 0, 27, 2, 0, 81, 81, 56, 82, 56, 81, 56,
+    81, 57, 81, 56, 82, 254, 255, 255, 0, 26, 2, 0, 81, 57, 81, 56, 82, 56, 82, 56, 82, 56, 82, 56, 82, 57, 254, 255, 255, 1,
+    25, 2, 0, 57, 81, 57, 82, 56, 82, 57, 81, 57, 82, 57, 81, 57, 82, 57, 254, 255, 255, 1, 24, 2, 0, 57, 82, 57, 82, 57,
+    82, 56, 82, 57, 82, 57, 82, 57, 82, 57, 82, 254, 0, 255, 0, 23, 2, 0, 88, 63, 255, 23, 0, 1, 0, 0, 0, 8, 2, 0,
+    254, 0, 1, 1, 7, 2, 0, 67, 92, 67, 92, 67, 92, 67, 92, 66, 92, 67, 92, 67, 92, 67, 254, 255, 1, 1, 6, 2, 0, 67,
+    92, 67, 91, 67, 92, 67, 91, 67, 92, 66, 92, 67, 91, 67, 254, 255, 1, 1, 5, 2, 0, 67, 92, 66, 92, 66, 92, 66, 92, 66,
+    92, 66, 91, 67, 91, 254, 255, 1, 0, 4, 2, 0, 92, 66, 91, 67, 91, 66, 91, 66, 92, 66, 91, 66, 91, 254, 255, 1, 0, 3,
+    2, 0, 91, 91, 66, 86, 66, 91, 66, 91, 61, 91, 66, 86, 254, 255, 1, 0, 2, 2, 0, 91, 61, 91, 66, 86, 66, 86, 66, 86,
+    66, 86, 66, 86, 61, 254, 255, 1, 1, 1, 2, 0, 61, 91, 61, 86, 66, 86, 61, 91, 61, 86, 61, 91, 61, 86, 61, 254, 255, 1,
+    1, 0, 2, 0, 61, 86, 61, 86, 61, 86, 66, 86, 61, 86, 61, 86, 61, 86, 61, 86, 254, 255, 0, 0, 31, 2, 0, 82, 57, 255,
+    1, 0, 9, 0, 0, 0, 16, 2, 0, 254, 1, 0, 1, 15, 2, 0, 63, 88, 63, 88, 63, 88, 63, 88, 68, 88, 63, 88, 63, 88,
+    63, 254, 1, 1, 1, 14, 2, 0, 63, 88, 63, 93, 63, 88, 63, 93, 63, 88, 68, 88, 63, 93, 63, 254, 1, 1, 1, 13, 2, 0,
+    63, 88, 68, 88, 68, 88, 68, 88, 68, 88, 68, 93, 63, 93, 254, 1, 1, 0, 12, 2, 0, 88, 68, 93, 63, 93, 68, 93, 68, 88,
+    68, 93, 68, 93, 254, 1, 1, 0, 11, 2, 0, 93, 93, 68, 92, 68, 93, 68, 93, 67, 93, 68, 92, 254, 1, 1, 0, 10, 2, 0,
+    93, 67, 93, 68, 92, 68, 92, 68, 92, 68, 92, 68, 92, 67, 254, 1, 1, 1, 9, 2, 0, 67, 93, 67, 92, 68, 92, 67, 93, 67,
+    92, 67, 93, 67, 92, 67, 254, 1, 1, 1, 8, 2, 0, 67, 92, 67, 92, 67, 92, 68, 92, 67, 92, 67, 92, 67, 92, 67, 92, 254,
+    0, 1, 0, 7, 2, 0, 86, 61, 255, 9, 0, 31, 0, 0, 0, 24, 2, 0, 254, 0, 255, 1, 23, 2, 0, 57, 82, 57, 82, 57,
+    82, 57, 82, 58, 82, 57, 82, 57, 82, 57, 254, 1, 255, 1, 22, 2, 0, 57, 82, 57, 83, 57, 82, 57, 83, 57, 82, 58, 82, 57,
+    83, 57, 254, 1, 255, 1, 21, 2, 0, 57, 82, 58, 82, 58, 82, 58, 82, 58, 82, 58, 83, 57, 83, 254, 1, 255, 0, 20, 2, 0,
+    82, 58, 83, 57, 83, 58, 83, 58, 82, 58, 83, 58, 83, 254, 1, 255, 0, 19, 2, 0, 83, 83, 58, 88, 58, 83, 58, 83, 63, 83,
+    58, 88, 254, 1, 255, 0, 18, 2, 0, 83, 63, 83, 58, 88, 58, 88, 58, 88, 58, 88, 58, 88, 63, 254, 1, 255, 1, 17, 2, 0,
+    63, 83, 63, 88, 58, 88, 63, 83, 63, 88, 63, 83, 63, 88, 63, 254, 1, 255, 1, 16, 2, 0, 63, 88, 63, 88, 63, 88, 58, 88,
+    63, 88, 63, 88, 63, 88, 63, 88, 254, 1, 0, 0, 15, 2, 0, 92, 67, 255, 31, 0, 23, 0, 0, 0, 0, 2, 0, 254, 255, 0,
+    1, 1, 2, 0, 61, 86, 61, 86, 86, 61, 86, 66, 86, 86, 61, 86, 86, 254, 255, 1, 0, 2, 2, 0, 86, 61, 86, 91, 61, 86,
+    61, 91, 86, 61, 91, 61, 254, 255, 1, 1, 3, 2, 0, 86, 61, 91, 86, 66, 86, 66, 91, 86, 66, 86, 66, 254, 255, 1, 1, 4,
+    2, 0, 86, 66, 91, 66, 86, 91, 66, 91, 66, 91, 254, 255, 1, 1, 5, 2, 0, 66, 91, 91, 66, 92, 66, 91, 91, 67, 254, 255,
+    1, 1, 6, 2, 0, 66, 92, 91, 67, 91, 66, 92, 91, 67, 91, 67, 92, 254, 255, 1, 1, 7, 2, 0, 67, 91, 92, 67, 91, 67,
+    92, 92, 66, 92, 67, 92, 254, 255, 1, 1, 8, 2, 0, 67, 92, 67, 92, 92, 66, 92, 92, 67, 92, 67, 92, 92, 67, 254, 0, 1,
+    1, 9, 2, 0, 63, 255, 23, 0, 1, 0, 0, 0, 8, 2, 0, 254, 0, 1, 1, 9, 2, 0, 67, 92, 67, 92, 92, 67, 92, 68,
+    92, 92, 67, 92, 92, 254, 1, 1, 0, 10, 2, 0, 92, 67, 92, 93, 67, 92, 67, 93, 92, 67, 93, 67, 254, 1, 1, 1, 11, 2,
+    0, 92, 67, 93, 92, 68, 92, 68, 93, 92, 68, 92, 68, 254, 1, 1, 1, 12, 2, 0, 92, 68, 93, 68, 92, 93, 68, 93, 68, 93,
+    254, 1, 1, 1, 13, 2, 0, 68, 93, 93, 68, 88, 68, 93, 93, 63, 254, 1, 1, 1, 14, 2, 0, 68, 88, 93, 63, 93, 68, 88,
+    93, 63, 93, 63, 88, 254, 1, 1, 1, 15, 2, 0, 63, 93, 88, 63, 93, 63, 88, 88, 68, 88, 63, 88, 254, 1, 1, 1, 16, 2,
+    0, 63, 88, 63, 88, 88, 68, 88, 88, 63, 88, 63, 88, 88, 63, 254, 1, 0, 1, 17, 2, 0, 57, 255, 1, 0, 9, 0, 0, 0,
+    16, 2, 0, 254, 1, 0, 1, 17, 2, 0, 63, 88, 63, 88, 88, 63, 88, 58, 88, 88, 63, 88, 88, 254, 1, 255, 0, 18, 2, 0,
+    88, 63, 88, 83, 63, 88, 63, 83, 88, 63, 83, 63, 254, 1, 255, 1, 19, 2, 0, 88, 63, 83, 88, 58, 88, 58, 83, 88, 58, 88,
+    58, 254, 1, 255, 1, 20, 2, 0, 88, 58, 83, 58, 88, 83, 58, 83, 58, 83, 254, 1, 255, 1, 21, 2, 0, 58, 83, 83, 58, 82,
+    58, 83, 83, 57, 254, 1, 255, 1, 22, 2, 0, 58, 82, 83, 57, 83, 58, 82, 83, 57, 83, 57, 82, 254, 1, 255, 1, 23, 2, 0,
+    57, 83, 82, 57, 83, 57, 82, 82, 58, 82, 57, 82, 254, 1, 255, 1, 24, 2, 0, 57, 82, 57, 82, 82, 58, 82, 82, 57, 82, 57,
+    82, 82, 57, 254, 0, 255, 1, 25, 2, 0, 61, 255, 9, 0, 31, 0, 0, 0, 24, 2, 0, 254, 0, 255, 1, 25, 2, 0, 57, 82,
+    57, 82, 82, 57, 82, 56, 82, 82, 57, 82, 82, 254, 255, 255, 0, 26, 2, 0, 82, 57, 82, 81, 57, 82, 57, 81, 82, 57, 81, 57,
+    254, 255, 255, 1, 27, 2, 0, 82, 57, 81, 82, 56, 82, 56, 81, 82, 56, 82, 56, 254, 255, 255, 1, 28, 2, 0, 82, 56, 81, 56,
+    82, 81, 56, 81, 56, 81, 254, 255, 255, 1, 29, 2, 0, 56, 81, 81, 56, 86, 56, 81, 81, 61, 254, 255, 255, 1, 30, 2, 0, 56,
+    86, 81, 61, 81, 56, 86, 81, 61, 81, 61, 86, 254, 255, 255, 1, 31, 2, 0, 61, 81, 86, 61, 81, 61, 86, 86, 56, 86, 61, 86,
+    254, 255, 255, 1, 0, 2, 0, 61, 86, 61, 86, 86, 56, 86, 86, 61, 86, 61, 86, 86, 61, 254, 255, 0, 1, 1, 2, 0, 67, 255,
+    31, 0, 23, 0, 15, 0, 0, 6, 0, 254, 255, 0, 255, 31, 6, 0, 61, 36, 61, 36, 61, 36, 61, 36, 56, 36, 61, 36, 61, 36,
+    61, 254, 255, 255, 255, 30, 6, 0, 61, 36, 61, 31, 61, 36, 61, 31, 61, 36, 56, 36, 61, 31, 61, 254, 255, 255, 255, 29, 6, 0,
+    61, 36, 56, 36, 56, 36, 56, 36, 56, 36, 56, 31, 61, 31, 254, 255, 255, 0, 28, 6, 0, 36, 56, 31, 61, 31, 56, 31, 56, 36,
+    56, 31, 56, 31, 254, 255, 255, 0, 27, 6, 0, 31, 31, 56, 32, 56, 31, 56, 31, 57, 31, 56, 32, 254, 255, 255, 0, 26, 6, 0,
+    31, 57, 31, 56, 32, 56, 32, 56, 32, 56, 32, 56, 32, 57, 254, 255, 255, 255, 25, 6, 0, 57, 31, 57, 32, 56, 32, 57, 31, 57,
+    32, 57, 31, 57, 32, 57, 254, 255, 255, 255, 24, 6, 0, 57, 32, 57, 32, 57, 32, 56, 32, 57, 32, 57, 32, 57, 32, 57, 32, 254,
+    0, 255, 0, 23, 6, 0, 38, 63, 255, 23, 0, 1, 0, 15, 0, 8, 6, 0, 254, 0, 1, 255, 7, 6, 0, 67, 42, 67, 42, 67,
+    42, 67, 42, 66, 42, 67, 42, 67, 42, 67, 254, 255, 1, 255, 6, 6, 0, 67, 42, 67, 41, 67, 42, 67, 41, 67, 42, 66, 42, 67,
+    41, 67, 254, 255, 1, 255, 5, 6, 0, 67, 42, 66, 42, 66, 42, 66, 42, 66, 42, 66, 41, 67, 41, 254, 255, 1, 0, 4, 6, 0,
+    42, 66, 41, 67, 41, 66, 41, 66, 42, 66, 41, 66, 41, 254, 255, 1, 0, 3, 6, 0, 41, 41, 66, 36, 66, 41, 66, 41, 61, 41,
+    66, 36, 254, 255, 1, 0, 2, 6, 0, 41, 61, 41, 66, 36, 66, 36, 66, 36, 66, 36, 66, 36, 61, 254, 255, 1, 255, 1, 6, 0,
+    61, 41, 61, 36, 66, 36, 61, 41, 61, 36, 61, 41, 61, 36, 61, 254, 255, 1, 255, 0, 6, 0, 61, 36, 61, 36, 61, 36, 66, 36,
+    61, 36, 61, 36, 61, 36, 61, 36, 254, 255, 0, 0, 31, 6, 0, 32, 57, 255, 1, 0, 9, 0, 15, 0, 16, 6, 0, 254, 1, 0,
+    255, 15, 6, 0, 63, 38, 63, 38, 63, 38, 63, 38, 68, 38, 63, 38, 63, 38, 63, 254, 1, 1, 255, 14, 6, 0, 63, 38, 63, 43,
+    63, 38, 63, 43, 63, 38, 68, 38, 63, 43, 63, 254, 1, 1, 255, 13, 6, 0, 63, 38, 68, 38, 68, 38, 68, 38, 68, 38, 68, 43,
+    63, 43, 254, 1, 1, 0, 12, 6, 0, 38, 68, 43, 63, 43, 68, 43, 68, 38, 68, 43, 68, 43, 254, 1, 1, 0, 11, 6, 0, 43,
+    43, 68, 42, 68, 43, 68, 43, 67, 43, 68, 42, 254, 1, 1, 0, 10, 6, 0, 43, 67, 43, 68, 42, 68, 42, 68, 42, 68, 42, 68,
+    42, 67, 254, 1, 1, 255, 9, 6, 0, 67, 43, 67, 42, 68, 42, 67, 43, 67, 42, 67, 43, 67, 42, 67, 254, 1, 1, 255, 8, 6,
+    0, 67, 42, 67, 42, 67, 42, 68, 42, 67, 42, 67, 42, 67, 42, 67, 42, 254, 0, 1, 0, 7, 6, 0, 36, 61, 255, 9, 0, 31,
+    0, 15, 0, 24, 6, 0, 254, 0, 255, 255, 23, 6, 0, 57, 32, 57, 32, 57, 32, 57, 32, 58, 32, 57, 32, 57, 32, 57, 254, 1,
+    255, 255, 22, 6, 0, 57, 32, 57, 33, 57, 32, 57, 33, 57, 32, 58, 32, 57, 33, 57, 254, 1, 255, 255, 21, 6, 0, 57, 32, 58,
+    32, 58, 32, 58, 32, 58, 32, 58, 33, 57, 33, 254, 1, 255, 0, 20, 6, 0, 32, 58, 33, 57, 33, 58, 33, 58, 32, 58, 33, 58,
+    33, 254, 1, 255, 0, 19, 6, 0, 33, 33, 58, 38, 58, 33, 58, 33, 63, 33, 58, 38, 254, 1, 255, 0, 18, 6, 0, 33, 63, 33,
+    58, 38, 58, 38, 58, 38, 58, 38, 58, 38, 63, 254, 1, 255, 255, 17, 6, 0, 63, 33, 63, 38, 58, 38, 63, 33, 63, 38, 63, 33,
+    63, 38, 63, 254, 1, 255, 255, 16, 6, 0, 63, 38, 63, 38, 63, 38, 58, 38, 63, 38, 63, 38, 63, 38, 63, 38, 254, 1, 0, 0,
+    15, 6, 0, 42, 67, 255, 31, 0, 23, 0, 15, 0, 0, 6, 0, 254, 255, 0, 255, 1, 6, 0, 61, 36, 61, 36, 36, 61, 36, 66,
+    36, 36, 61, 36, 36, 254, 255, 1, 0, 2, 6, 0, 36, 61, 36, 41, 61, 36, 61, 41, 36, 61, 41, 61, 254, 255, 1, 255, 3, 6,
+    0, 36, 61, 41, 36, 66, 36, 66, 41, 36, 66, 36, 66, 254, 255, 1, 255, 4, 6, 0, 36, 66, 41, 66, 36, 41, 66, 41, 66, 41,
+    254, 255, 1, 255, 5, 6, 0, 66, 41, 41, 66, 42, 66, 41, 41, 67, 254, 255, 1, 255, 6, 6, 0, 66, 42, 41, 67, 41, 66, 42,
+    41, 67, 41, 67, 42, 254, 255, 1, 255, 7, 6, 0, 67, 41, 42, 67, 41, 67, 42, 42, 66, 42, 67, 42, 254, 255, 1, 255, 8, 6,
+    0, 67, 42, 67, 42, 42, 66, 42, 42, 67, 42, 67, 42, 42, 67, 254, 0, 1, 255, 9, 6, 0, 63, 255, 23, 0, 1, 0, 15, 0,
+    8, 6, 0, 254, 0, 1, 255, 9, 6, 0, 67, 42, 67, 42, 42, 67, 42, 68, 42, 42, 67, 42, 42, 254, 1, 1, 0, 10, 6, 0,
+    42, 67, 42, 43, 67, 42, 67, 43, 42, 67, 43, 67, 254, 1, 1, 255, 11, 6, 0, 42, 67, 43, 42, 68, 42, 68, 43, 42, 68, 42,
+    68, 254, 1, 1, 255, 12, 6, 0, 42, 68, 43, 68, 42, 43, 68, 43, 68, 43, 254, 1, 1, 255, 13, 6, 0, 68, 43, 43, 68, 38,
+    68, 43, 43, 63, 254, 1, 1, 255, 14, 6, 0, 68, 38, 43, 63, 43, 68, 38, 43, 63, 43, 63, 38, 254, 1, 1, 255, 15, 6, 0,
+    63, 43, 38, 63, 43, 63, 38, 38, 68, 38, 63, 38, 254, 1, 1, 255, 16, 6, 0, 63, 38, 63, 38, 38, 68, 38, 38, 63, 38, 63,
+    38, 38, 63, 254, 1, 0, 255, 17, 6, 0, 57, 255, 1, 0, 9, 0, 15, 0, 16, 6, 0, 254, 1, 0, 255, 17, 6, 0, 63, 38,
+    63, 38, 38, 63, 38, 58, 38, 38, 63, 38, 38, 254, 1, 255, 0, 18, 6, 0, 38, 63, 38, 33, 63, 38, 63, 33, 38, 63, 33, 63,
+    254, 1, 255, 255, 19, 6, 0, 38, 63, 33, 38, 58, 38, 58, 33, 38, 58, 38, 58, 254, 1, 255, 255, 20, 6, 0, 38, 58, 33, 58,
+    38, 33, 58, 33, 58, 33, 254, 1, 255, 255, 21, 6, 0, 58, 33, 33, 58, 32, 58, 33, 33, 57, 254, 1, 255, 255, 22, 6, 0, 58,
+    32, 33, 57, 33, 58, 32, 33, 57, 33, 57, 32, 254, 1, 255, 255, 23, 6, 0, 57, 33, 32, 57, 33, 57, 32, 32, 58, 32, 57, 32,
+    254, 1, 255, 255, 24, 6, 0, 57, 32, 57, 32, 32, 58, 32, 32, 57, 32, 57, 32, 32, 57, 254, 0, 255, 255, 25, 6, 0, 61, 255,
+    9, 0, 31, 0, 15, 0, 24, 6, 0, 254, 0, 255, 255, 25, 6, 0, 57, 32, 57, 32, 32, 57, 32, 56, 32, 32, 57, 32, 32, 254,
+    255, 255, 0, 26, 6, 0, 32, 57, 32, 31, 57, 32, 57, 31, 32, 57, 31, 57, 254, 255, 255, 255, 27, 6, 0, 32, 57, 31, 32, 56,
+    32, 56, 31, 32, 56, 32, 56, 254, 255, 255, 255, 28, 6, 0, 32, 56, 31, 56, 32, 31, 56, 31, 56, 31, 254, 255, 255, 255, 29, 6,
+    0, 56, 31, 31, 56, 36, 56, 31, 31, 61, 254, 255, 255, 255, 30, 6, 0, 56, 36, 31, 61, 31, 56, 36, 31, 61, 31, 61, 36, 254,
+    255, 255, 255, 31, 6, 0, 61, 31, 36, 61, 31, 61, 36, 36, 56, 36, 61, 36, 254, 255, 255, 255, 0, 6, 0, 61, 36, 61, 36, 36,
+    56, 36, 36, 61, 36, 61, 36, 36, 61, 254, 255, 0, 255, 1, 6, 0, 67, 255, 32, 0, 23, 0, 0, 0, 0, 0, 0, 61, 61, 61,
+    61, 61, 61, 61, 61, 254, 255, 0, 0, 31, 0, 0, 56, 61, 61, 61, 61, 61, 61, 56, 61, 61, 61, 56, 61, 61, 61, 254, 255, 255,
+    0, 30, 0, 0, 61, 61, 56, 61, 56, 61, 61, 56, 61, 56, 61, 56, 61, 56, 254, 255, 0, 0, 29, 0, 0, 56, 61, 56, 61, 56,
+    56, 61, 56, 56, 61, 56, 56, 61, 56, 56, 61, 56, 56, 61, 56, 61, 254, 255, 255, 0, 30, 0, 0, 61, 56, 61, 56, 61, 56, 61,
+    61, 56, 61, 61, 56, 61, 254, 255, 0, 0, 31, 0, 0, 56, 61, 61, 61, 56, 61, 61, 61, 61, 61, 56, 254, 255, 0, 0, 0, 0,
+    0, 61, 61, 61, 61, 61, 61, 61, 255, 23, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0,
+    7, 0, 0, 66, 67, 67, 67, 67, 67, 67, 66, 67, 67, 67, 66, 67, 67, 67, 254, 255, 1, 0, 6, 0, 0, 67, 67, 66, 67, 66,
+    67, 67, 66, 67, 66, 67, 66, 67, 66, 254, 0, 1, 0, 5, 0, 0, 66, 67, 66, 67, 66, 66, 67, 66, 66, 67, 66, 66, 67, 66,
+    66, 67, 66, 66, 67, 66, 67, 254, 255, 1, 0, 6, 0, 0, 67, 66, 67, 66, 67, 66, 67, 67, 66, 67, 67, 66, 67, 254, 0, 1,
+    0, 7, 0, 0, 66, 67, 67, 67, 66, 67, 67, 67, 67, 67, 66, 254, 0, 1, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 255,
+    0, 0, 9, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 15, 0, 0, 68, 63, 63, 63, 63, 63,
+    63, 68, 63, 63, 63, 68, 63, 63, 63, 254, 1, 1, 0, 14, 0, 0, 63, 63, 68, 63, 68, 63, 63, 68, 63, 68, 63, 68, 63, 68,
+    254, 1, 0, 0, 13, 0, 0, 68, 63, 68, 63, 68, 68, 63, 68, 68, 63, 68, 68, 63, 68, 68, 63, 68, 68, 63, 68, 63, 254, 1,
+    1, 0, 14, 0, 0, 63, 68, 63, 68, 63, 68, 63, 63, 68, 63, 63, 68, 63, 254, 1, 0, 0, 15, 0, 0, 68, 63, 63, 63, 68,
+    63, 63, 63, 63, 63, 68, 254, 1, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 255, 9, 0, 32, 0, 0, 0, 24, 0, 0,
+    57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 23, 0, 0, 58, 57, 57, 57, 57, 57, 57, 58, 57, 57, 57, 58, 57, 57, 57,
+    254, 1, 255, 0, 22, 0, 0, 57, 57, 58, 57, 58, 57, 57, 58, 57, 58, 57, 58, 57, 58, 254, 0, 255, 0, 21, 0, 0, 58, 57,
+    58, 57, 58, 58, 57, 58, 58, 57, 58, 58, 57, 58, 58, 57, 58, 58, 57, 58, 57, 254, 1, 255, 0, 22, 0, 0, 57, 58, 57, 58,
+    57, 58, 57, 57, 58, 57, 57, 58, 57, 254, 0, 255, 0, 23, 0, 0, 58, 57, 57, 57, 58, 57, 57, 57, 57, 57, 58, 254, 0, 255,
+    0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 255, 32, 0, 23, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 254, 255,
+    0, 0, 1, 0, 0, 66, 61, 61, 61, 61, 61, 66, 61, 61, 61, 66, 254, 255, 0, 0, 2, 0, 0, 61, 66, 61, 61, 66, 61, 61,
+    66, 61, 66, 61, 66, 61, 254, 255, 1, 0, 3, 0, 0, 61, 66, 61, 66, 66, 61, 66, 66, 61, 66, 66, 61, 66, 66, 61, 66, 66,
+    61, 66, 61, 254, 255, 1, 0, 2, 0, 0, 61, 66, 61, 66, 61, 66, 61, 66, 61, 61, 66, 61, 66, 61, 61, 254, 255, 1, 0, 1,
+    0, 0, 61, 61, 61, 66, 61, 61, 61, 66, 61, 61, 61, 61, 61, 61, 66, 254, 255, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61,
+    61, 61, 255, 23, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 9, 0, 0, 68, 67, 67, 67,
+    67, 67, 68, 67, 67, 67, 68, 254, 0, 1, 0, 10, 0, 0, 67, 68, 67, 67, 68, 67, 67, 68, 67, 68, 67, 68, 67, 254, 1, 1,
+    0, 11, 0, 0, 67, 68, 67, 68, 68, 67, 68, 68, 67, 68, 68, 67, 68, 68, 67, 68, 68, 67, 68, 67, 254, 1, 1, 0, 10, 0,
+    0, 67, 68, 67, 68, 67, 68, 67, 68, 67, 67, 68, 67, 68, 67, 67, 254, 1, 1, 0, 9, 0, 0, 67, 67, 67, 68, 67, 67, 67,
+    68, 67, 67, 67, 67, 67, 67, 68, 254, 0, 1, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 255, 0, 0, 9, 0, 0, 0,
+    16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 17, 0, 0, 58, 63, 63, 63, 63, 63, 58, 63, 63, 63, 58, 254, 1,
+    0, 0, 18, 0, 0, 63, 58, 63, 63, 58, 63, 63, 58, 63, 58, 63, 58, 63, 254, 1, 255, 0, 19, 0, 0, 63, 58, 63, 58, 58,
+    63, 58, 58, 63, 58, 58, 63, 58, 58, 63, 58, 58, 63, 58, 63, 254, 1, 255, 0, 18, 0, 0, 63, 58, 63, 58, 63, 58, 63, 58,
+    63, 63, 58, 63, 58, 63, 63, 254, 1, 255, 0, 17, 0, 0, 63, 63, 63, 58, 63, 63, 63, 58, 63, 63, 63, 63, 63, 63, 58, 254,
+    1, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 255, 9, 0, 32, 0, 0, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57,
+    57, 254, 0, 255, 0, 25, 0, 0, 56, 57, 57, 57, 57, 57, 56, 57, 57, 57, 56, 254, 0, 255, 0, 26, 0, 0, 57, 56, 57, 57,
+    56, 57, 57, 56, 57, 56, 57, 56, 57, 254, 255, 255, 0, 27, 0, 0, 57, 56, 57, 56, 56, 57, 56, 56, 57, 56, 56, 57, 56, 56,
+    57, 56, 56, 57, 56, 57, 254, 255, 255, 0, 26, 0, 0, 57, 56, 57, 56, 57, 56, 57, 56, 57, 57, 56, 57, 56, 57, 57, 254, 255,
+    255, 0, 25, 0, 0, 57, 57, 57, 56, 57, 57, 57, 56, 57, 57, 57, 57, 57, 57, 56, 254, 0, 255, 0, 24, 0, 0, 57, 57, 57,
+    57, 57, 57, 57, 57, 255, 31, 0, 23, 0, 0, 0, 0, 0, 0, 254, 255, 0, 0, 31, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 254, 255, 255, 0, 30, 0, 0, 61, 61, 61, 56, 61, 61, 56, 61, 61, 254, 255, 255, 0, 29, 0, 0, 61, 56, 61, 56, 61, 56,
+    61, 56, 61, 254, 255, 255, 0, 28, 0, 0, 56, 56, 61, 56, 56, 56, 56, 254, 255, 255, 0, 27, 0, 0, 56, 56, 56, 56, 57, 56,
+    56, 254, 255, 255, 0, 26, 0, 0, 57, 56, 57, 56, 57, 56, 57, 56, 57, 254, 255, 255, 0, 25, 0, 0, 57, 57, 56, 57, 57, 56,
+    57, 57, 57, 254, 255, 255, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 255, 23, 0, 1, 0, 0, 0, 8, 0, 0,
+    254, 0, 1, 0, 7, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 255, 1, 0, 6, 0, 0, 67, 67, 67, 66, 67, 67, 66,
+    67, 67, 254, 255, 1, 0, 5, 0, 0, 67, 66, 67, 66, 67, 66, 67, 66, 67, 254, 255, 1, 0, 4, 0, 0, 66, 66, 67, 66, 66,
+    66, 66, 254, 255, 1, 0, 3, 0, 0, 66, 66, 66, 66, 61, 66, 66, 254, 255, 1, 0, 2, 0, 0, 61, 66, 61, 66, 61, 66, 61,
+    66, 61, 254, 255, 1, 0, 1, 0, 0, 61, 61, 66, 61, 61, 66, 61, 61, 61, 254, 255, 1, 0, 0, 0, 0, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 255, 1, 0, 9, 0, 0, 0, 16, 0, 0, 254, 1, 0, 0, 15, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 254, 1, 1, 0, 14, 0, 0, 63, 63, 63, 68, 63, 63, 68, 63, 63, 254, 1, 1, 0, 13, 0, 0, 63, 68, 63, 68, 63, 68,
+    63, 68, 63, 254, 1, 1, 0, 12, 0, 0, 68, 68, 63, 68, 68, 68, 68, 254, 1, 1, 0, 11, 0, 0, 68, 68, 68, 68, 67, 68,
+    68, 254, 1, 1, 0, 10, 0, 0, 67, 68, 67, 68, 67, 68, 67, 68, 67, 254, 1, 1, 0, 9, 0, 0, 67, 67, 68, 67, 67, 68,
+    67, 67, 67, 254, 1, 1, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255, 9, 0, 31, 0, 0, 0, 24, 0, 0,
+    254, 0, 255, 0, 23, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 1, 255, 0, 22, 0, 0, 57, 57, 57, 58, 57, 57, 58,
+    57, 57, 254, 1, 255, 0, 21, 0, 0, 57, 58, 57, 58, 57, 58, 57, 58, 57, 254, 1, 255, 0, 20, 0, 0, 58, 58, 57, 58, 58,
+    58, 58, 254, 1, 255, 0, 19, 0, 0, 58, 58, 58, 58, 63, 58, 58, 254, 1, 255, 0, 18, 0, 0, 63, 58, 63, 58, 63, 58, 63,
+    58, 63, 254, 1, 255, 0, 17, 0, 0, 63, 63, 58, 63, 63, 58, 63, 63, 63, 254, 1, 255, 0, 16, 0, 0, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 255, 31, 0, 23, 0, 0, 0, 0, 0, 0, 254, 255, 0, 0, 1, 0, 0, 61, 61, 61, 61, 61, 61, 254, 255,
+    0, 0, 2, 0, 0, 66, 61, 61, 61, 66, 61, 61, 254, 255, 1, 0, 3, 0, 0, 61, 66, 61, 66, 61, 66, 254, 255, 1, 0, 4,
+    0, 0, 61, 66, 66, 66, 66, 254, 255, 1, 0, 5, 0, 0, 66, 66, 66, 66, 67, 254, 255, 1, 0, 6, 0, 0, 66, 67, 66, 67,
+    66, 67, 254, 255, 1, 0, 7, 0, 0, 67, 67, 66, 67, 67, 67, 66, 254, 0, 1, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67,
+    255, 23, 0, 1, 0, 0, 0, 8, 0, 0, 254, 0, 1, 0, 9, 0, 0, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 10, 0, 0,
+    68, 67, 67, 67, 68, 67, 67, 254, 1, 1, 0, 11, 0, 0, 67, 68, 67, 68, 67, 68, 254, 1, 1, 0, 12, 0, 0, 67, 68, 68,
+    68, 68, 254, 1, 1, 0, 13, 0, 0, 68, 68, 68, 68, 63, 254, 1, 1, 0, 14, 0, 0, 68, 63, 68, 63, 68, 63, 254, 1, 1,
+    0, 15, 0, 0, 63, 63, 68, 63, 63, 63, 68, 254, 1, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 255, 1, 0, 9, 0,
+    0, 0, 16, 0, 0, 254, 1, 0, 0, 17, 0, 0, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 18, 0, 0, 58, 63, 63, 63, 58,
+    63, 63, 254, 1, 255, 0, 19, 0, 0, 63, 58, 63, 58, 63, 58, 254, 1, 255, 0, 20, 0, 0, 63, 58, 58, 58, 58, 254, 1, 255,
+    0, 21, 0, 0, 58, 58, 58, 58, 57, 254, 1, 255, 0, 22, 0, 0, 58, 57, 58, 57, 58, 57, 254, 1, 255, 0, 23, 0, 0, 57,
+    57, 58, 57, 57, 57, 58, 254, 0, 255, 0, 24, 0, 0, 57, 57, 57, 57, 57, 57, 57, 255, 9, 0, 31, 0, 0, 0, 24, 0, 0,
+    254, 0, 255, 0, 25, 0, 0, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 26, 0, 0, 56, 57, 57, 57, 56, 57, 57, 254, 255, 255,
+    0, 27, 0, 0, 57, 56, 57, 56, 57, 56, 254, 255, 255, 0, 28, 0, 0, 57, 56, 56, 56, 56, 254, 255, 255, 0, 29, 0, 0, 56,
+    56, 56, 56, 61, 254, 255, 255, 0, 30, 0, 0, 56, 61, 56, 61, 254, 4, 2, 0, 30, 0, 0, 56, 61, 56, 61, 56, 61, 254, 255,
+    255, 0, 31, 0, 0, 61, 61, 56, 61, 61, 61, 56, 254, 255, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 255, 31, 0, 23,
+    0, 0, 0, 0, 2, 0, 254, 255, 0, 0, 31, 2, 0, 86, 61, 86, 61, 61, 86, 61, 86, 61, 254, 255, 255, 0, 30, 2, 0, 86,
+    61, 86, 56, 61, 86, 56, 86, 61, 254, 255, 255, 0, 29, 2, 0, 86, 56, 86, 56, 61, 81, 61, 81, 61, 254, 255, 255, 0, 28, 2,
+    0, 81, 56, 86, 56, 56, 81, 56, 254, 255, 255, 1, 27, 2, 0, 56, 56, 81, 56, 57, 81, 56, 254, 255, 255, 1, 26, 2, 0, 57,
+    56, 82, 56, 82, 56, 57, 81, 57, 254, 255, 255, 1, 25, 2, 0, 57, 57, 81, 57, 82, 56, 57, 82, 57, 254, 255, 255, 1, 24, 2,
+    0, 57, 57, 82, 57, 82, 57, 57, 82, 57, 82, 255, 23, 0, 1, 0, 0, 0, 8, 2, 0, 254, 0, 1, 0, 7, 2, 0, 92, 67,
+    92, 67, 67, 92, 67, 92, 67, 254, 255, 1, 0, 6, 2, 0, 92, 67, 92, 66, 67, 92, 66, 92, 67, 254, 255, 1, 0, 5, 2, 0,
+    92, 66, 92, 66, 67, 91, 67, 91, 67, 254, 255, 1, 0, 4, 2, 0, 91, 66, 92, 66, 66, 91, 66, 254, 255, 1, 1, 3, 2, 0,
+    66, 66, 91, 66, 61, 91, 66, 254, 255, 1, 1, 2, 2, 0, 61, 66, 86, 66, 86, 66, 61, 91, 61, 254, 255, 1, 1, 1, 2, 0,
+    61, 61, 91, 61, 86, 66, 61, 86, 61, 254, 255, 1, 1, 0, 2, 0, 61, 61, 86, 61, 86, 61, 61, 86, 61, 86, 255, 1, 0, 9,
+    0, 0, 0, 16, 2, 0, 254, 1, 0, 0, 15, 2, 0, 88, 63, 88, 63, 63, 88, 63, 88, 63, 254, 1, 1, 0, 14, 2, 0, 88,
+    63, 88, 68, 63, 88, 68, 88, 63, 254, 1, 1, 0, 13, 2, 0, 88, 68, 88, 68, 63, 93, 63, 93, 63, 254, 1, 1, 0, 12, 2,
+    0, 93, 68, 88, 68, 68, 93, 68, 254, 1, 1, 1, 11, 2, 0, 68, 68, 93, 68, 67, 93, 68, 254, 1, 1, 1, 10, 2, 0, 67,
+    68, 92, 68, 92, 68, 67, 93, 67, 254, 1, 1, 1, 9, 2, 0, 67, 67, 93, 67, 92, 68, 67, 92, 67, 254, 1, 1, 1, 8, 2,
+    0, 67, 67, 92, 67, 92, 67, 67, 92, 67, 92, 255, 9, 0, 31, 0, 0, 0, 24, 2, 0, 254, 0, 255, 0, 23, 2, 0, 82, 57,
+    82, 57, 57, 82, 57, 82, 57, 254, 1, 255, 0, 22, 2, 0, 82, 57, 82, 58, 57, 82, 58, 82, 57, 254, 1, 255, 0, 21, 2, 0,
+    82, 58, 82, 58, 57, 83, 57, 83, 57, 254, 1, 255, 0, 20, 2, 0, 83, 58, 82, 58, 58, 83, 58, 254, 1, 255, 1, 19, 2, 0,
+    58, 58, 83, 58, 63, 83, 58, 254, 1, 255, 1, 18, 2, 0, 63, 58, 88, 58, 88, 58, 63, 83, 63, 254, 1, 255, 1, 17, 2, 0,
+    63, 63, 83, 63, 88, 58, 63, 88, 63, 254, 1, 255, 1, 16, 2, 0, 63, 63, 88, 63, 88, 63, 63, 88, 63, 88, 255, 31, 0, 23,
+    0, 0, 0, 0, 2, 0, 254, 255, 0, 1, 1, 2, 0, 61, 86, 61, 86, 61, 86, 254, 255, 0, 0, 2, 2, 0, 91, 61, 86, 61,
+    91, 61, 86, 254, 255, 1, 1, 3, 2, 0, 61, 91, 61, 91, 61, 91, 254, 255, 1, 0, 4, 2, 0, 86, 66, 91, 66, 91, 254, 255,
+    1, 1, 5, 2, 0, 66, 91, 66, 91, 67, 254, 255, 1, 1, 6, 2, 0, 66, 92, 66, 92, 66, 92, 254, 255, 1, 0, 7, 2, 0,
+    92, 92, 66, 92, 67, 92, 66, 254, 0, 1, 1, 8, 2, 0, 67, 92, 67, 92, 67, 92, 67, 255, 23, 0, 1, 0, 0, 0, 8, 2,
+    0, 254, 0, 1, 1, 9, 2, 0, 67, 92, 67, 92, 67, 92, 254, 0, 1, 0, 10, 2, 0, 93, 67, 92, 67, 93, 67, 92, 254, 1,
+    1, 1, 11, 2, 0, 67, 93, 67, 93, 67, 93, 254, 1, 1, 0, 12, 2, 0, 92, 68, 93, 68, 93, 254, 1, 1, 1, 13, 2, 0,
+    68, 93, 68, 93, 63, 254, 1, 1, 1, 14, 2, 0, 68, 88, 68, 88, 68, 88, 254, 1, 1, 0, 15, 2, 0, 88, 88, 68, 88, 63,
+    88, 68, 254, 1, 0, 1, 16, 2, 0, 63, 88, 63, 88, 63, 88, 63, 255, 1, 0, 9, 0, 0, 0, 16, 2, 0, 254, 1, 0, 1,
+    17, 2, 0, 63, 88, 63, 88, 63, 88, 254, 1, 0, 0, 18, 2, 0, 83, 63, 88, 63, 83, 63, 88, 254, 1, 255, 1, 19, 2, 0,
+    63, 83, 63, 83, 63, 83, 254, 1, 255, 0, 20, 2, 0, 88, 58, 83, 58, 83, 254, 1, 255, 1, 21, 2, 0, 58, 83, 58, 83, 57,
+    254, 1, 255, 1, 22, 2, 0, 58, 82, 58, 82, 58, 82, 254, 1, 255, 0, 23, 2, 0, 82, 82, 58, 82, 57, 82, 58, 254, 0, 255,
+    1, 24, 2, 0, 57, 82, 57, 82, 57, 82, 57, 255, 9, 0, 31, 0, 0, 0, 24, 2, 0, 254, 0, 255, 1, 25, 2, 0, 57, 82,
+    57, 82, 57, 82, 254, 0, 255, 0, 26, 2, 0, 81, 57, 82, 57, 81, 57, 82, 254, 255, 255, 1, 27, 2, 0, 57, 81, 57, 81, 57,
+    81, 254, 255, 255, 0, 28, 2, 0, 82, 56, 81, 56, 81, 254, 255, 255, 1, 29, 2, 0, 56, 81, 56, 81, 61, 254, 255, 255, 1, 30,
+    2, 0, 56, 86, 56, 86, 56, 86, 254, 255, 255, 0, 31, 2, 0, 86, 86, 56, 86, 61, 86, 56, 254, 255, 0, 1, 0, 2, 0, 61,
+    86, 61, 86, 61, 86, 61, 255, 31, 0, 23, 0, 15, 0, 0, 6, 0, 254, 255, 0, 0, 31, 6, 0, 36, 61, 36, 61, 61, 36, 61,
+    36, 61, 254, 255, 255, 255, 30, 6, 0, 61, 61, 36, 56, 36, 61, 56, 36, 61, 254, 255, 255, 255, 29, 6, 0, 61, 56, 36, 56, 36,
+    56, 61, 31, 61, 254, 255, 255, 255, 28, 6, 0, 56, 31, 61, 56, 31, 56, 31, 254, 255, 255, 0, 27, 6, 0, 56, 31, 56, 31, 57,
+    56, 31, 254, 255, 255, 0, 26, 6, 0, 32, 56, 32, 56, 57, 31, 57, 31, 57, 254, 255, 255, 0, 25, 6, 0, 32, 57, 31, 57, 57,
+    31, 57, 32, 57, 254, 255, 255, 0, 24, 6, 0, 32, 57, 32, 57, 32, 57, 57, 32, 57, 32, 255, 23, 0, 1, 0, 15, 0, 8, 6,
+    0, 254, 0, 1, 0, 7, 6, 0, 42, 67, 42, 67, 67, 42, 67, 42, 67, 254, 255, 1, 255, 6, 6, 0, 67, 67, 42, 66, 42, 67,
+    66, 42, 67, 254, 255, 1, 255, 5, 6, 0, 67, 66, 42, 66, 42, 66, 67, 41, 67, 254, 255, 1, 255, 4, 6, 0, 66, 41, 67, 66,
+    41, 66, 41, 254, 255, 1, 0, 3, 6, 0, 66, 41, 66, 41, 61, 66, 41, 254, 255, 1, 0, 2, 6, 0, 36, 66, 36, 66, 61, 41,
+    61, 41, 61, 254, 255, 1, 0, 1, 6, 0, 36, 61, 41, 61, 61, 41, 61, 36, 61, 254, 255, 1, 0, 0, 6, 0, 36, 61, 36, 61,
+    36, 61, 61, 36, 61, 36, 255, 1, 0, 9, 0, 15, 0, 16, 6, 0, 254, 1, 0, 0, 15, 6, 0, 38, 63, 38, 63, 63, 38, 63,
+    38, 63, 254, 1, 1, 255, 14, 6, 0, 63, 63, 38, 68, 38, 63, 68, 38, 63, 254, 1, 1, 255, 13, 6, 0, 63, 68, 38, 68, 38,
+    68, 63, 43, 63, 254, 1, 1, 255, 12, 6, 0, 68, 43, 63, 68, 43, 68, 43, 254, 1, 1, 0, 11, 6, 0, 68, 43, 68, 43, 67,
+    68, 43, 254, 1, 1, 0, 10, 6, 0, 42, 68, 42, 68, 67, 43, 67, 43, 67, 254, 1, 1, 0, 9, 6, 0, 42, 67, 43, 67, 67,
+    43, 67, 42, 67, 254, 1, 1, 0, 8, 6, 0, 42, 67, 42, 67, 42, 67, 67, 42, 67, 42, 255, 9, 0, 31, 0, 15, 0, 24, 6,
+    0, 254, 0, 255, 0, 23, 6, 0, 32, 57, 32, 57, 57, 32, 57, 32, 57, 254, 1, 255, 255, 22, 6, 0, 57, 57, 32, 58, 32, 57,
+    58, 32, 57, 254, 1, 255, 255, 21, 6, 0, 57, 58, 32, 58, 32, 58, 57, 33, 57, 254, 1, 255, 255, 20, 6, 0, 58, 33, 57, 58,
+    33, 58, 33, 254, 1, 255, 0, 19, 6, 0, 58, 33, 58, 33, 63, 58, 33, 254, 1, 255, 0, 18, 6, 0, 38, 58, 38, 58, 63, 33,
+    63, 33, 63, 254, 1, 255, 0, 17, 6, 0, 38, 63, 33, 63, 63, 33, 63, 38, 63, 254, 1, 255, 0, 16, 6, 0, 38, 63, 38, 63,
+    38, 63, 63, 38, 63, 38, 255, 31, 0, 23, 0, 15, 0, 0, 6, 0, 254, 255, 0, 255, 1, 6, 0, 61, 36, 61, 36, 61, 36, 254,
+    255, 0, 0, 2, 6, 0, 41, 36, 61, 36, 66, 36, 61, 254, 255, 1, 255, 3, 6, 0, 61, 41, 61, 41, 36, 66, 254, 255, 1, 255,
+    4, 6, 0, 61, 41, 66, 41, 66, 254, 255, 1, 255, 5, 6, 0, 41, 66, 41, 66, 42, 254, 255, 1, 0, 6, 6, 0, 41, 67, 41,
+    42, 66, 42, 254, 255, 1, 0, 7, 6, 0, 42, 67, 41, 67, 42, 67, 41, 254, 0, 1, 255, 8, 6, 0, 67, 42, 67, 42, 67, 42,
+    67, 255, 23, 0, 1, 0, 15, 0, 8, 6, 0, 254, 0, 1, 255, 9, 6, 0, 67, 42, 67, 42, 67, 42, 254, 0, 1, 0, 10, 6,
+    0, 43, 42, 67, 42, 68, 42, 67, 254, 1, 1, 255, 11, 6, 0, 67, 43, 67, 43, 42, 68, 254, 1, 1, 255, 12, 6, 0, 67, 43,
+    68, 43, 68, 254, 1, 1, 255, 13, 6, 0, 43, 68, 43, 68, 38, 254, 1, 1, 0, 14, 6, 0, 43, 63, 43, 38, 68, 38, 254, 1,
+    1, 0, 15, 6, 0, 38, 63, 43, 63, 38, 63, 43, 254, 1, 0, 255, 16, 6, 0, 63, 38, 63, 38, 63, 38, 63, 255, 1, 0, 9,
+    0, 15, 0, 16, 6, 0, 254, 1, 0, 255, 17, 6, 0, 63, 38, 63, 38, 63, 38, 254, 1, 0, 0, 18, 6, 0, 33, 38, 63, 38,
+    58, 38, 63, 254, 1, 255, 255, 19, 6, 0, 63, 33, 63, 33, 38, 58, 254, 1, 255, 255, 20, 6, 0, 63, 33, 58, 33, 58, 254, 1,
+    255, 255, 21, 6, 0, 33, 58, 33, 58, 32, 254, 1, 255, 0, 22, 6, 0, 33, 57, 33, 32, 58, 32, 254, 1, 255, 0, 23, 6, 0,
+    32, 57, 33, 57, 32, 57, 33, 254, 0, 255, 255, 24, 6, 0, 57, 32, 57, 32, 57, 32, 57, 255, 9, 0, 31, 0, 15, 0, 24, 6,
+    0, 254, 0, 255, 255, 25, 6, 0, 57, 32, 57, 32, 57, 32, 254, 0, 255, 0, 26, 6, 0, 31, 32, 57, 32, 56, 32, 57, 254, 255,
+    255, 255, 27, 6, 0, 57, 31, 57, 31, 32, 56, 254, 255, 255, 255, 28, 6, 0, 57, 31, 56, 31, 56, 254, 255, 255, 255, 29, 6, 0,
+    31, 56, 31, 56, 36, 254, 255, 255, 0, 30, 6, 0, 31, 61, 31, 36, 56, 36, 254, 255, 255, 0, 31, 6, 0, 36, 61, 31, 61, 36,
+    61, 31, 254, 255, 0, 255, 0, 6, 0, 61, 36, 61, 36, 61, 36, 61, 255, 31, 0, 23, 0, 0, 0, 0, 0, 0, 61, 61, 254, 255,
+    0, 0, 31, 0, 0, 61, 56, 61, 254, 255, 0, 0, 30, 0, 0, 56, 61, 61, 254, 255, 255, 0, 29, 0, 0, 61, 56, 56, 254, 255,
+    255, 0, 28, 0, 0, 56, 254, 255, 255, 0, 27, 0, 0, 56, 56, 57, 254, 255, 255, 0, 26, 0, 0, 57, 57, 56, 254, 0, 255, 0,
+    25, 0, 0, 57, 56, 57, 254, 0, 255, 0, 24, 0, 0, 57, 57, 57, 255, 23, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 254,
+    0, 1, 0, 7, 0, 0, 67, 66, 67, 254, 0, 1, 0, 6, 0, 0, 66, 67, 67, 254, 255, 1, 0, 5, 0, 0, 67, 66, 66, 254,
+    255, 1, 0, 4, 0, 0, 66, 254, 255, 1, 0, 3, 0, 0, 66, 66, 61, 254, 255, 1, 0, 2, 0, 0, 61, 61, 66, 254, 255, 0,
+    0, 1, 0, 0, 61, 66, 61, 254, 255, 0, 0, 0, 0, 0, 61, 61, 61, 255, 0, 0, 9, 0, 0, 0, 16, 0, 0, 63, 63, 63,
+    254, 1, 0, 0, 15, 0, 0, 68, 63, 63, 254, 1, 1, 0, 14, 0, 0, 63, 63, 68, 254, 1, 0, 0, 13, 0, 0, 68, 68, 68,
+    254, 1, 1, 0, 12, 0, 0, 68, 254, 1, 1, 0, 11, 0, 0, 68, 68, 67, 254, 1, 1, 0, 10, 0, 0, 67, 67, 68, 254, 0,
+    1, 0, 9, 0, 0, 67, 68, 67, 254, 0, 1, 0, 8, 0, 0, 67, 255, 9, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 254, 0,
+    255, 0, 23, 0, 0, 57, 58, 57, 254, 0, 255, 0, 22, 0, 0, 58, 57, 57, 254, 1, 255, 0, 21, 0, 0, 57, 58, 58, 254, 1,
+    255, 0, 20, 0, 0, 58, 254, 1, 255, 0, 19, 0, 0, 58, 58, 63, 254, 1, 255, 0, 18, 0, 0, 63, 63, 58, 254, 1, 0, 0,
+    17, 0, 0, 63, 58, 63, 254, 1, 0, 0, 16, 0, 0, 63, 63, 255, 31, 0, 23, 0, 0, 0, 0, 0, 0, 254, 255, 0, 0, 1,
+    0, 0, 61, 254, 255, 1, 0, 2, 0, 0, 61, 254, 255, 1, 0, 4, 0, 0, 66, 254, 255, 1, 0, 6, 0, 0, 67, 254, 255, 1,
+    0, 7, 0, 0, 67, 254, 0, 1, 0, 8, 0, 0, 255, 23, 0, 0, 0, 0, 0, 8, 0, 0, 67, 254, 0, 1, 0, 9, 0, 0,
+    67, 254, 1, 1, 0, 10, 0, 0, 67, 254, 1, 1, 0, 12, 0, 0, 68, 254, 1, 1, 0, 14, 0, 0, 63, 254, 1, 1, 0, 15,
+    0, 0, 63, 254, 1, 0, 0, 16, 0, 0, 255, 0, 0, 9, 0, 0, 0, 16, 0, 0, 63, 254, 1, 0, 0, 17, 0, 0, 63, 254,
+    1, 255, 0, 18, 0, 0, 63, 254, 1, 255, 0, 20, 0, 0, 58, 254, 1, 255, 0, 22, 0, 0, 57, 254, 1, 255, 0, 23, 0, 0,
+    57, 254, 0, 255, 0, 24, 0, 0, 57, 255, 9, 0, 31, 0, 0, 0, 24, 0, 0, 254, 0, 255, 0, 25, 0, 0, 57, 254, 255, 255,
+    0, 26, 0, 0, 57, 254, 255, 255, 0, 28, 0, 0, 56, 254, 255, 255, 0, 30, 0, 0, 61, 254, 255, 255, 0, 31, 0, 0, 61, 254,
+    255, 0, 0, 0, 0, 0, 61, 255, 31, 0, 9, 0, 0, 0, 0, 0, 0, 61, 61, 61, 254, 255, 1, 0, 2, 0, 0, 61, 61, 66,
+    61, 66, 61, 66, 66, 61, 66, 66, 61, 66, 66, 61, 66, 66, 61, 66, 61, 66, 61, 61, 254, 255, 1, 0, 0, 0, 0, 61, 61, 61,
+    255, 9, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 254, 1, 1, 0, 10, 0, 0, 67, 67, 68, 67, 68, 67, 68, 68, 67, 68,
+    68, 67, 68, 68, 67, 68, 68, 67, 68, 67, 68, 67, 67, 254, 1, 1, 0, 8, 0, 0, 67, 67, 67, 255, 0, 0, 23, 0, 0, 0,
+    16, 0, 0, 63, 63, 63, 254, 1, 255, 0, 18, 0, 0, 63, 63, 58, 63, 58, 63, 58, 58, 63, 58, 58, 63, 58, 58, 63, 58, 58,
+    63, 58, 63, 58, 63, 63, 254, 1, 255, 0, 16, 0, 0, 63, 63, 63, 255, 23, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57, 254,
+    255, 255, 0, 26, 0, 0, 57, 57, 56, 57, 56, 57, 56, 56, 57, 56, 56, 57, 56, 56, 57, 56, 56, 57, 56, 57, 56, 57, 57, 254,
+    255, 255, 0, 24, 0, 0, 57, 57, 57, 255, 31, 0, 23, 0, 0, 0, 0, 0, 0, 61, 61, 61, 254, 255, 255, 0, 30, 0, 0, 61,
+    61, 56, 61, 56, 61, 56, 56, 61, 56, 56, 61, 56, 56, 61, 56, 56, 61, 56, 61, 56, 61, 61, 254, 255, 255, 0, 0, 0, 0, 61,
+    61, 61, 255, 23, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67, 254, 255, 1, 0, 6, 0, 0, 67, 67, 66, 67, 66, 67, 66, 66,
+    67, 66, 66, 67, 66, 66, 67, 66, 66, 67, 66, 67, 66, 67, 67, 254, 255, 1, 0, 8, 0, 0, 67, 67, 67, 255, 0, 0, 9, 0,
+    0, 0, 16, 0, 0, 63, 63, 63, 254, 1, 1, 0, 14, 0, 0, 63, 63, 68, 63, 68, 63, 68, 68, 63, 68, 68, 63, 68, 68, 63,
+    68, 68, 63, 68, 63, 68, 63, 63, 254, 1, 1, 0, 16, 0, 0, 63, 63, 63, 255, 9, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57,
+    57, 254, 1, 255, 0, 22, 0, 0, 57, 57, 58, 57, 58, 57, 58, 58, 57, 58, 58, 57, 58, 58, 57, 58, 58, 57, 58, 57, 58, 57,
+    57, 254, 1, 255, 0, 24, 0, 0, 57, 57, 57, 255, 30, 0, 16, 0, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+    72, 255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 255, 16, 0, 30,
+    0, 0, 0, 24, 0, 0, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 255, 30, 0, 16, 0, 1, 0, 0, 0,
+    0, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 255, 16, 0, 0, 0, 1, 0, 8, 0, 0, 97, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 255, 0, 0, 16, 0, 1, 0, 16, 0, 0, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+    89, 89, 89, 89, 89, 89, 255, 16, 0, 30, 0, 1, 0, 24, 0, 0, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    77, 255, 30, 0, 16, 0, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 60, 60, 85, 85, 85, 85, 85, 85, 85, 85, 255, 16, 0, 0,
+    0, 0, 0, 8, 0, 0, 72, 72, 72, 72, 72, 72, 72, 97, 97, 97, 97, 97, 97, 97, 97, 255, 0, 0, 16, 0, 0, 0, 16, 0,
+    0, 64, 64, 64, 64, 64, 64, 64, 89, 89, 89, 89, 89, 89, 89, 89, 255, 16, 0, 30, 0, 0, 0, 24, 0, 0, 52, 52, 52, 52,
+    52, 52, 52, 77, 77, 77, 77, 77, 77, 77, 77, 255, 30, 0, 16, 0, 1, 0, 0, 0, 0, 85, 85, 85, 85, 85, 85, 85, 60, 60,
+    60, 60, 60, 60, 60, 60, 255, 16, 0, 0, 0, 1, 0, 8, 0, 0, 97, 97, 97, 97, 97, 97, 97, 72, 72, 72, 72, 72, 72, 72,
+    72, 255, 0, 0, 16, 0, 1, 0, 16, 0, 0, 89, 89, 89, 89, 89, 89, 89, 64, 64, 64, 64, 64, 64, 64, 64, 255, 16, 0, 30,
+    0, 1, 0, 24, 0, 0, 77, 77, 77, 77, 77, 77, 77, 52, 52, 52, 52, 52, 52, 52, 52, 255, 30, 0, 16, 0, 16, 0, 0, 0,
+    0, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 255, 16, 0, 0, 0, 16, 0, 8, 0, 0, 47, 47, 47, 47,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 255, 0, 0, 16, 0, 16, 0, 16, 0, 0, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 255, 16, 0, 30, 0, 16, 0, 24, 0, 0, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 255, 30, 0, 16, 0, 8, 0, 0, 0, 0, 60, 60, 60, 60, 60, 60, 60, 60, 35, 35, 35, 35, 35, 35, 35, 255, 16, 0, 0,
+    0, 8, 0, 8, 0, 0, 72, 72, 72, 72, 72, 72, 72, 72, 47, 47, 47, 47, 47, 47, 47, 255, 0, 0, 16, 0, 8, 0, 16, 0,
+    0, 64, 64, 64, 64, 64, 64, 64, 64, 39, 39, 39, 39, 39, 39, 39, 255, 16, 0, 30, 0, 8, 0, 24, 0, 0, 52, 52, 52, 52,
+    52, 52, 52, 52, 27, 27, 27, 27, 27, 27, 27, 255, 30, 0, 16, 0, 8, 0, 0, 0, 0, 35, 35, 35, 35, 35, 35, 35, 35, 60,
+    60, 60, 60, 60, 60, 60, 255, 16, 0, 0, 0, 8, 0, 8, 0, 0, 47, 47, 47, 47, 47, 47, 47, 47, 72, 72, 72, 72, 72, 72,
+    72, 255, 0, 0, 16, 0, 8, 0, 16, 0, 0, 39, 39, 39, 39, 39, 39, 39, 39, 64, 64, 64, 64, 64, 64, 64, 255, 16, 0, 30,
+    0, 8, 0, 24, 0, 0, 27, 27, 27, 27, 27, 27, 27, 27, 52, 52, 52, 52, 52, 52, 52, 255, 30, 0, 16, 0, 0, 0, 0, 0,
+    0, 254, 252, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 254, 0, 254, 0, 24, 0, 0, 52, 52, 52, 52, 52, 52, 52, 255, 16, 0,
+    0, 0, 0, 0, 8, 0, 0, 72, 72, 72, 72, 72, 72, 72, 72, 254, 254, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 60, 60, 255,
+    0, 0, 16, 0, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 254, 0, 2, 0, 8, 0, 0, 72, 72, 72, 72, 72, 72,
+    255, 16, 0, 30, 0, 0, 0, 24, 0, 0, 52, 52, 52, 52, 52, 52, 52, 254, 2, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 64,
+    255, 30, 0, 16, 0, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 60, 60, 254, 0, 2, 0, 8, 0, 0, 72, 72, 72, 72, 72, 72,
+    255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 72, 72, 72, 72, 72, 72, 72, 72, 254, 2, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64,
+    64, 255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 254, 0, 254, 0, 24, 0, 0, 52, 52, 52, 52,
+    52, 52, 52, 255, 16, 0, 30, 0, 0, 0, 24, 0, 0, 52, 52, 52, 52, 52, 52, 52, 254, 254, 0, 0, 0, 0, 0, 60, 60, 60,
+    60, 60, 60, 60, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 60, 60, 255, 0, 128, 4,
+    0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 5,
+    0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0,
+    0, 17, 52, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0,
+    255, 27, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0,
+    255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 254, 0, 0, 4, 0, 0, 0, 254, 0, 1, 252, 0, 0, 0, 255, 27, 0, 16, 0, 0,
+    0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 25, 0, 16, 0, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0,
+    0, 255, 241, 255, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 239, 255, 16, 0, 0, 0, 0,
+    0, 0, 60, 60, 60, 60, 60, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 227, 255, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128,
+    0, 0, 0, 0, 0, 0, 0, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 72, 72, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42,
+    254, 0, 253, 0, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1,
+    251, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 16, 0, 4,
+    0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0,
+    0, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0,
+    0, 0, 0, 254, 0, 0, 4, 0, 0, 0, 254, 0, 1, 252, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 8, 0, 0, 255, 0, 128,
+    4, 0, 0, 0, 0, 0, 0, 255, 16, 0, 6, 0, 0, 0, 8, 0, 0, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+    72, 72, 72, 72, 72, 72, 72, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 16, 0, 46, 0, 0,
+    0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 16, 0, 48, 0, 0, 0, 8, 0, 0, 72, 72, 72, 72, 72,
+    255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 16, 0, 60, 0, 0, 0, 8, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0,
+    255, 0, 0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0,
+    255, 4, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 4, 0,
+    15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255,
+    0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2,
+    0, 0, 0, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 254, 0, 0, 4,
+    0, 0, 0, 254, 0, 1, 252, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0,
+    255, 6, 0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 46, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128,
+    4, 0, 0, 0, 0, 0, 0, 72, 255, 48, 0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 255, 0, 128, 3, 0, 0, 0,
+    0, 0, 0, 255, 60, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 15, 0, 31, 0, 0, 0,
+    24, 0, 0, 52, 52, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0,
+    24, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 24, 0, 0,
+    255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0,
+    0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255,
+    15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 254, 0, 0, 4, 0, 0, 0, 254, 0, 1, 252,
+    0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 15, 0, 25, 0, 0, 0,
+    24, 0, 0, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 255, 0, 128, 4, 0, 3, 0,
+    0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 15, 0, 241, 255, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0,
+    72, 255, 15, 0, 239, 255, 0, 0, 24, 0, 0, 52, 52, 52, 52, 52, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 15, 0, 227,
+    255, 0, 0, 24, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 60, 60, 255, 0,
+    128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4,
+    0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 2, 0,
+    0, 0, 0, 17, 52, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0,
+    0, 0, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 24,
+    0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 254, 0, 0, 4, 0, 0, 0, 254, 0, 1, 252, 0, 0, 0, 255, 27, 0, 16,
+    0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 25, 0, 16, 0, 0, 0, 0, 0, 0, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 255, 0, 128, 4, 0, 3, 0, 0,
+    0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 229, 255, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72,
+    255, 229, 255, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 227, 255, 16, 0, 0, 0, 0, 0, 0,
+    255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 72, 72, 255, 0, 128, 4, 0, 1, 0, 0,
+    0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0,
+    254, 0, 1, 251, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255,
+    16, 0, 4, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 16, 0, 4,
+    0, 0, 0, 0, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4,
+    0, 0, 0, 0, 0, 0, 254, 0, 0, 4, 0, 0, 0, 254, 0, 1, 252, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 8, 0, 0,
+    255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 16, 0, 6, 0, 0, 0, 8, 0, 0, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253,
+    0, 0, 0, 255, 16, 0, 58, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 16, 0, 58, 0, 0,
+    0, 8, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 16, 0, 60, 0, 0, 0, 8, 0, 0, 255, 0, 128, 0, 0, 0,
+    0, 0, 0, 0, 255, 0, 0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253,
+    0, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0,
+    0, 255, 4, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 4, 0, 15, 0, 0, 0,
+    8, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0,
+    255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0,
+    254, 0, 0, 4, 0, 0, 0, 254, 0, 1, 252, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0,
+    0, 0, 0, 0, 255, 6, 0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 58, 0,
+    15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 58, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0,
+    128, 3, 0, 0, 0, 0, 0, 0, 255, 60, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 15,
+    0, 31, 0, 0, 0, 24, 0, 0, 52, 52, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 15,
+    0, 27, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 15, 0, 27, 0,
+    0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128,
+    4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0,
+    0, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 254, 0, 0, 4, 0, 0,
+    0, 254, 0, 1, 252, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 15,
+    0, 25, 0, 0, 0, 24, 0, 0, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 15, 0, 229, 255, 0, 0, 24, 0,
+    0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 15, 0, 229, 255, 0, 0, 24, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0,
+    0, 0, 255, 15, 0, 227, 255, 0, 0, 24, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 31, 0, 16, 0, 0, 0, 0,
+    0, 0, 60, 60, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 0,
+    0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 0, 0, 0, 255,
+    0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0,
+    0, 254, 0, 1, 250, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 27,
+    0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 254, 0, 0, 4, 0, 0, 0, 254, 0, 1, 252, 0,
+    0, 0, 255, 27, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 25, 0, 16, 0, 0, 0, 0,
+    0, 0, 60, 60, 60, 60, 60, 60, 60, 254, 254, 0, 5, 0, 0, 0, 60, 60, 60, 60, 60, 60, 60, 60, 254, 254, 0, 251, 0, 0,
+    0, 60, 60, 60, 60, 60, 60, 60, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 233, 255, 16, 0,
+    0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 233, 255, 16, 0, 0, 0, 0, 0, 0, 60, 60, 255, 0,
+    128, 3, 0, 0, 0, 0, 0, 0, 255, 227, 255, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 16,
+    0, 0, 0, 0, 0, 8, 0, 0, 72, 72, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 16,
+    0, 4, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 16, 0, 4, 0,
+    0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 16, 0, 4, 0, 0, 0, 0, 0, 0, 255, 0, 128,
+    4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 0, 0, 0, 255, 0, 128, 2, 0, 0,
+    0, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 254, 0, 0, 4, 0, 0,
+    0, 254, 0, 1, 252, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 16,
+    0, 6, 0, 0, 0, 8, 0, 0, 72, 72, 72, 72, 72, 72, 72, 254, 0, 2, 5, 8, 0, 0, 72, 72, 72, 72, 72, 72, 72, 72,
+    254, 0, 2, 251, 8, 0, 0, 72, 72, 72, 72, 72, 72, 72, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0,
+    0, 255, 16, 0, 54, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 16, 0, 54, 0, 0, 0, 8,
+    0, 0, 72, 72, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 16, 0, 60, 0, 0, 0, 8, 0, 0, 255, 0, 128, 0, 0, 0,
+    0, 0, 0, 0, 255, 0, 0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253,
+    0, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0,
+    0, 255, 4, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 4, 0, 15, 0, 0, 0,
+    8, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0,
+    255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0,
+    254, 0, 0, 4, 0, 0, 0, 254, 0, 1, 252, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0,
+    0, 0, 0, 0, 255, 6, 0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 64, 64, 254, 2, 0, 5, 16, 0, 0, 64, 64,
+    64, 64, 64, 64, 64, 64, 254, 2, 0, 251, 16, 0, 0, 64, 64, 64, 64, 64, 64, 64, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0,
+    254, 0, 1, 253, 0, 0, 0, 255, 54, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 54,
+    0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 60, 0, 15, 0, 0, 0, 16, 0, 0,
+    255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 15, 0, 31, 0, 0, 0, 24, 0, 0, 52, 52, 255, 0, 128, 4, 0, 1, 0, 0,
+    0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0,
+    254, 0, 1, 251, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255,
+    15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 15, 0, 27,
+    0, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4,
+    0, 0, 0, 0, 0, 0, 254, 0, 0, 4, 0, 0, 0, 254, 0, 1, 252, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 24, 0, 0,
+    255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 15, 0, 25, 0, 0, 0, 24, 0, 0, 52, 52, 52, 52, 52, 52, 52, 254, 0, 254,
+    5, 24, 0, 0, 52, 52, 52, 52, 52, 52, 52, 52, 254, 0, 254, 251, 24, 0, 0, 52, 52, 52, 52, 52, 52, 52, 255, 0, 128, 4,
+    0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 15, 0, 233, 255, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0,
+    0, 0, 0, 72, 255, 15, 0, 233, 255, 0, 0, 24, 0, 0, 52, 52, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 15, 0, 227,
+    255, 0, 0, 24, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 60, 60, 255, 0,
+    128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4,
+    0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 2, 0,
+    0, 0, 0, 17, 52, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0,
+    0, 0, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 24,
+    0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 254, 0, 0, 4, 0, 0, 0, 254, 0, 1, 252, 0, 0, 0, 255, 27, 0, 16,
+    0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 25, 0, 16, 0, 0, 0, 0, 0, 0, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 254, 0, 2, 0, 8, 0, 0, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+    72, 72, 254, 254, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 60, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0,
+    0, 0, 255, 239, 255, 49, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 239, 255, 48, 0, 0, 0,
+    8, 0, 0, 72, 72, 72, 72, 72, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 239, 255, 60, 0, 0, 0, 8, 0, 0, 255, 0,
+    128, 0, 0, 0, 0, 0, 0, 0, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 72, 72, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0,
+    42, 254, 0, 253, 0, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0,
+    1, 251, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 16, 0,
+    4, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 16, 0, 4, 0, 0,
+    0, 0, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0,
+    0, 0, 0, 0, 254, 0, 0, 4, 0, 0, 0, 254, 0, 1, 252, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 8, 0, 0, 255, 0,
+    128, 4, 0, 0, 0, 0, 0, 0, 255, 16, 0, 6, 0, 0, 0, 8, 0, 0, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+    72, 72, 254, 2, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 254, 0, 2, 0, 8, 0,
+    0, 72, 72, 72, 72, 72, 72, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 49, 0, 48, 0, 0,
+    0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 48, 0, 48, 0, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64,
+    255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 60, 0, 48, 0, 0, 0, 16, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0,
+    255, 0, 0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0,
+    255, 4, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 4, 0,
+    15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255,
+    0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2,
+    0, 0, 0, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 254, 0, 0, 4,
+    0, 0, 0, 254, 0, 1, 252, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0,
+    255, 6, 0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 254, 0, 254, 0, 24, 0,
+    0, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 254, 2, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 64, 255,
+    0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 48, 0, 238, 255, 0, 0, 16, 0, 0, 255, 0, 128, 4,
+    0, 0, 0, 0, 0, 0, 72, 255, 48, 0, 239, 255, 0, 0, 24, 0, 0, 52, 52, 52, 52, 52, 255, 0, 128, 3, 0, 0, 0, 0,
+    0, 0, 255, 48, 0, 227, 255, 0, 0, 24, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 15, 0, 31, 0, 0, 0, 24,
+    0, 0, 52, 52, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 24,
+    0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 24, 0, 0, 255,
+    0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0,
+    0, 254, 0, 1, 250, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 15,
+    0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 254, 0, 0, 4, 0, 0, 0, 254, 0, 1, 252, 0,
+    0, 0, 255, 15, 0, 27, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 15, 0, 25, 0, 0, 0, 24,
+    0, 0, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 254, 254, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 254, 0, 254, 0, 24, 0, 0, 52, 52, 52, 52, 52, 52, 255, 0, 128, 4, 0, 3, 0, 0, 0,
+    0, 254, 0, 1, 253, 0, 0, 0, 255, 238, 255, 239, 255, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255,
+    239, 255, 239, 255, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 227, 255, 239, 255, 0,
+    0, 0, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 60, 60, 255, 0, 128, 4,
+    0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 5,
+    0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0,
+    0, 17, 52, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0,
+    255, 27, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0,
+    255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 254, 0, 0, 4, 0, 0, 0, 254, 0, 1, 252, 0, 0, 0, 255, 27, 0, 16, 0, 0,
+    0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 25, 0, 16, 0, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 254, 0, 254, 0, 24, 0, 0, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    254, 254, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 60, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0,
+    255, 239, 255, 239, 255, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 239, 255, 240, 255, 0, 0, 24, 0,
+    0, 52, 52, 52, 52, 52, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 239, 255, 228, 255, 0, 0, 24, 0, 0, 255, 0, 128, 0,
+    0, 0, 0, 0, 0, 0, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 72, 72, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254,
+    0, 253, 0, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251,
+    0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 16, 0, 4, 0,
+    0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 0,
+    0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0,
+    0, 0, 254, 0, 0, 4, 0, 0, 0, 254, 0, 1, 252, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4,
+    0, 0, 0, 0, 0, 0, 255, 16, 0, 6, 0, 0, 0, 8, 0, 0, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+    254, 254, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 254, 0, 2, 0, 8, 0, 0, 72,
+    72, 72, 72, 72, 72, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 239, 255, 48, 0, 0, 0, 8,
+    0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 240, 255, 48, 0, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 255, 0,
+    128, 3, 0, 0, 0, 0, 0, 0, 255, 228, 255, 48, 0, 0, 0, 0, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 0,
+    0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 4,
+    0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 4, 0, 15, 0,
+    0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128,
+    4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0,
+    0, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 254, 0, 0, 4, 0, 0,
+    0, 254, 0, 1, 252, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 6,
+    0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 254, 0, 2, 0, 8, 0, 0, 72,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 254, 2, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 64, 255, 0, 128,
+    4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 48, 0, 48, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0,
+    0, 0, 0, 0, 72, 255, 48, 0, 47, 0, 0, 0, 8, 0, 0, 72, 72, 72, 72, 72, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0,
+    255, 48, 0, 59, 0, 0, 0, 8, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 15, 0, 31, 0, 0, 0, 24, 0, 0,
+    52, 52, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 24, 0, 0,
+    255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 24, 0, 0, 255, 0, 128,
+    4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254,
+    0, 1, 250, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 15, 0, 27,
+    0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 254, 0, 0, 4, 0, 0, 0, 254, 0, 1, 252, 0, 0, 0,
+    255, 15, 0, 27, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 15, 0, 25, 0, 0, 0, 24, 0, 0,
+    52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 254, 2, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 254, 0, 254, 0, 24, 0, 0, 52, 52, 52, 52, 52, 52, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254,
+    0, 1, 253, 0, 0, 0, 255, 48, 0, 239, 255, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 47, 0,
+    239, 255, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 59, 0, 239, 255, 0, 0, 16,
+    0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0,
+    0, 0, 255, 26, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 26, 0, 16, 0, 0, 0, 0,
+    0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 25, 0, 16, 0, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254,
+    253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 1, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 60, 60, 60,
+    60, 65, 60, 60, 60, 60, 60, 60, 65, 60, 60, 60, 60, 60, 60, 65, 60, 63, 63, 63, 58, 63, 63, 58, 63, 63, 58, 63, 63, 58,
+    63, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 227, 255, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0,
+    0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 227, 255, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255,
+    16, 0, 0, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 16, 0, 5, 0, 0, 0, 8, 0, 0, 255,
+    0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 16, 0, 5, 0, 0, 0, 8, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255,
+    16, 0, 6, 0, 0, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0,
+    254, 1, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 72, 72, 72, 72, 73, 72, 72, 72, 72, 72, 72, 73, 72, 72, 72, 72,
+    72, 72, 73, 72, 57, 57, 57, 56, 57, 57, 56, 57, 57, 56, 57, 57, 56, 57, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255,
+    16, 0, 60, 0, 0, 0, 8, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 16, 0, 60,
+    0, 0, 0, 8, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 2,
+    0, 0, 0, 0, 0, 0, 255, 5, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 5, 0, 15,
+    0, 0, 0, 16, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 6, 0, 15, 0, 0, 0, 16, 0, 0, 254, 3, 0, 0,
+    16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 255, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0,
+    0, 64, 64, 64, 64, 59, 64, 64, 64, 64, 64, 64, 59, 64, 64, 64, 64, 64, 64, 59, 64, 61, 61, 61, 66, 61, 61, 66, 61, 61,
+    66, 61, 61, 66, 61, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 60, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 6,
+    0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 60, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 0, 0, 0, 0,
+    0, 0, 0, 255, 15, 0, 31, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 15, 0, 26, 0, 0, 0,
+    24, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 15, 0, 26, 0, 0, 0, 24, 0, 0, 255, 0, 128, 3, 0, 0, 0,
+    0, 0, 0, 255, 15, 0, 25, 0, 0, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253,
+    0, 24, 0, 0, 254, 255, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 52, 52, 52, 52, 51, 52, 52, 52, 52, 52, 52, 51,
+    52, 52, 52, 52, 52, 52, 51, 52, 67, 67, 67, 68, 67, 67, 68, 67, 67, 68, 67, 67, 68, 67, 255, 0, 128, 4, 0, 0, 0, 0,
+    0, 0, 52, 255, 15, 0, 227, 255, 0, 0, 24, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0,
+    255, 15, 0, 227, 255, 0, 0, 24, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0,
+    255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 26, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0,
+    255, 26, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 25, 0, 16, 0, 0, 0, 0, 0, 0,
+    254, 253, 0, 0, 0, 0, 0, 254, 253, 255, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 255, 0, 0, 0, 0, 254, 253,
+    0, 0, 0, 0, 0, 254, 253, 255, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 255, 0, 0, 0, 0, 254, 253, 0, 0,
+    0, 0, 0, 254, 0, 3, 0, 0, 0, 0, 254, 0, 3, 0, 0, 0, 0, 254, 0, 3, 0, 0, 0, 0, 254, 0, 3, 0, 0, 0,
+    0, 72, 60, 60, 60, 60, 56, 52, 52, 52, 53, 52, 52, 60, 60, 60, 60, 65, 60, 61, 61, 61, 61, 61, 61, 61, 61, 61, 63, 63,
+    68, 63, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 227, 255, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 6, 0, 0, 0,
+    0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 227, 255, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0,
+    255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 16, 0, 5, 0, 0, 0, 8, 0, 0,
+    255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 16, 0, 5, 0, 0, 0, 8, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0,
+    255, 16, 0, 6, 0, 0, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 255, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0,
+    0, 254, 255, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 255, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254,
+    255, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 3, 0, 0, 8, 0, 0, 254, 3, 0, 0, 8, 0, 0, 254, 3, 0,
+    0, 8, 0, 0, 254, 3, 0, 0, 8, 0, 0, 64, 72, 72, 72, 72, 66, 60, 60, 60, 55, 60, 60, 72, 72, 72, 72, 73, 72, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 57, 57, 58, 57, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 16, 0, 60, 0, 0, 0,
+    8, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 16, 0, 60, 0, 0, 0, 8, 0, 0,
+    255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0,
+    255, 5, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 5, 0, 15, 0, 0, 0, 16, 0, 0,
+    255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 6, 0, 15, 0, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 1,
+    0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 1, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 1, 0, 16,
+    0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 1, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 0, 253, 0, 16, 0, 0,
+    254, 0, 253, 0, 16, 0, 0, 254, 0, 253, 0, 16, 0, 0, 254, 0, 253, 0, 16, 0, 0, 52, 64, 64, 64, 64, 68, 72, 72, 72,
+    71, 72, 72, 64, 64, 64, 64, 59, 64, 63, 63, 63, 63, 63, 63, 63, 63, 63, 61, 61, 56, 61, 255, 0, 128, 4, 0, 0, 0, 0,
+    0, 0, 52, 255, 60, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0,
+    255, 60, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 15, 0, 31, 0, 0, 0, 24, 0, 0,
+    255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 15, 0, 26, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0,
+    255, 15, 0, 26, 0, 0, 0, 24, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 15, 0, 25, 0, 0, 0, 24, 0, 0,
+    254, 0, 253, 0, 24, 0, 0, 254, 1, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 1, 253, 0, 24, 0, 0, 254, 0,
+    253, 0, 24, 0, 0, 254, 1, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 1, 253, 0, 24, 0, 0, 254, 0, 253, 0,
+    24, 0, 0, 254, 253, 0, 0, 24, 0, 0, 254, 253, 0, 0, 24, 0, 0, 254, 253, 0, 0, 24, 0, 0, 254, 253, 0, 0, 24, 0,
+    0, 60, 52, 52, 52, 52, 58, 64, 64, 64, 69, 64, 64, 52, 52, 52, 52, 51, 52, 57, 57, 57, 57, 57, 57, 57, 57, 57, 67, 67,
+    66, 67, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 15, 0, 227, 255, 0, 0, 24, 0, 0, 255, 0, 128, 6, 0, 0, 0,
+    0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 15, 0, 227, 255, 0, 0, 24, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0,
+    255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 26, 0, 16, 0, 0, 0, 0, 0, 0,
+    255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 26, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0,
+    255, 24, 0, 16, 0, 0, 0, 0, 0, 0, 254, 253, 1, 0, 0, 0, 0, 254, 253, 1, 0, 0, 0, 0, 254, 253, 1, 0, 0, 0,
+    0, 254, 253, 0, 0, 0, 0, 0, 65, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 7, 0, 20, 0, 0, 0, 0, 0, 0, 55,
+    254, 254, 253, 0, 0, 0, 0, 60, 65, 55, 60, 60, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 248, 255, 16, 0, 0, 0, 0,
+    0, 0, 60, 60, 60, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 227, 255, 16, 0,
+    0, 0, 0, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 227, 255, 16, 0, 0, 0, 0,
+    0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0,
+    0, 0, 255, 16, 0, 5, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 16, 0, 5, 0, 0, 0, 8,
+    0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 16, 0, 7, 0, 0, 0, 8, 0, 0, 254, 1, 3, 0, 8, 0, 0, 254,
+    1, 3, 0, 8, 0, 0, 254, 1, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 73, 255, 0, 128, 4, 0, 0, 0, 0, 0,
+    0, 255, 20, 0, 24, 0, 0, 0, 8, 0, 0, 71, 254, 253, 2, 0, 8, 0, 0, 72, 73, 71, 72, 72, 255, 0, 128, 4, 0, 1,
+    0, 0, 0, 0, 255, 16, 0, 39, 0, 0, 0, 8, 0, 0, 72, 72, 72, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255, 0, 128, 4,
+    0, 0, 0, 0, 0, 0, 52, 255, 16, 0, 60, 0, 0, 0, 8, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253,
+    0, 0, 0, 0, 255, 16, 0, 60, 0, 0, 0, 8, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 15, 0, 0,
+    0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 5, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 1,
+    0, 0, 0, 0, 255, 5, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 7, 0, 15, 0, 0,
+    0, 16, 0, 0, 254, 3, 255, 0, 16, 0, 0, 254, 3, 255, 0, 16, 0, 0, 254, 3, 255, 0, 16, 0, 0, 254, 3, 0, 0, 16,
+    0, 0, 59, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 24, 0, 11, 0, 0, 0, 16, 0, 0, 69, 254, 2, 3, 0, 16, 0,
+    0, 64, 59, 69, 64, 64, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 39, 0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 64, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 60, 0, 15, 0, 0, 0, 16, 0, 0, 255,
+    0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 60, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 0,
+    0, 0, 0, 0, 0, 0, 255, 15, 0, 31, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 15, 0, 26,
+    0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 15, 0, 26, 0, 0, 0, 24, 0, 0, 255, 0, 128, 3,
+    0, 0, 0, 0, 0, 0, 255, 15, 0, 24, 0, 0, 0, 24, 0, 0, 254, 255, 253, 0, 24, 0, 0, 254, 255, 253, 0, 24, 0, 0,
+    254, 255, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 51, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 11, 0, 7, 0,
+    0, 0, 24, 0, 0, 53, 254, 3, 254, 0, 24, 0, 0, 52, 51, 53, 52, 52, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 15,
+    0, 248, 255, 0, 0, 24, 0, 0, 52, 52, 52, 57, 57, 57, 57, 57, 57, 57, 57, 57, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0,
+    52, 255, 15, 0, 227, 255, 0, 0, 24, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 15,
+    0, 227, 255, 0, 0, 24, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0,
+    128, 2, 0, 0, 0, 0, 0, 0, 255, 26, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 26,
+    0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 24, 0, 16, 0, 0, 0, 0, 0, 0, 254, 253,
+    0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0,
+    0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0,
+    0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 244, 255, 16, 0,
+    0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 238, 255, 16, 0, 0, 0, 0,
+    0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 56, 51, 51, 51, 54, 79, 54, 59, 64, 94, 64, 72, 73, 98,
+    72, 73, 71, 72, 72, 71, 72, 72, 71, 72, 67, 67, 66, 67, 67, 67, 67, 254, 0, 2, 253, 0, 0, 0, 71, 67, 67, 67, 67, 67,
+    66, 67, 67, 67, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 239, 255, 60, 0, 0, 0, 8, 0, 0, 255, 0, 128, 6, 0,
+    0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 239, 255, 60, 0, 0, 0, 8, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0,
+    0, 0, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 16, 0, 5, 0, 0, 0, 8,
+    0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 16, 0, 5, 0, 0, 0, 8, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0,
+    0, 0, 255, 16, 0, 7, 0, 0, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0,
+    8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0,
+    0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 255,
+    0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 16, 0, 43, 0, 0, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 255, 0, 128, 4,
+    0, 1, 0, 0, 0, 0, 255, 16, 0, 49, 0, 0, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0,
+    66, 65, 65, 65, 50, 75, 50, 51, 52, 78, 52, 64, 59, 84, 64, 59, 69, 64, 64, 69, 64, 64, 69, 64, 63, 63, 68, 63, 63, 63,
+    63, 254, 2, 0, 253, 8, 0, 0, 69, 63, 63, 63, 63, 63, 68, 63, 63, 63, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255,
+    60, 0, 48, 0, 0, 0, 16, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 60, 0, 48,
+    0, 0, 0, 16, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 2,
+    0, 0, 0, 0, 0, 0, 255, 5, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 5, 0, 15,
+    0, 0, 0, 16, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 7, 0, 15, 0, 0, 0, 16, 0, 0, 254, 3, 0, 0,
+    16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0,
+    0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254,
+    3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 43, 0, 15, 0, 0, 0,
+    16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 49, 0, 15, 0, 0, 0, 16, 0, 0,
+    254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 68, 73, 73, 73, 70, 95, 70, 65, 60, 80, 60, 52, 51, 76, 52, 51,
+    53, 52, 52, 53, 52, 52, 53, 52, 57, 57, 58, 57, 57, 57, 57, 254, 0, 254, 253, 16, 0, 0, 53, 57, 57, 57, 57, 57, 58, 57,
+    57, 57, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 48, 0, 227, 255, 0, 0, 24, 0, 0, 255, 0, 128, 6, 0, 0, 0,
+    0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 48, 0, 227, 255, 0, 0, 24, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0,
+    255, 15, 0, 31, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 15, 0, 26, 0, 0, 0, 24, 0, 0,
+    255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 15, 0, 26, 0, 0, 0, 24, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0,
+    255, 15, 0, 24, 0, 0, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0,
+    0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254,
+    0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 255, 0, 128,
+    4, 0, 0, 0, 0, 0, 0, 255, 15, 0, 244, 255, 0, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 255, 0, 128, 4, 0, 1,
+    0, 0, 0, 0, 255, 15, 0, 238, 255, 0, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 58, 59,
+    59, 59, 74, 99, 74, 73, 72, 96, 72, 60, 65, 90, 60, 65, 55, 60, 60, 55, 60, 60, 55, 60, 61, 61, 56, 61, 61, 61, 61, 254,
+    254, 0, 253, 24, 0, 0, 55, 61, 61, 61, 61, 61, 56, 61, 61, 61, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 227, 255,
+    239, 255, 0, 0, 0, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 227, 255, 239, 255, 0,
+    0, 0, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 2, 0, 0,
+    0, 0, 0, 0, 255, 26, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 26, 0, 16, 0, 0,
+    0, 0, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 24, 0, 16, 0, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0,
+    0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254,
+    253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0,
+    0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 244, 255, 16, 0, 0, 0, 0, 0,
+    0, 254, 253, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 238, 255, 16, 0, 0, 0, 0, 0, 0, 254, 253,
+    0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 66, 71, 71, 71, 74, 99, 74, 69, 64, 84, 64, 52, 53, 78, 52, 53, 51, 52,
+    52, 51, 52, 52, 51, 52, 57, 57, 56, 57, 57, 57, 57, 254, 0, 254, 253, 0, 0, 0, 51, 57, 57, 57, 57, 57, 56, 57, 57, 57,
+    255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 239, 255, 228, 255, 0, 0, 24, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0,
+    0, 254, 0, 253, 0, 0, 0, 0, 255, 239, 255, 228, 255, 0, 0, 24, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 16,
+    0, 0, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 16, 0, 5, 0, 0, 0, 8, 0, 0, 255, 0,
+    128, 4, 0, 1, 0, 0, 0, 0, 255, 16, 0, 5, 0, 0, 0, 8, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 16,
+    0, 7, 0, 0, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254,
+    0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3,
+    0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 255, 0, 128, 4, 0,
+    0, 0, 0, 0, 0, 255, 16, 0, 43, 0, 0, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0,
+    0, 0, 255, 16, 0, 49, 0, 0, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 68, 69, 69, 69,
+    54, 79, 54, 53, 52, 76, 52, 60, 55, 80, 60, 55, 65, 60, 60, 65, 60, 60, 65, 60, 61, 61, 66, 61, 61, 61, 61, 254, 254, 0,
+    253, 8, 0, 0, 65, 61, 61, 61, 61, 61, 66, 61, 61, 61, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 228, 255, 48, 0,
+    0, 0, 0, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 228, 255, 48, 0, 0, 0, 0,
+    0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0,
+    0, 0, 255, 5, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 5, 0, 15, 0, 0, 0, 16,
+    0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 7, 0, 15, 0, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254,
+    3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0,
+    0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16,
+    0, 0, 254, 3, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 43, 0, 15, 0, 0, 0, 16, 0, 0, 254,
+    3, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 49, 0, 15, 0, 0, 0, 16, 0, 0, 254, 3, 0, 0,
+    16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 58, 53, 53, 53, 50, 75, 50, 55, 60, 90, 60, 72, 71, 96, 72, 71, 73, 72, 72, 73,
+    72, 72, 73, 72, 67, 67, 68, 67, 67, 67, 67, 254, 0, 2, 253, 16, 0, 0, 73, 67, 67, 67, 67, 67, 68, 67, 67, 67, 255, 0,
+    128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 48, 0, 59, 0, 0, 0, 8, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254,
+    0, 253, 0, 0, 0, 0, 255, 48, 0, 59, 0, 0, 0, 8, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 15, 0, 31,
+    0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 15, 0, 26, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4,
+    0, 1, 0, 0, 0, 0, 255, 15, 0, 26, 0, 0, 0, 24, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 15, 0, 24,
+    0, 0, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253,
+    0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24,
+    0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0,
+    0, 0, 0, 255, 15, 0, 244, 255, 0, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0,
+    255, 15, 0, 238, 255, 0, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 56, 55, 55, 55, 70, 95,
+    70, 71, 72, 98, 72, 64, 69, 94, 64, 69, 59, 64, 64, 59, 64, 64, 59, 64, 63, 63, 58, 63, 63, 63, 63, 254, 2, 0, 253, 24,
+    0, 0, 59, 63, 63, 63, 63, 63, 58, 63, 63, 63, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 59, 0, 239, 255, 0, 0,
+    16, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 59, 0, 239, 255, 0, 0, 16, 0, 0,
+    255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 60, 60, 255, 0, 128, 4, 0, 1, 0, 0,
+    0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0,
+    254, 0, 1, 251, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255,
+    27, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 27, 0, 16,
+    0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4,
+    0, 0, 0, 0, 0, 0, 255, 25, 0, 16, 0, 0, 0, 0, 0, 0, 60, 60, 60, 61, 254, 253, 0, 0, 0, 0, 0, 60, 60, 60,
+    60, 60, 60, 254, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 3, 0, 16, 0, 0, 0, 24,
+    0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 3, 0, 16, 0, 0, 0, 24, 0, 0, 255,
+    0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 3, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255,
+    1, 0, 16, 0, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 60, 60, 60, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1,
+    253, 0, 0, 0, 255, 241, 255, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 239, 255, 16, 0,
+    0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 227, 255, 16, 0, 0, 0, 0, 0, 0,
+    255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 72, 72, 255, 0, 128, 4, 0, 1, 0, 0,
+    0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0,
+    254, 0, 1, 251, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255,
+    16, 0, 4, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 16, 0, 4,
+    0, 0, 0, 0, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4,
+    0, 0, 0, 0, 0, 0, 255, 16, 0, 6, 0, 0, 0, 8, 0, 0, 72, 72, 72, 67, 254, 0, 3, 0, 8, 0, 0, 72, 72, 72,
+    72, 72, 72, 254, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 16, 0, 28, 0, 0, 0, 0,
+    0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 16, 0, 28, 0, 0, 0, 0, 0, 0, 255,
+    0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 16, 0, 28, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255,
+    16, 0, 30, 0, 0, 0, 8, 0, 0, 72, 72, 72, 72, 72, 72, 72, 72, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1,
+    253, 0, 0, 0, 255, 16, 0, 46, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 16, 0, 48, 0,
+    0, 0, 8, 0, 0, 72, 72, 72, 72, 72, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 16, 0, 60, 0, 0, 0, 8, 0, 0,
+    255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 255, 0, 128, 4, 0, 1, 0, 0,
+    0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0,
+    254, 0, 1, 251, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255,
+    4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 4, 0, 15,
+    0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4,
+    0, 0, 0, 0, 0, 0, 255, 6, 0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 64, 63, 254, 3, 0, 0, 16, 0, 0, 64, 64, 64,
+    64, 64, 64, 254, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 28, 0, 15, 0, 0, 0, 8,
+    0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 28, 0, 15, 0, 0, 0, 8, 0, 0, 255,
+    0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 28, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255,
+    30, 0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1,
+    253, 0, 0, 0, 255, 46, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 48, 0, 15, 0,
+    0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 60, 0, 15, 0, 0, 0, 16, 0, 0,
+    255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 15, 0, 31, 0, 0, 0, 24, 0, 0, 52, 52, 255, 0, 128, 4, 0, 1, 0, 0,
+    0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0,
+    254, 0, 1, 251, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255,
+    15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 15, 0, 27,
+    0, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4,
+    0, 0, 0, 0, 0, 0, 255, 15, 0, 25, 0, 0, 0, 24, 0, 0, 52, 52, 52, 57, 254, 0, 253, 0, 24, 0, 0, 52, 52, 52,
+    52, 52, 52, 254, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 15, 0, 3, 0, 0, 0, 16,
+    0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 15, 0, 3, 0, 0, 0, 16, 0, 0, 255,
+    0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 15, 0, 3, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255,
+    15, 0, 1, 0, 0, 0, 24, 0, 0, 52, 52, 52, 52, 52, 52, 52, 52, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1,
+    253, 0, 0, 0, 255, 15, 0, 241, 255, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 15, 0, 239, 255,
+    0, 0, 24, 0, 0, 52, 52, 52, 52, 52, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 15, 0, 227, 255, 0, 0, 24, 0, 0,
+    255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 60, 60, 255, 0, 128, 4, 0, 1, 0, 0,
+    0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0,
+    254, 0, 1, 251, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255,
+    27, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 27, 0, 16,
+    0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4,
+    0, 0, 0, 0, 0, 0, 255, 25, 0, 16, 0, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 255, 0,
+    128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 2, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0,
+    254, 0, 1, 250, 0, 0, 0, 255, 2, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 2, 0,
+    16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 255, 255, 16, 0, 0, 0, 0, 0, 0, 60, 60, 254,
+    0, 2, 0, 8, 0, 0, 72, 72, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 252, 255, 22, 0, 0, 0, 24, 0, 0,
+    255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 252, 255, 22, 0, 0, 0, 24, 0, 0, 255, 0, 128,
+    2, 0, 0, 0, 0, 0, 0, 255, 252, 255, 22, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 251, 255,
+    20, 0, 0, 0, 24, 0, 0, 52, 52, 254, 254, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 60, 60, 60, 60, 255, 0, 128, 4, 0,
+    3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 229, 255, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0,
+    0, 0, 72, 255, 229, 255, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 227, 255, 16, 0, 0, 0,
+    0, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 72, 72, 255, 0, 128, 4, 0,
+    1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 5, 0,
+    0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0,
+    17, 52, 255, 16, 0, 4, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255,
+    16, 0, 4, 0, 0, 0, 0, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 0, 0, 0, 255,
+    0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 16, 0, 6, 0, 0, 0, 8, 0, 0, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+    72, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 16, 0, 29, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 6, 0,
+    0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 16, 0, 29, 0, 0, 0, 0, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0,
+    255, 16, 0, 29, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 16, 0, 32, 0, 0, 0, 8, 0, 0,
+    72, 72, 254, 2, 0, 0, 16, 0, 0, 64, 64, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 22, 0, 35, 0, 0, 0,
+    0, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 22, 0, 35, 0, 0, 0, 0, 0, 0,
+    255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 22, 0, 35, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0,
+    255, 20, 0, 36, 0, 0, 0, 0, 0, 0, 60, 60, 254, 0, 2, 0, 8, 0, 0, 72, 72, 72, 72, 72, 72, 72, 72, 72, 255, 0,
+    128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 16, 0, 58, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0,
+    0, 0, 0, 0, 0, 72, 255, 16, 0, 58, 0, 0, 0, 8, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 16, 0, 60,
+    0, 0, 0, 8, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 255, 0,
+    128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4,
+    0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 2, 0,
+    0, 0, 0, 17, 52, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0,
+    0, 0, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 8,
+    0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 6, 0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 29, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4,
+    0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 29, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0, 0,
+    0, 0, 0, 255, 29, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 32, 0, 15, 0, 0, 0,
+    16, 0, 0, 64, 64, 254, 0, 254, 0, 24, 0, 0, 52, 52, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 35, 0, 9,
+    0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 35, 0, 9, 0, 0, 0,
+    8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 35, 0, 9, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0,
+    0, 0, 0, 255, 36, 0, 11, 0, 0, 0, 8, 0, 0, 72, 72, 254, 2, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 58, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0,
+    128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 58, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255,
+    60, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 15, 0, 31, 0, 0, 0, 24, 0, 0, 52,
+    52, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 24, 0, 0, 255,
+    0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4,
+    0, 2, 0, 0, 0, 0, 17, 52, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0,
+    1, 250, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 15, 0, 27, 0,
+    0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 15, 0, 25, 0, 0, 0, 24, 0, 0, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 15, 0, 2, 0, 0, 0, 16, 0, 0, 255,
+    0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 15, 0, 2, 0, 0, 0, 16, 0, 0, 255, 0, 128, 2,
+    0, 0, 0, 0, 0, 0, 255, 15, 0, 2, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 15, 0, 255,
+    255, 0, 0, 24, 0, 0, 52, 52, 254, 254, 0, 0, 0, 0, 0, 60, 60, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255,
+    9, 0, 252, 255, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 9, 0, 252,
+    255, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 9, 0, 252, 255, 0, 0, 16, 0, 0, 255, 0, 128, 4,
+    0, 0, 0, 0, 0, 0, 255, 11, 0, 251, 255, 0, 0, 16, 0, 0, 64, 64, 254, 0, 254, 0, 24, 0, 0, 52, 52, 52, 52, 52,
+    52, 52, 52, 52, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 15, 0, 229, 255, 0, 0, 24, 0,
+    0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 15, 0, 229, 255, 0, 0, 24, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0,
+    0, 0, 255, 15, 0, 227, 255, 0, 0, 24, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 31, 0, 16, 0, 0, 0, 0,
+    0, 0, 60, 60, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 0,
+    0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 0, 0, 0, 255,
+    0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0,
+    0, 254, 0, 1, 250, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 27,
+    0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 25, 0, 16, 0, 0, 0, 0, 0, 0, 60, 60,
+    60, 60, 60, 60, 60, 254, 254, 0, 5, 0, 0, 0, 60, 60, 60, 60, 60, 60, 60, 60, 254, 254, 0, 251, 0, 0, 0, 60, 60, 60,
+    60, 60, 60, 60, 254, 0, 254, 0, 24, 0, 0, 52, 52, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 233, 255, 10, 0,
+    0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 233, 255, 10, 0, 0, 0, 0,
+    0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 233, 255, 10, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0,
+    0, 0, 255, 233, 255, 10, 0, 0, 0, 8, 0, 0, 72, 72, 72, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0,
+    0, 0, 255, 233, 255, 16, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 233, 255, 16, 0, 0, 0,
+    0, 0, 0, 60, 60, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 227, 255, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 0, 0,
+    0, 0, 0, 0, 0, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 72, 72, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0,
+    253, 0, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0,
+    0, 0, 255, 16, 0, 4, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 16, 0, 4, 0, 0,
+    0, 0, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 0, 0,
+    0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0,
+    0, 255, 16, 0, 6, 0, 0, 0, 8, 0, 0, 72, 72, 72, 72, 72, 72, 72, 254, 0, 2, 5, 8, 0, 0, 72, 72, 72, 72, 72,
+    72, 72, 72, 254, 0, 2, 251, 8, 0, 0, 72, 72, 72, 72, 72, 72, 72, 254, 254, 0, 0, 0, 0, 0, 60, 60, 255, 0, 128, 4,
+    0, 2, 0, 0, 0, 0, 17, 52, 255, 10, 0, 54, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0,
+    1, 250, 0, 0, 0, 255, 10, 0, 54, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 10, 0, 54, 0,
+    0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 10, 0, 54, 0, 0, 0, 16, 0, 0, 64, 64, 64, 255, 0,
+    128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 16, 0, 54, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0,
+    0, 0, 0, 0, 0, 72, 255, 16, 0, 54, 0, 0, 0, 8, 0, 0, 72, 72, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 16,
+    0, 60, 0, 0, 0, 8, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 15, 0, 0, 0, 16, 0, 0, 64, 64,
+    255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0,
+    128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0,
+    2, 0, 0, 0, 0, 17, 52, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1,
+    250, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 4, 0, 15, 0, 0,
+    0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 6, 0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 64,
+    64, 254, 2, 0, 5, 16, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 254, 2, 0, 251, 16, 0, 0, 64, 64, 64, 64, 64, 64, 64,
+    254, 0, 2, 0, 8, 0, 0, 72, 72, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 54, 0, 21, 0, 0, 0, 16, 0,
+    0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 54, 0, 21, 0, 0, 0, 16, 0, 0, 255, 0,
+    128, 2, 0, 0, 0, 0, 0, 0, 255, 54, 0, 21, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 54,
+    0, 21, 0, 0, 0, 24, 0, 0, 52, 52, 52, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 54,
+    0, 15, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 54, 0, 15, 0, 0, 0, 16, 0, 0, 64,
+    64, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 60, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0,
+    0, 255, 15, 0, 31, 0, 0, 0, 24, 0, 0, 52, 52, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0,
+    0, 255, 15, 0, 27, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 15,
+    0, 27, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0,
+    255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128,
+    2, 0, 0, 0, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 15, 0,
+    25, 0, 0, 0, 24, 0, 0, 52, 52, 52, 52, 52, 52, 52, 254, 0, 254, 5, 24, 0, 0, 52, 52, 52, 52, 52, 52, 52, 52, 254,
+    0, 254, 251, 24, 0, 0, 52, 52, 52, 52, 52, 52, 52, 254, 2, 0, 0, 16, 0, 0, 64, 64, 255, 0, 128, 4, 0, 2, 0, 0,
+    0, 0, 17, 52, 255, 21, 0, 233, 255, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0,
+    0, 255, 21, 0, 233, 255, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 21, 0, 233, 255, 0, 0, 24, 0,
+    0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 21, 0, 233, 255, 0, 0, 0, 0, 0, 60, 60, 60, 255, 0, 128, 4, 0, 3,
+    0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 15, 0, 233, 255, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0,
+    0, 72, 255, 15, 0, 233, 255, 0, 0, 24, 0, 0, 52, 52, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 15, 0, 227, 255, 0,
+    0, 24, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 60, 60, 255, 0, 128, 4,
+    0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 5,
+    0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0,
+    0, 17, 52, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0,
+    255, 27, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0,
+    255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 25, 0, 16, 0, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 254, 0, 2, 0, 8,
+    0, 0, 72, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 15, 0, 20, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0,
+    6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 15, 0, 20, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0,
+    0, 0, 255, 15, 0, 20, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 13, 0, 20, 0, 0, 0, 0,
+    0, 0, 60, 60, 60, 60, 60, 60, 60, 60, 254, 0, 2, 0, 8, 0, 0, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 254, 254, 0,
+    0, 0, 0, 0, 60, 60, 60, 60, 60, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 240, 255, 41, 0, 0, 0, 0, 0,
+    0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 240, 255, 41, 0, 0, 0, 0, 0, 0, 255, 0,
+    128, 2, 0, 0, 0, 0, 0, 0, 255, 240, 255, 41, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 239,
+    255, 43, 0, 0, 0, 8, 0, 0, 72, 72, 72, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 239,
+    255, 49, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 239, 255, 48, 0, 0, 0, 8, 0, 0, 72,
+    72, 72, 72, 72, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 239, 255, 60, 0, 0, 0, 8, 0, 0, 255, 0, 128, 0, 0, 0,
+    0, 0, 0, 0, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 72, 72, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253,
+    0, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0,
+    0, 255, 16, 0, 4, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 16, 0, 4, 0, 0, 0,
+    0, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 0, 0, 0,
+    255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0,
+    255, 16, 0, 6, 0, 0, 0, 8, 0, 0, 72, 72, 72, 72, 72, 254, 2, 0, 0, 16, 0, 0, 64, 255, 0, 128, 4, 0, 2, 0,
+    0, 0, 0, 17, 52, 255, 20, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0,
+    0, 0, 255, 20, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 20, 0, 16, 0, 0, 0, 0,
+    0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 20, 0, 18, 0, 0, 0, 8, 0, 0, 72, 72, 72, 72, 72, 72, 72, 72,
+    254, 2, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 254, 0, 2, 0, 8, 0, 0, 72, 72, 72, 72, 72, 255,
+    0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 41, 0, 47, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0,
+    0, 254, 0, 1, 250, 0, 0, 0, 255, 41, 0, 47, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 41,
+    0, 47, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 43, 0, 48, 0, 0, 0, 16, 0, 0, 64, 64,
+    64, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 49, 0, 48, 0, 0, 0, 16, 0, 0, 255, 0,
+    128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 48, 0, 48, 0, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 255, 0, 128, 3, 0, 0,
+    0, 0, 0, 0, 255, 60, 0, 48, 0, 0, 0, 16, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 15, 0, 0,
+    0, 16, 0, 0, 64, 64, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 4, 0, 15, 0, 0,
+    0, 16, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 16, 0,
+    0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 6, 0,
+    0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0,
+    255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 6, 0, 15, 0, 0, 0, 16, 0, 0,
+    64, 64, 64, 64, 64, 254, 0, 254, 0, 24, 0, 0, 52, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 16, 0, 11, 0,
+    0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 16, 0, 11, 0, 0, 0, 8,
+    0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 16, 0, 11, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0,
+    0, 0, 255, 18, 0, 11, 0, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 254, 0, 254, 0, 24, 0, 0, 52, 52, 52,
+    52, 52, 52, 52, 52, 52, 52, 254, 2, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17,
+    52, 255, 47, 0, 246, 255, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 47,
+    0, 246, 255, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 47, 0, 246, 255, 0, 0, 16, 0, 0, 255, 0,
+    128, 4, 0, 0, 0, 0, 0, 0, 255, 48, 0, 244, 255, 0, 0, 24, 0, 0, 52, 52, 52, 255, 0, 128, 4, 0, 3, 0, 0, 0,
+    0, 254, 0, 1, 253, 0, 0, 0, 255, 48, 0, 238, 255, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255,
+    48, 0, 239, 255, 0, 0, 24, 0, 0, 52, 52, 52, 52, 52, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 48, 0, 227, 255, 0,
+    0, 24, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 15, 0, 31, 0, 0, 0, 24, 0, 0, 52, 52, 255, 0, 128, 4,
+    0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 5,
+    0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0,
+    0, 17, 52, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0,
+    255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0,
+    255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 15, 0, 25, 0, 0, 0, 24, 0, 0, 52, 52, 52, 52, 52, 254, 254, 0, 0, 0,
+    0, 0, 60, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 11, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0,
+    6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 11, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0,
+    0, 0, 255, 11, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 11, 0, 13, 0, 0, 0, 24,
+    0, 0, 52, 52, 52, 52, 52, 52, 52, 52, 254, 254, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 254, 0, 254,
+    0, 24, 0, 0, 52, 52, 52, 52, 52, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 246, 255, 240, 255, 0, 0, 24, 0,
+    0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 246, 255, 240, 255, 0, 0, 24, 0, 0, 255, 0,
+    128, 2, 0, 0, 0, 0, 0, 0, 255, 246, 255, 240, 255, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 244,
+    255, 239, 255, 0, 0, 0, 0, 0, 60, 60, 60, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 238,
+    255, 239, 255, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 239, 255, 239, 255, 0, 0, 0, 0, 0, 60,
+    60, 60, 60, 60, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 227, 255, 239, 255, 0, 0, 0, 0, 0, 255, 0, 128, 0, 0, 0,
+    0, 0, 0, 0, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 60, 60, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253,
+    0, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0,
+    0, 255, 27, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 27, 0, 16, 0, 0, 0,
+    24, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0,
+    255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0,
+    255, 25, 0, 16, 0, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 254, 0, 254, 0, 8, 0, 0, 52, 255, 0, 128, 4, 0, 2, 0,
+    0, 0, 0, 17, 52, 255, 15, 0, 12, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0,
+    0, 0, 255, 15, 0, 12, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 15, 0, 12, 0, 0, 0, 24,
+    0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 13, 0, 12, 0, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 60, 60, 60,
+    254, 0, 254, 0, 24, 0, 0, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 254, 254, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 255,
+    0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 240, 255, 247, 255, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0,
+    0, 254, 0, 1, 250, 0, 0, 0, 255, 240, 255, 247, 255, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 240,
+    255, 247, 255, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 239, 255, 245, 255, 0, 0, 24, 0, 0, 52, 52,
+    52, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 239, 255, 239, 255, 0, 0, 24, 0, 0, 255, 0,
+    128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 239, 255, 240, 255, 0, 0, 24, 0, 0, 52, 52, 52, 52, 52, 255, 0, 128, 3, 0, 0,
+    0, 0, 0, 0, 255, 239, 255, 228, 255, 0, 0, 24, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 16, 0, 0, 0, 0,
+    0, 8, 0, 0, 72, 72, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 16, 0, 4, 0, 0,
+    0, 8, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 8, 0,
+    0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 16, 0, 4, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 6, 0,
+    0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 0, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0,
+    255, 16, 0, 4, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 16, 0, 6, 0, 0, 0, 8, 0, 0,
+    72, 72, 72, 72, 72, 254, 254, 0, 0, 16, 0, 0, 60, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 12, 0, 16, 0,
+    0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 12, 0, 16, 0, 0, 0, 0,
+    0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 12, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0,
+    0, 0, 255, 12, 0, 18, 0, 0, 0, 8, 0, 0, 72, 72, 72, 72, 72, 72, 72, 72, 254, 254, 0, 0, 0, 0, 0, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 254, 0, 2, 0, 8, 0, 0, 72, 72, 72, 72, 72, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17,
+    52, 255, 247, 255, 47, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 247,
+    255, 47, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 247, 255, 47, 0, 0, 0, 24, 0, 0, 255, 0,
+    128, 4, 0, 0, 0, 0, 0, 0, 255, 245, 255, 48, 0, 0, 0, 0, 0, 0, 60, 60, 60, 255, 0, 128, 4, 0, 3, 0, 0, 0,
+    0, 254, 0, 1, 253, 0, 0, 0, 255, 239, 255, 48, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255,
+    240, 255, 48, 0, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 228, 255, 48, 0, 0,
+    0, 0, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 255, 0, 128, 4,
+    0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 5,
+    0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0,
+    0, 17, 52, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0,
+    255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0,
+    255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 6, 0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 254, 0, 2, 0, 24,
+    0, 0, 72, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 16, 0, 19, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0,
+    6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 16, 0, 19, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0,
+    0, 0, 255, 16, 0, 19, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 18, 0, 19, 0, 0, 0, 16,
+    0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 254, 0, 2, 0, 8, 0, 0, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 254, 2, 0,
+    0, 16, 0, 0, 64, 64, 64, 64, 64, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 47, 0, 40, 0, 0, 0, 0, 0,
+    0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 47, 0, 40, 0, 0, 0, 0, 0, 0, 255, 0,
+    128, 2, 0, 0, 0, 0, 0, 0, 255, 47, 0, 40, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 48,
+    0, 42, 0, 0, 0, 8, 0, 0, 72, 72, 72, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 48,
+    0, 48, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 48, 0, 47, 0, 0, 0, 8, 0, 0, 72,
+    72, 72, 72, 72, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 48, 0, 59, 0, 0, 0, 8, 0, 0, 255, 0, 128, 0, 0, 0,
+    0, 0, 0, 0, 255, 15, 0, 31, 0, 0, 0, 24, 0, 0, 52, 52, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253,
+    0, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0,
+    0, 255, 15, 0, 27, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 15, 0, 27, 0, 0, 0,
+    16, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0,
+    255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0,
+    255, 15, 0, 25, 0, 0, 0, 24, 0, 0, 52, 52, 52, 52, 52, 254, 2, 0, 0, 0, 0, 0, 64, 255, 0, 128, 4, 0, 2, 0,
+    0, 0, 0, 17, 52, 255, 19, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0,
+    0, 0, 255, 19, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 19, 0, 15, 0, 0, 0, 16,
+    0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 19, 0, 13, 0, 0, 0, 24, 0, 0, 52, 52, 52, 52, 52, 52, 52, 52,
+    254, 2, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 254, 0, 254, 0, 24, 0, 0, 52, 52, 52, 52, 52, 255,
+    0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 40, 0, 240, 255, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0,
+    0, 254, 0, 1, 250, 0, 0, 0, 255, 40, 0, 240, 255, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 40,
+    0, 240, 255, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 42, 0, 239, 255, 0, 0, 16, 0, 0, 64, 64,
+    64, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 48, 0, 239, 255, 0, 0, 16, 0, 0, 255, 0,
+    128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 47, 0, 239, 255, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 255, 0, 128, 3, 0, 0,
+    0, 0, 0, 0, 255, 59, 0, 239, 255, 0, 0, 16, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 31, 0, 16, 0, 0,
+    0, 0, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 26, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 1,
+    0, 0, 0, 0, 255, 26, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 25, 0, 16, 0, 0,
+    0, 0, 0, 0, 60, 60, 60, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 0, 128, 2, 0, 0, 0,
+    0, 0, 0, 67, 255, 2, 0, 16, 0, 0, 0, 0, 0, 0, 61, 60, 60, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 227, 255, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0,
+    0, 254, 0, 253, 0, 0, 0, 0, 255, 227, 255, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 16,
+    0, 0, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 16, 0, 5, 0, 0, 0, 8, 0, 0, 255, 0,
+    128, 4, 0, 1, 0, 0, 0, 0, 255, 16, 0, 5, 0, 0, 0, 8, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 16,
+    0, 6, 0, 0, 0, 8, 0, 0, 72, 72, 72, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255, 0, 128,
+    2, 0, 0, 0, 0, 0, 0, 67, 255, 16, 0, 29, 0, 0, 0, 8, 0, 0, 67, 72, 72, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 16, 0, 60, 0, 0, 0, 8, 0, 0, 255, 0, 128, 6, 0,
+    0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 16, 0, 60, 0, 0, 0, 8, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0,
+    0, 0, 255, 0, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 5, 0, 15, 0, 0, 0, 16,
+    0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 5, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0,
+    0, 0, 255, 6, 0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 64, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 29, 0, 15, 0, 0, 0, 16, 0, 0, 63, 64, 64, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 60, 0, 15, 0, 0, 0, 16, 0, 0, 255,
+    0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 60, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 0,
+    0, 0, 0, 0, 0, 0, 255, 15, 0, 31, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 15, 0, 26,
+    0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 15, 0, 26, 0, 0, 0, 24, 0, 0, 255, 0, 128, 3,
+    0, 0, 0, 0, 0, 0, 255, 15, 0, 25, 0, 0, 0, 24, 0, 0, 52, 52, 52, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 15, 0, 2, 0, 0, 0, 24, 0, 0, 57, 52, 52, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 15, 0, 227, 255, 0, 0,
+    24, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 15, 0, 227, 255, 0, 0, 24, 0, 0,
+    255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0,
+    255, 26, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 26, 0, 16, 0, 0, 0, 0, 0, 0,
+    255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 25, 0, 16, 0, 0, 0, 0, 0, 0, 254, 253, 255, 0, 0, 0, 0, 60, 60, 55,
+    60, 55, 60, 60, 55, 60, 55, 61, 61, 67, 67, 67, 68, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 1, 0, 16, 0, 0,
+    0, 0, 0, 0, 60, 60, 61, 61, 67, 67, 67, 67, 67, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 251, 255, 22, 0, 0,
+    0, 0, 0, 0, 60, 55, 60, 55, 60, 61, 56, 61, 56, 61, 61, 56, 61, 61, 56, 61, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0,
+    52, 255, 227, 255, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 227,
+    255, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 255, 0,
+    128, 2, 0, 0, 0, 0, 0, 0, 255, 16, 0, 5, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 16,
+    0, 5, 0, 0, 0, 8, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 16, 0, 6, 0, 0, 0, 8, 0, 0, 254, 255,
+    3, 0, 8, 0, 0, 72, 72, 71, 72, 71, 72, 72, 71, 72, 71, 67, 67, 63, 63, 63, 58, 255, 0, 128, 2, 0, 0, 0, 0, 0,
+    0, 67, 255, 16, 0, 30, 0, 0, 0, 8, 0, 0, 72, 72, 67, 67, 63, 63, 63, 63, 63, 255, 0, 128, 2, 0, 0, 0, 0, 0,
+    0, 67, 255, 22, 0, 36, 0, 0, 0, 8, 0, 0, 72, 71, 72, 71, 72, 67, 66, 67, 66, 67, 67, 66, 67, 67, 66, 67, 255, 0,
+    128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 16, 0, 60, 0, 0, 0, 8, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254,
+    0, 253, 0, 0, 0, 0, 255, 16, 0, 60, 0, 0, 0, 8, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 15,
+    0, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 5, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4,
+    0, 1, 0, 0, 0, 0, 255, 5, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 6, 0, 15,
+    0, 0, 0, 16, 0, 0, 254, 3, 1, 0, 16, 0, 0, 64, 64, 69, 64, 69, 64, 64, 69, 64, 69, 63, 63, 57, 57, 57, 56, 255,
+    0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 30, 0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 63, 63, 57, 57, 57, 57, 57, 255,
+    0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 36, 0, 9, 0, 0, 0, 16, 0, 0, 64, 69, 64, 69, 64, 63, 68, 63, 68, 63,
+    63, 68, 63, 63, 68, 63, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 60, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128,
+    6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 60, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 0, 0, 0,
+    0, 0, 0, 0, 255, 15, 0, 31, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 15, 0, 26, 0, 0,
+    0, 24, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 15, 0, 26, 0, 0, 0, 24, 0, 0, 255, 0, 128, 3, 0, 0,
+    0, 0, 0, 0, 255, 15, 0, 25, 0, 0, 0, 24, 0, 0, 254, 1, 253, 0, 24, 0, 0, 52, 52, 53, 52, 53, 52, 52, 53, 52,
+    53, 57, 57, 61, 61, 61, 66, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 15, 0, 1, 0, 0, 0, 24, 0, 0, 52, 52,
+    57, 57, 61, 61, 61, 61, 61, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 9, 0, 251, 255, 0, 0, 24, 0, 0, 52, 53,
+    52, 53, 52, 57, 58, 57, 58, 57, 57, 58, 57, 57, 58, 57, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 15, 0, 227, 255,
+    0, 0, 24, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 15, 0, 227, 255, 0, 0, 24,
+    0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0,
+    0, 0, 255, 26, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 26, 0, 16, 0, 0, 0, 0,
+    0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 24, 0, 16, 0, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254,
+    253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 60, 60, 60, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 7, 0, 15,
+    0, 0, 0, 0, 0, 0, 60, 55, 55, 60, 55, 60, 55, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 248, 255, 11, 0, 0, 0,
+    0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 233,
+    255, 11, 0, 0, 0, 0, 0, 0, 67, 67, 67, 67, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 227, 255, 16, 0, 0, 0,
+    0, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0,
+    255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 16, 0, 5, 0, 0, 0, 8, 0, 0,
+    255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 16, 0, 5, 0, 0, 0, 8, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0,
+    255, 16, 0, 7, 0, 0, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0,
+    0, 72, 72, 72, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 15, 0, 24, 0, 0, 0, 8, 0, 0, 72, 71, 71, 72, 71, 72,
+    71, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 11, 0, 39, 0, 0, 0, 8, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 11, 0, 54, 0, 0, 0, 8, 0, 0, 63, 63, 63, 63,
+    255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 16, 0, 60, 0, 0, 0, 8, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0,
+    0, 254, 0, 253, 0, 0, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0,
+    128, 2, 0, 0, 0, 0, 0, 0, 255, 5, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 5,
+    0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 7, 0, 15, 0, 0, 0, 16, 0, 0, 254, 3,
+    0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 64, 64, 64, 255, 0, 128, 4, 0, 0, 0, 0,
+    0, 0, 255, 24, 0, 16, 0, 0, 0, 16, 0, 0, 64, 69, 69, 64, 69, 64, 69, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255,
+    39, 0, 20, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 255, 0, 128, 2, 0, 0, 0,
+    0, 0, 0, 67, 255, 54, 0, 20, 0, 0, 0, 16, 0, 0, 57, 57, 57, 57, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255,
+    60, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 0, 128, 0,
+    0, 0, 0, 0, 0, 0, 255, 15, 0, 31, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 15, 0, 26,
+    0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 15, 0, 26, 0, 0, 0, 24, 0, 0, 255, 0, 128, 3,
+    0, 0, 0, 0, 0, 0, 255, 15, 0, 24, 0, 0, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0,
+    254, 0, 253, 0, 24, 0, 0, 52, 52, 52, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 16, 0, 7, 0, 0, 0, 24, 0, 0,
+    52, 53, 53, 52, 53, 52, 53, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 20, 0, 248, 255, 0, 0, 24, 0, 0, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 20, 0, 233, 255, 0, 0, 24,
+    0, 0, 61, 61, 61, 61, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 15, 0, 227, 255, 0, 0, 24, 0, 0, 255, 0, 128,
+    6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 31, 0, 16, 0, 0,
+    0, 0, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 26, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 1,
+    0, 0, 0, 0, 255, 26, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 24, 0, 16, 0, 0,
+    0, 0, 0, 0, 254, 253, 1, 0, 0, 0, 0, 60, 60, 55, 70, 60, 60, 60, 60, 61, 66, 61, 61, 61, 61, 61, 63, 63, 63, 63,
+    63, 63, 63, 68, 63, 63, 63, 63, 63, 63, 63, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 14, 0, 20, 0, 0, 0, 0,
+    0, 0, 60, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0,
+    0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0,
+    0, 0, 255, 244, 255, 20, 0, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255,
+    238, 255, 16, 0, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 56, 51, 51, 51, 54, 79, 54,
+    59, 64, 94, 64, 72, 73, 98, 72, 73, 71, 72, 72, 71, 72, 72, 71, 72, 67, 67, 66, 67, 67, 67, 67, 254, 0, 2, 253, 0, 0,
+    0, 71, 67, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 240, 255, 42, 0, 0, 0, 0, 0, 0, 67, 67, 67, 66, 67, 67,
+    67, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 239, 255, 60, 0, 0, 0, 8, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0,
+    0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 239, 255, 60, 0, 0, 0, 8, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255,
+    16, 0, 0, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 16, 0, 5, 0, 0, 0, 8, 0, 0, 255,
+    0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 16, 0, 5, 0, 0, 0, 8, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255,
+    16, 0, 7, 0, 0, 0, 8, 0, 0, 254, 1, 3, 0, 8, 0, 0, 72, 72, 71, 74, 72, 72, 72, 72, 67, 68, 67, 67, 67, 67,
+    67, 57, 57, 57, 57, 57, 57, 57, 58, 57, 57, 57, 57, 57, 57, 57, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 20, 0,
+    17, 0, 0, 0, 8, 0, 0, 72, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254,
+    0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 255, 0, 128,
+    4, 0, 0, 0, 0, 0, 0, 255, 20, 0, 43, 0, 0, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 255, 0, 128, 4, 0, 1,
+    0, 0, 0, 0, 255, 16, 0, 49, 0, 0, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 66, 65,
+    65, 65, 50, 75, 50, 51, 52, 78, 52, 64, 59, 84, 64, 59, 69, 64, 64, 69, 64, 64, 69, 64, 63, 63, 68, 63, 63, 63, 63, 254,
+    2, 0, 253, 8, 0, 0, 69, 63, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 42, 0, 47, 0, 0, 0, 8, 0, 0, 63,
+    63, 63, 68, 63, 63, 63, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 60, 0, 48, 0, 0, 0, 16, 0, 0, 255, 0, 128,
+    6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 60, 0, 48, 0, 0, 0, 16, 0, 0, 255, 0, 128, 0, 0, 0,
+    0, 0, 0, 0, 255, 0, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 5, 0, 15, 0, 0,
+    0, 16, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 5, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 3, 0, 0,
+    0, 0, 0, 0, 255, 7, 0, 15, 0, 0, 0, 16, 0, 0, 254, 3, 255, 0, 16, 0, 0, 64, 64, 69, 54, 64, 64, 64, 64, 63,
+    58, 63, 63, 63, 63, 63, 61, 61, 61, 61, 61, 61, 61, 56, 61, 61, 61, 61, 61, 61, 61, 255, 0, 128, 2, 0, 0, 0, 0, 0,
+    0, 67, 255, 17, 0, 11, 0, 0, 0, 16, 0, 0, 64, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0,
+    0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16,
+    0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 43, 0, 11, 0, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 255,
+    0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 49, 0, 15, 0, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0,
+    16, 0, 0, 68, 73, 73, 73, 70, 95, 70, 65, 60, 80, 60, 52, 51, 76, 52, 51, 53, 52, 52, 53, 52, 52, 53, 52, 57, 57, 58,
+    57, 57, 57, 57, 254, 0, 254, 253, 16, 0, 0, 53, 57, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 47, 0, 245, 255, 0,
+    0, 16, 0, 0, 57, 57, 57, 58, 57, 57, 57, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 48, 0, 227, 255, 0, 0, 24,
+    0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 48, 0, 227, 255, 0, 0, 24, 0, 0, 255,
+    0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 15, 0, 31, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255,
+    15, 0, 26, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 15, 0, 26, 0, 0, 0, 24, 0, 0, 255,
+    0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 15, 0, 24, 0, 0, 0, 24, 0, 0, 254, 255, 253, 0, 24, 0, 0, 52, 52, 53, 50,
+    52, 52, 52, 52, 57, 56, 57, 57, 57, 57, 57, 67, 67, 67, 67, 67, 67, 67, 66, 67, 67, 67, 67, 67, 67, 67, 255, 0, 128, 2,
+    0, 0, 0, 0, 0, 0, 67, 255, 11, 0, 14, 0, 0, 0, 24, 0, 0, 52, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24,
+    0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0,
+    254, 0, 253, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 11, 0, 244, 255, 0, 0, 24, 0, 0, 254, 0, 253,
+    0, 24, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 15, 0, 238, 255, 0, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0,
+    0, 254, 0, 253, 0, 24, 0, 0, 58, 59, 59, 59, 74, 99, 74, 73, 72, 96, 72, 60, 65, 90, 60, 65, 55, 60, 60, 55, 60, 60,
+    55, 60, 61, 61, 56, 61, 61, 61, 61, 254, 254, 0, 253, 24, 0, 0, 55, 61, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255,
+    245, 255, 240, 255, 0, 0, 24, 0, 0, 61, 61, 61, 56, 61, 61, 61, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 227, 255,
+    239, 255, 0, 0, 0, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 227, 255, 239, 255, 0,
+    0, 0, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 2, 0, 0,
+    0, 0, 0, 0, 255, 26, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 26, 0, 16, 0, 0,
+    0, 0, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 24, 0, 16, 0, 0, 0, 0, 0, 0, 254, 253, 255, 0, 0, 0,
+    0, 60, 60, 65, 50, 60, 60, 60, 60, 61, 56, 61, 61, 61, 61, 61, 63, 63, 63, 63, 63, 63, 63, 58, 63, 63, 63, 63, 63, 63,
+    63, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 14, 0, 12, 0, 0, 0, 0, 0, 0, 60, 254, 253, 0, 0, 0, 0, 0,
+    254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253,
+    0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 244, 255, 12, 0, 0, 0, 0,
+    0, 0, 254, 253, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 238, 255, 16, 0, 0, 0, 0, 0, 0, 254,
+    253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 66, 71, 71, 71, 74, 99, 74, 69, 64, 84, 64, 52, 53, 78, 52, 53, 51,
+    52, 52, 51, 52, 52, 51, 52, 57, 57, 56, 57, 57, 57, 57, 254, 0, 254, 253, 0, 0, 0, 51, 57, 255, 0, 128, 2, 0, 0, 0,
+    0, 0, 0, 67, 255, 240, 255, 246, 255, 0, 0, 0, 0, 0, 57, 57, 57, 56, 57, 57, 57, 255, 0, 128, 4, 0, 0, 0, 0, 0,
+    0, 52, 255, 239, 255, 228, 255, 0, 0, 24, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255,
+    239, 255, 228, 255, 0, 0, 24, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 255,
+    0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 16, 0, 5, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255,
+    16, 0, 5, 0, 0, 0, 8, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 16, 0, 7, 0, 0, 0, 8, 0, 0, 254,
+    255, 3, 0, 8, 0, 0, 72, 72, 73, 70, 72, 72, 72, 72, 67, 66, 67, 67, 67, 67, 67, 57, 57, 57, 57, 57, 57, 57, 56, 57,
+    57, 57, 57, 57, 57, 57, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 12, 0, 17, 0, 0, 0, 8, 0, 0, 72, 254, 0,
+    3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0,
+    8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 12, 0,
+    43, 0, 0, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 16, 0, 49, 0, 0,
+    0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 68, 69, 69, 69, 54, 79, 54, 53, 52, 76, 52, 60,
+    55, 80, 60, 55, 65, 60, 60, 65, 60, 60, 65, 60, 61, 61, 66, 61, 61, 61, 61, 254, 254, 0, 253, 8, 0, 0, 65, 61, 255, 0,
+    128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 246, 255, 47, 0, 0, 0, 8, 0, 0, 61, 61, 61, 66, 61, 61, 61, 255, 0, 128, 4,
+    0, 0, 0, 0, 0, 0, 52, 255, 228, 255, 48, 0, 0, 0, 0, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253,
+    0, 0, 0, 0, 255, 228, 255, 48, 0, 0, 0, 0, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 15, 0, 0,
+    0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 5, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 1,
+    0, 0, 0, 0, 255, 5, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 7, 0, 15, 0, 0,
+    0, 16, 0, 0, 254, 3, 1, 0, 16, 0, 0, 64, 64, 59, 74, 64, 64, 64, 64, 63, 68, 63, 63, 63, 63, 63, 61, 61, 61, 61,
+    61, 61, 61, 66, 61, 61, 61, 61, 61, 61, 61, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 17, 0, 19, 0, 0, 0, 16,
+    0, 0, 64, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0,
+    0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0,
+    0, 0, 255, 43, 0, 19, 0, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255,
+    49, 0, 15, 0, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 58, 53, 53, 53, 50, 75, 50,
+    55, 60, 90, 60, 72, 71, 96, 72, 71, 73, 72, 72, 73, 72, 72, 73, 72, 67, 67, 68, 67, 67, 67, 67, 254, 0, 2, 253, 16, 0,
+    0, 73, 67, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 47, 0, 41, 0, 0, 0, 16, 0, 0, 67, 67, 67, 68, 67, 67,
+    67, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 48, 0, 59, 0, 0, 0, 8, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0,
+    0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 48, 0, 59, 0, 0, 0, 8, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255,
+    15, 0, 31, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 15, 0, 26, 0, 0, 0, 24, 0, 0, 255,
+    0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 15, 0, 26, 0, 0, 0, 24, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255,
+    15, 0, 24, 0, 0, 0, 24, 0, 0, 254, 1, 253, 0, 24, 0, 0, 52, 52, 51, 54, 52, 52, 52, 52, 57, 58, 57, 57, 57, 57,
+    57, 67, 67, 67, 67, 67, 67, 67, 68, 67, 67, 67, 67, 67, 67, 67, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 19, 0,
+    14, 0, 0, 0, 24, 0, 0, 52, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254,
+    0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 255, 0, 128,
+    4, 0, 0, 0, 0, 0, 0, 255, 19, 0, 244, 255, 0, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 255, 0, 128, 4, 0, 1,
+    0, 0, 0, 0, 255, 15, 0, 238, 255, 0, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 56, 55,
+    55, 55, 70, 95, 70, 71, 72, 98, 72, 64, 69, 94, 64, 69, 59, 64, 64, 59, 64, 64, 59, 64, 63, 63, 58, 63, 63, 63, 63, 254,
+    2, 0, 253, 24, 0, 0, 59, 63, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 41, 0, 240, 255, 0, 0, 24, 0, 0, 63,
+    63, 63, 58, 63, 63, 63, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 59, 0, 239, 255, 0, 0, 16, 0, 0, 255, 0, 128,
+    6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 59, 0, 239, 255, 0, 0, 16, 0, 0, 255, 0, 128, 0, 0, 0,
+    0, 0, 0, 0, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 60, 60, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253,
+    0, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0,
+    0, 255, 27, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 27, 0, 16, 0, 0, 0,
+    24, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0,
+    255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0,
+    255, 25, 0, 16, 0, 0, 0, 0, 0, 0, 60, 60, 60, 61, 254, 253, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    60, 60, 60, 254, 0, 254, 0, 24, 0, 0, 52, 57, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 247, 255, 11, 0, 0,
+    0, 24, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 247, 255, 11, 0, 0, 0, 24, 0,
+    0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 247, 255, 11, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0,
+    0, 255, 247, 255, 12, 0, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 60, 60, 60, 254, 0, 2, 0, 8, 0, 0, 72, 72, 255, 0,
+    128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 231, 255, 18, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0,
+    254, 0, 1, 250, 0, 0, 0, 255, 231, 255, 18, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 231, 255,
+    18, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 233, 255, 18, 0, 0, 0, 16, 0, 0, 64, 64, 64,
+    64, 254, 0, 254, 0, 8, 0, 0, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 241, 255, 16, 0,
+    0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 239, 255, 16, 0, 0, 0, 0, 0, 0, 60, 60, 60, 60,
+    60, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 227, 255, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0,
+    0, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 72, 72, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0,
+    0, 255, 16, 0, 4, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 16,
+    0, 4, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 16, 0, 4, 0, 0, 0, 0, 0, 0,
+    255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 0, 0, 0, 255, 0, 128,
+    2, 0, 0, 0, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 16, 0,
+    6, 0, 0, 0, 8, 0, 0, 72, 72, 72, 67, 254, 0, 3, 0, 8, 0, 0, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+    254, 254, 0, 0, 0, 0, 0, 60, 61, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 11, 0, 40, 0, 0, 0, 0, 0,
+    0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 11, 0, 40, 0, 0, 0, 0, 0, 0, 255, 0,
+    128, 2, 0, 0, 0, 0, 0, 0, 255, 11, 0, 40, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 12,
+    0, 40, 0, 0, 0, 8, 0, 0, 72, 72, 72, 72, 72, 72, 72, 72, 254, 2, 0, 0, 16, 0, 0, 64, 64, 255, 0, 128, 4, 0,
+    2, 0, 0, 0, 0, 17, 52, 255, 18, 0, 56, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1,
+    250, 0, 0, 0, 255, 18, 0, 56, 0, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 18, 0, 56, 0, 0,
+    0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 18, 0, 54, 0, 0, 0, 24, 0, 0, 52, 52, 52, 52, 254, 254,
+    0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 16, 0, 46, 0, 0, 0, 16,
+    0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 16, 0, 48, 0, 0, 0, 8, 0, 0, 72, 72, 72, 72, 72, 255, 0,
+    128, 3, 0, 0, 0, 0, 0, 0, 255, 16, 0, 60, 0, 0, 0, 8, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 0,
+    0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 4,
+    0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 4, 0, 15, 0,
+    0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128,
+    4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0,
+    0, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 6, 0, 15, 0, 0,
+    0, 16, 0, 0, 64, 64, 64, 63, 254, 3, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 254, 0, 2,
+    0, 8, 0, 0, 72, 67, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 40, 0, 20, 0, 0, 0, 8, 0, 0, 255, 0,
+    128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 40, 0, 20, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0,
+    0, 0, 0, 0, 0, 255, 40, 0, 20, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 40, 0, 19, 0,
+    0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 254, 0, 254, 0, 24, 0, 0, 52, 52, 255, 0, 128, 4, 0, 2, 0, 0,
+    0, 0, 17, 52, 255, 56, 0, 13, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0,
+    0, 255, 56, 0, 13, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 56, 0, 13, 0, 0, 0, 24, 0,
+    0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 54, 0, 13, 0, 0, 0, 0, 0, 0, 60, 60, 60, 60, 254, 0, 2, 0, 24,
+    0, 0, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 46, 0, 15, 0, 0, 0, 24, 0, 0, 255,
+    0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 48, 0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 255, 0, 128, 3, 0,
+    0, 0, 0, 0, 0, 255, 60, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 15, 0, 31, 0,
+    0, 0, 24, 0, 0, 52, 52, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 15, 0, 27, 0,
+    0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 24,
+    0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 6,
+    0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0,
+    0, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 15, 0, 25, 0, 0, 0, 24, 0,
+    0, 52, 52, 52, 57, 254, 0, 253, 0, 24, 0, 0, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 254, 2, 0, 0, 16, 0,
+    0, 64, 63, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 20, 0, 247, 255, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0,
+    6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 20, 0, 247, 255, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0,
+    0, 0, 255, 20, 0, 247, 255, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 19, 0, 247, 255, 0, 0, 24,
+    0, 0, 52, 52, 52, 52, 52, 52, 52, 52, 254, 254, 0, 0, 0, 0, 0, 60, 60, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17,
+    52, 255, 13, 0, 231, 255, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 13,
+    0, 231, 255, 0, 0, 0, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 13, 0, 231, 255, 0, 0, 0, 0, 0, 255, 0,
+    128, 4, 0, 0, 0, 0, 0, 0, 255, 13, 0, 233, 255, 0, 0, 8, 0, 0, 72, 72, 72, 72, 254, 2, 0, 0, 0, 0, 0, 255,
+    0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 15, 0, 241, 255, 0, 0, 0, 0, 0, 255, 0, 128, 4,
+    0, 0, 0, 0, 0, 0, 72, 255, 15, 0, 239, 255, 0, 0, 24, 0, 0, 52, 52, 52, 52, 52, 255, 0, 128, 3, 0, 0, 0, 0,
+    0, 0, 255, 15, 0, 227, 255, 0, 0, 24, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 31, 0, 16, 0, 0, 0, 0,
+    0, 0, 60, 60, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 0,
+    0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 0, 0, 0, 255,
+    0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0,
+    0, 254, 0, 1, 250, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 27,
+    0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 25, 0, 16, 0, 0, 0, 0, 0, 0, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 254, 0, 254, 0, 24, 0, 0, 52, 255, 0,
+    128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 237, 255, 12, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0,
+    254, 0, 1, 250, 0, 0, 0, 255, 237, 255, 12, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 237, 255,
+    12, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 237, 255, 14, 0, 0, 0, 8, 0, 0, 72, 254, 254,
+    0, 0, 0, 0, 0, 60, 60, 60, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 229, 255, 16, 0,
+    0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 229, 255, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 3,
+    0, 0, 0, 0, 0, 0, 255, 227, 255, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 16, 0, 0,
+    0, 0, 0, 8, 0, 0, 72, 72, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0, 255, 16, 0, 4,
+    0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0,
+    8, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 16, 0, 4, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0,
+    6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 0, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0,
+    0, 0, 255, 16, 0, 4, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 16, 0, 6, 0, 0, 0, 8,
+    0, 0, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 254, 254, 0, 0, 0, 0,
+    0, 60, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 12, 0, 50, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 6,
+    0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 12, 0, 50, 0, 0, 0, 0, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0,
+    0, 255, 12, 0, 50, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 14, 0, 50, 0, 0, 0, 16, 0,
+    0, 64, 254, 0, 2, 0, 8, 0, 0, 72, 72, 72, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255,
+    16, 0, 58, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 16, 0, 58, 0, 0, 0, 8, 0, 0,
+    255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 16, 0, 60, 0, 0, 0, 8, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0,
+    255, 0, 0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0,
+    255, 4, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 4, 0,
+    15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255,
+    0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2,
+    0, 0, 0, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 6, 0, 15,
+    0, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 254, 0,
+    2, 0, 8, 0, 0, 72, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 50, 0, 19, 0, 0, 0, 8, 0, 0, 255, 0,
+    128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 50, 0, 19, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0,
+    0, 0, 0, 0, 0, 255, 50, 0, 19, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 50, 0, 17, 0,
+    0, 0, 24, 0, 0, 52, 254, 2, 0, 0, 16, 0, 0, 64, 64, 64, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253,
+    0, 0, 0, 255, 58, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 58, 0, 15, 0, 0,
+    0, 16, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 60, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 0, 0, 0,
+    0, 0, 0, 0, 255, 15, 0, 31, 0, 0, 0, 24, 0, 0, 52, 52, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253,
+    0, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0,
+    0, 255, 15, 0, 27, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 15, 0, 27, 0, 0, 0,
+    16, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0,
+    255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0,
+    255, 15, 0, 25, 0, 0, 0, 24, 0, 0, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+    52, 52, 254, 2, 0, 0, 16, 0, 0, 64, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 19, 0, 237, 255, 0, 0, 16,
+    0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 19, 0, 237, 255, 0, 0, 16, 0, 0, 255,
+    0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 19, 0, 237, 255, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255,
+    17, 0, 237, 255, 0, 0, 0, 0, 0, 60, 254, 0, 254, 0, 24, 0, 0, 52, 52, 52, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0,
+    254, 0, 1, 253, 0, 0, 0, 255, 15, 0, 229, 255, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 15,
+    0, 229, 255, 0, 0, 24, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 15, 0, 227, 255, 0, 0, 24, 0, 0, 255, 0,
+    128, 0, 0, 0, 0, 0, 0, 0, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 60, 60, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0,
+    42, 254, 0, 253, 0, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0,
+    1, 251, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 27, 0,
+    16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 27, 0, 16, 0, 0,
+    0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0,
+    0, 0, 0, 0, 255, 25, 0, 16, 0, 0, 0, 0, 0, 0, 60, 60, 61, 254, 0, 254, 0, 24, 0, 0, 52, 57, 255, 0, 128, 4,
+    0, 2, 0, 0, 0, 0, 17, 52, 255, 20, 0, 11, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0,
+    1, 250, 0, 0, 0, 255, 20, 0, 11, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 20, 0, 11, 0,
+    0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 19, 0, 12, 0, 0, 0, 8, 0, 0, 72, 254, 0, 2, 0,
+    0, 0, 0, 62, 60, 60, 60, 60, 254, 254, 0, 5, 0, 0, 0, 60, 60, 60, 60, 60, 60, 60, 60, 254, 254, 0, 251, 0, 0, 0,
+    60, 60, 60, 60, 60, 60, 60, 254, 0, 2, 0, 8, 0, 0, 72, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 233, 255,
+    21, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 233, 255, 21, 0, 0,
+    0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 233, 255, 21, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0,
+    0, 0, 0, 0, 255, 233, 255, 20, 0, 0, 0, 24, 0, 0, 52, 52, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253,
+    0, 0, 0, 255, 233, 255, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 233, 255, 16, 0, 0,
+    0, 0, 0, 0, 60, 60, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 227, 255, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 0,
+    0, 0, 0, 0, 0, 0, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 72, 72, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254,
+    0, 253, 0, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251,
+    0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 16, 0, 4, 0,
+    0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 0,
+    0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0,
+    0, 0, 255, 16, 0, 6, 0, 0, 0, 8, 0, 0, 72, 72, 67, 254, 254, 0, 0, 0, 0, 0, 60, 61, 255, 0, 128, 4, 0, 2,
+    0, 0, 0, 0, 17, 52, 255, 11, 0, 11, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250,
+    0, 0, 0, 255, 11, 0, 11, 0, 0, 0, 0, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 11, 0, 11, 0, 0, 0,
+    0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 12, 0, 12, 0, 0, 0, 16, 0, 0, 64, 254, 2, 0, 0, 8, 0,
+    0, 62, 72, 72, 72, 72, 254, 0, 2, 5, 8, 0, 0, 72, 72, 72, 72, 72, 72, 72, 72, 254, 0, 2, 251, 8, 0, 0, 72, 72,
+    72, 72, 72, 72, 72, 254, 2, 0, 0, 16, 0, 0, 64, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 21, 0, 54, 0,
+    0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 21, 0, 54, 0, 0, 0, 24,
+    0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 21, 0, 54, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0,
+    0, 0, 255, 20, 0, 54, 0, 0, 0, 0, 0, 0, 60, 60, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0,
+    0, 255, 16, 0, 54, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 16, 0, 54, 0, 0, 0, 8,
+    0, 0, 72, 72, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 16, 0, 60, 0, 0, 0, 8, 0, 0, 255, 0, 128, 0, 0, 0,
+    0, 0, 0, 0, 255, 0, 0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253,
+    0, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0,
+    0, 255, 4, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 4, 0, 15, 0, 0, 0,
+    8, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0,
+    255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0,
+    255, 6, 0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 63, 254, 0, 2, 0, 8, 0, 0, 72, 67, 255, 0, 128, 4, 0, 2, 0, 0,
+    0, 0, 17, 52, 255, 11, 0, 20, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0,
+    0, 255, 11, 0, 20, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 11, 0, 20, 0, 0, 0, 8, 0,
+    0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 12, 0, 19, 0, 0, 0, 24, 0, 0, 52, 254, 0, 254, 0, 16, 0, 0, 62,
+    64, 64, 64, 64, 254, 2, 0, 5, 16, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 254, 2, 0, 251, 16, 0, 0, 64, 64, 64, 64,
+    64, 64, 64, 254, 0, 254, 0, 24, 0, 0, 52, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 54, 0, 10, 0, 0, 0,
+    0, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 54, 0, 10, 0, 0, 0, 0, 0, 0,
+    255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 54, 0, 10, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0,
+    255, 54, 0, 11, 0, 0, 0, 8, 0, 0, 72, 72, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255,
+    54, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 54, 0, 15, 0, 0, 0, 16, 0, 0,
+    64, 64, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 60, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0,
+    0, 0, 255, 15, 0, 31, 0, 0, 0, 24, 0, 0, 52, 52, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0,
+    0, 0, 255, 15, 0, 27, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255,
+    15, 0, 27, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 15, 0, 27, 0, 0, 0, 16, 0,
+    0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0,
+    128, 2, 0, 0, 0, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 15,
+    0, 25, 0, 0, 0, 24, 0, 0, 52, 52, 57, 254, 2, 0, 0, 16, 0, 0, 64, 63, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0,
+    17, 52, 255, 20, 0, 20, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255,
+    20, 0, 20, 0, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 20, 0, 20, 0, 0, 0, 16, 0, 0, 255,
+    0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 19, 0, 19, 0, 0, 0, 0, 0, 0, 60, 254, 254, 0, 0, 24, 0, 0, 62, 52, 52,
+    52, 52, 254, 0, 254, 5, 24, 0, 0, 52, 52, 52, 52, 52, 52, 52, 52, 254, 0, 254, 251, 24, 0, 0, 52, 52, 52, 52, 52, 52,
+    52, 254, 254, 0, 0, 0, 0, 0, 60, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 10, 0, 233, 255, 0, 0, 8, 0,
+    0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 10, 0, 233, 255, 0, 0, 8, 0, 0, 255, 0,
+    128, 2, 0, 0, 0, 0, 0, 0, 255, 10, 0, 233, 255, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 11,
+    0, 233, 255, 0, 0, 16, 0, 0, 64, 64, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 15, 0,
+    233, 255, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 15, 0, 233, 255, 0, 0, 24, 0, 0, 52, 52,
+    255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 15, 0, 227, 255, 0, 0, 24, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0,
+    255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 60, 60, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0,
+    255, 27, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 27, 0,
+    16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0, 255,
+    0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2,
+    0, 0, 0, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 25, 0, 16,
+    0, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 254, 0, 2, 0, 8, 0, 0, 72, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17,
+    52, 255, 15, 0, 20, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 15,
+    0, 20, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 15, 0, 20, 0, 0, 0, 24, 0, 0, 255, 0,
+    128, 4, 0, 0, 0, 0, 0, 0, 112, 17, 52, 255, 15, 0, 20, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0,
+    0, 254, 0, 1, 250, 0, 0, 0, 255, 15, 0, 20, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 15,
+    0, 20, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 13, 0, 20, 0, 0, 0, 0, 0, 0, 60, 60,
+    60, 60, 60, 60, 60, 60, 254, 0, 2, 0, 8, 0, 0, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 254, 254, 0, 0, 0, 0, 0,
+    60, 60, 60, 60, 60, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 240, 255, 41, 0, 0, 0, 0, 0, 0, 255, 0, 128,
+    4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 240, 255, 41, 0, 0, 0, 0, 0, 0, 255, 0, 128, 2, 0, 0,
+    0, 0, 0, 0, 255, 240, 255, 41, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 239, 255, 43, 0, 0,
+    0, 8, 0, 0, 72, 72, 72, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 239, 255, 49, 0, 0,
+    0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 239, 255, 48, 0, 0, 0, 8, 0, 0, 72, 72, 72, 72, 72,
+    255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 239, 255, 60, 0, 0, 0, 8, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0,
+    255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 72, 72, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0,
+    255, 16, 0, 4, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 16, 0,
+    4, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 16, 0, 4, 0, 0, 0, 0, 0, 0, 255,
+    0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 0, 0, 0, 255, 0, 128, 2,
+    0, 0, 0, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 16, 0, 6,
+    0, 0, 0, 8, 0, 0, 72, 72, 72, 72, 72, 254, 2, 0, 0, 16, 0, 0, 64, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17,
+    52, 255, 20, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 20,
+    0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 20, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0,
+    128, 4, 0, 0, 0, 0, 0, 0, 112, 17, 52, 255, 20, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0,
+    0, 254, 0, 1, 250, 0, 0, 0, 255, 20, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 20,
+    0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 20, 0, 18, 0, 0, 0, 8, 0, 0, 72, 72,
+    72, 72, 72, 72, 72, 72, 254, 2, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 254, 0, 2, 0, 8, 0, 0,
+    72, 72, 72, 72, 72, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 41, 0, 47, 0, 0, 0, 8, 0, 0, 255, 0, 128,
+    4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 41, 0, 47, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0,
+    0, 0, 0, 0, 255, 41, 0, 47, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 43, 0, 48, 0, 0,
+    0, 16, 0, 0, 64, 64, 64, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 49, 0, 48, 0, 0,
+    0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 48, 0, 48, 0, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64,
+    255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 60, 0, 48, 0, 0, 0, 16, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0,
+    255, 0, 0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0,
+    255, 4, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 4, 0,
+    15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255,
+    0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2,
+    0, 0, 0, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 6, 0, 15,
+    0, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 254, 0, 254, 0, 24, 0, 0, 52, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17,
+    52, 255, 16, 0, 11, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 16,
+    0, 11, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 16, 0, 11, 0, 0, 0, 8, 0, 0, 255, 0,
+    128, 4, 0, 0, 0, 0, 0, 0, 112, 17, 52, 255, 16, 0, 11, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0,
+    0, 254, 0, 1, 250, 0, 0, 0, 255, 16, 0, 11, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 16,
+    0, 11, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 18, 0, 11, 0, 0, 0, 16, 0, 0, 64, 64,
+    64, 64, 64, 64, 64, 64, 254, 0, 254, 0, 24, 0, 0, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 254, 2, 0, 0, 16, 0, 0,
+    64, 64, 64, 64, 64, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 47, 0, 246, 255, 0, 0, 16, 0, 0, 255, 0, 128,
+    4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 47, 0, 246, 255, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0,
+    0, 0, 0, 0, 255, 47, 0, 246, 255, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 48, 0, 244, 255, 0,
+    0, 24, 0, 0, 52, 52, 52, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 48, 0, 238, 255, 0,
+    0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 48, 0, 239, 255, 0, 0, 24, 0, 0, 52, 52, 52, 52, 52,
+    255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 48, 0, 227, 255, 0, 0, 24, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0,
+    255, 15, 0, 31, 0, 0, 0, 24, 0, 0, 52, 52, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0,
+    255, 15, 0, 27, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 15, 0,
+    27, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255,
+    0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 2,
+    0, 0, 0, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 15, 0, 25,
+    0, 0, 0, 24, 0, 0, 52, 52, 52, 52, 52, 254, 254, 0, 0, 0, 0, 0, 60, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17,
+    52, 255, 11, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 11,
+    0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 11, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0,
+    128, 4, 0, 0, 0, 0, 0, 0, 112, 17, 52, 255, 11, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0,
+    0, 254, 0, 1, 250, 0, 0, 0, 255, 11, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 11,
+    0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 11, 0, 13, 0, 0, 0, 24, 0, 0, 52, 52,
+    52, 52, 52, 52, 52, 52, 254, 254, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 254, 0, 254, 0, 24, 0, 0,
+    52, 52, 52, 52, 52, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 246, 255, 240, 255, 0, 0, 24, 0, 0, 255, 0, 128,
+    4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 246, 255, 240, 255, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0,
+    0, 0, 0, 0, 255, 246, 255, 240, 255, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 244, 255, 239, 255, 0,
+    0, 0, 0, 0, 60, 60, 60, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 238, 255, 239, 255, 0,
+    0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 239, 255, 239, 255, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60,
+    255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 227, 255, 239, 255, 0, 0, 0, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0,
+    255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 60, 60, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0,
+    255, 27, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 27, 0,
+    16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0, 255,
+    0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2,
+    0, 0, 0, 0, 0, 0, 255, 27, 0, 16, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 25, 0, 16,
+    0, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 254, 0, 254, 0, 24, 0, 0, 52, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17,
+    52, 255, 15, 0, 12, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 15,
+    0, 12, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 15, 0, 12, 0, 0, 0, 24, 0, 0, 255, 0,
+    128, 4, 0, 0, 0, 0, 0, 0, 112, 17, 52, 255, 15, 0, 12, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0,
+    0, 254, 0, 1, 250, 0, 0, 0, 255, 15, 0, 12, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 15,
+    0, 12, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 13, 0, 12, 0, 0, 0, 0, 0, 0, 60, 60,
+    60, 60, 60, 60, 60, 60, 254, 0, 254, 0, 24, 0, 0, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 254, 254, 0, 0, 0, 0, 0,
+    60, 60, 60, 60, 60, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 240, 255, 247, 255, 0, 0, 16, 0, 0, 255, 0, 128,
+    4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 240, 255, 247, 255, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0,
+    0, 0, 0, 0, 255, 240, 255, 247, 255, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 239, 255, 245, 255, 0,
+    0, 24, 0, 0, 52, 52, 52, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 239, 255, 239, 255, 0,
+    0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 239, 255, 240, 255, 0, 0, 24, 0, 0, 52, 52, 52, 52, 52,
+    255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 239, 255, 228, 255, 0, 0, 24, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0,
+    255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 72, 72, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0,
+    255, 16, 0, 4, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 16, 0,
+    4, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 16, 0, 4, 0, 0, 0, 0, 0, 0, 255,
+    0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 0, 0, 0, 255, 0, 128, 2,
+    0, 0, 0, 0, 0, 0, 255, 16, 0, 4, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 16, 0, 6,
+    0, 0, 0, 8, 0, 0, 72, 72, 72, 72, 72, 254, 254, 0, 0, 0, 0, 0, 60, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17,
+    52, 255, 12, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 12,
+    0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 12, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0,
+    128, 4, 0, 0, 0, 0, 0, 0, 112, 17, 52, 255, 12, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0,
+    0, 254, 0, 1, 250, 0, 0, 0, 255, 12, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 12,
+    0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 12, 0, 18, 0, 0, 0, 8, 0, 0, 72, 72,
+    72, 72, 72, 72, 72, 72, 254, 254, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 254, 0, 2, 0, 8, 0, 0,
+    72, 72, 72, 72, 72, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 247, 255, 47, 0, 0, 0, 24, 0, 0, 255, 0, 128,
+    4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 247, 255, 47, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0,
+    0, 0, 0, 0, 255, 247, 255, 47, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 245, 255, 48, 0, 0,
+    0, 0, 0, 0, 60, 60, 60, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 239, 255, 48, 0, 0,
+    0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 240, 255, 48, 0, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60,
+    255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 228, 255, 48, 0, 0, 0, 0, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0,
+    255, 0, 0, 15, 0, 0, 0, 16, 0, 0, 64, 64, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0,
+    255, 4, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 4, 0,
+    15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255,
+    0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2,
+    0, 0, 0, 0, 0, 0, 255, 4, 0, 15, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 6, 0, 15,
+    0, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 254, 0, 2, 0, 8, 0, 0, 72, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17,
+    52, 255, 16, 0, 19, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 16,
+    0, 19, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 16, 0, 19, 0, 0, 0, 8, 0, 0, 255, 0,
+    128, 4, 0, 0, 0, 0, 0, 0, 112, 17, 52, 255, 16, 0, 19, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0,
+    0, 254, 0, 1, 250, 0, 0, 0, 255, 16, 0, 19, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 16,
+    0, 19, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 18, 0, 19, 0, 0, 0, 16, 0, 0, 64, 64,
+    64, 64, 64, 64, 64, 64, 254, 0, 2, 0, 8, 0, 0, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 254, 2, 0, 0, 16, 0, 0,
+    64, 64, 64, 64, 64, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 47, 0, 40, 0, 0, 0, 0, 0, 0, 255, 0, 128,
+    4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 47, 0, 40, 0, 0, 0, 0, 0, 0, 255, 0, 128, 2, 0, 0,
+    0, 0, 0, 0, 255, 47, 0, 40, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 48, 0, 42, 0, 0,
+    0, 8, 0, 0, 72, 72, 72, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 48, 0, 48, 0, 0,
+    0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 48, 0, 47, 0, 0, 0, 8, 0, 0, 72, 72, 72, 72, 72,
+    255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 48, 0, 59, 0, 0, 0, 8, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0,
+    255, 15, 0, 31, 0, 0, 0, 24, 0, 0, 52, 52, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 42, 254, 0, 253, 0, 0, 0, 0,
+    255, 15, 0, 27, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 5, 0, 0, 0, 0, 254, 0, 1, 251, 0, 0, 0, 255, 15, 0,
+    27, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255,
+    0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 2,
+    0, 0, 0, 0, 0, 0, 255, 15, 0, 27, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 15, 0, 25,
+    0, 0, 0, 24, 0, 0, 52, 52, 52, 52, 52, 254, 2, 0, 0, 16, 0, 0, 64, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17,
+    52, 255, 19, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 19,
+    0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 19, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0,
+    128, 4, 0, 0, 0, 0, 0, 0, 112, 17, 52, 255, 19, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 6, 0, 0, 0,
+    0, 254, 0, 1, 250, 0, 0, 0, 255, 19, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 19,
+    0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 19, 0, 13, 0, 0, 0, 24, 0, 0, 52, 52,
+    52, 52, 52, 52, 52, 52, 254, 2, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 254, 0, 254, 0, 24, 0, 0,
+    52, 52, 52, 52, 52, 255, 0, 128, 4, 0, 2, 0, 0, 0, 0, 17, 52, 255, 40, 0, 240, 255, 0, 0, 8, 0, 0, 255, 0, 128,
+    4, 0, 6, 0, 0, 0, 0, 254, 0, 1, 250, 0, 0, 0, 255, 40, 0, 240, 255, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0,
+    0, 0, 0, 0, 255, 40, 0, 240, 255, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 42, 0, 239, 255, 0,
+    0, 16, 0, 0, 64, 64, 64, 255, 0, 128, 4, 0, 3, 0, 0, 0, 0, 254, 0, 1, 253, 0, 0, 0, 255, 48, 0, 239, 255, 0,
+    0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 72, 255, 47, 0, 239, 255, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64,
+    255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 59, 0, 239, 255, 0, 0, 16, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0,
+    255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 26, 0, 16, 0, 0, 0, 0, 0, 0,
+    255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 26, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0,
+    255, 25, 0, 16, 0, 0, 0, 0, 0, 0, 55, 60, 55, 55, 60, 61, 56, 61, 61, 56, 61, 61, 56, 61, 61, 56, 61, 61, 56, 61,
+    62, 66, 61, 61, 66, 61, 61, 66, 61, 61, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 246, 255, 11, 0, 0, 0, 0, 0,
+    0, 61, 65, 66, 61, 66, 61, 66, 61, 66, 61, 66, 61, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 232, 255, 18, 0, 0,
+    0, 0, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 227, 255, 16, 0, 0, 0,
+    0, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 227, 255, 16, 0, 0, 0, 0, 0, 0,
+    255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0,
+    255, 16, 0, 5, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 16, 0, 5, 0, 0, 0, 8, 0, 0,
+    255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 16, 0, 6, 0, 0, 0, 8, 0, 0, 71, 72, 71, 71, 72, 67, 66, 67, 67, 66,
+    67, 67, 66, 67, 67, 66, 67, 67, 66, 67, 62, 68, 67, 67, 68, 67, 67, 68, 67, 67, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0,
+    67, 255, 11, 0, 41, 0, 0, 0, 8, 0, 0, 67, 73, 68, 67, 68, 67, 68, 67, 68, 67, 68, 67, 255, 0, 128, 2, 0, 0, 0,
+    0, 0, 0, 67, 255, 18, 0, 55, 0, 0, 0, 8, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 255, 0, 128, 4, 0, 0, 0, 0,
+    0, 0, 52, 255, 16, 0, 60, 0, 0, 0, 8, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0,
+    255, 16, 0, 60, 0, 0, 0, 8, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 15, 0, 0, 0, 16, 0, 0,
+    255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 5, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0,
+    255, 5, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 6, 0, 15, 0, 0, 0, 16, 0, 0,
+    69, 64, 69, 69, 64, 63, 68, 63, 63, 68, 63, 63, 68, 63, 63, 68, 63, 63, 68, 63, 62, 58, 63, 63, 58, 63, 63, 58, 63, 63,
+    255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 41, 0, 20, 0, 0, 0, 16, 0, 0, 63, 59, 58, 63, 58, 63, 58, 63, 58,
+    63, 58, 63, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 55, 0, 13, 0, 0, 0, 16, 0, 0, 61, 61, 61, 61, 61, 61,
+    61, 61, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 60, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 6, 0, 0, 0,
+    0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 60, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0,
+    255, 15, 0, 31, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 15, 0, 26, 0, 0, 0, 24, 0, 0,
+    255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 15, 0, 26, 0, 0, 0, 24, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0,
+    255, 15, 0, 25, 0, 0, 0, 24, 0, 0, 53, 52, 53, 53, 52, 57, 58, 57, 57, 58, 57, 57, 58, 57, 57, 58, 57, 57, 58, 57,
+    62, 56, 57, 57, 56, 57, 57, 56, 57, 57, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 20, 0, 246, 255, 0, 0, 24, 0,
+    0, 57, 51, 56, 57, 56, 57, 56, 57, 56, 57, 56, 57, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 13, 0, 232, 255, 0,
+    0, 24, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 15, 0, 227, 255, 0, 0,
+    24, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 15, 0, 227, 255, 0, 0, 24, 0, 0,
+    255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0,
+    255, 26, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 26, 0, 16, 0, 0, 0, 0, 0, 0,
+    255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 25, 0, 16, 0, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 255,
+    0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 255, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 255, 0, 0,
+    0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 255, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 0, 3, 0, 0, 0, 0,
+    254, 0, 3, 0, 0, 0, 0, 254, 0, 3, 0, 0, 0, 0, 254, 0, 3, 0, 0, 0, 0, 72, 60, 60, 60, 60, 56, 52, 52, 52,
+    53, 52, 52, 60, 60, 60, 60, 65, 60, 61, 61, 61, 61, 61, 61, 61, 61, 61, 63, 63, 63, 58, 63, 63, 63, 63, 58, 63, 255, 0,
+    128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 236, 255, 12, 0, 0, 0, 0, 0, 0, 61, 66, 66, 61, 66, 66, 255, 0, 128, 4, 0,
+    0, 0, 0, 0, 0, 52, 255, 227, 255, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0,
+    0, 0, 0, 255, 227, 255, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 16, 0, 0, 0, 0, 0,
+    8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 16, 0, 5, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 1, 0,
+    0, 0, 0, 255, 16, 0, 5, 0, 0, 0, 8, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 16, 0, 6, 0, 0, 0,
+    8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 255, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 255, 3, 0, 8, 0,
+    0, 254, 0, 3, 0, 8, 0, 0, 254, 255, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 255, 3, 0, 8, 0, 0, 254,
+    0, 3, 0, 8, 0, 0, 254, 3, 0, 0, 8, 0, 0, 254, 3, 0, 0, 8, 0, 0, 254, 3, 0, 0, 8, 0, 0, 254, 3, 0,
+    0, 8, 0, 0, 64, 72, 72, 72, 72, 66, 60, 60, 60, 55, 60, 60, 72, 72, 72, 72, 73, 72, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 57, 57, 57, 56, 57, 57, 57, 57, 56, 57, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 12, 0, 51, 0, 0, 0, 8,
+    0, 0, 67, 68, 68, 67, 68, 68, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 16, 0, 60, 0, 0, 0, 8, 0, 0, 255,
+    0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 16, 0, 60, 0, 0, 0, 8, 0, 0, 255, 0, 128, 0,
+    0, 0, 0, 0, 0, 0, 255, 0, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 5, 0, 15,
+    0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 5, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 3,
+    0, 0, 0, 0, 0, 0, 255, 6, 0, 15, 0, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 1, 0, 16, 0, 0,
+    254, 3, 0, 0, 16, 0, 0, 254, 3, 1, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 1, 0, 16, 0, 0, 254, 3,
+    0, 0, 16, 0, 0, 254, 3, 1, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 0, 253, 0, 16, 0, 0, 254, 0, 253, 0,
+    16, 0, 0, 254, 0, 253, 0, 16, 0, 0, 254, 0, 253, 0, 16, 0, 0, 52, 64, 64, 64, 64, 68, 72, 72, 72, 71, 72, 72, 64,
+    64, 64, 64, 59, 64, 63, 63, 63, 63, 63, 63, 63, 63, 63, 61, 61, 61, 66, 61, 61, 61, 61, 66, 61, 255, 0, 128, 2, 0, 0,
+    0, 0, 0, 0, 67, 255, 51, 0, 19, 0, 0, 0, 16, 0, 0, 63, 58, 58, 63, 58, 58, 255, 0, 128, 4, 0, 0, 0, 0, 0,
+    0, 52, 255, 60, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255,
+    60, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 15, 0, 31, 0, 0, 0, 24, 0, 0, 255,
+    0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 15, 0, 26, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255,
+    15, 0, 26, 0, 0, 0, 24, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 15, 0, 25, 0, 0, 0, 24, 0, 0, 254,
+    0, 253, 0, 24, 0, 0, 254, 1, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 1, 253, 0, 24, 0, 0, 254, 0, 253,
+    0, 24, 0, 0, 254, 1, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 1, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24,
+    0, 0, 254, 253, 0, 0, 24, 0, 0, 254, 253, 0, 0, 24, 0, 0, 254, 253, 0, 0, 24, 0, 0, 254, 253, 0, 0, 24, 0, 0,
+    60, 52, 52, 52, 52, 58, 64, 64, 64, 69, 64, 64, 52, 52, 52, 52, 51, 52, 57, 57, 57, 57, 57, 57, 57, 57, 57, 67, 67, 67,
+    68, 67, 67, 67, 67, 68, 67, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 19, 0, 236, 255, 0, 0, 24, 0, 0, 57, 56,
+    56, 57, 56, 56, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 15, 0, 227, 255, 0, 0, 24, 0, 0, 255, 0, 128, 6, 0,
+    0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 15, 0, 227, 255, 0, 0, 24, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0,
+    0, 0, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 26, 0, 16, 0, 0, 0, 0,
+    0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 26, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0,
+    0, 0, 255, 24, 0, 16, 0, 0, 0, 0, 0, 0, 254, 253, 255, 0, 0, 0, 0, 254, 253, 255, 0, 0, 0, 0, 60, 60, 55, 60,
+    61, 59, 63, 63, 63, 63, 63, 58, 63, 63, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 20, 0, 11, 0, 0, 0, 0, 0,
+    0, 60, 60, 60, 60, 60, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 7, 0, 12, 0, 0, 0, 0, 0, 0, 65, 65, 65, 65,
+    65, 65, 70, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 247, 255, 20, 0, 0, 0, 0, 0, 0, 60, 60, 60, 60, 60, 60, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 63, 63, 63, 63, 63, 63, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 233, 255, 20, 0,
+    0, 0, 0, 0, 0, 57, 57, 57, 57, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 227, 255, 16, 0, 0, 0, 0, 0, 0,
+    255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 227, 255, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128,
+    0, 0, 0, 0, 0, 0, 0, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 16, 0,
+    5, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 16, 0, 5, 0, 0, 0, 8, 0, 0, 255, 0, 128,
+    3, 0, 0, 0, 0, 0, 0, 255, 16, 0, 7, 0, 0, 0, 8, 0, 0, 254, 255, 3, 0, 8, 0, 0, 254, 255, 3, 0, 8, 0,
+    0, 72, 72, 71, 72, 67, 51, 57, 57, 57, 57, 57, 56, 57, 57, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 11, 0, 11,
+    0, 0, 0, 8, 0, 0, 72, 72, 72, 72, 72, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 12, 0, 24, 0, 0, 0, 8, 0,
+    0, 73, 73, 73, 73, 73, 73, 74, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 20, 0, 40, 0, 0, 0, 8, 0, 0, 72, 72,
+    72, 72, 72, 72, 67, 67, 67, 67, 67, 67, 67, 67, 67, 57, 57, 57, 57, 57, 57, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67,
+    255, 20, 0, 54, 0, 0, 0, 8, 0, 0, 61, 61, 61, 61, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 16, 0, 60, 0,
+    0, 0, 8, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 16, 0, 60, 0, 0, 0, 8,
+    0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0,
+    0, 0, 255, 5, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 5, 0, 15, 0, 0, 0, 16,
+    0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 7, 0, 15, 0, 0, 0, 16, 0, 0, 254, 3, 1, 0, 16, 0, 0, 254,
+    3, 1, 0, 16, 0, 0, 64, 64, 69, 64, 63, 65, 61, 61, 61, 61, 61, 66, 61, 61, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0,
+    67, 255, 11, 0, 20, 0, 0, 0, 16, 0, 0, 64, 64, 64, 64, 64, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 24, 0, 19,
+    0, 0, 0, 16, 0, 0, 59, 59, 59, 59, 59, 59, 54, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 40, 0, 11, 0, 0, 0,
+    16, 0, 0, 64, 64, 64, 64, 64, 64, 63, 63, 63, 63, 63, 63, 63, 63, 63, 61, 61, 61, 61, 61, 61, 255, 0, 128, 2, 0, 0,
+    0, 0, 0, 0, 67, 255, 54, 0, 11, 0, 0, 0, 16, 0, 0, 67, 67, 67, 67, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52,
+    255, 60, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 60, 0,
+    15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 15, 0, 31, 0, 0, 0, 24, 0, 0, 255, 0, 128,
+    2, 0, 0, 0, 0, 0, 0, 255, 15, 0, 26, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 15, 0,
+    26, 0, 0, 0, 24, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 15, 0, 24, 0, 0, 0, 24, 0, 0, 254, 1, 253,
+    0, 24, 0, 0, 254, 1, 253, 0, 24, 0, 0, 52, 52, 53, 52, 57, 73, 67, 67, 67, 67, 67, 68, 67, 67, 255, 0, 128, 2, 0,
+    0, 0, 0, 0, 0, 67, 255, 20, 0, 20, 0, 0, 0, 24, 0, 0, 52, 52, 52, 52, 52, 255, 0, 128, 4, 0, 0, 0, 0, 0,
+    0, 255, 19, 0, 7, 0, 0, 0, 24, 0, 0, 51, 51, 51, 51, 51, 51, 50, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 11,
+    0, 247, 255, 0, 0, 24, 0, 0, 52, 52, 52, 52, 52, 52, 57, 57, 57, 57, 57, 57, 57, 57, 57, 67, 67, 67, 67, 67, 67, 255,
+    0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 11, 0, 233, 255, 0, 0, 24, 0, 0, 63, 63, 63, 63, 255, 0, 128, 4, 0, 0,
+    0, 0, 0, 0, 52, 255, 15, 0, 227, 255, 0, 0, 24, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0,
+    0, 0, 255, 15, 0, 227, 255, 0, 0, 24, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 31, 0, 16, 0, 0, 0, 0,
+    0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 26, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0,
+    0, 0, 255, 26, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 24, 0, 16, 0, 0, 0, 0,
+    0, 0, 254, 253, 1, 0, 0, 0, 0, 60, 60, 55, 70, 60, 60, 60, 60, 61, 66, 61, 61, 61, 61, 61, 63, 63, 63, 63, 63, 63,
+    63, 68, 63, 63, 63, 63, 63, 63, 63, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 14, 0, 20, 0, 0, 0, 0, 0, 0,
+    60, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254,
+    253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0,
+    255, 244, 255, 20, 0, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 238, 255,
+    16, 0, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 56, 51, 51, 51, 54, 58, 83, 58, 58,
+    58, 63, 63, 63, 63, 62, 62, 61, 61, 61, 61, 66, 66, 66, 41, 66, 70, 73, 73, 73, 68, 254, 3, 0, 0, 0, 0, 0, 254, 3,
+    0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 241, 255, 20, 0, 0, 0, 0, 0, 0, 254, 3, 0, 0, 0,
+    0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 247, 255, 20, 0, 0, 0, 0, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 14, 0, 20, 0,
+    0, 0, 0, 0, 0, 60, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0,
+    0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0,
+    0, 0, 0, 0, 0, 255, 244, 255, 20, 0, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0,
+    0, 0, 255, 238, 255, 16, 0, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 56, 51, 51, 51,
+    54, 79, 54, 59, 64, 94, 64, 72, 73, 98, 72, 73, 71, 72, 72, 71, 72, 72, 71, 72, 67, 67, 66, 67, 67, 67, 67, 254, 0, 2,
+    253, 0, 0, 0, 71, 67, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 240, 255, 42, 0, 0, 0, 0, 0, 0, 67, 67, 67,
+    66, 67, 67, 67, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 239, 255, 60, 0, 0, 0, 8, 0, 0, 255, 0, 128, 6, 0,
+    0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 239, 255, 60, 0, 0, 0, 8, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0,
+    0, 0, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 16, 0, 5, 0, 0, 0, 8,
+    0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 16, 0, 5, 0, 0, 0, 8, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0,
+    0, 0, 255, 16, 0, 7, 0, 0, 0, 8, 0, 0, 254, 1, 3, 0, 8, 0, 0, 72, 72, 71, 74, 72, 72, 72, 72, 67, 68, 67,
+    67, 67, 67, 67, 57, 57, 57, 57, 57, 57, 57, 58, 57, 57, 57, 57, 57, 57, 57, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67,
+    255, 20, 0, 17, 0, 0, 0, 8, 0, 0, 72, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8,
+    0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0,
+    255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 20, 0, 43, 0, 0, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 255, 0, 128,
+    4, 0, 1, 0, 0, 0, 0, 255, 16, 0, 49, 0, 0, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0,
+    0, 66, 65, 65, 65, 50, 56, 81, 56, 56, 56, 57, 57, 57, 57, 62, 62, 67, 67, 67, 67, 68, 68, 68, 43, 68, 74, 59, 59, 59,
+    58, 254, 0, 253, 0, 8, 0, 0, 254, 0, 253, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 20, 0, 46, 0,
+    0, 0, 8, 0, 0, 254, 0, 253, 0, 8, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 20, 0, 40, 0, 0, 0, 8,
+    0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 255, 0, 128, 2, 0, 0,
+    0, 0, 0, 0, 67, 255, 20, 0, 17, 0, 0, 0, 8, 0, 0, 72, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0,
+    254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0,
+    3, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 20, 0, 43, 0, 0, 0, 8, 0, 0, 254, 0, 3, 0, 8,
+    0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 16, 0, 49, 0, 0, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254,
+    0, 3, 0, 8, 0, 0, 66, 65, 65, 65, 50, 75, 50, 51, 52, 78, 52, 64, 59, 84, 64, 59, 69, 64, 64, 69, 64, 64, 69, 64,
+    63, 63, 68, 63, 63, 63, 63, 254, 2, 0, 253, 8, 0, 0, 69, 63, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 42, 0,
+    47, 0, 0, 0, 8, 0, 0, 63, 63, 63, 68, 63, 63, 63, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 60, 0, 48, 0,
+    0, 0, 16, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 60, 0, 48, 0, 0, 0, 16,
+    0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0,
+    0, 0, 255, 5, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 5, 0, 15, 0, 0, 0, 16,
+    0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 7, 0, 15, 0, 0, 0, 16, 0, 0, 254, 3, 255, 0, 16, 0, 0, 64,
+    64, 69, 54, 64, 64, 64, 64, 63, 58, 63, 63, 63, 63, 63, 61, 61, 61, 61, 61, 61, 61, 56, 61, 61, 61, 61, 61, 61, 61, 255,
+    0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 17, 0, 11, 0, 0, 0, 16, 0, 0, 64, 254, 3, 0, 0, 16, 0, 0, 254, 3,
+    0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0,
+    16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 43, 0, 11, 0, 0, 0, 16, 0, 0,
+    254, 3, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 49, 0, 15, 0, 0, 0, 16, 0, 0, 254, 3, 0,
+    0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 68, 73, 73, 73, 70, 66, 91, 66, 66, 66, 61, 61, 61, 61, 62, 62, 63, 63, 63,
+    63, 58, 58, 58, 33, 58, 54, 51, 51, 51, 56, 254, 253, 0, 0, 16, 0, 0, 254, 253, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0,
+    0, 0, 0, 0, 0, 255, 46, 0, 11, 0, 0, 0, 16, 0, 0, 254, 253, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0,
+    0, 0, 255, 40, 0, 11, 0, 0, 0, 16, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 17, 0, 11, 0, 0, 0, 16, 0, 0, 64, 254, 3, 0, 0,
+    16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0,
+    0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 43, 0, 11, 0,
+    0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 49, 0, 15, 0, 0, 0, 16,
+    0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 68, 73, 73, 73, 70, 95, 70, 65, 60, 80, 60, 52, 51, 76,
+    52, 51, 53, 52, 52, 53, 52, 52, 53, 52, 57, 57, 58, 57, 57, 57, 57, 254, 0, 254, 253, 16, 0, 0, 53, 57, 255, 0, 128, 2,
+    0, 0, 0, 0, 0, 0, 67, 255, 47, 0, 245, 255, 0, 0, 16, 0, 0, 57, 57, 57, 58, 57, 57, 57, 255, 0, 128, 4, 0, 0,
+    0, 0, 0, 0, 52, 255, 48, 0, 227, 255, 0, 0, 24, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0,
+    0, 0, 255, 48, 0, 227, 255, 0, 0, 24, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 15, 0, 31, 0, 0, 0, 24,
+    0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 15, 0, 26, 0, 0, 0, 24, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0,
+    0, 0, 255, 15, 0, 26, 0, 0, 0, 24, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 15, 0, 24, 0, 0, 0, 24,
+    0, 0, 254, 255, 253, 0, 24, 0, 0, 52, 52, 53, 50, 52, 52, 52, 52, 57, 56, 57, 57, 57, 57, 57, 67, 67, 67, 67, 67, 67,
+    67, 66, 67, 67, 67, 67, 67, 67, 67, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 11, 0, 14, 0, 0, 0, 24, 0, 0,
+    52, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254,
+    0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0,
+    255, 11, 0, 244, 255, 0, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 15, 0,
+    238, 255, 0, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 58, 59, 59, 59, 74, 68, 93, 68, 68,
+    68, 67, 67, 67, 67, 62, 62, 57, 57, 57, 57, 56, 56, 56, 31, 56, 50, 65, 65, 65, 66, 254, 0, 3, 0, 24, 0, 0, 254, 0,
+    3, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 11, 0, 241, 255, 0, 0, 24, 0, 0, 254, 0, 3, 0, 24,
+    0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 11, 0, 247, 255, 0, 0, 24, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 11, 0, 14, 0,
+    0, 0, 24, 0, 0, 52, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253,
+    0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 255, 0, 128, 4, 0,
+    0, 0, 0, 0, 0, 255, 11, 0, 244, 255, 0, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0,
+    0, 0, 255, 15, 0, 238, 255, 0, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 58, 59, 59, 59,
+    74, 99, 74, 73, 72, 96, 72, 60, 65, 90, 60, 65, 55, 60, 60, 55, 60, 60, 55, 60, 61, 61, 56, 61, 61, 61, 61, 254, 254, 0,
+    253, 24, 0, 0, 55, 61, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 245, 255, 240, 255, 0, 0, 24, 0, 0, 61, 61, 61,
+    56, 61, 61, 61, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 227, 255, 239, 255, 0, 0, 0, 0, 0, 255, 0, 128, 6, 0,
+    0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 227, 255, 239, 255, 0, 0, 0, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0,
+    0, 0, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 26, 0, 16, 0, 0, 0, 0,
+    0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 26, 0, 16, 0, 0, 0, 0, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0,
+    0, 0, 255, 24, 0, 16, 0, 0, 0, 0, 0, 0, 254, 253, 255, 0, 0, 0, 0, 60, 60, 65, 50, 60, 60, 60, 60, 61, 56, 61,
+    61, 61, 61, 61, 63, 63, 63, 63, 63, 63, 63, 58, 63, 63, 63, 63, 63, 63, 63, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67,
+    255, 14, 0, 12, 0, 0, 0, 0, 0, 0, 60, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0,
+    0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0,
+    255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 244, 255, 12, 0, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 255, 0, 128,
+    4, 0, 1, 0, 0, 0, 0, 255, 238, 255, 16, 0, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0,
+    0, 66, 71, 71, 71, 74, 68, 93, 68, 68, 68, 63, 63, 63, 63, 62, 62, 61, 61, 61, 61, 56, 56, 56, 31, 56, 50, 53, 53, 53,
+    58, 254, 3, 0, 0, 0, 0, 0, 254, 3, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 241, 255, 12, 0,
+    0, 0, 0, 0, 0, 254, 3, 0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 247, 255, 12, 0, 0, 0, 0,
+    0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 255, 0, 128, 2, 0, 0,
+    0, 0, 0, 0, 67, 255, 14, 0, 12, 0, 0, 0, 0, 0, 0, 60, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0,
+    254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254, 253,
+    0, 0, 0, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 244, 255, 12, 0, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0,
+    0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 238, 255, 16, 0, 0, 0, 0, 0, 0, 254, 253, 0, 0, 0, 0, 0, 254,
+    253, 0, 0, 0, 0, 0, 66, 71, 71, 71, 74, 99, 74, 69, 64, 89, 59, 52, 53, 78, 52, 53, 51, 52, 52, 51, 52, 52, 51, 52,
+    57, 57, 56, 57, 57, 57, 57, 254, 0, 254, 253, 0, 0, 0, 51, 57, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 240, 255,
+    246, 255, 0, 0, 0, 0, 0, 57, 57, 57, 56, 57, 57, 57, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 239, 255, 228, 255,
+    0, 0, 24, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 239, 255, 228, 255, 0, 0, 24,
+    0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0,
+    0, 0, 255, 16, 0, 5, 0, 0, 0, 8, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 16, 0, 5, 0, 0, 0, 8,
+    0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 16, 0, 7, 0, 0, 0, 8, 0, 0, 254, 255, 3, 0, 8, 0, 0, 72,
+    72, 73, 70, 72, 72, 72, 72, 67, 66, 67, 67, 67, 67, 67, 57, 57, 57, 57, 57, 57, 57, 56, 57, 57, 57, 57, 57, 57, 57, 255,
+    0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 12, 0, 17, 0, 0, 0, 8, 0, 0, 72, 254, 0, 3, 0, 8, 0, 0, 254, 0,
+    3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0,
+    8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 12, 0, 43, 0, 0, 0, 8, 0, 0,
+    254, 0, 3, 0, 8, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 16, 0, 49, 0, 0, 0, 8, 0, 0, 254, 0, 3,
+    0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 68, 69, 69, 69, 54, 58, 83, 58, 58, 58, 57, 57, 57, 57, 62, 62, 67, 67, 67,
+    67, 66, 66, 66, 41, 66, 70, 55, 55, 55, 56, 254, 0, 253, 0, 8, 0, 0, 254, 0, 253, 0, 8, 0, 0, 255, 0, 128, 4, 0,
+    0, 0, 0, 0, 0, 255, 12, 0, 46, 0, 0, 0, 8, 0, 0, 254, 0, 253, 0, 8, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0,
+    0, 0, 255, 12, 0, 40, 0, 0, 0, 8, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 12, 0, 17, 0, 0, 0, 8, 0, 0, 72, 254, 0, 3, 0,
+    8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0,
+    0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 12, 0, 43, 0,
+    0, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 16, 0, 49, 0, 0, 0, 8,
+    0, 0, 254, 0, 3, 0, 8, 0, 0, 254, 0, 3, 0, 8, 0, 0, 68, 69, 69, 69, 54, 79, 54, 53, 52, 77, 51, 60, 55, 80,
+    60, 55, 65, 60, 60, 65, 60, 60, 65, 60, 61, 61, 66, 61, 61, 61, 61, 254, 254, 0, 253, 8, 0, 0, 65, 61, 255, 0, 128, 2,
+    0, 0, 0, 0, 0, 0, 67, 255, 246, 255, 47, 0, 0, 0, 8, 0, 0, 61, 61, 61, 66, 61, 61, 61, 255, 0, 128, 4, 0, 0,
+    0, 0, 0, 0, 52, 255, 228, 255, 48, 0, 0, 0, 0, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0,
+    0, 0, 255, 228, 255, 48, 0, 0, 0, 0, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0, 0, 0, 255, 0, 0, 15, 0, 0, 0, 16,
+    0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 5, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0,
+    0, 0, 255, 5, 0, 15, 0, 0, 0, 16, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0, 0, 0, 255, 7, 0, 15, 0, 0, 0, 16,
+    0, 0, 254, 3, 1, 0, 16, 0, 0, 64, 64, 59, 74, 64, 64, 64, 64, 63, 68, 63, 63, 63, 63, 63, 61, 61, 61, 61, 61, 61,
+    61, 66, 61, 61, 61, 61, 61, 61, 61, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 17, 0, 19, 0, 0, 0, 16, 0, 0,
+    64, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254,
+    3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0,
+    255, 43, 0, 19, 0, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 49, 0,
+    15, 0, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 58, 53, 53, 53, 50, 56, 81, 56, 56,
+    56, 61, 61, 61, 61, 62, 62, 63, 63, 63, 63, 68, 68, 68, 43, 68, 74, 71, 71, 71, 66, 254, 253, 0, 0, 16, 0, 0, 254, 253,
+    0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 46, 0, 19, 0, 0, 0, 16, 0, 0, 254, 253, 0, 0, 16,
+    0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 40, 0, 19, 0, 0, 0, 16, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 17, 0, 19, 0,
+    0, 0, 16, 0, 0, 64, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0,
+    0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0,
+    0, 0, 0, 0, 0, 255, 43, 0, 19, 0, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0,
+    0, 0, 255, 49, 0, 15, 0, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 254, 3, 0, 0, 16, 0, 0, 58, 53, 53, 53,
+    50, 75, 50, 55, 60, 85, 65, 72, 71, 96, 72, 71, 73, 72, 72, 73, 72, 72, 73, 72, 67, 67, 68, 67, 67, 67, 67, 254, 0, 2,
+    253, 16, 0, 0, 73, 67, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 47, 0, 41, 0, 0, 0, 16, 0, 0, 67, 67, 67,
+    68, 67, 67, 67, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 48, 0, 59, 0, 0, 0, 8, 0, 0, 255, 0, 128, 6, 0,
+    0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 48, 0, 59, 0, 0, 0, 8, 0, 0, 255, 0, 128, 0, 0, 0, 0, 0,
+    0, 0, 255, 15, 0, 31, 0, 0, 0, 24, 0, 0, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 255, 15, 0, 26, 0, 0, 0, 24,
+    0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 15, 0, 26, 0, 0, 0, 24, 0, 0, 255, 0, 128, 3, 0, 0, 0, 0,
+    0, 0, 255, 15, 0, 24, 0, 0, 0, 24, 0, 0, 254, 1, 253, 0, 24, 0, 0, 52, 52, 51, 54, 52, 52, 52, 52, 57, 58, 57,
+    57, 57, 57, 57, 67, 67, 67, 67, 67, 67, 67, 68, 67, 67, 67, 67, 67, 67, 67, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67,
+    255, 19, 0, 14, 0, 0, 0, 24, 0, 0, 52, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24,
+    0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0,
+    255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 19, 0, 244, 255, 0, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 255, 0, 128,
+    4, 0, 1, 0, 0, 0, 0, 255, 15, 0, 238, 255, 0, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0,
+    0, 56, 55, 55, 55, 70, 66, 91, 66, 66, 66, 67, 67, 67, 67, 62, 62, 57, 57, 57, 57, 58, 58, 58, 33, 58, 54, 69, 69, 69,
+    68, 254, 0, 3, 0, 24, 0, 0, 254, 0, 3, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 19, 0, 241, 255,
+    0, 0, 24, 0, 0, 254, 0, 3, 0, 24, 0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 19, 0, 247, 255, 0, 0, 24,
+    0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 255, 0, 128, 2, 0, 0,
+    0, 0, 0, 0, 67, 255, 19, 0, 14, 0, 0, 0, 24, 0, 0, 52, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0,
+    254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254, 0,
+    253, 0, 24, 0, 0, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 255, 19, 0, 244, 255, 0, 0, 24, 0, 0, 254, 0, 253, 0, 24,
+    0, 0, 255, 0, 128, 4, 0, 1, 0, 0, 0, 0, 255, 15, 0, 238, 255, 0, 0, 24, 0, 0, 254, 0, 253, 0, 24, 0, 0, 254,
+    0, 253, 0, 24, 0, 0, 56, 55, 55, 55, 70, 95, 70, 71, 72, 97, 73, 64, 69, 94, 64, 69, 59, 64, 64, 59, 64, 64, 59, 64,
+    63, 63, 58, 63, 63, 63, 63, 254, 2, 0, 253, 24, 0, 0, 59, 63, 255, 0, 128, 2, 0, 0, 0, 0, 0, 0, 67, 255, 41, 0,
+    240, 255, 0, 0, 24, 0, 0, 63, 63, 63, 58, 63, 63, 63, 255, 0, 128, 4, 0, 0, 0, 0, 0, 0, 52, 255, 59, 0, 239, 255,
+    0, 0, 16, 0, 0, 255, 0, 128, 6, 0, 0, 0, 0, 0, 0, 254, 0, 253, 0, 0, 0, 0, 255, 59, 0, 239, 255, 0, 0, 16,
+    0, 0, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 2, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0,
+    0, 4, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 6, 0, 0, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0,
+    8, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 10, 0, 0, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 12,
+    0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 14, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0,
+    0, 16, 0, 0, 61, 254, 95, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0,
+    10, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 12, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0,
+    1, 0, 14, 0, 0, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 16, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1,
+    0, 18, 0, 0, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 20, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0,
+    22, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 24, 0, 0, 67, 254, 0, 161, 0, 8, 0, 0, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 18, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0,
+    0, 20, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 22, 0, 0, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0,
+    24, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 26, 0, 0, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 28,
+    0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 30, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0,
+    0, 0, 0, 0, 63, 254, 161, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0,
+    26, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 28, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0,
+    255, 0, 30, 0, 0, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 0, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255,
+    0, 2, 0, 0, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 4, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0,
+    6, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 8, 0, 0, 57, 254, 0, 95, 0, 24, 0, 0, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 255, 31, 0, 16, 0, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 30, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0,
+    0, 28, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 26, 0, 0, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0,
+    24, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 22, 0, 0, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 20,
+    0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0, 0, 18, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 254, 255, 0,
+    0, 16, 0, 0, 61, 254, 95, 0, 0, 0, 0, 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 255, 16, 0, 0, 0, 0, 0, 8, 0, 0, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0,
+    6, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 4, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0,
+    1, 0, 2, 0, 0, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 0, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1,
+    0, 30, 0, 0, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 28, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0,
+    26, 0, 0, 67, 67, 67, 67, 67, 67, 67, 67, 67, 254, 0, 1, 0, 24, 0, 0, 67, 254, 0, 161, 0, 8, 0, 0, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 255, 0, 0, 16, 0, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 14, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0,
+    0, 12, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 10, 0, 0, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0,
+    8, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 6, 0, 0, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 4,
+    0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0, 0, 2, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 254, 1, 0,
+    0, 0, 0, 0, 63, 254, 161, 0, 0, 16, 0, 0, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 255, 16, 0, 31, 0, 0, 0, 24, 0, 0, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0,
+    22, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 20, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0,
+    255, 0, 18, 0, 0, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 16, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255,
+    0, 14, 0, 0, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 12, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0,
+    10, 0, 0, 57, 57, 57, 57, 57, 57, 57, 57, 57, 254, 0, 255, 0, 8, 0, 0, 57, 254, 0, 95, 0, 24, 0, 0, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+    57, 57,
+};
+
+// clang-format on
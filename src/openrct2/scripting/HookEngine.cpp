@@ -14,6 +14,7 @@
 #    include "../core/EnumMap.hpp"
 #    include "ScriptEngine.h"
 
+#    include <algorithm>
 #    include <unordered_map>
 
 using namespace OpenRCT2::Scripting;
@@ -39,6 +40,11 @@ HOOK_TYPE OpenRCT2::Scripting::GetHookType(const std::string& name)
     return (result != HooksLookupTable.end()) ? result->second : HOOK_TYPE::UNDEFINED;
 }
 
+std::string_view OpenRCT2::Scripting::GetHookName(HOOK_TYPE type)
+{
+    return HooksLookupTable[type];
+}
+
 HookEngine::HookEngine(ScriptEngine& scriptEngine)
     : _scriptEngine(scriptEngine)
 {
@@ -98,54 +104,93 @@ bool HookEngine::HasSubscriptions(HOOK_TYPE type) const
 
 void HookEngine::Call(HOOK_TYPE type, bool isGameStateMutable)
 {
-    auto& hookList = GetHookList(type);
-    for (auto& hook : hookList.Hooks)
-    {
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, {}, isGameStateMutable);
-    }
+    CallHooks(type, {}, isGameStateMutable);
 }
 
 void HookEngine::Call(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutable)
 {
-    auto& hookList = GetHookList(type);
-    for (auto& hook : hookList.Hooks)
-    {
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, { arg }, isGameStateMutable);
-    }
+    CallHooks(type, { arg }, isGameStateMutable);
 }
 
 void HookEngine::Call(
     HOOK_TYPE type, const std::initializer_list<std::pair<std::string_view, std::any>>& args, bool isGameStateMutable)
 {
-    auto& hookList = GetHookList(type);
-    for (auto& hook : hookList.Hooks)
+    if (!HasSubscriptions(type))
+        return;
+
+    // Convert key/value pairs into an object, every subscriber is given the same object
+    auto ctx = _scriptEngine.GetContext();
+    auto objIdx = duk_push_object(ctx);
+    for (const auto& arg : args)
+    {
+        if (arg.second.type() == typeid(int32_t))
+        {
+            auto val = std::any_cast<int32_t>(arg.second);
+            duk_push_int(ctx, val);
+        }
+        else if (arg.second.type() == typeid(std::string))
+        {
+            const auto& val = std::any_cast<const std::string&>(arg.second);
+            duk_push_lstring(ctx, val.c_str(), val.size());
+        }
+        else
+        {
+            throw std::runtime_error("Not implemented");
+        }
+        duk_put_prop_lstring(ctx, objIdx, arg.first.data(), arg.first.size());
+    }
+
+    CallHooks(type, { DukValue::take_from_stack(ctx) }, isGameStateMutable);
+}
+
+void HookEngine::CallHooks(HOOK_TYPE type, const std::vector<DukValue>& args, bool isGameStateMutable)
+{
+    // Functions can subscribe or unsubscribe while the hooks run, so each hook is looked up again afterwards.
+    auto& hooks = GetHookList(type).Hooks;
+    size_t index = 0;
+    while (index < hooks.size())
     {
-        auto ctx = _scriptEngine.GetContext();
+        auto cookie = hooks[index].Cookie;
+        auto owner = hooks[index].Owner;
+
+        auto startTime = std::chrono::steady_clock::now();
+        _scriptEngine.ExecutePluginCall(owner, hooks[index].Function, args, isGameStateMutable);
+        auto duration = std::chrono::steady_clock::now() - startTime;
 
-        // Convert key/value pairs into an object
-        auto objIdx = duk_push_object(ctx);
-        for (const auto& arg : args)
+        auto it = std::find_if(hooks.begin(), hooks.end(), [cookie](const Hook& hook) { return hook.Cookie == cookie; });
+        if (it != hooks.end())
         {
-            if (arg.second.type() == typeid(int32_t))
-            {
-                auto val = std::any_cast<int32_t>(arg.second);
-                duk_push_int(ctx, val);
-            }
-            else if (arg.second.type() == typeid(std::string))
-            {
-                const auto& val = std::any_cast<std::string>(arg.second);
-                duk_push_string(ctx, val.c_str());
-            }
-            else
-            {
-                throw std::runtime_error("Not implemented");
-            }
-            duk_put_prop_string(ctx, objIdx, arg.first.data());
+            auto& statistics = it->Statistics;
+            statistics.Calls++;
+            statistics.TotalTime += duration;
+            statistics.MaxTime = std::max<std::chrono::nanoseconds>(statistics.MaxTime, duration);
+            index = std::distance(hooks.begin(), it) + 1;
         }
+        // Otherwise the hook unsubscribed itself and the next one took its place.
+    }
+}
 
-        std::vector<DukValue> dukArgs;
-        dukArgs.push_back(DukValue::take_from_stack(ctx));
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, dukArgs, isGameStateMutable);
+std::vector<HookStatisticsEntry> HookEngine::GetStatistics() const
+{
+    std::vector<HookStatisticsEntry> result;
+    for (const auto& hookList : _hookMap)
+    {
+        for (const auto& hook : hookList.Hooks)
+        {
+            result.push_back({ hookList.Type, hook.Owner, hook.Statistics });
+        }
+    }
+    return result;
+}
+
+void HookEngine::ResetStatistics()
+{
+    for (auto& hookList : _hookMap)
+    {
+        for (auto& hook : hookList.Hooks)
+        {
+            hook.Statistics = {};
+        }
     }
 }
 
@@ -15,6 +15,7 @@
 #    include "Duktape.hpp"
 
 #    include <any>
+#    include <chrono>
 #    include <memory>
 #    include <string>
 #    include <tuple>
@@ -45,12 +46,21 @@ namespace OpenRCT2::Scripting
     };
     constexpr size_t NUM_HOOK_TYPES = static_cast<size_t>(HOOK_TYPE::COUNT);
     HOOK_TYPE GetHookType(const std::string& name);
+    std::string_view GetHookName(HOOK_TYPE type);
+
+    struct HookStatistics
+    {
+        uint32_t Calls{};
+        std::chrono::nanoseconds TotalTime{};
+        std::chrono::nanoseconds MaxTime{};
+    };
 
     struct Hook
     {
         uint32_t Cookie;
         std::shared_ptr<Plugin> Owner;
         DukValue Function;
+        HookStatistics Statistics;
 
         Hook() = default;
         Hook(uint32_t cookie, std::shared_ptr<Plugin> owner, const DukValue& function)
@@ -71,6 +81,13 @@ namespace OpenRCT2::Scripting
         HookList(HookList&& src) = default;
     };
 
+    struct HookStatisticsEntry
+    {
+        HOOK_TYPE Type{};
+        std::shared_ptr<Plugin> Owner;
+        HookStatistics Statistics;
+    };
+
     class HookEngine
     {
     private:
@@ -91,7 +108,14 @@ namespace OpenRCT2::Scripting
         void Call(
             HOOK_TYPE type, const std::initializer_list<std::pair<std::string_view, std::any>>& args, bool isGameStateMutable);
 
+        /**
+         * Returns how often and for how long each subscribed function has run, in the order they were subscribed.
+         */
+        std::vector<HookStatisticsEntry> GetStatistics() const;
+        void ResetStatistics();
+
     private:
+        void CallHooks(HOOK_TYPE type, const std::vector<DukValue>& args, bool isGameStateMutable);
         HookList& GetHookList(HOOK_TYPE type);
         const HookList& GetHookList(HOOK_TYPE type) const;
     };
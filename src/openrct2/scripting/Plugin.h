@@ -13,6 +13,7 @@
 
 #    include "Duktape.hpp"
 
+#    include <chrono>
 #    include <memory>
 #    include <string>
 #    include <string_view>
@@ -46,6 +47,16 @@ namespace OpenRCT2::Scripting
         DukValue Main;
     };
 
+    struct PluginExecutionStatistics
+    {
+        std::chrono::nanoseconds TotalTime{};
+        // Time spent since the start of the current update.
+        std::chrono::nanoseconds UpdateTime{};
+        std::chrono::nanoseconds MaxUpdateTime{};
+        uint32_t UpdatesOverBudget{};
+        uint32_t LastBudgetWarning{};
+    };
+
     class Plugin
     {
     private:
@@ -54,6 +65,7 @@ namespace OpenRCT2::Scripting
         PluginMetadata _metadata{};
         std::string _code;
         bool _hasStarted{};
+        PluginExecutionStatistics _executionStatistics;
 
     public:
         std::string GetPath() const
@@ -81,6 +93,11 @@ namespace OpenRCT2::Scripting
             return _hasStarted;
         }
 
+        PluginExecutionStatistics& GetExecutionStatistics()
+        {
+            return _executionStatistics;
+        }
+
         int32_t GetTargetAPIVersion() const;
 
         Plugin() = default;
@@ -20,7 +20,9 @@
 #    include "../core/EnumMap.hpp"
 #    include "../core/File.h"
 #    include "../core/FileScanner.h"
+#    include "../core/JobPool.h"
 #    include "../core/Path.hpp"
+#    include "../core/String.hpp"
 #    include "../interface/InteractiveConsole.h"
 #    include "../platform/Platform2.h"
 #    include "Duktape.hpp"
@@ -50,6 +52,10 @@
 #    include "bindings/world/ScTile.hpp"
 #    include "bindings/world/ScTileElement.hpp"
 
+#    include <chrono>
+#    include <csetjmp>
+#    include <cstdio>
+#    include <cstdlib>
 #    include <iostream>
 #    include <stdexcept>
 
@@ -383,6 +389,26 @@ ScriptEngine::ScriptEngine(InteractiveConsole& console, IPlatformEnvironment& en
 {
 }
 
+// Jobs are interrupted at their next allocation once cancelled or out of time.
+static constexpr auto JobTimeLimit = std::chrono::seconds(30);
+static constexpr auto JobStopTimeout = std::chrono::seconds(2);
+
+ScriptEngine::~ScriptEngine()
+{
+    if (_jobPool == nullptr)
+        return;
+
+    std::unique_lock<std::mutex> lock(_jobQueue->Mutex);
+    _jobQueue->Cancelled = true;
+    auto stopped = _jobQueue->Done.wait_for(lock, JobStopTimeout, [this]() { return _jobQueue->Outstanding == 0; });
+    lock.unlock();
+    if (!stopped)
+    {
+        // A job that never allocates can not be interrupted, its thread is left running instead of holding up the exit.
+        [[maybe_unused]] auto abandonedPool = _jobPool.release();
+    }
+}
+
 void ScriptEngine::Initialise()
 {
     auto ctx = static_cast<duk_context*>(_context);
@@ -483,7 +509,10 @@ void ScriptEngine::LoadPlugin(std::shared_ptr<Plugin>& plugin)
     try
     {
         ScriptExecutionInfo::PluginScope scope(_execInfo, plugin, false);
-        plugin->Load();
+        {
+            TimedPluginScope timed(*this, plugin);
+            plugin->Load();
+        }
 
         auto metadata = plugin->GetMetadata();
         if (metadata.MinApiVersion <= OPENRCT2_PLUGIN_API_VERSION)
@@ -509,6 +538,7 @@ void ScriptEngine::StopPlugin(std::shared_ptr<Plugin> plugin)
         RemoveCustomGameActions(plugin);
         RemoveIntervals(plugin);
         RemoveSockets(plugin);
+        RemoveJobs(plugin);
         _hookEngine.UnsubscribeAll(plugin);
         for (const auto& callback : _pluginStoppedSubscriptions)
         {
@@ -568,8 +598,12 @@ void ScriptEngine::AutoReloadPlugins()
                     StopPlugin(plugin);
 
                     ScriptExecutionInfo::PluginScope scope(_execInfo, plugin, false);
-                    plugin->Load();
+                    {
+                        TimedPluginScope timed(*this, plugin);
+                        plugin->Load();
+                    }
                     LogPluginInfo(plugin, "Reloaded");
+                    TimedPluginScope timed(*this, plugin);
                     plugin->Start();
                 }
                 catch (const std::exception& e)
@@ -606,6 +640,7 @@ void ScriptEngine::StartPlugins()
             try
             {
                 LogPluginInfo(plugin, "Started");
+                TimedPluginScope timed(*this, plugin);
                 plugin->Start();
             }
             catch (const std::exception& e)
@@ -672,7 +707,9 @@ void ScriptEngine::Update()
 
     UpdateIntervals();
     UpdateSockets();
+    UpdateJobs();
     ProcessREPL();
+    CheckPluginBudgets();
 }
 
 void ScriptEngine::ProcessREPL()
@@ -729,7 +766,13 @@ DukValue ScriptEngine::ExecutePluginCall(
         {
             arg.push();
         }
-        auto result = duk_pcall_method(_context, static_cast<duk_idx_t>(args.size()));
+
+        duk_int_t result;
+        {
+            TimedPluginScope timed(*this, plugin);
+            result = duk_pcall_method(_context, static_cast<duk_idx_t>(args.size()));
+        }
+
         if (result == DUK_EXEC_SUCCESS)
         {
             return DukValue::take_from_stack(_context);
@@ -742,6 +785,61 @@ DukValue ScriptEngine::ExecutePluginCall(
     return DukValue();
 }
 
+ScriptEngine::TimedPluginScope::TimedPluginScope(ScriptEngine& engine, std::shared_ptr<Plugin> plugin)
+    : _engine(engine)
+{
+    _engine.ChargeTimedPlugin();
+    _outerPlugin = std::exchange(_engine._timedPlugin, std::move(plugin));
+}
+
+ScriptEngine::TimedPluginScope::~TimedPluginScope()
+{
+    _engine.ChargeTimedPlugin();
+    _engine._timedPlugin = std::move(_outerPlugin);
+}
+
+void ScriptEngine::ChargeTimedPlugin()
+{
+    auto now = std::chrono::steady_clock::now();
+    if (_timedPlugin != nullptr)
+    {
+        auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(now - _timedSince);
+        auto& statistics = _timedPlugin->GetExecutionStatistics();
+        statistics.TotalTime += duration;
+        statistics.UpdateTime += duration;
+    }
+    _timedSince = now;
+}
+
+void ScriptEngine::CheckPluginBudgets()
+{
+    // A plugin that keeps going over its budget is only reported every so often.
+    constexpr uint32_t BudgetWarningInterval = 10000;
+
+    const auto budget = std::chrono::milliseconds(gConfigPlugin.update_budget);
+    const auto tick = Platform::GetTicks();
+    for (auto& plugin : _plugins)
+    {
+        auto& statistics = plugin->GetExecutionStatistics();
+        statistics.MaxUpdateTime = std::max(statistics.MaxUpdateTime, statistics.UpdateTime);
+        if (budget.count() > 0 && statistics.UpdateTime > budget)
+        {
+            statistics.UpdatesOverBudget++;
+            if (statistics.LastBudgetWarning == 0 || tick - statistics.LastBudgetWarning >= BudgetWarningInterval)
+            {
+                using TimeMs = std::chrono::duration<double, std::milli>;
+                LogPluginInfo(
+                    plugin,
+                    String::StdFormat(
+                        "Took %.1f ms in one update, the budget is %d ms (%u updates over budget so far)",
+                        TimeMs(statistics.UpdateTime).count(), gConfigPlugin.update_budget, statistics.UpdatesOverBudget));
+                statistics.LastBudgetWarning = tick;
+            }
+        }
+        statistics.UpdateTime = {};
+    }
+}
+
 void ScriptEngine::LogPluginInfo(const std::shared_ptr<Plugin>& plugin, std::string_view message)
 {
     if (plugin == nullptr)
@@ -1098,6 +1196,64 @@ static std::unique_ptr<GameAction> CreateGameActionFromActionId(const std::strin
     return nullptr;
 }
 
+static DukValue GameActionArgsToDuk(duk_context* ctx, const GameAction& action)
+{
+    if (action.GetType() == GameCommand::Custom)
+    {
+        const auto& customAction = static_cast<const CustomAction&>(action);
+        auto dukArgs = DuktapeTryParseJson(ctx, customAction.GetJson());
+        if (dukArgs)
+        {
+            return *dukArgs;
+        }
+        DukObject args(ctx);
+        return args.Take();
+    }
+
+    DukObject args(ctx);
+    DukFromGameActionParameterVisitor visitor(args);
+    const_cast<GameAction&>(action).AcceptParameters(visitor);
+    const_cast<GameAction&>(action).AcceptFlags(visitor);
+    return args.Take();
+}
+
+static void DefineActionHookArgs(duk_context* ctx, duk_idx_t objIdx, duk_idx_t valueIdx)
+{
+    // Replaces the accessor, so the arguments are only converted once however many hooks read them.
+    objIdx = duk_normalize_index(ctx, objIdx);
+    valueIdx = duk_normalize_index(ctx, valueIdx);
+    duk_push_string(ctx, "args");
+    duk_dup(ctx, valueIdx);
+    duk_def_prop(
+        ctx, objIdx,
+        DUK_DEFPROP_HAVE_VALUE | DUK_DEFPROP_SET_WRITABLE | DUK_DEFPROP_SET_ENUMERABLE | DUK_DEFPROP_SET_CONFIGURABLE);
+}
+
+static duk_ret_t GetActionHookArgs(duk_context* ctx)
+{
+    duk_push_this(ctx);
+    duk_get_prop_string(ctx, -1, "\xFF" "action");
+    auto action = static_cast<const GameAction*>(duk_get_pointer(ctx, -1));
+    duk_pop(ctx);
+    if (action == nullptr)
+    {
+        // Read after the hooks have returned, the action no longer exists.
+        return 0;
+    }
+
+    auto args = GameActionArgsToDuk(ctx, *action);
+    args.push();
+    DefineActionHookArgs(ctx, -2, -1);
+    return 1;
+}
+
+static duk_ret_t SetActionHookArgs(duk_context* ctx)
+{
+    duk_push_this(ctx);
+    DefineActionHookArgs(ctx, -1, 0);
+    return 0;
+}
+
 void ScriptEngine::RunGameActionHooks(const GameAction& action, GameActions::Result& result, bool isExecute)
 {
     DukStackFrame frame(_context);
@@ -1110,19 +1266,8 @@ void ScriptEngine::RunGameActionHooks(const GameAction& action, GameActions::Res
         auto actionId = action.GetType();
         if (action.GetType() == GameCommand::Custom)
         {
-            auto customAction = static_cast<const CustomAction&>(action);
+            const auto& customAction = static_cast<const CustomAction&>(action);
             obj.Set("action", customAction.GetId());
-
-            auto dukArgs = DuktapeTryParseJson(_context, customAction.GetJson());
-            if (dukArgs)
-            {
-                obj.Set("args", *dukArgs);
-            }
-            else
-            {
-                DukObject args(_context);
-                obj.Set("args", args.Take());
-            }
         }
         else
         {
@@ -1131,12 +1276,6 @@ void ScriptEngine::RunGameActionHooks(const GameAction& action, GameActions::Res
             {
                 obj.Set("action", actionName);
             }
-
-            DukObject args(_context);
-            DukFromGameActionParameterVisitor visitor(args);
-            const_cast<GameAction&>(action).AcceptParameters(visitor);
-            const_cast<GameAction&>(action).AcceptFlags(visitor);
-            obj.Set("args", args.Take());
         }
 
         obj.Set("player", action.GetPlayer());
@@ -1148,8 +1287,30 @@ void ScriptEngine::RunGameActionHooks(const GameAction& action, GameActions::Res
         obj.Set("result", GameActionResultToDuk(action, result));
         auto dukEventArgs = obj.Take();
 
+        // Most hooks only look at the action and the result, the arguments are converted when a hook reads them.
+        if (_actionHookArgsGetter.type() == DukValue::Type::UNDEFINED)
+        {
+            duk_push_c_function(_context, GetActionHookArgs, 0);
+            _actionHookArgsGetter = DukValue::take_from_stack(_context);
+            duk_push_c_function(_context, SetActionHookArgs, 1);
+            _actionHookArgsSetter = DukValue::take_from_stack(_context);
+        }
+        dukEventArgs.push();
+        duk_push_string(_context, "args");
+        _actionHookArgsGetter.push();
+        _actionHookArgsSetter.push();
+        duk_def_prop(
+            _context, -4,
+            DUK_DEFPROP_HAVE_GETTER | DUK_DEFPROP_HAVE_SETTER | DUK_DEFPROP_SET_ENUMERABLE | DUK_DEFPROP_SET_CONFIGURABLE);
+        duk_push_pointer(_context, const_cast<GameAction*>(&action));
+        duk_put_prop_string(_context, -2, "\xFF" "action");
+
         _hookEngine.Call(hookType, dukEventArgs, false);
 
+        duk_push_pointer(_context, nullptr);
+        duk_put_prop_string(_context, -2, "\xFF" "action");
+        duk_pop(_context);
+
         if (!isExecute)
         {
             auto dukResult = dukEventArgs["result"];
@@ -1334,6 +1495,253 @@ void ScriptEngine::RemoveIntervals(const std::shared_ptr<Plugin>& plugin)
     }
 }
 
+void ScriptEngine::AddJob(
+    const std::shared_ptr<Plugin>& plugin, std::string_view source, std::string&& data, DukValue&& callback)
+{
+    // Jobs are meant for computation, a couple of threads is enough and leaves the rest of the machine to the game.
+    constexpr size_t MaxJobThreads = 2;
+
+    auto id = _nextJobId++;
+    _jobs.emplace(id, ScriptJob{ plugin, std::move(callback) });
+
+    if (_jobPool == nullptr)
+    {
+        _jobPool = std::make_unique<JobPool>(MaxJobThreads);
+    }
+    {
+        std::lock_guard<std::mutex> lock(_jobQueue->Mutex);
+        _jobQueue->Outstanding++;
+    }
+    _jobPool->AddTask([queue = _jobQueue, id, source = std::string(source), data = std::move(data)]() {
+        auto result = RunJob(id, source, data, queue->Cancelled);
+        std::lock_guard<std::mutex> lock(queue->Mutex);
+        queue->Results.push_back(std::move(result));
+        queue->Outstanding--;
+        queue->Done.notify_all();
+    });
+}
+
+namespace
+{
+    /**
+     * The state of a job's heap, passed to its allocation functions and fatal error handler.
+     */
+    struct JobHeap
+    {
+        std::chrono::steady_clock::time_point Deadline;
+        const std::atomic<bool>* Cancelled{};
+        bool Interrupted{};
+        bool CanJump{};
+        std::jmp_buf FatalJump{};
+        char FatalMessage[256]{};
+
+        bool CheckInterrupted()
+        {
+            if (!Interrupted && (*Cancelled || std::chrono::steady_clock::now() >= Deadline))
+            {
+                Interrupted = true;
+            }
+            return Interrupted;
+        }
+    };
+
+    enum class JobStatus
+    {
+        Success,
+        Error,
+        Fatal,
+    };
+} // namespace
+
+// Duktape has no way to interrupt a running heap, so jobs are stopped by failing their allocations instead.
+static void* JobAlloc(void* udata, duk_size_t size)
+{
+    if (static_cast<JobHeap*>(udata)->CheckInterrupted())
+        return nullptr;
+    return std::malloc(size);
+}
+
+static void* JobRealloc(void* udata, void* ptr, duk_size_t size)
+{
+    if (size != 0 && static_cast<JobHeap*>(udata)->CheckInterrupted())
+        return nullptr;
+    return std::realloc(ptr, size);
+}
+
+static void JobFree(void* udata, void* ptr)
+{
+    std::free(ptr);
+}
+
+static void JobFatal(void* udata, const char* msg)
+{
+    auto heap = static_cast<JobHeap*>(udata);
+    if (!heap->CanJump)
+    {
+        std::abort();
+    }
+    std::snprintf(heap->FatalMessage, sizeof(heap->FatalMessage), "%s", msg != nullptr ? msg : "");
+    std::longjmp(heap->FatalJump, 1);
+}
+
+/**
+ * Calls the job on its heap and leaves the result or the error message on the stack. A fatal error jumps back here,
+ * only Duktape's own frames are skipped as the job heap has no native functions.
+ */
+static JobStatus CallJob(
+    JobHeap& heap, duk_context* ctx, const std::string& source, const std::string& data, const char*& value,
+    duk_size_t& length)
+{
+    // Everything that can fail happens inside the call, so errors are caught instead of ending the heap.
+    static constexpr const char* JobRunner = R"js(
+(function (source, data) {
+    var job = (0, eval)(source);
+    if (typeof job !== 'function') {
+        throw new TypeError('Job source did not evaluate to a function.');
+    }
+    return JSON.stringify(job(data === undefined ? undefined : JSON.parse(data)));
+})
+)js";
+
+    heap.CanJump = true;
+    if (setjmp(heap.FatalJump) != 0)
+    {
+        heap.CanJump = false;
+        return JobStatus::Fatal;
+    }
+
+    auto status = JobStatus::Error;
+    if (duk_peval_string(ctx, JobRunner) == DUK_EXEC_SUCCESS)
+    {
+        duk_push_lstring(ctx, source.data(), source.size());
+        if (data.empty())
+        {
+            duk_push_undefined(ctx);
+        }
+        else
+        {
+            duk_push_lstring(ctx, data.data(), data.size());
+        }
+        if (duk_pcall(ctx, 2) == DUK_EXEC_SUCCESS)
+        {
+            status = JobStatus::Success;
+        }
+    }
+
+    if (status == JobStatus::Success)
+    {
+        value = duk_is_string(ctx, -1) ? duk_get_lstring(ctx, -1, &length) : nullptr;
+    }
+    else
+    {
+        value = duk_safe_to_lstring(ctx, -1, &length);
+    }
+    heap.CanJump = false;
+    return status;
+}
+
+ScriptJobResult ScriptEngine::RunJob(
+    uint32_t id, const std::string& source, const std::string& data, const std::atomic<bool>& cancelled)
+{
+    ScriptJobResult result;
+    result.Id = id;
+    if (cancelled)
+    {
+        result.Value = "Job was stopped.";
+        return result;
+    }
+
+    // A heap of its own without any of the game APIs, only the standard built-ins are available to jobs.
+    JobHeap heap;
+    heap.Deadline = std::chrono::steady_clock::now() + JobTimeLimit;
+    heap.Cancelled = &cancelled;
+    auto ctx = duk_create_heap(JobAlloc, JobRealloc, JobFree, &heap, JobFatal);
+    if (ctx == nullptr)
+    {
+        result.Value = "Unable to create job heap.";
+        return result;
+    }
+
+    const char* value{};
+    duk_size_t length{};
+    auto status = CallJob(heap, ctx, source, data, value, length);
+    if (status == JobStatus::Fatal)
+    {
+        // The heap is unusable after a fatal error, not even destroying it is safe.
+        result.Value = std::string("Job failed: ") + heap.FatalMessage;
+        return result;
+    }
+
+    if (heap.Interrupted)
+    {
+        result.Value = cancelled ? "Job was stopped." : "Job exceeded its time limit.";
+    }
+    else
+    {
+        result.Success = status == JobStatus::Success;
+        if (value != nullptr)
+        {
+            result.Value = std::string(value, length);
+        }
+    }
+    duk_destroy_heap(ctx);
+    return result;
+}
+
+void ScriptEngine::UpdateJobs()
+{
+    std::vector<ScriptJobResult> results;
+    {
+        std::lock_guard<std::mutex> lock(_jobQueue->Mutex);
+        results.swap(_jobQueue->Results);
+    }
+
+    for (const auto& result : results)
+    {
+        auto it = _jobs.find(result.Id);
+        if (it == _jobs.end())
+        {
+            // The plugin was stopped while the job was running.
+            continue;
+        }
+        auto job = std::move(it->second);
+        _jobs.erase(it);
+
+        duk_push_undefined(_context);
+        auto value = DukValue::take_from_stack(_context);
+        auto error = value;
+        if (!result.Success)
+        {
+            duk_push_lstring(_context, result.Value.data(), result.Value.size());
+            error = DukValue::take_from_stack(_context);
+        }
+        else if (!result.Value.empty())
+        {
+            auto parsed = DuktapeTryParseJson(_context, result.Value);
+            if (parsed)
+            {
+                value = *parsed;
+            }
+        }
+        ExecutePluginCall(job.Owner, job.Callback, { value, error }, false);
+    }
+}
+
+void ScriptEngine::RemoveJobs(const std::shared_ptr<Plugin>& plugin)
+{
+    for (auto it = _jobs.begin(); it != _jobs.end();)
+    {
+        if (it->second.Owner == plugin)
+        {
+            it = _jobs.erase(it);
+        }
+        else
+        {
+            it++;
+        }
+    }
+}
+
 #    ifndef DISABLE_NETWORK
 void ScriptEngine::AddSocket(const std::shared_ptr<ScSocketBase>& socket)
 {
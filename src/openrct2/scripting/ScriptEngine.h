@@ -18,6 +18,9 @@
 #    include "HookEngine.h"
 #    include "Plugin.h"
 
+#    include <atomic>
+#    include <chrono>
+#    include <condition_variable>
 #    include <future>
 #    include <list>
 #    include <memory>
@@ -38,6 +41,7 @@ namespace GameActions
 }
 class FileWatcher;
 class InteractiveConsole;
+class JobPool;
 
 namespace OpenRCT2
 {
@@ -46,7 +50,7 @@ namespace OpenRCT2
 
 namespace OpenRCT2::Scripting
 {
-    static constexpr int32_t OPENRCT2_PLUGIN_API_VERSION = 41;
+    static constexpr int32_t OPENRCT2_PLUGIN_API_VERSION = 47;
 
     // Versions marking breaking changes.
     static constexpr int32_t API_VERSION_33_PEEP_DEPRECATION = 33;
@@ -138,6 +142,33 @@ namespace OpenRCT2::Scripting
         }
     };
 
+    struct ScriptJob
+    {
+        std::shared_ptr<Plugin> Owner;
+        DukValue Callback;
+    };
+
+    struct ScriptJobResult
+    {
+        uint32_t Id{};
+        bool Success{};
+        // The result as JSON, or the error message if the job failed.
+        std::string Value;
+    };
+
+    /**
+     * Where jobs report their results. Shared with the job threads, so a job that can not be interrupted and is left
+     * running on exit does not outlive it.
+     */
+    struct ScriptJobQueue
+    {
+        std::mutex Mutex;
+        std::condition_variable Done;
+        std::vector<ScriptJobResult> Results;
+        size_t Outstanding{};
+        std::atomic<bool> Cancelled{};
+    };
+
     class ScriptEngine
     {
     private:
@@ -153,10 +184,21 @@ namespace OpenRCT2::Scripting
         HookEngine _hookEngine;
         ScriptExecutionInfo _execInfo;
         DukValue _sharedStorage;
+        DukValue _actionHookArgsGetter;
+        DukValue _actionHookArgsSetter;
 
         uint32_t _lastIntervalTimestamp{};
         std::vector<ScriptInterval> _intervals;
 
+        // The plugin whose code is currently running and since when, calls into other plugins pause its clock.
+        std::shared_ptr<Plugin> _timedPlugin;
+        std::chrono::steady_clock::time_point _timedSince;
+
+        uint32_t _nextJobId = 1;
+        std::unordered_map<uint32_t, ScriptJob> _jobs;
+        std::shared_ptr<ScriptJobQueue> _jobQueue = std::make_shared<ScriptJobQueue>();
+        std::unique_ptr<JobPool> _jobPool;
+
         std::unique_ptr<FileWatcher> _pluginFileWatcher;
         std::unordered_set<std::string> _changedPluginFiles;
         std::mutex _changedPluginFilesMutex;
@@ -178,6 +220,7 @@ namespace OpenRCT2::Scripting
     public:
         ScriptEngine(InteractiveConsole& console, IPlatformEnvironment& env);
         ScriptEngine(ScriptEngine&) = delete;
+        ~ScriptEngine();
 
         duk_context* GetContext()
         {
@@ -232,6 +275,12 @@ namespace OpenRCT2::Scripting
         IntervalHandle AddInterval(const std::shared_ptr<Plugin>& plugin, int32_t delay, bool repeat, DukValue&& callback);
         void RemoveInterval(const std::shared_ptr<Plugin>& plugin, IntervalHandle handle);
 
+        /**
+         * Runs a function on a worker thread in a heap of its own. The source has to evaluate to a function, it is called
+         * with a copy of the data and its return value is passed to the callback during a later update.
+         */
+        void AddJob(const std::shared_ptr<Plugin>& plugin, std::string_view source, std::string&& data, DukValue&& callback);
+
 #    ifndef DISABLE_NETWORK
         void AddSocket(const std::shared_ptr<ScSocketBase>& socket);
 #    endif
@@ -263,6 +312,27 @@ namespace OpenRCT2::Scripting
 
         void UpdateSockets();
         void RemoveSockets(const std::shared_ptr<Plugin>& plugin);
+
+        static ScriptJobResult RunJob(
+            uint32_t id, const std::string& source, const std::string& data, const std::atomic<bool>& cancelled);
+        void UpdateJobs();
+        void RemoveJobs(const std::shared_ptr<Plugin>& plugin);
+
+        // Charges the time until it is destroyed to the plugin, every call into plugin code runs inside one.
+        class TimedPluginScope
+        {
+        private:
+            ScriptEngine& _engine;
+            std::shared_ptr<Plugin> _outerPlugin;
+
+        public:
+            TimedPluginScope(ScriptEngine& engine, std::shared_ptr<Plugin> plugin);
+            TimedPluginScope(const TimedPluginScope&) = delete;
+            ~TimedPluginScope();
+        };
+
+        void ChargeTimedPlugin();
+        void CheckPluginBudgets();
     };
 
     bool IsGameStateMutable();
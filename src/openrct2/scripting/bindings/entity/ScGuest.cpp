@@ -12,6 +12,7 @@
 #    include "ScGuest.hpp"
 
 #    include "../../../entity/Guest.h"
+#    include "../../../peep/PeepStats.h"
 
 namespace OpenRCT2::Scripting
 {
@@ -142,6 +143,7 @@ namespace OpenRCT2::Scripting
         if (peep != nullptr)
         {
             peep->Happiness = value;
+            PeepStats::Update(*peep);
         }
     }
 
@@ -334,6 +336,7 @@ namespace OpenRCT2::Scripting
         if (peep != nullptr)
         {
             peep->GuestIsLostCountdown = value;
+            PeepStats::Update(*peep);
         }
     }
 
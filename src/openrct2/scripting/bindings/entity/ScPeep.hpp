@@ -11,6 +11,7 @@
 
 #ifdef ENABLE_SCRIPTING
 
+#    include "../../../peep/PeepStats.h"
 #    include "ScEntity.hpp"
 
 namespace OpenRCT2::Scripting
@@ -112,6 +113,7 @@ namespace OpenRCT2::Scripting
                 else
                     peep->PeepFlags &= ~mask;
                 peep->Invalidate();
+                PeepStats::Update(*peep);
             }
         }
 
@@ -12,6 +12,7 @@
 #    include "ScStaff.hpp"
 
 #    include "../../../entity/Staff.h"
+#    include "../../../peep/PeepStats.h"
 
 namespace OpenRCT2::Scripting
 {
@@ -82,6 +83,13 @@ namespace OpenRCT2::Scripting
                 peep->AssignedStaffType = StaffType::Entertainer;
                 peep->SpriteType = PeepSpriteType::EntertainerPanda;
             }
+            PeepStats::Update(*peep);
+
+            // The patrol area now counts towards the merged area of the new staff type.
+            if (peep->HasPatrolArea())
+            {
+                staff_update_greyed_patrol_areas();
+            }
         }
     }
 
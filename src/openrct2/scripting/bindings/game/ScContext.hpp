@@ -11,9 +11,11 @@
 
 #ifdef ENABLE_SCRIPTING
 
+#    include "../../../actions/BatchAction.h"
 #    include "../../../actions/GameAction.h"
 #    include "../../../interface/Screenshot.h"
 #    include "../../../localisation/Formatting.h"
+#    include "../../../network/network.h"
 #    include "../../../object/ObjectManager.h"
 #    include "../../../scenario/Scenario.h"
 #    include "../../Duktape.hpp"
@@ -23,6 +25,7 @@
 #    include "../game/ScDisposable.hpp"
 #    include "../object/ScObject.hpp"
 
+#    include <chrono>
 #    include <cstdio>
 #    include <memory>
 
@@ -230,6 +233,31 @@ namespace OpenRCT2::Scripting
             return std::make_shared<ScDisposable>([this, hookType, cookie]() { _hookEngine.Unsubscribe(hookType, cookie); });
         }
 
+        std::vector<DukValue> getHookStatistics()
+        {
+            using TimeMs = std::chrono::duration<double, std::milli>;
+
+            auto& scriptEngine = GetContext()->GetScriptEngine();
+            auto ctx = scriptEngine.GetContext();
+            std::vector<DukValue> result;
+            for (const auto& entry : _hookEngine.GetStatistics())
+            {
+                DukObject obj(ctx);
+                obj.Set("hook", GetHookName(entry.Type));
+                obj.Set("plugin", entry.Owner != nullptr ? entry.Owner->GetMetadata().Name : std::string());
+                obj.Set("calls", entry.Statistics.Calls);
+                obj.Set("totalTime", TimeMs(entry.Statistics.TotalTime).count());
+                obj.Set("maxTime", TimeMs(entry.Statistics.MaxTime).count());
+                result.push_back(obj.Take());
+            }
+            return result;
+        }
+
+        void resetHookStatistics()
+        {
+            _hookEngine.ResetStatistics();
+        }
+
         void queryAction(const std::string& action, const DukValue& args, const DukValue& callback)
         {
             QueryOrExecuteAction(action, args, callback, false);
@@ -240,6 +268,16 @@ namespace OpenRCT2::Scripting
             QueryOrExecuteAction(action, args, callback, true);
         }
 
+        void queryActionBatch(const DukValue& actions, const DukValue& callback)
+        {
+            QueryOrExecuteActionBatch(actions, callback, false);
+        }
+
+        void executeActionBatch(const DukValue& actions, const DukValue& callback)
+        {
+            QueryOrExecuteActionBatch(actions, callback, true);
+        }
+
         void QueryOrExecuteAction(const std::string& actionid, const DukValue& args, const DukValue& callback, bool isExecute)
         {
             auto& scriptEngine = GetContext()->GetScriptEngine();
@@ -249,20 +287,7 @@ namespace OpenRCT2::Scripting
                 auto action = scriptEngine.CreateGameAction(actionid, args);
                 if (action != nullptr)
                 {
-                    auto plugin = scriptEngine.GetExecInfo().GetCurrentPlugin();
-                    if (isExecute)
-                    {
-                        action->SetCallback(
-                            [this, plugin, callback](const GameAction*, const GameActions::Result* res) -> void {
-                                HandleGameActionResult(plugin, *res, callback);
-                            });
-                        GameActions::Execute(action.get());
-                    }
-                    else
-                    {
-                        auto res = GameActions::Query(action.get());
-                        HandleGameActionResult(plugin, res, callback);
-                    }
+                    QueryOrExecuteAction(*action, callback, isExecute);
                 }
                 else
                 {
@@ -275,7 +300,85 @@ namespace OpenRCT2::Scripting
             }
         }
 
-        void HandleGameActionResult(
+        void QueryOrExecuteActionBatch(const DukValue& actions, const DukValue& callback, bool isExecute)
+        {
+            auto& scriptEngine = GetContext()->GetScriptEngine();
+            auto ctx = scriptEngine.GetContext();
+            if (!actions.is_array())
+            {
+                duk_error(ctx, DUK_ERR_ERROR, "Expected array for actions");
+            }
+
+            try
+            {
+                auto items = actions.as_array();
+                if (items.empty() || items.size() > BatchAction::MaxActions)
+                {
+                    duk_error(ctx, DUK_ERR_RANGE_ERROR, "Invalid number of actions.");
+                }
+
+                BatchAction batchAction;
+                for (const auto& item : items)
+                {
+                    auto actionid = AsOrDefault(item["action"], "");
+                    auto action = scriptEngine.CreateGameAction(actionid, item["args"]);
+                    if (action == nullptr)
+                    {
+                        duk_error(ctx, DUK_ERR_ERROR, "Unknown action.");
+                    }
+                    if (!BatchAction::IsBatchable(action->GetType()))
+                    {
+                        duk_error(ctx, DUK_ERR_ERROR, "Action can not be part of a batch.");
+                    }
+                    batchAction.AddAction(std::move(action));
+                }
+                QueryOrExecuteBatch(batchAction, callback, isExecute);
+            }
+            catch (DukException&)
+            {
+                duk_error(ctx, DUK_ERR_ERROR, "Invalid action parameters.");
+            }
+        }
+
+    public:
+        /**
+         * Runs a batch built natively for a plugin, the callback receives the same result object as executeAction.
+         */
+        static void QueryOrExecuteBatch(BatchAction& batchAction, const DukValue& callback, bool isExecute)
+        {
+            if (network_get_mode() != NETWORK_MODE_NONE)
+            {
+                DataSerialiser ds(true);
+                batchAction.Serialise(ds);
+                if (ds.GetStream().GetLength() > BatchAction::MaxNetworkSize)
+                {
+                    auto ctx = GetContext()->GetScriptEngine().GetContext();
+                    duk_error(ctx, DUK_ERR_RANGE_ERROR, "Too many actions to send over the network.");
+                }
+            }
+            QueryOrExecuteAction(batchAction, callback, isExecute);
+        }
+
+    private:
+        static void QueryOrExecuteAction(GameAction& action, const DukValue& callback, bool isExecute)
+        {
+            auto& scriptEngine = GetContext()->GetScriptEngine();
+            auto plugin = scriptEngine.GetExecInfo().GetCurrentPlugin();
+            if (isExecute)
+            {
+                action.SetCallback([plugin, callback](const GameAction*, const GameActions::Result* res) -> void {
+                    HandleGameActionResult(plugin, *res, callback);
+                });
+                GameActions::Execute(&action);
+            }
+            else
+            {
+                auto res = GameActions::Query(&action);
+                HandleGameActionResult(plugin, res, callback);
+            }
+        }
+
+        static void HandleGameActionResult(
             const std::shared_ptr<Plugin>& plugin, const GameActions::Result& res, const DukValue& callback)
         {
             // Construct result object
@@ -285,7 +388,8 @@ namespace OpenRCT2::Scripting
             duk_push_int(ctx, static_cast<duk_int_t>(res.Error));
             duk_put_prop_string(ctx, objIdx, "error");
 
-            if (res.Error != GameActions::Status::Ok)
+            // A stopped batch succeeds for what it applied, but still tells why it stopped.
+            if (res.Error != GameActions::Status::Ok || std::any_cast<BatchActionStopped>(&res.ResultData) != nullptr)
             {
                 auto title = res.GetErrorTitle();
                 duk_push_string(ctx, title.c_str());
@@ -355,6 +459,38 @@ namespace OpenRCT2::Scripting
             scriptEngine.RemoveInterval(plugin, handle);
         }
 
+        void runJob(const std::string& source, const DukValue& data, const DukValue& callback)
+        {
+            auto& scriptEngine = GetContext()->GetScriptEngine();
+            auto ctx = scriptEngine.GetContext();
+            if (!callback.is_function())
+            {
+                duk_error(ctx, DUK_ERR_ERROR, "callback was not a function.");
+            }
+
+            auto plugin = _execInfo.GetCurrentPlugin();
+            if (plugin == nullptr)
+            {
+                duk_error(ctx, DUK_ERR_ERROR, "Not in a plugin context");
+            }
+
+            // The job runs in another heap, so the data is handed over as JSON.
+            std::string json;
+            if (data.type() != DukValue::Type::UNDEFINED)
+            {
+                data.push();
+                auto jsonz = duk_json_encode(ctx, -1);
+                if (jsonz != nullptr)
+                {
+                    json = jsonz;
+                }
+                duk_pop(ctx);
+            }
+
+            auto callbackCopy = callback;
+            scriptEngine.AddJob(plugin, source, std::move(json), std::move(callbackCopy));
+        }
+
         int32_t setInterval(DukValue callback, int32_t delay)
         {
             return SetIntervalOrTimeout(callback, delay, true);
@@ -387,13 +523,18 @@ namespace OpenRCT2::Scripting
             dukglue_register_method(ctx, &ScContext::getRandom, "getRandom");
             dukglue_register_method_varargs(ctx, &ScContext::formatString, "formatString");
             dukglue_register_method(ctx, &ScContext::subscribe, "subscribe");
+            dukglue_register_method(ctx, &ScContext::getHookStatistics, "getHookStatistics");
+            dukglue_register_method(ctx, &ScContext::resetHookStatistics, "resetHookStatistics");
             dukglue_register_method(ctx, &ScContext::queryAction, "queryAction");
             dukglue_register_method(ctx, &ScContext::executeAction, "executeAction");
+            dukglue_register_method(ctx, &ScContext::queryActionBatch, "queryActionBatch");
+            dukglue_register_method(ctx, &ScContext::executeActionBatch, "executeActionBatch");
             dukglue_register_method(ctx, &ScContext::registerAction, "registerAction");
             dukglue_register_method(ctx, &ScContext::setInterval, "setInterval");
             dukglue_register_method(ctx, &ScContext::setTimeout, "setTimeout");
             dukglue_register_method(ctx, &ScContext::clearInterval, "clearInterval");
             dukglue_register_method(ctx, &ScContext::clearTimeout, "clearTimeout");
+            dukglue_register_method(ctx, &ScContext::runJob, "runJob");
         }
     };
 } // namespace OpenRCT2::Scripting
@@ -151,6 +151,8 @@ namespace OpenRCT2::Scripting
             }
             obj.Set("bytesSent", DukValue::take_from_stack(_context));
         }
+        obj.Set("packetsFramed", static_cast<int64_t>(networkStats.packetsFramed));
+        obj.Set("bytesFramed", static_cast<int64_t>(networkStats.bytesFramed));
         return obj.Take();
 #    else
         return ToDuk(_context, nullptr);
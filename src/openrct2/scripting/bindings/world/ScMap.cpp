@@ -11,6 +11,8 @@
 
 #    include "ScMap.hpp"
 
+#    include "../../../actions/BatchAction.h"
+#    include "../../../actions/TileModifyAction.h"
 #    include "../../../common.h"
 #    include "../../../entity/Balloon.h"
 #    include "../../../entity/Duck.h"
@@ -30,9 +32,17 @@
 #    include "../entity/ScLitter.hpp"
 #    include "../entity/ScStaff.hpp"
 #    include "../entity/ScVehicle.hpp"
+#    include "../game/ScContext.hpp"
 #    include "../ride/ScRide.hpp"
 #    include "../world/ScTile.hpp"
 
+#    include <algorithm>
+#    include <cstring>
+#    include <iterator>
+#    include <limits>
+#    include <optional>
+#    include <unordered_set>
+
 namespace OpenRCT2::Scripting
 {
     ScMap::ScMap(duk_context* ctx)
@@ -167,6 +177,444 @@ namespace OpenRCT2::Scripting
         return result;
     }
 
+    enum class EntityQueryTarget : uint8_t
+    {
+        Entity,
+        Peep,
+        Guest,
+    };
+
+    struct EntityQueryField
+    {
+        std::string_view Name;
+        EntityQueryTarget Target;
+        int32_t (*Read)(const EntityBase& entity);
+    };
+
+    /**
+     * Adds the values as an Int32Array property of the object on top of the stack.
+     */
+    static void PutInt32Array(duk_context* ctx, std::string_view name, const std::vector<int32_t>& values)
+    {
+        auto dataLen = values.size() * sizeof(int32_t);
+        auto data = duk_push_fixed_buffer(ctx, dataLen);
+        if (dataLen != 0)
+        {
+            std::memcpy(data, values.data(), dataLen);
+        }
+        duk_push_buffer_object(ctx, -1, 0, dataLen, DUK_BUFOBJ_INT32ARRAY);
+        duk_put_prop_lstring(ctx, -3, name.data(), name.size());
+        duk_pop(ctx);
+    }
+
+    static const Peep& AsPeep(const EntityBase& entity)
+    {
+        return static_cast<const Peep&>(entity);
+    }
+
+    static const Guest& AsGuest(const EntityBase& entity)
+    {
+        return static_cast<const Guest&>(entity);
+    }
+
+    // clang-format off
+    static const EntityQueryField EntityQueryFields[] = {
+        { "id", EntityQueryTarget::Entity, [](const EntityBase& e) -> int32_t { return e.sprite_index; } },
+        { "x", EntityQueryTarget::Entity, [](const EntityBase& e) -> int32_t { return e.x; } },
+        { "y", EntityQueryTarget::Entity, [](const EntityBase& e) -> int32_t { return e.y; } },
+        { "z", EntityQueryTarget::Entity, [](const EntityBase& e) -> int32_t { return e.z; } },
+        { "energy", EntityQueryTarget::Peep, [](const EntityBase& e) -> int32_t { return AsPeep(e).Energy; } },
+        { "energyTarget", EntityQueryTarget::Peep, [](const EntityBase& e) -> int32_t { return AsPeep(e).EnergyTarget; } },
+        { "happiness", EntityQueryTarget::Guest, [](const EntityBase& e) -> int32_t { return AsGuest(e).Happiness; } },
+        { "happinessTarget", EntityQueryTarget::Guest,
+          [](const EntityBase& e) -> int32_t { return AsGuest(e).HappinessTarget; } },
+        { "nausea", EntityQueryTarget::Guest, [](const EntityBase& e) -> int32_t { return AsGuest(e).Nausea; } },
+        { "nauseaTarget", EntityQueryTarget::Guest, [](const EntityBase& e) -> int32_t { return AsGuest(e).NauseaTarget; } },
+        { "hunger", EntityQueryTarget::Guest, [](const EntityBase& e) -> int32_t { return AsGuest(e).Hunger; } },
+        { "thirst", EntityQueryTarget::Guest, [](const EntityBase& e) -> int32_t { return AsGuest(e).Thirst; } },
+        { "toilet", EntityQueryTarget::Guest, [](const EntityBase& e) -> int32_t { return AsGuest(e).Toilet; } },
+        { "mass", EntityQueryTarget::Guest, [](const EntityBase& e) -> int32_t { return AsGuest(e).Mass; } },
+        { "minIntensity", EntityQueryTarget::Guest,
+          [](const EntityBase& e) -> int32_t { return AsGuest(e).Intensity.GetMinimum(); } },
+        { "maxIntensity", EntityQueryTarget::Guest,
+          [](const EntityBase& e) -> int32_t { return AsGuest(e).Intensity.GetMaximum(); } },
+        { "nauseaTolerance", EntityQueryTarget::Guest,
+          [](const EntityBase& e) -> int32_t { return EnumValue(AsGuest(e).NauseaTolerance); } },
+        { "cash", EntityQueryTarget::Guest, [](const EntityBase& e) -> int32_t { return AsGuest(e).CashInPocket; } },
+        { "isInPark", EntityQueryTarget::Guest, [](const EntityBase& e) -> int32_t { return !AsGuest(e).OutsideOfPark; } },
+        { "isLost", EntityQueryTarget::Guest,
+          [](const EntityBase& e) -> int32_t { return AsGuest(e).GuestIsLostCountdown < 90; } },
+        { "lostCountdown", EntityQueryTarget::Guest,
+          [](const EntityBase& e) -> int32_t { return AsGuest(e).GuestIsLostCountdown; } },
+    };
+    // clang-format on
+
+    /**
+     * Calls func for every entity getAllEntities would return for the type, returns false for types it does not know.
+     */
+    template<typename TFunc> static bool ForEachQueryEntity(std::string_view type, TFunc func)
+    {
+        if (type == "balloon")
+        {
+            for (auto sprite : EntityList<Balloon>())
+                func(*sprite);
+        }
+        else if (type == "car")
+        {
+            for (auto trainHead : TrainManager::View())
+            {
+                for (auto car = trainHead; car != nullptr; car = GetEntity<Vehicle>(car->next_vehicle_on_train))
+                    func(*car);
+            }
+        }
+        else if (type == "litter")
+        {
+            for (auto sprite : EntityList<Litter>())
+                func(*sprite);
+        }
+        else if (type == "duck")
+        {
+            for (auto sprite : EntityList<Duck>())
+                func(*sprite);
+        }
+        else if (type == "peep" || type == "guest" || type == "staff")
+        {
+            if (type != "staff")
+            {
+                for (auto sprite : EntityList<Guest>())
+                    func(*sprite);
+            }
+            if (type != "guest")
+            {
+                for (auto sprite : EntityList<Staff>())
+                    func(*sprite);
+            }
+        }
+        else
+        {
+            return false;
+        }
+        return true;
+    }
+
+    static const EntityQueryField* GetEntityQueryField(std::string_view type, std::string_view name)
+    {
+        auto target = EntityQueryTarget::Entity;
+        if (type == "guest")
+            target = EntityQueryTarget::Guest;
+        else if (type == "peep" || type == "staff")
+            target = EntityQueryTarget::Peep;
+
+        for (const auto& field : EntityQueryFields)
+        {
+            if (field.Name == name)
+            {
+                return field.Target <= target ? &field : nullptr;
+            }
+        }
+        return nullptr;
+    }
+
+    DukValue ScMap::queryEntities(const std::string& type, const std::vector<std::string>& fields, const DukValue& filter) const
+    {
+        struct Filter
+        {
+            const EntityQueryField* Field;
+            int32_t Min;
+            int32_t Max;
+        };
+
+        // Everything is checked before any entity is read.
+        std::vector<const EntityQueryField*> columns;
+        for (const auto& name : fields)
+        {
+            auto field = GetEntityQueryField(type, name);
+            if (field == nullptr)
+            {
+                duk_error(_context, DUK_ERR_ERROR, "Invalid field for entity type.");
+            }
+            columns.push_back(field);
+        }
+
+        std::vector<Filter> filters;
+        if (filter.type() == DukValue::Type::OBJECT)
+        {
+            filter.push();
+            duk_enum(_context, -1, 0);
+            while (duk_next(_context, -1, 1))
+            {
+                auto value = DukValue::take_from_stack(_context, -1);
+                auto key = DukValue::take_from_stack(_context, -1);
+                auto field = GetEntityQueryField(type, AsOrDefault(key, ""));
+                if (field == nullptr)
+                {
+                    duk_error(_context, DUK_ERR_ERROR, "Invalid field for entity type.");
+                }
+                if (value.type() == DukValue::Type::NUMBER)
+                {
+                    filters.push_back({ field, value.as_int(), value.as_int() });
+                }
+                else if (value.type() == DukValue::Type::BOOLEAN)
+                {
+                    filters.push_back({ field, value.as_bool() ? 1 : 0, value.as_bool() ? 1 : 0 });
+                }
+                else if (value.type() == DukValue::Type::OBJECT)
+                {
+                    filters.push_back({ field, AsOrDefault(value["min"], std::numeric_limits<int32_t>::min()),
+                                        AsOrDefault(value["max"], std::numeric_limits<int32_t>::max()) });
+                }
+                else
+                {
+                    duk_error(_context, DUK_ERR_ERROR, "Invalid filter value for field.");
+                }
+            }
+            duk_pop_2(_context);
+        }
+
+        std::vector<std::vector<int32_t>> values(columns.size());
+        int32_t count = 0;
+        auto validType = ForEachQueryEntity(type, [&](const EntityBase& entity) {
+            for (const auto& f : filters)
+            {
+                auto value = f.Field->Read(entity);
+                if (value < f.Min || value > f.Max)
+                    return;
+            }
+            for (size_t i = 0; i < columns.size(); i++)
+            {
+                values[i].push_back(columns[i]->Read(entity));
+            }
+            count++;
+        });
+        if (!validType)
+        {
+            duk_error(_context, DUK_ERR_ERROR, "Invalid entity type.");
+        }
+
+        duk_push_object(_context);
+        duk_push_int(_context, count);
+        duk_put_prop_string(_context, -2, "count");
+        for (size_t i = 0; i < columns.size(); i++)
+        {
+            PutInt32Array(_context, columns[i]->Name, values[i]);
+        }
+        return DukValue::take_from_stack(_context);
+    }
+
+    static constexpr const char* TileElementTypeNames[] = {
+        "surface", "footpath", "track", "small_scenery", "entrance", "wall", "large_scenery", "banner",
+    };
+
+    static std::optional<TileElementType> GetTileElementType(std::string_view name)
+    {
+        for (size_t i = 0; i < std::size(TileElementTypeNames); i++)
+        {
+            if (name == TileElementTypeNames[i])
+            {
+                return static_cast<TileElementType>(i);
+            }
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * The object index the element's object property returns, -1 for elements without one.
+     */
+    static int32_t GetTileElementObjectIndex(const TileElement& element)
+    {
+        switch (element.GetType())
+        {
+            case TileElementType::Path:
+                return element.AsPath()->GetLegacyPathEntryIndex();
+            case TileElementType::SmallScenery:
+                return element.AsSmallScenery()->GetEntryIndex();
+            case TileElementType::LargeScenery:
+                return element.AsLargeScenery()->GetEntryIndex();
+            case TileElementType::Wall:
+                return element.AsWall()->GetEntryIndex();
+            case TileElementType::Entrance:
+                return element.AsEntrance()->GetEntranceType();
+            default:
+                return -1;
+        }
+    }
+
+    DukValue ScMap::getTiles(const DukValue& range, const DukValue& filter) const
+    {
+        if (range.type() != DukValue::Type::OBJECT || range["leftTop"].type() != DukValue::Type::OBJECT
+            || range["rightBottom"].type() != DukValue::Type::OBJECT)
+        {
+            duk_error(_context, DUK_ERR_ERROR, "Invalid map range.");
+        }
+        auto leftTop = range["leftTop"];
+        auto rightBottom = range["rightBottom"];
+        auto mapRange = MapRange(
+            AsOrDefault(leftTop["x"], 0), AsOrDefault(leftTop["y"], 0), AsOrDefault(rightBottom["x"], 0),
+            AsOrDefault(rightBottom["y"], 0));
+        mapRange = mapRange.Normalise();
+        auto left = std::max(0, mapRange.GetLeft() / COORDS_XY_STEP);
+        auto top = std::max(0, mapRange.GetTop() / COORDS_XY_STEP);
+        auto right = std::min(gMapSize - 1, mapRange.GetRight() / COORDS_XY_STEP);
+        auto bottom = std::min(gMapSize - 1, mapRange.GetBottom() / COORDS_XY_STEP);
+
+        std::optional<TileElementType> filterType;
+        int32_t minBaseHeight = 0;
+        int32_t maxBaseHeight = std::numeric_limits<int32_t>::max();
+        if (filter.type() == DukValue::Type::OBJECT)
+        {
+            auto type = filter["type"];
+            if (type.type() == DukValue::Type::STRING)
+            {
+                filterType = GetTileElementType(type.as_string());
+                if (!filterType)
+                {
+                    duk_error(_context, DUK_ERR_ERROR, "Invalid tile element type.");
+                }
+            }
+            else if (type.type() != DukValue::Type::UNDEFINED)
+            {
+                duk_error(_context, DUK_ERR_ERROR, "Invalid tile element type.");
+            }
+            auto baseHeight = filter["baseHeight"];
+            if (baseHeight.type() == DukValue::Type::NUMBER)
+            {
+                minBaseHeight = maxBaseHeight = baseHeight.as_int();
+            }
+            else if (baseHeight.type() == DukValue::Type::OBJECT)
+            {
+                minBaseHeight = AsOrDefault(baseHeight["min"], minBaseHeight);
+                maxBaseHeight = AsOrDefault(baseHeight["max"], maxBaseHeight);
+            }
+            else if (baseHeight.type() != DukValue::Type::UNDEFINED)
+            {
+                duk_error(_context, DUK_ERR_ERROR, "Invalid base height filter.");
+            }
+        }
+
+        std::vector<int32_t> xs, ys, indices, types, baseHeights, clearanceHeights, objects;
+        for (int32_t y = top; y <= bottom; y++)
+        {
+            for (int32_t x = left; x <= right; x++)
+            {
+                auto element = map_get_first_element_at(TileCoordsXY(x, y));
+                if (element == nullptr)
+                    continue;
+
+                int32_t index = 0;
+                do
+                {
+                    auto type = element->GetType();
+                    if ((!filterType || type == *filterType) && element->base_height >= minBaseHeight
+                        && element->base_height <= maxBaseHeight)
+                    {
+                        xs.push_back(x);
+                        ys.push_back(y);
+                        indices.push_back(index);
+                        types.push_back(EnumValue(type));
+                        baseHeights.push_back(element->base_height);
+                        clearanceHeights.push_back(element->clearance_height);
+                        objects.push_back(GetTileElementObjectIndex(*element));
+                    }
+                    index++;
+                } while (!(element++)->IsLastForTile());
+            }
+        }
+
+        duk_push_object(_context);
+        duk_push_int(_context, static_cast<duk_int_t>(xs.size()));
+        duk_put_prop_string(_context, -2, "count");
+        PutInt32Array(_context, "x", xs);
+        PutInt32Array(_context, "y", ys);
+        PutInt32Array(_context, "index", indices);
+        PutInt32Array(_context, "type", types);
+        PutInt32Array(_context, "baseHeight", baseHeights);
+        PutInt32Array(_context, "clearanceHeight", clearanceHeights);
+        PutInt32Array(_context, "object", objects);
+
+        auto typeNamesIdx = duk_push_array(_context);
+        for (size_t i = 0; i < std::size(TileElementTypeNames); i++)
+        {
+            duk_push_string(_context, TileElementTypeNames[i]);
+            duk_put_prop_index(_context, typeNamesIdx, static_cast<duk_uarridx_t>(i));
+        }
+        duk_put_prop_string(_context, -2, "typeNames");
+        return DukValue::take_from_stack(_context);
+    }
+
+    void ScMap::setTileHeights(const DukValue& changes, const DukValue& callback)
+    {
+        if (changes.type() != DukValue::Type::OBJECT)
+        {
+            duk_error(_context, DUK_ERR_ERROR, "Invalid tile changes.");
+        }
+
+        // Any array like works, so the arrays getTiles returns can be edited and passed back.
+        static constexpr const char* ColumnNames[] = { "x", "y", "index", "baseHeight" };
+        std::vector<int32_t> columns[std::size(ColumnNames)];
+        for (size_t i = 0; i < std::size(ColumnNames); i++)
+        {
+            changes.push();
+            duk_get_prop_string(_context, -1, ColumnNames[i]);
+            if (!duk_is_object(_context, -1))
+            {
+                duk_error(_context, DUK_ERR_ERROR, "Invalid tile changes.");
+            }
+            auto length = duk_get_length(_context, -1);
+            columns[i].reserve(length);
+            for (duk_uarridx_t j = 0; j < length; j++)
+            {
+                duk_get_prop_index(_context, -1, j);
+                columns[i].push_back(duk_get_int(_context, -1));
+                duk_pop(_context);
+            }
+            duk_pop_2(_context);
+        }
+        const auto& [xs, ys, indices, baseHeights] = columns;
+        if (ys.size() != xs.size() || indices.size() != xs.size() || baseHeights.size() != xs.size())
+        {
+            duk_error(_context, DUK_ERR_ERROR, "Tile change arrays differ in length.");
+        }
+
+        BatchAction batchAction;
+        size_t numActions = 0;
+        // Offsets are worked out from the current heights, an element listed twice would be moved twice.
+        std::unordered_set<uint64_t> changedElements;
+        for (size_t i = 0; i < xs.size(); i++)
+        {
+            if (xs[i] < 0 || ys[i] < 0 || xs[i] >= gMapSize || ys[i] >= gMapSize)
+            {
+                duk_error(_context, DUK_ERR_RANGE_ERROR, "Tile %d, %d is outside the map.", xs[i], ys[i]);
+            }
+            auto element = map_get_nth_element_at(TileCoordsXY(xs[i], ys[i]).ToCoordsXY(), indices[i]);
+            if (element == nullptr)
+            {
+                duk_error(_context, DUK_ERR_ERROR, "No tile element at %d, %d index %d.", xs[i], ys[i], indices[i]);
+            }
+            auto key = (static_cast<uint64_t>(xs[i]) << 48) | (static_cast<uint64_t>(ys[i]) << 32)
+                | static_cast<uint32_t>(indices[i]);
+            if (!changedElements.insert(key).second)
+            {
+                duk_error(
+                    _context, DUK_ERR_ERROR, "Tile element at %d, %d index %d is listed twice.", xs[i], ys[i], indices[i]);
+            }
+            auto offset = baseHeights[i] - element->base_height;
+            if (offset == 0)
+                continue;
+            if (offset < std::numeric_limits<int8_t>::min() || offset > std::numeric_limits<int8_t>::max())
+            {
+                duk_error(_context, DUK_ERR_RANGE_ERROR, "Invalid base height.");
+            }
+            if (++numActions > BatchAction::MaxActions)
+            {
+                duk_error(_context, DUK_ERR_RANGE_ERROR, "Too many tile changes.");
+            }
+            batchAction.AddAction(std::make_unique<TileModifyAction>(
+                TileCoordsXY(xs[i], ys[i]).ToCoordsXY(), TileModifyType::AnyBaseHeightOffset, indices[i],
+                static_cast<uint8_t>(static_cast<int8_t>(offset))));
+        }
+        ScContext::QueryOrExecuteBatch(batchAction, callback, true);
+    }
+
     template<typename TEntityType, typename TScriptType>
     DukValue createEntityType(duk_context* ctx, const DukValue& initializer)
     {
@@ -252,6 +700,9 @@ namespace OpenRCT2::Scripting
         dukglue_register_method(ctx, &ScMap::getTile, "getTile");
         dukglue_register_method(ctx, &ScMap::getEntity, "getEntity");
         dukglue_register_method(ctx, &ScMap::getAllEntities, "getAllEntities");
+        dukglue_register_method(ctx, &ScMap::queryEntities, "queryEntities");
+        dukglue_register_method(ctx, &ScMap::getTiles, "getTiles");
+        dukglue_register_method(ctx, &ScMap::setTileHeights, "setTileHeights");
         dukglue_register_method(ctx, &ScMap::createEntity, "createEntity");
     }
 
@@ -42,6 +42,12 @@ namespace OpenRCT2::Scripting
 
         std::vector<DukValue> getAllEntities(const std::string& type) const;
 
+        DukValue queryEntities(const std::string& type, const std::vector<std::string>& fields, const DukValue& filter) const;
+
+        DukValue getTiles(const DukValue& range, const DukValue& filter) const;
+
+        void setTileHeights(const DukValue& changes, const DukValue& callback);
+
         DukValue createEntity(const std::string& type, const DukValue& initializer);
 
         static void Register(duk_context* ctx);
@@ -94,7 +94,7 @@ namespace OpenRCT2::Scripting
     void ScTileElement::baseHeight_set(uint8_t newBaseHeight)
     {
         ThrowIfGameStateNotMutable();
-        _element->base_height = newBaseHeight;
+        _element->SetBaseZ(newBaseHeight * COORDS_Z_STEP);
         Invalidate();
     }
 
@@ -116,7 +116,7 @@ namespace OpenRCT2::Scripting
     void ScTileElement::clearanceHeight_set(uint8_t newClearanceHeight)
     {
         ThrowIfGameStateNotMutable();
-        _element->clearance_height = newClearanceHeight;
+        _element->SetClearanceZ(newClearanceHeight * COORDS_Z_STEP);
         Invalidate();
     }
 
@@ -18,6 +18,11 @@
 #include "SmallScenery.h"
 #include "Surface.h"
 
+#include <algorithm>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
 static int32_t map_place_clear_func(
     TileElement** tile_element, const CoordsXY& coords, uint8_t flags, money32* price, bool is_scenery)
 {
@@ -104,6 +109,304 @@ static bool MapLoc68BABCShouldContinue(
     return false;
 }
 
+namespace
+{
+    struct ClearanceIndexEntry
+    {
+        uint16_t Offset;
+        uint8_t BaseHeight;
+        uint8_t ClearanceHeight;
+        uint8_t Quadrants;
+    };
+
+    /**
+     * Height intervals of the elements on a single tile. Non-surface elements that are not ghosts are kept sorted by
+     * base height so only the ones overlapping a given height range need to be looked at.
+     */
+    struct TileClearanceIndex
+    {
+        // The elements the index was built from, a tile whose elements moved is indexed again.
+        const TileElementBase* FirstElement{};
+        const TileElementBase* LastElement{};
+        std::vector<ClearanceIndexEntry> Elements;
+        // Highest clearance height of Elements[0..i], allows the search to stop early.
+        std::vector<uint8_t> MaxClearanceHeight;
+        std::vector<uint16_t> Surfaces;
+    };
+} // namespace
+
+// Tiles are only indexed once they are queried, limit the amount so the cache does not grow with the map.
+static constexpr size_t MaxIndexedTiles = 16384;
+
+static std::unordered_map<uint32_t, TileClearanceIndex> _clearanceIndex;
+// The indexed tiles by their first element, to find the tile of an element that changed.
+static std::map<const TileElementBase*, uint32_t> _clearanceIndexTiles;
+static bool _clearanceIndexInvalid = true;
+static std::vector<uint16_t> _clearanceCandidates;
+
+static uint32_t GetClearanceIndexKey(const TileCoordsXY& tileLoc)
+{
+    return (static_cast<uint32_t>(tileLoc.x) << 16) | static_cast<uint32_t>(tileLoc.y);
+}
+
+static void RemoveTileClearanceIndex(std::unordered_map<uint32_t, TileClearanceIndex>::iterator it)
+{
+    _clearanceIndexTiles.erase(it->second.FirstElement);
+    _clearanceIndex.erase(it);
+}
+
+void MapInvalidateClearanceIndex()
+{
+    _clearanceIndexInvalid = true;
+}
+
+void MapInvalidateClearanceIndex(const CoordsXY& loc)
+{
+    if (_clearanceIndexInvalid)
+        return;
+
+    auto it = _clearanceIndex.find(GetClearanceIndexKey(TileCoordsXY(loc)));
+    if (it != _clearanceIndex.end())
+    {
+        RemoveTileClearanceIndex(it);
+    }
+}
+
+void MapInvalidateClearanceIndex(const TileElementBase& element)
+{
+    if (_clearanceIndexInvalid || _clearanceIndexTiles.empty())
+        return;
+
+    auto tileIt = _clearanceIndexTiles.upper_bound(&element);
+    if (tileIt == _clearanceIndexTiles.begin())
+        return;
+
+    tileIt--;
+    auto it = _clearanceIndex.find(tileIt->second);
+    if (it != _clearanceIndex.end() && &element <= it->second.LastElement)
+    {
+        RemoveTileClearanceIndex(it);
+    }
+}
+
+static const TileClearanceIndex& GetTileClearanceIndex(const CoordsXY& loc, const TileElement* firstElement)
+{
+    if (_clearanceIndexInvalid || _clearanceIndex.size() >= MaxIndexedTiles)
+    {
+        _clearanceIndex.clear();
+        _clearanceIndexTiles.clear();
+        _clearanceIndexInvalid = false;
+    }
+
+    const auto key = GetClearanceIndexKey(TileCoordsXY(loc));
+    auto it = _clearanceIndex.find(key);
+    if (it != _clearanceIndex.end())
+    {
+        if (it->second.FirstElement == firstElement)
+            return it->second;
+
+        RemoveTileClearanceIndex(it);
+    }
+
+    auto& index = _clearanceIndex[key];
+    index.FirstElement = firstElement;
+
+    uint16_t offset = 0;
+    const auto* tileElement = firstElement;
+    do
+    {
+        if (tileElement->GetType() == TileElementType::Surface)
+        {
+            index.Surfaces.push_back(offset);
+        }
+        else if (!tileElement->IsGhost())
+        {
+            index.Elements.push_back(
+                { offset, tileElement->base_height, tileElement->clearance_height, tileElement->GetOccupiedQuadrants() });
+        }
+        offset++;
+    } while (!(tileElement++)->IsLastForTile());
+    index.LastElement = tileElement - 1;
+    _clearanceIndexTiles[index.FirstElement] = key;
+
+    std::stable_sort(index.Elements.begin(), index.Elements.end(), [](const auto& a, const auto& b) {
+        return a.BaseHeight < b.BaseHeight;
+    });
+
+    uint8_t maxClearanceHeight = 0;
+    index.MaxClearanceHeight.reserve(index.Elements.size());
+    for (const auto& entry : index.Elements)
+    {
+        maxClearanceHeight = std::max(maxClearanceHeight, entry.ClearanceHeight);
+        index.MaxClearanceHeight.push_back(maxClearanceHeight);
+    }
+    return index;
+}
+
+/**
+ * Gets the offsets of all surface elements and all elements overlapping the given height range and quarters, in the
+ * same order as they appear on the tile.
+ */
+static const std::vector<uint16_t>& GetClearanceCandidates(
+    const CoordsXYRangedZ& pos, uint8_t baseQuarter, const TileElement* firstElement)
+{
+    const auto& index = GetTileClearanceIndex(pos, firstElement);
+
+    auto& candidates = _clearanceCandidates;
+    candidates.assign(index.Surfaces.begin(), index.Surfaces.end());
+
+    // Only elements starting below the top of the range can overlap it.
+    auto end = std::lower_bound(
+        index.Elements.begin(), index.Elements.end(), pos.clearanceZ, [](const ClearanceIndexEntry& entry, int32_t z) {
+            return entry.BaseHeight * COORDS_Z_STEP < z;
+        });
+    for (auto i = std::distance(index.Elements.begin(), end) - 1; i >= 0; i--)
+    {
+        if (index.MaxClearanceHeight[i] * COORDS_Z_STEP <= pos.baseZ)
+            break;
+
+        const auto& entry = index.Elements[i];
+        if (entry.ClearanceHeight * COORDS_Z_STEP > pos.baseZ && (entry.Quadrants & baseQuarter))
+        {
+            candidates.push_back(entry.Offset);
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end());
+    return candidates;
+}
+
+/**
+ * The index can only be used when the check does not remove any elements from the tile.
+ */
+static bool CanUseClearanceIndex(CLEAR_FUNC clearFunc, uint8_t flags)
+{
+    return clearFunc == nullptr || !(flags & GAME_COMMAND_FLAG_APPLY) || (flags & GAME_COMMAND_FLAG_GHOST);
+}
+
+/**
+ * Checks a single element on the tile, returns false if it blocks construction in which case res contains the error.
+ */
+static bool MapCanConstructWithClearAtElement(
+    TileElement*& tileElement, const CoordsXYRangedZ& pos, CLEAR_FUNC clearFunc, QuarterTile quarterTile, uint8_t flags,
+    uint8_t crossingMode, bool isTree, uint8_t& groundFlags, bool& canBuildCrossing, GameActions::Result& res)
+{
+    if (tileElement->GetType() != TileElementType::Surface)
+    {
+        if (pos.baseZ < tileElement->GetClearanceZ() && pos.clearanceZ > tileElement->GetBaseZ() && !(tileElement->IsGhost()))
+        {
+            if (tileElement->GetOccupiedQuadrants() & (quarterTile.GetBaseQuarterOccupied()))
+            {
+                if (MapLoc68BABCShouldContinue(&tileElement, pos, clearFunc, flags, res.Cost, crossingMode, canBuildCrossing))
+                {
+                    return true;
+                }
+
+                map_obstruction_set_error_text(tileElement, res);
+                res.Error = GameActions::Status::NoClearance;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    const auto waterHeight = tileElement->AsSurface()->GetWaterHeight();
+    if (waterHeight && waterHeight > pos.baseZ && tileElement->GetBaseZ() < pos.clearanceZ)
+    {
+        groundFlags |= ELEMENT_IS_UNDERWATER;
+        if (waterHeight < pos.clearanceZ)
+        {
+            if (clearFunc != nullptr && clearFunc(&tileElement, pos, flags, &res.Cost))
+            {
+                res.Error = GameActions::Status::NoClearance;
+                res.ErrorMessage = STR_CANNOT_BUILD_PARTLY_ABOVE_AND_PARTLY_BELOW_WATER;
+                return false;
+            }
+        }
+    }
+
+    if (gParkFlags & PARK_FLAGS_FORBID_HIGH_CONSTRUCTION && !isTree)
+    {
+        const auto heightFromGround = pos.clearanceZ - tileElement->GetBaseZ();
+
+        if (heightFromGround > (18 * COORDS_Z_STEP))
+        {
+            res.Error = GameActions::Status::Disallowed;
+            res.ErrorMessage = STR_LOCAL_AUTHORITY_WONT_ALLOW_CONSTRUCTION_ABOVE_TREE_HEIGHT;
+            return false;
+        }
+    }
+
+    // Only allow building crossings directly on a flat surface tile.
+    if (tileElement->GetType() == TileElementType::Surface
+        && (tileElement->AsSurface()->GetSlope()) == TILE_ELEMENT_SLOPE_FLAT && tileElement->GetBaseZ() == pos.baseZ)
+    {
+        canBuildCrossing = true;
+    }
+
+    if (quarterTile.GetZQuarterOccupied() != 0b1111)
+    {
+        if (tileElement->GetBaseZ() >= pos.clearanceZ)
+        {
+            // loc_68BA81
+            groundFlags |= ELEMENT_IS_UNDERGROUND;
+            groundFlags &= ~ELEMENT_IS_ABOVE_GROUND;
+        }
+        else
+        {
+            auto northZ = tileElement->GetBaseZ();
+            auto eastZ = northZ;
+            auto southZ = northZ;
+            auto westZ = northZ;
+            const auto slope = tileElement->AsSurface()->GetSlope();
+            if (slope & TILE_ELEMENT_SLOPE_N_CORNER_UP)
+            {
+                northZ += LAND_HEIGHT_STEP;
+                if (slope == (TILE_ELEMENT_SLOPE_S_CORNER_DN | TILE_ELEMENT_SLOPE_DOUBLE_HEIGHT))
+                    northZ += LAND_HEIGHT_STEP;
+            }
+            if (slope & TILE_ELEMENT_SLOPE_E_CORNER_UP)
+            {
+                eastZ += LAND_HEIGHT_STEP;
+                if (slope == (TILE_ELEMENT_SLOPE_W_CORNER_DN | TILE_ELEMENT_SLOPE_DOUBLE_HEIGHT))
+                    eastZ += LAND_HEIGHT_STEP;
+            }
+            if (slope & TILE_ELEMENT_SLOPE_S_CORNER_UP)
+            {
+                southZ += LAND_HEIGHT_STEP;
+                if (slope == (TILE_ELEMENT_SLOPE_N_CORNER_DN | TILE_ELEMENT_SLOPE_DOUBLE_HEIGHT))
+                    southZ += LAND_HEIGHT_STEP;
+            }
+            if (slope & TILE_ELEMENT_SLOPE_W_CORNER_UP)
+            {
+                westZ += LAND_HEIGHT_STEP;
+                if (slope == (TILE_ELEMENT_SLOPE_E_CORNER_DN | TILE_ELEMENT_SLOPE_DOUBLE_HEIGHT))
+                    westZ += LAND_HEIGHT_STEP;
+            }
+            const auto baseHeight = pos.baseZ + (4 * COORDS_Z_STEP);
+            const auto baseQuarter = quarterTile.GetBaseQuarterOccupied();
+            const auto zQuarter = quarterTile.GetZQuarterOccupied();
+            if ((!(baseQuarter & 0b0001) || ((zQuarter & 0b0001 || pos.baseZ >= northZ) && baseHeight >= northZ))
+                && (!(baseQuarter & 0b0010) || ((zQuarter & 0b0010 || pos.baseZ >= eastZ) && baseHeight >= eastZ))
+                && (!(baseQuarter & 0b0100) || ((zQuarter & 0b0100 || pos.baseZ >= southZ) && baseHeight >= southZ))
+                && (!(baseQuarter & 0b1000) || ((zQuarter & 0b1000 || pos.baseZ >= westZ) && baseHeight >= westZ)))
+            {
+                return true;
+            }
+
+            if (MapLoc68BABCShouldContinue(&tileElement, pos, clearFunc, flags, res.Cost, crossingMode, canBuildCrossing))
+            {
+                return true;
+            }
+
+            map_obstruction_set_error_text(tileElement, res);
+            res.Error = GameActions::Status::NoClearance;
+            return false;
+        }
+    }
+    return true;
+}
+
 /**
  *
  *  rct2: 0x0068B932
@@ -144,124 +447,31 @@ GameActions::Result MapCanConstructWithClearAt(
         return res;
     }
 
-    do
+    if (CanUseClearanceIndex(clearFunc, flags))
     {
-        if (tileElement->GetType() != TileElementType::Surface)
+        // Nothing gets removed, so only the elements that can affect the result need to be visited, in tile order.
+        auto* firstElement = tileElement;
+        for (auto offset : GetClearanceCandidates(pos, quarterTile.GetBaseQuarterOccupied(), firstElement))
         {
-            if (pos.baseZ < tileElement->GetClearanceZ() && pos.clearanceZ > tileElement->GetBaseZ()
-                && !(tileElement->IsGhost()))
+            tileElement = firstElement + offset;
+            if (!MapCanConstructWithClearAtElement(
+                    tileElement, pos, clearFunc, quarterTile, flags, crossingMode, isTree, groundFlags, canBuildCrossing, res))
             {
-                if (tileElement->GetOccupiedQuadrants() & (quarterTile.GetBaseQuarterOccupied()))
-                {
-                    if (MapLoc68BABCShouldContinue(
-                            &tileElement, pos, clearFunc, flags, res.Cost, crossingMode, canBuildCrossing))
-                    {
-                        continue;
-                    }
-
-                    map_obstruction_set_error_text(tileElement, res);
-                    res.Error = GameActions::Status::NoClearance;
-                    return res;
-                }
-            }
-            continue;
-        }
-
-        const auto waterHeight = tileElement->AsSurface()->GetWaterHeight();
-        if (waterHeight && waterHeight > pos.baseZ && tileElement->GetBaseZ() < pos.clearanceZ)
-        {
-            groundFlags |= ELEMENT_IS_UNDERWATER;
-            if (waterHeight < pos.clearanceZ)
-            {
-                if (clearFunc != nullptr && clearFunc(&tileElement, pos, flags, &res.Cost))
-                {
-                    res.Error = GameActions::Status::NoClearance;
-                    res.ErrorMessage = STR_CANNOT_BUILD_PARTLY_ABOVE_AND_PARTLY_BELOW_WATER;
-                    return res;
-                }
-            }
-        }
-
-        if (gParkFlags & PARK_FLAGS_FORBID_HIGH_CONSTRUCTION && !isTree)
-        {
-            const auto heightFromGround = pos.clearanceZ - tileElement->GetBaseZ();
-
-            if (heightFromGround > (18 * COORDS_Z_STEP))
-            {
-                res.Error = GameActions::Status::Disallowed;
-                res.ErrorMessage = STR_LOCAL_AUTHORITY_WONT_ALLOW_CONSTRUCTION_ABOVE_TREE_HEIGHT;
                 return res;
             }
         }
-
-        // Only allow building crossings directly on a flat surface tile.
-        if (tileElement->GetType() == TileElementType::Surface
-            && (tileElement->AsSurface()->GetSlope()) == TILE_ELEMENT_SLOPE_FLAT && tileElement->GetBaseZ() == pos.baseZ)
-        {
-            canBuildCrossing = true;
-        }
-
-        if (quarterTile.GetZQuarterOccupied() != 0b1111)
+    }
+    else
+    {
+        do
         {
-            if (tileElement->GetBaseZ() >= pos.clearanceZ)
+            if (!MapCanConstructWithClearAtElement(
+                    tileElement, pos, clearFunc, quarterTile, flags, crossingMode, isTree, groundFlags, canBuildCrossing, res))
             {
-                // loc_68BA81
-                groundFlags |= ELEMENT_IS_UNDERGROUND;
-                groundFlags &= ~ELEMENT_IS_ABOVE_GROUND;
-            }
-            else
-            {
-                auto northZ = tileElement->GetBaseZ();
-                auto eastZ = northZ;
-                auto southZ = northZ;
-                auto westZ = northZ;
-                const auto slope = tileElement->AsSurface()->GetSlope();
-                if (slope & TILE_ELEMENT_SLOPE_N_CORNER_UP)
-                {
-                    northZ += LAND_HEIGHT_STEP;
-                    if (slope == (TILE_ELEMENT_SLOPE_S_CORNER_DN | TILE_ELEMENT_SLOPE_DOUBLE_HEIGHT))
-                        northZ += LAND_HEIGHT_STEP;
-                }
-                if (slope & TILE_ELEMENT_SLOPE_E_CORNER_UP)
-                {
-                    eastZ += LAND_HEIGHT_STEP;
-                    if (slope == (TILE_ELEMENT_SLOPE_W_CORNER_DN | TILE_ELEMENT_SLOPE_DOUBLE_HEIGHT))
-                        eastZ += LAND_HEIGHT_STEP;
-                }
-                if (slope & TILE_ELEMENT_SLOPE_S_CORNER_UP)
-                {
-                    southZ += LAND_HEIGHT_STEP;
-                    if (slope == (TILE_ELEMENT_SLOPE_N_CORNER_DN | TILE_ELEMENT_SLOPE_DOUBLE_HEIGHT))
-                        southZ += LAND_HEIGHT_STEP;
-                }
-                if (slope & TILE_ELEMENT_SLOPE_W_CORNER_UP)
-                {
-                    westZ += LAND_HEIGHT_STEP;
-                    if (slope == (TILE_ELEMENT_SLOPE_E_CORNER_DN | TILE_ELEMENT_SLOPE_DOUBLE_HEIGHT))
-                        westZ += LAND_HEIGHT_STEP;
-                }
-                const auto baseHeight = pos.baseZ + (4 * COORDS_Z_STEP);
-                const auto baseQuarter = quarterTile.GetBaseQuarterOccupied();
-                const auto zQuarter = quarterTile.GetZQuarterOccupied();
-                if ((!(baseQuarter & 0b0001) || ((zQuarter & 0b0001 || pos.baseZ >= northZ) && baseHeight >= northZ))
-                    && (!(baseQuarter & 0b0010) || ((zQuarter & 0b0010 || pos.baseZ >= eastZ) && baseHeight >= eastZ))
-                    && (!(baseQuarter & 0b0100) || ((zQuarter & 0b0100 || pos.baseZ >= southZ) && baseHeight >= southZ))
-                    && (!(baseQuarter & 0b1000) || ((zQuarter & 0b1000 || pos.baseZ >= westZ) && baseHeight >= westZ)))
-                {
-                    continue;
-                }
-
-                if (MapLoc68BABCShouldContinue(&tileElement, pos, clearFunc, flags, res.Cost, crossingMode, canBuildCrossing))
-                {
-                    continue;
-                }
-
-                map_obstruction_set_error_text(tileElement, res);
-                res.Error = GameActions::Status::NoClearance;
                 return res;
             }
-        }
-    } while (!(tileElement++)->IsLastForTile());
+        } while (!(tileElement++)->IsLastForTile());
+    }
 
     res.SetData(ConstructClearResult{ groundFlags });
 
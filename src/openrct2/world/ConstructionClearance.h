@@ -16,6 +16,7 @@
 #include <cstdint>
 
 struct TileElement;
+struct TileElementBase;
 struct CoordsXY;
 struct CoordsXYRangedZ;
 class QuarterTile;
@@ -36,4 +37,13 @@ struct ConstructClearResult
 
 [[nodiscard]] GameActions::Result MapCanConstructAt(const CoordsXYRangedZ& pos, QuarterTile bl);
 
+/**
+ * Marks the cached per-tile height intervals used by the clearance checks as out of date. Must be called whenever tile
+ * elements are inserted, removed or have their height, quadrants, type or ghost flag changed. The overloads only drop
+ * the tile at the location or the tile the element belongs to.
+ */
+void MapInvalidateClearanceIndex();
+void MapInvalidateClearanceIndex(const CoordsXY& loc);
+void MapInvalidateClearanceIndex(const TileElementBase& element);
+
 void map_obstruction_set_error_text(TileElement* tileElement, GameActions::Result& res);
@@ -46,6 +46,7 @@
 #include "../world/TilePointerIndex.hpp"
 #include "Banner.h"
 #include "Climate.h"
+#include "ConstructionClearance.h"
 #include "Footpath.h"
 #include "LargeScenery.h"
 #include "MapAnimation.h"
@@ -128,6 +129,7 @@ void StashMap()
     _mapSizeStash = gMapSize;
     _currentRotationStash = gCurrentRotation;
     _tileElementsInUseStash = _tileElementsInUse;
+    MapInvalidateClearanceIndex();
 }
 
 void UnstashMap()
@@ -137,6 +139,7 @@ void UnstashMap()
     gMapSize = _mapSizeStash;
     gCurrentRotation = _currentRotationStash;
     _tileElementsInUse = _tileElementsInUseStash;
+    MapInvalidateClearanceIndex();
 }
 
 const std::vector<TileElement>& GetTileElements()
@@ -149,6 +152,7 @@ void SetTileElements(std::vector<TileElement>&& tileElements)
     _tileElements = std::move(tileElements);
     _tileIndex = TilePointerIndex<TileElement>(MAXIMUM_MAP_SIZE_TECHNICAL, _tileElements.data(), _tileElements.size());
     _tileElementsInUse = _tileElements.size();
+    MapInvalidateClearanceIndex();
 }
 
 static TileElement GetDefaultSurfaceElement()
@@ -384,6 +388,7 @@ void map_set_tile_element(const TileCoordsXY& tilePos, TileElement* elements)
         return;
     }
     _tileIndex.SetTile(tilePos, elements);
+    MapInvalidateClearanceIndex(tilePos.ToCoordsXY());
 }
 
 SurfaceElement* map_get_surface_element_at(const CoordsXY& coords)
@@ -1084,6 +1089,8 @@ bool map_is_location_at_edge(const CoordsXY& loc)
  */
 void tile_element_remove(TileElement* tileElement)
 {
+    MapInvalidateClearanceIndex(*tileElement);
+
     // Replace Nth element by (N+1)th element.
     // This loop will make tileElement point to the old last element position,
     // after copy it to it's new position
@@ -1250,6 +1257,7 @@ TileElement* tile_element_insert(const CoordsXYZ& loc, int32_t occupiedQuadrants
 
     // Set tile index pointer to point to new element block
     _tileIndex.SetTile(tileLoc, newTileElement);
+    MapInvalidateClearanceIndex(loc);
 
     bool isLastForTile = false;
     if (originalTileElement == nullptr)
@@ -26,35 +26,51 @@
 #include "Scenery.h"
 #include "SmallScenery.h"
 
+#include <algorithm>
+#include <array>
+#include <unordered_set>
+
 using map_animation_invalidate_event_handler = bool (*)(const CoordsXYZ& loc);
 
-static std::vector<MapAnimation> _mapAnimations;
+// Animations are kept in one bucket per type so each type can be scheduled by its own frame period.
+static std::array<std::vector<MapAnimation>, MAP_ANIMATION_TYPE_COUNT> _mapAnimations;
+static std::unordered_set<uint64_t> _mapAnimationKeys;
+static size_t _numMapAnimations;
 
 constexpr size_t MAX_ANIMATED_OBJECTS = 2000;
 
+// Animations that are not checked every tick are checked for removal once per this many ticks.
+constexpr uint32_t MAP_ANIMATION_VALIDATE_INTERVAL = 32;
+
+// Highest point above its base any animation invalidates, used to cull animations against the viewports.
+constexpr int32_t MAP_ANIMATION_MAX_HEIGHT = 256;
+
 static bool InvalidateMapAnimation(const MapAnimation& obj);
 
+static uint64_t GetMapAnimationKey(int32_t type, const CoordsXYZ& location)
+{
+    return (static_cast<uint64_t>(type) << 48) | (static_cast<uint64_t>(static_cast<uint16_t>(location.x)) << 32)
+        | (static_cast<uint64_t>(static_cast<uint16_t>(location.y)) << 16) | static_cast<uint16_t>(location.z);
+}
+
 static bool DoesAnimationExist(int32_t type, const CoordsXYZ& location)
 {
-    for (const auto& a : _mapAnimations)
-    {
-        if (a.type == type && a.location == location)
-        {
-            // Animation already exists
-            return true;
-        }
-    }
-    return false;
+    return _mapAnimationKeys.find(GetMapAnimationKey(type, location)) != _mapAnimationKeys.end();
 }
 
 void map_animation_create(int32_t type, const CoordsXYZ& loc)
 {
+    if (type < 0 || type >= MAP_ANIMATION_TYPE_COUNT)
+        return;
+
     if (!DoesAnimationExist(type, loc))
     {
-        if (_mapAnimations.size() < MAX_ANIMATED_OBJECTS)
+        if (_numMapAnimations < MAX_ANIMATED_OBJECTS)
         {
             // Create new animation
-            _mapAnimations.push_back({ static_cast<uint8_t>(type), loc });
+            _mapAnimations[type].push_back({ static_cast<uint8_t>(type), loc });
+            _mapAnimationKeys.insert(GetMapAnimationKey(type, loc));
+            _numMapAnimations++;
         }
         else
         {
@@ -64,23 +80,142 @@ void map_animation_create(int32_t type, const CoordsXYZ& loc)
 }
 
 /**
- *
- *  rct2: 0x0068AFAD
+ * Number of ticks between two frames of an animation type, the tiles only need to be invalidated when the frame changes.
  */
-void map_animation_invalidate_all()
+static constexpr const uint8_t _animatedObjectFramePeriods[MAP_ANIMATION_TYPE_COUNT] = {
+    2, // MAP_ANIMATION_TYPE_RIDE_ENTRANCE
+    2, // MAP_ANIMATION_TYPE_QUEUE_BANNER
+    1, // MAP_ANIMATION_TYPE_SMALL_SCENERY
+    2, // MAP_ANIMATION_TYPE_PARK_ENTRANCE
+    2, // MAP_ANIMATION_TYPE_TRACK_WATERFALL
+    2, // MAP_ANIMATION_TYPE_TRACK_RAPIDS
+    1, // MAP_ANIMATION_TYPE_TRACK_ONRIDEPHOTO
+    4, // MAP_ANIMATION_TYPE_TRACK_WHIRLPOOL
+    4, // MAP_ANIMATION_TYPE_TRACK_SPINNINGTUNNEL
+    1, // MAP_ANIMATION_TYPE_REMOVE
+    2, // MAP_ANIMATION_TYPE_BANNER
+    2, // MAP_ANIMATION_TYPE_LARGE_SCENERY
+    2, // MAP_ANIMATION_TYPE_WALL_DOOR
+    1, // MAP_ANIMATION_TYPE_WALL
+};
+
+/**
+ * Some animations also change the game state. On the ticks where they do, every animation of the type has to be updated
+ * no matter whether it is visible, so that all clients stay in sync.
+ */
+static bool DoesMapAnimationUpdateState(int32_t type)
+{
+    switch (type)
+    {
+        case MAP_ANIMATION_TYPE_SMALL_SCENERY:
+            // Guests walking past a clock check the time
+            return (gCurrentTicks & 0x3FF) == 0;
+        case MAP_ANIMATION_TYPE_TRACK_ONRIDEPHOTO:
+        case MAP_ANIMATION_TYPE_REMOVE:
+            return true;
+        case MAP_ANIMATION_TYPE_WALL_DOOR:
+            return (gCurrentTicks & 1) == 0;
+        default:
+            return false;
+    }
+}
+
+/**
+ * The tick counter is incremented before the next frame is drawn, so an animation changes frame when the next tick is a
+ * multiple of its period.
+ */
+static bool IsMapAnimationFrameDue(int32_t type)
+{
+    return ((gCurrentTicks + 1) % _animatedObjectFramePeriods[type]) == 0;
+}
+
+static bool IsMapAnimationVisible(const CoordsXYZ& loc, const std::vector<ScreenRect>& visibleAreas)
 {
-    auto it = _mapAnimations.begin();
-    while (it != _mapAnimations.end())
+    auto screenCoords = translate_3d_to_2d_with_z(get_current_rotation(), { loc.x + 16, loc.y + 16, 0 });
+    auto left = screenCoords.x - 32;
+    auto right = screenCoords.x + 32;
+    auto top = screenCoords.y - 32 - (loc.z + MAP_ANIMATION_MAX_HEIGHT);
+    auto bottom = screenCoords.y + 32 - loc.z;
+    for (const auto& area : visibleAreas)
     {
-        if (InvalidateMapAnimation(*it))
+        if (right > area.GetLeft() && left < area.GetRight() && bottom > area.GetTop() && top < area.GetBottom())
         {
-            // Map animation has finished, remove it
-            it = _mapAnimations.erase(it);
+            return true;
         }
-        else
+    }
+    return false;
+}
+
+static void RemoveMapAnimationKeys(std::vector<MapAnimation>& animations, size_t first)
+{
+    for (size_t i = first; i < animations.size(); i++)
+    {
+        _mapAnimationKeys.erase(GetMapAnimationKey(animations[i].type, animations[i].location));
+    }
+    _numMapAnimations -= animations.size() - first;
+    animations.erase(animations.begin() + first, animations.end());
+}
+
+static void UpdateMapAnimationsOfType(int32_t type, const std::vector<ScreenRect>& visibleAreas)
+{
+    auto& animations = _mapAnimations[type];
+    if (animations.empty())
+        return;
+
+    // Removed animations are moved to the end of the bucket, keeping the order of the others.
+    if (DoesMapAnimationUpdateState(type))
+    {
+        auto it = std::stable_partition(
+            animations.begin(), animations.end(), [](const MapAnimation& a) { return !InvalidateMapAnimation(a); });
+        RemoveMapAnimationKeys(animations, it - animations.begin());
+        return;
+    }
+
+    // Only check for removed animations in a fixed slice per tick, as culling depends on the local viewports and the
+    // animation list has to stay the same for all clients.
+    const auto validateSlot = gCurrentTicks % MAP_ANIMATION_VALIDATE_INTERVAL;
+    const bool invalidate = !visibleAreas.empty() && IsMapAnimationFrameDue(type);
+    size_t numKept = 0;
+    for (size_t i = 0; i < animations.size(); i++)
+    {
+        const auto& animation = animations[i];
+        if ((i % MAP_ANIMATION_VALIDATE_INTERVAL) == validateSlot)
         {
-            it++;
+            if (InvalidateMapAnimation(animation))
+            {
+                _mapAnimationKeys.erase(GetMapAnimationKey(animation.type, animation.location));
+                _numMapAnimations--;
+                continue;
+            }
+        }
+        else if (invalidate && IsMapAnimationVisible(animation.location, visibleAreas))
+        {
+            InvalidateMapAnimation(animation);
         }
+
+        if (numKept != i)
+        {
+            animations[numKept] = animation;
+        }
+        numKept++;
+    }
+    animations.resize(numKept);
+}
+
+/**
+ *
+ *  rct2: 0x0068AFAD
+ */
+void map_animation_invalidate_all()
+{
+    // Nothing animates while the game is paused, as the tick counter does not advance.
+    if (game_is_paused())
+        return;
+
+    const auto visibleAreas = viewports_get_visible_areas(ZoomLevel{ 1 });
+    for (int32_t type = 0; type < MAP_ANIMATION_TYPE_COUNT; type++)
+    {
+        UpdateMapAnimationsOfType(type, visibleAreas);
     }
 }
 
@@ -599,12 +734,24 @@ static bool InvalidateMapAnimation(const MapAnimation& a)
 
 const std::vector<MapAnimation>& GetMapAnimations()
 {
-    return _mapAnimations;
+    static std::vector<MapAnimation> allAnimations;
+    allAnimations.clear();
+    allAnimations.reserve(_numMapAnimations);
+    for (const auto& animations : _mapAnimations)
+    {
+        allAnimations.insert(allAnimations.end(), animations.begin(), animations.end());
+    }
+    return allAnimations;
 }
 
 static void ClearMapAnimations()
 {
-    _mapAnimations.clear();
+    for (auto& animations : _mapAnimations)
+    {
+        animations.clear();
+    }
+    _mapAnimationKeys.clear();
+    _numMapAnimations = 0;
 }
 
 void AutoCreateMapAnimations()
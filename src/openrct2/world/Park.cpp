@@ -30,6 +30,7 @@
 #include "../management/Marketing.h"
 #include "../management/Research.h"
 #include "../network/network.h"
+#include "../peep/PeepStats.h"
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
 #include "../ride/ShopItem.h"
@@ -49,6 +50,9 @@ uint64_t gParkFlags;
 uint16_t gParkRating;
 money16 gParkEntranceFee;
 uint16_t gParkSize;
+uint32_t gParkSizeScanPosition;
+uint32_t gParkSizeScanOwnedTiles;
+bool gParkSizeScanOwnershipChanged;
 money16 gLandPrice;
 money16 gConstructionRightsPrice;
 
@@ -65,6 +69,10 @@ uint32_t gGuestsInParkHistory[32];
 // If this value is more than or equal to 0, the park rating is forced to this value. Used for cheat
 static int32_t _forcedParkRating = -1;
 
+// Ticks between updates of the park size, every ~102 seconds.
+constexpr uint32_t ParkSizeUpdateInterval = 4096;
+constexpr uint32_t ParkSizeScanTileCount = MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL;
+
 /**
  * In a difficult guest generation scenario, no guests will be generated if over this value.
  */
@@ -265,6 +273,9 @@ void Park::Initialise()
     gNumGuestsHeadingForPark = 0;
     gGuestChangeModifier = 0;
     gParkRating = 0;
+    gParkSizeScanPosition = 0;
+    gParkSizeScanOwnedTiles = 0;
+    gParkSizeScanOwnershipChanged = false;
     _guestGenerationProbability = 0;
     gTotalRideValueForMoney = 0;
     gResearchLastItem = std::nullopt;
@@ -322,9 +333,20 @@ void Park::Update(const Date& date)
         context_broadcast_intent(&intent);
     }
     // Every ~102 seconds
-    if (gCurrentTicks % 4096 == 0)
+    if (UpdateParkSizeScan())
     {
-        gParkSize = CalculateParkSize();
+        // Land bought or sold during the scan may have been counted in some slices and not in others.
+        if (gParkSizeScanOwnershipChanged)
+        {
+            CalculateParkSize();
+        }
+        else
+        {
+            gParkSize = static_cast<uint16_t>(gParkSizeScanOwnedTiles);
+        }
+        gParkSizeScanPosition = 0;
+        gParkSizeScanOwnedTiles = 0;
+        gParkSizeScanOwnershipChanged = false;
         window_invalidate_by_class(WC_PARK_INFORMATION);
     }
     // Every new week
@@ -335,21 +357,56 @@ void Park::Update(const Date& date)
     GenerateGuests();
 }
 
-int32_t Park::CalculateParkSize() const
+static uint32_t CountOwnedTiles(const TileCoordsXY& tile)
 {
-    int32_t tiles = 0;
-    tile_element_iterator it;
-    tile_element_iterator_begin(&it);
+    uint32_t tiles = 0;
+    TileElement* tileElement = map_get_first_element_at(tile);
+    if (tileElement == nullptr)
+        return tiles;
+
     do
     {
-        if (it.element->GetType() == TileElementType::Surface)
+        if (tileElement->GetType() == TileElementType::Surface)
         {
-            if (it.element->AsSurface()->GetOwnership() & (OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED | OWNERSHIP_OWNED))
+            if (tileElement->AsSurface()->GetOwnership() & (OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED | OWNERSHIP_OWNED))
             {
                 tiles++;
             }
         }
-    } while (tile_element_iterator_next(&it));
+    } while (!(tileElement++)->IsLastForTile());
+    return tiles;
+}
+
+/**
+ * Counts the owned land of the next slice of the map. The map is split into one slice per tick of the park size update
+ * interval, the last slice is counted on the tick the park size is updated, which is when this returns true. If any
+ * land changed hands during the scan, the whole map is counted again on that tick instead.
+ */
+bool Park::UpdateParkSizeScan()
+{
+    // gCurrentTicks wraps around on a multiple of the interval, so the slices stay in step with it.
+    const auto slice = (gCurrentTicks - 1) % ParkSizeUpdateInterval;
+    const auto sliceEnd = static_cast<uint32_t>(
+        ((static_cast<uint64_t>(slice) + 1) * ParkSizeScanTileCount) / ParkSizeUpdateInterval);
+    for (; gParkSizeScanPosition < sliceEnd; gParkSizeScanPosition++)
+    {
+        const auto x = static_cast<int32_t>(gParkSizeScanPosition % MAXIMUM_MAP_SIZE_TECHNICAL);
+        const auto y = static_cast<int32_t>(gParkSizeScanPosition / MAXIMUM_MAP_SIZE_TECHNICAL);
+        gParkSizeScanOwnedTiles += CountOwnedTiles({ x, y });
+    }
+    return slice == ParkSizeUpdateInterval - 1;
+}
+
+int32_t Park::CalculateParkSize() const
+{
+    int32_t tiles = 0;
+    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+    {
+        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+        {
+            tiles += CountOwnedTiles({ x, y });
+        }
+    }
 
     if (tiles != gParkSize)
     {
@@ -379,22 +436,9 @@ int32_t Park::CalculateParkRating() const
         result -= 150 - (std::min<int16_t>(2000, gNumGuestsInPark) / 13);
 
         // Find the number of happy peeps and the number of peeps who can't find the park exit
-        uint32_t happyGuestCount = 0;
-        uint32_t lostGuestCount = 0;
-        for (auto peep : EntityList<Guest>())
-        {
-            if (!peep->OutsideOfPark)
-            {
-                if (peep->Happiness > 128)
-                {
-                    happyGuestCount++;
-                }
-                if ((peep->PeepFlags & PEEP_FLAGS_LEAVING_PARK) && (peep->GuestIsLostCountdown < 90))
-                {
-                    lostGuestCount++;
-                }
-            }
-        }
+        PeepStats::Verify();
+        uint32_t happyGuestCount = PeepStats::GetHappyGuests();
+        uint32_t lostGuestCount = PeepStats::GetLostGuests();
 
         // Peep happiness -500 to +0
         result -= 500;
@@ -464,9 +508,7 @@ int32_t Park::CalculateParkRating() const
     // Litter
     {
         // Counts the amount of litter whose age is min. 7680 ticks (5~ min) old.
-        const auto litterList = EntityList<Litter>();
-        const auto litterCount = std::count_if(
-            litterList.begin(), litterList.end(), [](auto* litter) { return litter->GetAge() >= 7680; });
+        const auto litterCount = static_cast<int32_t>(Litter::CountOfMinimumAge(7680));
 
         result -= 600 - (4 * (150 - std::min<int32_t>(150, litterCount)));
     }
@@ -80,6 +80,7 @@ namespace OpenRCT2
         money16 CalculateTotalRideValueForMoney() const;
         uint32_t CalculateSuggestedMaxGuests() const;
         uint32_t CalculateGuestGenerationProbability() const;
+        bool UpdateParkSizeScan();
 
         void GenerateGuests();
         Guest* GenerateGuestFromCampaign(int32_t campaign);
@@ -90,6 +91,9 @@ extern uint64_t gParkFlags;
 extern uint16_t gParkRating;
 extern money16 gParkEntranceFee;
 extern uint16_t gParkSize;
+extern uint32_t gParkSizeScanPosition;
+extern uint32_t gParkSizeScanOwnedTiles;
+extern bool gParkSizeScanOwnershipChanged;
 extern money16 gLandPrice;
 extern money16 gConstructionRightsPrice;
 
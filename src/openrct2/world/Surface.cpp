@@ -16,6 +16,7 @@
 #include "../scenario/Scenario.h"
 #include "Location.hpp"
 #include "Map.h"
+#include "Park.h"
 
 uint32_t SurfaceElement::GetSurfaceStyle() const
 {
@@ -197,6 +198,13 @@ uint8_t SurfaceElement::GetOwnership() const
 
 void SurfaceElement::SetOwnership(uint8_t newOwnership)
 {
+    // The park size is counted a slice of the map at a time, it has to be counted again once land changes hands.
+    constexpr uint8_t ownedMask = OWNERSHIP_OWNED | OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED;
+    if (((Ownership & ownedMask) != 0) != ((newOwnership & ownedMask) != 0))
+    {
+        gParkSizeScanOwnershipChanged = true;
+    }
+
     Ownership &= ~TILE_ELEMENT_SURFACE_OWNERSHIP_MASK;
     Ownership |= (newOwnership & TILE_ELEMENT_SURFACE_OWNERSHIP_MASK);
 }
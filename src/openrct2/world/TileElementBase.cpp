@@ -7,6 +7,7 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 
+#include "ConstructionClearance.h"
 #include "Map.h"
 #include "TileElement.h"
 
@@ -17,6 +18,7 @@ TileElementType TileElementBase::GetType() const
 
 void TileElementBase::SetType(TileElementType newType)
 {
+    MapInvalidateClearanceIndex(*this);
     this->type &= ~TILE_ELEMENT_TYPE_MASK;
     this->type |= ((EnumValue(newType) << 2) & TILE_ELEMENT_TYPE_MASK);
 }
@@ -44,6 +46,7 @@ bool TileElementBase::IsLastForTile() const
 
 void TileElementBase::SetLastForTile(bool on)
 {
+    MapInvalidateClearanceIndex(*this);
     if (on)
         Flags |= TILE_ELEMENT_FLAG_LAST_TILE;
     else
@@ -70,6 +73,7 @@ bool TileElementBase::IsGhost() const
 
 void TileElementBase::SetGhost(bool isGhost)
 {
+    MapInvalidateClearanceIndex(*this);
     if (isGhost)
     {
         this->Flags |= TILE_ELEMENT_FLAG_GHOST;
@@ -92,6 +96,7 @@ uint8_t TileElementBase::GetOccupiedQuadrants() const
 
 void TileElementBase::SetOccupiedQuadrants(uint8_t quadrants)
 {
+    MapInvalidateClearanceIndex(*this);
     Flags &= ~TILE_ELEMENT_OCCUPIED_QUADRANTS_MASK;
     Flags |= (quadrants & TILE_ELEMENT_OCCUPIED_QUADRANTS_MASK);
 }
@@ -103,6 +108,7 @@ int32_t TileElementBase::GetBaseZ() const
 
 void TileElementBase::SetBaseZ(int32_t newZ)
 {
+    MapInvalidateClearanceIndex(*this);
     base_height = (newZ / COORDS_Z_STEP);
 }
 
@@ -113,6 +119,7 @@ int32_t TileElementBase::GetClearanceZ() const
 
 void TileElementBase::SetClearanceZ(int32_t newZ)
 {
+    MapInvalidateClearanceIndex(*this);
     clearance_height = (newZ / COORDS_Z_STEP);
 }
 
@@ -23,6 +23,7 @@
 #include "../windows/Intent.h"
 #include "../windows/tile_inspector.h"
 #include "Banner.h"
+#include "ConstructionClearance.h"
 #include "Footpath.h"
 #include "LargeScenery.h"
 #include "Map.h"
@@ -63,6 +64,7 @@ namespace OpenRCT2::TileInspector
 
         // Swap their memory
         std::swap(*firstElement, *secondElement);
+        MapInvalidateClearanceIndex(loc);
 
         // Swap the 'last map element for tile' flag if either one of them was last
         if ((firstElement)->IsLastForTile() || (secondElement)->IsLastForTile())
@@ -493,8 +495,8 @@ namespace OpenRCT2::TileInspector
                 }
             }
 
-            tileElement->base_height += heightOffset;
-            tileElement->clearance_height += heightOffset;
+            tileElement->SetBaseZ(tileElement->GetBaseZ() + heightOffset * COORDS_Z_STEP);
+            tileElement->SetClearanceZ(tileElement->GetClearanceZ() + heightOffset * COORDS_Z_STEP);
 
             map_invalidate_tile_full(loc);
 
@@ -569,8 +571,8 @@ namespace OpenRCT2::TileInspector
                     }
                 }
 
-                surfaceElement->base_height += 2;
-                surfaceElement->clearance_height = surfaceElement->base_height;
+                surfaceElement->SetBaseZ(surfaceElement->GetBaseZ() + 2 * COORDS_Z_STEP);
+                surfaceElement->SetClearanceZ(surfaceElement->GetBaseZ());
             }
 
             surfaceElement->SetSlope(newSlope);
@@ -825,8 +827,8 @@ namespace OpenRCT2::TileInspector
                 // Keep?
                 // invalidate_test_results(ride);
 
-                tileElement->base_height += offset;
-                tileElement->clearance_height += offset;
+                tileElement->SetBaseZ(tileElement->GetBaseZ() + offset * COORDS_Z_STEP);
+                tileElement->SetClearanceZ(tileElement->GetClearanceZ() + offset * COORDS_Z_STEP);
             }
 
             if (auto* inspector = GetTileInspectorWithPos(loc); inspector != nullptr)
@@ -15,6 +15,7 @@
 #include <openrct2/config/Config.h>
 #include <openrct2/core/String.hpp>
 #include <openrct2/localisation/Localisation.h>
+#include <openrct2/localisation/LocalisationService.h>
 #include <openrct2/localisation/StringIds.h>
 #include <sstream>
 #include <string>
@@ -339,6 +340,25 @@ TEST_F(FormattingTests, using_legacy_buffer_args)
     ASSERT_STREQ("Queuing for Boat Hire 2", buffer);
 }
 
+TEST_F(FormattingTests, using_legacy_buffer_args_after_string_changes)
+{
+    auto& localisationService = GetContext()->GetLocalisationService();
+    auto ft = Formatter();
+    ft.Add<int16_t>(1234);
+
+    char buffer[32]{};
+    auto stringId = localisationService.AllocateObjectString("{COMMA16} guests");
+    FormatStringLegacy(buffer, sizeof(buffer), stringId, ft.Data());
+    ASSERT_STREQ("1,234 guests", buffer);
+    localisationService.FreeObjectString(stringId);
+
+    // Reuses the string id, which must not format with the string it had before.
+    auto otherStringId = localisationService.AllocateObjectString("Guests: {COMMA16}");
+    FormatStringLegacy(buffer, sizeof(buffer), otherStringId, ft.Data());
+    ASSERT_STREQ("Guests: 1,234", buffer);
+    localisationService.FreeObjectString(otherStringId);
+}
+
 TEST_F(FormattingTests, format_number_basic)
 {
     FormatBuffer ss;
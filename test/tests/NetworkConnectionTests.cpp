@@ -0,0 +1,191 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/network/NetworkConnection.h>
+#include <openrct2/network/NetworkPacket.h>
+#include <openrct2/network/Socket.h>
+#include <vector>
+
+// Both ends of a connection, what one end sends is read by the other. Sending only accepts as many bytes as allowed.
+class LoopbackSocket final : public ITcpSocket
+{
+public:
+    std::shared_ptr<std::vector<uint8_t>> Buffer = std::make_shared<std::vector<uint8_t>>();
+    size_t SendLimit = SIZE_MAX;
+
+    SocketStatus GetStatus() const override
+    {
+        return SocketStatus::Connected;
+    }
+    const char* GetError() const override
+    {
+        return nullptr;
+    }
+    const char* GetHostName() const override
+    {
+        return "loopback";
+    }
+    std::string GetIpAddress() const override
+    {
+        return {};
+    }
+
+    void Listen(uint16_t) override
+    {
+    }
+    void Listen(const std::string&, uint16_t) override
+    {
+    }
+    std::unique_ptr<ITcpSocket> Accept() override
+    {
+        return nullptr;
+    }
+
+    void Connect(const std::string&, uint16_t) override
+    {
+    }
+    void ConnectAsync(const std::string&, uint16_t) override
+    {
+    }
+
+    size_t SendData(const void* buffer, size_t size) override
+    {
+        SocketBuffer socketBuffer{ buffer, size };
+        return SendData(&socketBuffer, 1);
+    }
+
+    size_t SendData(const SocketBuffer* buffers, size_t count) override
+    {
+        size_t sent = 0;
+        for (size_t i = 0; i < count && SendLimit > 0; i++)
+        {
+            auto length = std::min(buffers[i].Size, SendLimit);
+            const auto* data = static_cast<const uint8_t*>(buffers[i].Data);
+            Buffer->insert(Buffer->end(), data, data + length);
+            SendLimit -= length;
+            sent += length;
+        }
+        return sent;
+    }
+
+    NetworkReadPacket ReceiveData(void* buffer, size_t size, size_t* sizeReceived) override
+    {
+        if (Buffer->empty())
+        {
+            *sizeReceived = 0;
+            return NetworkReadPacket::NoData;
+        }
+        auto length = std::min(size, Buffer->size());
+        std::memcpy(buffer, Buffer->data(), length);
+        Buffer->erase(Buffer->begin(), Buffer->begin() + length);
+        *sizeReceived = length;
+        return NetworkReadPacket::Success;
+    }
+
+    void SetNoDelay(bool) override
+    {
+    }
+
+    void Finish() override
+    {
+    }
+    void Disconnect() override
+    {
+    }
+    void Close() override
+    {
+    }
+};
+
+class NetworkConnectionTests : public testing::Test
+{
+protected:
+    NetworkConnection _sender;
+    NetworkConnection _receiver;
+    LoopbackSocket* _socket = nullptr;
+
+    void SetUp() override
+    {
+        auto sendSocket = std::make_unique<LoopbackSocket>();
+        auto receiveSocket = std::make_unique<LoopbackSocket>();
+        receiveSocket->Buffer = sendSocket->Buffer;
+        _socket = sendSocket.get();
+
+        _sender.Socket = std::move(sendSocket);
+        _sender.AuthStatus = NetworkAuth::Ok;
+        _sender.BeginCompression();
+        _receiver.Socket = std::move(receiveSocket);
+    }
+
+    std::vector<NetworkCommand> ReceiveAll()
+    {
+        std::vector<NetworkCommand> commands;
+        while (true)
+        {
+            auto status = _receiver.ReadPacket();
+            if (status == NetworkReadPacket::Success)
+            {
+                commands.push_back(_receiver.InboundPacket.GetCommand());
+                _receiver.InboundPacket.Clear();
+            }
+            else if (status != NetworkReadPacket::MoreData)
+            {
+                EXPECT_EQ(status, NetworkReadPacket::NoData);
+                return commands;
+            }
+        }
+    }
+};
+
+TEST_F(NetworkConnectionTests, front_packet_after_unsent_batch)
+{
+    // The first batch is compressed but can not be sent yet.
+    _socket->SendLimit = 0;
+    _sender.QueuePacket(NetworkPacket(NetworkCommand::Chat));
+    _sender.SendQueuedPackets();
+
+    // A ping wants to go first, but has to follow the batch compressed before it.
+    _sender.QueuePacket(NetworkPacket(NetworkCommand::Ping), true);
+    _sender.SendQueuedPackets();
+
+    _socket->SendLimit = SIZE_MAX;
+    _sender.SendQueuedPackets();
+    ASSERT_FALSE(_sender.HasQueuedPackets());
+
+    auto commands = ReceiveAll();
+    ASSERT_EQ(commands.size(), 2U);
+    ASSERT_EQ(commands[0], NetworkCommand::Chat);
+    ASSERT_EQ(commands[1], NetworkCommand::Ping);
+}
+
+TEST_F(NetworkConnectionTests, front_packet_before_unbatched_packets)
+{
+    // Partially sent, so the ping can only go after it.
+    _socket->SendLimit = 1;
+    _sender.QueuePacket(NetworkPacket(NetworkCommand::Chat));
+    _sender.SendQueuedPackets();
+
+    _socket->SendLimit = 0;
+    _sender.QueuePacket(NetworkPacket(NetworkCommand::Chat));
+    _sender.QueuePacket(NetworkPacket(NetworkCommand::Ping), true);
+
+    _socket->SendLimit = SIZE_MAX;
+    _sender.SendQueuedPackets();
+    ASSERT_FALSE(_sender.HasQueuedPackets());
+
+    auto commands = ReceiveAll();
+    ASSERT_EQ(commands.size(), 3U);
+    ASSERT_EQ(commands[0], NetworkCommand::Chat);
+    ASSERT_EQ(commands[1], NetworkCommand::Ping);
+    ASSERT_EQ(commands[2], NetworkCommand::Chat);
+}
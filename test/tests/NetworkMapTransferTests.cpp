@@ -0,0 +1,98 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <openrct2/network/NetworkMapTransfer.h>
+#include <openrct2/network/NetworkPacket.h>
+#include <openrct2/network/NetworkTypes.h>
+#include <vector>
+
+// Packets are read up to the size in their header, which is only set for packets received.
+static NetworkPacket& Receive(NetworkPacket& packet)
+{
+    packet.Header.Size = static_cast<uint16_t>(packet.Data.size());
+    return packet;
+}
+
+// Large enough for several blocks, a reload changes only the middle one.
+static std::vector<uint8_t> CreateMap(uint8_t seed)
+{
+    std::vector<uint8_t> data(3 * 256 * 1024);
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        data[i] = static_cast<uint8_t>((i * 31) ^ (i >> 8));
+    }
+    std::fill_n(data.begin() + data.size() / 2, 1024, seed);
+    return data;
+}
+
+static void SendBlocks(const NetworkMapSnapshot& snapshot, const std::vector<uint32_t>& blocks, NetworkMapDownload& download)
+{
+    for (auto index : blocks)
+    {
+        const auto& data = snapshot.GetCompressedBlock(index);
+        for (size_t offset = 0; offset < data.size(); offset += 1024)
+        {
+            auto size = std::min<size_t>(1024, data.size() - offset);
+            ASSERT_TRUE(download.ReceiveBlockData(index, static_cast<uint32_t>(offset), &data[offset], size));
+        }
+    }
+}
+
+TEST(NetworkMapTransferTests, reload_during_transfer)
+{
+    const auto firstMap = CreateMap(1);
+    const auto reloadedMap = CreateMap(2);
+    auto firstSnapshot = NetworkMapSnapshot::Create(firstMap);
+    ASSERT_NE(firstSnapshot, nullptr);
+
+    NetworkMapDownload download;
+    NetworkPacket firstManifest(NetworkCommand::MapManifest);
+    firstSnapshot->WriteManifest(firstManifest);
+    ASSERT_TRUE(download.Begin(Receive(firstManifest)));
+    NetworkPacket firstRequest(NetworkCommand::MapBlockRequest);
+    download.WriteBlockRequest(firstRequest);
+
+    // The park is reloaded before the server reads the request, which was made for the first manifest.
+    auto reloadedSnapshot = NetworkMapSnapshot::Create(reloadedMap);
+    ASSERT_NE(reloadedSnapshot, nullptr);
+    std::vector<uint32_t> blocks;
+    ASSERT_EQ(reloadedSnapshot->ReadBlockRequest(Receive(firstRequest), blocks), NetworkMapBlockRequest::Outdated);
+
+    // The client answers the new manifest as well, that request is served from the new snapshot.
+    NetworkPacket reloadedManifest(NetworkCommand::MapManifest);
+    reloadedSnapshot->WriteManifest(reloadedManifest);
+    ASSERT_TRUE(download.Begin(Receive(reloadedManifest)));
+    NetworkPacket reloadedRequest(NetworkCommand::MapBlockRequest);
+    download.WriteBlockRequest(reloadedRequest);
+    ASSERT_EQ(reloadedSnapshot->ReadBlockRequest(Receive(reloadedRequest), blocks), NetworkMapBlockRequest::Valid);
+    ASSERT_EQ(blocks.size(), reloadedSnapshot->GetBlockCount());
+
+    SendBlocks(*reloadedSnapshot, blocks, download);
+    ASSERT_TRUE(download.HasReceivedAll());
+    std::vector<uint8_t> data;
+    ASSERT_TRUE(download.Finish(data));
+    ASSERT_EQ(data, reloadedMap);
+}
+
+TEST(NetworkMapTransferTests, request_for_unknown_block_is_invalid)
+{
+    auto snapshot = NetworkMapSnapshot::Create(CreateMap(1));
+    ASSERT_NE(snapshot, nullptr);
+
+    NetworkPacket request(NetworkCommand::MapBlockRequest);
+    request << snapshot->GetId() << static_cast<uint32_t>(1) << snapshot->GetBlockCount();
+    std::vector<uint32_t> blocks;
+    ASSERT_EQ(snapshot->ReadBlockRequest(Receive(request), blocks), NetworkMapBlockRequest::Invalid);
+
+    NetworkPacket futureRequest(NetworkCommand::MapBlockRequest);
+    futureRequest << snapshot->GetId() + 1 << static_cast<uint32_t>(0);
+    ASSERT_EQ(snapshot->ReadBlockRequest(Receive(futureRequest), blocks), NetworkMapBlockRequest::Invalid);
+}
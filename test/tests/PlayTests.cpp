@@ -15,17 +15,23 @@
 #include <openrct2/GameState.h>
 #include <openrct2/OpenRCT2.h>
 #include <openrct2/ParkImporter.h>
+#include <openrct2/actions/BatchAction.h>
 #include <openrct2/actions/ParkSetParameterAction.h>
 #include <openrct2/actions/RideSetPriceAction.h>
+#include <openrct2/actions/TileModifyAction.h>
 #include <openrct2/entity/EntityRegistry.h>
 #include <openrct2/entity/EntityTweener.h>
 #include <openrct2/entity/Peep.h>
 #include <openrct2/object/ObjectManager.h>
 #include <openrct2/platform/platform.h>
 #include <openrct2/ride/Ride.h>
+#include <openrct2/world/ConstructionClearance.h>
+#include <openrct2/world/Map.h>
 #include <openrct2/world/MapAnimation.h>
 #include <openrct2/world/Park.h>
 #include <openrct2/world/Scenery.h>
+#include <openrct2/world/Surface.h>
+#include <openrct2/world/TileElementsView.h>
 #include <string>
 
 using namespace OpenRCT2;
@@ -193,3 +199,142 @@ TEST_F(PlayTests, CarRideWithOneCarOnlyAcceptsTwoGuests)
         gs->UpdateLogic();
     }
 }
+
+static GameAction::Ptr CreateHeightOffsetAction(
+    const CoordsXY& loc, const TileElementBase* element, int8_t offset,
+    TileModifyType type = TileModifyType::AnyBaseHeightOffset)
+{
+    uint32_t index = 0;
+    while (map_get_nth_element_at(loc, index) != element)
+    {
+        index++;
+    }
+    return std::make_unique<TileModifyAction>(loc, type, index, static_cast<uint8_t>(offset));
+}
+
+TEST_F(PlayTests, AtomicBatchStopsAtFirstFailedAction)
+{
+    /* Lowering a surface to the bottom of the map passes its query twice, as both queries see the unchanged map, but the
+     * second one fails once the first has been executed. The batch has to report that failure and must not execute the
+     * action after it, but still succeed for the action it already executed so that it is charged.
+     */
+    std::string initStateFile = TestData::GetParkPath("small_park_with_ferris_wheel.sv6");
+
+    auto context = localStartGame(initStateFile);
+    ASSERT_NE(context.get(), nullptr);
+
+    const auto firstLoc = TileCoordsXY(gMapSize / 2, gMapSize / 2).ToCoordsXY();
+    const auto secondLoc = TileCoordsXY(gMapSize / 2 + 1, gMapSize / 2).ToCoordsXY();
+    auto* firstSurface = map_get_surface_element_at(firstLoc);
+    auto* secondSurface = map_get_surface_element_at(secondLoc);
+    ASSERT_NE(firstSurface, nullptr);
+    ASSERT_NE(secondSurface, nullptr);
+    const auto firstHeight = firstSurface->base_height;
+    const auto secondHeight = secondSurface->base_height;
+    ASSERT_GT(firstHeight, 0);
+    ASSERT_GT(secondHeight, 0);
+
+    std::vector<GameAction::Ptr> actions;
+    actions.push_back(CreateHeightOffsetAction(firstLoc, firstSurface, -firstHeight));
+    actions.push_back(CreateHeightOffsetAction(firstLoc, firstSurface, -firstHeight));
+    actions.push_back(CreateHeightOffsetAction(secondLoc, secondSurface, -1));
+    BatchAction batch(std::move(actions), true);
+
+    ASSERT_EQ(GameActions::Query(&batch).Error, GameActions::Status::Ok);
+    auto res = GameActions::Execute(&batch);
+    ASSERT_EQ(res.Error, GameActions::Status::Ok);
+    ASSERT_EQ(res.Position.x, firstLoc.x);
+    ASSERT_EQ(res.Position.y, firstLoc.y);
+    auto stopped = res.GetData<BatchActionStopped>();
+    ASSERT_EQ(stopped.Error, GameActions::Status::TooLow);
+    ASSERT_EQ(stopped.Index, 1U);
+
+    // Executed actions can not be undone, but nothing after the failed action runs.
+    ASSERT_EQ(firstSurface->base_height, 0);
+    ASSERT_EQ(secondSurface->base_height, secondHeight);
+}
+
+TEST_F(PlayTests, ClearanceCheckSeesTrackMovedByTileInspector)
+{
+    /* The clearance checks keep the heights of a tile's elements once it has been checked. Moving a track block with the
+     * tile inspector must drop those, otherwise the space the track moved into still looks free.
+     */
+    std::string initStateFile = TestData::GetParkPath("small_park_with_ferris_wheel.sv6");
+
+    auto context = localStartGame(initStateFile);
+    ASSERT_NE(context.get(), nullptr);
+
+    CoordsXY loc;
+    TrackElement* track = nullptr;
+    for (int32_t y = 0; y < gMapSize && track == nullptr; y++)
+    {
+        for (int32_t x = 0; x < gMapSize && track == nullptr; x++)
+        {
+            loc = TileCoordsXY(x, y).ToCoordsXY();
+            for (auto* trackElement : TileElementsView<TrackElement>(loc))
+            {
+                track = trackElement;
+                break;
+            }
+        }
+    }
+    ASSERT_NE(track, nullptr);
+
+    // Move the track up far enough to leave the space it occupied.
+    const auto offset = track->clearance_height - track->base_height + 2;
+    ASSERT_LE(offset, INT8_MAX);
+    ASSERT_LE(track->clearance_height + offset, UINT8_MAX);
+    const auto movedRange = CoordsXYRangedZ(
+        loc, track->GetBaseZ() + offset * COORDS_Z_STEP, track->GetClearanceZ() + offset * COORDS_Z_STEP);
+    const auto quarterTile = QuarterTile(0b1111, 0);
+
+    ASSERT_EQ(MapCanConstructAt(movedRange, quarterTile).Error, GameActions::Status::Ok);
+
+    auto action = CreateHeightOffsetAction(loc, track, offset, TileModifyType::TrackBaseHeightOffset);
+    ASSERT_EQ(GameActions::Execute(action.get()).Error, GameActions::Status::Ok);
+
+    ASSERT_NE(MapCanConstructAt(movedRange, quarterTile).Error, GameActions::Status::Ok);
+}
+
+TEST_F(PlayTests, ParkSizeCountsLandBoughtDuringScan)
+{
+    /* The park size is counted a slice of the map per tick. Land bought part way through the count, on a tile that was
+     * already counted, must still be part of the park size published at the end of it.
+     */
+    std::string initStateFile = TestData::GetParkPath("small_park_with_ferris_wheel.sv6");
+
+    auto context = localStartGame(initStateFile);
+    ASSERT_NE(context.get(), nullptr);
+
+    auto gs = context->GetGameState();
+    ASSERT_NE(gs, nullptr);
+
+    // Finish the count in progress, loading the park counts as a change of ownership.
+    bool matched = updateUntil(*gs, 5000, []() { return gParkSizeScanPosition == 0 && !gParkSizeScanOwnershipChanged; });
+    ASSERT_TRUE(matched);
+    const auto parkSize = gParkSize;
+
+    SurfaceElement* surface = nullptr;
+    uint32_t scanIndex = 0;
+    for (int32_t y = 1; y < gMapSize - 1 && surface == nullptr; y++)
+    {
+        for (int32_t x = 1; x < gMapSize - 1 && surface == nullptr; x++)
+        {
+            auto* surfaceElement = map_get_surface_element_at(TileCoordsXY(x, y).ToCoordsXY());
+            if (surfaceElement != nullptr && surfaceElement->GetOwnership() == OWNERSHIP_UNOWNED)
+            {
+                surface = surfaceElement;
+                scanIndex = static_cast<uint32_t>(y * MAXIMUM_MAP_SIZE_TECHNICAL + x);
+            }
+        }
+    }
+    ASSERT_NE(surface, nullptr);
+
+    matched = updateUntil(*gs, 5000, [&]() { return gParkSizeScanPosition > scanIndex; });
+    ASSERT_TRUE(matched);
+    surface->SetOwnership(OWNERSHIP_OWNED);
+
+    matched = updateUntil(*gs, 5000, []() { return gParkSizeScanPosition == 0; });
+    ASSERT_TRUE(matched);
+    ASSERT_EQ(gParkSize, parkSize + 1);
+}